@@ -82,6 +82,7 @@ LOCAL_SRC_FILES                                          := \
     src/core/api/netdata_api.cpp                            \
     src/core/api/server_api.cpp                             \
     src/core/api/tasklet_api.cpp                            \
+    src/core/api/tcp_api.cpp                                \
     src/core/api/thread_api.cpp                             \
     src/core/api/thread_ftd_api.cpp                         \
     src/core/api/udp_api.cpp                                \
@@ -89,7 +90,9 @@ LOCAL_SRC_FILES                                          := \
     src/core/coap/coap_header.cpp                           \
     src/core/coap/coap_secure.cpp                           \
     src/core/common/crc16.cpp                               \
+    src/core/common/handler_profiler.cpp                    \
     src/core/common/instance.cpp                            \
+    src/core/common/log_buffer.cpp                          \
     src/core/common/logging.cpp                             \
     src/core/common/locator.cpp                             \
     src/core/common/message.cpp                             \
@@ -110,6 +113,7 @@ LOCAL_SRC_FILES                                          := \
     src/core/mac/mac.cpp                                    \
     src/core/mac/mac_filter.cpp                             \
     src/core/mac/mac_frame.cpp                              \
+    src/core/mac/mac_tsch.cpp                               \
     src/core/meshcop/announce_begin_client.cpp              \
     src/core/meshcop/border_agent.cpp                       \
     src/core/meshcop/commissioner.cpp                       \
@@ -137,6 +141,7 @@ LOCAL_SRC_FILES                                          := \
     src/core/net/ip6_mpl.cpp                                \
     src/core/net/ip6_routes.cpp                             \
     src/core/net/netif.cpp                                  \
+    src/core/net/tcp.cpp                                    \
     src/core/net/udp6.cpp                                   \
     src/core/thread/address_resolver.cpp                    \
     src/core/thread/announce_begin_server.cpp               \
@@ -250,9 +255,11 @@ LOCAL_LDLIBS                               := \
 
 LOCAL_SRC_FILES                            := \
     src/cli/cli.cpp                           \
+    src/cli/cli_benchmark.cpp                 \
     src/cli/cli_coap.cpp                      \
     src/cli/cli_console.cpp                   \
     src/cli/cli_dataset.cpp                   \
+    src/cli/cli_perf.cpp                      \
     src/cli/cli_uart.cpp                      \
     src/cli/cli_udp_example.cpp               \
     src/posix/main.c                          \
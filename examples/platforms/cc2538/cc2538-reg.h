@@ -50,6 +50,13 @@
 #define NVIC_ST_CTRL_INTEN                      0x00000002  // Interrupt Enable
 #define NVIC_ST_CTRL_ENABLE                     0x00000001  // Enable
 
+#define CPU_DWT_CTRL                            0xE0001000  // DWT Control
+#define CPU_DWT_CYCCNT                          0xE0001004  // DWT Current PC Sampler Cycle Count
+#define CPU_CORE_DEMCR                          0xE000EDFC  // Debug Exception and Monitor Control
+
+#define CPU_DWT_CTRL_CYCCNTENA                  0x00000001  // Enable the cycle counter
+#define CPU_CORE_DEMCR_TRCENA                   0x01000000  // Enable the DWT and ITM units
+
 #define RFCORE_XREG_SRCMATCH_EN                 0x00000001  // SRCMATCH.SRC_MATCH_EN(1)
 #define RFCORE_XREG_SRCMATCH_AUTOPEND           0x00000002  // SRCMATCH.AUTOPEND(1)
 #define RFCORE_XREG_SRCMATCH_PEND_DATAREQ_ONLY  0x00000004  // SRCMATCH.PEND_DATAREQ_ONLY(1)
@@ -47,3 +47,15 @@ void otPlatWakeHost(void)
 {
     // TODO: implement an operation to wake the host from sleep state.
 }
+
+uint32_t otPlatGetCycleCount(void)
+{
+    // the cycle counter is left disabled until first used, as the trace unit draws power
+    if (!(HWREG(CPU_DWT_CTRL) & CPU_DWT_CTRL_CYCCNTENA))
+    {
+        HWREG(CPU_CORE_DEMCR) |= CPU_CORE_DEMCR_TRCENA;
+        HWREG(CPU_DWT_CTRL) |= CPU_DWT_CTRL_CYCCNTENA;
+    }
+
+    return HWREG(CPU_DWT_CYCCNT);
+}
@@ -34,6 +34,8 @@
 #include "platform-cc2538.h"
 #include <openthread/config.h>
 
+#include "utils/settings_flash.h"
+
 otInstance *sInstance;
 
 void otSysInit(int argc, char *argv[])
@@ -63,4 +65,5 @@ void otSysProcessDrivers(otInstance *aInstance)
     cc2538UartProcess();
     cc2538RadioProcess(aInstance);
     cc2538AlarmProcess(aInstance);
+    utilsSettingsFlashProcess(aInstance);
 }
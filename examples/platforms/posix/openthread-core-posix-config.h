@@ -109,4 +109,14 @@
  */
 #define OPENTHREAD_CONFIG_ENABLE_PLATFORM_USEC_TIMER 1
 
+/**
+ * @def OPENTHREAD_CONFIG_CLI_PERF
+ *
+ * Enable the CLI `perf` command so simulation test scripts can measure throughput and latency.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_CLI_PERF
+#define OPENTHREAD_CONFIG_CLI_PERF 1
+#endif
+
 #endif // OPENTHREAD_CORE_POSIX_CONFIG_H_
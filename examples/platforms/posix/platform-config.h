@@ -41,3 +41,36 @@
 #ifndef OPENTHREAD_POSIX_UART_BAUDRATE
 #define OPENTHREAD_POSIX_UART_BAUDRATE B115200
 #endif
+
+/**
+ * @def OPENTHREAD_POSIX_RADIO_MULTICAST
+ *
+ * Define as 1 to exchange simulated radio frames through a loopback multicast group.
+ *
+ * Each frame is then sent once instead of once per node, and node ids are no longer limited to `WELLKNOWN_NODE_ID`.
+ * Nodes sharing a `PORT_OFFSET` join the same group port.
+ *
+ */
+#ifndef OPENTHREAD_POSIX_RADIO_MULTICAST
+#define OPENTHREAD_POSIX_RADIO_MULTICAST 0
+#endif
+
+/**
+ * @def OPENTHREAD_POSIX_RADIO_MULTICAST_GROUP
+ *
+ * The IPv4 multicast group of the simulated radio when `OPENTHREAD_POSIX_RADIO_MULTICAST` is enabled.
+ *
+ */
+#ifndef OPENTHREAD_POSIX_RADIO_MULTICAST_GROUP
+#define OPENTHREAD_POSIX_RADIO_MULTICAST_GROUP "224.0.0.116"
+#endif
+
+/**
+ * @def OPENTHREAD_POSIX_RADIO_RX_LOSS_PERCENT
+ *
+ * The percentage of simulated radio frames from other nodes which are randomly dropped on receive.
+ *
+ */
+#ifndef OPENTHREAD_POSIX_RADIO_RX_LOSS_PERCENT
+#define OPENTHREAD_POSIX_RADIO_RX_LOSS_PERCENT 0
+#endif
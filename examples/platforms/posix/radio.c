@@ -122,6 +122,10 @@ static uint16_t sShortAddress;
 static uint16_t sPanid;
 static uint16_t sPortOffset = 0;
 static int      sSockFd;
+#if OPENTHREAD_POSIX_RADIO_MULTICAST
+static int      sTxSockFd; ///< Sends to the multicast group, its port identifies frames sent by this node.
+static uint16_t sTxPort;
+#endif
 static bool     sPromiscuous = false;
 static bool     sAckWait     = false;
 static int8_t   sTxPower     = 0;
@@ -380,6 +384,58 @@ void otPlatRadioSetPromiscuous(otInstance *aInstance, bool aEnable)
     sPromiscuous = aEnable;
 }
 
+#if OPENTHREAD_POSIX_RADIO_MULTICAST
+static void radioInitMulticast(void)
+{
+    struct sockaddr_in sockaddr;
+    struct ip_mreq     mreq;
+    socklen_t          socklen = sizeof(sockaddr);
+    int                one     = 1;
+    unsigned char      loop    = 1;
+
+    memset(&sockaddr, 0, sizeof(sockaddr));
+    sockaddr.sin_family      = AF_INET;
+    sockaddr.sin_port        = htons(9000 + sPortOffset);
+    sockaddr.sin_addr.s_addr = INADDR_ANY;
+
+    memset(&mreq, 0, sizeof(mreq));
+    inet_pton(AF_INET, OPENTHREAD_POSIX_RADIO_MULTICAST_GROUP, &mreq.imr_multiaddr);
+    inet_pton(AF_INET, "127.0.0.1", &mreq.imr_interface);
+
+    // All nodes receive on the group port.
+    sSockFd = (int)socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+
+    if (sSockFd == -1 || setsockopt(sSockFd, SOL_SOCKET, SO_REUSEADDR, (const char *)&one, sizeof(one)) == -1 ||
+#ifdef SO_REUSEPORT
+        setsockopt(sSockFd, SOL_SOCKET, SO_REUSEPORT, (const char *)&one, sizeof(one)) == -1 ||
+#endif
+        bind(sSockFd, (struct sockaddr *)&sockaddr, sizeof(sockaddr)) == -1 ||
+        setsockopt(sSockFd, IPPROTO_IP, IP_ADD_MEMBERSHIP, (const char *)&mreq, sizeof(mreq)) == -1)
+    {
+        perror("radio multicast receive socket");
+        exit(EXIT_FAILURE);
+    }
+
+    // Each node sends from its own ephemeral port, through loopback.
+    sockaddr.sin_port = 0;
+    sockaddr.sin_addr = mreq.imr_interface;
+    sTxSockFd         = (int)socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+
+    if (sTxSockFd == -1 ||
+        setsockopt(sTxSockFd, IPPROTO_IP, IP_MULTICAST_IF, (const char *)&mreq.imr_interface,
+                   sizeof(mreq.imr_interface)) == -1 ||
+        setsockopt(sTxSockFd, IPPROTO_IP, IP_MULTICAST_LOOP, (const char *)&loop, sizeof(loop)) == -1 ||
+        bind(sTxSockFd, (struct sockaddr *)&sockaddr, sizeof(sockaddr)) == -1 ||
+        getsockname(sTxSockFd, (struct sockaddr *)&sockaddr, &socklen) == -1)
+    {
+        perror("radio multicast send socket");
+        exit(EXIT_FAILURE);
+    }
+
+    sTxPort = ntohs(sockaddr.sin_port);
+}
+#endif // OPENTHREAD_POSIX_RADIO_MULTICAST
+
 void platformRadioInit(void)
 {
     struct sockaddr_in sockaddr;
@@ -404,6 +460,10 @@ void platformRadioInit(void)
         sPortOffset *= WELLKNOWN_NODE_ID;
     }
 
+#if OPENTHREAD_POSIX_RADIO_MULTICAST
+    radioInitMulticast();
+    (void)sockaddr;
+#else
     if (sPromiscuous)
     {
         sockaddr.sin_port = htons(9000 + sPortOffset + WELLKNOWN_NODE_ID);
@@ -428,6 +488,7 @@ void platformRadioInit(void)
         perror("bind");
         exit(EXIT_FAILURE);
     }
+#endif // OPENTHREAD_POSIX_RADIO_MULTICAST
 
     sReceiveFrame.mPsdu  = sReceiveMessage.mPsdu;
     sTransmitFrame.mPsdu = sTransmitMessage.mPsdu;
@@ -445,6 +506,9 @@ void platformRadioInit(void)
 void platformRadioDeinit(void)
 {
     close(sSockFd);
+#if OPENTHREAD_POSIX_RADIO_MULTICAST
+    close(sTxSockFd);
+#endif
 }
 
 bool otPlatRadioIsEnabled(otInstance *aInstance)
@@ -563,8 +627,13 @@ bool otPlatRadioGetPromiscuous(otInstance *aInstance)
 
 void radioReceive(otInstance *aInstance)
 {
-    bool    isAck;
-    ssize_t rval = recvfrom(sSockFd, (char *)&sReceiveMessage, sizeof(sReceiveMessage), 0, NULL, NULL);
+    bool               isAck;
+    struct sockaddr_in sockaddr;
+    socklen_t          socklen = sizeof(sockaddr);
+    ssize_t            rval;
+
+    rval = recvfrom(sSockFd, (char *)&sReceiveMessage, sizeof(sReceiveMessage), 0, (struct sockaddr *)&sockaddr,
+                    &socklen);
 
     if (rval < 0)
     {
@@ -572,6 +641,15 @@ void radioReceive(otInstance *aInstance)
         exit(EXIT_FAILURE);
     }
 
+#if OPENTHREAD_POSIX_RADIO_MULTICAST
+    // Frames sent by this node are looped back by the multicast group.
+    otEXPECT(ntohs(sockaddr.sin_port) != sTxPort);
+#endif
+
+#if OPENTHREAD_POSIX_RADIO_RX_LOSS_PERCENT
+    otEXPECT(otPlatRandomGet() % 100 >= OPENTHREAD_POSIX_RADIO_RX_LOSS_PERCENT);
+#endif
+
     if (otPlatRadioGetPromiscuous(aInstance))
     {
         // Timestamp
@@ -600,6 +678,11 @@ void radioReceive(otInstance *aInstance)
     {
         radioProcessFrame(aInstance);
     }
+
+#if OPENTHREAD_POSIX_RADIO_MULTICAST || OPENTHREAD_POSIX_RADIO_RX_LOSS_PERCENT
+exit:
+    return;
+#endif
 }
 
 void radioSendMessage(otInstance *aInstance)
@@ -723,6 +806,20 @@ void radioTransmit(struct RadioMessage *aMessage, const struct otRadioFrame *aFr
 
     memset(&sockaddr, 0, sizeof(sockaddr));
     sockaddr.sin_family = AF_INET;
+
+#if OPENTHREAD_POSIX_RADIO_MULTICAST
+    inet_pton(AF_INET, OPENTHREAD_POSIX_RADIO_MULTICAST_GROUP, &sockaddr.sin_addr);
+    sockaddr.sin_port = htons(9000 + sPortOffset);
+
+    if (sendto(sTxSockFd, (const char *)aMessage, 1 + aFrame->mLength, 0, (struct sockaddr *)&sockaddr,
+               sizeof(sockaddr)) < 0)
+    {
+        perror("sendto");
+        exit(EXIT_FAILURE);
+    }
+
+    (void)i;
+#else
     inet_pton(AF_INET, "127.0.0.1", &sockaddr.sin_addr);
 
     for (i = 1; i <= WELLKNOWN_NODE_ID; i++)
@@ -744,6 +841,7 @@ void radioTransmit(struct RadioMessage *aMessage, const struct otRadioFrame *aFr
             exit(EXIT_FAILURE);
         }
     }
+#endif // OPENTHREAD_POSIX_RADIO_MULTICAST
 }
 
 void radioSendAck(void)
@@ -45,6 +45,17 @@ static uint32_t sState = 1;
 
 void platformRandomInit(void)
 {
+#if OPENTHREAD_POSIX_VIRTUAL_TIME
+    const char *seed = getenv("RANDOM_SEED");
+
+    if (seed != NULL)
+    {
+        // A fixed seed makes a discrete-event simulation reproducible, while each node keeps its own sequence.
+        sState = ((uint32_t)strtoul(seed, NULL, 0) * WELLKNOWN_NODE_ID + gNodeId) % 0x7ffffffe + 1;
+        return;
+    }
+#endif
+
 #if __SANITIZE_ADDRESS__ == 0
 
     otError error;
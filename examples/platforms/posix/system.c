@@ -92,7 +92,11 @@ void otSysInit(int aArgCount, char *aArgVector[])
 
     gNodeId = (uint32_t)strtol(aArgVector[1], &endptr, 0);
 
+#if OPENTHREAD_POSIX_RADIO_MULTICAST
+    if (*endptr != '\0' || gNodeId < 1)
+#else
     if (*endptr != '\0' || gNodeId < 1 || gNodeId >= WELLKNOWN_NODE_ID)
+#endif
     {
         fprintf(stderr, "Invalid NodeId: %s\n", aArgVector[1]);
         exit(EXIT_FAILURE);
@@ -0,0 +1,185 @@
+/*
+ *  Copyright (c) 2019, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements a lock-free OpenThread platform message pool.
+ *
+ * The free buffers are kept on a Treiber stack. The stack head packs the index of the top buffer together with a
+ * modification tag into a single 32-bit word, so that it is updated with one compare-and-swap and a pop racing with
+ * a pop and push of the same buffer (ABA) is detected. The links are kept outside of the buffers, since OpenThread
+ * owns the buffer content while a buffer is allocated.
+ *
+ * `otPlatMessagePoolNew()` and `otPlatMessagePoolFree()` may be called concurrently from any thread or interrupt
+ * context, e.g., by a radio driver allocating receive buffers while the stack runs on another thread. The pool is
+ * shared by all OpenThread instances.
+ *
+ */
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <openthread-core-config.h>
+
+#include <openthread/platform/messagepool.h>
+
+#include "utils/code_utils.h"
+
+#if OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT
+
+/**
+ * @def MESSAGE_POOL_CONFIG_NUM_BUFFERS
+ *
+ * The number of buffers in the platform message pool.
+ *
+ */
+#ifndef MESSAGE_POOL_CONFIG_NUM_BUFFERS
+#define MESSAGE_POOL_CONFIG_NUM_BUFFERS OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS
+#endif
+
+#if MESSAGE_POOL_CONFIG_NUM_BUFFERS >= 0xffff
+#error "MESSAGE_POOL_CONFIG_NUM_BUFFERS must be less than 0xffff."
+#endif
+
+#define MESSAGE_POOL_INDEX_NONE 0xffff
+#define MESSAGE_POOL_INDEX_MASK 0x0000ffffU
+#define MESSAGE_POOL_TAG_INCREMENT 0x00010000U
+
+typedef union messagePoolBuffer
+{
+    uint8_t  mData[OPENTHREAD_CONFIG_MESSAGE_BUFFER_SIZE];
+    void *   mAlignPointer;
+    uint64_t mAlignUint64;
+} messagePoolBuffer;
+
+static messagePoolBuffer sBuffers[MESSAGE_POOL_CONFIG_NUM_BUFFERS];
+static uint16_t          sNext[MESSAGE_POOL_CONFIG_NUM_BUFFERS];
+static uint32_t          sHead = MESSAGE_POOL_INDEX_NONE; // Tag (upper 16 bits) and index (lower 16 bits) of top.
+static uint32_t          sNumFreeBuffers;
+static bool              sInitialized;
+
+static uint32_t nextHead(uint32_t aHead, uint16_t aIndex)
+{
+    return ((aHead & ~MESSAGE_POOL_INDEX_MASK) + MESSAGE_POOL_TAG_INCREMENT) | aIndex;
+}
+
+static uint16_t popFreeBuffer(void)
+{
+    uint32_t head = __atomic_load_n(&sHead, __ATOMIC_ACQUIRE);
+    uint16_t index;
+    uint16_t next;
+
+    do
+    {
+        index = (uint16_t)(head & MESSAGE_POOL_INDEX_MASK);
+        otEXPECT(index != MESSAGE_POOL_INDEX_NONE);
+
+        // `next` may be stale if another context popped the buffer meanwhile, in which case the tag has changed and
+        // the compare-and-swap fails.
+        next = __atomic_load_n(&sNext[index], __ATOMIC_RELAXED);
+    } while (
+        !__atomic_compare_exchange_n(&sHead, &head, nextHead(head, next), true, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE));
+
+    __atomic_fetch_sub(&sNumFreeBuffers, 1, __ATOMIC_RELAXED);
+
+exit:
+    return index;
+}
+
+static void pushFreeBuffer(uint16_t aIndex)
+{
+    uint32_t head = __atomic_load_n(&sHead, __ATOMIC_RELAXED);
+
+    do
+    {
+        __atomic_store_n(&sNext[aIndex], (uint16_t)(head & MESSAGE_POOL_INDEX_MASK), __ATOMIC_RELAXED);
+    } while (!__atomic_compare_exchange_n(&sHead, &head, nextHead(head, aIndex), true, __ATOMIC_RELEASE,
+                                          __ATOMIC_RELAXED));
+
+    __atomic_fetch_add(&sNumFreeBuffers, 1, __ATOMIC_RELAXED);
+}
+
+void otPlatMessagePoolInit(otInstance *aInstance, uint16_t aMinNumFreeBuffers, size_t aBufferSize)
+{
+    (void)aInstance;
+
+    assert(aMinNumFreeBuffers <= MESSAGE_POOL_CONFIG_NUM_BUFFERS);
+    assert(aBufferSize <= sizeof(messagePoolBuffer));
+    (void)aMinNumFreeBuffers;
+    (void)aBufferSize;
+
+    // The pool is shared, so buffers handed out to another instance must not be put back.
+    otEXPECT(!sInitialized);
+    sInitialized = true;
+
+    for (uint16_t i = 0; i < MESSAGE_POOL_CONFIG_NUM_BUFFERS; i++)
+    {
+        pushFreeBuffer(i);
+    }
+
+exit:
+    return;
+}
+
+otMessage *otPlatMessagePoolNew(otInstance *aInstance)
+{
+    otMessage *buffer = NULL;
+    uint16_t   index;
+
+    (void)aInstance;
+
+    index = popFreeBuffer();
+    otEXPECT(index != MESSAGE_POOL_INDEX_NONE);
+
+    buffer = (otMessage *)&sBuffers[index];
+
+exit:
+    return buffer;
+}
+
+void otPlatMessagePoolFree(otInstance *aInstance, otMessage *aBuffer)
+{
+    messagePoolBuffer *buffer = (messagePoolBuffer *)aBuffer;
+
+    (void)aInstance;
+
+    assert(buffer >= &sBuffers[0] && buffer < &sBuffers[MESSAGE_POOL_CONFIG_NUM_BUFFERS]);
+
+    pushFreeBuffer((uint16_t)(buffer - &sBuffers[0]));
+}
+
+uint16_t otPlatMessagePoolNumFreeBuffers(otInstance *aInstance)
+{
+    (void)aInstance;
+
+    return (uint16_t)__atomic_load_n(&sNumFreeBuffers, __ATOMIC_RELAXED);
+}
+
+#endif // OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT
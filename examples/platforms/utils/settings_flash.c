@@ -45,6 +45,7 @@
 #include "utils/wrap_string.h"
 
 #include "flash.h"
+#include "settings_flash.h"
 
 #define OT_FLASH_BLOCK_ADD_BEGIN_FLAG (1 << 0)
 #define OT_FLASH_BLOCK_ADD_COMPLETE_FLAG (1 << 1)
@@ -97,29 +98,303 @@ struct settingsBlock
 #define SETTINGS_CONFIG_PAGE_NUM 2
 #endif // SETTINGS_CONFIG_PAGE_NUM
 
+/**
+ * @def SETTINGS_CONFIG_AREA_NUM
+ *
+ * The number of areas the settings pages are split into (ignored when there is a single page).
+ *
+ * One area is in use at a time. A swap copies the live settings to the next area, rotating through all of them, so a
+ * larger number spreads the page erases over more pages at the cost of a smaller settings capacity.
+ *
+ */
+#ifndef SETTINGS_CONFIG_AREA_NUM
+#define SETTINGS_CONFIG_AREA_NUM 2
+#endif // SETTINGS_CONFIG_AREA_NUM
+
+/**
+ * @def SETTINGS_CONFIG_IDLE_SWAP_THRESHOLD
+ *
+ * The percentage of the free space left by the last swap that must be used before `utilsSettingsFlashProcess()`
+ * swaps the settings ahead of time.
+ *
+ */
+#ifndef SETTINGS_CONFIG_IDLE_SWAP_THRESHOLD
+#define SETTINGS_CONFIG_IDLE_SWAP_THRESHOLD 75
+#endif // SETTINGS_CONFIG_IDLE_SWAP_THRESHOLD
+
+#if (SETTINGS_CONFIG_PAGE_NUM > 1) && \
+    ((SETTINGS_CONFIG_AREA_NUM < 2) || (SETTINGS_CONFIG_PAGE_NUM % SETTINGS_CONFIG_AREA_NUM))
+#error "SETTINGS_CONFIG_PAGE_NUM must be a multiple of SETTINGS_CONFIG_AREA_NUM, which must be at least 2"
+#endif
+
+#define SETTINGS_AREA_NUM (SETTINGS_CONFIG_PAGE_NUM > 1 ? SETTINGS_CONFIG_AREA_NUM : 1)
+#define SETTINGS_AREA_SIZE (SETTINGS_CONFIG_PAGE_SIZE * SETTINGS_CONFIG_PAGE_NUM / SETTINGS_AREA_NUM)
+#define SETTINGS_AREA_PAGES (SETTINGS_AREA_SIZE / SETTINGS_CONFIG_PAGE_SIZE)
+
+/**
+ * @def SETTINGS_CONFIG_INDEX_SIZE
+ *
+ * The maximum number of settings values tracked by the RAM index (zero disables the index).
+ *
+ * The index maps every stored value to its flash address, so reads do not scan the settings area. If more values are
+ * stored than the index can hold, the index is disabled until the next `otPlatSettingsInit()` and reads fall back to
+ * scanning the flash.
+ *
+ */
+#ifndef SETTINGS_CONFIG_INDEX_SIZE
+#define SETTINGS_CONFIG_INDEX_SIZE 0
+#endif // SETTINGS_CONFIG_INDEX_SIZE
+
 static uint32_t sSettingsBaseAddress;
 static uint32_t sSettingsUsedSize;
+static uint32_t sSwapUsedSize; ///< The used size right after the last swap (or init).
+
+static uint16_t                   sNextAreaBlankPages; ///< The number of leading pages of the next area known blank.
+static bool                       sEraseInProgress;
+static utilsSettingsFlashCounters sCounters;
 
 static uint16_t getAlignLength(uint16_t length)
 {
     return (length + 3) & 0xfffc;
 }
 
+#if SETTINGS_CONFIG_INDEX_SIZE
+struct settingsIndexEntry
+{
+    uint32_t address; ///< The flash address of the settings block.
+    uint16_t key;
+    uint16_t length;
+};
+
+/*
+ * Live values in flash order. A value written with `otPlatSettingsSet()` drops all earlier values of its key (as a
+ * settings swap does), so the entries of a key are exactly its list of values, in index order.
+ */
+static struct settingsIndexEntry sIndex[SETTINGS_CONFIG_INDEX_SIZE];
+static uint16_t                  sIndexCount;
+static bool                      sIndexValid;
+
+/*
+ * The last lookup, so that reading the values of a key one index after the other (e.g. restoring the child table)
+ * continues from the previous position instead of starting over.
+ */
+static uint16_t sCursorKey;
+static int      sCursorIndex = -1;
+static uint16_t sCursorPos;
+
+static void indexRemove(uint16_t aPos)
+{
+    memmove(&sIndex[aPos], &sIndex[aPos + 1], (size_t)(sIndexCount - aPos - 1) * sizeof(sIndex[0]));
+    sIndexCount--;
+    sCursorIndex = -1;
+}
+
+static void indexAdd(uint16_t aKey, bool aIndex0, uint32_t aAddress, uint16_t aLength)
+{
+    otEXPECT(sIndexValid);
+
+    if (aIndex0)
+    {
+        uint16_t pos = 0;
+
+        while (pos < sIndexCount)
+        {
+            if (sIndex[pos].key == aKey)
+            {
+                indexRemove(pos);
+            }
+            else
+            {
+                pos++;
+            }
+        }
+    }
+
+    otEXPECT_ACTION(sIndexCount < SETTINGS_CONFIG_INDEX_SIZE, sIndexValid = false);
+
+    sIndex[sIndexCount].address = aAddress;
+    sIndex[sIndexCount].key     = aKey;
+    sIndex[sIndexCount].length  = aLength;
+    sIndexCount++;
+
+exit:
+    return;
+}
+
+static void indexBuild(void)
+{
+    uint32_t address = sSettingsBaseAddress + OT_SETTINGS_FLAG_SIZE;
+
+    sIndexCount  = 0;
+    sIndexValid  = true;
+    sCursorIndex = -1;
+
+    while (address < (sSettingsBaseAddress + sSettingsUsedSize))
+    {
+        struct settingsBlock block;
+
+        utilsFlashRead(address, (uint8_t *)(&block), sizeof(block));
+
+        if (!(block.flag & OT_FLASH_BLOCK_ADD_COMPLETE_FLAG) && (block.flag & OT_FLASH_BLOCK_DELETE_FLAG))
+        {
+            indexAdd(block.key, !(block.flag & OT_FLASH_BLOCK_INDEX_0_FLAG), address, block.length);
+        }
+
+        address += (getAlignLength(block.length) + sizeof(struct settingsBlock));
+    }
+}
+
+static uint16_t indexFind(uint16_t aKey, int aIndex)
+{
+    uint16_t pos   = 0;
+    int      index = 0;
+
+    if (sCursorIndex >= 0 && sCursorKey == aKey && aIndex > sCursorIndex)
+    {
+        pos   = sCursorPos + 1;
+        index = sCursorIndex + 1;
+    }
+
+    for (; pos < sIndexCount; pos++)
+    {
+        if (sIndex[pos].key != aKey)
+        {
+            continue;
+        }
+
+        if (index == aIndex)
+        {
+            sCursorKey   = aKey;
+            sCursorIndex = aIndex;
+            sCursorPos   = pos;
+            break;
+        }
+
+        index++;
+    }
+
+    return pos;
+}
+
+static void markDeleted(uint32_t aAddress, bool aIndex0)
+{
+    struct settingsBlock block;
+
+    utilsFlashRead(aAddress, (uint8_t *)(&block), sizeof(block));
+
+    if (aIndex0)
+    {
+        block.flag &= (~OT_FLASH_BLOCK_INDEX_0_FLAG);
+    }
+    else
+    {
+        block.flag &= (~OT_FLASH_BLOCK_DELETE_FLAG);
+    }
+
+    utilsFlashWrite(aAddress, (uint8_t *)(&block), sizeof(block));
+}
+
+static otError indexDelete(uint16_t aKey, int aIndex)
+{
+    otError  error = OT_ERROR_NOT_FOUND;
+    uint16_t pos;
+
+    if (aIndex == -1)
+    {
+        pos = 0;
+
+        while (pos < sIndexCount)
+        {
+            if (sIndex[pos].key == aKey)
+            {
+                markDeleted(sIndex[pos].address, false);
+                indexRemove(pos);
+                error = OT_ERROR_NONE;
+            }
+            else
+            {
+                pos++;
+            }
+        }
+
+    }
+    else if ((pos = indexFind(aKey, aIndex)) < sIndexCount)
+    {
+        markDeleted(sIndex[pos].address, false);
+        indexRemove(pos);
+        error = OT_ERROR_NONE;
+
+        // the value that follows the deleted first value becomes the first one
+        if (aIndex == 0 && (pos = indexFind(aKey, 0)) < sIndexCount)
+        {
+            markDeleted(sIndex[pos].address, true);
+        }
+    }
+
+    return error;
+}
+#endif // SETTINGS_CONFIG_INDEX_SIZE
+
 static void setSettingsFlag(uint32_t aBase, uint32_t aFlag)
 {
     utilsFlashWrite(aBase, (uint8_t *)&aFlag, sizeof(aFlag));
 }
 
-static void initSettings(uint32_t aBase, uint32_t aFlag)
+static uint32_t getNextArea(uint32_t aBase)
 {
-    uint32_t address      = aBase;
-    uint32_t settingsSize = SETTINGS_CONFIG_PAGE_NUM > 1 ? SETTINGS_CONFIG_PAGE_SIZE * SETTINGS_CONFIG_PAGE_NUM / 2
-                                                         : SETTINGS_CONFIG_PAGE_SIZE;
+    uint32_t next = aBase + SETTINGS_AREA_SIZE;
 
-    while (address < (aBase + settingsSize))
+    if (next >= SETTINGS_CONFIG_BASE_ADDRESS + SETTINGS_CONFIG_PAGE_SIZE * SETTINGS_CONFIG_PAGE_NUM)
+    {
+        next = SETTINGS_CONFIG_BASE_ADDRESS;
+    }
+
+    return next;
+}
+
+static void finishErase(void)
+{
+    otEXPECT(sEraseInProgress);
+
+    utilsFlashStatusWait(1000);
+    sEraseInProgress = false;
+    sNextAreaBlankPages++;
+
+exit:
+    return;
+}
+
+static bool isPageBlank(uint32_t aAddress)
+{
+    bool     blank = true;
+    uint32_t buffer[8];
+
+    for (uint32_t offset = 0; offset < SETTINGS_CONFIG_PAGE_SIZE && blank; offset += sizeof(buffer))
+    {
+        utilsFlashRead(aAddress + offset, (uint8_t *)buffer, sizeof(buffer));
+
+        for (uint8_t i = 0; i < sizeof(buffer) / sizeof(buffer[0]); i++)
+        {
+            if (buffer[i] != 0xffffffff)
+            {
+                blank = false;
+                break;
+            }
+        }
+    }
+
+    return blank;
+}
+
+static void initSettings(uint32_t aBase, uint32_t aFlag, uint16_t aBlankPages)
+{
+    uint32_t address = aBase + aBlankPages * SETTINGS_CONFIG_PAGE_SIZE;
+
+    while (address < (aBase + SETTINGS_AREA_SIZE))
     {
         utilsFlashErasePage(address);
         utilsFlashStatusWait(1000);
+        sCounters.mPageErases++;
         address += SETTINGS_CONFIG_PAGE_SIZE;
     }
 
@@ -128,20 +403,21 @@ static void initSettings(uint32_t aBase, uint32_t aFlag)
 
 static uint32_t swapSettingsBlock(otInstance *aInstance)
 {
-    uint32_t oldBase      = sSettingsBaseAddress;
-    uint32_t swapAddress  = oldBase;
-    uint32_t usedSize     = sSettingsUsedSize;
-    uint8_t  pageNum      = SETTINGS_CONFIG_PAGE_NUM;
-    uint32_t settingsSize = pageNum > 1 ? SETTINGS_CONFIG_PAGE_SIZE * pageNum / 2 : SETTINGS_CONFIG_PAGE_SIZE;
+    uint32_t oldBase     = sSettingsBaseAddress;
+    uint32_t swapAddress = oldBase;
+    uint32_t usedSize    = sSettingsUsedSize;
 
     (void)aInstance;
 
-    otEXPECT(pageNum > 1);
+    otEXPECT(SETTINGS_AREA_NUM > 1);
 
-    sSettingsBaseAddress =
-        (swapAddress == SETTINGS_CONFIG_BASE_ADDRESS) ? (swapAddress + settingsSize) : SETTINGS_CONFIG_BASE_ADDRESS;
+    finishErase();
+    sSettingsBaseAddress = getNextArea(oldBase);
 
-    initSettings(sSettingsBaseAddress, (uint32_t)OT_SETTINGS_IN_SWAP);
+    // pages already erased by `utilsSettingsFlashProcess()` are not erased again
+    initSettings(sSettingsBaseAddress, (uint32_t)OT_SETTINGS_IN_SWAP, sNextAreaBlankPages);
+    sNextAreaBlankPages = 0;
+    sCounters.mSwaps++;
     sSettingsUsedSize = OT_SETTINGS_FLAG_SIZE;
     swapAddress += OT_SETTINGS_FLAG_SIZE;
 
@@ -197,9 +473,14 @@ static uint32_t swapSettingsBlock(otInstance *aInstance)
 
     setSettingsFlag(sSettingsBaseAddress, (uint32_t)OT_SETTINGS_IN_USE);
     setSettingsFlag(oldBase, (uint32_t)OT_SETTINGS_NOT_USED);
+    sSwapUsedSize = sSettingsUsedSize;
+
+#if SETTINGS_CONFIG_INDEX_SIZE
+    indexBuild();
+#endif
 
 exit:
-    return settingsSize - sSettingsUsedSize;
+    return SETTINGS_AREA_SIZE - sSettingsUsedSize;
 }
 
 static otError addSetting(otInstance *   aInstance,
@@ -215,8 +496,8 @@ static otError addSetting(otInstance *   aInstance,
         struct settingsBlock block;
         uint8_t              data[OT_SETTINGS_BLOCK_DATA_SIZE];
     } OT_TOOL_PACKED_END addBlock;
-    uint32_t settingsSize = SETTINGS_CONFIG_PAGE_NUM > 1 ? SETTINGS_CONFIG_PAGE_SIZE * SETTINGS_CONFIG_PAGE_NUM / 2
-                                                         : SETTINGS_CONFIG_PAGE_SIZE;
+
+    finishErase();
 
     addBlock.block.flag = 0xff;
     addBlock.block.key  = aKey;
@@ -229,7 +510,8 @@ static otError addSetting(otInstance *   aInstance,
     addBlock.block.flag &= (~OT_FLASH_BLOCK_ADD_BEGIN_FLAG);
     addBlock.block.length = aValueLength;
 
-    if ((sSettingsUsedSize + getAlignLength(addBlock.block.length) + sizeof(struct settingsBlock)) >= settingsSize)
+    if ((sSettingsUsedSize + getAlignLength(addBlock.block.length) + sizeof(struct settingsBlock)) >=
+        SETTINGS_AREA_SIZE)
     {
         otEXPECT_ACTION(swapSettingsBlock(aInstance) >=
                             (getAlignLength(addBlock.block.length) + sizeof(struct settingsBlock)),
@@ -248,6 +530,9 @@ static otError addSetting(otInstance *   aInstance,
     addBlock.block.flag &= (~OT_FLASH_BLOCK_ADD_COMPLETE_FLAG);
     utilsFlashWrite(sSettingsBaseAddress + sSettingsUsedSize, (uint8_t *)(&addBlock.block),
                     sizeof(struct settingsBlock));
+#if SETTINGS_CONFIG_INDEX_SIZE
+    indexAdd(aKey, aIndex0, sSettingsBaseAddress + sSettingsUsedSize, aValueLength);
+#endif
     sSettingsUsedSize += (sizeof(struct settingsBlock) + getAlignLength(addBlock.block.length));
 
 exit:
@@ -257,21 +542,20 @@ exit:
 // settings API
 void otPlatSettingsInit(otInstance *aInstance)
 {
-    uint8_t  index;
-    uint32_t settingsSize = SETTINGS_CONFIG_PAGE_NUM > 1 ? SETTINGS_CONFIG_PAGE_SIZE * SETTINGS_CONFIG_PAGE_NUM / 2
-                                                         : SETTINGS_CONFIG_PAGE_SIZE;
+    uint8_t index;
 
     (void)aInstance;
 
-    sSettingsBaseAddress = SETTINGS_CONFIG_BASE_ADDRESS;
+    finishErase();
+    sNextAreaBlankPages = 0;
 
     utilsFlashInit();
 
-    for (index = 0; index < 2; index++)
+    for (index = 0; index < SETTINGS_AREA_NUM; index++)
     {
         uint32_t blockFlag;
 
-        sSettingsBaseAddress += settingsSize * index;
+        sSettingsBaseAddress = SETTINGS_CONFIG_BASE_ADDRESS + SETTINGS_AREA_SIZE * index;
         utilsFlashRead(sSettingsBaseAddress, (uint8_t *)(&blockFlag), sizeof(blockFlag));
 
         if (blockFlag == OT_SETTINGS_IN_USE)
@@ -280,14 +564,14 @@ void otPlatSettingsInit(otInstance *aInstance)
         }
     }
 
-    if (index == 2)
+    if (index == SETTINGS_AREA_NUM)
     {
-        initSettings(sSettingsBaseAddress, (uint32_t)OT_SETTINGS_IN_USE);
+        initSettings(sSettingsBaseAddress, (uint32_t)OT_SETTINGS_IN_USE, 0);
     }
 
     sSettingsUsedSize = OT_SETTINGS_FLAG_SIZE;
 
-    while (sSettingsUsedSize < settingsSize)
+    while (sSettingsUsedSize < SETTINGS_AREA_SIZE)
     {
         struct settingsBlock block;
 
@@ -302,6 +586,12 @@ void otPlatSettingsInit(otInstance *aInstance)
             break;
         }
     }
+
+    sSwapUsedSize = sSettingsUsedSize;
+
+#if SETTINGS_CONFIG_INDEX_SIZE
+    indexBuild();
+#endif
 }
 
 otError otPlatSettingsBeginChange(otInstance *aInstance)
@@ -331,6 +621,36 @@ otError otPlatSettingsGet(otInstance *aInstance, uint16_t aKey, int aIndex, uint
 
     (void)aInstance;
 
+    finishErase();
+
+#if SETTINGS_CONFIG_INDEX_SIZE
+    if (sIndexValid)
+    {
+        uint16_t pos = indexFind(aKey, aIndex);
+
+        if (pos < sIndexCount)
+        {
+            uint16_t readLength = sIndex[pos].length;
+
+            if (aValue != NULL && aValueLength != NULL)
+            {
+                if (readLength > *aValueLength)
+                {
+                    readLength = *aValueLength;
+                }
+
+                utilsFlashRead(sIndex[pos].address + sizeof(struct settingsBlock), aValue, readLength);
+            }
+
+            valueLength = sIndex[pos].length;
+            error       = OT_ERROR_NONE;
+        }
+
+        // skip the flash scan below
+        address = sSettingsBaseAddress + sSettingsUsedSize;
+    }
+#endif
+
     while (address < (sSettingsBaseAddress + sSettingsUsedSize))
     {
         struct settingsBlock block;
@@ -403,6 +723,12 @@ otError otPlatSettingsDelete(otInstance *aInstance, uint16_t aKey, int aIndex)
 
     (void)aInstance;
 
+    finishErase();
+
+#if SETTINGS_CONFIG_INDEX_SIZE
+    otEXPECT_ACTION(!sIndexValid, error = indexDelete(aKey, aIndex));
+#endif
+
     while (address < (sSettingsBaseAddress + sSettingsUsedSize))
     {
         struct settingsBlock block;
@@ -438,11 +764,60 @@ otError otPlatSettingsDelete(otInstance *aInstance, uint16_t aKey, int aIndex)
         address += (getAlignLength(block.length) + sizeof(struct settingsBlock));
     }
 
+#if SETTINGS_CONFIG_INDEX_SIZE
+exit:
+#endif
     return error;
 }
 
 void otPlatSettingsWipe(otInstance *aInstance)
 {
-    initSettings(sSettingsBaseAddress, (uint32_t)OT_SETTINGS_IN_USE);
+    finishErase();
+    initSettings(sSettingsBaseAddress, (uint32_t)OT_SETTINGS_IN_USE, 0);
     otPlatSettingsInit(aInstance);
 }
+
+void utilsSettingsFlashProcess(otInstance *aInstance)
+{
+    uint32_t nextBase = getNextArea(sSettingsBaseAddress);
+
+    otEXPECT(SETTINGS_AREA_NUM > 1);
+
+    if (sEraseInProgress)
+    {
+        otEXPECT(utilsFlashStatusWait(0) == OT_ERROR_NONE);
+        sEraseInProgress = false;
+        sNextAreaBlankPages++;
+    }
+
+    if (sNextAreaBlankPages < SETTINGS_AREA_PAGES)
+    {
+        uint32_t address = nextBase + sNextAreaBlankPages * SETTINGS_CONFIG_PAGE_SIZE;
+
+        if (isPageBlank(address))
+        {
+            sNextAreaBlankPages++;
+        }
+        else if (utilsFlashErasePage(address) == OT_ERROR_NONE)
+        {
+            sEraseInProgress = true;
+            sCounters.mPageErases++;
+            sCounters.mIdlePageErases++;
+        }
+    }
+    else if ((SETTINGS_AREA_SIZE - sSettingsUsedSize) * 100 <=
+             (SETTINGS_AREA_SIZE - sSwapUsedSize) * (100 - SETTINGS_CONFIG_IDLE_SWAP_THRESHOLD))
+    {
+        // the next area is blank, so this swap only copies the live settings
+        sCounters.mIdleSwaps++;
+        swapSettingsBlock(aInstance);
+    }
+
+exit:
+    return;
+}
+
+const utilsSettingsFlashCounters *utilsSettingsFlashGetCounters(void)
+{
+    return &sCounters;
+}
@@ -0,0 +1,84 @@
+/*
+ *  Copyright (c) 2018, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * @brief
+ *   This file defines the maintenance interface of the flash based settings (settings_flash.c).
+ */
+
+#ifndef UTILS_SETTINGS_FLASH_H
+#define UTILS_SETTINGS_FLASH_H
+
+#include <stdint.h>
+
+#include <openthread/instance.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * This structure represents the flash maintenance counters of the settings (since the last reset).
+ *
+ */
+typedef struct utilsSettingsFlashCounters
+{
+    uint32_t mPageErases;     ///< Number of settings pages erased.
+    uint32_t mIdlePageErases; ///< Number of those pages erased ahead of time by `utilsSettingsFlashProcess()`.
+    uint32_t mSwaps;          ///< Number of times the live settings were copied to the next area.
+    uint32_t mIdleSwaps;      ///< Number of those copies started by `utilsSettingsFlashProcess()`.
+} utilsSettingsFlashCounters;
+
+/**
+ * Perform one step of settings flash maintenance.
+ *
+ * Each call does at most one bounded piece of work: it starts erasing one page of the area the settings move to on the
+ * next swap, or, once that area is blank and the current area is filled above `SETTINGS_CONFIG_IDLE_SWAP_THRESHOLD`,
+ * copies the live settings over. Swaps triggered by a write then rarely need to erase pages.
+ *
+ * The platform should call this function from its driver process loop, when the radio is idle.
+ *
+ * @param[in]  aInstance  The OpenThread instance structure.
+ *
+ */
+void utilsSettingsFlashProcess(otInstance *aInstance);
+
+/**
+ * Get the settings flash maintenance counters.
+ *
+ * @returns A pointer to the counters.
+ *
+ */
+const utilsSettingsFlashCounters *utilsSettingsFlashGetCounters(void);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // UTILS_SETTINGS_FLASH_H
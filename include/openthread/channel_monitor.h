@@ -63,6 +63,21 @@ extern "C" {
  *
  */
 
+/**
+ * This structure represents a summary of the RSSI samples of a channel.
+ *
+ * The median and 90th percentile are approximated from a histogram with 8 dB wide bins, and give more weight to the
+ * recent samples.
+ *
+ */
+typedef struct otChannelMonitorRssiSummary
+{
+    int8_t mMinRssi;          ///< The lowest RSSI sample (dBm).
+    int8_t mMaxRssi;          ///< The highest RSSI sample (dBm).
+    int8_t mMedianRssi;       ///< The median RSSI (dBm).
+    int8_t mPercentile90Rssi; ///< The 90th percentile RSSI (dBm).
+} otChannelMonitorRssiSummary;
+
 /**
  * This function enables/disables the Channel Monitoring operation.
  *
@@ -155,6 +170,39 @@ uint32_t otChannelMonitorGetSampleCount(otInstance *aInstance);
  */
 uint16_t otChannelMonitorGetChannelOccupancy(otInstance *aInstance, uint8_t aChannel);
 
+/**
+ * This function gets the short-term channel occupancy for a given channel.
+ *
+ * The short-term occupancy is maintained like the channel occupancy from `otChannelMonitorGetChannelOccupancy()`,
+ * but over the `OPENTHREAD_CONFIG_CHANNEL_MONITOR_SHORT_SAMPLE_WINDOW` window. A short-term occupancy well above the
+ * channel occupancy indicates bursty interference.
+ *
+ * @param[in]  aInstance       A pointer to an OpenThread instance.
+ * @param[in]  aChannel        The channel for which to get the short-term occupancy.
+ *
+ * @returns The short-term channel occupancy for the given channel, or 0 if the short-term occupancy is disabled.
+ *
+ */
+uint16_t otChannelMonitorGetShortTermChannelOccupancy(otInstance *aInstance, uint8_t aChannel);
+
+/**
+ * This function gets the summary of the RSSI samples of a given channel.
+ *
+ * @param[in]   aInstance      A pointer to an OpenThread instance.
+ * @param[in]   aChannel       The channel for which to get the RSSI summary.
+ * @param[out]  aSummary       A pointer to where the RSSI summary is placed.
+ *
+ * @retval OT_ERROR_NONE              Successfully retrieved the RSSI summary.
+ * @retval OT_ERROR_NOT_FOUND         No valid RSSI sample has been taken on the channel.
+ * @retval OT_ERROR_INVALID_ARGS      @p aChannel is not a supported channel.
+ * @retval OT_ERROR_DISABLED_FEATURE  The RSSI histogram (`OPENTHREAD_CONFIG_CHANNEL_MONITOR_RSSI_HISTOGRAM`) is
+ *                                    disabled.
+ *
+ */
+otError otChannelMonitorGetChannelRssiSummary(otInstance *                 aInstance,
+                                              uint8_t                      aChannel,
+                                              otChannelMonitorRssiSummary *aSummary);
+
 /**
  * @}
  *
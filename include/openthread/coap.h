@@ -91,12 +91,13 @@ typedef enum otCoapCode
     OT_COAP_CODE_PUT    = OT_COAP_CODE(0, 3), ///< Put
     OT_COAP_CODE_DELETE = OT_COAP_CODE(0, 4), ///< Delete
 
-    OT_COAP_CODE_RESPONSE_MIN = OT_COAP_CODE(2, 0), ///< 2.00
-    OT_COAP_CODE_CREATED      = OT_COAP_CODE(2, 1), ///< Created
-    OT_COAP_CODE_DELETED      = OT_COAP_CODE(2, 2), ///< Deleted
-    OT_COAP_CODE_VALID        = OT_COAP_CODE(2, 3), ///< Valid
-    OT_COAP_CODE_CHANGED      = OT_COAP_CODE(2, 4), ///< Changed
-    OT_COAP_CODE_CONTENT      = OT_COAP_CODE(2, 5), ///< Content
+    OT_COAP_CODE_RESPONSE_MIN = OT_COAP_CODE(2, 0),  ///< 2.00
+    OT_COAP_CODE_CREATED      = OT_COAP_CODE(2, 1),  ///< Created
+    OT_COAP_CODE_DELETED      = OT_COAP_CODE(2, 2),  ///< Deleted
+    OT_COAP_CODE_VALID        = OT_COAP_CODE(2, 3),  ///< Valid
+    OT_COAP_CODE_CHANGED      = OT_COAP_CODE(2, 4),  ///< Changed
+    OT_COAP_CODE_CONTENT      = OT_COAP_CODE(2, 5),  ///< Content
+    OT_COAP_CODE_CONTINUE     = OT_COAP_CODE(2, 31), ///< RFC7959 Continue
 
     OT_COAP_CODE_BAD_REQUEST         = OT_COAP_CODE(4, 0),  ///< Bad Request
     OT_COAP_CODE_UNAUTHORIZED        = OT_COAP_CODE(4, 1),  ///< Unauthorized
@@ -105,6 +106,7 @@ typedef enum otCoapCode
     OT_COAP_CODE_NOT_FOUND           = OT_COAP_CODE(4, 4),  ///< Not Found
     OT_COAP_CODE_METHOD_NOT_ALLOWED  = OT_COAP_CODE(4, 5),  ///< Method Not Allowed
     OT_COAP_CODE_NOT_ACCEPTABLE      = OT_COAP_CODE(4, 6),  ///< Not Acceptable
+    OT_COAP_CODE_REQUEST_INCOMPLETE  = OT_COAP_CODE(4, 8),  ///< RFC7959 Request Entity Incomplete
     OT_COAP_CODE_PRECONDITION_FAILED = OT_COAP_CODE(4, 12), ///< Precondition Failed
     OT_COAP_CODE_REQUEST_TOO_LARGE   = OT_COAP_CODE(4, 13), ///< Request Entity Too Large
     OT_COAP_CODE_UNSUPPORTED_FORMAT  = OT_COAP_CODE(4, 15), ///< Unsupported Content-Format
@@ -134,6 +136,9 @@ typedef enum otCoapOptionType
     OT_COAP_OPTION_MAX_AGE        = 14, ///< Max-Age
     OT_COAP_OPTION_URI_QUERY      = 15, ///< Uri-Query
     OT_COAP_OPTION_ACCEPT         = 17, ///< Accept
+    OT_COAP_OPTION_BLOCK2         = 23, ///< Block2 (RFC7959)
+    OT_COAP_OPTION_BLOCK1         = 27, ///< Block1 (RFC7959)
+    OT_COAP_OPTION_SIZE2          = 28, ///< Size2 (RFC7959)
     OT_COAP_OPTION_LOCATION_QUERY = 20, ///< Location-Query
     OT_COAP_OPTION_PROXY_URI      = 35, ///< Proxy-Uri
     OT_COAP_OPTION_PROXY_SCHEME   = 39, ///< Proxy-Scheme
@@ -169,6 +174,21 @@ typedef enum otCoapOptionContentFormat
     OT_COAP_OPTION_CONTENT_FORMAT_JWS          = 101 ///< application/json-web-signature
 } otCoapOptionContentFormat;
 
+/**
+ * CoAP Block Size Exponents (RFC 7959).
+ *
+ */
+typedef enum otCoapBlockSize
+{
+    OT_COAP_BLOCK_SIZE_16   = 0, ///< 16 byte blocks
+    OT_COAP_BLOCK_SIZE_32   = 1, ///< 32 byte blocks
+    OT_COAP_BLOCK_SIZE_64   = 2, ///< 64 byte blocks
+    OT_COAP_BLOCK_SIZE_128  = 3, ///< 128 byte blocks
+    OT_COAP_BLOCK_SIZE_256  = 4, ///< 256 byte blocks
+    OT_COAP_BLOCK_SIZE_512  = 5, ///< 512 byte blocks
+    OT_COAP_BLOCK_SIZE_1024 = 6, ///< 1024 byte blocks
+} otCoapBlockSize;
+
 #define OT_COAP_HEADER_MAX_LENGTH 512 ///< Max CoAP header length (bytes)
 
 /**
@@ -240,6 +260,73 @@ typedef struct otCoapResource
     struct otCoapResource *mNext;    ///< The next CoAP resource in the list
 } otCoapResource;
 
+/**
+ * This function pointer is called when a block of a block-wise transfer is received.
+ *
+ * A block larger than `OPENTHREAD_CONFIG_COAP_MAX_BLOCK_LENGTH` is delivered in several consecutive calls.
+ *
+ * @param[in]  aContext      A pointer to application-specific context.
+ * @param[in]  aBlock        A pointer to the received bytes.
+ * @param[in]  aPosition     The position of @p aBlock in the whole transferred content.
+ * @param[in]  aBlockLength  The length of @p aBlock in bytes.
+ * @param[in]  aMore         TRUE if more bytes follow, FALSE if this is the last part of the content.
+ * @param[in]  aTotalLength  The total content length announced by the peer (Size1 or Size2 option), or zero.
+ *
+ * @retval OT_ERROR_NONE     The bytes were consumed, the transfer continues.
+ * @retval OT_ERROR_NO_BUFS  The content is too large for the receiver, the transfer is aborted.
+ * @retval ...               Any other error aborts the transfer.
+ *
+ */
+typedef otError (*otCoapBlockwiseReceiveHook)(void *         aContext,
+                                              const uint8_t *aBlock,
+                                              uint32_t       aPosition,
+                                              uint16_t       aBlockLength,
+                                              bool           aMore,
+                                              uint32_t       aTotalLength);
+
+/**
+ * This function pointer is called when the next block of a block-wise transfer is to be sent.
+ *
+ * @param[in]     aContext      A pointer to application-specific context.
+ * @param[out]    aBlock        A pointer to the buffer to write the block to.
+ * @param[in]     aPosition     The position of the requested block in the whole transferred content.
+ * @param[inout]  aBlockLength  On entry, the size of @p aBlock in bytes. On exit, the number of bytes written.
+ * @param[out]    aMore         Set to TRUE if more blocks follow, FALSE if this is the last block.
+ *
+ * @retval OT_ERROR_NONE  The block was written to @p aBlock.
+ * @retval ...            Any other error aborts the transfer.
+ *
+ */
+typedef otError (*otCoapBlockwiseTransmitHook)(void *    aContext,
+                                               uint8_t * aBlock,
+                                               uint32_t  aPosition,
+                                               uint16_t *aBlockLength,
+                                               bool *    aMore);
+
+/**
+ * This structure represents a CoAP resource with block-wise transfer support.
+ *
+ */
+typedef struct otCoapBlockwiseResource
+{
+    const char *                    mUriPath;      ///< The URI Path string
+    otCoapRequestHandler            mHandler;      ///< The callback for handling a received (last block of) request
+    otCoapBlockwiseReceiveHook      mReceiveHook;  ///< The callback for consuming received Block1 blocks, may be NULL
+    otCoapBlockwiseTransmitHook     mTransmitHook; ///< The callback for producing Block2 blocks, may be NULL
+    void *                          mContext;      ///< Application-specific context
+    struct otCoapBlockwiseResource *mNext;         ///< The next CoAP block-wise resource in the list
+} otCoapBlockwiseResource;
+
+/**
+ * This structure represents the CoAP response cache counters.
+ *
+ */
+typedef struct otCoapResponseCacheCounters
+{
+    uint32_t mHits;      ///< The number of duplicate requests answered from the response cache.
+    uint32_t mEvictions; ///< The number of cached responses removed before their exchange lifetime elapsed.
+} otCoapResponseCacheCounters;
+
 /**
  * This function initializes the CoAP header.
  *
@@ -382,6 +469,46 @@ otError otCoapHeaderAppendMaxAgeOption(otCoapHeader *aHeader, uint32_t aMaxAge);
  */
 otError otCoapHeaderAppendUriQueryOption(otCoapHeader *aHeader, const char *aUriQuery);
 
+/**
+ * This function appends a Block1 option (RFC 7959).
+ *
+ * @param[inout]  aHeader  A pointer to the CoAP header.
+ * @param[in]     aNum     The block number.
+ * @param[in]     aMore    TRUE if more blocks follow.
+ * @param[in]     aSize    The block size exponent.
+ *
+ * @retval OT_ERROR_NONE          Successfully appended the option.
+ * @retval OT_ERROR_INVALID_ARGS  The option type is not equal or greater than the last option type.
+ * @retval OT_ERROR_NO_BUFS       The option length exceeds the buffer size.
+ *
+ */
+otError otCoapHeaderAppendBlock1Option(otCoapHeader *aHeader, uint32_t aNum, bool aMore, otCoapBlockSize aSize);
+
+/**
+ * This function appends a Block2 option (RFC 7959).
+ *
+ * @param[inout]  aHeader  A pointer to the CoAP header.
+ * @param[in]     aNum     The block number.
+ * @param[in]     aMore    TRUE if more blocks follow.
+ * @param[in]     aSize    The block size exponent.
+ *
+ * @retval OT_ERROR_NONE          Successfully appended the option.
+ * @retval OT_ERROR_INVALID_ARGS  The option type is not equal or greater than the last option type.
+ * @retval OT_ERROR_NO_BUFS       The option length exceeds the buffer size.
+ *
+ */
+otError otCoapHeaderAppendBlock2Option(otCoapHeader *aHeader, uint32_t aNum, bool aMore, otCoapBlockSize aSize);
+
+/**
+ * This function converts a block size exponent to the block size in bytes.
+ *
+ * @param[in]  aSize  The block size exponent.
+ *
+ * @returns The block size in bytes.
+ *
+ */
+uint16_t otCoapBlockSizeFromExponent(otCoapBlockSize aSize);
+
 /**
  * This function adds Payload Marker indicating beginning of the payload to the CoAP header.
  *
@@ -519,6 +646,91 @@ otError otCoapSendRequest(otInstance *          aInstance,
                           otCoapResponseHandler aHandler,
                           void *                aContext);
 
+/**
+ * This function sends a CoAP request block-wise (RFC 7959).
+ *
+ * When @p aTransmitHook is not NULL, the request payload is produced block by block by @p aTransmitHook and sent with
+ * Block1 options. @p aMessage must then carry the CoAP header only. A Block1 option with block number zero may be
+ * appended by the caller to select the block size, otherwise the largest supported block size is used.
+ *
+ * When @p aReceiveHook is not NULL, a response carrying a Block2 option is passed to @p aReceiveHook block by block,
+ * and the remaining blocks are requested automatically. @p aHandler is called once the last block was received.
+ *
+ * @note This function requires `OPENTHREAD_CONFIG_ENABLE_COAP_BLOCKWISE_TRANSFER`.
+ *
+ * @param[in]  aInstance      A pointer to an OpenThread instance.
+ * @param[in]  aMessage       A pointer to the message to send.
+ * @param[in]  aMessageInfo   A pointer to the message info associated with @p aMessage.
+ * @param[in]  aHandler       A function pointer that shall be called on response reception or timeout.
+ * @param[in]  aContext       A pointer to arbitrary context information, also passed to the hooks.
+ * @param[in]  aTransmitHook  A function pointer that produces the request blocks, or NULL.
+ * @param[in]  aReceiveHook   A function pointer that consumes the response blocks, or NULL.
+ *
+ * @retval OT_ERROR_NONE     Successfully sent CoAP message.
+ * @retval OT_ERROR_NO_BUFS  Failed to allocate retransmission data.
+ *
+ */
+otError otCoapSendRequestBlockWise(otInstance *                aInstance,
+                                   otMessage *                 aMessage,
+                                   const otMessageInfo *       aMessageInfo,
+                                   otCoapResponseHandler       aHandler,
+                                   void *                      aContext,
+                                   otCoapBlockwiseTransmitHook aTransmitHook,
+                                   otCoapBlockwiseReceiveHook  aReceiveHook);
+
+/**
+ * This function cancels the observation of a CoAP resource (RFC 7641).
+ *
+ * An observation is started by sending a GET request with an Observe option set to zero using `otCoapSendRequest()`.
+ * Each notification is then passed to the response handler of that request, stale notifications being dropped.
+ *
+ * This function deregisters from the server by sending a GET request with an Observe option set to one, and ends the
+ * observation that was started with @p aHandler and @p aContext. The response handler is called with
+ * OT_ERROR_ABORT.
+ *
+ * @note This function requires `OPENTHREAD_CONFIG_ENABLE_COAP_OBSERVE`.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ * @param[in]  aHandler   A function pointer of the observation response handler.
+ * @param[in]  aContext   A pointer to the context information of the observation.
+ *
+ * @retval OT_ERROR_NONE       Successfully cancelled the observation.
+ * @retval OT_ERROR_NOT_FOUND  No observation with @p aHandler and @p aContext was found.
+ * @retval OT_ERROR_NO_BUFS    Insufficient buffers available to send the deregistration.
+ *
+ */
+otError otCoapCancelObserve(otInstance *aInstance, otCoapResponseHandler aHandler, void *aContext);
+
+/**
+ * This function sets the number of outstanding CoAP interactions per destination (NSTART, RFC 7252).
+ *
+ * A confirmable request is outstanding until acknowledged, a non-confirmable request with a response handler until
+ * its response is received or times out. Further requests to the destination are queued and sent in order as
+ * outstanding ones complete.
+ *
+ * @note This function requires `OPENTHREAD_CONFIG_ENABLE_COAP_REQUEST_WINDOW`.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ * @param[in]  aNstart    The number of outstanding interactions per destination, at least one.
+ *
+ * @retval OT_ERROR_NONE          Successfully set the window.
+ * @retval OT_ERROR_INVALID_ARGS  @p aNstart is zero.
+ *
+ */
+otError otCoapSetNstart(otInstance *aInstance, uint8_t aNstart);
+
+/**
+ * This function gets the number of outstanding CoAP interactions per destination (NSTART, RFC 7252).
+ *
+ * @note This function requires `OPENTHREAD_CONFIG_ENABLE_COAP_REQUEST_WINDOW`.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ * @returns The number of outstanding interactions per destination.
+ *
+ */
+uint8_t otCoapGetNstart(otInstance *aInstance);
+
 /**
  * This function starts the CoAP server.
  *
@@ -561,6 +773,35 @@ otError otCoapAddResource(otInstance *aInstance, otCoapResource *aResource);
  */
 void otCoapRemoveResource(otInstance *aInstance, otCoapResource *aResource);
 
+/**
+ * This function adds a block-wise resource to the CoAP server.
+ *
+ * Requests to a block-wise resource carrying a Block1 option are passed to its receive hook block by block and
+ * acknowledged with 2.31 (Continue), and its handler is called with the last block. Requests for Block2 blocks other
+ * than the first are answered from its transmit hook without calling the handler.
+ *
+ * @note This function requires `OPENTHREAD_CONFIG_ENABLE_COAP_BLOCKWISE_TRANSFER`.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ * @param[in]  aResource  A pointer to the block-wise resource.
+ *
+ * @retval OT_ERROR_NONE     Successfully added @p aResource.
+ * @retval OT_ERROR_ALREADY  The @p aResource was already added.
+ *
+ */
+otError otCoapAddBlockWiseResource(otInstance *aInstance, otCoapBlockwiseResource *aResource);
+
+/**
+ * This function removes a block-wise resource from the CoAP server.
+ *
+ * @note This function requires `OPENTHREAD_CONFIG_ENABLE_COAP_BLOCKWISE_TRANSFER`.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ * @param[in]  aResource  A pointer to the block-wise resource.
+ *
+ */
+void otCoapRemoveBlockWiseResource(otInstance *aInstance, otCoapBlockwiseResource *aResource);
+
 /**
  * This function sets the default handler for unhandled CoAP requests.
  *
@@ -571,6 +812,16 @@ void otCoapRemoveResource(otInstance *aInstance, otCoapResource *aResource);
  */
 void otCoapSetDefaultHandler(otInstance *aInstance, otCoapRequestHandler aHandler, void *aContext);
 
+/**
+ * This function gets the response cache counters of the CoAP server.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ * @returns A pointer to the CoAP response cache counters.
+ *
+ */
+const otCoapResponseCacheCounters *otCoapGetResponseCacheCounters(otInstance *aInstance);
+
 /**
  * This function sends a CoAP response from the server.
  *
@@ -584,6 +835,56 @@ void otCoapSetDefaultHandler(otInstance *aInstance, otCoapRequestHandler aHandle
  */
 otError otCoapSendResponse(otInstance *aInstance, otMessage *aMessage, const otMessageInfo *aMessageInfo);
 
+/**
+ * This function sends a CoAP response block-wise (RFC 7959) from the server.
+ *
+ * The first block is produced by @p aTransmitHook and sent with a Block2 option. @p aMessage must carry the CoAP
+ * header only. A Block2 option with block number zero may be appended by the caller to select the block size,
+ * otherwise the largest supported block size is used. The following blocks are requested by the client and served
+ * from the transmit hook of the block-wise resource.
+ *
+ * @note This function requires `OPENTHREAD_CONFIG_ENABLE_COAP_BLOCKWISE_TRANSFER`.
+ *
+ * @param[in]  aInstance      A pointer to an OpenThread instance.
+ * @param[in]  aMessage       A pointer to the CoAP response to send.
+ * @param[in]  aMessageInfo   A pointer to the message info associated with @p aMessage.
+ * @param[in]  aContext       A pointer to arbitrary context information passed to @p aTransmitHook.
+ * @param[in]  aTransmitHook  A function pointer that produces the response blocks.
+ *
+ * @retval OT_ERROR_NONE     Successfully enqueued the CoAP response message.
+ * @retval OT_ERROR_NO_BUFS  Insufficient buffers available to send the CoAP response.
+ *
+ */
+otError otCoapSendResponseBlockWise(otInstance *                aInstance,
+                                    otMessage *                 aMessage,
+                                    const otMessageInfo *       aMessageInfo,
+                                    void *                      aContext,
+                                    otCoapBlockwiseTransmitHook aTransmitHook);
+
+/**
+ * This function sends a notification to all observers of a CoAP resource (RFC 7641).
+ *
+ * A GET request with an Observe option set to zero registers the client as an observer of a resource, and one set to
+ * one deregisters it. Success responses to an observer are sent with an Observe option. Observers which reject a
+ * notification or do not acknowledge a confirmable one are removed.
+ *
+ * @p aMessage is the notification template: a confirmable or non-confirmable header with the response code and
+ * options, and the payload. A copy is sent to every observer of @p aResource with its own Message ID, Token and
+ * Observe option.
+ *
+ * @note This function requires `OPENTHREAD_CONFIG_ENABLE_COAP_OBSERVE`.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ * @param[in]  aResource  A pointer to the observed resource.
+ * @param[in]  aMessage   A pointer to the notification template. It is freed on success.
+ *
+ * @retval OT_ERROR_NONE          Successfully notified the observers.
+ * @retval OT_ERROR_INVALID_ARGS  @p aMessage is not a confirmable or non-confirmable response.
+ * @retval OT_ERROR_NO_BUFS       Insufficient buffers available to send the notifications.
+ *
+ */
+otError otCoapNotifyObservers(otInstance *aInstance, otCoapResource *aResource, otMessage *aMessage);
+
 /**
  * @}
  *
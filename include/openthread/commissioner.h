@@ -217,6 +217,18 @@ typedef void(OTCALL *otCommissionerEnergyReportCallback)(uint32_t       aChannel
                                                          uint8_t        aEnergyListLength,
                                                          void *         aContext);
 
+/**
+ * This structure represents the energy measurements aggregated for one channel across all Energy Reports received
+ * since the last Energy Scan Query.
+ *
+ */
+typedef struct otEnergyScanChannelSummary
+{
+    uint16_t mMeasurementCount; ///< Number of measurements received for the channel
+    int8_t   mMaxRssi;          ///< Highest measured energy (dBm), valid when mMeasurementCount is non-zero
+    int8_t   mAverageRssi;      ///< Average measured energy (dBm), valid when mMeasurementCount is non-zero
+} otEnergyScanChannelSummary;
+
 /**
  * This function sends an Energy Scan Query message.
  *
@@ -245,6 +257,23 @@ OTAPI otError OTCALL otCommissionerEnergyScan(otInstance *
                                               otCommissionerEnergyReportCallback aCallback,
                                               void *                             aContext);
 
+/**
+ * This function gets the per-channel summary of the Energy Reports received since the last Energy Scan Query.
+ *
+ * The summary is updated as each Energy Report arrives, so it can be polled before the scan completes.
+ *
+ * @param[in]   aInstance  A pointer to an OpenThread instance.
+ * @param[in]   aChannel   The channel.
+ * @param[out]  aSummary   A pointer to where the channel summary is placed.
+ *
+ * @retval OT_ERROR_NONE          Successfully retrieved the channel summary.
+ * @retval OT_ERROR_INVALID_ARGS  @p aChannel is not a supported channel.
+ *
+ */
+OTAPI otError OTCALL otCommissionerGetEnergyScanSummary(otInstance *                aInstance,
+                                                        uint8_t                     aChannel,
+                                                        otEnergyScanChannelSummary *aSummary);
+
 /**
  * This function pointer is called when the Commissioner receives a PAN ID Conflict message.
  *
@@ -354,6 +383,29 @@ OTAPI otError OTCALL otCommissionerGeneratePSKc(otInstance *           aInstance
                                                 const otExtendedPanId *aExtPanId,
                                                 uint8_t *              aPSKc);
 
+/**
+ * This method supplies a precomputed PSKc for the given inputs.
+ *
+ * Subsequent calls to otCommissionerGeneratePSKc() with the same inputs return @p aPSKc without running PBKDF2.
+ * Requires `OPENTHREAD_CONFIG_COMMISSIONER_PSKC_CACHE_SIZE` to be non-zero.
+ *
+ * @param[in]  aInstance     A pointer to an OpenThread instance.
+ * @param[in]  aPassPhrase   The commissioning passphrase.
+ * @param[in]  aNetworkName  The network name for PSKc computation.
+ * @param[in]  aExtPanId     The extended pan id for PSKc computation.
+ * @param[in]  aPSKc         A pointer to the precomputed PSKc.
+ *
+ * @retval OT_ERROR_NONE              Successfully cached PSKc.
+ * @retval OT_ERROR_INVALID_ARGS      If any of the input arguments is invalid.
+ * @retval OT_ERROR_DISABLED_FEATURE  The PSKc cache is not enabled.
+ *
+ */
+OTAPI otError OTCALL otCommissionerSetPSKc(otInstance *           aInstance,
+                                           const char *           aPassPhrase,
+                                           const char *           aNetworkName,
+                                           const otExtendedPanId *aExtPanId,
+                                           const uint8_t *        aPSKc);
+
 /**
  * @}
  *
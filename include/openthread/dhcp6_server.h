@@ -48,6 +48,19 @@ extern "C" {
  *
  */
 
+/**
+ * This structure represents the DHCPv6 server counters.
+ *
+ */
+typedef struct otDhcp6ServerCounters
+{
+    uint32_t mSolicits;      ///< The number of Solicit messages received.
+    uint32_t mReplies;       ///< The number of Reply messages sent.
+    uint32_t mDiscards;      ///< The number of Solicit messages discarded as malformed or unsupported.
+    uint32_t mNewLeases;     ///< The number of replies leasing addresses to a new or changed client binding.
+    uint32_t mRenewedLeases; ///< The number of replies repeating the leases of an existing client binding.
+} otDhcp6ServerCounters;
+
 /**
  * Updates DHCP Agents and DHCP Alocs.
  *
@@ -56,6 +69,27 @@ extern "C" {
  */
 void otDhcp6ServerUpdate(otInstance *aInstance);
 
+/**
+ * This function gets the DHCPv6 server counters.
+ *
+ * `mRenewedLeases` is only counted when `OPENTHREAD_CONFIG_DHCP6_SERVER_NUM_BINDINGS` is non-zero, otherwise every
+ * lease is reported as new.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ * @returns A pointer to the DHCPv6 server counters.
+ *
+ */
+const otDhcp6ServerCounters *otDhcp6ServerGetCounters(otInstance *aInstance);
+
+/**
+ * This function resets the DHCPv6 server counters.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ */
+void otDhcp6ServerResetCounters(otInstance *aInstance);
+
 /**
  * @}
  *
@@ -96,6 +96,9 @@ typedef void (*otDnsResponseHandler)(void *        aContext,
  *
  * This function is available only if feature `OPENTHREAD_ENABLE_DNS_CLIENT` is enabled.
  *
+ * When the DNS client cache is enabled (`OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENTRIES`) and holds an unexpired result
+ * for the hostname, @p aHandler is called with the cached result before this function returns.
+ *
  * @param[in]  aInstance   A pointer to an OpenThread instance.
  * @param[in]  aQuery      A pointer to specify DNS query parameters.
  * @param[in]  aHandler    A function pointer that shall be called on response reception or time-out.
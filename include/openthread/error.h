@@ -145,6 +145,8 @@ extern "C" {
  *
  * @defgroup plat-alarm               Alarm
  * @defgroup plat-ble                 BLE Host
+ * @defgroup plat-checksum            Checksum
+ * @defgroup plat-crypto              Crypto
  * @defgroup plat-factory-diagnostics Factory Diagnostics
  * @defgroup plat-logging             Logging
  * @defgroup plat-memory              Memory
@@ -357,6 +357,33 @@ OTAPI void OTCALL otInstanceFactoryReset(otInstance *aInstance);
  */
 otError otInstanceErasePersistentInfo(otInstance *aInstance);
 
+/**
+ * This structure represents the times at which the start-up phases of an OpenThread instance completed.
+ *
+ * All times are in milliseconds, as returned by `otPlatAlarmMilliGetNow()`.
+ *
+ */
+typedef struct otBootTimestamps
+{
+    uint32_t mConstructed;  ///< All the instance subsystems were constructed.
+    uint32_t mSettingsInit; ///< Non-volatile settings were initialized.
+    uint32_t mRestored;     ///< Network information was restored from non-volatile settings.
+    uint32_t mInitDone;     ///< Instance initialization (including auto start) completed.
+    uint32_t mAttached;     ///< The device first attached to a Thread partition (zero until then).
+} otBootTimestamps;
+
+/**
+ * This function gets the times at which the start-up phases of the OpenThread instance completed.
+ *
+ * @note This function requires `OPENTHREAD_CONFIG_ENABLE_BOOT_TIMESTAMPS`.
+ *
+ * @param[in]  aInstance A pointer to an OpenThread instance.
+ *
+ * @returns A pointer to the boot timestamps.
+ *
+ */
+const otBootTimestamps *otInstanceGetBootTimestamps(otInstance *aInstance);
+
 /**
  * This function gets the OpenThread version string.
  *
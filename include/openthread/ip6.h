@@ -182,6 +182,50 @@ typedef struct otMessageInfo
     const void *mLinkInfo;
 } otMessageInfo;
 
+/**
+ * This structure represents the IPv6 fragment reassembly counters.
+ *
+ */
+typedef struct otIp6ReassemblyCounters
+{
+    uint32_t mRxFragments;          ///< The number of received IPv6 fragments handled by reassembly.
+    uint32_t mRxReassembled;        ///< The number of IPv6 datagrams successfully reassembled.
+    uint32_t mRxReassemblyTimeout;  ///< The number of IPv6 datagrams dropped due to reassembly timeout.
+    uint32_t mRxDuplicateFragments; ///< The number of duplicate IPv6 fragments dropped.
+    uint32_t mRxFragmentDrops;      ///< The number of IPv6 fragments dropped (invalid, overlapping, or no resources).
+} otIp6ReassemblyCounters;
+
+/**
+ * This enumeration defines the reasons for which an IPv6 datagram or 6LoWPAN frame is dropped.
+ *
+ */
+typedef enum otIp6DropReason
+{
+    OT_IP6_DROP_REASON_NO_ROUTE      = 0,  ///< No route or next hop to the destination.
+    OT_IP6_DROP_REASON_ADDRESS_QUERY = 1,  ///< Address resolution of the destination failed.
+    OT_IP6_DROP_REASON_REASSEMBLY    = 2,  ///< Reassembly did not complete (timeout or missing fragment).
+    OT_IP6_DROP_REASON_EVICTED       = 3,  ///< Evicted from the send queue to free message buffers.
+    OT_IP6_DROP_REASON_SECURITY      = 4,  ///< Rejected by link security or the IPv6 filter.
+    OT_IP6_DROP_REASON_DUPLICATE     = 5,  ///< Duplicate fragment.
+    OT_IP6_DROP_REASON_NO_BUFS       = 6,  ///< No message buffers available.
+    OT_IP6_DROP_REASON_EXPIRED       = 7,  ///< Message lifetime expired in the send queue.
+    OT_IP6_DROP_REASON_QUEUE_DELAY   = 8,  ///< Dropped by the send queue active queue management.
+    OT_IP6_DROP_REASON_MALFORMED     = 9,  ///< Failed to parse or decompress.
+    OT_IP6_DROP_REASON_OTHER         = 10, ///< Any other reason.
+} otIp6DropReason;
+
+#define OT_IP6_NUM_DROP_REASONS 11 ///< Number of `otIp6DropReason` values.
+
+/**
+ * This structure represents the drop counters of a layer, indexed by `otIp6DropReason`.
+ *
+ */
+typedef struct otIp6DropCounters
+{
+    uint32_t mTx[OT_IP6_NUM_DROP_REASONS]; ///< The number of outgoing datagrams dropped, per reason.
+    uint32_t mRx[OT_IP6_NUM_DROP_REASONS]; ///< The number of incoming datagrams or frames dropped, per reason.
+} otIp6DropCounters;
+
 /**
  * This function brings up the IPv6 interface.
  *
@@ -573,6 +617,39 @@ bool otIp6IsAddressUnspecified(const otIp6Address *aAddress);
  */
 otError otIp6SelectSourceAddress(otInstance *aInstance, otMessageInfo *aMessageInfo);
 
+/**
+ * This function gets the IPv6 fragment reassembly counters.
+ *
+ * @note This function requires `OPENTHREAD_CONFIG_IP6_REASSEMBLY_MAX_DATAGRAMS` to be non-zero.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ * @returns A pointer to the IPv6 fragment reassembly counters.
+ *
+ */
+const otIp6ReassemblyCounters *otIp6GetReassemblyCounters(otInstance *aInstance);
+
+/**
+ * This function gets the IPv6 layer drop counters.
+ *
+ * These counters cover datagrams dropped by the IPv6 layer (forwarding, extension headers, reassembly and payload
+ * handling). Drops in the Thread mesh layer are reported by `otThreadGetDropCounters()`.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ * @returns A pointer to the IPv6 layer drop counters.
+ *
+ */
+const otIp6DropCounters *otIp6GetDropCounters(otInstance *aInstance);
+
+/**
+ * This function resets the IPv6 layer drop counters.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ */
+void otIp6ResetDropCounters(otInstance *aInstance);
+
 /**
  * @}
  *
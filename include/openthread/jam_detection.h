@@ -192,6 +192,19 @@ bool otJamDetectionGetState(otInstance *aInstance);
  */
 uint64_t otJamDetectionGetHistoryBitmap(otInstance *aInstance);
 
+/**
+ * Get the mask of channels considered jammed based on the Channel Monitor samples.
+ *
+ * This is available when `OPENTHREAD_CONFIG_JAM_DETECTOR_CHANNEL_MONITOR` is enabled along with the Channel Monitor
+ * feature, and always returns zero otherwise.
+ *
+ * @param[in]  aInstance            A pointer to an OpenThread instance.
+ *
+ * @returns The jammed channel mask.
+ *
+ */
+uint32_t otJamDetectionGetJammedChannels(otInstance *aInstance);
+
 /**
  * @}
  *
@@ -78,7 +78,7 @@ typedef struct otThreadLinkInfo
 
 #define OT_MAC_FILTER_ITERATOR_INIT 0 ///< Initializer for otMacFilterIterator.
 
-typedef uint8_t otMacFilterIterator; ///< Used to iterate through mac filter entries.
+typedef uint16_t otMacFilterIterator; ///< Used to iterate through mac filter entries.
 
 /**
  * Defines address mode of the mac filter.
@@ -142,6 +142,89 @@ typedef struct otMacCounters
     uint32_t mRxErrOther;           ///< The number of received packets with other error.
 } otMacCounters;
 
+/**
+ * This enumeration defines the MAC operations tracked by `otMacOperationStats`.
+ *
+ */
+typedef enum otMacOperation
+{
+    OT_MAC_OPERATION_ACTIVE_SCAN        = 0, ///< Active scan.
+    OT_MAC_OPERATION_ENERGY_SCAN        = 1, ///< Energy scan.
+    OT_MAC_OPERATION_TRANSMIT_BEACON    = 2, ///< Beacon transmission.
+    OT_MAC_OPERATION_TRANSMIT_DATA      = 3, ///< Data (or data poll) frame transmission.
+    OT_MAC_OPERATION_WAITING_FOR_DATA   = 4, ///< Waiting for a data frame after a data poll.
+    OT_MAC_OPERATION_TRANSMIT_OOB_FRAME = 5, ///< Out of band frame transmission.
+} otMacOperation;
+
+#define OT_MAC_NUM_OPERATIONS 6            ///< Number of MAC operations in `otMacOperation`.
+#define OT_MAC_OPERATION_HISTOGRAM_BINS 10 ///< Number of bins in `otMacOperationStats` histograms.
+
+/**
+ * This structure represents the latency statistics of a MAC operation.
+ *
+ * The queue time is the time from the operation being requested until it starts (i.e., while other operations hold
+ * the radio). The execution time is the time from the start until the operation finishes. All times are in
+ * milliseconds.
+ *
+ * Histogram bin 0 counts times below 1 ms, bin `i` (for `0 < i < OT_MAC_OPERATION_HISTOGRAM_BINS - 1`) counts times
+ * in `[2^(i-1), 2^i)` ms and the last bin counts all longer times.
+ *
+ */
+typedef struct otMacOperationStats
+{
+    uint32_t mCount;                                                   ///< Number of finished operations.
+    uint32_t mTotalQueueTime;                                          ///< Sum of queue times (msec).
+    uint32_t mMaxQueueTime;                                            ///< Maximum queue time (msec).
+    uint32_t mTotalExecutionTime;                                      ///< Sum of execution times (msec).
+    uint32_t mMaxExecutionTime;                                        ///< Maximum execution time (msec).
+    uint32_t mQueueTimeHistogram[OT_MAC_OPERATION_HISTOGRAM_BINS];     ///< Queue time histogram.
+    uint32_t mExecutionTimeHistogram[OT_MAC_OPERATION_HISTOGRAM_BINS]; ///< Execution time histogram.
+} otMacOperationStats;
+
+/**
+ * This enumeration defines the radio states tracked by `otRadioTimeStats`.
+ *
+ */
+typedef enum otRadioTimeState
+{
+    OT_RADIO_TIME_STATE_SLEEP    = 0, ///< Radio sleeping (or disabled).
+    OT_RADIO_TIME_STATE_RECEIVE  = 1, ///< Radio receiving (listening).
+    OT_RADIO_TIME_STATE_TRANSMIT = 2, ///< Radio transmitting, including CSMA-CA and waiting for the ack.
+} otRadioTimeState;
+
+#define OT_RADIO_NUM_TIME_STATES 3 ///< Number of radio states in `otRadioTimeState`.
+
+/**
+ * This enumeration defines the causes the radio time is attributed to in `otRadioTimeStats`.
+ *
+ */
+typedef enum otRadioTimeCause
+{
+    OT_RADIO_TIME_CAUSE_IDLE             = 0, ///< No MAC operation (rx-on-when-idle listening or sleeping).
+    OT_RADIO_TIME_CAUSE_ACTIVE_SCAN      = 1, ///< Active scan.
+    OT_RADIO_TIME_CAUSE_ENERGY_SCAN      = 2, ///< Energy scan.
+    OT_RADIO_TIME_CAUSE_TRANSMIT_BEACON  = 3, ///< Beacon transmission.
+    OT_RADIO_TIME_CAUSE_TRANSMIT_DATA    = 4, ///< Data frame transmission.
+    OT_RADIO_TIME_CAUSE_DATA_POLL        = 5, ///< Data poll transmission.
+    OT_RADIO_TIME_CAUSE_WAITING_FOR_DATA = 6, ///< Waiting for a data frame after a data poll.
+    OT_RADIO_TIME_CAUSE_TRANSMIT_OOB     = 7, ///< Out of band frame transmission.
+} otRadioTimeCause;
+
+#define OT_RADIO_NUM_TIME_CAUSES 8 ///< Number of causes in `otRadioTimeCause`.
+
+/**
+ * This structure represents the cumulative time the radio spent in each state, in total and per cause.
+ *
+ * All times are in microseconds. The time spent transmitting includes the CSMA-CA backoffs, the retransmissions and
+ * the ack waits of the frame, as these are performed by the radio (or the MAC) as part of one transmission.
+ *
+ */
+typedef struct otRadioTimeStats
+{
+    uint64_t mStateTime[OT_RADIO_NUM_TIME_STATES];                           ///< Time per `otRadioTimeState`.
+    uint64_t mCauseTime[OT_RADIO_NUM_TIME_CAUSES][OT_RADIO_NUM_TIME_STATES]; ///< Time per cause and state.
+} otRadioTimeStats;
+
 /**
  * This structure represents a received IEEE 802.15.4 Beacon.
  *
@@ -172,6 +255,21 @@ typedef struct otEnergyScanResult
     int8_t  mMaxRssi; ///< The max RSSI (dBm)
 } otEnergyScanResult;
 
+#define OT_LINK_TSCH_CELL_OPTION_TX (1 << 0)     ///< The TSCH cell is used to transmit.
+#define OT_LINK_TSCH_CELL_OPTION_RX (1 << 1)     ///< The TSCH cell is used to receive.
+#define OT_LINK_TSCH_CELL_OPTION_SHARED (1 << 2) ///< Transmissions in the TSCH cell use CSMA-CA.
+
+/**
+ * This structure represents a TSCH cell.
+ *
+ */
+typedef struct otLinkTschCell
+{
+    uint16_t mSlotOffset;    ///< The timeslot of the cell within the slotframe.
+    uint8_t  mChannelOffset; ///< The channel offset of the cell.
+    uint8_t  mOptions;       ///< The cell options (`OT_LINK_TSCH_CELL_OPTION_*`).
+} otLinkTschCell;
+
 /**
  * This function pointer is called during an IEEE 802.15.4 Active Scan when an IEEE 802.15.4 Beacon is received or
  * the scan completes.
@@ -431,6 +529,116 @@ OTAPI uint32_t OTCALL otLinkGetPollPeriod(otInstance *aInstance);
  */
 OTAPI void OTCALL otLinkSetPollPeriod(otInstance *aInstance, uint32_t aPollPeriod);
 
+/**
+ * Get the CSL period of sleepy end device.
+ *
+ * @note This function requires `OPENTHREAD_CONFIG_ENABLE_CSL`.
+ *
+ * @param[in]  aInstance A pointer to an OpenThread instance.
+ *
+ * @returns  The CSL period in milliseconds, or zero if CSL receive mode is disabled.
+ *
+ * @sa otLinkSetCslPeriod
+ *
+ */
+OTAPI uint16_t OTCALL otLinkGetCslPeriod(otInstance *aInstance);
+
+/**
+ * Set the CSL period of sleepy end device.
+ *
+ * With a non-zero CSL period, a sleepy end device opens a short receive window every CSL period, synchronized to its
+ * data polls, and its parent sends queued frames at those windows instead of waiting for the next data poll.
+ *
+ * @note This function requires `OPENTHREAD_CONFIG_ENABLE_CSL`.
+ *
+ * @param[in]  aInstance    A pointer to an OpenThread instance.
+ * @param[in]  aCslPeriod   The CSL period in milliseconds, or zero to disable CSL receive mode.
+ *
+ * @retval OT_ERROR_NONE          Successfully set the CSL period.
+ * @retval OT_ERROR_INVALID_ARGS  @p aCslPeriod is non-zero and too small for the configured receive window.
+ *
+ * @sa otLinkGetCslPeriod
+ *
+ */
+OTAPI otError OTCALL otLinkSetCslPeriod(otInstance *aInstance, uint16_t aCslPeriod);
+
+/**
+ * Get the TSCH slotframe length.
+ *
+ * @note This function requires `OPENTHREAD_CONFIG_MAC_TSCH`.
+ *
+ * @param[in]  aInstance A pointer to an OpenThread instance.
+ *
+ * @returns  The number of timeslots in the slotframe, or zero if TSCH is disabled.
+ *
+ * @sa otLinkTschSetSlotframeLength
+ *
+ */
+OTAPI uint16_t OTCALL otLinkTschGetSlotframeLength(otInstance *aInstance);
+
+/**
+ * Set the TSCH slotframe length.
+ *
+ * TSCH is used once the slotframe has at least one cell and the network time is synchronized. Cells whose slot offset
+ * does not fit in the new slotframe are removed.
+ *
+ * @note This function requires `OPENTHREAD_CONFIG_MAC_TSCH`.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ * @param[in]  aLength    The number of timeslots in the slotframe, or zero to disable TSCH.
+ *
+ * @sa otLinkTschGetSlotframeLength
+ *
+ */
+OTAPI void OTCALL otLinkTschSetSlotframeLength(otInstance *aInstance, uint16_t aLength);
+
+/**
+ * Add a cell to the TSCH schedule.
+ *
+ * @note This function requires `OPENTHREAD_CONFIG_MAC_TSCH`.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ * @param[in]  aCell      A pointer to the cell to add.
+ *
+ * @retval OT_ERROR_NONE          Successfully added the cell.
+ * @retval OT_ERROR_INVALID_ARGS  The slot offset is outside the slotframe or the cell has no TX or RX option.
+ * @retval OT_ERROR_ALREADY       A cell with the same slot offset already exists.
+ * @retval OT_ERROR_NO_BUFS       The schedule is full.
+ *
+ */
+OTAPI otError OTCALL otLinkTschAddCell(otInstance *aInstance, const otLinkTschCell *aCell);
+
+/**
+ * Remove a cell from the TSCH schedule.
+ *
+ * @note This function requires `OPENTHREAD_CONFIG_MAC_TSCH`.
+ *
+ * @param[in]  aInstance    A pointer to an OpenThread instance.
+ * @param[in]  aSlotOffset  The slot offset of the cell to remove.
+ *
+ * @retval OT_ERROR_NONE       Successfully removed the cell.
+ * @retval OT_ERROR_NOT_FOUND  There is no cell with the given slot offset.
+ *
+ */
+OTAPI otError OTCALL otLinkTschRemoveCell(otInstance *aInstance, uint16_t aSlotOffset);
+
+/**
+ * Get a cell of the TSCH schedule by its index.
+ *
+ * Cells are ordered by slot offset.
+ *
+ * @note This function requires `OPENTHREAD_CONFIG_MAC_TSCH`.
+ *
+ * @param[in]   aInstance  A pointer to an OpenThread instance.
+ * @param[in]   aIndex     The index of the cell.
+ * @param[out]  aCell      A pointer to where the cell is placed.
+ *
+ * @retval OT_ERROR_NONE       Successfully retrieved the cell.
+ * @retval OT_ERROR_NOT_FOUND  @p aIndex is out of range.
+ *
+ */
+OTAPI otError OTCALL otLinkTschGetCell(otInstance *aInstance, uint8_t aIndex, otLinkTschCell *aCell);
+
 /**
  * Get the IEEE 802.15.4 Short Address.
  *
@@ -716,6 +924,35 @@ int8_t otLinkConvertLinkQualityToRss(otInstance *aInstance, uint8_t aLinkQuality
  */
 OTAPI const otMacCounters *OTCALL otLinkGetCounters(otInstance *aInstance);
 
+/**
+ * Get the latency statistics of a MAC operation.
+ *
+ * The statistics are cleared along with the MAC counters (e.g., by a network diagnostic reset).
+ *
+ * @note This function requires `OPENTHREAD_CONFIG_ENABLE_MAC_OPERATION_STATS`.
+ *
+ * @param[in]  aInstance   A pointer to an OpenThread instance.
+ * @param[in]  aOperation  The MAC operation.
+ *
+ * @returns A pointer to the statistics of @p aOperation, or NULL if @p aOperation is not valid.
+ *
+ */
+const otMacOperationStats *otLinkGetOperationStats(otInstance *aInstance, otMacOperation aOperation);
+
+/**
+ * Get the cumulative time the radio spent sleeping, receiving and transmitting, in total and per cause.
+ *
+ * The statistics are cleared along with the MAC counters (e.g., by a network diagnostic reset).
+ *
+ * @note This function requires `OPENTHREAD_CONFIG_ENABLE_RADIO_TIME_STATS`.
+ *
+ * @param[in]  aInstance   A pointer to an OpenThread instance.
+ *
+ * @returns A pointer to the radio time statistics (updated up to the time of the call).
+ *
+ */
+const otRadioTimeStats *otLinkGetRadioTimeStats(otInstance *aInstance);
+
 /**
  * This function pointer is called when an IEEE 802.15.4 frame is received.
  *
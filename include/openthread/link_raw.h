@@ -185,6 +185,55 @@ typedef void (*otLinkRawTransmitDone)(otInstance *  aInstance,
  */
 otError otLinkRawTransmit(otInstance *aInstance, otLinkRawTransmitDone aCallback);
 
+/**
+ * This structure represents one frame of a batched transmission.
+ *
+ */
+typedef struct otLinkRawBatchFrame
+{
+    const uint8_t *mPsdu;            ///< The PSDU.
+    uint8_t        mLength;          ///< Length of the PSDU.
+    uint8_t        mChannel;         ///< Channel used to transmit the frame.
+    uint8_t        mMaxCsmaBackoffs; ///< Maximum number of backoffs attempts before declaring CCA failure.
+    uint8_t        mMaxFrameRetries; ///< Maximum number of retries allowed after a transmission failure.
+    bool           mCsmaCaEnabled;   ///< Set to true to enable CSMA-CA for the frame.
+} otLinkRawBatchFrame;
+
+/**
+ * This function pointer is called when all frames of a batched transmission are done.
+ *
+ * @param[in]  aInstance        A pointer to an OpenThread instance.
+ * @param[in]  aErrors          A pointer to an array with the outcome of each frame, in submission order (see
+ *                              otLinkRawTransmitDone for the possible values).
+ * @param[in]  aCount           The number of entries in @p aErrors.
+ *
+ */
+typedef void (*otLinkRawTransmitBatchDone)(otInstance *aInstance, const otError *aErrors, uint8_t aCount);
+
+/**
+ * This method transmits a batch of frames back-to-back.
+ *
+ * The frames are copied, so @p aFrames only needs to remain valid for the duration of this call. Each frame is sent
+ * (with its own CSMA-CA and retry parameters) as soon as the previous one is done, and @p aCallback reports the
+ * outcome of all of them once the last frame is done.
+ *
+ * This function is available when `OPENTHREAD_CONFIG_LINK_RAW_TRANSMIT_BATCH_SIZE` is non-zero.
+ *
+ * @param[in]  aInstance    A pointer to an OpenThread instance.
+ * @param[in]  aFrames      A pointer to an array of frames.
+ * @param[in]  aCount       The number of frames in @p aFrames.
+ * @param[in]  aCallback    A pointer to a function called on completion of the batch.
+ *
+ * @retval OT_ERROR_NONE          Successfully started the batch.
+ * @retval OT_ERROR_INVALID_STATE The raw link-layer isn't enabled or a batch is already in progress.
+ * @retval OT_ERROR_INVALID_ARGS  @p aCount is zero or too large, or a frame is too long.
+ *
+ */
+otError otLinkRawTransmitBatch(otInstance *               aInstance,
+                               const otLinkRawBatchFrame *aFrames,
+                               uint8_t                    aCount,
+                               otLinkRawTransmitBatchDone aCallback);
+
 /**
  * Get the most recent RSSI measurement.
  *
@@ -75,6 +75,44 @@ otLogLevel otLoggingGetLevel(void);
  */
 otError otLoggingSetLevel(otLogLevel aLogLevel);
 
+/**
+ * This function returns the current log level of a log region.
+ *
+ * If dynamic log level feature `OPENTHREAD_CONFIG_ENABLE_DYNAMIC_LOG_LEVEL` is enabled, this function returns the
+ * currently set dynamic log level of the region. Otherwise, this function returns the build-time configured log level.
+ *
+ * @param[in]  aLogRegion  The log region.
+ *
+ * @returns The log level of the region.
+ *
+ */
+otLogLevel otLoggingGetRegionLevel(otLogRegion aLogRegion);
+
+/**
+ * This function sets the log level of a single log region.
+ *
+ * Setting the log level with `otLoggingSetLevel()` overrides the log level of all regions.
+ *
+ * @param[in]  aLogRegion              The log region.
+ * @param[in]  aLogLevel               The log level.
+ *
+ * @retval OT_ERROR_NONE               The log level of the region was changed successfully.
+ * @retval OT_ERROR_INVALID_ARGS       @p aLogRegion is not a valid log region.
+ * @retval OT_ERROR_DISABLED_FEATURE   The dynamic log level feature is not supported.
+ *                                     (see `OPENTHREAD_CONFIG_ENABLE_DYNAMIC_LOG_LEVEL` configuration option).
+ *
+ */
+otError otLoggingSetRegionLevel(otLogRegion aLogRegion, otLogLevel aLogLevel);
+
+/**
+ * This function returns the number of log lines dropped because the deferred log buffer was full.
+ *
+ * @returns The number of dropped log lines, or zero if deferred logging (`OPENTHREAD_CONFIG_LOG_DEFERRED`) is not
+ *          enabled.
+ *
+ */
+uint32_t otLoggingGetDeferredDropCount(void);
+
 /**
  * @}
  *
@@ -60,9 +60,14 @@ typedef struct otMessage
     struct otMessage *mNext; ///< A pointer to the next Message buffer.
 } otMessage;
 
+#define OT_BUFFER_INFO_NUM_MESSAGE_TYPES 4     ///< Number of message types in `otBufferInfo` failure counters.
+#define OT_BUFFER_INFO_NUM_MESSAGE_SUBTYPES 10 ///< Number of message sub types in `otBufferInfo` failure counters.
+
 /**
  * This structure represents the message buffer information.
  *
+ * The high-water marks of the queues are sampled whenever a message is added to the queue.
+ *
  */
 typedef struct otBufferInfo
 {
@@ -86,6 +91,31 @@ typedef struct otBufferInfo
     uint16_t mCoapSecureBuffers;       ///< The number of buffers in the CoAP secure send queue.
     uint16_t mApplicationCoapMessages; ///< The number of messages in the application CoAP send queue.
     uint16_t mApplicationCoapBuffers;  ///< The number of buffers in the application CoAP send queue.
+    uint16_t mReservedBuffers;         ///< The number of buffers reserved for network control messages.
+    uint16_t mIndirectBuffers;         ///< The number of buffers used by messages queued for sleepy children.
+    uint16_t mCoapCacheBuffers;        ///< The number of buffers used by cached CoAP responses.
+    uint16_t mMaxUsedBuffers;          ///< The maximum number of buffers in use at the same time (high-water mark).
+    uint16_t m6loSendMaxBuffers;       ///< The maximum number of buffers in the 6lo send queue.
+    uint16_t m6loReassemblyMaxBuffers; ///< The maximum number of buffers in the 6LoWPAN reassembly queue.
+    uint16_t mIp6MaxBuffers;           ///< The maximum number of buffers in the IPv6 send queue.
+    uint16_t mMplMaxBuffers;           ///< The maximum number of buffers in the MPL send queue.
+    uint16_t mMleMaxBuffers;           ///< The maximum number of buffers in the MLE send queue.
+    uint16_t mArpMaxBuffers;           ///< The maximum number of buffers in the ARP send queue.
+    uint16_t mCoapMaxBuffers;          ///< The sum of maximum number of buffers in the CoAP queues.
+    uint16_t mAllocFailures;           ///< The number of message buffer allocation failures.
+    uint32_t mLowBufferTime;           ///< The total time (in msec) with free buffers below the low threshold.
+    uint32_t mBufferAllocations;       ///< The number of message buffers allocated so far.
+    uint32_t mPrependReallocations;    ///< The number of buffers added due to lack of reserved header space.
+
+    /**
+     * The number of message buffer allocation failures per (internal) message type.
+     */
+    uint16_t mTypeAllocFailures[OT_BUFFER_INFO_NUM_MESSAGE_TYPES];
+
+    /**
+     * The number of message buffer allocation failures per (internal) message sub type.
+     */
+    uint16_t mSubTypeAllocFailures[OT_BUFFER_INFO_NUM_MESSAGE_SUBTYPES];
 } otBufferInfo;
 
 /**
@@ -99,6 +129,36 @@ typedef enum otMessagePriority
     OT_MESSAGE_PRIORITY_HIGH   = 2, ///< High priority level.
 } otMessagePriority;
 
+#define OT_MESSAGE_TRACE_NUM_PRIORITIES 4 ///< Number of priority levels in `otMessageTraceHistograms` (incl. network).
+#define OT_MESSAGE_TRACE_NUM_BUCKETS 10   ///< Number of buckets in each `otMessageTraceHistograms` histogram.
+
+/**
+ * This structure represents the message latency histograms collected by the message trace mode.
+ *
+ * Bucket 0 counts delays below 1 ms, bucket `i` counts delays in [2^(i-1), 2^i) ms and the last bucket counts all
+ * longer delays. The queueing and airtime histograms are indexed by message priority level, where the level above
+ * `OT_MESSAGE_PRIORITY_HIGH` is the internal network control priority.
+ *
+ */
+typedef struct otMessageTraceHistograms
+{
+    /**
+     * The time from adding a message to the send queue to starting its transmission.
+     */
+    uint32_t mQueueing[OT_MESSAGE_TRACE_NUM_PRIORITIES][OT_MESSAGE_TRACE_NUM_BUCKETS];
+
+    /**
+     * The time from handing the first frame of a message to the MAC to the completion of its last frame, including
+     * CSMA backoffs and retries.
+     */
+    uint32_t mAirtime[OT_MESSAGE_TRACE_NUM_PRIORITIES][OT_MESSAGE_TRACE_NUM_BUCKETS];
+
+    /**
+     * The end-to-end latency of received datagrams carrying a timestamp option (based on the network time).
+     */
+    uint32_t mPathLatency[OT_MESSAGE_TRACE_NUM_BUCKETS];
+} otMessageTraceHistograms;
+
 /**
  * This structure represents a message settings.
  *
@@ -107,6 +167,7 @@ typedef struct otMessageSettings
 {
     bool              mLinkSecurityEnabled; ///< TRUE if the message should be secured at Layer 2.
     otMessagePriority mPriority;            ///< The message priority level.
+    uint32_t          mLifetime;            ///< The message lifetime in milliseconds (0 for no expiry).
 } otMessageSettings;
 
 /**
@@ -224,6 +285,18 @@ bool otMessageIsLinkSecurityEnabled(otMessage *aMessage);
  */
 void otMessageSetDirectTransmission(otMessage *aMessage, bool aEnabled);
 
+/**
+ * This function sets the lifetime of the message.
+ *
+ * A message whose lifetime has expired is discarded instead of starting its (direct or indirect) transmission.
+ * Default setting for a new message is no expiry, unless set by `otMessageSettings`.
+ *
+ * @param[in]  aMessage   A pointer to a message buffer.
+ * @param[in]  aLifetime  The lifetime in milliseconds from now, or 0 for no expiry.
+ *
+ */
+void otMessageSetLifetime(otMessage *aMessage, uint32_t aLifetime);
+
 /**
  * This function returns the average RSS (received signal strength) associated with the message.
  *
@@ -300,7 +373,8 @@ int otMessageWrite(otMessage *aMessage, uint16_t aOffset, const void *aBuf, uint
  */
 typedef struct
 {
-    void *mData; ///< Opaque data used by the implementation.
+    void *   mData;       ///< Opaque data used by the implementation.
+    uint16_t mMaxBuffers; ///< Opaque data used by the implementation.
 } otMessageQueue;
 
 /**
@@ -382,6 +456,27 @@ otMessage *otMessageQueueGetNext(otMessageQueue *aQueue, const otMessage *aMessa
  */
 OTAPI void OTCALL otMessageGetBufferInfo(otInstance *aInstance, otBufferInfo *aBufferInfo);
 
+/**
+ * Get the message latency histograms.
+ *
+ * This function requires `OPENTHREAD_CONFIG_ENABLE_MESSAGE_TRACE`.
+ *
+ * @param[in]   aInstance    A pointer to the OpenThread instance.
+ * @param[out]  aHistograms  A pointer where the histograms are written.
+ *
+ */
+void otMessageGetTraceHistograms(otInstance *aInstance, otMessageTraceHistograms *aHistograms);
+
+/**
+ * Reset the message latency histograms.
+ *
+ * This function requires `OPENTHREAD_CONFIG_ENABLE_MESSAGE_TRACE`.
+ *
+ * @param[in]  aInstance  A pointer to the OpenThread instance.
+ *
+ */
+void otMessageResetTraceHistograms(otInstance *aInstance);
+
 /**
  * @}
  *
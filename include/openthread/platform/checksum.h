@@ -0,0 +1,80 @@
+/*
+ *  Copyright (c) 2018, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * @brief
+ *   This file includes the platform abstraction for the Internet checksum computation.
+ */
+
+#ifndef OPENTHREAD_PLATFORM_CHECKSUM_H_
+#define OPENTHREAD_PLATFORM_CHECKSUM_H_
+
+#include <stdint.h>
+
+/**
+ * @addtogroup plat-checksum
+ *
+ * @brief
+ *   This module includes the platform abstraction for the Internet checksum computation.
+ *
+ *   The platform implementation is used only when `OPENTHREAD_CONFIG_PLATFORM_CHECKSUM` is enabled.
+ *
+ * @{
+ *
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * This function adds the contents of a buffer to a 16-bit one's complement sum (RFC 1071).
+ *
+ * The buffer is treated as a sequence of 16-bit big-endian words, with its first byte being the high-order byte of
+ * the first word. If @p aLength is odd, the last byte is padded with a zero (low-order) byte.
+ *
+ * @param[in]  aChecksum  The current (not complemented) one's complement sum.
+ * @param[in]  aBuf       A pointer to the buffer. The buffer may not be aligned.
+ * @param[in]  aLength    The number of bytes in the buffer.
+ *
+ * @returns The updated (not complemented) one's complement sum.
+ *
+ */
+uint16_t otPlatChecksumUpdate(uint16_t aChecksum, const uint8_t *aBuf, uint16_t aLength);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+/**
+ * @}
+ *
+ */
+
+#endif // OPENTHREAD_PLATFORM_CHECKSUM_H_
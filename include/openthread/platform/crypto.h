@@ -0,0 +1,102 @@
+/*
+ *  Copyright (c) 2018, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * @brief
+ *   This file includes the platform abstraction for hardware accelerated cryptography.
+ */
+
+#ifndef OPENTHREAD_PLATFORM_CRYPTO_H_
+#define OPENTHREAD_PLATFORM_CRYPTO_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <openthread/error.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup plat-crypto
+ *
+ * @brief
+ *   This module includes the platform abstraction for hardware accelerated cryptography.
+ *
+ * @{
+ *
+ */
+
+/**
+ * Perform an AES-CCM* operation on a contiguous frame using a hardware engine.
+ *
+ * The payload is encrypted (or decrypted) in place and the authentication tag computed over the header and the
+ * plaintext payload is written to @p aTag. On decryption, the caller compares the tag with the received one.
+ *
+ * This function is only used when `OPENTHREAD_CONFIG_ENABLE_PLATFORM_AES_CCM` is enabled. It may be called from
+ * interrupt context and must not call back into OpenThread. A platform without a suitable engine for the given
+ * parameters returns `OT_ERROR_NOT_IMPLEMENTED`, in which case OpenThread falls back to its software implementation.
+ *
+ * @param[in]     aKey            A pointer to the 128-bit AES key.
+ * @param[in]     aNonce          A pointer to the nonce.
+ * @param[in]     aNonceLength    The nonce length in bytes (13 for IEEE 802.15.4).
+ * @param[in]     aHeader         A pointer to the header (additional authenticated data).
+ * @param[in]     aHeaderLength   The header length in bytes.
+ * @param[inout]  aPayload        A pointer to the payload, processed in place.
+ * @param[in]     aPayloadLength  The payload length in bytes.
+ * @param[out]    aTag            A pointer to where the tag is written.
+ * @param[in]     aTagLength      The tag length in bytes.
+ * @param[in]     aEncrypt        TRUE to encrypt the payload, FALSE to decrypt it.
+ *
+ * @retval OT_ERROR_NONE             Successfully processed the frame.
+ * @retval OT_ERROR_NOT_IMPLEMENTED  The platform cannot process the frame.
+ *
+ */
+otError otPlatCryptoAesCcm(const uint8_t *aKey,
+                           const uint8_t *aNonce,
+                           uint8_t        aNonceLength,
+                           const uint8_t *aHeader,
+                           uint16_t       aHeaderLength,
+                           uint8_t *      aPayload,
+                           uint16_t       aPayloadLength,
+                           uint8_t *      aTag,
+                           uint8_t        aTagLength,
+                           bool           aEncrypt);
+
+/**
+ * @}
+ *
+ */
+
+#ifdef __cplusplus
+} // end of extern "C"
+#endif
+
+#endif // OPENTHREAD_PLATFORM_CRYPTO_H_
@@ -193,6 +193,18 @@ otError otPlatSetMcuPowerState(otInstance *aInstance, otPlatMcuPowerState aState
  */
 otPlatMcuPowerState otPlatGetMcuPowerState(otInstance *aInstance);
 
+/**
+ * This function returns the value of a free-running cycle counter (e.g. the Cortex-M DWT cycle counter).
+ *
+ * It is only used to time code (e.g. by the CLI `benchmark` command), so only differences between two values are
+ * meaningful. Platforms without a cycle counter need not implement it; the default implementation returns the
+ * platform time in microseconds.
+ *
+ * @returns The current value of the cycle counter.
+ *
+ */
+uint32_t otPlatGetCycleCount(void);
+
 /**
  * @}
  *
@@ -96,11 +96,13 @@ typedef uint8_t otRadioCaps;
  */
 enum
 {
-    OT_RADIO_CAPS_NONE             = 0,      ///< Radio supports no capability.
-    OT_RADIO_CAPS_ACK_TIMEOUT      = 1 << 0, ///< Radio supports AckTime event.
-    OT_RADIO_CAPS_ENERGY_SCAN      = 1 << 1, ///< Radio supports Energy Scans.
-    OT_RADIO_CAPS_TRANSMIT_RETRIES = 1 << 2, ///< Radio supports tx retry logic with collision avoidance (CSMA).
-    OT_RADIO_CAPS_CSMA_BACKOFF     = 1 << 3, ///< Radio supports CSMA backoff for frame transmission (but no retry).
+    OT_RADIO_CAPS_NONE              = 0,      ///< Radio supports no capability.
+    OT_RADIO_CAPS_ACK_TIMEOUT       = 1 << 0, ///< Radio supports AckTime event.
+    OT_RADIO_CAPS_ENERGY_SCAN       = 1 << 1, ///< Radio supports Energy Scans.
+    OT_RADIO_CAPS_TRANSMIT_RETRIES  = 1 << 2, ///< Radio supports tx retry logic with collision avoidance (CSMA).
+    OT_RADIO_CAPS_CSMA_BACKOFF      = 1 << 3, ///< Radio supports CSMA backoff for frame transmission (but no retry).
+    OT_RADIO_CAPS_SFD_TIMESTAMP     = 1 << 4, ///< Radio timestamps frames and writes the Time IE at the SFD.
+    OT_RADIO_CAPS_MULTI_ENERGY_SCAN = 1 << 5, ///< Radio supports Energy Scans of several channels in one request.
 };
 
 #define OT_PANID_BROADCAST 0xffff ///< IEEE 802.15.4 Broadcast PAN ID
@@ -144,7 +146,7 @@ typedef struct otRadioIeInfo
 {
     uint8_t  mTimeIeOffset;      ///< The Time IE offset from the start of PSDU.
     uint8_t  mTimeSyncSeq;       ///< The Time sync sequence.
-    uint64_t mTimestamp;         ///< The time in microseconds when the SFD was received.
+    uint64_t mTimestamp;         ///< The time in microseconds when the SFD was received or sent.
     int64_t  mNetworkTimeOffset; ///< The time offset to the Thread network time.
 } otRadioIeInfo;
 
@@ -159,6 +161,22 @@ typedef struct otRadioFrame
     bool           mDidTx : 1; ///< Set to true if this frame sent from the radio. Ignored by radio driver.
     otRadioIeInfo *mIeInfo;    ///< The pointer to the Header IE(s) related information.
 
+    /**
+     * Header field offsets cached by OpenThread while processing a received frame (ignored by radio driver).
+     *
+     * The offsets are only used while the Frame Control Field and the PSDU length still match `mFcf` and `mLength`.
+     */
+    struct
+    {
+        uint16_t mFcf;                 ///< The Frame Control Field the offsets were parsed from.
+        uint8_t  mLength;              ///< The PSDU length the offsets were parsed from.
+        uint8_t  mSrcAddrIndex;        ///< The index of the Source Address.
+        uint8_t  mSecurityHeaderIndex; ///< The index of the Auxiliary Security Header.
+        uint8_t  mPayloadIndex;        ///< The index of the payload.
+        uint8_t  mFooterLength;        ///< The length of the footer (MIC and FCS).
+        bool     mValid : 1;           ///< Set to true when the offsets were parsed.
+    } mParsedInfo;
+
     /**
      * The union of transmit and receive information for a radio frame.
      */
@@ -452,6 +470,48 @@ otError otPlatRadioReceive(otInstance *aInstance, uint8_t aChannel);
  */
 extern void otPlatRadioReceiveDone(otInstance *aInstance, otRadioFrame *aFrame, otError aError);
 
+/**
+ * The radio driver calls this method to notify OpenThread that received frames are pending in its receive queue.
+ *
+ * This function is an alternative to `otPlatRadioReceiveDone()` for drivers which receive into several buffers, and
+ * is available when OpenThread is built with `OPENTHREAD_CONFIG_RADIO_RX_QUEUE`. OpenThread retrieves the pending
+ * frames in order with `otPlatRadioGetReceivedFrame()` and processes each one before handing its buffer back with
+ * `otPlatRadioReleaseReceivedFrame()`, so the driver can keep receiving into its other buffers in the meantime.
+ *
+ * Only successfully received frames are queued. Receive failures are still reported with `otPlatRadioReceiveDone()`.
+ *
+ * @note  This function should be called by the same thread that executes all of the other OpenThread code. It should
+ *        not be called by ISR or any other task.
+ *
+ * @param[in]  aInstance The OpenThread instance structure.
+ *
+ */
+extern void otPlatRadioReceivePending(otInstance *aInstance);
+
+/**
+ * Get the oldest frame pending in the radio driver receive queue.
+ *
+ * The frame stays valid and is not reused by the driver until it is passed to `otPlatRadioReleaseReceivedFrame()`.
+ * Only required when OpenThread is built with `OPENTHREAD_CONFIG_RADIO_RX_QUEUE`.
+ *
+ * @param[in]  aInstance The OpenThread instance structure.
+ *
+ * @returns A pointer to the oldest pending received frame, or NULL if there is none.
+ *
+ */
+otRadioFrame *otPlatRadioGetReceivedFrame(otInstance *aInstance);
+
+/**
+ * Remove a processed frame from the radio driver receive queue, and return its buffer to the driver.
+ *
+ * Only required when OpenThread is built with `OPENTHREAD_CONFIG_RADIO_RX_QUEUE`.
+ *
+ * @param[in]  aInstance The OpenThread instance structure.
+ * @param[in]  aFrame    A pointer to the frame, as returned by `otPlatRadioGetReceivedFrame()`.
+ *
+ */
+void otPlatRadioReleaseReceivedFrame(otInstance *aInstance, otRadioFrame *aFrame);
+
 /**
  * The radio driver calls this method to notify OpenThread diagnostics module of a received frame.
  *
@@ -589,6 +649,38 @@ otError otPlatRadioEnergyScan(otInstance *aInstance, uint8_t aScanChannel, uint1
  */
 extern void otPlatRadioEnergyScanDone(otInstance *aInstance, int8_t aEnergyScanMaxRssi);
 
+/**
+ * Begin an energy scan of several channels on the radio.
+ *
+ * This function is used when radio provides OT_RADIO_CAPS_MULTI_ENERGY_SCAN capability. The radio may sample the
+ * channels in parallel or in the background without leaving receive on the current channel, so that the whole set of
+ * channels is measured by a single request instead of one `otPlatRadioEnergyScan()` call per channel.
+ *
+ * @param[in] aInstance      The OpenThread instance structure.
+ * @param[in] aScanChannels  A bit vector of the channels to scan (bit N set for channel N).
+ * @param[in] aScanDuration  The duration, in milliseconds, for each channel to be scanned.
+ *
+ * @retval OT_ERROR_NONE             Successfully started scanning the channels.
+ * @retval OT_ERROR_NOT_IMPLEMENTED  The radio doesn't support multi-channel energy scanning.
+ *
+ */
+otError otPlatRadioEnergyScanMultiChannel(otInstance *aInstance, uint32_t aScanChannels, uint16_t aScanDuration);
+
+/**
+ * The radio driver calls this method to notify OpenThread that the multi-channel energy scan is complete.
+ *
+ * This function is used when radio provides OT_RADIO_CAPS_MULTI_ENERGY_SCAN capability.
+ *
+ * @param[in]  aInstance      The OpenThread instance structure.
+ * @param[in]  aScanChannels  The bit vector of scanned channels, as passed to `otPlatRadioEnergyScanMultiChannel()`.
+ * @param[in]  aMaxRssi       The maximum RSSI encountered on each scanned channel, one entry per channel set in
+ *                            @p aScanChannels in ascending channel order (127 when no valid measurement was made).
+ *
+ */
+extern void otPlatRadioEnergyScanMultiChannelDone(otInstance *  aInstance,
+                                                  uint32_t      aScanChannels,
+                                                  const int8_t *aMaxRssi);
+
 /**
  * Enable/Disable source address match feature.
  *
@@ -673,6 +765,103 @@ void otPlatRadioClearSrcMatchShortEntries(otInstance *aInstance);
  */
 void otPlatRadioClearSrcMatchExtEntries(otInstance *aInstance);
 
+/**
+ * Add and remove several short addresses in the source address match table in one operation.
+ *
+ * The addresses in @p aClearList are removed first, then the addresses in @p aAddList are added. If there is not
+ * enough space for all the addresses in @p aAddList, none of them is added (the removals still take effect).
+ *
+ * A default implementation built on `otPlatRadioAddSrcMatchShortEntry()` and `otPlatRadioClearSrcMatchShortEntry()`
+ * is provided. Platforms where each table update is costly (e.g. a radio co-processor) should override it.
+ *
+ * @param[in]  aInstance    The OpenThread instance structure.
+ * @param[in]  aAddList     A pointer to the short addresses to be added.
+ * @param[in]  aNumAdd      The number of short addresses in @p aAddList.
+ * @param[in]  aClearList   A pointer to the short addresses to be removed.
+ * @param[in]  aNumClear    The number of short addresses in @p aClearList.
+ *
+ * @retval OT_ERROR_NONE      Successfully updated the source match table.
+ * @retval OT_ERROR_NO_BUFS   Not enough available entries in the source match table, no address was added.
+ *
+ */
+otError otPlatRadioUpdateSrcMatchShortEntries(otInstance *          aInstance,
+                                              const otShortAddress *aAddList,
+                                              uint8_t               aNumAdd,
+                                              const otShortAddress *aClearList,
+                                              uint8_t               aNumClear);
+
+/**
+ * Add and remove several extended addresses in the source address match table in one operation.
+ *
+ * The addresses in @p aClearList are removed first, then the addresses in @p aAddList are added. If there is not
+ * enough space for all the addresses in @p aAddList, none of them is added (the removals still take effect).
+ *
+ * A default implementation built on `otPlatRadioAddSrcMatchExtEntry()` and `otPlatRadioClearSrcMatchExtEntry()`
+ * is provided. Platforms where each table update is costly (e.g. a radio co-processor) should override it.
+ *
+ * @param[in]  aInstance    The OpenThread instance structure.
+ * @param[in]  aAddList     A pointer to the extended addresses to be added, stored in little-endian byte order.
+ * @param[in]  aNumAdd      The number of extended addresses in @p aAddList.
+ * @param[in]  aClearList   A pointer to the extended addresses to be removed, stored in little-endian byte order.
+ * @param[in]  aNumClear    The number of extended addresses in @p aClearList.
+ *
+ * @retval OT_ERROR_NONE      Successfully updated the source match table.
+ * @retval OT_ERROR_NO_BUFS   Not enough available entries in the source match table, no address was added.
+ *
+ */
+otError otPlatRadioUpdateSrcMatchExtEntries(otInstance *        aInstance,
+                                            const otExtAddress *aAddList,
+                                            uint8_t             aNumAdd,
+                                            const otExtAddress *aClearList,
+                                            uint8_t             aNumClear);
+
+/**
+ * This enumeration represents the purpose of a radio time slot requested from a multiprotocol radio arbiter.
+ *
+ */
+typedef enum otRadioSlotType
+{
+    OT_RADIO_SLOT_TRANSMIT = 0, ///< Frame transmission, including CSMA-CA and the wait for the acknowledgment.
+    OT_RADIO_SLOT_RECEIVE  = 1, ///< Scheduled receive window, e.g. waiting for data after a data poll.
+    OT_RADIO_SLOT_SCAN     = 2, ///< Energy scan of one channel, or beacon request transmission of an active scan.
+} otRadioSlotType;
+
+/**
+ * Request radio time from the arbiter of a multiprotocol radio (e.g., shared with BLE).
+ *
+ * OpenThread calls this function before each transmission and at the start of each scheduled receive window, with
+ * the expected duration of the radio activity. The slot ends by itself once the duration has elapsed; the radio is
+ * then only used for idle reception, which the other protocol may preempt at any time.
+ *
+ * For transmissions, a denied request makes OpenThread wait for `otPlatRadioSlotGranted()` before it transmits, or
+ * give up the attempt as a channel access failure after `OPENTHREAD_CONFIG_MAC_RADIO_GRANT_TIMEOUT`. For receive
+ * windows and scans, the request only informs the arbiter.
+ *
+ * A default implementation granting every request is provided.
+ *
+ * @note This function is only used with `OPENTHREAD_CONFIG_MAC_RADIO_ARBITRATION`.
+ *
+ * @param[in]  aInstance   The OpenThread instance structure.
+ * @param[in]  aType       The purpose of the slot.
+ * @param[in]  aDuration   The expected duration of the slot, in microseconds.
+ *
+ * @retval OT_ERROR_NONE   The radio is granted for the slot.
+ * @retval OT_ERROR_BUSY   The radio is used by another protocol.
+ *
+ */
+otError otPlatRadioRequestSlot(otInstance *aInstance, otRadioSlotType aType, uint32_t aDuration);
+
+/**
+ * The radio driver calls this function to notify OpenThread that the radio, after a denied
+ * `otPlatRadioRequestSlot()`, has been granted to it.
+ *
+ * @note This function is only used with `OPENTHREAD_CONFIG_MAC_RADIO_ARBITRATION`.
+ *
+ * @param[in]  aInstance   The OpenThread instance structure.
+ *
+ */
+extern void otPlatRadioSlotGranted(otInstance *aInstance);
+
 /**
  * @}
  *
@@ -54,6 +54,10 @@ extern "C" {
 /**
  * Run all queued OpenThread tasklets at the time this is called.
  *
+ * Latency critical (e.g., radio and MAC) tasklets are run first. If the build limits the number of tasklets run per
+ * call (`OPENTHREAD_CONFIG_TASKLETS_PROCESS_BUDGET`), this function may return with tasklets still pending, in which
+ * case `otTaskletsSignalPending()` is called.
+ *
  * @param[in] aInstance A pointer to an OpenThread instance.
  *
  */
@@ -78,6 +82,94 @@ bool otTaskletsArePending(otInstance *aInstance);
  */
 extern void otTaskletsSignalPending(otInstance *aInstance);
 
+#define OT_SLEEP_HINT_NO_DEADLINE 0xffffffff ///< No timer is running (used in `otSleepHint`).
+
+/**
+ * This structure describes when OpenThread next needs the CPU and the radio.
+ *
+ * A platform can use it before entering a low-power state to pick the deepest state whose wakeup latency still meets
+ * the next deadline, instead of waking up early.
+ *
+ */
+typedef struct otSleepHint
+{
+    uint32_t mMilliRemaining;  ///< Time (in ms) until the next millisecond timer fires, or OT_SLEEP_HINT_NO_DEADLINE.
+    uint32_t mMicroRemaining;  ///< Time (in us) until the next microsecond timer fires, or OT_SLEEP_HINT_NO_DEADLINE.
+    bool     mTaskletsPending; ///< TRUE if tasklets are pending (the CPU should not sleep).
+    bool     mRadioInUse;      ///< TRUE if the MAC has an operation in progress/pending or keeps the radio receiving.
+} otSleepHint;
+
+/**
+ * This function gets the hint describing the next OpenThread event, for the platform to select a sleep state.
+ *
+ * The hint is only valid until OpenThread runs again (i.e., until the next tasklet, alarm or radio callback). It
+ * should be queried right before going to sleep, after `otTaskletsProcess()` returned.
+ *
+ * @param[in]   aInstance  A pointer to an OpenThread instance.
+ * @param[out]  aHint      A pointer to where the sleep hint is placed.
+ *
+ */
+void otTaskletsGetSleepHint(otInstance *aInstance, otSleepHint *aHint);
+
+/**
+ * This enumeration represents the kind of a profiled handler.
+ *
+ */
+typedef enum otHandlerType
+{
+    OT_HANDLER_TYPE_TASKLET = 0, ///< A tasklet handler.
+    OT_HANDLER_TYPE_TIMER   = 1, ///< A (millisecond or microsecond) timer handler.
+} otHandlerType;
+
+/**
+ * This structure represents the execution profile of a tasklet or timer handler.
+ *
+ */
+typedef struct otHandlerProfile
+{
+    uint64_t      mHandler;   ///< Address of the handler function (zero for the overflow entry).
+    uint64_t      mTotalTime; ///< The cumulative execution time (in microseconds).
+    uint32_t      mCount;     ///< The number of invocations.
+    uint32_t      mMaxTime;   ///< The maximum execution time of a single invocation (in microseconds).
+    otHandlerType mType;      ///< The kind of handler.
+} otHandlerProfile;
+
+#define OT_HANDLER_PROFILE_ITERATOR_INIT 0 ///< Initializer for otHandlerProfileIterator.
+
+typedef uint16_t otHandlerProfileIterator; ///< Used to iterate through the handler profiles.
+
+/**
+ * This function gets the next tasklet or timer handler profile.
+ *
+ * Handlers are identified by the address of their handler function, which can be resolved with the symbol map of
+ * the image. Handlers that did not fit in the profile table (`OPENTHREAD_CONFIG_HANDLER_PROFILER_MAX_ENTRIES`) are
+ * reported in a last entry with a zero handler address.
+ *
+ * @note This function requires `OPENTHREAD_CONFIG_ENABLE_HANDLER_PROFILER`.
+ *
+ * @param[in]     aInstance  A pointer to an OpenThread instance.
+ * @param[inout]  aIterator  A pointer to the iterator context. To get the first profile it should be set to
+ *                           OT_HANDLER_PROFILE_ITERATOR_INIT.
+ * @param[out]    aProfile   A pointer to where the handler profile is placed.
+ *
+ * @retval OT_ERROR_NONE       Successfully found the next handler profile.
+ * @retval OT_ERROR_NOT_FOUND  No subsequent handler profile exists.
+ *
+ */
+otError otTaskletGetNextHandlerProfile(otInstance *              aInstance,
+                                       otHandlerProfileIterator *aIterator,
+                                       otHandlerProfile *        aProfile);
+
+/**
+ * This function clears all the tasklet and timer handler profiles.
+ *
+ * @note This function requires `OPENTHREAD_CONFIG_ENABLE_HANDLER_PROFILER`.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ */
+void otTaskletResetHandlerProfiles(otInstance *aInstance);
+
 /**
  * @}
  *
@@ -0,0 +1,264 @@
+/*
+ *  Copyright (c) 2018, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * @file
+ * @brief
+ *  This file defines the OpenThread TCP API.
+ *
+ */
+
+#ifndef OPENTHREAD_TCP_H_
+#define OPENTHREAD_TCP_H_
+
+#include <openthread/ip6.h>
+#include <openthread/message.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup api-tcp
+ *
+ * @brief
+ *   This module includes functions that control TCP communication.
+ *
+ *   The functions in this module are available when TCP support is enabled
+ *   (`OPENTHREAD_CONFIG_ENABLE_TCP`).
+ *
+ * @{
+ *
+ */
+
+/**
+ * This enumeration represents the events reported on a TCP socket.
+ *
+ */
+typedef enum otTcpEvent
+{
+    OT_TCP_EVENT_CONNECTED   = 0, ///< The connection has been established.
+    OT_TCP_EVENT_SENT        = 1, ///< Queued data has been acknowledged and send buffer space was freed.
+    OT_TCP_EVENT_PEER_CLOSED = 2, ///< The peer has closed its side of the connection (no more data will arrive).
+    OT_TCP_EVENT_CLOSED      = 3, ///< The connection has been closed gracefully and the socket was released.
+    OT_TCP_EVENT_ABORTED     = 4, ///< The connection was reset or timed out and the socket was released.
+} otTcpEvent;
+
+struct otTcpSocket;
+
+/**
+ * This callback allows OpenThread to inform the application of data received on a TCP connection.
+ *
+ * The received bytes start at the offset of @p aMessage (see `otMessageGetOffset()`) and extend to its end. Data is
+ * delivered in order and exactly once. The message is owned by OpenThread and is only valid during the callback.
+ *
+ * @param[in]  aContext  A pointer to application-specific context.
+ * @param[in]  aSocket   A pointer to the TCP socket.
+ * @param[in]  aMessage  A pointer to the message holding the received data.
+ *
+ */
+typedef void (*otTcpReceive)(void *aContext, struct otTcpSocket *aSocket, const otMessage *aMessage);
+
+/**
+ * This callback allows OpenThread to inform the application of TCP socket events.
+ *
+ * @param[in]  aContext  A pointer to application-specific context.
+ * @param[in]  aSocket   A pointer to the TCP socket.
+ * @param[in]  aEvent    The event.
+ *
+ */
+typedef void (*otTcpEventHandler)(void *aContext, struct otTcpSocket *aSocket, otTcpEvent aEvent);
+
+/**
+ * This structure represents a TCP socket.
+ *
+ * The application owns the memory of the structure but must only access it through the functions in this module.
+ *
+ */
+typedef struct otTcpSocket
+{
+    otSockAddr          mSockName;           ///< The local IPv6 socket address.
+    otSockAddr          mPeerName;           ///< The peer IPv6 socket address.
+    otTcpReceive        mReceiveHandler;     ///< A function pointer to the application receive callback.
+    otTcpEventHandler   mEventHandler;       ///< A function pointer to the application event callback.
+    void *              mContext;            ///< A pointer to application-specific context.
+    otMessage *         mSendBuffer;         ///< Data not yet acknowledged by the peer (internal use only).
+    uint32_t            mSendUnacked;        ///< The oldest unacknowledged sequence number (internal use only).
+    uint32_t            mSendNext;           ///< The next sequence number to send (internal use only).
+    uint32_t            mReceiveNext;        ///< The next sequence number expected (internal use only).
+    uint32_t            mRttSequence;        ///< The sequence number being timed (internal use only).
+    uint32_t            mRttStartTime;       ///< The time the timed sequence number was sent (internal use only).
+    uint32_t            mTimerFireTime;      ///< The fire time of the socket timer (internal use only).
+    uint16_t            mSendWindow;         ///< The window advertised by the peer (internal use only).
+    uint16_t            mCongestionWindow;   ///< The congestion window (internal use only).
+    uint16_t            mSlowStartThreshold; ///< The slow start threshold (internal use only).
+    uint16_t            mMaxSegmentSize;     ///< The maximum segment size to send (internal use only).
+    uint16_t            mSmoothedRtt;        ///< The smoothed round-trip time in ms (internal use only).
+    uint16_t            mRttVariance;        ///< The round-trip time variation in ms (internal use only).
+    uint16_t            mRetransmitTimeout;  ///< The retransmission timeout in ms (internal use only).
+    uint8_t             mState;              ///< The connection state (internal use only).
+    uint8_t             mFlags;              ///< The socket flags (internal use only).
+    uint8_t             mRetransmitCount;    ///< The number of consecutive retransmissions (internal use only).
+    uint8_t             mDuplicateAckCount;  ///< The number of duplicate acknowledgments (internal use only).
+    struct otTcpSocket *mNext;               ///< A pointer to the next TCP socket (internal use only).
+} otTcpSocket;
+
+/**
+ * Open a TCP/IPv6 socket.
+ *
+ * The socket starts in the closed state. Use `otTcpBind()` and `otTcpListen()` to accept a connection, or
+ * `otTcpConnect()` to establish one.
+ *
+ * @param[in]  aInstance         A pointer to an OpenThread instance.
+ * @param[in]  aSocket           A pointer to a TCP socket structure.
+ * @param[in]  aReceiveHandler   A pointer to the function called when data is received.
+ * @param[in]  aEventHandler     A pointer to the function called on socket events.
+ * @param[in]  aContext          A pointer to application-specific context.
+ *
+ * @retval OT_ERROR_NONE     Successfully opened the socket.
+ * @retval OT_ERROR_ALREADY  The socket is already open.
+ *
+ * @sa otTcpClose
+ * @sa otTcpAbort
+ *
+ */
+otError otTcpOpen(otInstance *      aInstance,
+                  otTcpSocket *     aSocket,
+                  otTcpReceive      aReceiveHandler,
+                  otTcpEventHandler aEventHandler,
+                  void *            aContext);
+
+/**
+ * Bind a TCP/IPv6 socket.
+ *
+ * If the port of @p aSockName is zero, an ephemeral port is chosen.
+ *
+ * @param[in]  aSocket    A pointer to a TCP socket structure.
+ * @param[in]  aSockName  A pointer to an IPv6 socket address structure.
+ *
+ * @retval OT_ERROR_NONE           Bind operation was successful.
+ * @retval OT_ERROR_INVALID_STATE  The socket is not closed.
+ *
+ */
+otError otTcpBind(otTcpSocket *aSocket, const otSockAddr *aSockName);
+
+/**
+ * Wait for an incoming connection on a bound TCP/IPv6 socket.
+ *
+ * The socket itself becomes the connection once a peer connects, so each socket accepts a single connection.
+ *
+ * @param[in]  aSocket  A pointer to a TCP socket structure.
+ *
+ * @retval OT_ERROR_NONE           The socket is listening.
+ * @retval OT_ERROR_INVALID_STATE  The socket is not closed or is not bound to a port.
+ *
+ */
+otError otTcpListen(otTcpSocket *aSocket);
+
+/**
+ * Establish a connection to a peer.
+ *
+ * `OT_TCP_EVENT_CONNECTED` is reported once the connection is established.
+ *
+ * @param[in]  aSocket    A pointer to a TCP socket structure.
+ * @param[in]  aPeerName  A pointer to the IPv6 socket address of the peer.
+ *
+ * @retval OT_ERROR_NONE           Successfully started connecting.
+ * @retval OT_ERROR_INVALID_ARGS   The peer address or port is unspecified.
+ * @retval OT_ERROR_INVALID_STATE  The socket is not closed.
+ * @retval OT_ERROR_NO_BUFS        Insufficient buffers to send the connection request.
+ *
+ */
+otError otTcpConnect(otTcpSocket *aSocket, const otSockAddr *aPeerName);
+
+/**
+ * Queue data for transmission on a TCP connection.
+ *
+ * The data is copied into the send buffer of the socket and sent as the windows allow. Data may be queued while
+ * the connection is being established.
+ *
+ * @param[in]  aSocket  A pointer to a TCP socket structure.
+ * @param[in]  aBuf     A pointer to the data to send.
+ * @param[in]  aLength  The number of bytes to send.
+ *
+ * @retval OT_ERROR_NONE           Successfully queued all of the data.
+ * @retval OT_ERROR_INVALID_STATE  The socket cannot send data in its current state.
+ * @retval OT_ERROR_NO_BUFS        The send buffer does not have room for @p aLength bytes. Nothing was queued.
+ *
+ * @sa otTcpGetSendBufferSpace
+ *
+ */
+otError otTcpSend(otTcpSocket *aSocket, const void *aBuf, uint16_t aLength);
+
+/**
+ * Get the number of bytes that can currently be queued with `otTcpSend()`.
+ *
+ * @param[in]  aSocket  A pointer to a TCP socket structure.
+ *
+ * @returns The free space in the send buffer, in bytes.
+ *
+ */
+uint16_t otTcpGetSendBufferSpace(otTcpSocket *aSocket);
+
+/**
+ * Close a TCP connection gracefully.
+ *
+ * Queued data is still delivered before the connection is shut down. `OT_TCP_EVENT_CLOSED` is reported once the
+ * connection is closed, at which point the socket is released. A socket that is not connected is released
+ * immediately and no event is reported.
+ *
+ * @param[in]  aSocket  A pointer to a TCP socket structure.
+ *
+ * @retval OT_ERROR_NONE           Successfully started closing the connection.
+ * @retval OT_ERROR_INVALID_STATE  The connection is already closing.
+ *
+ */
+otError otTcpClose(otTcpSocket *aSocket);
+
+/**
+ * Abort a TCP connection.
+ *
+ * A reset is sent to the peer if a connection exists, queued data is discarded and the socket is released
+ * immediately. No event is reported.
+ *
+ * @param[in]  aSocket  A pointer to a TCP socket structure.
+ *
+ */
+void otTcpAbort(otTcpSocket *aSocket);
+
+/**
+ * @}
+ *
+ */
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // OPENTHREAD_TCP_H_
@@ -36,6 +36,7 @@
 #define OPENTHREAD_THREAD_H_
 
 #include <openthread/dataset.h>
+#include <openthread/ip6.h>
 #include <openthread/link.h>
 #include <openthread/message.h>
 
@@ -152,6 +153,17 @@ typedef struct otIpCounters
     uint32_t mRxSuccess; ///< The number of IPv6 packets successfully received.
     uint32_t mTxFailure; ///< The number of IPv6 packets failed to transmit.
     uint32_t mRxFailure; ///< The number of IPv6 packets failed to receive.
+    uint32_t mRxReassemblyTimeout;  ///< The number of IPv6 packets dropped due to 6LoWPAN reassembly timeout.
+    uint32_t mRxDuplicateFragments; ///< The number of duplicate 6LoWPAN fragments dropped.
+
+    /**
+     * The number of IPv6 packets dropped by the send queue active queue management, indexed by message priority
+     * (`otMessagePriority`, the last entry counts network control messages which are never dropped).
+     *
+     */
+    uint32_t mTxQueueDelayDrops[4];
+
+    uint32_t mTxExpired; ///< The number of IPv6 packets discarded because their lifetime expired.
 } otIpCounters;
 
 /**
@@ -181,6 +193,19 @@ typedef struct otMleCounters
      *
      */
     uint16_t mParentChanges;
+
+    /**
+     * Number of times the device, restarting as a child, tried to resume its saved parent link with a Child Update
+     * Request instead of a full attach.
+     *
+     */
+    uint16_t mParentSyncAttempts;
+
+    /**
+     * Number of parent link resume attempts that succeeded. Each failed attempt is followed by a full attach.
+     *
+     */
+    uint16_t mParentSyncSuccesses;
 } otMleCounters;
 
 /**
@@ -716,6 +741,27 @@ OTAPI otError OTCALL otThreadSendDiagnosticReset(otInstance *        aInstance,
  */
 OTAPI const otIpCounters *OTCALL otThreadGetIp6Counters(otInstance *aInstance);
 
+/**
+ * Get the Thread mesh layer drop counters.
+ *
+ * These counters cover messages and frames dropped by the mesh forwarder (send queue, address resolution, mesh
+ * forwarding and 6LoWPAN reassembly), independently of the log level.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ * @returns A pointer to the Thread mesh layer drop counters.
+ *
+ */
+const otIp6DropCounters *otThreadGetDropCounters(otInstance *aInstance);
+
+/**
+ * Reset the Thread mesh layer drop counters.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ */
+void otThreadResetDropCounters(otInstance *aInstance);
+
 /**
  * Get the Thread MLE counters.
  *
@@ -93,6 +93,30 @@ typedef struct otEidCacheEntry
     bool           mValid : 1; ///< Indicates whether or not the cache entry is valid
 } otEidCacheEntry;
 
+/**
+ * This structure represents the EID cache counters.
+ *
+ */
+typedef struct otEidCacheCounters
+{
+    uint32_t mHits;      ///< Number of lookups resolved from a cached entry
+    uint32_t mMisses;    ///< Number of lookups that required or were waiting on an Address Query
+    uint32_t mEvictions; ///< Number of valid entries evicted to make room for a new entry
+} otEidCacheCounters;
+
+/**
+ * This structure represents the Joiner Router relay counters.
+ *
+ */
+typedef struct otJoinerRouterCounters
+{
+    uint32_t mRelayRxDatagrams; ///< Number of DTLS datagrams received from joiners
+    uint32_t mRelayRxMessages;  ///< Number of RLY_RX.ntf messages sent (one may carry several datagrams)
+    uint32_t mRelayTxMessages;  ///< Number of RLY_TX.ntf messages relayed to joiners
+    uint32_t mJoinerEntrusts;   ///< Number of JOIN_ENT.ntf messages sent
+    uint32_t mDropped;          ///< Number of datagrams or messages that could not be relayed
+} otJoinerRouterCounters;
+
 /**
  * Get the maximum number of children currently allowed.
  *
@@ -223,6 +247,24 @@ OTAPI uint16_t OTCALL otThreadGetJoinerUdpPort(otInstance *aInstance);
  */
 OTAPI otError OTCALL otThreadSetJoinerUdpPort(otInstance *aInstance, uint16_t aJoinerUdpPort);
 
+/**
+ * This function gets the Joiner Router relay counters.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ * @returns A pointer to the Joiner Router relay counters.
+ *
+ */
+const otJoinerRouterCounters *otThreadGetJoinerRouterCounters(otInstance *aInstance);
+
+/**
+ * This function resets the Joiner Router relay counters.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ */
+void otThreadResetJoinerRouterCounters(otInstance *aInstance);
+
 /**
  * Set Steering data out of band.
  *
@@ -486,6 +528,24 @@ OTAPI otError OTCALL otThreadGetRouterInfo(otInstance *aInstance, uint16_t aRout
  */
 OTAPI otError OTCALL otThreadGetEidCacheEntry(otInstance *aInstance, uint8_t aIndex, otEidCacheEntry *aEntry);
 
+/**
+ * This function gets the EID cache counters.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ * @returns A pointer to the EID cache counters.
+ *
+ */
+const otEidCacheCounters *otThreadGetEidCacheCounters(otInstance *aInstance);
+
+/**
+ * This function resets the EID cache counters.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ */
+void otThreadResetEidCacheCounters(otInstance *aInstance);
+
 /**
  * Get the thrPSKc.
  *
@@ -203,6 +203,28 @@ otError otUdpConnect(otUdpSocket *aSocket, otSockAddr *aSockName);
  */
 otError otUdpSend(otUdpSocket *aSocket, otMessage *aMessage, const otMessageInfo *aMessageInfo);
 
+/**
+ * Send a UDP/IPv6 datagram with a payload taken from a buffer.
+ *
+ * This function is equivalent to calling otUdpNewMessage(), writing the payload and calling otUdpSend(), but the
+ * message is allocated in one step with the header space needed for the destination, and freed on failure.
+ *
+ * The message is sent with link security enabled and normal priority.
+ *
+ * @param[in]  aSocket       A pointer to a UDP socket structure.
+ * @param[in]  aBuf          A pointer to the payload.
+ * @param[in]  aLength       The length of the payload in bytes.
+ * @param[in]  aMessageInfo  A pointer to a message info structure.
+ *
+ * @retval OT_ERROR_NONE            The datagram is successfully scheduled for sending.
+ * @retval OT_ERROR_INVALID_ARGS    Invalid arguments are given.
+ * @retval OT_ERROR_NO_BUFS         Insufficient message buffers available for the datagram.
+ *
+ * @sa otUdpSend
+ *
+ */
+otError otUdpSendBuffer(otUdpSocket *aSocket, const void *aBuf, uint16_t aLength, const otMessageInfo *aMessageInfo);
+
 /**
  * @}
  *
@@ -0,0 +1,75 @@
+#!/bin/sh
+#
+#  Copyright (c) 2018, The OpenThread Authors.
+#  All rights reserved.
+#
+#  Redistribution and use in source and binary forms, with or without
+#  modification, are permitted provided that the following conditions are met:
+#  1. Redistributions of source code must retain the above copyright
+#     notice, this list of conditions and the following disclaimer.
+#  2. Redistributions in binary form must reproduce the above copyright
+#     notice, this list of conditions and the following disclaimer in the
+#     documentation and/or other materials provided with the distribution.
+#  3. Neither the name of the copyright holder nor the
+#     names of its contributors may be used to endorse or promote products
+#     derived from this software without specific prior written permission.
+#
+#  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+#  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+#  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+#  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+#  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+#  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+#  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+#  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+#  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+#  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+#  POSSIBILITY OF SUCH DAMAGE.
+#
+
+#
+# Prints the memory footprint report of an OpenThread library:
+#
+#   - the size of the main classes, read from the symbol sizes of the
+#     `otFootprint_<Class>` arrays in the footprint object (see
+#     src/core/common/footprint.cpp), and
+#   - the text/data/bss section sizes of each object in the library.
+#
+# Usage: footprint-report.sh <nm> <size> <library> [<footprint-object>]
+#
+
+set -e
+
+NM="$1"
+SIZE="$2"
+LIBRARY="$3"
+FOOTPRINT="$4"
+
+echo "Memory footprint of $(basename "${LIBRARY}")"
+echo
+
+if [ -n "${FOOTPRINT}" ]; then
+    echo "Class sizes (bytes):"
+    echo
+
+    ${NM} -S "${FOOTPRINT}" | awk '
+        function hex(aString,    i, value) {
+            value = 0
+            for (i = 1; i <= length(aString); i++) {
+                value = value * 16 + index("0123456789abcdef", tolower(substr(aString, i, 1))) - 1
+            }
+            return value
+        }
+        $4 ~ /^_?otFootprint_/ {
+            name = $4
+            sub(/^_?otFootprint_/, "", name)
+            printf("    %-32s %8d\n", name, hex($2))
+        }'
+
+    echo
+fi
+
+echo "Object section sizes (bytes):"
+echo
+
+${SIZE} -t "${LIBRARY}"
@@ -46,6 +46,8 @@
 #include <openthread/icmp6.h>
 #include <openthread/joiner.h>
 #include <openthread/link.h>
+#include <openthread/logging.h>
+#include <openthread/tasklet.h>
 #if OPENTHREAD_CONFIG_ENABLE_TIME_SYNC
 #include <openthread/network_time.h>
 #endif
@@ -100,6 +102,12 @@ namespace Cli {
 const struct Command Interpreter::sCommands[] = {
     {"help", &Interpreter::ProcessHelp},
     {"autostart", &Interpreter::ProcessAutoStart},
+#if OPENTHREAD_CONFIG_CLI_BENCHMARK
+    {"benchmark", &Interpreter::ProcessBenchmark},
+#endif
+#if OPENTHREAD_CONFIG_ENABLE_BOOT_TIMESTAMPS
+    {"boottime", &Interpreter::ProcessBootTime},
+#endif
     {"bufferinfo", &Interpreter::ProcessBufferInfo},
     {"channel", &Interpreter::ProcessChannel},
 #if OPENTHREAD_FTD
@@ -120,6 +128,9 @@ const struct Command Interpreter::sCommands[] = {
     {"contextreusedelay", &Interpreter::ProcessContextIdReuseDelay},
 #endif
     {"counter", &Interpreter::ProcessCounters},
+#if OPENTHREAD_CONFIG_ENABLE_CSL
+    {"cslperiod", &Interpreter::ProcessCslPeriod},
+#endif
     {"dataset", &Interpreter::ProcessDataset},
 #if OPENTHREAD_FTD
     {"delaytimermin", &Interpreter::ProcessDelayTimerMin},
@@ -166,6 +177,7 @@ const struct Command Interpreter::sCommands[] = {
     {"leaderpartitionid", &Interpreter::ProcessLeaderPartitionId},
     {"leaderweight", &Interpreter::ProcessLeaderWeight},
 #endif
+    {"loglevel", &Interpreter::ProcessLogLevel},
 #if OPENTHREAD_ENABLE_MAC_FILTER
     {"macfilter", &Interpreter::ProcessMacFilter},
 #endif
@@ -195,6 +207,9 @@ const struct Command Interpreter::sCommands[] = {
 #if OPENTHREAD_FTD
     {"parentpriority", &Interpreter::ProcessParentPriority},
 #endif
+#if OPENTHREAD_CONFIG_CLI_PERF
+    {"perf", &Interpreter::ProcessPerf},
+#endif
 #ifndef OTDLL
     {"ping", &Interpreter::ProcessPing},
 #endif
@@ -205,6 +220,9 @@ const struct Command Interpreter::sCommands[] = {
 #if OPENTHREAD_ENABLE_BORDER_ROUTER
     {"prefix", &Interpreter::ProcessPrefix},
 #endif
+#if OPENTHREAD_CONFIG_ENABLE_HANDLER_PROFILER
+    {"profile", &Interpreter::ProcessProfile},
+#endif
 #if OPENTHREAD_FTD
     {"pskc", &Interpreter::ProcessPSKc},
     {"releaserouterid", &Interpreter::ProcessReleaseRouterId},
@@ -231,6 +249,9 @@ const struct Command Interpreter::sCommands[] = {
 #endif
     {"state", &Interpreter::ProcessState},
     {"thread", &Interpreter::ProcessThread},
+#if OPENTHREAD_CONFIG_MAC_TSCH
+    {"tsch", &Interpreter::ProcessTsch},
+#endif
 #ifndef OTDLL
     {"txpower", &Interpreter::ProcessTxPower},
     {"udp", &Interpreter::ProcessUdp},
@@ -294,6 +315,12 @@ Interpreter::Interpreter(Instance *aInstance)
     , mUdp(*this)
 #endif
     , mInstance(aInstance)
+#if OPENTHREAD_CONFIG_CLI_BENCHMARK
+    , mBenchmark(*this)
+#endif
+#if OPENTHREAD_CONFIG_CLI_PERF
+    , mPerf(*this)
+#endif
 #if OPENTHREAD_ENABLE_APPLICATION_COAP
     , mCoap(*this)
 #endif
@@ -458,6 +485,32 @@ void Interpreter::ProcessAutoStart(int argc, char *argv[])
     AppendResult(error);
 }
 
+#if OPENTHREAD_CONFIG_CLI_BENCHMARK
+void Interpreter::ProcessBenchmark(int argc, char *argv[])
+{
+    otError error;
+    error = mBenchmark.Process(argc, argv);
+    AppendResult(error);
+}
+#endif
+
+#if OPENTHREAD_CONFIG_ENABLE_BOOT_TIMESTAMPS
+void Interpreter::ProcessBootTime(int argc, char *argv[])
+{
+    const otBootTimestamps *timestamps = otInstanceGetBootTimestamps(mInstance);
+    OT_UNUSED_VARIABLE(argc);
+    OT_UNUSED_VARIABLE(argv);
+
+    mServer->OutputFormat("constructed: %lu\r\n", static_cast<unsigned long>(timestamps->mConstructed));
+    mServer->OutputFormat("settings init: %lu\r\n", static_cast<unsigned long>(timestamps->mSettingsInit));
+    mServer->OutputFormat("restored: %lu\r\n", static_cast<unsigned long>(timestamps->mRestored));
+    mServer->OutputFormat("init done: %lu\r\n", static_cast<unsigned long>(timestamps->mInitDone));
+    mServer->OutputFormat("attached: %lu\r\n", static_cast<unsigned long>(timestamps->mAttached));
+
+    AppendResult(OT_ERROR_NONE);
+}
+#endif
+
 void Interpreter::ProcessBufferInfo(int argc, char *argv[])
 {
     otBufferInfo bufferInfo;
@@ -478,6 +531,14 @@ void Interpreter::ProcessBufferInfo(int argc, char *argv[])
     mServer->OutputFormat("coap secure: %d %d\r\n", bufferInfo.mCoapSecureMessages, bufferInfo.mCoapSecureBuffers);
     mServer->OutputFormat("application coap: %d %d\r\n", bufferInfo.mApplicationCoapMessages,
                           bufferInfo.mApplicationCoapBuffers);
+    mServer->OutputFormat("reserved: %d\r\n", bufferInfo.mReservedBuffers);
+    mServer->OutputFormat("indirect: %d\r\n", bufferInfo.mIndirectBuffers);
+    mServer->OutputFormat("coap cache: %d\r\n", bufferInfo.mCoapCacheBuffers);
+    mServer->OutputFormat("max used: %d\r\n", bufferInfo.mMaxUsedBuffers);
+    mServer->OutputFormat("alloc failures: %d\r\n", bufferInfo.mAllocFailures);
+    mServer->OutputFormat("low buffer time: %lu\r\n", static_cast<unsigned long>(bufferInfo.mLowBufferTime));
+    mServer->OutputFormat("prepend reallocations: %lu\r\n",
+                          static_cast<unsigned long>(bufferInfo.mPrependReallocations));
 
     AppendResult(OT_ERROR_NONE);
 }
@@ -699,6 +760,10 @@ void Interpreter::ProcessCounters(int argc, char *argv[])
     if (argc == 0)
     {
         mServer->OutputFormat("mac\r\n");
+        mServer->OutputFormat("drops\r\n");
+#if OPENTHREAD_CONFIG_ENABLE_RADIO_TIME_STATS
+        mServer->OutputFormat("radio\r\n");
+#endif
         mServer->OutputFormat("Done\r\n");
     }
     else
@@ -738,9 +803,82 @@ void Interpreter::ProcessCounters(int argc, char *argv[])
             mServer->OutputFormat("    RxErrFcs: %d\r\n", counters->mRxErrFcs);
             mServer->OutputFormat("    RxErrOther: %d\r\n", counters->mRxErrOther);
         }
+        else if (strcmp(argv[0], "drops") == 0)
+        {
+            ProcessDropCounters(argc - 1, argv + 1);
+        }
+#if OPENTHREAD_CONFIG_ENABLE_RADIO_TIME_STATS
+        else if (strcmp(argv[0], "radio") == 0)
+        {
+            ProcessRadioTimeCounters();
+        }
+#endif
+    }
+}
+
+void Interpreter::ProcessDropCounters(int argc, char *argv[])
+{
+    static const char *const kReasonNames[OT_IP6_NUM_DROP_REASONS] = {
+        "NoRoute", "AddressQuery", "Reassembly", "Evicted",   "Security", "Duplicate",
+        "NoBufs",  "Expired",      "QueueDelay", "Malformed", "Other",
+    };
+
+    otError                  error = OT_ERROR_NONE;
+    const otIp6DropCounters *mesh  = otThreadGetDropCounters(mInstance);
+    const otIp6DropCounters *ip6   = otIp6GetDropCounters(mInstance);
+
+    if (argc > 0)
+    {
+        VerifyOrExit(strcmp(argv[0], "reset") == 0, error = OT_ERROR_INVALID_ARGS);
+        otThreadResetDropCounters(mInstance);
+        otIp6ResetDropCounters(mInstance);
+        ExitNow();
+    }
+
+    mServer->OutputFormat("| Reason       | MeshTx     | MeshRx     | Ip6Tx      | Ip6Rx      |\r\n");
+    mServer->OutputFormat("+--------------+------------+------------+------------+------------+\r\n");
+
+    for (uint8_t i = 0; i < OT_IP6_NUM_DROP_REASONS; i++)
+    {
+        mServer->OutputFormat("| %-12s | %10u | %10u | %10u | %10u |\r\n", kReasonNames[i], mesh->mTx[i], mesh->mRx[i],
+                              ip6->mTx[i], ip6->mRx[i]);
     }
+
+exit:
+    AppendResult(error);
 }
 
+#if OPENTHREAD_CONFIG_ENABLE_RADIO_TIME_STATS
+void Interpreter::ProcessRadioTimeCounters(void)
+{
+    static const char *const kCauseNames[OT_RADIO_NUM_TIME_CAUSES] = {
+        "Idle", "ActiveScan", "EnergyScan", "TxBeacon", "TxData", "DataPoll", "WaitForData", "TxOob",
+    };
+
+    const otRadioTimeStats *stats = otLinkGetRadioTimeStats(mInstance);
+
+    mServer->OutputFormat("| Cause        | Sleep (ms) | Rx (ms)    | Tx (ms)    |\r\n");
+    mServer->OutputFormat("+--------------+------------+------------+------------+\r\n");
+
+    for (uint8_t i = 0; i < OT_RADIO_NUM_TIME_CAUSES; i++)
+    {
+        const uint64_t *time = stats->mCauseTime[i];
+
+        mServer->OutputFormat("| %-12s | %10lu | %10lu | %10lu |\r\n", kCauseNames[i],
+                              static_cast<unsigned long>(time[OT_RADIO_TIME_STATE_SLEEP] / 1000),
+                              static_cast<unsigned long>(time[OT_RADIO_TIME_STATE_RECEIVE] / 1000),
+                              static_cast<unsigned long>(time[OT_RADIO_TIME_STATE_TRANSMIT] / 1000));
+    }
+
+    mServer->OutputFormat("| %-12s | %10lu | %10lu | %10lu |\r\n", "Total",
+                          static_cast<unsigned long>(stats->mStateTime[OT_RADIO_TIME_STATE_SLEEP] / 1000),
+                          static_cast<unsigned long>(stats->mStateTime[OT_RADIO_TIME_STATE_RECEIVE] / 1000),
+                          static_cast<unsigned long>(stats->mStateTime[OT_RADIO_TIME_STATE_TRANSMIT] / 1000));
+
+    AppendResult(OT_ERROR_NONE);
+}
+#endif // OPENTHREAD_CONFIG_ENABLE_RADIO_TIME_STATS
+
 void Interpreter::ProcessDataset(int argc, char *argv[])
 {
     otError error;
@@ -1308,6 +1446,42 @@ exit:
 }
 #endif // OPENTHREAD_FTD
 
+void Interpreter::ProcessLogLevel(int argc, char *argv[])
+{
+    otError error = OT_ERROR_NONE;
+    long    region;
+    long    level;
+
+    if (argc == 0)
+    {
+        mServer->OutputFormat("%d\r\n", otLoggingGetLevel());
+    }
+    else if (strcmp(argv[0], "region") == 0)
+    {
+        VerifyOrExit(argc >= 2, error = OT_ERROR_INVALID_ARGS);
+        SuccessOrExit(error = ParseLong(argv[1], region));
+
+        if (argc == 2)
+        {
+            mServer->OutputFormat("%d\r\n", otLoggingGetRegionLevel(static_cast<otLogRegion>(region)));
+        }
+        else
+        {
+            SuccessOrExit(error = ParseLong(argv[2], level));
+            SuccessOrExit(error = otLoggingSetRegionLevel(static_cast<otLogRegion>(region),
+                                                          static_cast<otLogLevel>(level)));
+        }
+    }
+    else
+    {
+        SuccessOrExit(error = ParseLong(argv[0], level));
+        SuccessOrExit(error = otLoggingSetLevel(static_cast<otLogLevel>(level)));
+    }
+
+exit:
+    AppendResult(error);
+}
+
 #if OPENTHREAD_FTD
 void Interpreter::ProcessPSKc(int argc, char *argv[])
 {
@@ -1731,6 +1905,15 @@ exit:
 }
 #endif
 
+#if OPENTHREAD_CONFIG_CLI_PERF
+void Interpreter::ProcessPerf(int argc, char *argv[])
+{
+    otError error;
+    error = mPerf.Process(argc, argv);
+    AppendResult(error);
+}
+#endif
+
 #ifndef OTDLL
 void Interpreter::s_HandleIcmpReceive(void *               aContext,
                                       otMessage *          aMessage,
@@ -1870,6 +2053,28 @@ exit:
 }
 #endif
 
+#if OPENTHREAD_CONFIG_ENABLE_CSL
+void Interpreter::ProcessCslPeriod(int argc, char *argv[])
+{
+    otError error = OT_ERROR_NONE;
+    long    value;
+
+    if (argc == 0)
+    {
+        mServer->OutputFormat("%d\r\n", otLinkGetCslPeriod(mInstance));
+    }
+    else
+    {
+        SuccessOrExit(error = ParseLong(argv[0], value));
+        VerifyOrExit(value >= 0 && value <= 0xffff, error = OT_ERROR_INVALID_ARGS);
+        error = otLinkSetCslPeriod(mInstance, static_cast<uint16_t>(value));
+    }
+
+exit:
+    AppendResult(error);
+}
+#endif // OPENTHREAD_CONFIG_ENABLE_CSL
+
 void Interpreter::ProcessPollPeriod(int argc, char *argv[])
 {
     otError error = OT_ERROR_NONE;
@@ -1890,6 +2095,37 @@ exit:
 }
 
 #ifndef OTDLL
+#if OPENTHREAD_CONFIG_ENABLE_HANDLER_PROFILER
+void Interpreter::ProcessProfile(int argc, char *argv[])
+{
+    otError                  error    = OT_ERROR_NONE;
+    otHandlerProfileIterator iterator = OT_HANDLER_PROFILE_ITERATOR_INIT;
+    otHandlerProfile         profile;
+
+    if (argc > 0)
+    {
+        VerifyOrExit(strcmp(argv[0], "reset") == 0, error = OT_ERROR_INVALID_ARGS);
+        otTaskletResetHandlerProfiles(mInstance);
+        ExitNow();
+    }
+
+    mServer->OutputFormat("| Type    | Handler    | Count      | Total (us)   | Max (us)   | Avg (us)   |\r\n");
+    mServer->OutputFormat("+---------+------------+------------+--------------+------------+------------+\r\n");
+
+    while (otTaskletGetNextHandlerProfile(mInstance, &iterator, &profile) == OT_ERROR_NONE)
+    {
+        mServer->OutputFormat("| %-7s | 0x%08lx | %10u | %12lu | %10u | %10u |\r\n",
+                              (profile.mType == OT_HANDLER_TYPE_TASKLET) ? "tasklet" : "timer",
+                              static_cast<unsigned long>(profile.mHandler), profile.mCount,
+                              static_cast<unsigned long>(profile.mTotalTime), profile.mMaxTime,
+                              static_cast<uint32_t>(profile.mTotalTime / profile.mCount));
+    }
+
+exit:
+    AppendResult(error);
+}
+#endif // OPENTHREAD_CONFIG_ENABLE_HANDLER_PROFILER
+
 void Interpreter::ProcessPromiscuous(int argc, char *argv[])
 {
     otError error = OT_ERROR_NONE;
@@ -2876,6 +3112,86 @@ exit:
     AppendResult(error);
 }
 
+#if OPENTHREAD_CONFIG_MAC_TSCH
+void Interpreter::ProcessTsch(int argc, char *argv[])
+{
+    otError        error = OT_ERROR_NONE;
+    otLinkTschCell cell;
+    long           value;
+
+    if (argc == 0)
+    {
+        mServer->OutputFormat("slotframe: %d\r\n", otLinkTschGetSlotframeLength(mInstance));
+
+        for (uint8_t i = 0; otLinkTschGetCell(mInstance, i, &cell) == OT_ERROR_NONE; i++)
+        {
+            mServer->OutputFormat("slot %d, choff %d, %s%s%s\r\n", cell.mSlotOffset, cell.mChannelOffset,
+                                  (cell.mOptions & OT_LINK_TSCH_CELL_OPTION_TX) ? "t" : "",
+                                  (cell.mOptions & OT_LINK_TSCH_CELL_OPTION_RX) ? "r" : "",
+                                  (cell.mOptions & OT_LINK_TSCH_CELL_OPTION_SHARED) ? "s" : "");
+        }
+    }
+    else if (strcmp(argv[0], "slotframe") == 0)
+    {
+        VerifyOrExit(argc == 2, error = OT_ERROR_INVALID_ARGS);
+        SuccessOrExit(error = ParseLong(argv[1], value));
+        VerifyOrExit(value >= 0 && value <= 0xffff, error = OT_ERROR_INVALID_ARGS);
+        otLinkTschSetSlotframeLength(mInstance, static_cast<uint16_t>(value));
+    }
+    else if (strcmp(argv[0], "add") == 0)
+    {
+        VerifyOrExit(argc == 4, error = OT_ERROR_INVALID_ARGS);
+
+        SuccessOrExit(error = ParseLong(argv[1], value));
+        VerifyOrExit(value >= 0 && value <= 0xffff, error = OT_ERROR_INVALID_ARGS);
+        cell.mSlotOffset = static_cast<uint16_t>(value);
+
+        SuccessOrExit(error = ParseLong(argv[2], value));
+        VerifyOrExit(value >= 0 && value <= 0xff, error = OT_ERROR_INVALID_ARGS);
+        cell.mChannelOffset = static_cast<uint8_t>(value);
+
+        cell.mOptions = 0;
+
+        for (char *arg = argv[3]; *arg != '\0'; arg++)
+        {
+            switch (*arg)
+            {
+            case 't':
+                cell.mOptions |= OT_LINK_TSCH_CELL_OPTION_TX;
+                break;
+
+            case 'r':
+                cell.mOptions |= OT_LINK_TSCH_CELL_OPTION_RX;
+                break;
+
+            case 's':
+                cell.mOptions |= OT_LINK_TSCH_CELL_OPTION_SHARED;
+                break;
+
+            default:
+                ExitNow(error = OT_ERROR_INVALID_ARGS);
+            }
+        }
+
+        error = otLinkTschAddCell(mInstance, &cell);
+    }
+    else if (strcmp(argv[0], "remove") == 0)
+    {
+        VerifyOrExit(argc == 2, error = OT_ERROR_INVALID_ARGS);
+        SuccessOrExit(error = ParseLong(argv[1], value));
+        VerifyOrExit(value >= 0 && value <= 0xffff, error = OT_ERROR_INVALID_ARGS);
+        error = otLinkTschRemoveCell(mInstance, static_cast<uint16_t>(value));
+    }
+    else
+    {
+        ExitNow(error = OT_ERROR_INVALID_ARGS);
+    }
+
+exit:
+    AppendResult(error);
+}
+#endif // OPENTHREAD_CONFIG_MAC_TSCH
+
 #ifndef OTDLL
 void Interpreter::ProcessTxPower(int argc, char *argv[])
 {
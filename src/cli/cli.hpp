@@ -42,6 +42,8 @@
 #include <openthread/ip6.h>
 #include <openthread/udp.h>
 
+#include "cli/cli_benchmark.hpp"
+#include "cli/cli_perf.hpp"
 #include "cli/cli_server.hpp"
 #include "cli/cli_udp_example.hpp"
 
@@ -99,8 +101,10 @@ struct Command
  */
 class Interpreter
 {
+    friend class Benchmark;
     friend class Coap;
     friend class CoapSecure;
+    friend class Perf;
     friend class UdpExample;
 
 public:
@@ -189,6 +193,12 @@ private:
 
     void ProcessHelp(int argc, char *argv[]);
     void ProcessAutoStart(int argc, char *argv[]);
+#if OPENTHREAD_CONFIG_CLI_BENCHMARK
+    void ProcessBenchmark(int argc, char *argv[]);
+#endif
+#if OPENTHREAD_CONFIG_ENABLE_BOOT_TIMESTAMPS
+    void ProcessBootTime(int argc, char *argv[]);
+#endif
     void ProcessBufferInfo(int argc, char *argv[]);
     void ProcessChannel(int argc, char *argv[]);
 #if OPENTHREAD_FTD
@@ -209,6 +219,13 @@ private:
     void ProcessContextIdReuseDelay(int argc, char *argv[]);
 #endif
     void ProcessCounters(int argc, char *argv[]);
+    void ProcessDropCounters(int argc, char *argv[]);
+#if OPENTHREAD_CONFIG_ENABLE_RADIO_TIME_STATS
+    void ProcessRadioTimeCounters(void);
+#endif
+#if OPENTHREAD_CONFIG_ENABLE_CSL
+    void ProcessCslPeriod(int argc, char *argv[]);
+#endif
     void ProcessDataset(int argc, char *argv[]);
 #if OPENTHREAD_FTD
     void ProcessDelayTimerMin(int argc, char *argv[]);
@@ -256,6 +273,7 @@ private:
     void ProcessLeaderPartitionId(int argc, char *argv[]);
     void ProcessLeaderWeight(int argc, char *argv[]);
 #endif
+    void ProcessLogLevel(int argc, char *argv[]);
     void ProcessMasterKey(int argc, char *argv[]);
     void ProcessMode(int argc, char *argv[]);
 #if OPENTHREAD_FTD
@@ -282,6 +300,9 @@ private:
     void ProcessParent(int argc, char *argv[]);
 #if OPENTHREAD_FTD
     void ProcessParentPriority(int argc, char *argv[]);
+#endif
+#if OPENTHREAD_CONFIG_CLI_PERF
+    void ProcessPerf(int argc, char *argv[]);
 #endif
     void ProcessPing(int argc, char *argv[]);
     void ProcessPollPeriod(int argc, char *argv[]);
@@ -290,6 +311,9 @@ private:
     otError ProcessPrefixAdd(int argc, char *argv[]);
     otError ProcessPrefixRemove(int argc, char *argv[]);
     otError ProcessPrefixList(void);
+#endif
+#if OPENTHREAD_CONFIG_ENABLE_HANDLER_PROFILER
+    void ProcessProfile(int argc, char *argv[]);
 #endif
     void ProcessPromiscuous(int argc, char *argv[]);
 #if OPENTHREAD_FTD
@@ -318,6 +342,9 @@ private:
 #endif
     void ProcessState(int argc, char *argv[]);
     void ProcessThread(int argc, char *argv[]);
+#if OPENTHREAD_CONFIG_MAC_TSCH
+    void ProcessTsch(int argc, char *argv[]);
+#endif
 #ifndef OTDLL
     void ProcessTxPower(int argc, char *argv[]);
     void ProcessUdp(int argc, char *argv[]);
@@ -453,6 +480,16 @@ private:
 
     Instance *mInstance;
 
+#if OPENTHREAD_CONFIG_CLI_BENCHMARK
+
+    Benchmark mBenchmark;
+
+#endif // OPENTHREAD_CONFIG_CLI_BENCHMARK
+#if OPENTHREAD_CONFIG_CLI_PERF
+
+    Perf mPerf;
+
+#endif // OPENTHREAD_CONFIG_CLI_PERF
 #if OPENTHREAD_ENABLE_APPLICATION_COAP
 
     Coap mCoap;
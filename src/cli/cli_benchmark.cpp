@@ -0,0 +1,273 @@
+/*
+ *  Copyright (c) 2018, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the CLI benchmark of core kernels.
+ */
+
+#include "cli_benchmark.hpp"
+
+#if OPENTHREAD_CONFIG_CLI_BENCHMARK
+
+#include <openthread/platform/alarm-micro.h>
+#include <openthread/platform/alarm-milli.h>
+#include <openthread/platform/misc.h>
+
+#include "cli/cli.hpp"
+#include "common/code_utils.hpp"
+#include "common/crc16.hpp"
+#include "common/instance.hpp"
+#include "common/message.hpp"
+#include "crypto/aes_ccm.hpp"
+#include "mac/mac_frame.hpp"
+#include "net/ip6_headers.hpp"
+#include "net/udp6.hpp"
+#include "thread/lowpan.hpp"
+#include "thread/thread_netif.hpp"
+
+namespace ot {
+namespace Cli {
+
+static const uint16_t sSizes[] = {16, 64, 127};
+
+Benchmark::Benchmark(Interpreter &aInterpreter)
+    : mInterpreter(aInterpreter)
+{
+    for (uint8_t i = 0; i < kBufferSize; i++)
+    {
+        mBuffer[i] = i;
+    }
+}
+
+otError Benchmark::Process(int argc, char *argv[])
+{
+    otError       error      = OT_ERROR_NONE;
+    unsigned long iterations = kDefaultIterations;
+
+    VerifyOrExit(argc <= 1, error = OT_ERROR_INVALID_ARGS);
+
+    if (argc == 1)
+    {
+        SuccessOrExit(error = Interpreter::ParseUnsignedLong(argv[0], iterations));
+        VerifyOrExit(iterations > 0 && iterations <= 0xffffffff, error = OT_ERROR_INVALID_ARGS);
+    }
+
+    mInterpreter.mServer->OutputFormat("kernel size iterations cycles/op\r\n");
+
+    RunAesCcm(static_cast<uint32_t>(iterations));
+    RunCrc16(static_cast<uint32_t>(iterations));
+    SuccessOrExit(error = RunLowpan(static_cast<uint32_t>(iterations)));
+    SuccessOrExit(error = RunMessageCopy(static_cast<uint32_t>(iterations)));
+
+exit:
+    return error;
+}
+
+void Benchmark::OutputResult(const char *aKernel, uint16_t aSize, uint32_t aIterations, uint32_t aCycles)
+{
+    mInterpreter.mServer->OutputFormat("%s %u %u %u\r\n", aKernel, aSize, static_cast<unsigned int>(aIterations),
+                                       static_cast<unsigned int>(aCycles / aIterations));
+}
+
+void Benchmark::RunAesCcm(uint32_t aIterations)
+{
+    const uint8_t key[]   = {0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7,
+                           0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf};
+    const uint8_t nonce[] = {0xac, 0xde, 0x48, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x02};
+
+    Crypto::AesCcm aesCcm;
+    uint8_t        tag[Crypto::AesEcb::kBlockSize];
+
+    aesCcm.SetKey(key, sizeof(key));
+
+    for (uint8_t index = 0; index < OT_ARRAY_LENGTH(sSizes); index++)
+    {
+        // a MAC header sized associated data followed by the payload, as for a secured data frame
+        uint16_t size   = sSizes[index];
+        uint16_t header = (size > 21) ? 21 : size / 2;
+        uint32_t start  = otPlatGetCycleCount();
+
+        for (uint32_t i = 0; i < aIterations; i++)
+        {
+            uint8_t tagLength = 4;
+
+            aesCcm.Init(header, size - header, tagLength, nonce, sizeof(nonce));
+            aesCcm.Header(mBuffer, header);
+            aesCcm.Payload(mBuffer + header, mBuffer + header, size - header, true);
+            aesCcm.Finalize(tag, &tagLength);
+        }
+
+        OutputResult("aes-ccm", size, aIterations, otPlatGetCycleCount() - start);
+    }
+}
+
+void Benchmark::RunCrc16(uint32_t aIterations)
+{
+    Crc16 crc16(Crc16::kCcitt);
+
+    for (uint8_t index = 0; index < OT_ARRAY_LENGTH(sSizes); index++)
+    {
+        uint16_t size  = sSizes[index];
+        uint32_t start = otPlatGetCycleCount();
+
+        for (uint32_t i = 0; i < aIterations; i++)
+        {
+            crc16.Init();
+            crc16.Update(mBuffer, size);
+        }
+
+        OutputResult("crc16", size, aIterations, otPlatGetCycleCount() - start);
+    }
+}
+
+otError Benchmark::RunLowpan(uint32_t aIterations)
+{
+    const uint8_t macSourceBytes[] = {0x00, 0x00, 0x5e, 0xef, 0x10, 0x22, 0x11, 0x00};
+    const uint8_t macDestBytes[]   = {0x00, 0x00, 0x5e, 0xef, 0x10, 0xaa, 0xbb, 0xcc};
+
+    otError         error   = OT_ERROR_NONE;
+    Lowpan::Lowpan &lowpan  = mInterpreter.mInstance->GetThreadNetif().GetLowpan();
+    Message *       message = NULL;
+    Mac::Address    macSource;
+    Mac::Address    macDest;
+    Ip6::Header     ip6Header;
+    Ip6::UdpHeader  udpHeader;
+    uint8_t         frame[kBufferSize];
+    int             frameLength;
+    uint16_t        size = 16;
+    uint32_t        start;
+
+    macSource.SetExtended(macSourceBytes, /* reverse */ false);
+    macDest.SetExtended(macDestBytes, /* reverse */ false);
+
+    // a link-local UDP datagram, whose IPv6 and UDP headers compress fully
+    ip6Header.Init();
+    ip6Header.SetPayloadLength(sizeof(udpHeader) + size);
+    ip6Header.SetNextHeader(Ip6::kProtoUdp);
+    ip6Header.SetHopLimit(64);
+    ip6Header.GetSource().FromString("fe80::200:5eef:1022:1100");
+    ip6Header.GetDestination().FromString("fe80::200:5eef:10aa:bbcc");
+
+    udpHeader.SetSourcePort(61616);
+    udpHeader.SetDestinationPort(61631);
+    udpHeader.SetLength(sizeof(udpHeader) + size);
+    udpHeader.SetChecksum(0xface);
+
+    VerifyOrExit((message = mInterpreter.mInstance->GetMessagePool().New(Message::kTypeIp6, 0)) != NULL,
+                 error = OT_ERROR_NO_BUFS);
+    SuccessOrExit(error = message->Append(&ip6Header, sizeof(ip6Header)));
+    SuccessOrExit(error = message->Append(&udpHeader, sizeof(udpHeader)));
+    SuccessOrExit(error = message->Append(mBuffer, size));
+
+    start = otPlatGetCycleCount();
+
+    for (uint32_t i = 0; i < aIterations; i++)
+    {
+        message->SetOffset(0);
+        frameLength = lowpan.Compress(*message, macSource, macDest, frame);
+    }
+
+    OutputResult("lowpan-compress", size, aIterations, otPlatGetCycleCount() - start);
+    VerifyOrExit(frameLength > 0, error = OT_ERROR_FAILED);
+
+    start = otPlatGetCycleCount();
+
+    for (uint32_t i = 0; i < aIterations; i++)
+    {
+        SuccessOrExit(error = message->SetLength(0));
+        VerifyOrExit(lowpan.Decompress(*message, macSource, macDest, frame, static_cast<uint16_t>(frameLength), 0) > 0,
+                     error = OT_ERROR_FAILED);
+    }
+
+    OutputResult("lowpan-decompress", size, aIterations, otPlatGetCycleCount() - start);
+
+exit:
+
+    if (message != NULL)
+    {
+        message->Free();
+    }
+
+    return error;
+}
+
+otError Benchmark::RunMessageCopy(uint32_t aIterations)
+{
+    otError  error       = OT_ERROR_NONE;
+    Message *source      = NULL;
+    Message *destination = NULL;
+
+    VerifyOrExit((source = mInterpreter.mInstance->GetMessagePool().New(Message::kTypeIp6, 0)) != NULL,
+                 error = OT_ERROR_NO_BUFS);
+    VerifyOrExit((destination = mInterpreter.mInstance->GetMessagePool().New(Message::kTypeIp6, 0)) != NULL,
+                 error = OT_ERROR_NO_BUFS);
+    SuccessOrExit(error = source->Append(mBuffer, kBufferSize));
+    SuccessOrExit(error = destination->SetLength(kBufferSize));
+
+    for (uint8_t index = 0; index < OT_ARRAY_LENGTH(sSizes); index++)
+    {
+        uint16_t size  = sSizes[index];
+        uint32_t start = otPlatGetCycleCount();
+
+        for (uint32_t i = 0; i < aIterations; i++)
+        {
+            source->CopyTo(0, 0, size, *destination);
+        }
+
+        OutputResult("message-copy", size, aIterations, otPlatGetCycleCount() - start);
+    }
+
+exit:
+
+    if (source != NULL)
+    {
+        source->Free();
+    }
+
+    if (destination != NULL)
+    {
+        destination->Free();
+    }
+
+    return error;
+}
+
+} // namespace Cli
+} // namespace ot
+
+OT_TOOL_WEAK uint32_t otPlatGetCycleCount(void)
+{
+#if OPENTHREAD_CONFIG_ENABLE_PLATFORM_USEC_TIMER
+    return otPlatAlarmMicroGetNow();
+#else
+    return otPlatAlarmMilliGetNow() * 1000;
+#endif
+}
+
+#endif // OPENTHREAD_CONFIG_CLI_BENCHMARK
@@ -0,0 +1,553 @@
+/*
+ *  Copyright (c) 2018, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the CLI UDP throughput and latency generator.
+ */
+
+#include "cli_perf.hpp"
+
+#if OPENTHREAD_CONFIG_CLI_PERF
+
+#include <openthread/message.h>
+
+#include "cli/cli.hpp"
+#include "common/code_utils.hpp"
+#include "common/encoding.hpp"
+
+using ot::Encoding::BigEndian::HostSwap32;
+
+namespace ot {
+namespace Cli {
+
+const struct Perf::Command Perf::sCommands[] = {{"help", &Perf::ProcessHelp},
+                                                {"server", &Perf::ProcessServer},
+                                                {"client", &Perf::ProcessClient},
+                                                {"stop", &Perf::ProcessStop},
+                                                {"result", &Perf::ProcessResult}};
+
+Perf::Perf(Interpreter &aInterpreter)
+    : mInterpreter(aInterpreter)
+    , mTimer(*aInterpreter.mInstance, &Perf::HandleTimer, &aInterpreter)
+    , mState(kStateIdle)
+    , mLength(0)
+    , mRate(0)
+    , mStartTime(0)
+    , mEndTime(0)
+    , mNextProbeTime(0)
+    , mSent(0)
+    , mReportRequests(0)
+    , mRttCount(0)
+    , mFirstTime(0)
+    , mLastTime(0)
+    , mLastTransit(0)
+{
+    memset(&mSocket, 0, sizeof(mSocket));
+    memset(&mPeerInfo, 0, sizeof(mPeerInfo));
+    memset(&mStats, 0, sizeof(mStats));
+    memset(&mLastReport, 0, sizeof(mLastReport));
+}
+
+otError Perf::Process(int argc, char *argv[])
+{
+    otError error = OT_ERROR_PARSE;
+
+    if (argc < 1)
+    {
+        ProcessHelp(0, NULL);
+        error = OT_ERROR_INVALID_ARGS;
+    }
+    else
+    {
+        for (size_t i = 0; i < OT_ARRAY_LENGTH(sCommands); i++)
+        {
+            if (strcmp(argv[0], sCommands[i].mName) == 0)
+            {
+                error = (this->*sCommands[i].mCommand)(argc - 1, argv + 1);
+                break;
+            }
+        }
+    }
+
+    return error;
+}
+
+otError Perf::ProcessHelp(int argc, char *argv[])
+{
+    for (unsigned int i = 0; i < OT_ARRAY_LENGTH(sCommands); i++)
+    {
+        mInterpreter.mServer->OutputFormat("%s\r\n", sCommands[i].mName);
+    }
+
+    OT_UNUSED_VARIABLE(argc);
+    OT_UNUSED_VARIABLE(argv);
+
+    return OT_ERROR_NONE;
+}
+
+otError Perf::ProcessServer(int argc, char *argv[])
+{
+    otError       error;
+    unsigned long port = kDefaultPort;
+
+    VerifyOrExit(mState == kStateIdle, error = OT_ERROR_BUSY);
+    VerifyOrExit(argc <= 1, error = OT_ERROR_INVALID_ARGS);
+
+    if (argc == 1)
+    {
+        SuccessOrExit(error = Interpreter::ParseUnsignedLong(argv[0], port));
+        VerifyOrExit(port > 0 && port <= 0xffff, error = OT_ERROR_INVALID_ARGS);
+    }
+
+    SuccessOrExit(error = Open(static_cast<uint16_t>(port)));
+
+    ResetServerStats();
+    memset(&mLastReport, 0, sizeof(mLastReport));
+    mState = kStateServer;
+
+exit:
+    return error;
+}
+
+otError Perf::ProcessClient(int argc, char *argv[])
+{
+    otError       error;
+    unsigned long value[4] = {kDefaultPort, kDefaultLength, kDefaultRate, kDefaultDuration};
+
+    VerifyOrExit(mState == kStateIdle, error = OT_ERROR_BUSY);
+    VerifyOrExit(argc >= 1 && argc <= 5, error = OT_ERROR_INVALID_ARGS);
+
+    memset(&mPeerInfo, 0, sizeof(mPeerInfo));
+    SuccessOrExit(error = otIp6AddressFromString(argv[0], &mPeerInfo.mPeerAddr));
+
+    for (int i = 1; i < argc; i++)
+    {
+        SuccessOrExit(error = Interpreter::ParseUnsignedLong(argv[i], value[i - 1]));
+    }
+
+    VerifyOrExit(value[0] > 0 && value[0] <= 0xffff, error = OT_ERROR_INVALID_ARGS);
+    VerifyOrExit(value[1] >= sizeof(Header) && value[1] <= 1232, error = OT_ERROR_INVALID_ARGS);
+    VerifyOrExit(value[2] > 0 && value[2] <= 1000, error = OT_ERROR_INVALID_ARGS);
+    VerifyOrExit(value[3] > 0 && value[3] <= 3600, error = OT_ERROR_INVALID_ARGS);
+
+    mPeerInfo.mPeerPort    = static_cast<uint16_t>(value[0]);
+    mPeerInfo.mInterfaceId = OT_NETIF_INTERFACE_ID_THREAD;
+
+    SuccessOrExit(error = Open(0));
+
+    mLength         = static_cast<uint16_t>(value[1]);
+    mRate           = static_cast<uint32_t>(value[2]);
+    mStartTime      = TimerMilli::GetNow();
+    mEndTime        = mStartTime + static_cast<uint32_t>(value[3]) * 1000;
+    mNextProbeTime  = mStartTime;
+    mSent           = 0;
+    mReportRequests = 0;
+    mRttCount       = 0;
+    mState          = kStateClientSending;
+
+    HandleTimer();
+
+exit:
+    return error;
+}
+
+otError Perf::ProcessStop(int argc, char *argv[])
+{
+    otError error = OT_ERROR_NONE;
+
+    OT_UNUSED_VARIABLE(argv);
+
+    VerifyOrExit(argc == 0, error = OT_ERROR_INVALID_ARGS);
+    VerifyOrExit(mState != kStateIdle, error = OT_ERROR_INVALID_STATE);
+
+    Stop();
+
+exit:
+    return error;
+}
+
+otError Perf::ProcessResult(int argc, char *argv[])
+{
+    otError error = OT_ERROR_NONE;
+
+    OT_UNUSED_VARIABLE(argv);
+
+    VerifyOrExit(argc == 0, error = OT_ERROR_INVALID_ARGS);
+
+    OutputReport("result", mLastReport);
+    OutputRtt();
+
+exit:
+    return error;
+}
+
+otError Perf::Open(uint16_t aPort)
+{
+    otError    error;
+    otSockAddr sockaddr;
+
+    memset(&sockaddr, 0, sizeof(sockaddr));
+    sockaddr.mPort    = aPort;
+    sockaddr.mScopeId = OT_NETIF_INTERFACE_ID_THREAD;
+
+    SuccessOrExit(error = otUdpOpen(mInterpreter.mInstance, &mSocket, &Perf::HandleUdpReceive, this));
+
+    if ((error = otUdpBind(&mSocket, &sockaddr)) != OT_ERROR_NONE)
+    {
+        otUdpClose(&mSocket);
+    }
+
+exit:
+    return error;
+}
+
+void Perf::Stop(void)
+{
+    mTimer.Stop();
+    otUdpClose(&mSocket);
+    mState = kStateIdle;
+}
+
+otError Perf::SendMessage(Type aType, uint32_t aSequence, uint32_t aTimestamp, const void *aPayload, uint16_t aLength)
+{
+    otError    error   = OT_ERROR_NONE;
+    otMessage *message = NULL;
+    Header     header;
+
+    header.mType      = static_cast<uint8_t>(aType);
+    header.mReserved  = 0;
+    header.mSequence  = HostSwap32(aSequence);
+    header.mTimestamp = HostSwap32(aTimestamp);
+
+    VerifyOrExit((message = otUdpNewMessage(mInterpreter.mInstance, NULL)) != NULL, error = OT_ERROR_NO_BUFS);
+    SuccessOrExit(error = otMessageAppend(message, &header, sizeof(header)));
+
+    if (aPayload != NULL)
+    {
+        SuccessOrExit(error = otMessageAppend(message, aPayload, aLength));
+    }
+    else if (aLength > sizeof(header))
+    {
+        // the data payload content is irrelevant, only its length matters
+        SuccessOrExit(error = otMessageSetLength(message, aLength));
+    }
+
+    SuccessOrExit(error = otUdpSend(&mSocket, message, &mPeerInfo));
+
+exit:
+
+    if (error != OT_ERROR_NONE && message != NULL)
+    {
+        otMessageFree(message);
+    }
+
+    return error;
+}
+
+void Perf::HandleTimer(Timer &aTimer)
+{
+    Interpreter::GetOwner(aTimer).mPerf.HandleTimer();
+}
+
+void Perf::HandleTimer(void)
+{
+    uint32_t now = TimerMilli::GetNow();
+
+    if (mState == kStateClientSending && static_cast<int32_t>(now - mEndTime) < 0)
+    {
+        // send as many datagrams as the rate allows since the start, so timer latency does not lower the rate
+        uint32_t target = static_cast<uint32_t>((static_cast<uint64_t>(now - mStartTime) * mRate) / 1000) + 1;
+
+        for (uint8_t burst = 0; mSent < target && burst < kMaxBurst; burst++)
+        {
+            SuccessOrExit(SendMessage(kTypeData, mSent, now, NULL, mLength));
+            mSent++;
+        }
+
+        if (static_cast<int32_t>(now - mNextProbeTime) >= 0)
+        {
+            SendMessage(kTypeProbe, 0, now, NULL, sizeof(Header));
+            mNextProbeTime = now + kProbeInterval;
+        }
+
+        mTimer.Start((mRate >= 1000) ? 1 : (1000 / mRate));
+        ExitNow();
+    }
+
+    if (mState == kStateClientSending)
+    {
+        mState = kStateClientWaitReport;
+    }
+
+    VerifyOrExit(mState == kStateClientWaitReport);
+
+    if (mReportRequests < kMaxReportRequests)
+    {
+        SendMessage(kTypeEnd, mSent, now, NULL, sizeof(Header));
+        mReportRequests++;
+        mTimer.Start(kReportTimeout);
+    }
+    else
+    {
+        memset(&mLastReport, 0, sizeof(mLastReport));
+        mLastReport.mSent = mSent;
+        mInterpreter.mServer->OutputFormat("perf client: no report from server\r\n");
+        OutputRtt();
+        Stop();
+    }
+
+exit:
+
+    if (mState == kStateClientSending && !mTimer.IsRunning())
+    {
+        // a send failed (most likely out of buffers), retry on the next tick
+        mTimer.Start(1);
+    }
+}
+
+void Perf::HandleUdpReceive(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo)
+{
+    static_cast<Perf *>(aContext)->HandleUdpReceive(aMessage, aMessageInfo);
+}
+
+void Perf::HandleUdpReceive(otMessage *aMessage, const otMessageInfo *aMessageInfo)
+{
+    uint16_t length = otMessageGetLength(aMessage) - otMessageGetOffset(aMessage);
+    Header   header;
+
+    VerifyOrExit(otMessageRead(aMessage, otMessageGetOffset(aMessage), &header, sizeof(header)) == sizeof(header));
+
+    header.mSequence  = HostSwap32(header.mSequence);
+    header.mTimestamp = HostSwap32(header.mTimestamp);
+
+    if (mState == kStateServer)
+    {
+        HandleServerReceive(header, length, *aMessageInfo);
+    }
+    else
+    {
+        otMessageSetOffset(aMessage, otMessageGetOffset(aMessage) + sizeof(header));
+        HandleClientReceive(header, *aMessage);
+    }
+
+exit:
+    return;
+}
+
+void Perf::HandleServerReceive(const Header &aHeader, uint16_t aLength, const otMessageInfo &aMessageInfo)
+{
+    uint32_t now = TimerMilli::GetNow();
+
+    memset(&mPeerInfo, 0, sizeof(mPeerInfo));
+    mPeerInfo.mPeerAddr    = aMessageInfo.mPeerAddr;
+    mPeerInfo.mPeerPort    = aMessageInfo.mPeerPort;
+    mPeerInfo.mInterfaceId = aMessageInfo.mInterfaceId;
+
+    switch (aHeader.mType)
+    {
+    case kTypeData:
+    {
+        // the sender and receiver clocks are not synchronized, but only the change in transit time is used
+        int32_t transit = static_cast<int32_t>(now - aHeader.mTimestamp);
+
+        if (mStats.mReceived == 0)
+        {
+            mFirstTime = now;
+        }
+        else
+        {
+            int32_t delta = transit - mLastTransit;
+
+            if (delta < 0)
+            {
+                delta = -delta;
+            }
+
+            // J += (|D| - J) / 16, kept in 1/16 ms to avoid losing precision
+            mStats.mJitter += static_cast<uint32_t>(delta) - ((mStats.mJitter + 8) >> 4);
+        }
+
+        mLastTransit = transit;
+        mLastTime    = now;
+        mStats.mReceived++;
+        mStats.mBytes += aLength;
+        break;
+    }
+
+    case kTypeProbe:
+        SendMessage(kTypeProbeReply, aHeader.mSequence, aHeader.mTimestamp, NULL, sizeof(Header));
+        break;
+
+    case kTypeEnd:
+    {
+        Report report;
+
+        // the client asks again if the report is lost, so answer repeats with the last report
+        if (mStats.mReceived > 0)
+        {
+            mStats.mSent     = aHeader.mSequence;
+            mStats.mDuration = mLastTime - mFirstTime;
+            mLastReport      = mStats;
+            ResetServerStats();
+            OutputReport("server", mLastReport);
+        }
+
+        report.mSent     = HostSwap32(mLastReport.mSent);
+        report.mReceived = HostSwap32(mLastReport.mReceived);
+        report.mBytes    = HostSwap32(mLastReport.mBytes);
+        report.mDuration = HostSwap32(mLastReport.mDuration);
+        report.mJitter   = HostSwap32(mLastReport.mJitter);
+
+        SendMessage(kTypeReport, aHeader.mSequence, aHeader.mTimestamp, &report, sizeof(report));
+        break;
+    }
+
+    default:
+        break;
+    }
+}
+
+void Perf::HandleClientReceive(const Header &aHeader, otMessage &aMessage)
+{
+    uint32_t now = TimerMilli::GetNow();
+    Report   report;
+
+    switch (aHeader.mType)
+    {
+    case kTypeProbeReply:
+    {
+        uint32_t rtt = now - aHeader.mTimestamp;
+
+        mRttSamples[mRttCount % kMaxRttSamples] = static_cast<uint16_t>((rtt > 0xffff) ? 0xffff : rtt);
+
+        if (mRttCount < 0xffff)
+        {
+            mRttCount++;
+        }
+
+        break;
+    }
+
+    case kTypeReport:
+        VerifyOrExit(mState == kStateClientWaitReport);
+        VerifyOrExit(otMessageRead(&aMessage, otMessageGetOffset(&aMessage), &report, sizeof(report)) ==
+                     sizeof(report));
+
+        mLastReport.mSent     = HostSwap32(report.mSent);
+        mLastReport.mReceived = HostSwap32(report.mReceived);
+        mLastReport.mBytes    = HostSwap32(report.mBytes);
+        mLastReport.mDuration = HostSwap32(report.mDuration);
+        mLastReport.mJitter   = HostSwap32(report.mJitter);
+
+        OutputReport("client", mLastReport);
+        OutputRtt();
+        Stop();
+        break;
+
+    default:
+        break;
+    }
+
+exit:
+    return;
+}
+
+void Perf::ResetServerStats(void)
+{
+    memset(&mStats, 0, sizeof(mStats));
+    mFirstTime   = 0;
+    mLastTime    = 0;
+    mLastTransit = 0;
+}
+
+void Perf::OutputReport(const char *aRole, const Report &aReport)
+{
+    uint32_t lost     = (aReport.mSent > aReport.mReceived) ? (aReport.mSent - aReport.mReceived) : 0;
+    uint32_t loss     = 0; // in 1/100 %
+    uint32_t duration = (aReport.mDuration > 0) ? aReport.mDuration : 1;
+    uint32_t goodput  = static_cast<uint32_t>((static_cast<uint64_t>(aReport.mBytes) * 8 * 1000) / duration);
+    uint32_t jitter   = (aReport.mJitter * 100) >> 4;
+
+    if (aReport.mSent > 0)
+    {
+        loss = static_cast<uint32_t>((static_cast<uint64_t>(lost) * 10000) / aReport.mSent);
+    }
+
+    mInterpreter.mServer->OutputFormat(
+        "perf %s: sent=%lu received=%lu lost=%lu loss=%lu.%02lu%% goodput=%lubps jitter=%lu.%02lums\r\n", aRole,
+        static_cast<unsigned long>(aReport.mSent), static_cast<unsigned long>(aReport.mReceived),
+        static_cast<unsigned long>(lost), static_cast<unsigned long>(loss / 100),
+        static_cast<unsigned long>(loss % 100), static_cast<unsigned long>(goodput),
+        static_cast<unsigned long>(jitter / 100), static_cast<unsigned long>(jitter % 100));
+}
+
+void Perf::OutputRtt(void)
+{
+    static const uint8_t kPercentiles[] = {50, 90, 99};
+
+    uint16_t samples[kMaxRttSamples];
+    uint16_t count = (mRttCount < kMaxRttSamples) ? mRttCount : static_cast<uint16_t>(kMaxRttSamples);
+
+    VerifyOrExit(count > 0);
+
+    memcpy(samples, mRttSamples, count * sizeof(samples[0]));
+
+    // insertion sort, the sample set is small
+    for (uint16_t i = 1; i < count; i++)
+    {
+        uint16_t value = samples[i];
+        uint16_t j     = i;
+
+        for (; j > 0 && samples[j - 1] > value; j--)
+        {
+            samples[j] = samples[j - 1];
+        }
+
+        samples[j] = value;
+    }
+
+    mInterpreter.mServer->OutputFormat("perf rtt: probes=%u min=%u", mRttCount, samples[0]);
+
+    for (uint8_t i = 0; i < OT_ARRAY_LENGTH(kPercentiles); i++)
+    {
+        uint16_t index = static_cast<uint16_t>((count * kPercentiles[i] + 99) / 100) - 1;
+
+        mInterpreter.mServer->OutputFormat(" p%u=%u", kPercentiles[i], samples[index]);
+    }
+
+    mInterpreter.mServer->OutputFormat(" max=%ums\r\n", samples[count - 1]);
+
+exit:
+    return;
+}
+
+} // namespace Cli
+} // namespace ot
+
+#endif // OPENTHREAD_CONFIG_CLI_PERF
@@ -0,0 +1,190 @@
+/*
+ *  Copyright (c) 2018, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file contains definitions for the CLI UDP throughput and latency generator.
+ */
+
+#ifndef CLI_PERF_HPP_
+#define CLI_PERF_HPP_
+
+#include "openthread-core-config.h"
+
+#include <stdint.h>
+
+#include <openthread/error.h>
+#include <openthread/udp.h>
+
+#include "common/timer.hpp"
+
+#if OPENTHREAD_CONFIG_CLI_PERF
+
+namespace ot {
+namespace Cli {
+
+class Interpreter;
+
+/**
+ * This class implements the CLI `perf` command.
+ *
+ * A client sends fixed-size UDP datagrams to a server at a given rate for a given duration, interleaved with RTT
+ * probes that the server echoes back. At the end the client asks the server for its receive statistics and prints
+ * goodput, loss, jitter and RTT percentiles.
+ *
+ */
+class Perf
+{
+public:
+    /**
+     * Constructor
+     *
+     * @param[in]  aInterpreter  The CLI interpreter.
+     *
+     */
+    explicit Perf(Interpreter &aInterpreter);
+
+    /**
+     * This method interprets a list of CLI arguments.
+     *
+     * @param[in]  argc  The number of elements in argv.
+     * @param[in]  argv  A pointer to an array of command line arguments.
+     *
+     */
+    otError Process(int argc, char *argv[]);
+
+private:
+    enum
+    {
+        kDefaultPort       = 5001,
+        kDefaultLength     = 64,
+        kDefaultRate       = 10,   ///< Datagrams per second.
+        kDefaultDuration   = 10,   ///< Seconds.
+        kProbeInterval     = 100,  ///< Milliseconds between RTT probes.
+        kReportTimeout     = 1000, ///< Milliseconds to wait for the server report before asking again.
+        kMaxReportRequests = 3,
+        kMaxBurst          = 8, ///< Maximum datagrams sent per timer tick when catching up.
+        kMaxRttSamples     = 64,
+    };
+
+    enum Type
+    {
+        kTypeData       = 0,
+        kTypeProbe      = 1,
+        kTypeProbeReply = 2,
+        kTypeEnd        = 3,
+        kTypeReport     = 4,
+    };
+
+    enum State
+    {
+        kStateIdle,
+        kStateServer,
+        kStateClientSending,
+        kStateClientWaitReport,
+    };
+
+    OT_TOOL_PACKED_BEGIN
+    struct Header
+    {
+        uint8_t  mType;
+        uint8_t  mReserved;
+        uint32_t mSequence;  ///< Data sequence number, or the total number of datagrams sent in `kTypeEnd`.
+        uint32_t mTimestamp; ///< Sender time in milliseconds, echoed back in `kTypeProbeReply`.
+    } OT_TOOL_PACKED_END;
+
+    OT_TOOL_PACKED_BEGIN
+    struct Report
+    {
+        uint32_t mSent;
+        uint32_t mReceived;
+        uint32_t mBytes;
+        uint32_t mDuration; ///< Milliseconds between the first and last datagram received.
+        uint32_t mJitter;   ///< Interarrival jitter (RFC 3550) in 1/16 ms.
+    } OT_TOOL_PACKED_END;
+
+    otError ProcessHelp(int argc, char *argv[]);
+    otError ProcessServer(int argc, char *argv[]);
+    otError ProcessClient(int argc, char *argv[]);
+    otError ProcessStop(int argc, char *argv[]);
+    otError ProcessResult(int argc, char *argv[]);
+
+    otError Open(uint16_t aPort);
+    void    Stop(void);
+    otError SendMessage(Type aType, uint32_t aSequence, uint32_t aTimestamp, const void *aPayload, uint16_t aLength);
+    void    ResetServerStats(void);
+    void    OutputReport(const char *aRole, const Report &aReport);
+    void    OutputRtt(void);
+
+    static void HandleTimer(Timer &aTimer);
+    void        HandleTimer(void);
+
+    static void HandleUdpReceive(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo);
+    void        HandleUdpReceive(otMessage *aMessage, const otMessageInfo *aMessageInfo);
+    void        HandleServerReceive(const Header &aHeader, uint16_t aLength, const otMessageInfo &aMessageInfo);
+    void        HandleClientReceive(const Header &aHeader, otMessage &aMessage);
+
+    struct Command
+    {
+        const char *mName;
+        otError (Perf::*mCommand)(int argc, char *argv[]);
+    };
+
+    static const Command sCommands[];
+    Interpreter &        mInterpreter;
+
+    otUdpSocket   mSocket;
+    otMessageInfo mPeerInfo;
+    TimerMilli    mTimer;
+    State         mState;
+
+    // Client
+    uint16_t mLength;
+    uint32_t mRate;
+    uint32_t mStartTime;
+    uint32_t mEndTime;
+    uint32_t mNextProbeTime;
+    uint32_t mSent;
+    uint8_t  mReportRequests;
+    uint16_t mRttCount;
+    uint16_t mRttSamples[kMaxRttSamples];
+
+    // Server
+    Report   mStats;
+    Report   mLastReport;
+    uint32_t mFirstTime;
+    uint32_t mLastTime;
+    int32_t  mLastTransit;
+};
+
+} // namespace Cli
+} // namespace ot
+
+#endif // OPENTHREAD_CONFIG_CLI_PERF
+
+#endif // CLI_PERF_HPP_
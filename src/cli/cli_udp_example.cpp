@@ -137,8 +137,7 @@ otError UdpExample::ProcessSend(int argc, char *argv[])
 {
     otError       error;
     otMessageInfo messageInfo;
-    otMessage *   message = NULL;
-    int           curArg  = 0;
+    int           curArg = 0;
 
     memset(&messageInfo, 0, sizeof(messageInfo));
 
@@ -158,21 +157,9 @@ otError UdpExample::ProcessSend(int argc, char *argv[])
         messageInfo.mInterfaceId = OT_NETIF_INTERFACE_ID_THREAD;
     }
 
-    message = otUdpNewMessage(mInterpreter.mInstance, NULL);
-    VerifyOrExit(message != NULL, error = OT_ERROR_NO_BUFS);
-
-    error = otMessageAppend(message, argv[curArg], static_cast<uint16_t>(strlen(argv[curArg])));
-    SuccessOrExit(error);
-
-    error = otUdpSend(&mSocket, message, &messageInfo);
+    error = otUdpSendBuffer(&mSocket, argv[curArg], static_cast<uint16_t>(strlen(argv[curArg])), &messageInfo);
 
 exit:
-
-    if (error != OT_ERROR_NONE && message != NULL)
-    {
-        otMessageFree(message);
-    }
-
     return error;
 }
 
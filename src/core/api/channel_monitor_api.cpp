@@ -42,7 +42,7 @@ using namespace ot;
 
 otError otChannelMonitorSetEnabled(otInstance *aInstance, bool aEnabled)
 {
-    Utils::ChannelMonitor monitor = static_cast<Instance *>(aInstance)->GetChannelMonitor();
+    Utils::ChannelMonitor &monitor = static_cast<Instance *>(aInstance)->GetChannelMonitor();
 
     return aEnabled ? monitor.Start() : monitor.Stop();
 }
@@ -89,4 +89,20 @@ uint16_t otChannelMonitorGetChannelOccupancy(otInstance *aInstance, uint8_t aCha
     return instance.GetChannelMonitor().GetChannelOccupancy(aChannel);
 }
 
+uint16_t otChannelMonitorGetShortTermChannelOccupancy(otInstance *aInstance, uint8_t aChannel)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return instance.GetChannelMonitor().GetShortTermChannelOccupancy(aChannel);
+}
+
+otError otChannelMonitorGetChannelRssiSummary(otInstance *                 aInstance,
+                                              uint8_t                      aChannel,
+                                              otChannelMonitorRssiSummary *aSummary)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return instance.GetChannelMonitor().GetChannelRssiSummary(aChannel, *aSummary);
+}
+
 #endif // OPENTHREAD_ENABLE_CHANNEL_MONITOR
@@ -98,6 +98,21 @@ otError otCoapHeaderAppendUriQueryOption(otCoapHeader *aHeader, const char *aUri
     return static_cast<Coap::Header *>(aHeader)->AppendUriQueryOption(aUriQuery);
 }
 
+otError otCoapHeaderAppendBlock1Option(otCoapHeader *aHeader, uint32_t aNum, bool aMore, otCoapBlockSize aSize)
+{
+    return static_cast<Coap::Header *>(aHeader)->AppendBlockOption(OT_COAP_OPTION_BLOCK1, aNum, aMore, aSize);
+}
+
+otError otCoapHeaderAppendBlock2Option(otCoapHeader *aHeader, uint32_t aNum, bool aMore, otCoapBlockSize aSize)
+{
+    return static_cast<Coap::Header *>(aHeader)->AppendBlockOption(OT_COAP_OPTION_BLOCK2, aNum, aMore, aSize);
+}
+
+uint16_t otCoapBlockSizeFromExponent(otCoapBlockSize aSize)
+{
+    return Coap::Header::GetBlockSize(aSize);
+}
+
 otError otCoapHeaderSetPayloadMarker(otCoapHeader *aHeader)
 {
     return static_cast<Coap::Header *>(aHeader)->SetPayloadMarker();
@@ -178,6 +193,48 @@ otError otCoapSendRequest(otInstance *          aInstance,
         *static_cast<Message *>(aMessage), *static_cast<const Ip6::MessageInfo *>(aMessageInfo), aHandler, aContext);
 }
 
+#if OPENTHREAD_CONFIG_ENABLE_COAP_BLOCKWISE_TRANSFER
+otError otCoapSendRequestBlockWise(otInstance *                aInstance,
+                                   otMessage *                 aMessage,
+                                   const otMessageInfo *       aMessageInfo,
+                                   otCoapResponseHandler       aHandler,
+                                   void *                      aContext,
+                                   otCoapBlockwiseTransmitHook aTransmitHook,
+                                   otCoapBlockwiseReceiveHook  aReceiveHook)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return instance.GetApplicationCoap().SendMessage(*static_cast<Message *>(aMessage),
+                                                     *static_cast<const Ip6::MessageInfo *>(aMessageInfo), aHandler,
+                                                     aContext, aTransmitHook, aReceiveHook);
+}
+#endif
+
+#if OPENTHREAD_CONFIG_ENABLE_COAP_OBSERVE
+otError otCoapCancelObserve(otInstance *aInstance, otCoapResponseHandler aHandler, void *aContext)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return instance.GetApplicationCoap().CancelObserve(aHandler, aContext);
+}
+#endif
+
+#if OPENTHREAD_CONFIG_ENABLE_COAP_REQUEST_WINDOW
+otError otCoapSetNstart(otInstance *aInstance, uint8_t aNstart)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return instance.GetApplicationCoap().SetNstart(aNstart);
+}
+
+uint8_t otCoapGetNstart(otInstance *aInstance)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return instance.GetApplicationCoap().GetNstart();
+}
+#endif
+
 otError otCoapStart(otInstance *aInstance, uint16_t aPort)
 {
     Instance &instance = *static_cast<Instance *>(aInstance);
@@ -206,6 +263,22 @@ void otCoapRemoveResource(otInstance *aInstance, otCoapResource *aResource)
     instance.GetApplicationCoap().RemoveResource(*static_cast<Coap::Resource *>(aResource));
 }
 
+#if OPENTHREAD_CONFIG_ENABLE_COAP_BLOCKWISE_TRANSFER
+otError otCoapAddBlockWiseResource(otInstance *aInstance, otCoapBlockwiseResource *aResource)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return instance.GetApplicationCoap().AddBlockWiseResource(*static_cast<Coap::ResourceBlockWise *>(aResource));
+}
+
+void otCoapRemoveBlockWiseResource(otInstance *aInstance, otCoapBlockwiseResource *aResource)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    instance.GetApplicationCoap().RemoveBlockWiseResource(*static_cast<Coap::ResourceBlockWise *>(aResource));
+}
+#endif
+
 void otCoapSetDefaultHandler(otInstance *aInstance, otCoapRequestHandler aHandler, void *aContext)
 {
     Instance &instance = *static_cast<Instance *>(aInstance);
@@ -213,6 +286,13 @@ void otCoapSetDefaultHandler(otInstance *aInstance, otCoapRequestHandler aHandle
     instance.GetApplicationCoap().SetDefaultHandler(aHandler, aContext);
 }
 
+const otCoapResponseCacheCounters *otCoapGetResponseCacheCounters(otInstance *aInstance)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return &instance.GetApplicationCoap().GetResponseCacheCounters();
+}
+
 otError otCoapSendResponse(otInstance *aInstance, otMessage *aMessage, const otMessageInfo *aMessageInfo)
 {
     Instance &instance = *static_cast<Instance *>(aInstance);
@@ -221,4 +301,29 @@ otError otCoapSendResponse(otInstance *aInstance, otMessage *aMessage, const otM
                                                      *static_cast<const Ip6::MessageInfo *>(aMessageInfo));
 }
 
+#if OPENTHREAD_CONFIG_ENABLE_COAP_BLOCKWISE_TRANSFER
+otError otCoapSendResponseBlockWise(otInstance *                aInstance,
+                                    otMessage *                 aMessage,
+                                    const otMessageInfo *       aMessageInfo,
+                                    void *                      aContext,
+                                    otCoapBlockwiseTransmitHook aTransmitHook)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return instance.GetApplicationCoap().SendResponseBlockWise(
+        *static_cast<Message *>(aMessage), *static_cast<const Ip6::MessageInfo *>(aMessageInfo), aContext,
+        aTransmitHook);
+}
+#endif
+
+#if OPENTHREAD_CONFIG_ENABLE_COAP_OBSERVE
+otError otCoapNotifyObservers(otInstance *aInstance, otCoapResource *aResource, otMessage *aMessage)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return instance.GetApplicationCoap().NotifyObservers(*static_cast<Coap::Resource *>(aResource),
+                                                         *static_cast<Message *>(aMessage));
+}
+#endif
+
 #endif // OPENTHREAD_ENABLE_APPLICATION_COAP
@@ -198,6 +198,25 @@ otError otCommissionerEnergyScan(otInstance *                       aInstance,
     return error;
 }
 
+otError otCommissionerGetEnergyScanSummary(otInstance *                aInstance,
+                                           uint8_t                     aChannel,
+                                           otEnergyScanChannelSummary *aSummary)
+{
+    otError error = OT_ERROR_DISABLED_FEATURE;
+
+#if OPENTHREAD_FTD && OPENTHREAD_ENABLE_COMMISSIONER
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    error = instance.GetThreadNetif().GetCommissioner().GetEnergyScanClient().GetSummary(aChannel, *aSummary);
+#else
+    OT_UNUSED_VARIABLE(aInstance);
+    OT_UNUSED_VARIABLE(aChannel);
+    OT_UNUSED_VARIABLE(aSummary);
+#endif
+
+    return error;
+}
+
 otError otCommissionerPanIdQuery(otInstance *                        aInstance,
                                  uint16_t                            aPanId,
                                  uint32_t                            aChannelMask,
@@ -303,7 +322,30 @@ otError otCommissionerGeneratePSKc(otInstance *           aInstance,
 #if OPENTHREAD_FTD && OPENTHREAD_ENABLE_COMMISSIONER
     Instance &instance = *static_cast<Instance *>(aInstance);
 
-    error = instance.GetThreadNetif().GetCommissioner().GeneratePSKc(aPassPhrase, aNetworkName, *aExtPanId, aPSKc);
+    error = instance.GetThreadNetif().GetCommissioner().GetPSKc(aPassPhrase, aNetworkName, *aExtPanId, aPSKc);
+#else
+    OT_UNUSED_VARIABLE(aInstance);
+    OT_UNUSED_VARIABLE(aPassPhrase);
+    OT_UNUSED_VARIABLE(aNetworkName);
+    OT_UNUSED_VARIABLE(aExtPanId);
+    OT_UNUSED_VARIABLE(aPSKc);
+#endif
+
+    return error;
+}
+
+otError otCommissionerSetPSKc(otInstance *           aInstance,
+                              const char *           aPassPhrase,
+                              const char *           aNetworkName,
+                              const otExtendedPanId *aExtPanId,
+                              const uint8_t *        aPSKc)
+{
+    otError error = OT_ERROR_DISABLED_FEATURE;
+
+#if OPENTHREAD_FTD && OPENTHREAD_ENABLE_COMMISSIONER && OPENTHREAD_CONFIG_COMMISSIONER_PSKC_CACHE_SIZE
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    error = instance.GetThreadNetif().GetCommissioner().SetPSKc(aPassPhrase, aNetworkName, *aExtPanId, aPSKc);
 #else
     OT_UNUSED_VARIABLE(aInstance);
     OT_UNUSED_VARIABLE(aPassPhrase);
@@ -56,4 +56,18 @@ void otDhcp6ServerUpdate(otInstance *aInstance)
 
     instance.GetThreadNetif().GetDhcp6Server().UpdateService();
 }
+
+const otDhcp6ServerCounters *otDhcp6ServerGetCounters(otInstance *aInstance)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return &instance.GetThreadNetif().GetDhcp6Server().GetCounters();
+}
+
+void otDhcp6ServerResetCounters(otInstance *aInstance)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    instance.GetThreadNetif().GetDhcp6Server().ResetCounters();
+}
 #endif
@@ -115,6 +115,15 @@ otError otInstanceErasePersistentInfo(otInstance *aInstance)
 
     return instance.ErasePersistentInfo();
 }
+
+#if OPENTHREAD_CONFIG_ENABLE_BOOT_TIMESTAMPS
+const otBootTimestamps *otInstanceGetBootTimestamps(otInstance *aInstance)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return &instance.GetBootTimestamps();
+}
+#endif
 #endif // OPENTHREAD_MTD || OPENTHREAD_FTD
 
 const char *otGetVersionString(void)
@@ -285,3 +285,26 @@ otError otIp6SelectSourceAddress(otInstance *aInstance, otMessageInfo *aMessageI
 exit:
     return error;
 }
+
+#if OPENTHREAD_CONFIG_IP6_REASSEMBLY_MAX_DATAGRAMS
+const otIp6ReassemblyCounters *otIp6GetReassemblyCounters(otInstance *aInstance)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return &instance.GetIp6().GetReassemblyCounters();
+}
+#endif
+
+const otIp6DropCounters *otIp6GetDropCounters(otInstance *aInstance)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return &instance.GetIp6().GetDropCounters();
+}
+
+void otIp6ResetDropCounters(otInstance *aInstance)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    instance.GetIp6().ResetDropCounters();
+}
@@ -118,4 +118,11 @@ uint64_t otJamDetectionGetHistoryBitmap(otInstance *aInstance)
     return instance.GetThreadNetif().GetJamDetector().GetHistoryBitmap();
 }
 
+uint32_t otJamDetectionGetJammedChannels(otInstance *aInstance)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return instance.GetThreadNetif().GetJamDetector().GetJammedChannelMask();
+}
+
 #endif // OPENTHREAD_ENABLE_JAM_DETECTION
@@ -152,6 +152,65 @@ void otLinkSetPollPeriod(otInstance *aInstance, uint32_t aPollPeriod)
     instance.GetThreadNetif().GetMeshForwarder().GetDataPollManager().SetExternalPollPeriod(aPollPeriod);
 }
 
+#if OPENTHREAD_CONFIG_ENABLE_CSL
+uint16_t otLinkGetCslPeriod(otInstance *aInstance)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return instance.GetThreadNetif().GetMle().GetCslPeriod();
+}
+
+otError otLinkSetCslPeriod(otInstance *aInstance, uint16_t aCslPeriod)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return instance.GetThreadNetif().GetMle().SetCslPeriod(aCslPeriod);
+}
+#endif // OPENTHREAD_CONFIG_ENABLE_CSL
+
+#if OPENTHREAD_CONFIG_MAC_TSCH
+uint16_t otLinkTschGetSlotframeLength(otInstance *aInstance)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return instance.GetThreadNetif().GetMac().GetTschSchedule().GetSlotframeLength();
+}
+
+void otLinkTschSetSlotframeLength(otInstance *aInstance, uint16_t aLength)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    instance.GetThreadNetif().GetMac().SetTschSlotframeLength(aLength);
+}
+
+otError otLinkTschAddCell(otInstance *aInstance, const otLinkTschCell *aCell)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return instance.GetThreadNetif().GetMac().AddTschCell(*aCell);
+}
+
+otError otLinkTschRemoveCell(otInstance *aInstance, uint16_t aSlotOffset)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return instance.GetThreadNetif().GetMac().RemoveTschCell(aSlotOffset);
+}
+
+otError otLinkTschGetCell(otInstance *aInstance, uint8_t aIndex, otLinkTschCell *aCell)
+{
+    otError                        error    = OT_ERROR_NONE;
+    Instance &                     instance = *static_cast<Instance *>(aInstance);
+    const Mac::TschSchedule::Cell *cell     = instance.GetThreadNetif().GetMac().GetTschSchedule().GetCell(aIndex);
+
+    VerifyOrExit(cell != NULL, error = OT_ERROR_NOT_FOUND);
+    *aCell = *cell;
+
+exit:
+    return error;
+}
+#endif // OPENTHREAD_CONFIG_MAC_TSCH
+
 otError otLinkSendDataRequest(otInstance *aInstance)
 {
     Instance &instance = *static_cast<Instance *>(aInstance);
@@ -338,6 +397,24 @@ const otMacCounters *otLinkGetCounters(otInstance *aInstance)
     return &instance.GetThreadNetif().GetMac().GetCounters();
 }
 
+#if OPENTHREAD_CONFIG_ENABLE_MAC_OPERATION_STATS
+const otMacOperationStats *otLinkGetOperationStats(otInstance *aInstance, otMacOperation aOperation)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return instance.GetThreadNetif().GetMac().GetOperationStats(aOperation);
+}
+#endif
+
+#if OPENTHREAD_CONFIG_ENABLE_RADIO_TIME_STATS
+const otRadioTimeStats *otLinkGetRadioTimeStats(otInstance *aInstance)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return &instance.GetThreadNetif().GetMac().GetRadioTimeStats();
+}
+#endif
+
 otError otLinkActiveScan(otInstance *             aInstance,
                          uint32_t                 aScanChannels,
                          uint16_t                 aScanDuration,
@@ -114,6 +114,17 @@ otError otLinkRawTransmit(otInstance *aInstance, otLinkRawTransmitDone aCallback
     return static_cast<Instance *>(aInstance)->GetLinkRaw().Transmit(aCallback);
 }
 
+#if OPENTHREAD_CONFIG_LINK_RAW_TRANSMIT_BATCH_SIZE
+otError otLinkRawTransmitBatch(otInstance *               aInstance,
+                               const otLinkRawBatchFrame *aFrames,
+                               uint8_t                    aCount,
+                               otLinkRawTransmitBatchDone aCallback)
+{
+    otLogInfoPlat("LinkRaw Transmit Batch (%d frames)", aCount);
+    return static_cast<Instance *>(aInstance)->GetLinkRaw().TransmitBatch(aFrames, aCount, aCallback);
+}
+#endif
+
 int8_t otLinkRawGetRssi(otInstance *aInstance)
 {
     return otPlatRadioGetRssi(aInstance);
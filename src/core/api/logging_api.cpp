@@ -37,6 +37,7 @@
 
 #include <openthread/logging.h>
 #include "common/instance.hpp"
+#include "common/logging.hpp"
 
 using namespace ot;
 
@@ -67,3 +68,47 @@ otError otLoggingSetLevel(otLogLevel aLogLevel)
     OT_UNUSED_VARIABLE(aLogLevel);
     return error;
 }
+
+otLogLevel otLoggingGetRegionLevel(otLogRegion aLogRegion)
+#if OPENTHREAD_CONFIG_ENABLE_DYNAMIC_LOG_LEVEL && !OPENTHREAD_ENABLE_MULTIPLE_INSTANCES
+{
+    return (aLogRegion < _OT_LOG_NUM_REGIONS) ? _otLogRegionLevels[aLogRegion] : otLoggingGetLevel();
+}
+#else
+{
+    OT_UNUSED_VARIABLE(aLogRegion);
+    return static_cast<otLogLevel>(OPENTHREAD_CONFIG_LOG_LEVEL);
+}
+#endif
+
+otError otLoggingSetRegionLevel(otLogRegion aLogRegion, otLogLevel aLogLevel)
+{
+    otError error = OT_ERROR_DISABLED_FEATURE;
+
+#if OPENTHREAD_CONFIG_ENABLE_DYNAMIC_LOG_LEVEL && !OPENTHREAD_ENABLE_MULTIPLE_INSTANCES
+    if (aLogRegion < _OT_LOG_NUM_REGIONS)
+    {
+        _otLogRegionLevels[aLogRegion] = aLogLevel;
+        error                          = OT_ERROR_NONE;
+    }
+    else
+    {
+        error = OT_ERROR_INVALID_ARGS;
+    }
+#endif
+
+    OT_UNUSED_VARIABLE(aLogRegion);
+    OT_UNUSED_VARIABLE(aLogLevel);
+    return error;
+}
+
+uint32_t otLoggingGetDeferredDropCount(void)
+#if OPENTHREAD_CONFIG_LOG_DEFERRED
+{
+    return Instance::Get().GetLogBuffer().GetDroppedCount();
+}
+#else
+{
+    return 0;
+}
+#endif
@@ -88,6 +88,12 @@ void otMessageSetDirectTransmission(otMessage *aMessage, bool aEnabled)
     }
 }
 
+void otMessageSetLifetime(otMessage *aMessage, uint32_t aLifetime)
+{
+    Message &message = *static_cast<Message *>(aMessage);
+    message.SetLifetime(aLifetime);
+}
+
 int8_t otMessageGetRss(otMessage *aMessage)
 {
     Message &message = *static_cast<Message *>(aMessage);
@@ -114,7 +120,8 @@ int otMessageWrite(otMessage *aMessage, uint16_t aOffset, const void *aBuf, uint
 
 void otMessageQueueInit(otMessageQueue *aQueue)
 {
-    aQueue->mData = NULL;
+    aQueue->mData       = NULL;
+    aQueue->mMaxBuffers = 0;
 }
 
 otError otMessageQueueEnqueue(otMessageQueue *aQueue, otMessage *aMessage)
@@ -220,5 +227,61 @@ void otMessageGetBufferInfo(otInstance *aInstance, otBufferInfo *aBufferInfo)
     aBufferInfo->mApplicationCoapMessages = 0;
     aBufferInfo->mApplicationCoapBuffers  = 0;
 #endif
+
+    aBufferInfo->mReservedBuffers  = MessagePool::GetReservedBufferCount();
+    aBufferInfo->mIndirectBuffers  = instance.GetMessagePool().GetBufferClassCount(Message::kBufferClassIndirect);
+    aBufferInfo->mCoapCacheBuffers = instance.GetMessagePool().GetBufferClassCount(Message::kBufferClassCoapCache);
+
+    aBufferInfo->mMaxUsedBuffers = instance.GetMessagePool().GetMaxUsedBufferCount();
+
+    aBufferInfo->m6loSendMaxBuffers = instance.GetThreadNetif().GetMeshForwarder().GetSendQueue().GetMaxBufferCount();
+    aBufferInfo->m6loReassemblyMaxBuffers =
+        instance.GetThreadNetif().GetMeshForwarder().GetReassemblyQueue().GetMaxBufferCount();
+
+#if OPENTHREAD_FTD
+    aBufferInfo->mArpMaxBuffers = instance.GetThreadNetif().GetMeshForwarder().GetResolvingQueue().GetMaxBufferCount();
+#else
+    aBufferInfo->mArpMaxBuffers = 0;
+#endif
+
+    aBufferInfo->mIp6MaxBuffers = instance.GetThreadNetif().GetIp6().GetSendQueue().GetMaxBufferCount();
+    aBufferInfo->mMplMaxBuffers =
+        instance.GetThreadNetif().GetIp6().GetMpl().GetBufferedMessageSet().GetMaxBufferCount();
+    aBufferInfo->mMleMaxBuffers  = instance.GetThreadNetif().GetMle().GetMessageQueue().GetMaxBufferCount();
+    aBufferInfo->mCoapMaxBuffers = instance.GetThreadNetif().GetCoap().GetRequestMessages().GetMaxBufferCount() +
+                                   instance.GetThreadNetif().GetCoap().GetCachedResponses().GetMaxBufferCount();
+
+    aBufferInfo->mAllocFailures = 0;
+
+    for (uint8_t type = 0; type < Message::kNumTypes; type++)
+    {
+        aBufferInfo->mTypeAllocFailures[type] = instance.GetMessagePool().GetAllocFailureCount(type);
+        aBufferInfo->mAllocFailures += aBufferInfo->mTypeAllocFailures[type];
+    }
+
+    for (uint8_t subType = 0; subType < Message::kNumSubTypes; subType++)
+    {
+        aBufferInfo->mSubTypeAllocFailures[subType] = instance.GetMessagePool().GetSubTypeAllocFailureCount(subType);
+    }
+
+    aBufferInfo->mLowBufferTime        = instance.GetMessagePool().GetLowBufferTime();
+    aBufferInfo->mBufferAllocations    = instance.GetMessagePool().GetBufferAllocationCount();
+    aBufferInfo->mPrependReallocations = instance.GetMessagePool().GetPrependReallocationCount();
+}
+
+#if OPENTHREAD_CONFIG_ENABLE_MESSAGE_TRACE
+void otMessageGetTraceHistograms(otInstance *aInstance, otMessageTraceHistograms *aHistograms)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    *aHistograms = instance.GetThreadNetif().GetMeshForwarder().GetTraceHistograms();
+}
+
+void otMessageResetTraceHistograms(otInstance *aInstance)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    instance.GetThreadNetif().GetMeshForwarder().ResetTraceHistograms();
 }
+#endif // OPENTHREAD_CONFIG_ENABLE_MESSAGE_TRACE
 #endif // OPENTHREAD_MTD || OPENTHREAD_FTD
@@ -66,6 +66,56 @@ exit:
     return retval;
 }
 
+void otTaskletsGetSleepHint(otInstance *aInstance, otSleepHint *aHint)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    aHint->mMilliRemaining  = OT_SLEEP_HINT_NO_DEADLINE;
+    aHint->mMicroRemaining  = OT_SLEEP_HINT_NO_DEADLINE;
+    aHint->mTaskletsPending = false;
+    aHint->mRadioInUse      = false;
+
+    VerifyOrExit(otInstanceIsInitialized(aInstance));
+
+    IgnoreReturnValue(instance.GetTimerMilliScheduler().GetRemainingTime(aHint->mMilliRemaining));
+#if OPENTHREAD_CONFIG_ENABLE_PLATFORM_USEC_TIMER
+    IgnoreReturnValue(instance.GetTimerMicroScheduler().GetRemainingTime(aHint->mMicroRemaining));
+#endif
+
+    aHint->mTaskletsPending = instance.GetTaskletScheduler().AreTaskletsPending();
+
+#if OPENTHREAD_RADIO
+    // In radio-only builds the radio is driven by the host, so it is always considered in use.
+    aHint->mRadioInUse = true;
+#else
+#if OPENTHREAD_ENABLE_RAW_LINK_API
+    aHint->mRadioInUse = instance.GetLinkRaw().IsEnabled();
+#endif
+    aHint->mRadioInUse = aHint->mRadioInUse || instance.GetThreadNetif().GetMac().IsRadioInUse();
+#endif
+
+exit:
+    return;
+}
+
+#if OPENTHREAD_CONFIG_ENABLE_HANDLER_PROFILER
+otError otTaskletGetNextHandlerProfile(otInstance *              aInstance,
+                                       otHandlerProfileIterator *aIterator,
+                                       otHandlerProfile *        aProfile)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return instance.GetHandlerProfiler().GetNextProfile(*aIterator, *aProfile);
+}
+
+void otTaskletResetHandlerProfiles(otInstance *aInstance)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    instance.GetHandlerProfiler().Reset();
+}
+#endif // OPENTHREAD_CONFIG_ENABLE_HANDLER_PROFILER
+
 #ifndef _MSC_VER
 OT_TOOL_WEAK void otTaskletsSignalPending(otInstance *)
 {
@@ -0,0 +1,98 @@
+/*
+ *  Copyright (c) 2018, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * @file
+ *   This file implements the OpenThread TCP API.
+ */
+
+#include "openthread-core-config.h"
+
+#include <openthread/tcp.h>
+
+#include "common/instance.hpp"
+#include "common/new.hpp"
+
+using namespace ot;
+
+#if OPENTHREAD_CONFIG_ENABLE_TCP
+otError otTcpOpen(otInstance *      aInstance,
+                  otTcpSocket *     aSocket,
+                  otTcpReceive      aReceiveHandler,
+                  otTcpEventHandler aEventHandler,
+                  void *            aContext)
+{
+    Instance &      instance = *static_cast<Instance *>(aInstance);
+    Ip6::TcpSocket &socket   = *new (aSocket) Ip6::TcpSocket(instance.GetIp6().GetTcp());
+
+    return socket.Open(aReceiveHandler, aEventHandler, aContext);
+}
+
+otError otTcpBind(otTcpSocket *aSocket, const otSockAddr *aSockName)
+{
+    Ip6::TcpSocket &socket = *static_cast<Ip6::TcpSocket *>(aSocket);
+    return socket.Bind(*static_cast<const Ip6::SockAddr *>(aSockName));
+}
+
+otError otTcpListen(otTcpSocket *aSocket)
+{
+    Ip6::TcpSocket &socket = *static_cast<Ip6::TcpSocket *>(aSocket);
+    return socket.Listen();
+}
+
+otError otTcpConnect(otTcpSocket *aSocket, const otSockAddr *aPeerName)
+{
+    Ip6::TcpSocket &socket = *static_cast<Ip6::TcpSocket *>(aSocket);
+    return socket.Connect(*static_cast<const Ip6::SockAddr *>(aPeerName));
+}
+
+otError otTcpSend(otTcpSocket *aSocket, const void *aBuf, uint16_t aLength)
+{
+    Ip6::TcpSocket &socket = *static_cast<Ip6::TcpSocket *>(aSocket);
+    return socket.Send(aBuf, aLength);
+}
+
+uint16_t otTcpGetSendBufferSpace(otTcpSocket *aSocket)
+{
+    Ip6::TcpSocket &socket = *static_cast<Ip6::TcpSocket *>(aSocket);
+    return socket.GetSendBufferSpace();
+}
+
+otError otTcpClose(otTcpSocket *aSocket)
+{
+    Ip6::TcpSocket &socket = *static_cast<Ip6::TcpSocket *>(aSocket);
+    return socket.Close();
+}
+
+void otTcpAbort(otTcpSocket *aSocket)
+{
+    Ip6::TcpSocket &socket = *static_cast<Ip6::TcpSocket *>(aSocket);
+    socket.Abort();
+}
+#endif // OPENTHREAD_CONFIG_ENABLE_TCP
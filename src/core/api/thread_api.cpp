@@ -525,6 +525,20 @@ const otIpCounters *otThreadGetIp6Counters(otInstance *aInstance)
     return &instance.GetThreadNetif().GetMeshForwarder().GetCounters();
 }
 
+const otIp6DropCounters *otThreadGetDropCounters(otInstance *aInstance)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return &instance.GetThreadNetif().GetMeshForwarder().GetDropCounters();
+}
+
+void otThreadResetDropCounters(otInstance *aInstance)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    instance.GetThreadNetif().GetMeshForwarder().ResetDropCounters();
+}
+
 const otMleCounters *otThreadGetMleCounters(otInstance *aInstance)
 {
     Instance &instance = *static_cast<Instance *>(aInstance);
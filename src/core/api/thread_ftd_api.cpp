@@ -122,6 +122,20 @@ otError otThreadSetJoinerUdpPort(otInstance *aInstance, uint16_t aJoinerUdpPort)
     return instance.GetThreadNetif().GetJoinerRouter().SetJoinerUdpPort(aJoinerUdpPort);
 }
 
+const otJoinerRouterCounters *otThreadGetJoinerRouterCounters(otInstance *aInstance)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return &instance.GetThreadNetif().GetJoinerRouter().GetCounters();
+}
+
+void otThreadResetJoinerRouterCounters(otInstance *aInstance)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    instance.GetThreadNetif().GetJoinerRouter().ResetCounters();
+}
+
 uint32_t otThreadGetContextIdReuseDelay(otInstance *aInstance)
 {
     Instance &instance = *static_cast<Instance *>(aInstance);
@@ -317,6 +331,20 @@ exit:
     return error;
 }
 
+const otEidCacheCounters *otThreadGetEidCacheCounters(otInstance *aInstance)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return &instance.GetThreadNetif().GetAddressResolver().GetCounters();
+}
+
+void otThreadResetEidCacheCounters(otInstance *aInstance)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    instance.GetThreadNetif().GetAddressResolver().ResetCounters();
+}
+
 otError otThreadSetSteeringData(otInstance *aInstance, const otExtAddress *aExtAddress)
 {
     otError error;
@@ -95,6 +95,12 @@ otError otUdpSend(otUdpSocket *aSocket, otMessage *aMessage, const otMessageInfo
     return socket.SendTo(*static_cast<Message *>(aMessage), *static_cast<const Ip6::MessageInfo *>(aMessageInfo));
 }
 
+otError otUdpSendBuffer(otUdpSocket *aSocket, const void *aBuf, uint16_t aLength, const otMessageInfo *aMessageInfo)
+{
+    Ip6::UdpSocket &socket = *static_cast<Ip6::UdpSocket *>(aSocket);
+    return socket.SendTo(aBuf, aLength, *static_cast<const Ip6::MessageInfo *>(aMessageInfo));
+}
+
 #if OPENTHREAD_ENABLE_UDP_FORWARD
 void otUdpForwardSetForwarder(otInstance *aInstance, otUdpForwarder aForwarder, void *aContext)
 {
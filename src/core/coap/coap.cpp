@@ -54,7 +54,12 @@ CoapBase::CoapBase(Instance &     aInstance,
     : InstanceLocator(aInstance)
     , mSocket(aInstance.GetThreadNetif().GetIp6().GetUdp())
     , mRetransmissionTimer(aInstance, aRetransmissionTimerHandler, this)
-    , mResources(NULL)
+#if OPENTHREAD_CONFIG_ENABLE_COAP_BLOCKWISE_TRANSFER
+    , mBlockWiseResources(NULL)
+#endif
+#if OPENTHREAD_CONFIG_ENABLE_COAP_REQUEST_WINDOW
+    , mNstart(kNStart)
+#endif
     , mContext(NULL)
     , mInterceptor(NULL)
     , mResponsesQueue(aInstance, aResponsesQueueTimerHandler, this)
@@ -62,6 +67,11 @@ CoapBase::CoapBase(Instance &     aInstance,
     , mDefaultHandlerContext(NULL)
 {
     mMessageId = Random::GetUint16();
+    memset(mResources, 0, sizeof(mResources));
+#if OPENTHREAD_CONFIG_ENABLE_COAP_OBSERVE
+    memset(mObservers, 0, sizeof(mObservers));
+    mObserveSequence = 0;
+#endif
 }
 
 otError CoapBase::Start(uint16_t aPort)
@@ -79,10 +89,22 @@ exit:
 
 otError CoapBase::Stop(void)
 {
-    Message *    message = mPendingRequests.GetHead();
+    Message *    message;
     Message *    messageToRemove;
     CoapMetadata coapMetadata;
 
+#if OPENTHREAD_CONFIG_ENABLE_COAP_REQUEST_WINDOW
+    // Remove the deferred requests first, so that none is sent when pending messages are removed.
+    while ((message = mDeferredRequests.GetHead()) != NULL)
+    {
+        coapMetadata.ReadFrom(*message);
+        mDeferredRequests.Dequeue(*message);
+        FinalizeDeferredRequest(*message, coapMetadata, OT_ERROR_ABORT);
+    }
+#endif
+
+    message = mPendingRequests.GetHead();
+
     // Remove all pending messages.
     while (message != NULL)
     {
@@ -95,20 +117,89 @@ otError CoapBase::Stop(void)
 
     mResponsesQueue.DequeueAllResponses();
 
+#if OPENTHREAD_CONFIG_ENABLE_COAP_OBSERVE
+    RemoveObservers(NULL);
+#endif
+
     return mSocket.Close();
 }
 
+uint16_t CoapBase::UpdateUriPathHash(uint16_t aHash, const uint8_t *aBytes, uint16_t aLength)
+{
+    for (uint16_t i = 0; i < aLength; i++)
+    {
+        aHash = static_cast<uint16_t>(aHash * 31 + aBytes[i]);
+    }
+
+    return aHash;
+}
+
+uint16_t CoapBase::UpdateUriPathHash(uint16_t aHash, const Message &aMessage, uint16_t aOffset, uint16_t aLength)
+{
+    Message::Chunk chunk;
+
+    for (aMessage.GetFirstChunk(aOffset, aLength, chunk); chunk.mLength > 0; aMessage.GetNextChunk(aLength, chunk))
+    {
+        aHash = UpdateUriPathHash(aHash, chunk.mData, chunk.mLength);
+    }
+
+    return aHash;
+}
+
+uint8_t CoapBase::GetResourceBucket(const Resource &aResource)
+{
+    const char *uriPath = aResource.GetUriPath();
+
+    return GetResourceBucket(
+        UpdateUriPathHash(0, reinterpret_cast<const uint8_t *>(uriPath), static_cast<uint16_t>(strlen(uriPath))));
+}
+
+bool CoapBase::IsUriPathMatch(const char *aUriPath, Header::OptionIterator &aIterator)
+{
+    const char *cur       = aUriPath;
+    size_t      remaining = strlen(aUriPath);
+    bool        matches   = false;
+
+    // The URI path segments are compared in place in the message, stopping at the first mismatch.
+    for (const Header::Option *coapOption = aIterator.GetFirstOption(); coapOption != NULL;
+         coapOption                       = aIterator.GetNextOption())
+    {
+        if (coapOption->mNumber != OT_COAP_OPTION_URI_PATH)
+        {
+            continue;
+        }
+
+        if (cur != aUriPath)
+        {
+            VerifyOrExit(*cur == kUriPathSeparator);
+            cur++;
+            remaining--;
+        }
+
+        VerifyOrExit(coapOption->mLength <= remaining);
+        VerifyOrExit(aIterator.IsValueEqual(reinterpret_cast<const uint8_t *>(cur)));
+        cur += coapOption->mLength;
+        remaining -= coapOption->mLength;
+    }
+
+    matches = (*cur == '\0');
+
+exit:
+    return matches;
+}
+
 otError CoapBase::AddResource(Resource &aResource)
 {
-    otError error = OT_ERROR_NONE;
+    otError    error  = OT_ERROR_NONE;
+    Resource *&bucket = mResources[GetResourceBucket(aResource)];
 
-    for (Resource *cur = mResources; cur; cur = cur->GetNext())
+    for (Resource *cur = bucket; cur; cur = cur->GetNext())
     {
         VerifyOrExit(cur != &aResource, error = OT_ERROR_ALREADY);
     }
 
-    aResource.mNext = mResources;
-    mResources      = &aResource;
+    aResource.mNext = bucket;
+    bucket          = &aResource;
 
 exit:
     return error;
@@ -116,13 +207,58 @@ exit:
 
 void CoapBase::RemoveResource(Resource &aResource)
 {
-    if (mResources == &aResource)
+    Resource *&bucket = mResources[GetResourceBucket(aResource)];
+
+    if (bucket == &aResource)
+    {
+        bucket = aResource.GetNext();
+    }
+    else
+    {
+        for (Resource *cur = bucket; cur; cur = cur->GetNext())
+        {
+            if (cur->mNext == &aResource)
+            {
+                cur->mNext = aResource.mNext;
+                ExitNow();
+            }
+        }
+    }
+
+exit:
+    aResource.mNext = NULL;
+
+#if OPENTHREAD_CONFIG_ENABLE_COAP_OBSERVE
+    RemoveObservers(&aResource);
+#endif
+}
+
+#if OPENTHREAD_CONFIG_ENABLE_COAP_BLOCKWISE_TRANSFER
+otError CoapBase::AddBlockWiseResource(ResourceBlockWise &aResource)
+{
+    otError error = OT_ERROR_NONE;
+
+    for (ResourceBlockWise *cur = mBlockWiseResources; cur; cur = cur->GetNext())
+    {
+        VerifyOrExit(cur != &aResource, error = OT_ERROR_ALREADY);
+    }
+
+    aResource.mNext     = mBlockWiseResources;
+    mBlockWiseResources = &aResource;
+
+exit:
+    return error;
+}
+
+void CoapBase::RemoveBlockWiseResource(ResourceBlockWise &aResource)
+{
+    if (mBlockWiseResources == &aResource)
     {
-        mResources = aResource.GetNext();
+        mBlockWiseResources = aResource.GetNext();
     }
     else
     {
-        for (Resource *cur = mResources; cur; cur = cur->GetNext())
+        for (ResourceBlockWise *cur = mBlockWiseResources; cur; cur = cur->GetNext())
         {
             if (cur->mNext == &aResource)
             {
@@ -135,6 +271,7 @@ void CoapBase::RemoveResource(Resource &aResource)
 exit:
     aResource.mNext = NULL;
 }
+#endif // OPENTHREAD_CONFIG_ENABLE_COAP_BLOCKWISE_TRANSFER
 
 void CoapBase::SetDefaultHandler(otCoapRequestHandler aHandler, void *aContext)
 {
@@ -160,16 +297,62 @@ exit:
 otError CoapBase::SendMessage(Message &               aMessage,
                               const Ip6::MessageInfo &aMessageInfo,
                               otCoapResponseHandler   aHandler,
-                              void *                  aContext)
+                              void *                  aContext
+#if OPENTHREAD_CONFIG_ENABLE_COAP_BLOCKWISE_TRANSFER
+                              ,
+                              otCoapBlockwiseTransmitHook aTransmitHook,
+                              otCoapBlockwiseReceiveHook  aReceiveHook
+#endif
+)
 {
     otError      error;
     Header       header;
     CoapMetadata coapMetadata;
     Message *    storedCopy = NULL;
     uint16_t     copyLength = 0;
+#if OPENTHREAD_CONFIG_ENABLE_COAP_OBSERVE
+    Observer *observer;
+    uint32_t  observe;
+#endif
 
     SuccessOrExit(error = header.FromMessage(aMessage, 0));
 
+#if OPENTHREAD_CONFIG_ENABLE_COAP_REQUEST_WINDOW
+    if (header.IsRequest() && (header.IsConfirmable() || (header.IsNonConfirmable() && aHandler != NULL)) &&
+        !aMessageInfo.GetPeerAddr().IsMulticast() && IsRequestWindowFull(aMessageInfo.GetPeerAddr()))
+    {
+        coapMetadata = CoapMetadata(header.IsConfirmable(), aMessageInfo, aHandler, aContext);
+#if OPENTHREAD_CONFIG_ENABLE_COAP_BLOCKWISE_TRANSFER
+        coapMetadata.mBlockwiseTransmitHook = aTransmitHook;
+        coapMetadata.mBlockwiseReceiveHook  = aReceiveHook;
+#endif
+        ExitNow(error = DeferRequest(aMessage, coapMetadata));
+    }
+#endif
+
+#if OPENTHREAD_CONFIG_ENABLE_COAP_BLOCKWISE_TRANSFER
+    if (aTransmitHook != NULL)
+    {
+        VerifyOrExit(header.IsRequest(), error = OT_ERROR_INVALID_ARGS);
+        SuccessOrExit(error = WriteFirstBlock(aMessage, header, OT_COAP_OPTION_BLOCK1, aContext, aTransmitHook));
+    }
+#endif
+
+#if OPENTHREAD_CONFIG_ENABLE_COAP_OBSERVE
+    if (header.IsResponse() && (observer = FindObserver(header, aMessageInfo)) != NULL)
+    {
+        if (header.GetCode() >= OT_COAP_CODE_BAD_REQUEST)
+        {
+            // An error response ends the observation (RFC 7641, section 4.2).
+            RemoveObserver(*observer);
+        }
+        else if (header.GetUintOption(OT_COAP_OPTION_OBSERVE, observe) == OT_ERROR_NOT_FOUND)
+        {
+            SuccessOrExit(error = SetObserveOption(aMessage, header));
+        }
+    }
+#endif
+
     if ((header.GetType() == OT_COAP_TYPE_ACKNOWLEDGMENT || header.GetType() == OT_COAP_TYPE_RESET) &&
         header.GetCode() != OT_COAP_CODE_EMPTY)
     {
@@ -193,11 +376,32 @@ otError CoapBase::SendMessage(Message &               aMessage,
     {
         // As we do not retransmit non confirmable messages, create a copy of header only, for token information.
         copyLength = header.GetLength();
+
+        // Leave out the payload marker so that the stored header can be parsed again.
+        if (copyLength < aMessage.GetLength())
+        {
+            copyLength--;
+        }
     }
 
     if (copyLength > 0)
     {
         coapMetadata = CoapMetadata(header.IsConfirmable(), aMessageInfo, aHandler, aContext);
+#if OPENTHREAD_CONFIG_ENABLE_COAP_BLOCKWISE_TRANSFER
+        coapMetadata.mBlockwiseTransmitHook = aTransmitHook;
+        coapMetadata.mBlockwiseReceiveHook  = aReceiveHook;
+#endif
+#if OPENTHREAD_CONFIG_ENABLE_COAP_OBSERVE
+        coapMetadata.mObserve = (aHandler != NULL && header.GetCode() == OT_COAP_CODE_GET &&
+                                 header.GetUintOption(OT_COAP_OPTION_OBSERVE, observe) == OT_ERROR_NONE &&
+                                 observe == kObserveRegister);
+#endif
+#if OPENTHREAD_CONFIG_ENABLE_COAP_ADAPTIVE_RTO
+        if (header.IsConfirmable())
+        {
+            coapMetadata.SetInitialTimeout(mRtoEstimator.GetRto(aMessageInfo.GetPeerAddr()));
+        }
+#endif
         VerifyOrExit((storedCopy = CopyAndEnqueueMessage(aMessage, copyLength, coapMetadata)) != NULL,
                      error = OT_ERROR_NO_BUFS);
     }
@@ -246,29 +450,22 @@ exit:
     return error;
 }
 
-otError CoapBase::SendHeaderResponse(Header::Code            aCode,
-                                     const Header &          aRequestHeader,
-                                     const Ip6::MessageInfo &aMessageInfo)
+otError CoapBase::InitResponseHeader(Header &aResponseHeader, Header::Code aCode, const Header &aRequestHeader)
 {
-    otError      error = OT_ERROR_NONE;
-    Header       responseHeader;
-    Header::Type requestType;
-    Message *    message = NULL;
+    otError error = OT_ERROR_NONE;
 
     VerifyOrExit(aRequestHeader.IsRequest(), error = OT_ERROR_INVALID_ARGS);
 
-    requestType = aRequestHeader.GetType();
-
-    switch (requestType)
+    switch (aRequestHeader.GetType())
     {
     case OT_COAP_TYPE_CONFIRMABLE:
-        responseHeader.Init(OT_COAP_TYPE_ACKNOWLEDGMENT, aCode);
-        responseHeader.SetMessageId(aRequestHeader.GetMessageId());
+        aResponseHeader.Init(OT_COAP_TYPE_ACKNOWLEDGMENT, aCode);
+        aResponseHeader.SetMessageId(aRequestHeader.GetMessageId());
         break;
 
     case OT_COAP_TYPE_NON_CONFIRMABLE:
-        responseHeader.Init(OT_COAP_TYPE_NON_CONFIRMABLE, aCode);
-        responseHeader.SetMessageId(mMessageId++);
+        aResponseHeader.Init(OT_COAP_TYPE_NON_CONFIRMABLE, aCode);
+        aResponseHeader.SetMessageId(mMessageId++);
         break;
 
     default:
@@ -276,7 +473,21 @@ otError CoapBase::SendHeaderResponse(Header::Code            aCode,
         break;
     }
 
-    responseHeader.SetToken(aRequestHeader.GetToken(), aRequestHeader.GetTokenLength());
+    aResponseHeader.SetToken(aRequestHeader.GetToken(), aRequestHeader.GetTokenLength());
+
+exit:
+    return error;
+}
+
+otError CoapBase::SendHeaderResponse(Header::Code            aCode,
+                                     const Header &          aRequestHeader,
+                                     const Ip6::MessageInfo &aMessageInfo)
+{
+    otError  error = OT_ERROR_NONE;
+    Header   responseHeader;
+    Message *message = NULL;
+
+    SuccessOrExit(error = InitResponseHeader(responseHeader, aCode, aRequestHeader));
 
     VerifyOrExit((message = NewMessage(responseHeader)) != NULL, error = OT_ERROR_NO_BUFS);
 
@@ -306,7 +517,14 @@ void CoapBase::HandleRetransmissionTimer(void)
         nextMessage = message->GetNext();
         coapMetadata.ReadFrom(*message);
 
-        if (coapMetadata.IsLater(now))
+#if OPENTHREAD_CONFIG_ENABLE_COAP_OBSERVE
+        if (coapMetadata.mObserving)
+        {
+            // Notifications are awaited until the observation is cancelled.
+        }
+        else
+#endif
+            if (coapMetadata.IsLater(now))
         {
             // Calculate the next delay and choose the lowest.
             if (coapMetadata.mNextTimerShot - now < nextDelta)
@@ -318,7 +536,12 @@ void CoapBase::HandleRetransmissionTimer(void)
         {
             // Increment retransmission counter and timer.
             coapMetadata.mRetransmissionCount++;
+#if OPENTHREAD_CONFIG_ENABLE_COAP_ADAPTIVE_RTO
+            coapMetadata.mRetransmissionTimeout =
+                coapMetadata.mRetransmissionTimeout * coapMetadata.mBackoffFactor / RtoEstimator::kBackoffDenominator;
+#else
             coapMetadata.mRetransmissionTimeout *= 2;
+#endif
             coapMetadata.mNextTimerShot = now + coapMetadata.mRetransmissionTimeout;
             coapMetadata.UpdateIn(*message);
 
@@ -377,6 +600,21 @@ otError CoapBase::AbortTransaction(otCoapResponseHandler aHandler, void *aContex
     Message *    nextMessage;
     CoapMetadata coapMetadata;
 
+#if OPENTHREAD_CONFIG_ENABLE_COAP_REQUEST_WINDOW
+    for (message = mDeferredRequests.GetHead(); message != NULL; message = nextMessage)
+    {
+        nextMessage = message->GetNext();
+        coapMetadata.ReadFrom(*message);
+
+        if (coapMetadata.mResponseHandler == aHandler && coapMetadata.mResponseContext == aContext)
+        {
+            mDeferredRequests.Dequeue(*message);
+            FinalizeDeferredRequest(*message, coapMetadata, OT_ERROR_ABORT);
+            error = OT_ERROR_NONE;
+        }
+    }
+#endif
+
     for (message = mPendingRequests.GetHead(); message != NULL; message = nextMessage)
     {
         nextMessage = message->GetNext();
@@ -451,7 +689,110 @@ void CoapBase::DequeueMessage(Message &aMessage)
 
     // No need to worry that the earliest pending message was removed -
     // the timer would just shoot earlier and then it'd be setup again.
+
+#if OPENTHREAD_CONFIG_ENABLE_COAP_REQUEST_WINDOW
+    SendDeferredRequests();
+#endif
+}
+
+#if OPENTHREAD_CONFIG_ENABLE_COAP_REQUEST_WINDOW
+otError CoapBase::SetNstart(uint8_t aNstart)
+{
+    otError error = OT_ERROR_NONE;
+
+    VerifyOrExit(aNstart > 0, error = OT_ERROR_INVALID_ARGS);
+
+    mNstart = aNstart;
+    SendDeferredRequests();
+
+exit:
+    return error;
+}
+
+bool CoapBase::IsRequestWindowFull(const Ip6::Address &aAddress) const
+{
+    uint8_t      count = 0;
+    CoapMetadata coapMetadata;
+
+    for (const Message *message = mPendingRequests.GetHead(); message != NULL && count < mNstart;
+         message               = message->GetNext())
+    {
+        coapMetadata.ReadFrom(*message);
+
+        // An interaction is outstanding until acknowledged, or until its response for a non-confirmable request.
+        if (!coapMetadata.mAcknowledged && coapMetadata.mDestinationAddress == aAddress)
+        {
+            count++;
+        }
+    }
+
+    return count >= mNstart;
+}
+
+otError CoapBase::DeferRequest(Message &aMessage, const CoapMetadata &aCoapMetadata)
+{
+    otError error;
+
+    SuccessOrExit(error = aCoapMetadata.AppendTo(aMessage));
+    mDeferredRequests.Enqueue(aMessage);
+
+exit:
+    return error;
+}
+
+void CoapBase::SendDeferredRequests(void)
+{
+    Message *        message = mDeferredRequests.GetHead();
+    CoapMetadata     coapMetadata;
+    Ip6::MessageInfo messageInfo;
+    otError          error;
+
+    while (message != NULL)
+    {
+        coapMetadata.ReadFrom(*message);
+
+        if (IsRequestWindowFull(coapMetadata.mDestinationAddress))
+        {
+            message = message->GetNext();
+            continue;
+        }
+
+        // Shrinking a message does not fail.
+        mDeferredRequests.Dequeue(*message);
+        message->SetLength(message->GetLength() - sizeof(CoapMetadata));
+
+        messageInfo.SetPeerAddr(coapMetadata.mDestinationAddress);
+        messageInfo.SetPeerPort(coapMetadata.mDestinationPort);
+        messageInfo.SetSockAddr(coapMetadata.mSourceAddress);
+        messageInfo.SetInterfaceId(GetNetif().GetInterfaceId());
+
+        error = SendMessage(*message, messageInfo, coapMetadata.mResponseHandler, coapMetadata.mResponseContext
+#if OPENTHREAD_CONFIG_ENABLE_COAP_BLOCKWISE_TRANSFER
+                            ,
+                            coapMetadata.mBlockwiseTransmitHook, coapMetadata.mBlockwiseReceiveHook
+#endif
+        );
+
+        if (error != OT_ERROR_NONE)
+        {
+            FinalizeDeferredRequest(*message, coapMetadata, error);
+        }
+
+        // Sending may have released or aborted other deferred requests, start over.
+        message = mDeferredRequests.GetHead();
+    }
+}
+
+void CoapBase::FinalizeDeferredRequest(Message &aMessage, const CoapMetadata &aCoapMetadata, otError aResult)
+{
+    aMessage.Free();
+
+    if (aCoapMetadata.mResponseHandler != NULL)
+    {
+        aCoapMetadata.mResponseHandler(aCoapMetadata.mResponseContext, NULL, NULL, NULL, aResult);
+    }
 }
+#endif // OPENTHREAD_CONFIG_ENABLE_COAP_REQUEST_WINDOW
 
 otError CoapBase::SendCopy(const Message &aMessage, const Ip6::MessageInfo &aMessageInfo)
 {
@@ -563,6 +904,13 @@ void CoapBase::ProcessReceivedResponse(Header &aResponseHeader, Message &aMessag
 
     aMessage.MoveOffset(aResponseHeader.GetLength());
 
+#if OPENTHREAD_CONFIG_ENABLE_COAP_OBSERVE
+    if (aResponseHeader.GetType() == OT_COAP_TYPE_RESET)
+    {
+        ProcessObserverReset(aResponseHeader, aMessageInfo);
+    }
+#endif
+
     message = FindRelatedRequest(aResponseHeader, aMessageInfo, requestHeader, coapMetadata);
 
     if (message == NULL)
@@ -582,6 +930,14 @@ void CoapBase::ProcessReceivedResponse(Header &aResponseHeader, Message &aMessag
         break;
 
     case OT_COAP_TYPE_ACKNOWLEDGMENT:
+#if OPENTHREAD_CONFIG_ENABLE_COAP_ADAPTIVE_RTO
+        if (coapMetadata.mConfirmable && !coapMetadata.mAcknowledged)
+        {
+            mRtoEstimator.UpdateRtt(coapMetadata.mDestinationAddress, TimerMilli::GetNow() - coapMetadata.mTransmitTime,
+                                    coapMetadata.mRetransmissionCount);
+        }
+#endif
+
         if (aResponseHeader.IsEmpty())
         {
             // Empty acknowledgment.
@@ -596,9 +952,35 @@ void CoapBase::ProcessReceivedResponse(Header &aResponseHeader, Message &aMessag
             {
                 DequeueMessage(*message);
             }
+#if OPENTHREAD_CONFIG_ENABLE_COAP_OBSERVE
+            else if (requestHeader.IsResponse())
+            {
+                // A confirmable notification is complete once acknowledged.
+                FinalizeCoapTransaction(*message, coapMetadata, NULL, NULL, &aMessageInfo, OT_ERROR_NONE);
+            }
+#endif
+
+#if OPENTHREAD_CONFIG_ENABLE_COAP_REQUEST_WINDOW
+            // The acknowledged request is no longer outstanding.
+            SendDeferredRequests();
+#endif
         }
         else if (aResponseHeader.IsResponse() && aResponseHeader.IsTokenEqual(requestHeader))
         {
+#if OPENTHREAD_CONFIG_ENABLE_COAP_BLOCKWISE_TRANSFER
+            if (ContinueBlockwiseTransfer(*message, coapMetadata, requestHeader, aResponseHeader, aMessage))
+            {
+                break;
+            }
+#endif
+
+#if OPENTHREAD_CONFIG_ENABLE_COAP_OBSERVE
+            if (ProcessNotification(*message, coapMetadata, aResponseHeader, aMessage, aMessageInfo))
+            {
+                break;
+            }
+#endif
+
             // Piggybacked response.
             FinalizeCoapTransaction(*message, coapMetadata, &aResponseHeader, &aMessage, &aMessageInfo, OT_ERROR_NONE);
         }
@@ -614,6 +996,20 @@ void CoapBase::ProcessReceivedResponse(Header &aResponseHeader, Message &aMessag
         // fall through
 
     case OT_COAP_TYPE_NON_CONFIRMABLE:
+#if OPENTHREAD_CONFIG_ENABLE_COAP_BLOCKWISE_TRANSFER
+        if (ContinueBlockwiseTransfer(*message, coapMetadata, requestHeader, aResponseHeader, aMessage))
+        {
+            break;
+        }
+#endif
+
+#if OPENTHREAD_CONFIG_ENABLE_COAP_OBSERVE
+        if (ProcessNotification(*message, coapMetadata, aResponseHeader, aMessage, aMessageInfo))
+        {
+            break;
+        }
+#endif
+
         // Separate response.
         FinalizeCoapTransaction(*message, coapMetadata, &aResponseHeader, &aMessage, &aMessageInfo, OT_ERROR_NONE);
 
@@ -634,17 +1030,19 @@ exit:
 
 void CoapBase::ProcessReceivedRequest(Header &aHeader, Message &aMessage, const Ip6::MessageInfo &aMessageInfo)
 {
-    char                  uriPath[Resource::kMaxReceivedUriPath] = "";
-    char *                curUriPath                             = uriPath;
-    const Header::Option *coapOption;
-    Message *             cachedResponse = NULL;
-    otError               error          = OT_ERROR_NOT_FOUND;
+    uint16_t               uriPathHash    = 0;
+    uint16_t               uriPathLength  = 0;
+    Message *              cachedResponse = NULL;
+    otError                error          = OT_ERROR_NOT_FOUND;
+    Header::OptionIterator iterator;
+    const Header::Option * coapOption;
 
     if (mInterceptor != NULL)
     {
         SuccessOrExit(error = mInterceptor(aMessage, aMessageInfo, mContext));
     }
 
+    iterator.Init(aMessage, aMessage.GetOffset(), aHeader);
     aMessage.MoveOffset(aHeader.GetLength());
 
     switch (mResponsesQueue.GetMatchedResponseCopy(aHeader, aMessageInfo, &cachedResponse))
@@ -662,37 +1060,54 @@ void CoapBase::ProcessReceivedRequest(Header &aHeader, Message &aMessage, const
         break;
     }
 
-    coapOption = aHeader.GetFirstOption();
+    coapOption = iterator.GetFirstOption();
 
     while (coapOption != NULL)
     {
         switch (coapOption->mNumber)
         {
         case OT_COAP_OPTION_URI_PATH:
-            if (curUriPath != uriPath)
+            if (uriPathLength != 0)
             {
-                *curUriPath++ = '/';
+                const uint8_t separator = kUriPathSeparator;
+
+                uriPathHash = UpdateUriPathHash(uriPathHash, &separator, sizeof(separator));
+                uriPathLength++;
             }
 
-            VerifyOrExit(coapOption->mLength < sizeof(uriPath) - static_cast<size_t>(curUriPath + 1 - uriPath));
+            VerifyOrExit(coapOption->mLength < Resource::kMaxReceivedUriPath - uriPathLength - 1);
 
-            memcpy(curUriPath, coapOption->mValue, coapOption->mLength);
-            curUriPath += coapOption->mLength;
+            uriPathHash = UpdateUriPathHash(uriPathHash, aMessage, iterator.GetValueOffset(), coapOption->mLength);
+            uriPathLength += coapOption->mLength;
             break;
 
         default:
             break;
         }
 
-        coapOption = aHeader.GetNextOption();
+        coapOption = iterator.GetNextOption();
     }
 
-    curUriPath[0] = '\0';
+#if OPENTHREAD_CONFIG_ENABLE_COAP_BLOCKWISE_TRANSFER
+    for (const ResourceBlockWise *resource = mBlockWiseResources; resource != NULL; resource = resource->GetNext())
+    {
+        if (IsUriPathMatch(resource->mUriPath, iterator))
+        {
+            ProcessBlockwiseRequest(*resource, aHeader, aMessage, aMessageInfo);
+            error = OT_ERROR_NONE;
+            ExitNow();
+        }
+    }
+#endif
 
-    for (const Resource *resource = mResources; resource; resource = resource->GetNext())
+    for (const Resource *resource = mResources[GetResourceBucket(uriPathHash)]; resource != NULL;
+         resource                 = resource->GetNext())
     {
-        if (strcmp(resource->mUriPath, uriPath) == 0)
+        if (IsUriPathMatch(resource->mUriPath, iterator))
         {
+#if OPENTHREAD_CONFIG_ENABLE_COAP_OBSERVE
+            ProcessObserveRequest(*resource, aHeader, aMessageInfo);
+#endif
             resource->HandleRequest(aHeader, aMessage, aMessageInfo);
             error = OT_ERROR_NONE;
             ExitNow();
@@ -725,89 +1140,814 @@ exit:
     return;
 }
 
-CoapMetadata::CoapMetadata(bool                    aConfirmable,
-                           const Ip6::MessageInfo &aMessageInfo,
-                           otCoapResponseHandler   aHandler,
-                           void *                  aContext)
-{
-    mSourceAddress         = aMessageInfo.GetSockAddr();
-    mDestinationPort       = aMessageInfo.GetPeerPort();
-    mDestinationAddress    = aMessageInfo.GetPeerAddr();
-    mResponseHandler       = aHandler;
-    mResponseContext       = aContext;
-    mRetransmissionCount   = 0;
-    mRetransmissionTimeout = TimerMilli::SecToMsec(kAckTimeout);
-    mRetransmissionTimeout += Random::GetUint32InRange(
-        0, TimerMilli::SecToMsec(kAckTimeout) * kAckRandomFactorNumerator / kAckRandomFactorDenominator -
-               TimerMilli::SecToMsec(kAckTimeout) + 1);
+#if OPENTHREAD_CONFIG_ENABLE_COAP_BLOCKWISE_TRANSFER
 
-    if (aConfirmable)
-    {
-        // Set next retransmission timeout.
-        mNextTimerShot = TimerMilli::GetNow() + mRetransmissionTimeout;
-    }
-    else
+otCoapBlockSize CoapBase::ClampBlockSize(otCoapBlockSize aSize)
+{
+    while (aSize > OT_COAP_BLOCK_SIZE_16 && Header::GetBlockSize(aSize) > kMaxBlockLength)
     {
-        // Set overall response timeout.
-        mNextTimerShot = TimerMilli::GetNow() + kMaxTransmitWait;
+        aSize = static_cast<otCoapBlockSize>(aSize - 1);
     }
 
-    mAcknowledged = false;
-    mConfirmable  = aConfirmable;
+    return aSize;
 }
 
-ResponsesQueue::ResponsesQueue(Instance &aInstance, Timer::Handler aHandler, void *aContext)
-    : mQueue()
-    , mTimer(aInstance, aHandler, aContext)
+otError CoapBase::WriteBlock(Message &                   aMessage,
+                             Header &                    aHeader,
+                             uint16_t                    aOptionNumber,
+                             uint32_t                    aNum,
+                             otCoapBlockSize             aSize,
+                             void *                      aContext,
+                             otCoapBlockwiseTransmitHook aTransmitHook)
 {
-}
+    otError  error = OT_ERROR_NONE;
+    uint8_t  block[kMaxBlockLength];
+    uint16_t blockLength = Header::GetBlockSize(aSize);
+    bool     more        = false;
 
-otError ResponsesQueue::GetMatchedResponseCopy(const Header &          aHeader,
-                                               const Ip6::MessageInfo &aMessageInfo,
-                                               Message **              aResponse)
-{
-    otError                error = OT_ERROR_NOT_FOUND;
-    Message *              message;
-    EnqueuedResponseHeader enqueuedResponseHeader;
-    Ip6::MessageInfo       messageInfo;
-    Header                 header;
+    assert(blockLength <= sizeof(block));
 
-    for (message = mQueue.GetHead(); message != NULL; message = message->GetNext())
-    {
-        enqueuedResponseHeader.ReadFrom(*message);
-        messageInfo = enqueuedResponseHeader.GetMessageInfo();
+    SuccessOrExit(error = aTransmitHook(aContext, block, aNum * blockLength, &blockLength, &more));
+    VerifyOrExit(blockLength <= Header::GetBlockSize(aSize), error = OT_ERROR_INVALID_ARGS);
 
-        // Check source endpoint
-        if (messageInfo.GetPeerPort() != aMessageInfo.GetPeerPort())
+    SuccessOrExit(error = aHeader.SetBlockOption(aOptionNumber, aNum, more, aSize));
+
+    if (blockLength > 0)
+    {
+        SuccessOrExit(error = aHeader.SetPayloadMarker());
+    }
+
+    // Replace the message content with the updated header and the block.
+    SuccessOrExit(error = aMessage.SetLength(0));
+    aMessage.SetOffset(0);
+    SuccessOrExit(error = aMessage.Append(aHeader.GetBytes(), aHeader.GetLength()));
+    SuccessOrExit(error = aMessage.Append(block, blockLength));
+
+exit:
+    return error;
+}
+
+otError CoapBase::WriteFirstBlock(Message &                   aMessage,
+                                  Header &                    aHeader,
+                                  uint16_t                    aOptionNumber,
+                                  void *                      aContext,
+                                  otCoapBlockwiseTransmitHook aTransmitHook)
+{
+    otError         error;
+    uint32_t        num;
+    bool            more;
+    otCoapBlockSize size;
+
+    switch (error = aHeader.GetBlockOption(aOptionNumber, num, more, size))
+    {
+    case OT_ERROR_NONE:
+        // A later block was already written when continuing a transfer.
+        VerifyOrExit(num == 0);
+        size = ClampBlockSize(size);
+        break;
+
+    case OT_ERROR_NOT_FOUND:
+        size = ClampBlockSize(OT_COAP_BLOCK_SIZE_1024);
+        break;
+
+    default:
+        ExitNow();
+    }
+
+    error = WriteBlock(aMessage, aHeader, aOptionNumber, 0, size, aContext, aTransmitHook);
+
+exit:
+    return error;
+}
+
+otError CoapBase::DeliverBlock(const Message &            aMessage,
+                               uint32_t                   aPosition,
+                               bool                       aMore,
+                               uint32_t                   aTotalLength,
+                               void *                     aContext,
+                               otCoapBlockwiseReceiveHook aReceiveHook)
+{
+    otError  error = OT_ERROR_NONE;
+    uint8_t  buf[kMaxBlockLength];
+    uint16_t offset = aMessage.GetOffset();
+    uint16_t length;
+
+    // Blocks larger than the local maximum are passed on in several parts.
+    do
+    {
+        length = aMessage.Read(offset, sizeof(buf), buf);
+        offset += length;
+
+        SuccessOrExit(error = aReceiveHook(aContext, buf, aPosition, length, aMore || offset < aMessage.GetLength(),
+                                           aTotalLength));
+
+        aPosition += length;
+    } while (offset < aMessage.GetLength());
+
+exit:
+    return error;
+}
+
+otError CoapBase::SendNextBlockRequest(const Message &     aRequest,
+                                       const CoapMetadata &aCoapMetadata,
+                                       Header &            aRequestHeader,
+                                       uint16_t            aOptionNumber,
+                                       uint32_t            aNum,
+                                       otCoapBlockSize     aSize)
+{
+    otError                     error        = OT_ERROR_NONE;
+    Message *                   message      = NULL;
+    otCoapBlockwiseTransmitHook transmitHook = NULL;
+    Ip6::MessageInfo            messageInfo;
+
+    // A new Message ID is assigned by `SendMessage()`, the Token is kept.
+    aRequestHeader.SetMessageId(0);
+
+    if (aOptionNumber == OT_COAP_OPTION_BLOCK1)
+    {
+        transmitHook = aCoapMetadata.mBlockwiseTransmitHook;
+    }
+    else
+    {
+        // The request payload is not repeated when fetching the blocks of the response (RFC 7959, section 3.2).
+        SuccessOrExit(error = aRequestHeader.RemoveOption(OT_COAP_OPTION_BLOCK1));
+        SuccessOrExit(error = aRequestHeader.SetBlockOption(OT_COAP_OPTION_BLOCK2, aNum, false, aSize));
+    }
+
+    VerifyOrExit((message = NewMessage(aRequestHeader)) != NULL, error = OT_ERROR_NO_BUFS);
+    message->SetLinkSecurityEnabled(aRequest.IsLinkSecurityEnabled());
+    SuccessOrExit(error = message->SetPriority(aRequest.GetPriority()));
+
+    if (transmitHook != NULL)
+    {
+        SuccessOrExit(error = WriteBlock(*message, aRequestHeader, OT_COAP_OPTION_BLOCK1, aNum, aSize,
+                                         aCoapMetadata.mResponseContext, transmitHook));
+    }
+
+    messageInfo.SetPeerAddr(aCoapMetadata.mDestinationAddress);
+    messageInfo.SetPeerPort(aCoapMetadata.mDestinationPort);
+    messageInfo.SetSockAddr(aCoapMetadata.mSourceAddress);
+    messageInfo.SetInterfaceId(GetNetif().GetInterfaceId());
+
+    SuccessOrExit(error = SendMessage(*message, messageInfo, aCoapMetadata.mResponseHandler,
+                                      aCoapMetadata.mResponseContext, transmitHook,
+                                      aCoapMetadata.mBlockwiseReceiveHook));
+
+exit:
+
+    if (error != OT_ERROR_NONE && message != NULL)
+    {
+        message->Free();
+    }
+
+    return error;
+}
+
+bool CoapBase::ContinueBlockwiseTransfer(Message &           aRequest,
+                                         const CoapMetadata &aCoapMetadata,
+                                         Header &            aRequestHeader,
+                                         Header &            aResponseHeader,
+                                         const Message &     aResponse)
+{
+    otError         error       = OT_ERROR_NONE;
+    bool            continued   = false;
+    uint32_t        totalLength = 0;
+    uint32_t        num;
+    bool            more;
+    otCoapBlockSize size;
+    uint32_t        requestNum;
+    bool            requestMore;
+    otCoapBlockSize requestSize;
+
+    if (aResponseHeader.GetCode() == OT_COAP_CODE_CONTINUE && aCoapMetadata.mBlockwiseTransmitHook != NULL)
+    {
+        SuccessOrExit(error =
+                          aRequestHeader.GetBlockOption(OT_COAP_OPTION_BLOCK1, requestNum, requestMore, requestSize));
+        VerifyOrExit(requestMore);
+        SuccessOrExit(error = aResponseHeader.GetBlockOption(OT_COAP_OPTION_BLOCK1, num, more, size));
+
+        if (size < requestSize)
         {
-            continue;
+            // The server asks for smaller blocks, renumber from the position of the next block.
+            num = (requestNum + 1) * Header::GetBlockSize(requestSize) / Header::GetBlockSize(size);
+        }
+        else
+        {
+            num  = requestNum + 1;
+            size = requestSize;
         }
 
-        if (messageInfo.GetPeerAddr() != aMessageInfo.GetPeerAddr())
+        SuccessOrExit(error = SendNextBlockRequest(aRequest, aCoapMetadata, aRequestHeader, OT_COAP_OPTION_BLOCK1, num,
+                                                   size));
+        continued = true;
+    }
+    else if (aCoapMetadata.mBlockwiseReceiveHook != NULL && aResponseHeader.GetCode() < OT_COAP_CODE_BAD_REQUEST &&
+             aResponseHeader.GetBlockOption(OT_COAP_OPTION_BLOCK2, num, more, size) == OT_ERROR_NONE)
+    {
+        aResponseHeader.GetUintOption(OT_COAP_OPTION_SIZE2, totalLength);
+
+        SuccessOrExit(error = DeliverBlock(aResponse, num * Header::GetBlockSize(size), more, totalLength,
+                                           aCoapMetadata.mResponseContext, aCoapMetadata.mBlockwiseReceiveHook));
+        VerifyOrExit(more);
+
+        SuccessOrExit(error = SendNextBlockRequest(aRequest, aCoapMetadata, aRequestHeader, OT_COAP_OPTION_BLOCK2,
+                                                   num + 1, size));
+        continued = true;
+    }
+
+exit:
+
+    if (error != OT_ERROR_NONE)
+    {
+        otLogInfoCoapErr(error, "Block-wise transfer failed");
+        FinalizeCoapTransaction(aRequest, aCoapMetadata, NULL, NULL, NULL, error);
+        continued = true;
+    }
+    else if (continued)
+    {
+        // The transaction goes on with the request for the next block.
+        DequeueMessage(aRequest);
+    }
+
+    return continued;
+}
+
+void CoapBase::ProcessBlockwiseRequest(const ResourceBlockWise &aResource,
+                                       Header &                 aHeader,
+                                       Message &                aMessage,
+                                       const Ip6::MessageInfo & aMessageInfo)
+{
+    otError         error = OT_ERROR_NONE;
+    Header          responseHeader;
+    Message *       message     = NULL;
+    uint32_t        totalLength = 0;
+    uint32_t        num;
+    bool            more;
+    otCoapBlockSize size;
+
+    if (aResource.mReceiveHook != NULL &&
+        aHeader.GetBlockOption(OT_COAP_OPTION_BLOCK1, num, more, size) == OT_ERROR_NONE)
+    {
+        aHeader.GetUintOption(OT_COAP_OPTION_SIZE1, totalLength);
+
+        error = DeliverBlock(aMessage, num * Header::GetBlockSize(size), more, totalLength, aResource.mContext,
+                             aResource.mReceiveHook);
+
+        if (error != OT_ERROR_NONE)
         {
-            continue;
+            SendHeaderResponse(error == OT_ERROR_NO_BUFS ? OT_COAP_CODE_REQUEST_TOO_LARGE
+                                                         : OT_COAP_CODE_REQUEST_INCOMPLETE,
+                               aHeader, aMessageInfo);
+            ExitNow();
         }
 
-        // Check Message Id
-        if (header.FromMessage(*message, sizeof(EnqueuedResponseHeader)) != OT_ERROR_NONE)
+        if (more)
         {
-            continue;
+            // Acknowledge the block and ask for the next one at the same (or the local maximum) size.
+            SuccessOrExit(error = InitResponseHeader(responseHeader, OT_COAP_CODE_CONTINUE, aHeader));
+            SuccessOrExit(error = responseHeader.AppendBlockOption(OT_COAP_OPTION_BLOCK1, num, true,
+                                                                   ClampBlockSize(size)));
+            VerifyOrExit((message = NewMessage(responseHeader)) != NULL, error = OT_ERROR_NO_BUFS);
+            SuccessOrExit(error = SendMessage(*message, aMessageInfo));
+            ExitNow();
+        }
+    }
+    else if (aResource.mTransmitHook != NULL &&
+             aHeader.GetBlockOption(OT_COAP_OPTION_BLOCK2, num, more, size) == OT_ERROR_NONE && num > 0)
+    {
+        SendBlock2Response(aResource, aHeader, num, size, aMessageInfo);
+        ExitNow();
+    }
+
+    aResource.HandleRequest(aHeader, aMessage, aMessageInfo);
+
+exit:
+
+    if (error != OT_ERROR_NONE && message != NULL)
+    {
+        message->Free();
+    }
+}
+
+otError CoapBase::SendBlock2Response(const ResourceBlockWise &aResource,
+                                     const Header &           aRequestHeader,
+                                     uint32_t                 aNum,
+                                     otCoapBlockSize          aSize,
+                                     const Ip6::MessageInfo & aMessageInfo)
+{
+    otError      error    = OT_ERROR_NONE;
+    uint32_t     position = aNum * Header::GetBlockSize(aSize);
+    Header::Code code =
+        (aRequestHeader.GetCode() == OT_COAP_CODE_GET) ? OT_COAP_CODE_CONTENT : OT_COAP_CODE_CHANGED;
+    Header   responseHeader;
+    Message *message = NULL;
+
+    // Serve smaller blocks than requested if needed, renumbered from the requested position.
+    aSize = ClampBlockSize(aSize);
+    aNum  = position / Header::GetBlockSize(aSize);
+
+    SuccessOrExit(error = InitResponseHeader(responseHeader, code, aRequestHeader));
+    VerifyOrExit((message = NewMessage(responseHeader)) != NULL, error = OT_ERROR_NO_BUFS);
+
+    if (WriteBlock(*message, responseHeader, OT_COAP_OPTION_BLOCK2, aNum, aSize, aResource.mContext,
+                   aResource.mTransmitHook) != OT_ERROR_NONE)
+    {
+        // The requested block does not exist (RFC 7959, section 2.2).
+        message->Free();
+        message = NULL;
+        ExitNow(error = SendHeaderResponse(OT_COAP_CODE_BAD_OPTION, aRequestHeader, aMessageInfo));
+    }
+
+    SuccessOrExit(error = SendMessage(*message, aMessageInfo));
+
+exit:
+
+    if (error != OT_ERROR_NONE && message != NULL)
+    {
+        message->Free();
+    }
+
+    return error;
+}
+
+otError CoapBase::SendResponseBlockWise(Message &                   aMessage,
+                                        const Ip6::MessageInfo &    aMessageInfo,
+                                        void *                      aContext,
+                                        otCoapBlockwiseTransmitHook aTransmitHook)
+{
+    otError error;
+    Header  header;
+
+    SuccessOrExit(error = header.FromMessage(aMessage, 0));
+    VerifyOrExit(header.IsResponse(), error = OT_ERROR_INVALID_ARGS);
+    SuccessOrExit(error = WriteFirstBlock(aMessage, header, OT_COAP_OPTION_BLOCK2, aContext, aTransmitHook));
+
+    error = SendMessage(aMessage, aMessageInfo);
+
+exit:
+    return error;
+}
+
+#endif // OPENTHREAD_CONFIG_ENABLE_COAP_BLOCKWISE_TRANSFER
+
+#if OPENTHREAD_CONFIG_ENABLE_COAP_OBSERVE
+
+CoapBase::Observer *CoapBase::FindObserver(const Header &aHeader, const Ip6::MessageInfo &aMessageInfo)
+{
+    Observer *observer = NULL;
+
+    for (uint8_t i = 0; i < kMaxObservers; i++)
+    {
+        Observer &cur = mObservers[i];
+
+        if (cur.mResource != NULL && cur.mPeerPort == aMessageInfo.GetPeerPort() &&
+            cur.mPeerAddr == aMessageInfo.GetPeerAddr() && cur.mTokenLength == aHeader.GetTokenLength() &&
+            memcmp(cur.mToken, aHeader.GetToken(), cur.mTokenLength) == 0)
+        {
+            observer = &cur;
+            break;
+        }
+    }
+
+    return observer;
+}
+
+void CoapBase::RemoveObserver(Observer &aObserver)
+{
+    // Stop retransmitting a pending confirmable notification.
+    AbortTransaction(&CoapBase::HandleNotificationResponse, &aObserver);
+    aObserver.mResource = NULL;
+}
+
+void CoapBase::RemoveObservers(const Resource *aResource)
+{
+    for (uint8_t i = 0; i < kMaxObservers; i++)
+    {
+        if (mObservers[i].mResource != NULL && (aResource == NULL || mObservers[i].mResource == aResource))
+        {
+            RemoveObserver(mObservers[i]);
+        }
+    }
+}
+
+void CoapBase::ProcessObserveRequest(const Resource &aResource, Header &aHeader, const Ip6::MessageInfo &aMessageInfo)
+{
+    Observer *observer = NULL;
+    uint32_t  observe;
+
+    VerifyOrExit(aHeader.GetCode() == OT_COAP_CODE_GET);
+    SuccessOrExit(aHeader.GetUintOption(OT_COAP_OPTION_OBSERVE, observe));
+
+    if (observe == kObserveDeregister)
+    {
+        if ((observer = FindObserver(aHeader, aMessageInfo)) != NULL)
+        {
+            RemoveObserver(*observer);
+        }
+
+        ExitNow();
+    }
+
+    VerifyOrExit(observe == kObserveRegister && !aMessageInfo.GetSockAddr().IsMulticast());
+
+    // A client has one registration per resource, a new request replaces its Token (RFC 7641, section 4.1).
+    for (uint8_t i = 0; i < kMaxObservers; i++)
+    {
+        Observer &cur = mObservers[i];
+
+        if (cur.mResource == &aResource && cur.mPeerPort == aMessageInfo.GetPeerPort() &&
+            cur.mPeerAddr == aMessageInfo.GetPeerAddr())
+        {
+            observer = &cur;
+            break;
+        }
+
+        if (cur.mResource == NULL && observer == NULL)
+        {
+            observer = &cur;
+        }
+    }
+
+    // Without a free entry, the request is served as a plain GET.
+    VerifyOrExit(observer != NULL);
+
+    observer->mResource    = &aResource;
+    observer->mPeerAddr    = aMessageInfo.GetPeerAddr();
+    observer->mSockAddr    = aMessageInfo.GetSockAddr();
+    observer->mPeerPort    = aMessageInfo.GetPeerPort();
+    observer->mMessageId   = 0;
+    observer->mTokenLength = aHeader.GetTokenLength();
+    memcpy(observer->mToken, aHeader.GetToken(), observer->mTokenLength);
+
+exit:
+    return;
+}
+
+void CoapBase::ProcessObserverReset(const Header &aHeader, const Ip6::MessageInfo &aMessageInfo)
+{
+    // A client rejecting a notification is no longer interested in the resource (RFC 7641, section 3.6).
+    for (uint8_t i = 0; i < kMaxObservers; i++)
+    {
+        Observer &cur = mObservers[i];
+
+        if (cur.mResource != NULL && cur.mMessageId == aHeader.GetMessageId() &&
+            cur.mPeerPort == aMessageInfo.GetPeerPort() && cur.mPeerAddr == aMessageInfo.GetPeerAddr())
+        {
+            RemoveObserver(cur);
+        }
+    }
+}
+
+otError CoapBase::SetObserveOption(Message &aMessage, Header &aHeader)
+{
+    otError  error;
+    uint16_t headerLength = aHeader.GetLength();
+
+    SuccessOrExit(error = aHeader.SetUintOption(OT_COAP_OPTION_OBSERVE, mObserveSequence));
+
+    if (headerLength < aMessage.GetLength())
+    {
+        SuccessOrExit(error = aHeader.SetPayloadMarker());
+    }
+
+    // Replace the header in front of the payload.
+    SuccessOrExit(error = aMessage.RemoveHeader(headerLength));
+    error = aMessage.Prepend(aHeader.GetBytes(), aHeader.GetLength());
+
+exit:
+    return error;
+}
+
+otError CoapBase::NotifyObservers(const Resource &aResource, Message &aMessage)
+{
+    otError error;
+    Header  header;
+
+    SuccessOrExit(error = header.FromMessage(aMessage, 0));
+    VerifyOrExit(header.IsResponse() && (header.IsConfirmable() || header.IsNonConfirmable()),
+                 error = OT_ERROR_INVALID_ARGS);
+
+    mObserveSequence = (mObserveSequence + 1) & kObserveSequenceMask;
+
+    for (uint8_t i = 0; i < kMaxObservers; i++)
+    {
+        if (mObservers[i].mResource == &aResource)
+        {
+            SuccessOrExit(error = SendNotification(mObservers[i], header, aMessage));
+        }
+    }
+
+    aMessage.Free();
+
+exit:
+    return error;
+}
+
+otError CoapBase::SendNotification(Observer &aObserver, Header &aHeader, const Message &aMessage)
+{
+    otError          error         = OT_ERROR_NONE;
+    uint16_t         payloadLength = aMessage.GetLength() - aHeader.GetLength();
+    Message *        message       = NULL;
+    Header           header;
+    Ip6::MessageInfo messageInfo;
+
+    SuccessOrExit(error = header.InitWithToken(aHeader, aObserver.mToken, aObserver.mTokenLength));
+    header.SetMessageId(mMessageId++);
+    SuccessOrExit(error = header.SetUintOption(OT_COAP_OPTION_OBSERVE, mObserveSequence));
+
+    if (payloadLength > 0)
+    {
+        SuccessOrExit(error = header.SetPayloadMarker());
+    }
+
+    VerifyOrExit((message = NewMessage(header)) != NULL, error = OT_ERROR_NO_BUFS);
+    message->SetLinkSecurityEnabled(aMessage.IsLinkSecurityEnabled());
+    SuccessOrExit(error = message->SetPriority(aMessage.GetPriority()));
+    SuccessOrExit(error = message->SetLength(header.GetLength() + payloadLength));
+    aMessage.CopyTo(aHeader.GetLength(), header.GetLength(), payloadLength, *message);
+
+    messageInfo.SetPeerAddr(aObserver.mPeerAddr);
+    messageInfo.SetPeerPort(aObserver.mPeerPort);
+    messageInfo.SetSockAddr(aObserver.mSockAddr);
+    messageInfo.SetInterfaceId(GetNetif().GetInterfaceId());
+
+    aObserver.mMessageId = header.GetMessageId();
+
+    if (header.IsConfirmable())
+    {
+        // A newer notification supersedes one still being retransmitted (RFC 7641, section 4.5.2).
+        AbortTransaction(&CoapBase::HandleNotificationResponse, &aObserver);
+        SuccessOrExit(error = SendMessage(*message, messageInfo, &CoapBase::HandleNotificationResponse, &aObserver));
+    }
+    else
+    {
+        SuccessOrExit(error = SendMessage(*message, messageInfo));
+    }
+
+exit:
+
+    if (error != OT_ERROR_NONE && message != NULL)
+    {
+        message->Free();
+    }
+
+    return error;
+}
+
+void CoapBase::HandleNotificationResponse(void *               aContext,
+                                          otCoapHeader *       aHeader,
+                                          otMessage *          aMessage,
+                                          const otMessageInfo *aMessageInfo,
+                                          otError              aResult)
+{
+    OT_UNUSED_VARIABLE(aHeader);
+    OT_UNUSED_VARIABLE(aMessage);
+    OT_UNUSED_VARIABLE(aMessageInfo);
+
+    // An observer which does not acknowledge a confirmable notification is removed (RFC 7641, section 4.5).
+    if (aResult == OT_ERROR_RESPONSE_TIMEOUT)
+    {
+        static_cast<Observer *>(aContext)->mResource = NULL;
+    }
+}
+
+bool CoapBase::ProcessNotification(Message &               aRequest,
+                                   CoapMetadata &          aCoapMetadata,
+                                   Header &                aResponseHeader,
+                                   Message &               aResponse,
+                                   const Ip6::MessageInfo &aMessageInfo)
+{
+    bool     processed = false;
+    uint32_t now       = TimerMilli::GetNow();
+    uint32_t sequence;
+
+    VerifyOrExit(aCoapMetadata.mObserve && aResponseHeader.GetCode() < OT_COAP_CODE_BAD_REQUEST);
+    SuccessOrExit(aResponseHeader.GetUintOption(OT_COAP_OPTION_OBSERVE, sequence));
+
+    processed = true;
+
+    // Notifications may be reordered on the way, an older one is dropped (RFC 7641, section 3.4).
+    VerifyOrExit(!aCoapMetadata.mObserving || aCoapMetadata.IsFreshNotification(sequence, now));
+
+    // The request stays pending to match the following notifications.
+    aCoapMetadata.mAcknowledged    = true;
+    aCoapMetadata.mObserving       = true;
+    aCoapMetadata.mObserveSequence = sequence;
+    aCoapMetadata.mObserveTime     = now;
+    aCoapMetadata.UpdateIn(aRequest);
+
+    aCoapMetadata.mResponseHandler(aCoapMetadata.mResponseContext, &aResponseHeader, &aResponse, &aMessageInfo,
+                                   OT_ERROR_NONE);
+
+#if OPENTHREAD_CONFIG_ENABLE_COAP_REQUEST_WINDOW
+    SendDeferredRequests();
+#endif
+
+exit:
+    return processed;
+}
+
+otError CoapBase::CancelObserve(otCoapResponseHandler aHandler, void *aContext)
+{
+    otError          error = OT_ERROR_NONE;
+    Message *        message;
+    Message *        request = NULL;
+    CoapMetadata     coapMetadata;
+    Header           header;
+    Ip6::MessageInfo messageInfo;
+
+    for (message = mPendingRequests.GetHead(); message != NULL; message = message->GetNext())
+    {
+        coapMetadata.ReadFrom(*message);
+
+        if (coapMetadata.mObserve && coapMetadata.mResponseHandler == aHandler &&
+            coapMetadata.mResponseContext == aContext)
+        {
+            break;
         }
+    }
+
+    VerifyOrExit(message != NULL, error = OT_ERROR_NOT_FOUND);
+
+    // Deregister with the Token of the observation and a new Message ID (RFC 7641, section 3.6).
+    SuccessOrExit(error = header.FromMessage(*message, sizeof(CoapMetadata)));
+    SuccessOrExit(error = header.SetUintOption(OT_COAP_OPTION_OBSERVE, kObserveDeregister));
+    header.SetMessageId(0);
+
+    VerifyOrExit((request = NewMessage(header)) != NULL, error = OT_ERROR_NO_BUFS);
+    request->SetLinkSecurityEnabled(message->IsLinkSecurityEnabled());
+    SuccessOrExit(error = request->SetPriority(message->GetPriority()));
+
+    messageInfo.SetPeerAddr(coapMetadata.mDestinationAddress);
+    messageInfo.SetPeerPort(coapMetadata.mDestinationPort);
+    messageInfo.SetSockAddr(coapMetadata.mSourceAddress);
+    messageInfo.SetInterfaceId(GetNetif().GetInterfaceId());
+
+    // End the observation first so that the response is not taken for a notification.
+    FinalizeCoapTransaction(*message, coapMetadata, NULL, NULL, NULL, OT_ERROR_ABORT);
+
+    SuccessOrExit(error = SendMessage(*request, messageInfo));
+
+exit:
+
+    if (error != OT_ERROR_NONE && request != NULL)
+    {
+        request->Free();
+    }
+
+    return error;
+}
+
+#endif // OPENTHREAD_CONFIG_ENABLE_COAP_OBSERVE
+
+CoapMetadata::CoapMetadata(bool                    aConfirmable,
+                           const Ip6::MessageInfo &aMessageInfo,
+                           otCoapResponseHandler   aHandler,
+                           void *                  aContext)
+{
+    mSourceAddress         = aMessageInfo.GetSockAddr();
+    mDestinationPort       = aMessageInfo.GetPeerPort();
+    mDestinationAddress    = aMessageInfo.GetPeerAddr();
+    mResponseHandler       = aHandler;
+    mResponseContext       = aContext;
+    mRetransmissionCount   = 0;
+    mRetransmissionTimeout = TimerMilli::SecToMsec(kAckTimeout);
+    mRetransmissionTimeout += Random::GetUint32InRange(
+        0, TimerMilli::SecToMsec(kAckTimeout) * kAckRandomFactorNumerator / kAckRandomFactorDenominator -
+               TimerMilli::SecToMsec(kAckTimeout) + 1);
+
+    if (aConfirmable)
+    {
+        // Set next retransmission timeout.
+        mNextTimerShot = TimerMilli::GetNow() + mRetransmissionTimeout;
+    }
+    else
+    {
+        // Set overall response timeout.
+        mNextTimerShot = TimerMilli::GetNow() + kMaxTransmitWait;
+    }
+
+    mAcknowledged = false;
+    mConfirmable  = aConfirmable;
+#if OPENTHREAD_CONFIG_ENABLE_COAP_BLOCKWISE_TRANSFER
+    mBlockwiseTransmitHook = NULL;
+    mBlockwiseReceiveHook  = NULL;
+#endif
+#if OPENTHREAD_CONFIG_ENABLE_COAP_OBSERVE
+    mObserveSequence = 0;
+    mObserveTime     = 0;
+    mObserve         = false;
+    mObserving       = false;
+#endif
+#if OPENTHREAD_CONFIG_ENABLE_COAP_ADAPTIVE_RTO
+    mTransmitTime  = TimerMilli::GetNow();
+    mBackoffFactor = RtoEstimator::GetBackoffFactor(TimerMilli::SecToMsec(kAckTimeout));
+#endif
+}
+
+#if OPENTHREAD_CONFIG_ENABLE_COAP_OBSERVE
+bool CoapMetadata::IsFreshNotification(uint32_t aSequence, uint32_t aTime) const
+{
+    return (mObserveSequence < aSequence && aSequence - mObserveSequence < kObserveFreshnessWindow) ||
+           (mObserveSequence > aSequence && mObserveSequence - aSequence > kObserveFreshnessWindow) ||
+           (aTime - mObserveTime > TimerMilli::SecToMsec(kObserveFreshnessTime));
+}
+#endif
+
+#if OPENTHREAD_CONFIG_ENABLE_COAP_ADAPTIVE_RTO
+void CoapMetadata::SetInitialTimeout(uint32_t aRto)
+{
+    mRetransmissionTimeout =
+        aRto + Random::GetUint32InRange(0, aRto * kAckRandomFactorNumerator / kAckRandomFactorDenominator - aRto + 1);
+    mTransmitTime  = TimerMilli::GetNow();
+    mNextTimerShot = mTransmitTime + mRetransmissionTimeout;
+    mBackoffFactor = RtoEstimator::GetBackoffFactor(aRto);
+}
+#endif
+
+ResponsesQueue::ResponsesQueue(Instance &aInstance, Timer::Handler aHandler, void *aContext)
+    : mQueue()
+    , mTimer(aInstance, aHandler, aContext)
+    , mFreeEntry(0)
+{
+    for (uint8_t i = 0; i < kMaxCachedResponses; i++)
+    {
+        mEntries[i].mMessage = NULL;
+        mEntries[i].mNext    = static_cast<uint8_t>((i + 1 < kMaxCachedResponses) ? (i + 1) : kInvalidIndex);
+    }
+
+    memset(mBuckets, kInvalidIndex, sizeof(mBuckets));
+    memset(&mCounters, 0, sizeof(mCounters));
+}
+
+uint16_t ResponsesQueue::GetResponseHash(uint16_t aMessageId, const Ip6::MessageInfo &aMessageInfo)
+{
+    const uint8_t *peerAddr = aMessageInfo.GetPeerAddr().mFields.m8;
+    uint16_t       hash     = aMessageId ^ aMessageInfo.GetPeerPort();
+
+    for (uint8_t i = 0; i < sizeof(aMessageInfo.GetPeerAddr().mFields.m8); i++)
+    {
+        hash = static_cast<uint16_t>(hash * 31 + peerAddr[i]);
+    }
+
+    return hash;
+}
+
+Message *ResponsesQueue::FindMatchedResponse(uint16_t aMessageId, const Ip6::MessageInfo &aMessageInfo)
+{
+    uint16_t               hash     = GetResponseHash(aMessageId, aMessageInfo);
+    Message *              response = NULL;
+    EnqueuedResponseHeader enqueuedResponseHeader;
 
-        if (header.GetMessageId() != aHeader.GetMessageId())
+    for (uint8_t index = GetBucket(hash); index != kInvalidIndex; index = mEntries[index].mNext)
+    {
+        const CacheEntry &entry = mEntries[index];
+
+        if (entry.mHash != hash || entry.mMessageId != aMessageId)
         {
             continue;
         }
 
-        *aResponse = message->Clone();
-        VerifyOrExit(*aResponse != NULL, error = OT_ERROR_NO_BUFS);
+        // Check source endpoint
+        enqueuedResponseHeader.ReadFrom(*entry.mMessage);
 
-        EnqueuedResponseHeader::RemoveFrom(**aResponse);
+        if (enqueuedResponseHeader.GetMessageInfo().GetPeerPort() != aMessageInfo.GetPeerPort() ||
+            enqueuedResponseHeader.GetMessageInfo().GetPeerAddr() != aMessageInfo.GetPeerAddr())
+        {
+            continue;
+        }
 
-        error = OT_ERROR_NONE;
+        response = entry.mMessage;
         break;
     }
 
+    return response;
+}
+
+void ResponsesQueue::FreeEntry(uint8_t aIndex)
+{
+    mEntries[aIndex].mMessage = NULL;
+    mEntries[aIndex].mNext    = mFreeEntry;
+    mFreeEntry                = aIndex;
+}
+
+otError ResponsesQueue::GetMatchedResponseCopy(const Header &          aHeader,
+                                               const Ip6::MessageInfo &aMessageInfo,
+                                               Message **              aResponse)
+{
+    otError  error = OT_ERROR_NONE;
+    Message *message;
+
+    VerifyOrExit((message = FindMatchedResponse(aHeader.GetMessageId(), aMessageInfo)) != NULL,
+                 error = OT_ERROR_NOT_FOUND);
+
+    mCounters.mHits++;
+
+    *aResponse = message->Clone();
+    VerifyOrExit(*aResponse != NULL, error = OT_ERROR_NO_BUFS);
+
+    EnqueuedResponseHeader::RemoveFrom(**aResponse);
+
 exit:
     return error;
 }
@@ -832,25 +1972,13 @@ void ResponsesQueue::EnqueueResponse(Message &aMessage, const Ip6::MessageInfo &
     Header                 header;
     Message *              copy;
     EnqueuedResponseHeader enqueuedResponseHeader(aMessageInfo);
+    uint8_t                index = kInvalidIndex;
+    uint16_t               hash;
     uint16_t               messageCount;
     uint16_t               bufferCount;
 
     SuccessOrExit(header.FromMessage(aMessage, 0));
-
-    switch (GetMatchedResponseCopy(aMessage, aMessageInfo, &copy))
-    {
-    case OT_ERROR_NOT_FOUND:
-        break;
-
-    case OT_ERROR_NONE:
-        copy->Free();
-
-        // fall through
-
-    case OT_ERROR_NO_BUFS:
-    default:
-        ExitNow();
-    }
+    VerifyOrExit(FindMatchedResponse(header.GetMessageId(), aMessageInfo) == NULL);
 
     mQueue.GetInfo(messageCount, bufferCount);
 
@@ -859,10 +1987,39 @@ void ResponsesQueue::EnqueueResponse(Message &aMessage, const Ip6::MessageInfo &
         DequeueOldestResponse();
     }
 
+    // Every cached response holds one entry, so an entry is free once the cache is below its limit.
+    index = mFreeEntry;
+    assert(index != kInvalidIndex);
+    mFreeEntry = mEntries[index].mNext;
+
     copy = aMessage.Clone();
     VerifyOrExit(copy != NULL);
 
+    enqueuedResponseHeader.SetEntryIndex(index);
     enqueuedResponseHeader.AppendTo(*copy);
+
+    // Drop the oldest cached responses as needed to keep the cache within its buffer quota.
+    while (copy->SetBufferClass(Message::kBufferClassCoapCache) != OT_ERROR_NONE)
+    {
+        if (mQueue.GetHead() == NULL)
+        {
+            copy->Free();
+            ExitNow();
+        }
+
+        DequeueOldestResponse();
+    }
+
+    hash = GetResponseHash(header.GetMessageId(), aMessageInfo);
+
+    mEntries[index].mMessage   = copy;
+    mEntries[index].mHash      = hash;
+    mEntries[index].mMessageId = header.GetMessageId();
+    mEntries[index].mNext      = GetBucket(hash);
+
+    GetBucket(hash) = index;
+    index           = kInvalidIndex;
+
     mQueue.Enqueue(*copy);
 
     if (!mTimer.IsRunning())
@@ -871,7 +2028,11 @@ void ResponsesQueue::EnqueueResponse(Message &aMessage, const Ip6::MessageInfo &
     }
 
 exit:
-    return;
+
+    if (index != kInvalidIndex)
+    {
+        FreeEntry(index);
+    }
 }
 
 void ResponsesQueue::DequeueOldestResponse(void)
@@ -880,11 +2041,36 @@ void ResponsesQueue::DequeueOldestResponse(void)
 
     VerifyOrExit((message = mQueue.GetHead()) != NULL);
     DequeueResponse(*message);
+    mCounters.mEvictions++;
 
 exit:
     return;
 }
 
+void ResponsesQueue::DequeueResponse(Message &aMessage)
+{
+    EnqueuedResponseHeader enqueuedResponseHeader;
+    uint8_t                index;
+    uint8_t *              link;
+
+    enqueuedResponseHeader.ReadFrom(aMessage);
+    index = enqueuedResponseHeader.GetEntryIndex();
+
+    for (link = &GetBucket(mEntries[index].mHash); *link != kInvalidIndex; link = &mEntries[*link].mNext)
+    {
+        if (*link == index)
+        {
+            *link = mEntries[index].mNext;
+            break;
+        }
+    }
+
+    FreeEntry(index);
+
+    mQueue.Dequeue(aMessage);
+    aMessage.Free();
+}
+
 void ResponsesQueue::DequeueAllResponses(void)
 {
     Message *message;
@@ -923,6 +2109,147 @@ uint32_t EnqueuedResponseHeader::GetRemainingTime(void) const
     return remainingTime >= 0 ? static_cast<uint32_t>(remainingTime) : 0;
 }
 
+#if OPENTHREAD_CONFIG_ENABLE_COAP_ADAPTIVE_RTO
+
+RtoEstimator::RtoEstimator(void)
+{
+    for (uint8_t i = 0; i < kNumEntries; i++)
+    {
+        mEntries[i].mInUse = false;
+    }
+}
+
+RtoEstimator::Entry *RtoEstimator::FindEntry(const Ip6::Address &aAddress)
+{
+    Entry *entry = NULL;
+
+    for (uint8_t i = 0; i < kNumEntries; i++)
+    {
+        if (mEntries[i].mInUse && mEntries[i].mAddress == aAddress)
+        {
+            entry = &mEntries[i];
+            break;
+        }
+    }
+
+    return entry;
+}
+
+uint32_t RtoEstimator::GetRto(const Ip6::Address &aAddress)
+{
+    uint32_t now = TimerMilli::GetNow();
+    uint32_t rto = kInitialRto;
+    Entry *  entry;
+
+    VerifyOrExit((entry = FindEntry(aAddress)) != NULL);
+
+    // Age a timeout which was not updated for a while (CoCoA, section 4.2.3).
+    if (entry->mRto < kSmallRto && now - entry->mUpdateTime > kSmallRtoAgingFactor * entry->mRto)
+    {
+        entry->mRto *= 2;
+        entry->mUpdateTime = now;
+    }
+    else if (entry->mRto > kLargeRto && now - entry->mUpdateTime > kLargeRtoAgingFactor * entry->mRto)
+    {
+        entry->mRto        = kSmallRto + entry->mRto / 2;
+        entry->mUpdateTime = now;
+    }
+
+    rto = entry->mRto;
+
+exit:
+    return rto;
+}
+
+void RtoEstimator::UpdateRtt(const Ip6::Address &aAddress, uint32_t aRtt, uint8_t aRetransmissionCount)
+{
+    uint32_t now = TimerMilli::GetNow();
+    uint32_t estimate;
+    Entry *  entry;
+
+    VerifyOrExit(!aAddress.IsMulticast() && aRetransmissionCount <= kWeakMaxRetransmit);
+
+    if ((entry = FindEntry(aAddress)) == NULL)
+    {
+        // Replace an unused or the least recently updated entry.
+        entry = &mEntries[0];
+
+        for (uint8_t i = 1; i < kNumEntries && entry->mInUse; i++)
+        {
+            if (!mEntries[i].mInUse || now - mEntries[i].mUpdateTime > now - entry->mUpdateTime)
+            {
+                entry = &mEntries[i];
+            }
+        }
+
+        entry->mAddress      = aAddress;
+        entry->mRto          = kInitialRto;
+        entry->mStrongSrtt   = 0;
+        entry->mStrongRttVar = 0;
+        entry->mWeakSrtt     = 0;
+        entry->mWeakRttVar   = 0;
+        entry->mInUse        = true;
+    }
+
+    if (aRetransmissionCount == 0)
+    {
+        estimate    = UpdateEstimator(entry->mStrongSrtt, entry->mStrongRttVar, aRtt, kStrongRttVarFactor);
+        entry->mRto = (estimate + entry->mRto) / 2;
+    }
+    else
+    {
+        // The response may belong to any transmission, so the weak estimate weighs less (CoCoA, section 4.2.1).
+        estimate    = UpdateEstimator(entry->mWeakSrtt, entry->mWeakRttVar, aRtt, kWeakRttVarFactor);
+        entry->mRto = (estimate + 3 * entry->mRto) / 4;
+    }
+
+    entry->mUpdateTime = now;
+
+exit:
+    return;
+}
+
+uint32_t RtoEstimator::UpdateEstimator(uint32_t &aSrtt, uint32_t &aRttVar, uint32_t aRtt, uint8_t aRttVarFactor)
+{
+    uint32_t estimate;
+
+    // Smoothed round-trip time and variation as in RFC 6298.
+    if (aSrtt == 0)
+    {
+        aSrtt   = aRtt;
+        aRttVar = aRtt / 2;
+    }
+    else
+    {
+        aRttVar = (3 * aRttVar + (aSrtt > aRtt ? aSrtt - aRtt : aRtt - aSrtt)) / 4;
+        aSrtt   = (7 * aSrtt + aRtt) / 8;
+    }
+
+    // The variation term is at least the clock granularity of one millisecond.
+    estimate = aSrtt + ((aRttVar > 0) ? aRttVarFactor * aRttVar : 1);
+
+    return (estimate < kMaxRto) ? estimate : static_cast<uint32_t>(kMaxRto);
+}
+
+uint8_t RtoEstimator::GetBackoffFactor(uint32_t aRto)
+{
+    uint8_t factor = kDefaultBackoff;
+
+    // Back off faster from small timeouts and slower from large ones (CoCoA, section 4.2.2).
+    if (aRto < kSmallRto)
+    {
+        factor = kSmallRtoBackoff;
+    }
+    else if (aRto > kLargeRto)
+    {
+        factor = kLargeRtoBackoff;
+    }
+
+    return factor;
+}
+
+#endif // OPENTHREAD_CONFIG_ENABLE_COAP_ADAPTIVE_RTO
+
 Coap::Coap(Instance &aInstance)
     : CoapBase(aInstance, &Coap::HandleRetransmissionTimer, &Coap::HandleResponsesQueueTimer)
 {
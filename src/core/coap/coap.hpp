@@ -68,7 +68,7 @@ enum
     kAckRandomFactorNumerator   = OPENTHREAD_CONFIG_COAP_ACK_RANDOM_FACTOR_NUMERATOR,
     kAckRandomFactorDenominator = OPENTHREAD_CONFIG_COAP_ACK_RANDOM_FACTOR_DENOMINATOR,
     kMaxRetransmit              = OPENTHREAD_CONFIG_COAP_MAX_RETRANSMIT,
-    kNStart                     = 1,
+    kNStart                     = OPENTHREAD_CONFIG_COAP_NSTART,
     kDefaultLeisure             = 5,
     kProbingRate                = 1,
 
@@ -106,7 +106,23 @@ public:
         , mRetransmissionTimeout(0)
         , mRetransmissionCount(0)
         , mAcknowledged(false)
-        , mConfirmable(false){};
+        , mConfirmable(false)
+#if OPENTHREAD_CONFIG_ENABLE_COAP_BLOCKWISE_TRANSFER
+        , mBlockwiseTransmitHook(NULL)
+        , mBlockwiseReceiveHook(NULL)
+#endif
+#if OPENTHREAD_CONFIG_ENABLE_COAP_OBSERVE
+        , mObserveSequence(0)
+        , mObserveTime(0)
+        , mObserve(false)
+        , mObserving(false)
+#endif
+#if OPENTHREAD_CONFIG_ENABLE_COAP_ADAPTIVE_RTO
+        , mTransmitTime(0)
+        , mBackoffFactor(0)
+#endif
+    {
+    }
 
     /**
      * This constructor initializes the object with specific values.
@@ -179,7 +195,41 @@ public:
      */
     bool IsLater(uint32_t aTime) const { return (static_cast<int32_t>(aTime - mNextTimerShot) < 0); };
 
+#if OPENTHREAD_CONFIG_ENABLE_COAP_OBSERVE
+    /**
+     * This method checks if a notification is newer than the latest one received (RFC 7641, section 3.4).
+     *
+     * @param[in]  aSequence  The Observe option value of the notification.
+     * @param[in]  aTime      The time when the notification was received.
+     *
+     * @retval TRUE   If the notification is newer.
+     * @retval FALSE  If the notification is older and must be dropped.
+     *
+     */
+    bool IsFreshNotification(uint32_t aSequence, uint32_t aTime) const;
+#endif
+
+#if OPENTHREAD_CONFIG_ENABLE_COAP_ADAPTIVE_RTO
+    /**
+     * This method sets the initial retransmission timeout of a confirmable message.
+     *
+     * The timeout is randomized like the default one, and the backoff factor is chosen for @p aRto.
+     *
+     * @param[in]  aRto  The retransmission timeout estimated for the destination in milliseconds.
+     *
+     */
+    void SetInitialTimeout(uint32_t aRto);
+#endif
+
 private:
+#if OPENTHREAD_CONFIG_ENABLE_COAP_OBSERVE
+    enum
+    {
+        kObserveFreshnessWindow = 1 << 23, ///< Range of newer Observe option values (RFC 7641).
+        kObserveFreshnessTime   = 128,     ///< Time in seconds after which a notification is newer (RFC 7641).
+    };
+
+#endif
     Ip6::Address          mSourceAddress;         ///< IPv6 address of the message source.
     Ip6::Address          mDestinationAddress;    ///< IPv6 address of the message destination.
     uint16_t              mDestinationPort;       ///< UDP port of the message destination.
@@ -190,6 +240,20 @@ private:
     uint8_t               mRetransmissionCount;   ///< Number of retransmissions.
     bool                  mAcknowledged : 1;      ///< Information that request was acknowledged.
     bool                  mConfirmable : 1;       ///< Information that message is confirmable.
+#if OPENTHREAD_CONFIG_ENABLE_COAP_BLOCKWISE_TRANSFER
+    otCoapBlockwiseTransmitHook mBlockwiseTransmitHook; ///< A function pointer that is called to produce Block1.
+    otCoapBlockwiseReceiveHook  mBlockwiseReceiveHook;  ///< A function pointer that is called to consume Block2.
+#endif
+#if OPENTHREAD_CONFIG_ENABLE_COAP_OBSERVE
+    uint32_t mObserveSequence; ///< Observe option value of the latest notification.
+    uint32_t mObserveTime;     ///< Time when the latest notification was received.
+    bool     mObserve : 1;     ///< Information that the request registers as an observer.
+    bool     mObserving : 1;   ///< Information that notifications are being received.
+#endif
+#if OPENTHREAD_CONFIG_ENABLE_COAP_ADAPTIVE_RTO
+    uint32_t mTransmitTime;  ///< Time of the first transmission.
+    uint8_t  mBackoffFactor; ///< Backoff factor in units of 1 / `RtoEstimator::kBackoffDenominator`.
+#endif
 } OT_TOOL_PACKED_END;
 
 /**
@@ -244,6 +308,65 @@ private:
     }
 };
 
+#if OPENTHREAD_CONFIG_ENABLE_COAP_BLOCKWISE_TRANSFER
+
+/**
+ * This class implements CoAP block-wise resource handling.
+ *
+ */
+class ResourceBlockWise : public otCoapBlockwiseResource
+{
+    friend class CoapBase;
+
+public:
+    /**
+     * This constructor initializes the resource.
+     *
+     * @param[in]  aUriPath       A pointer to a NULL-terminated string for the Uri-Path.
+     * @param[in]  aHandler       A function pointer that is called when receiving a CoAP message for @p aUriPath.
+     * @param[in]  aReceiveHook   A function pointer that is called to consume received Block1 blocks, or NULL.
+     * @param[in]  aTransmitHook  A function pointer that is called to produce Block2 blocks, or NULL.
+     * @param[in]  aContext       A pointer to arbitrary context information.
+     */
+    ResourceBlockWise(const char *                aUriPath,
+                      otCoapRequestHandler        aHandler,
+                      otCoapBlockwiseReceiveHook  aReceiveHook,
+                      otCoapBlockwiseTransmitHook aTransmitHook,
+                      void *                      aContext)
+    {
+        mUriPath      = aUriPath;
+        mHandler      = aHandler;
+        mReceiveHook  = aReceiveHook;
+        mTransmitHook = aTransmitHook;
+        mContext      = aContext;
+        mNext         = NULL;
+    }
+
+    /**
+     * This method returns a pointer to the next resource.
+     *
+     * @returns A Pointer to the next resource.
+     *
+     */
+    ResourceBlockWise *GetNext(void) const { return static_cast<ResourceBlockWise *>(mNext); };
+
+    /**
+     * This method returns a pointer to the Uri-Path.
+     *
+     * @returns A Pointer to the Uri-Path.
+     *
+     */
+    const char *GetUriPath(void) const { return mUriPath; };
+
+private:
+    void HandleRequest(Header &aHeader, Message &aMessage, const Ip6::MessageInfo &aMessageInfo) const
+    {
+        mHandler(mContext, &aHeader, &aMessage, &aMessageInfo);
+    }
+};
+
+#endif // OPENTHREAD_CONFIG_ENABLE_COAP_BLOCKWISE_TRANSFER
+
 /**
  * This class implements metadata required for caching CoAP responses.
  *
@@ -257,6 +380,7 @@ public:
      */
     EnqueuedResponseHeader(void)
         : mDequeueTime(0)
+        , mEntryIndex(0)
         , mMessageInfo()
     {
     }
@@ -269,6 +393,7 @@ public:
      */
     EnqueuedResponseHeader(const Ip6::MessageInfo &aMessageInfo)
         : mDequeueTime(TimerMilli::GetNow() + TimerMilli::SecToMsec(kExchangeLifetime))
+        , mEntryIndex(0)
         , mMessageInfo(aMessageInfo)
     {
     }
@@ -336,8 +461,25 @@ public:
      */
     const Ip6::MessageInfo &GetMessageInfo(void) const { return mMessageInfo; }
 
+    /**
+     * This method returns the index of the response cache entry indexing the cached CoAP response.
+     *
+     * @returns  The index of the response cache entry.
+     *
+     */
+    uint8_t GetEntryIndex(void) const { return mEntryIndex; }
+
+    /**
+     * This method sets the index of the response cache entry indexing the cached CoAP response.
+     *
+     * @param[in]  aEntryIndex  The index of the response cache entry.
+     *
+     */
+    void SetEntryIndex(uint8_t aEntryIndex) { mEntryIndex = aEntryIndex; }
+
 private:
     uint32_t               mDequeueTime;
+    uint8_t                mEntryIndex;
     const Ip6::MessageInfo mMessageInfo;
 };
 
@@ -420,6 +562,14 @@ public:
      */
     const MessageQueue &GetResponses(void) const { return mQueue; }
 
+    /**
+     * This method returns the response cache counters.
+     *
+     * @returns A reference to the response cache counters.
+     *
+     */
+    const otCoapResponseCacheCounters &GetCounters(void) const { return mCounters; }
+
     /**
      * Callback handler for timer.
      *
@@ -433,17 +583,129 @@ private:
     enum
     {
         kMaxCachedResponses = OPENTHREAD_CONFIG_COAP_SERVER_MAX_CACHED_RESPONSES,
+        kInvalidIndex       = 0xff,
     };
 
-    void DequeueResponse(Message &aMessage)
+    /**
+     * This structure indexes a cached CoAP response by Message ID and peer endpoint.
+     *
+     */
+    struct CacheEntry
     {
-        mQueue.Dequeue(aMessage);
-        aMessage.Free();
-    }
+        Message *mMessage;
+        uint16_t mHash;
+        uint16_t mMessageId;
+        uint8_t  mNext;
+    };
+
+    static uint16_t GetResponseHash(uint16_t aMessageId, const Ip6::MessageInfo &aMessageInfo);
+    uint8_t &       GetBucket(uint16_t aHash) { return mBuckets[aHash % kMaxCachedResponses]; }
+    Message *       FindMatchedResponse(uint16_t aMessageId, const Ip6::MessageInfo &aMessageInfo);
+    void            FreeEntry(uint8_t aIndex);
+    void            DequeueResponse(Message &aMessage);
+
+    MessageQueue                mQueue;
+    TimerMilli                  mTimer;
+    CacheEntry                  mEntries[kMaxCachedResponses];
+    uint8_t                     mBuckets[kMaxCachedResponses];
+    uint8_t                     mFreeEntry;
+    otCoapResponseCacheCounters mCounters;
+};
+
+#if OPENTHREAD_CONFIG_ENABLE_COAP_ADAPTIVE_RTO
+/**
+ * This class estimates CoAP retransmission timeouts per destination (CoCoA, draft-ietf-core-cocoa).
+ *
+ */
+class RtoEstimator
+{
+public:
+    enum
+    {
+        kBackoffDenominator = 2, ///< Denominator of the backoff factors returned by `GetBackoffFactor()`.
+    };
+
+    /**
+     * Default class constructor.
+     *
+     */
+    RtoEstimator(void);
+
+    /**
+     * This method returns the current retransmission timeout for a destination.
+     *
+     * A timeout that was not updated for a while is aged towards the initial one.
+     *
+     * @param[in]  aAddress  A reference to the destination address.
+     *
+     * @returns The retransmission timeout in milliseconds.
+     *
+     */
+    uint32_t GetRto(const Ip6::Address &aAddress);
+
+    /**
+     * This method updates the estimates of a destination with a measured round-trip time.
+     *
+     * Exchanges without retransmission update the strong estimator, exchanges with one or two retransmissions the
+     * weak estimator (measured from the first transmission). Other exchanges are ignored.
+     *
+     * @param[in]  aAddress              A reference to the destination address.
+     * @param[in]  aRtt                  The round-trip time in milliseconds.
+     * @param[in]  aRetransmissionCount  The number of retransmissions of the exchange.
+     *
+     */
+    void UpdateRtt(const Ip6::Address &aAddress, uint32_t aRtt, uint8_t aRetransmissionCount);
+
+    /**
+     * This static method returns the variable backoff factor for an initial retransmission timeout.
+     *
+     * @param[in]  aRto  The initial retransmission timeout in milliseconds.
+     *
+     * @returns The backoff factor, in units of 1 / `kBackoffDenominator`.
+     *
+     */
+    static uint8_t GetBackoffFactor(uint32_t aRto);
+
+private:
+    enum
+    {
+        kNumEntries           = OPENTHREAD_CONFIG_COAP_RTO_ESTIMATOR_ENTRIES,
+        kInitialRto           = kAckTimeout * 1000,
+        kMaxRto               = 60000,
+        kSmallRto             = 1000,
+        kLargeRto             = 3000,
+        kWeakMaxRetransmit    = 2,
+        kStrongRttVarFactor   = 4,
+        kWeakRttVarFactor     = 1,
+        kSmallRtoAgingFactor  = 16,
+        kLargeRtoAgingFactor  = 4,
+        kSmallRtoBackoff      = 6,
+        kDefaultBackoff       = 4,
+        kLargeRtoBackoff      = 3,
+    };
+
+    /**
+     * This structure holds the estimates of one destination, times are in milliseconds.
+     *
+     */
+    struct Entry
+    {
+        Ip6::Address mAddress;
+        uint32_t     mRto;          ///< The overall retransmission timeout.
+        uint32_t     mUpdateTime;   ///< The time of the latest update of `mRto`.
+        uint32_t     mStrongSrtt;   ///< Zero until the first strong measurement.
+        uint32_t     mStrongRttVar;
+        uint32_t     mWeakSrtt; ///< Zero until the first weak measurement.
+        uint32_t     mWeakRttVar;
+        bool         mInUse;
+    };
 
-    MessageQueue mQueue;
-    TimerMilli   mTimer;
+    Entry *         FindEntry(const Ip6::Address &aAddress);
+    static uint32_t UpdateEstimator(uint32_t &aSrtt, uint32_t &aRttVar, uint32_t aRtt, uint8_t aRttVarFactor);
+
+    Entry mEntries[kNumEntries];
 };
+#endif // OPENTHREAD_CONFIG_ENABLE_COAP_ADAPTIVE_RTO
 
 /**
  * This class implements the common base for CoAP client and server.
@@ -506,6 +768,27 @@ public:
      */
     void RemoveResource(Resource &aResource);
 
+#if OPENTHREAD_CONFIG_ENABLE_COAP_BLOCKWISE_TRANSFER
+    /**
+     * This method adds a block-wise resource to the CoAP server.
+     *
+     * @param[in]  aResource  A reference to the block-wise resource.
+     *
+     * @retval OT_ERROR_NONE     Successfully added @p aResource.
+     * @retval OT_ERROR_ALREADY  The @p aResource was already added.
+     *
+     */
+    otError AddBlockWiseResource(ResourceBlockWise &aResource);
+
+    /**
+     * This method removes a block-wise resource from the CoAP server.
+     *
+     * @param[in]  aResource  A reference to the block-wise resource.
+     *
+     */
+    void RemoveBlockWiseResource(ResourceBlockWise &aResource);
+#endif
+
     /* This function sets the default handler for unhandled CoAP requests.
      *
      * @param[in]  aHandler   A function pointer that shall be called when an unhandled request arrives.
@@ -534,10 +817,15 @@ public:
      * If no response is expected, these arguments should be NULL pointers.
      * If Message Id was not set in the header (equal to 0), this function will assign unique Message Id to the message.
      *
-     * @param[in]  aMessage      A reference to the message to send.
-     * @param[in]  aMessageInfo  A reference to the message info associated with @p aMessage.
-     * @param[in]  aHandler      A function pointer that shall be called on response reception or time-out.
-     * @param[in]  aContext      A pointer to arbitrary context information.
+     * With block-wise transfer, a non-NULL @p aTransmitHook produces the request payload as Block1 blocks, and a
+     * non-NULL @p aReceiveHook consumes a response payload sent as Block2 blocks. Both hooks are passed @p aContext.
+     *
+     * @param[in]  aMessage       A reference to the message to send.
+     * @param[in]  aMessageInfo   A reference to the message info associated with @p aMessage.
+     * @param[in]  aHandler       A function pointer that shall be called on response reception or time-out.
+     * @param[in]  aContext       A pointer to arbitrary context information.
+     * @param[in]  aTransmitHook  A function pointer that produces the request blocks, or NULL.
+     * @param[in]  aReceiveHook   A function pointer that consumes the response blocks, or NULL.
      *
      * @retval OT_ERROR_NONE     Successfully sent CoAP message.
      * @retval OT_ERROR_NO_BUFS  Failed to allocate retransmission data.
@@ -546,7 +834,35 @@ public:
     otError SendMessage(Message &               aMessage,
                         const Ip6::MessageInfo &aMessageInfo,
                         otCoapResponseHandler   aHandler = NULL,
-                        void *                  aContext = NULL);
+                        void *                  aContext = NULL
+#if OPENTHREAD_CONFIG_ENABLE_COAP_BLOCKWISE_TRANSFER
+                        ,
+                        otCoapBlockwiseTransmitHook aTransmitHook = NULL,
+                        otCoapBlockwiseReceiveHook  aReceiveHook  = NULL
+#endif
+    );
+
+#if OPENTHREAD_CONFIG_ENABLE_COAP_BLOCKWISE_TRANSFER
+    /**
+     * This method sends the first block of a CoAP response sent block-wise.
+     *
+     * The block is produced by @p aTransmitHook, @p aMessage must carry the CoAP header only. The following blocks are
+     * served from the transmit hook of the matching block-wise resource.
+     *
+     * @param[in]  aMessage       A reference to the response to send.
+     * @param[in]  aMessageInfo   A reference to the message info associated with @p aMessage.
+     * @param[in]  aContext       A pointer to arbitrary context information passed to @p aTransmitHook.
+     * @param[in]  aTransmitHook  A function pointer that produces the response blocks.
+     *
+     * @retval OT_ERROR_NONE     Successfully sent CoAP message.
+     * @retval OT_ERROR_NO_BUFS  Insufficient buffers available to send the CoAP response.
+     *
+     */
+    otError SendResponseBlockWise(Message &                   aMessage,
+                                  const Ip6::MessageInfo &    aMessageInfo,
+                                  void *                      aContext,
+                                  otCoapBlockwiseTransmitHook aTransmitHook);
+#endif
 
     /**
      * This method sends a CoAP reset message.
@@ -641,6 +957,64 @@ public:
      */
     otError AbortTransaction(otCoapResponseHandler aHandler, void *aContext);
 
+#if OPENTHREAD_CONFIG_ENABLE_COAP_OBSERVE
+    /**
+     * This method sends a notification to all observers of a resource.
+     *
+     * @p aMessage is a confirmable or non-confirmable response used as template. A copy is sent to every observer of
+     * @p aResource with its own Message ID, Token and Observe option.
+     *
+     * @param[in]  aResource  A reference to the observed resource.
+     * @param[in]  aMessage   A reference to the notification template. It is freed on success.
+     *
+     * @retval OT_ERROR_NONE          Successfully notified the observers.
+     * @retval OT_ERROR_INVALID_ARGS  @p aMessage is not a confirmable or non-confirmable response.
+     * @retval OT_ERROR_NO_BUFS       Insufficient buffers available to send the notifications.
+     *
+     */
+    otError NotifyObservers(const Resource &aResource, Message &aMessage);
+
+    /**
+     * This method cancels an observation started with given handler and context.
+     *
+     * A deregistration is sent to the server and the response handler is called with OT_ERROR_ABORT.
+     *
+     * @param[in]  aHandler  A function pointer of the observation response handler.
+     * @param[in]  aContext  A pointer to the context information of the observation.
+     *
+     * @retval OT_ERROR_NONE       Successfully cancelled the observation.
+     * @retval OT_ERROR_NOT_FOUND  No observation associated with given handler was found.
+     * @retval OT_ERROR_NO_BUFS    Insufficient buffers available to send the deregistration.
+     *
+     */
+    otError CancelObserve(otCoapResponseHandler aHandler, void *aContext);
+#endif
+
+#if OPENTHREAD_CONFIG_ENABLE_COAP_REQUEST_WINDOW
+    /**
+     * This method sets the number of outstanding interactions per destination (NSTART).
+     *
+     * A confirmable request is outstanding until acknowledged, a non-confirmable request with a response handler
+     * until its response is received or times out. Further requests to the destination are queued and sent in order
+     * as outstanding ones complete.
+     *
+     * @param[in]  aNstart  The number of outstanding interactions per destination, at least one.
+     *
+     * @retval OT_ERROR_NONE          Successfully set the window.
+     * @retval OT_ERROR_INVALID_ARGS  @p aNstart is zero.
+     *
+     */
+    otError SetNstart(uint8_t aNstart);
+
+    /**
+     * This method returns the number of outstanding interactions per destination (NSTART).
+     *
+     * @returns The number of outstanding interactions per destination.
+     *
+     */
+    uint8_t GetNstart(void) const { return mNstart; }
+#endif
+
     /**
      * This method sets interceptor to be called before processing a CoAP packet.
      *
@@ -670,6 +1044,14 @@ public:
      */
     const MessageQueue &GetCachedResponses(void) const { return mResponsesQueue.GetResponses(); }
 
+    /**
+     * This method returns the response cache counters.
+     *
+     * @returns A reference to the response cache counters.
+     *
+     */
+    const otCoapResponseCacheCounters &GetResponseCacheCounters(void) const { return mResponsesQueue.GetCounters(); }
+
 protected:
     /**
      * This constructor initializes the object.
@@ -742,12 +1124,137 @@ private:
 
     otError SendCopy(const Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
     otError SendEmptyMessage(Header::Type aType, const Header &aRequestHeader, const Ip6::MessageInfo &aMessageInfo);
+    otError InitResponseHeader(Header &aResponseHeader, Header::Code aCode, const Header &aRequestHeader);
+
+#if OPENTHREAD_CONFIG_ENABLE_COAP_BLOCKWISE_TRANSFER
+    enum
+    {
+        kMaxBlockLength = OPENTHREAD_CONFIG_COAP_MAX_BLOCK_LENGTH,
+    };
+
+    static otCoapBlockSize ClampBlockSize(otCoapBlockSize aSize);
+
+    otError WriteBlock(Message &                   aMessage,
+                       Header &                    aHeader,
+                       uint16_t                    aOptionNumber,
+                       uint32_t                    aNum,
+                       otCoapBlockSize             aSize,
+                       void *                      aContext,
+                       otCoapBlockwiseTransmitHook aTransmitHook);
+    otError WriteFirstBlock(Message &                   aMessage,
+                            Header &                    aHeader,
+                            uint16_t                    aOptionNumber,
+                            void *                      aContext,
+                            otCoapBlockwiseTransmitHook aTransmitHook);
+    otError DeliverBlock(const Message &            aMessage,
+                         uint32_t                   aPosition,
+                         bool                       aMore,
+                         uint32_t                   aTotalLength,
+                         void *                     aContext,
+                         otCoapBlockwiseReceiveHook aReceiveHook);
+    otError SendNextBlockRequest(const Message &     aRequest,
+                                 const CoapMetadata &aCoapMetadata,
+                                 Header &            aRequestHeader,
+                                 uint16_t            aOptionNumber,
+                                 uint32_t            aNum,
+                                 otCoapBlockSize     aSize);
+    bool    ContinueBlockwiseTransfer(Message &           aRequest,
+                                      const CoapMetadata &aCoapMetadata,
+                                      Header &            aRequestHeader,
+                                      Header &            aResponseHeader,
+                                      const Message &     aResponse);
+    void    ProcessBlockwiseRequest(const ResourceBlockWise &aResource,
+                                    Header &                 aHeader,
+                                    Message &                aMessage,
+                                    const Ip6::MessageInfo & aMessageInfo);
+    otError SendBlock2Response(const ResourceBlockWise &aResource,
+                               const Header &           aRequestHeader,
+                               uint32_t                 aNum,
+                               otCoapBlockSize          aSize,
+                               const Ip6::MessageInfo & aMessageInfo);
+#endif
+
+#if OPENTHREAD_CONFIG_ENABLE_COAP_REQUEST_WINDOW
+    bool    IsRequestWindowFull(const Ip6::Address &aAddress) const;
+    otError DeferRequest(Message &aMessage, const CoapMetadata &aCoapMetadata);
+    void    SendDeferredRequests(void);
+    void    FinalizeDeferredRequest(Message &aMessage, const CoapMetadata &aCoapMetadata, otError aResult);
+#endif
+
+#if OPENTHREAD_CONFIG_ENABLE_COAP_OBSERVE
+    enum
+    {
+        kMaxObservers        = OPENTHREAD_CONFIG_COAP_MAX_OBSERVERS,
+        kObserveRegister     = 0,
+        kObserveDeregister   = 1,
+        kObserveSequenceMask = 0xffffff,
+    };
+
+    struct Observer
+    {
+        const Resource *mResource; ///< The observed resource, NULL if the entry is unused.
+        Ip6::Address    mPeerAddr;
+        Ip6::Address    mSockAddr;
+        uint16_t        mPeerPort;
+        uint16_t        mMessageId; ///< Message ID of the latest notification.
+        uint8_t         mToken[OT_COAP_MAX_TOKEN_LENGTH];
+        uint8_t         mTokenLength;
+    };
+
+    static void HandleNotificationResponse(void *               aContext,
+                                           otCoapHeader *       aHeader,
+                                           otMessage *          aMessage,
+                                           const otMessageInfo *aMessageInfo,
+                                           otError              aResult);
+
+    Observer *FindObserver(const Header &aHeader, const Ip6::MessageInfo &aMessageInfo);
+    void      RemoveObserver(Observer &aObserver);
+    void      RemoveObservers(const Resource *aResource);
+    void      ProcessObserveRequest(const Resource &aResource, Header &aHeader, const Ip6::MessageInfo &aMessageInfo);
+    void      ProcessObserverReset(const Header &aHeader, const Ip6::MessageInfo &aMessageInfo);
+    otError   SetObserveOption(Message &aMessage, Header &aHeader);
+    otError   SendNotification(Observer &aObserver, Header &aHeader, const Message &aMessage);
+    bool      ProcessNotification(Message &               aRequest,
+                                  CoapMetadata &          aCoapMetadata,
+                                  Header &                aResponseHeader,
+                                  Message &               aResponse,
+                                  const Ip6::MessageInfo &aMessageInfo);
+#endif
+
+    enum
+    {
+        kNumResourceBuckets = OPENTHREAD_CONFIG_COAP_RESOURCE_HASH_BUCKETS,
+        kUriPathSeparator   = '/',
+    };
+
+    static uint16_t UpdateUriPathHash(uint16_t aHash, const uint8_t *aBytes, uint16_t aLength);
+    static uint16_t UpdateUriPathHash(uint16_t aHash, const Message &aMessage, uint16_t aOffset, uint16_t aLength);
+    static uint8_t  GetResourceBucket(uint16_t aUriPathHash)
+    {
+        return static_cast<uint8_t>(aUriPathHash & (kNumResourceBuckets - 1));
+    }
+    static uint8_t GetResourceBucket(const Resource &aResource);
+    static bool    IsUriPathMatch(const char *aUriPath, Header::OptionIterator &aIterator);
 
     MessageQueue mPendingRequests;
     uint16_t     mMessageId;
     TimerMilli   mRetransmissionTimer;
 
-    Resource *mResources;
+    Resource *mResources[kNumResourceBuckets];
+#if OPENTHREAD_CONFIG_ENABLE_COAP_BLOCKWISE_TRANSFER
+    ResourceBlockWise *mBlockWiseResources;
+#endif
+#if OPENTHREAD_CONFIG_ENABLE_COAP_OBSERVE
+    Observer mObservers[kMaxObservers];
+    uint32_t mObserveSequence;
+#endif
+#if OPENTHREAD_CONFIG_ENABLE_COAP_ADAPTIVE_RTO
+    RtoEstimator mRtoEstimator;
+#endif
+#if OPENTHREAD_CONFIG_ENABLE_COAP_REQUEST_WINDOW
+    MessageQueue mDeferredRequests;
+    uint8_t      mNstart;
+#endif
 
     void *         mContext;
     Interceptor    mInterceptor;
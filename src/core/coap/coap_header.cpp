@@ -209,6 +209,11 @@ otError Header::AppendOption(const Option &aOption)
         aOption.mLength < kOption1ByteExtensionOffset ? 0 : (aOption.mLength < kOption2ByteExtensionOffset ? 1 : 2);
     VerifyOrExit(mHeaderLength + optionLength < kMaxHeaderLength, error = OT_ERROR_NO_BUFS);
 
+    if (mFirstOptionOffset == 0)
+    {
+        mFirstOptionOffset = mHeaderLength;
+    }
+
     // Insert option delta.
     if (optionDelta < kOption1ByteExtensionOffset)
     {
@@ -334,6 +339,142 @@ otError Header::AppendUriQueryOption(const char *aUriQuery)
     return AppendStringOption(OT_COAP_OPTION_URI_QUERY, aUriQuery);
 }
 
+otError Header::AppendBlockOption(uint16_t aNumber, uint32_t aNum, bool aMore, otCoapBlockSize aSize)
+{
+    otError error = OT_ERROR_NONE;
+
+    VerifyOrExit(aNum <= kMaxBlockNum && aSize <= OT_COAP_BLOCK_SIZE_1024, error = OT_ERROR_INVALID_ARGS);
+
+    error = AppendUintOption(aNumber, (aNum << kBlockNumOffset) | (aMore ? kBlockMoreFlag : 0) | aSize);
+
+exit:
+    return error;
+}
+
+otError Header::GetUintOption(uint16_t aNumber, uint32_t &aValue)
+{
+    otError error = OT_ERROR_NOT_FOUND;
+
+    for (const Option *option = GetFirstOption(); option != NULL; option = GetNextOption())
+    {
+        if (option->mNumber != aNumber)
+        {
+            continue;
+        }
+
+        VerifyOrExit(option->mLength <= sizeof(uint32_t), error = OT_ERROR_PARSE);
+
+        aValue = 0;
+
+        for (uint16_t i = 0; i < option->mLength; i++)
+        {
+            aValue = (aValue << 8) | option->mValue[i];
+        }
+
+        ExitNow(error = OT_ERROR_NONE);
+    }
+
+exit:
+    return error;
+}
+
+otError Header::GetBlockOption(uint16_t aNumber, uint32_t &aNum, bool &aMore, otCoapBlockSize &aSize)
+{
+    otError  error;
+    uint32_t value;
+
+    SuccessOrExit(error = GetUintOption(aNumber, value));
+    VerifyOrExit((value & kBlockSizeMask) <= OT_COAP_BLOCK_SIZE_1024, error = OT_ERROR_PARSE);
+
+    aNum  = value >> kBlockNumOffset;
+    aMore = (value & kBlockMoreFlag) != 0;
+    aSize = static_cast<otCoapBlockSize>(value & kBlockSizeMask);
+
+exit:
+    return error;
+}
+
+otError Header::SetBlockOption(uint16_t aNumber, uint32_t aNum, bool aMore, otCoapBlockSize aSize)
+{
+    otError error = OT_ERROR_NONE;
+
+    VerifyOrExit(aNum <= kMaxBlockNum && aSize <= OT_COAP_BLOCK_SIZE_1024, error = OT_ERROR_INVALID_ARGS);
+
+    error = SetUintOption(aNumber, (aNum << kBlockNumOffset) | (aMore ? kBlockMoreFlag : 0) | aSize);
+
+exit:
+    return error;
+}
+
+otError Header::SetUintOption(uint16_t aNumber, uint32_t aValue)
+{
+    Header source = *this;
+    Option coapOption;
+
+    aValue             = Encoding::BigEndian::HostSwap32(aValue);
+    coapOption.mNumber = aNumber;
+    coapOption.mLength = sizeof(aValue);
+    coapOption.mValue  = reinterpret_cast<uint8_t *>(&aValue);
+
+    // skip preceding zeros
+    while (coapOption.mLength > 0 && coapOption.mValue[0] == 0)
+    {
+        coapOption.mValue++;
+        coapOption.mLength--;
+    }
+
+    return CopyFrom(source, source.GetToken(), source.GetTokenLength(), aNumber, &coapOption);
+}
+
+otError Header::RemoveOption(uint16_t aNumber)
+{
+    Header source = *this;
+
+    return CopyFrom(source, source.GetToken(), source.GetTokenLength(), aNumber, NULL);
+}
+
+otError Header::InitWithToken(Header &aSource, const uint8_t *aToken, uint8_t aTokenLength)
+{
+    return CopyFrom(aSource, aToken, aTokenLength, 0, NULL);
+}
+
+otError Header::CopyFrom(Header &       aSource,
+                         const uint8_t *aToken,
+                         uint8_t        aTokenLength,
+                         uint16_t       aNumber,
+                         const Option * aOption)
+{
+    otError       error = OT_ERROR_NONE;
+    const Option *coapOption;
+
+    // Rebuild the header from the options of `aSource`, leaving out the payload marker.
+    Init(aSource.GetType(), aSource.GetCode());
+    SetMessageId(aSource.GetMessageId());
+    SetToken(aToken, aTokenLength);
+
+    for (coapOption = aSource.GetFirstOption(); coapOption != NULL; coapOption = aSource.GetNextOption())
+    {
+        if (aOption != NULL && coapOption->mNumber > aNumber)
+        {
+            SuccessOrExit(error = AppendOption(*aOption));
+            aOption = NULL;
+        }
+
+        if (coapOption->mNumber != aNumber)
+        {
+            SuccessOrExit(error = AppendOption(*coapOption));
+        }
+    }
+
+    if (aOption != NULL)
+    {
+        SuccessOrExit(error = AppendOption(*aOption));
+    }
+
+exit:
+    return error;
+}
+
 const Header::Option *Header::GetFirstOption(void)
 {
     const Option *rval = NULL;
@@ -411,6 +552,114 @@ exit:
     return rval;
 }
 
+void Header::OptionIterator::Init(const Message &aMessage, uint16_t aOffset, const Header &aHeader)
+{
+    mMessage           = &aMessage;
+    mFirstOptionOffset = aOffset + kTokenOffset + aHeader.GetTokenLength();
+    mEndOffset         = aOffset + aHeader.GetLength();
+    mNextOptionOffset  = mEndOffset;
+    mValueOffset       = mEndOffset;
+    memset(&mOption, 0, sizeof(mOption));
+}
+
+const Header::Option *Header::OptionIterator::GetFirstOption(void)
+{
+    memset(&mOption, 0, sizeof(mOption));
+    mNextOptionOffset = mFirstOptionOffset;
+
+    return GetNextOption();
+}
+
+const Header::Option *Header::OptionIterator::GetNextOption(void)
+{
+    const Option *rval = NULL;
+    uint8_t       buf[kMaxOptionHeaderSize];
+    uint16_t      length;
+    uint16_t      index = sizeof(uint8_t);
+    uint16_t      optionDelta;
+    uint16_t      optionLength;
+
+    VerifyOrExit(mNextOptionOffset < mEndOffset);
+
+    // Only the option header is read, the value is left in the message.
+    length = mEndOffset - mNextOptionOffset;
+    length = mMessage->Read(mNextOptionOffset, (length < sizeof(buf)) ? length : sizeof(buf), buf);
+    VerifyOrExit(buf[0] != 0xff);
+
+    optionDelta  = buf[0] >> 4;
+    optionLength = buf[0] & 0xf;
+
+    if (optionDelta < kOption1ByteExtension)
+    {
+        // do nothing
+    }
+    else if (optionDelta == kOption1ByteExtension)
+    {
+        VerifyOrExit(index + sizeof(uint8_t) <= length);
+        optionDelta = kOption1ByteExtensionOffset + buf[index];
+        index += sizeof(uint8_t);
+    }
+    else if (optionDelta == kOption2ByteExtension)
+    {
+        VerifyOrExit(index + sizeof(uint16_t) <= length);
+        optionDelta = kOption2ByteExtensionOffset + static_cast<uint16_t>((buf[index] << 8) | buf[index + 1]);
+        index += sizeof(uint16_t);
+    }
+    else
+    {
+        ExitNow();
+    }
+
+    if (optionLength < kOption1ByteExtension)
+    {
+        // do nothing
+    }
+    else if (optionLength == kOption1ByteExtension)
+    {
+        VerifyOrExit(index + sizeof(uint8_t) <= length);
+        optionLength = kOption1ByteExtensionOffset + buf[index];
+        index += sizeof(uint8_t);
+    }
+    else if (optionLength == kOption2ByteExtension)
+    {
+        VerifyOrExit(index + sizeof(uint16_t) <= length);
+        optionLength = kOption2ByteExtensionOffset + static_cast<uint16_t>((buf[index] << 8) | buf[index + 1]);
+        index += sizeof(uint16_t);
+    }
+    else
+    {
+        ExitNow();
+    }
+
+    mValueOffset = mNextOptionOffset + index;
+    VerifyOrExit(optionLength <= mEndOffset - mValueOffset);
+
+    mOption.mNumber += optionDelta;
+    mOption.mLength = optionLength;
+    mNextOptionOffset = mValueOffset + optionLength;
+    rval              = &mOption;
+
+exit:
+    return rval;
+}
+
+bool Header::OptionIterator::IsValueEqual(const uint8_t *aValue) const
+{
+    bool           equal  = true;
+    uint16_t       length = mOption.mLength;
+    Message::Chunk chunk;
+
+    for (mMessage->GetFirstChunk(mValueOffset, length, chunk); chunk.mLength > 0;
+         mMessage->GetNextChunk(length, chunk))
+    {
+        VerifyOrExit(memcmp(chunk.mData, aValue, chunk.mLength) == 0, equal = false);
+        aValue += chunk.mLength;
+    }
+
+exit:
+    return equal;
+}
+
 otError Header::SetPayloadMarker(void)
 {
     otError error = OT_ERROR_NONE;
@@ -492,6 +741,9 @@ const char *Header::CodeToString(void) const
     case OT_COAP_CODE_CHANGED:
         mCodeString = "Changed";
         break;
+    case OT_COAP_CODE_CONTINUE:
+        mCodeString = "Continue";
+        break;
     case OT_COAP_CODE_BAD_REQUEST:
         mCodeString = "BadRequest";
         break;
@@ -507,6 +759,9 @@ const char *Header::CodeToString(void) const
     case OT_COAP_CODE_NOT_ACCEPTABLE:
         mCodeString = "NotAcceptable";
         break;
+    case OT_COAP_CODE_REQUEST_INCOMPLETE:
+        mCodeString = "RequestIncomplete";
+        break;
     case OT_COAP_CODE_PRECONDITION_FAILED:
         mCodeString = "PreconditionFailed";
         break;
@@ -388,6 +388,114 @@ public:
      */
     otError AppendUriQueryOption(const char *aUriQuery);
 
+    /**
+     * This method appends a Block1 or Block2 option (RFC 7959).
+     *
+     * @param[in]  aNumber  The CoAP Option number, `OT_COAP_OPTION_BLOCK1` or `OT_COAP_OPTION_BLOCK2`.
+     * @param[in]  aNum     The block number.
+     * @param[in]  aMore    TRUE if more blocks follow.
+     * @param[in]  aSize    The block size exponent.
+     *
+     * @retval OT_ERROR_NONE          Successfully appended the option.
+     * @retval OT_ERROR_INVALID_ARGS  The option type is not equal or greater than the last option type, or the block
+     *                                number or size is out of range.
+     * @retval OT_ERROR_NO_BUFS       The option length exceeds the buffer size.
+     */
+    otError AppendBlockOption(uint16_t aNumber, uint32_t aNum, bool aMore, otCoapBlockSize aSize);
+
+    /**
+     * This method reads the value of the first unsigned integer CoAP option with a given number.
+     *
+     * @param[in]   aNumber  The CoAP Option number.
+     * @param[out]  aValue   A reference to output the option value.
+     *
+     * @retval OT_ERROR_NONE       Successfully read the option value.
+     * @retval OT_ERROR_NOT_FOUND  The option is not present.
+     * @retval OT_ERROR_PARSE      The option value is longer than four bytes.
+     */
+    otError GetUintOption(uint16_t aNumber, uint32_t &aValue);
+
+    /**
+     * This method reads a Block1 or Block2 option (RFC 7959).
+     *
+     * @param[in]   aNumber  The CoAP Option number, `OT_COAP_OPTION_BLOCK1` or `OT_COAP_OPTION_BLOCK2`.
+     * @param[out]  aNum     A reference to output the block number.
+     * @param[out]  aMore    A reference to output whether more blocks follow.
+     * @param[out]  aSize    A reference to output the block size exponent.
+     *
+     * @retval OT_ERROR_NONE       Successfully read the option.
+     * @retval OT_ERROR_NOT_FOUND  The option is not present.
+     * @retval OT_ERROR_PARSE      The option value is malformed.
+     */
+    otError GetBlockOption(uint16_t aNumber, uint32_t &aNum, bool &aMore, otCoapBlockSize &aSize);
+
+    /**
+     * This method replaces a Block1 or Block2 option (RFC 7959), or inserts it in order if not present.
+     *
+     * All other options are kept. A Payload Marker is removed and must be set again if needed.
+     *
+     * @param[in]  aNumber  The CoAP Option number, `OT_COAP_OPTION_BLOCK1` or `OT_COAP_OPTION_BLOCK2`.
+     * @param[in]  aNum     The block number.
+     * @param[in]  aMore    TRUE if more blocks follow.
+     * @param[in]  aSize    The block size exponent.
+     *
+     * @retval OT_ERROR_NONE          Successfully set the option.
+     * @retval OT_ERROR_INVALID_ARGS  The block number or size is out of range.
+     * @retval OT_ERROR_NO_BUFS       The option length exceeds the buffer size.
+     */
+    otError SetBlockOption(uint16_t aNumber, uint32_t aNum, bool aMore, otCoapBlockSize aSize);
+
+    /**
+     * This method replaces an unsigned integer CoAP option, or inserts it in order if not present.
+     *
+     * All other options are kept. A Payload Marker is removed and must be set again if needed.
+     *
+     * @param[in]  aNumber  The CoAP Option number.
+     * @param[in]  aValue   The CoAP Option unsigned integer value.
+     *
+     * @retval OT_ERROR_NONE     Successfully set the option.
+     * @retval OT_ERROR_NO_BUFS  The option length exceeds the buffer size.
+     */
+    otError SetUintOption(uint16_t aNumber, uint32_t aValue);
+
+    /**
+     * This method removes all CoAP options with a given number.
+     *
+     * A Payload Marker is removed and must be set again if needed.
+     *
+     * @param[in]  aNumber  The CoAP Option number.
+     *
+     * @retval OT_ERROR_NONE     Successfully removed the options.
+     * @retval OT_ERROR_NO_BUFS  The remaining options exceed the buffer size.
+     */
+    otError RemoveOption(uint16_t aNumber);
+
+    /**
+     * This method initializes the header with the Type, Code, Message ID and options of another header and a given
+     * Token.
+     *
+     * @param[in]  aSource       A reference to the header to copy.
+     * @param[in]  aToken        A pointer to the Token value.
+     * @param[in]  aTokenLength  The Length of @p aToken.
+     *
+     * @retval OT_ERROR_NONE     Successfully initialized the header.
+     * @retval OT_ERROR_NO_BUFS  The options exceed the buffer size.
+     */
+    otError InitWithToken(Header &aSource, const uint8_t *aToken, uint8_t aTokenLength);
+
+    /**
+     * This static method returns the block size for a block size exponent.
+     *
+     * @param[in]  aSize  The block size exponent.
+     *
+     * @returns The block size in bytes.
+     *
+     */
+    static uint16_t GetBlockSize(otCoapBlockSize aSize)
+    {
+        return static_cast<uint16_t>(1 << (kBlockSizeOffset + aSize));
+    }
+
     /**
      * This method returns a pointer to the first option.
      *
@@ -404,6 +512,71 @@ public:
      */
     const Option *GetNextOption(void);
 
+    /**
+     * This class implements an iterator over the options of a CoAP header, parsing them directly from the message.
+     *
+     * Unlike `GetFirstOption()` and `GetNextOption()`, the iterator does not rely on the bytes copied into the
+     * `Header` object. The option values stay in the message: `mValue` of a returned option is always NULL and the
+     * value is compared in place with `IsValueEqual()` or accessed at `GetValueOffset()`.
+     *
+     */
+    class OptionIterator
+    {
+    public:
+        /**
+         * This method initializes the iterator.
+         *
+         * @param[in]  aMessage  The message containing the CoAP header.
+         * @param[in]  aOffset   The byte offset of the CoAP header within @p aMessage.
+         * @param[in]  aHeader   The header parsed from @p aMessage at @p aOffset (using `FromMessage()`).
+         *
+         */
+        void Init(const Message &aMessage, uint16_t aOffset, const Header &aHeader);
+
+        /**
+         * This method returns a pointer to the first option.
+         *
+         * @returns A pointer to the first option, or NULL if there is none.
+         *
+         */
+        const Option *GetFirstOption(void);
+
+        /**
+         * This method returns a pointer to the next option.
+         *
+         * @returns A pointer to the next option, or NULL if there are no more options.
+         *
+         */
+        const Option *GetNextOption(void);
+
+        /**
+         * This method returns the byte offset of the value of the current option within the message.
+         *
+         * @returns The byte offset of the current option value.
+         *
+         */
+        uint16_t GetValueOffset(void) const { return mValueOffset; }
+
+        /**
+         * This method indicates whether the value of the current option is equal to given bytes.
+         *
+         * @param[in]  aValue  A pointer to the bytes to compare with (at least `mLength` bytes of the option).
+         *
+         * @retval TRUE   If the current option value is equal to @p aValue.
+         * @retval FALSE  If the current option value is not equal to @p aValue.
+         *
+         */
+        bool IsValueEqual(const uint8_t *aValue) const;
+
+    private:
+        const Message *mMessage;
+        uint16_t       mFirstOptionOffset;
+        uint16_t       mNextOptionOffset;
+        uint16_t       mEndOffset;
+        uint16_t       mValueOffset;
+        Option         mOption;
+    };
+
     /**
      * This method adds Payload Marker indicating beginning of the payload to the CoAP header.
      *
@@ -523,7 +696,19 @@ private:
 
         kOption1ByteExtensionOffset = 13,  ///< Delta/Length offset as specified (RFC 7252).
         kOption2ByteExtensionOffset = 269, ///< Delta/Length offset as specified (RFC 7252).
+
+        kBlockNumOffset  = 4,             ///< Block number offset in a Block option value (RFC 7959).
+        kBlockMoreFlag   = 1 << 3,        ///< More flag in a Block option value (RFC 7959).
+        kBlockSizeMask   = 0x07,          ///< Block size exponent mask in a Block option value (RFC 7959).
+        kBlockSizeOffset = 4,             ///< Block size is 2 ** (exponent + 4) (RFC 7959).
+        kMaxBlockNum     = (1 << 20) - 1, ///< Maximum block number (RFC 7959).
     };
+
+    otError CopyFrom(Header &       aSource,
+                     const uint8_t *aToken,
+                     uint8_t        aTokenLength,
+                     uint16_t       aNumber,
+                     const Option * aOption);
 };
 
 /**
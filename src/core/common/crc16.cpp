@@ -35,30 +35,35 @@
 
 namespace ot {
 
+// Each table entry is the CRC contribution of the entry index placed in the top nibble of the CRC register.
+const uint16_t Crc16::sCcittTable[kTableSize] = {
+    0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50a5, 0x60c6, 0x70e7,
+    0x8108, 0x9129, 0xa14a, 0xb16b, 0xc18c, 0xd1ad, 0xe1ce, 0xf1ef,
+};
+
+const uint16_t Crc16::sAnsiTable[kTableSize] = {
+    0x0000, 0x8005, 0x800f, 0x000a, 0x801b, 0x001e, 0x0014, 0x8011,
+    0x8033, 0x0036, 0x003c, 0x8039, 0x0028, 0x802d, 0x8027, 0x0022,
+};
+
 Crc16::Crc16(Polynomial aPolynomial)
 {
-    mPolynomial = static_cast<uint16_t>(aPolynomial);
+    mTable = (aPolynomial == kCcitt) ? sCcittTable : sAnsiTable;
     Init();
 }
 
 void Crc16::Update(uint8_t aByte)
 {
-    uint8_t i;
-
-    mCrc = mCrc ^ static_cast<uint16_t>(aByte << 8);
-    i    = 8;
+    mCrc = static_cast<uint16_t>(mCrc << 4) ^ mTable[(mCrc >> 12) ^ (aByte >> 4)];
+    mCrc = static_cast<uint16_t>(mCrc << 4) ^ mTable[(mCrc >> 12) ^ (aByte & 0x0f)];
+}
 
-    do
+void Crc16::Update(const uint8_t *aBuf, uint16_t aLength)
+{
+    for (const uint8_t *end = aBuf + aLength; aBuf < end; aBuf++)
     {
-        if (mCrc & 0x8000)
-        {
-            mCrc = static_cast<uint16_t>(mCrc << 1) ^ mPolynomial;
-        }
-        else
-        {
-            mCrc = static_cast<uint16_t>(mCrc << 1);
-        }
-    } while (--i);
+        Update(*aBuf);
+    }
 }
 
 } // namespace ot
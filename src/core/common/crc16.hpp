@@ -43,6 +43,8 @@ namespace ot {
 /**
  * This class implements CRC16 computations.
  *
+ * The CRC is computed using a 16-entry (nibble) lookup table per polynomial, i.e. two table lookups per byte.
+ *
  */
 class Crc16
 {
@@ -75,6 +77,15 @@ public:
      */
     void Update(uint8_t aByte);
 
+    /**
+     * This method feeds a buffer of bytes into the CRC16 computation.
+     *
+     * @param[in]  aBuf     A pointer to the bytes.
+     * @param[in]  aLength  The number of bytes in @p aBuf.
+     *
+     */
+    void Update(const uint8_t *aBuf, uint16_t aLength);
+
     /**
      * This method gets the current CRC16 value.
      *
@@ -84,8 +95,16 @@ public:
     uint16_t Get(void) const { return mCrc; }
 
 private:
-    uint16_t mPolynomial;
-    uint16_t mCrc;
+    enum
+    {
+        kTableSize = 16, ///< Number of entries in a nibble lookup table.
+    };
+
+    static const uint16_t sCcittTable[kTableSize];
+    static const uint16_t sAnsiTable[kTableSize];
+
+    const uint16_t *mTable;
+    uint16_t        mCrc;
 };
 
 } // namespace ot
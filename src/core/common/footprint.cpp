@@ -0,0 +1,100 @@
+/*
+ *  Copyright (c) 2018, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file defines the class size symbols used by the memory footprint report.
+ *
+ *   This file is not part of the OpenThread libraries. It is compiled with the flags of each library and every
+ *   `otFootprint_<Class>` array is sized after the corresponding class, so that the symbol sizes reported by `nm -S`
+ *   give the class sizes without running code on the target (see script/footprint-report.sh).
+ */
+
+#include "openthread-core-config.h"
+
+#include "common/instance.hpp"
+
+#define OT_FOOTPRINT(aName, aType) char otFootprint_##aName[sizeof(aType)]
+
+extern "C" {
+
+OT_FOOTPRINT(Instance, ot::Instance);
+OT_FOOTPRINT(TimerMilliScheduler, ot::TimerMilliScheduler);
+OT_FOOTPRINT(TaskletScheduler, ot::TaskletScheduler);
+
+#if OPENTHREAD_RADIO || OPENTHREAD_ENABLE_RAW_LINK_API
+OT_FOOTPRINT(LinkRaw, ot::Mac::LinkRaw);
+#endif
+
+#if OPENTHREAD_MTD || OPENTHREAD_FTD
+OT_FOOTPRINT(Notifier, ot::Notifier);
+OT_FOOTPRINT(Settings, ot::Settings);
+OT_FOOTPRINT(MessagePool, ot::MessagePool);
+OT_FOOTPRINT(MessageBuffer, ot::Buffer);
+OT_FOOTPRINT(Ip6, ot::Ip6::Ip6);
+OT_FOOTPRINT(ThreadNetif, ot::ThreadNetif);
+OT_FOOTPRINT(Mac, ot::Mac::Mac);
+OT_FOOTPRINT(MeshForwarder, ot::MeshForwarder);
+OT_FOOTPRINT(DataPollManager, ot::DataPollManager);
+OT_FOOTPRINT(Lowpan, ot::Lowpan::Lowpan);
+OT_FOOTPRINT(MleRouter, ot::Mle::MleRouter);
+OT_FOOTPRINT(ChildTable, ot::ChildTable);
+OT_FOOTPRINT(RouterTable, ot::RouterTable);
+OT_FOOTPRINT(AddressResolver, ot::AddressResolver);
+OT_FOOTPRINT(KeyManager, ot::KeyManager);
+OT_FOOTPRINT(NetworkDataLeader, ot::NetworkData::Leader);
+OT_FOOTPRINT(TmfCoap, ot::Coap::Coap);
+
+#if !OPENTHREAD_ENABLE_MULTIPLE_INSTANCES
+OT_FOOTPRINT(MbedTls, ot::Crypto::MbedTls);
+OT_FOOTPRINT(Heap, ot::Utils::Heap);
+#endif
+
+#if OPENTHREAD_ENABLE_BORDER_ROUTER || OPENTHREAD_ENABLE_SERVICE
+OT_FOOTPRINT(NetworkDataLocal, ot::NetworkData::Local);
+#endif
+
+#if OPENTHREAD_ENABLE_DTLS
+OT_FOOTPRINT(Dtls, ot::MeshCoP::Dtls);
+OT_FOOTPRINT(CoapSecure, ot::Coap::CoapSecure);
+#endif
+
+#if OPENTHREAD_ENABLE_COMMISSIONER && OPENTHREAD_FTD
+OT_FOOTPRINT(Commissioner, ot::MeshCoP::Commissioner);
+#endif
+
+#if OPENTHREAD_ENABLE_JOINER
+OT_FOOTPRINT(Joiner, ot::MeshCoP::Joiner);
+#endif
+
+#if OPENTHREAD_ENABLE_APPLICATION_COAP
+OT_FOOTPRINT(ApplicationCoap, ot::Coap::ApplicationCoap);
+#endif
+#endif // OPENTHREAD_MTD || OPENTHREAD_FTD
+
+} // extern "C"
@@ -0,0 +1,117 @@
+/*
+ *  Copyright (c) 2018, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the tasklet and timer handler profiler.
+ */
+
+#include "handler_profiler.hpp"
+
+#include <string.h>
+
+#include "common/code_utils.hpp"
+
+#if OPENTHREAD_CONFIG_ENABLE_HANDLER_PROFILER
+
+namespace ot {
+
+HandlerProfiler::HandlerProfiler(void)
+{
+    Reset();
+}
+
+void HandlerProfiler::Record(otHandlerType aType, uintptr_t aHandler, uint32_t aStartTime)
+{
+    uint32_t          duration = GetNow() - aStartTime;
+    otHandlerProfile *profile  = NULL;
+
+    for (uint16_t i = 0; i < mNumProfiles; i++)
+    {
+        if (mProfiles[i].mHandler == aHandler && mProfiles[i].mType == aType)
+        {
+            ExitNow(profile = &mProfiles[i]);
+        }
+    }
+
+    if (mNumProfiles < kMaxProfiles)
+    {
+        profile           = &mProfiles[mNumProfiles++];
+        profile->mHandler = aHandler;
+        profile->mType    = aType;
+    }
+    else
+    {
+        profile = &mOverflow;
+    }
+
+exit:
+    Update(*profile, duration);
+}
+
+void HandlerProfiler::Update(otHandlerProfile &aProfile, uint32_t aDuration)
+{
+    aProfile.mCount++;
+    aProfile.mTotalTime += aDuration;
+
+    if (aDuration > aProfile.mMaxTime)
+    {
+        aProfile.mMaxTime = aDuration;
+    }
+}
+
+otError HandlerProfiler::GetNextProfile(otHandlerProfileIterator &aIterator, otHandlerProfile &aProfile) const
+{
+    otError error = OT_ERROR_NONE;
+
+    if (aIterator < mNumProfiles)
+    {
+        aProfile = mProfiles[aIterator];
+    }
+    else
+    {
+        VerifyOrExit(aIterator == mNumProfiles && mOverflow.mCount != 0, error = OT_ERROR_NOT_FOUND);
+        aProfile = mOverflow;
+    }
+
+    aIterator++;
+
+exit:
+    return error;
+}
+
+void HandlerProfiler::Reset(void)
+{
+    memset(mProfiles, 0, sizeof(mProfiles));
+    memset(&mOverflow, 0, sizeof(mOverflow));
+    mNumProfiles = 0;
+}
+
+} // namespace ot
+
+#endif // OPENTHREAD_CONFIG_ENABLE_HANDLER_PROFILER
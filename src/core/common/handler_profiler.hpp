@@ -0,0 +1,126 @@
+/*
+ *  Copyright (c) 2018, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the tasklet and timer handler profiler.
+ */
+
+#ifndef HANDLER_PROFILER_HPP_
+#define HANDLER_PROFILER_HPP_
+
+#include "openthread-core-config.h"
+
+#include <stdint.h>
+
+#include <openthread/tasklet.h>
+#include <openthread/platform/time.h>
+
+namespace ot {
+
+/**
+ * @addtogroup core-tasklet
+ *
+ * @{
+ *
+ */
+
+#if OPENTHREAD_CONFIG_ENABLE_HANDLER_PROFILER
+
+/**
+ * This class records the invocation count and execution time of tasklet and timer handlers.
+ *
+ */
+class HandlerProfiler
+{
+public:
+    /**
+     * This constructor initializes the object.
+     *
+     */
+    HandlerProfiler(void);
+
+    /**
+     * This static method returns the current time of the profiling clock.
+     *
+     * @returns The current time (in microseconds).
+     *
+     */
+    static uint32_t GetNow(void) { return static_cast<uint32_t>(otPlatTimeGet()); }
+
+    /**
+     * This method records one invocation of a handler.
+     *
+     * @param[in]  aType       The kind of handler.
+     * @param[in]  aHandler    The address of the handler function.
+     * @param[in]  aStartTime  The time (from `GetNow()`) when the handler was invoked.
+     *
+     */
+    void Record(otHandlerType aType, uintptr_t aHandler, uint32_t aStartTime);
+
+    /**
+     * This method gets the next handler profile.
+     *
+     * @param[inout]  aIterator  A reference to the iterator context.
+     * @param[out]    aProfile   A reference to where the handler profile is placed.
+     *
+     * @retval OT_ERROR_NONE       Successfully found the next handler profile.
+     * @retval OT_ERROR_NOT_FOUND  No subsequent handler profile exists.
+     *
+     */
+    otError GetNextProfile(otHandlerProfileIterator &aIterator, otHandlerProfile &aProfile) const;
+
+    /**
+     * This method clears all the handler profiles.
+     *
+     */
+    void Reset(void);
+
+private:
+    enum
+    {
+        kMaxProfiles = OPENTHREAD_CONFIG_HANDLER_PROFILER_MAX_ENTRIES,
+    };
+
+    static void Update(otHandlerProfile &aProfile, uint32_t aDuration);
+
+    otHandlerProfile mProfiles[kMaxProfiles];
+    otHandlerProfile mOverflow;
+    uint16_t         mNumProfiles;
+};
+
+#endif // OPENTHREAD_CONFIG_ENABLE_HANDLER_PROFILER
+
+/**
+ * @}
+ *
+ */
+
+} // namespace ot
+
+#endif // HANDLER_PROFILER_HPP_
@@ -87,11 +87,22 @@ Instance::Instance(void)
 #if OPENTHREAD_CONFIG_ENABLE_DYNAMIC_LOG_LEVEL
     , mLogLevel(static_cast<otLogLevel>(OPENTHREAD_CONFIG_LOG_LEVEL))
 #endif
+#if OPENTHREAD_CONFIG_LOG_DEFERRED
+    , mLogBuffer(*this)
+#endif
 #if OPENTHREAD_ENABLE_VENDOR_EXTENSION
     , mExtension(Extension::ExtensionBase::Init(*this))
 #endif
     , mIsInitialized(false)
 {
+#if OPENTHREAD_CONFIG_ENABLE_DYNAMIC_LOG_LEVEL
+    SetLogLevel(mLogLevel);
+#endif
+
+#if OPENTHREAD_CONFIG_ENABLE_BOOT_TIMESTAMPS
+    memset(&mBootTimestamps, 0, sizeof(mBootTimestamps));
+    mBootTimestamps.mConstructed = TimerMilli::GetNow();
+#endif
 }
 
 #if !OPENTHREAD_ENABLE_MULTIPLE_INSTANCES
@@ -140,6 +151,14 @@ exit:
 
 #endif // OPENTHREAD_ENABLE_MULTIPLE_INSTANCES
 
+#if OPENTHREAD_CONFIG_ENABLE_DYNAMIC_LOG_LEVEL
+void Instance::SetLogLevel(otLogLevel aLogLevel)
+{
+    mLogLevel = aLogLevel;
+    memset(_otLogRegionLevels, aLogLevel, sizeof(_otLogRegionLevels));
+}
+#endif
+
 void Instance::Reset(void)
 {
     otPlatReset(this);
@@ -153,7 +172,14 @@ void Instance::AfterInit(void)
     // Restore datasets and network information
 
     GetSettings().Init();
+#if OPENTHREAD_CONFIG_ENABLE_BOOT_TIMESTAMPS
+    mBootTimestamps.mSettingsInit = TimerMilli::GetNow();
+#endif
+
     mThreadNetif.GetMle().Restore();
+#if OPENTHREAD_CONFIG_ENABLE_BOOT_TIMESTAMPS
+    mBootTimestamps.mRestored = TimerMilli::GetNow();
+#endif
 
 #if OPENTHREAD_CONFIG_ENABLE_AUTO_START_SUPPORT
 
@@ -171,6 +197,10 @@ void Instance::AfterInit(void)
     }
 
 #endif
+
+#if OPENTHREAD_CONFIG_ENABLE_BOOT_TIMESTAMPS
+    mBootTimestamps.mInitDone = TimerMilli::GetNow();
+#endif
 #endif // OPENTHREAD_MTD || OPENTHREAD_FTD
 
 #if OPENTHREAD_ENABLE_VENDOR_EXTENSION
@@ -212,6 +242,23 @@ exit:
     return error;
 }
 
+#if OPENTHREAD_CONFIG_ENABLE_BOOT_TIMESTAMPS
+void Instance::RecordBootAttached(void)
+{
+    VerifyOrExit(mBootTimestamps.mAttached == 0);
+    mBootTimestamps.mAttached = TimerMilli::GetNow();
+
+    otLogInfoCore("Attached %lu ms after start-up (settings %lu ms, restore %lu ms, init done %lu ms)",
+                  static_cast<unsigned long>(mBootTimestamps.mAttached - mBootTimestamps.mConstructed),
+                  static_cast<unsigned long>(mBootTimestamps.mSettingsInit - mBootTimestamps.mConstructed),
+                  static_cast<unsigned long>(mBootTimestamps.mRestored - mBootTimestamps.mConstructed),
+                  static_cast<unsigned long>(mBootTimestamps.mInitDone - mBootTimestamps.mConstructed));
+
+exit:
+    return;
+}
+#endif
+
 void Instance::RegisterActiveScanCallback(otHandleActiveScanResult aCallback, void *aContext)
 {
     mActiveScanCallback        = aCallback;
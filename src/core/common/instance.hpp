@@ -40,8 +40,12 @@
 #include "utils/wrap_stdint.h"
 
 #include <openthread/error.h>
+#include <openthread/instance.h>
 #include <openthread/platform/logging.h>
 
+#include "common/handler_profiler.hpp"
+#include "common/log_buffer.hpp"
+
 #if OPENTHREAD_RADIO || OPENTHREAD_ENABLE_RAW_LINK_API
 #include "common/message.hpp"
 #include "mac/link_raw.hpp"
@@ -180,6 +184,16 @@ public:
      */
     TaskletScheduler &GetTaskletScheduler(void) { return mTaskletScheduler; }
 
+#if OPENTHREAD_CONFIG_ENABLE_HANDLER_PROFILER
+    /**
+     * This method returns a reference to the tasklet and timer handler profiler object.
+     *
+     * @returns A reference to the handler profiler object.
+     *
+     */
+    HandlerProfiler &GetHandlerProfiler(void) { return mHandlerProfiler; }
+#endif
+
     /**
      * This method returns the active log level.
      *
@@ -201,10 +215,22 @@ public:
     /**
      * This method sets the log level.
      *
+     * The log level of every log region is set to @p aLogLevel as well.
+     *
      * @param[in] aLogLevel  A log level.
      *
      */
-    void SetLogLevel(otLogLevel aLogLevel) { mLogLevel = aLogLevel; }
+    void SetLogLevel(otLogLevel aLogLevel);
+#endif
+
+#if OPENTHREAD_CONFIG_LOG_DEFERRED
+    /**
+     * This method returns a reference to the deferred log buffer.
+     *
+     * @returns A reference to the deferred log buffer.
+     *
+     */
+    LogBuffer &GetLogBuffer(void) { return mLogBuffer; }
 #endif
 
     /**
@@ -297,6 +323,22 @@ public:
     Utils::Heap &GetHeap(void) { return mHeap; }
 #endif
 
+#if OPENTHREAD_CONFIG_ENABLE_BOOT_TIMESTAMPS
+    /**
+     * This method returns the times at which the start-up phases of the instance completed.
+     *
+     * @returns A reference to the boot timestamps.
+     *
+     */
+    const otBootTimestamps &GetBootTimestamps(void) const { return mBootTimestamps; }
+
+    /**
+     * This method records the time the device first attached, if not recorded yet.
+     *
+     */
+    void RecordBootAttached(void);
+#endif
+
     /**
      * This method returns a reference to the Ip6 object.
      *
@@ -419,12 +461,18 @@ private:
     TimerMicroScheduler mTimerMicroScheduler;
 #endif
     TaskletScheduler mTaskletScheduler;
+#if OPENTHREAD_CONFIG_ENABLE_HANDLER_PROFILER
+    HandlerProfiler mHandlerProfiler;
+#endif
 
 #if OPENTHREAD_MTD || OPENTHREAD_FTD
     otHandleActiveScanResult mActiveScanCallback;
     void *                   mActiveScanCallbackContext;
     otHandleEnergyScanResult mEnergyScanCallback;
     void *                   mEnergyScanCallbackContext;
+#if OPENTHREAD_CONFIG_ENABLE_BOOT_TIMESTAMPS
+    otBootTimestamps mBootTimestamps;
+#endif
 
     Notifier mNotifier;
     Settings mSettings;
@@ -466,6 +514,9 @@ private:
 #if OPENTHREAD_CONFIG_ENABLE_DYNAMIC_LOG_LEVEL
     otLogLevel mLogLevel;
 #endif
+#if OPENTHREAD_CONFIG_LOG_DEFERRED
+    LogBuffer mLogBuffer;
+#endif
 #if OPENTHREAD_ENABLE_VENDOR_EXTENSION
     Extension::ExtensionBase &mExtension;
 #endif
@@ -714,6 +765,13 @@ template <> inline TaskletScheduler &Instance::Get(void)
     return GetTaskletScheduler();
 }
 
+#if OPENTHREAD_CONFIG_LOG_DEFERRED
+template <> inline LogBuffer &Instance::Get(void)
+{
+    return GetLogBuffer();
+}
+#endif
+
 #if OPENTHREAD_ENABLE_VENDOR_EXTENSION
 template <> inline Extension::ExtensionBase &Instance::Get(void)
 {
@@ -0,0 +1,172 @@
+/*
+ *  Copyright (c) 2018, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the deferred log buffer.
+ */
+
+#define WPP_NAME "log_buffer.tmh"
+
+#include "log_buffer.hpp"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "common/code_utils.hpp"
+#include "common/instance.hpp"
+#include "common/logging.hpp"
+#include "common/owner-locator.hpp"
+
+#if OPENTHREAD_CONFIG_LOG_DEFERRED
+
+namespace ot {
+
+LogBuffer::LogBuffer(Instance &aInstance)
+    : InstanceLocator(aInstance)
+    , mHead(0)
+    , mLength(0)
+    , mDroppedCount(0)
+    , mReportedDroppedCount(0)
+    , mTasklet(aInstance, &LogBuffer::HandleTasklet, this, Tasklet::kPriorityLow)
+{
+}
+
+void LogBuffer::Append(otLogLevel aLogLevel, otLogRegion aLogRegion, const char *aFormat, va_list aArgs)
+{
+    Header header;
+    char   line[kMaxLineLength];
+    int    length;
+
+    // Arguments may point to temporaries of the caller (e.g. `ToString()` buffers), so the line is formatted here and
+    // only its output is deferred.
+    length = vsnprintf(line, sizeof(line), aFormat, aArgs);
+    VerifyOrExit(length >= 0);
+
+    if (length >= kMaxLineLength)
+    {
+        length = kMaxLineLength - 1;
+    }
+
+    header.mLogLevel  = static_cast<uint8_t>(aLogLevel);
+    header.mLogRegion = static_cast<uint8_t>(aLogRegion);
+    header.mLength    = static_cast<uint8_t>(length);
+
+    VerifyOrExit(sizeof(header) + header.mLength <= static_cast<uint16_t>(kBufferSize - mLength), mDroppedCount++);
+
+    Write(&header, sizeof(header));
+    Write(line, header.mLength);
+
+exit:
+    mTasklet.Post();
+}
+
+void LogBuffer::Write(const void *aData, uint16_t aLength)
+{
+    uint16_t tail  = (mHead + mLength) % kBufferSize;
+    uint16_t chunk = (aLength < kBufferSize - tail) ? aLength : static_cast<uint16_t>(kBufferSize - tail);
+
+    memcpy(&mBuffer[tail], aData, chunk);
+    memcpy(mBuffer, static_cast<const uint8_t *>(aData) + chunk, aLength - chunk);
+    mLength += aLength;
+}
+
+void LogBuffer::Read(void *aData, uint16_t aLength)
+{
+    uint16_t chunk = (aLength < kBufferSize - mHead) ? aLength : static_cast<uint16_t>(kBufferSize - mHead);
+
+    memcpy(aData, &mBuffer[mHead], chunk);
+    memcpy(static_cast<uint8_t *>(aData) + chunk, mBuffer, aLength - chunk);
+    mHead = (mHead + aLength) % kBufferSize;
+    mLength -= aLength;
+}
+
+void LogBuffer::HandleTasklet(Tasklet &aTasklet)
+{
+    aTasklet.GetOwner<LogBuffer>().HandleTasklet();
+}
+
+void LogBuffer::HandleTasklet(void)
+{
+    Header header;
+    char   line[kMaxLineLength];
+
+    if (mReportedDroppedCount != mDroppedCount)
+    {
+        OPENTHREAD_CONFIG_PLAT_LOG_FUNCTION(OT_LOG_LEVEL_WARN, OT_LOG_REGION_CORE, "%u log line(s) dropped",
+                                            static_cast<unsigned int>(mDroppedCount - mReportedDroppedCount));
+        mReportedDroppedCount = mDroppedCount;
+    }
+
+    VerifyOrExit(mLength >= sizeof(header));
+
+    // Output a single line per run so that other tasklets are not held up by a slow platform log function.
+    Read(&header, sizeof(header));
+    Read(line, header.mLength);
+    line[header.mLength] = '\0';
+
+    OPENTHREAD_CONFIG_PLAT_LOG_FUNCTION(static_cast<otLogLevel>(header.mLogLevel),
+                                        static_cast<otLogRegion>(header.mLogRegion), "%s", line);
+
+    if (mLength > 0)
+    {
+        mTasklet.Post();
+    }
+
+exit:
+    return;
+}
+
+} // namespace ot
+
+using namespace ot;
+
+extern "C" void otLogDeferred(otLogLevel aLogLevel, otLogRegion aLogRegion, const char *aFormat, ...)
+{
+    Instance &instance = Instance::Get();
+    va_list   args;
+
+    va_start(args, aFormat);
+
+    if (instance.IsInitialized())
+    {
+        instance.GetLogBuffer().Append(aLogLevel, aLogRegion, aFormat, args);
+    }
+    else
+    {
+        // The instance (and its tasklet scheduler) is not available yet, so the line is output right away.
+        char line[128];
+
+        vsnprintf(line, sizeof(line), aFormat, args);
+        OPENTHREAD_CONFIG_PLAT_LOG_FUNCTION(aLogLevel, aLogRegion, "%s", line);
+    }
+
+    va_end(args);
+}
+
+#endif // OPENTHREAD_CONFIG_LOG_DEFERRED
@@ -0,0 +1,137 @@
+/*
+ *  Copyright (c) 2018, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the deferred log buffer.
+ */
+
+#ifndef LOG_BUFFER_HPP_
+#define LOG_BUFFER_HPP_
+
+#include "openthread-core-config.h"
+
+#include <stdarg.h>
+
+#include <openthread/platform/logging.h>
+
+#include "common/locator.hpp"
+#include "common/tasklet.hpp"
+
+namespace ot {
+
+/**
+ * @addtogroup core-log-buffer
+ *
+ * @{
+ *
+ */
+
+#if OPENTHREAD_CONFIG_LOG_DEFERRED
+
+#if OPENTHREAD_ENABLE_MULTIPLE_INSTANCES
+#error "OPENTHREAD_CONFIG_LOG_DEFERRED is not supported along with OPENTHREAD_ENABLE_MULTIPLE_INSTANCES"
+#endif
+
+/**
+ * This class implements a ring buffer of formatted log lines whose output to the platform is deferred to a tasklet.
+ *
+ * The caller only pays for formatting the line, while the (typically slow) platform output runs later, one line per
+ * tasklet run so that other tasklets are not held up.
+ *
+ */
+class LogBuffer : public InstanceLocator
+{
+public:
+    /**
+     * This constructor initializes the log buffer.
+     *
+     * @param[in]  aInstance  A reference to the OpenThread instance.
+     *
+     */
+    explicit LogBuffer(Instance &aInstance);
+
+    /**
+     * This method formats a log line and appends it to the buffer.
+     *
+     * If the buffer has no room for the line, the line is dropped and counted.
+     *
+     * @param[in]  aLogLevel   The log level.
+     * @param[in]  aLogRegion  The log region.
+     * @param[in]  aFormat     A pointer to the format string.
+     * @param[in]  aArgs       The arguments for the format string.
+     *
+     */
+    void Append(otLogLevel aLogLevel, otLogRegion aLogRegion, const char *aFormat, va_list aArgs);
+
+    /**
+     * This method returns the number of log lines dropped because the buffer was full.
+     *
+     * @returns The number of dropped log lines.
+     *
+     */
+    uint32_t GetDroppedCount(void) const { return mDroppedCount; }
+
+private:
+    enum
+    {
+        kBufferSize    = OPENTHREAD_CONFIG_LOG_DEFERRED_BUFFER_SIZE,
+        kMaxLineLength = 128, ///< Maximum length of a log line, including the null terminator.
+    };
+
+    struct Header
+    {
+        uint8_t mLogLevel;
+        uint8_t mLogRegion;
+        uint8_t mLength; ///< Length of the line, excluding the null terminator.
+    };
+
+    void Write(const void *aData, uint16_t aLength);
+    void Read(void *aData, uint16_t aLength);
+
+    static void HandleTasklet(Tasklet &aTasklet);
+    void        HandleTasklet(void);
+
+    uint8_t  mBuffer[kBufferSize];
+    uint16_t mHead;
+    uint16_t mLength;
+    uint32_t mDroppedCount;
+    uint32_t mReportedDroppedCount;
+    Tasklet  mTasklet;
+};
+
+#endif // OPENTHREAD_CONFIG_LOG_DEFERRED
+
+/**
+ * @}
+ *
+ */
+
+} // namespace ot
+
+#endif // LOG_BUFFER_HPP_
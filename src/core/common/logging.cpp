@@ -348,6 +348,10 @@ const char *otLogLevelToPrefixString(otLogLevel aLogLevel)
     return retval;
 }
 
+#if OPENTHREAD_CONFIG_ENABLE_DYNAMIC_LOG_LEVEL
+uint8_t _otLogRegionLevels[_OT_LOG_NUM_REGIONS];
+#endif
+
 #if OPENTHREAD_CONFIG_LOG_OUTPUT == OPENTHREAD_CONFIG_LOG_OUTPUT_NONE
 /* this provides a stub, incase something uses the function */
 void otPlatLog(otLogLevel aLogLevel, otLogRegion aLogRegion, const char *aFormat, ...)
@@ -1908,13 +1908,25 @@ const char *otLogLevelToPrefixString(otLogLevel aLogLevel);
 
 #if OPENTHREAD_CONFIG_ENABLE_DYNAMIC_LOG_LEVEL == 1
 
+/**
+ * The number of entries in the runtime log level table (`otLogRegion` values start from one).
+ */
+#define _OT_LOG_NUM_REGIONS (OT_LOG_REGION_UTIL + 1)
+
+/**
+ * The runtime log level of each log region, indexed by `otLogRegion`.
+ *
+ * The table is kept outside of the instance so that filtering a log line costs a single load and compare.
+ */
+extern uint8_t _otLogRegionLevels[_OT_LOG_NUM_REGIONS];
+
 /**
  * Local/private macro to dynamically filter log level.
  */
 #define _otDynamicLog(aLogLevel, aRegion, aFormat, ...)             \
     do                                                              \
     {                                                               \
-        if (otLoggingGetLevel() >= aLogLevel)                       \
+        if (_otLogRegionLevels[aRegion] >= aLogLevel)               \
             _otPlatLog(aLogLevel, aRegion, aFormat, ##__VA_ARGS__); \
     } while (false)
 
@@ -1924,6 +1936,27 @@ const char *otLogLevelToPrefixString(otLogLevel aLogLevel);
 
 #endif // OPENTHREAD_CONFIG_ENABLE_DYNAMIC_LOG_LEVEL
 
+#if OPENTHREAD_CONFIG_LOG_DEFERRED
+
+/**
+ * This function formats a log line into the deferred log buffer, its output to `OPENTHREAD_CONFIG_PLAT_LOG_FUNCTION`
+ * happens later from a tasklet.
+ *
+ * @param[in]  aLogLevel   The log level.
+ * @param[in]  aLogRegion  The log region.
+ * @param[in]  aFormat     A pointer to the format string.
+ * @param[in]  ...         Arguments for the format specification.
+ *
+ */
+void otLogDeferred(otLogLevel aLogLevel, otLogRegion aLogRegion, const char *aFormat, ...);
+
+/**
+ * Local/private macro to defer the log output (see `OPENTHREAD_CONFIG_LOG_DEFERRED`).
+ */
+#define _otPlatLog(aLogLevel, aRegion, aFormat, ...) otLogDeferred(aLogLevel, aRegion, aFormat, ##__VA_ARGS__)
+
+#else // OPENTHREAD_CONFIG_LOG_DEFERRED
+
 /**
  * `OPENTHREAD_CONFIG_PLAT_LOG_FUNCTION` is a configuration parameter (see `openthread-core-default-config.h`) which
  * specifies the function/macro to be used for logging in OpenThread. By default it is set to `otPlatLog()`.
@@ -1931,6 +1964,8 @@ const char *otLogLevelToPrefixString(otLogLevel aLogLevel);
 #define _otPlatLog(aLogLevel, aRegion, aFormat, ...) \
     OPENTHREAD_CONFIG_PLAT_LOG_FUNCTION(aLogLevel, aRegion, aFormat, ##__VA_ARGS__)
 
+#endif // OPENTHREAD_CONFIG_LOG_DEFERRED
+
 #ifdef __cplusplus
 };
 #endif
@@ -35,10 +35,14 @@
 
 #include "message.hpp"
 
+#include <openthread/platform/checksum.h>
+
 #include "common/code_utils.hpp"
 #include "common/debug.hpp"
+#include "common/encoding.hpp"
 #include "common/instance.hpp"
 #include "common/logging.hpp"
+#include "common/timer.hpp"
 #include "net/ip6.hpp"
 
 namespace ot {
@@ -63,6 +67,37 @@ MessagePool::MessagePool(Instance &aInstance)
     mBuffers[kNumBuffers - 1].SetNextBuffer(NULL);
     mNumFreeBuffers = kNumBuffers;
 #endif
+
+#if OPENTHREAD_CONFIG_NUM_MESSAGE_LARGE_BUFFERS
+    memset(mLargeBuffers, 0, sizeof(mLargeBuffers));
+
+    mFreeLargeBuffers = &mLargeBuffers[0].mBuffer;
+
+    for (uint16_t i = 0; i < kNumLargeBuffers - 1; i++)
+    {
+        mLargeBuffers[i].mBuffer.SetNextBuffer(&mLargeBuffers[i + 1].mBuffer);
+    }
+
+    mLargeBuffers[kNumLargeBuffers - 1].mBuffer.SetNextBuffer(NULL);
+    mNumFreeLargeBuffers = kNumLargeBuffers;
+#endif
+
+#if OPENTHREAD_CONFIG_ENABLE_SHARED_MESSAGE_BUFFERS
+    memset(mBufferShareCount, 0, sizeof(mBufferShareCount));
+#if OPENTHREAD_CONFIG_NUM_MESSAGE_LARGE_BUFFERS
+    memset(mLargeBufferShareCount, 0, sizeof(mLargeBufferShareCount));
+#endif
+#endif
+
+    memset(mBufferClassCount, 0, sizeof(mBufferClassCount));
+    memset(mTypeAllocFailures, 0, sizeof(mTypeAllocFailures));
+    memset(mSubTypeAllocFailures, 0, sizeof(mSubTypeAllocFailures));
+    mMaxUsedBuffers          = 0;
+    mNumBufferAllocations    = 0;
+    mNumPrependReallocations = 0;
+    mIsLowOnBuffers          = false;
+    mLowBufferStartTime      = 0;
+    mLowBufferTime           = 0;
 }
 
 Message *MessagePool::New(uint8_t aType, uint16_t aReserved, uint8_t aPriority)
@@ -70,9 +105,14 @@ Message *MessagePool::New(uint8_t aType, uint16_t aReserved, uint8_t aPriority)
     otError  error   = OT_ERROR_NONE;
     Message *message = NULL;
 
-    VerifyOrExit((message = static_cast<Message *>(NewBuffer(aPriority))) != NULL);
+    if ((message = static_cast<Message *>(NewBuffer(aPriority))) == NULL)
+    {
+        RecordAllocFailure(aType, Message::kSubTypeNone);
+        ExitNow();
+    }
 
     memset(message, 0, sizeof(*message));
+    mBufferClassCount[Message::kBufferClassDefault]++;
     message->SetMessagePool(this);
     message->SetType(aType);
     message->SetReserved(aReserved);
@@ -96,22 +136,26 @@ Message *MessagePool::New(uint8_t aType, uint16_t aReserved, const otMessageSett
     Message *message;
     bool     linkSecurityEnabled;
     uint8_t  priority;
+    uint32_t lifetime;
 
     if (aSettings == NULL)
     {
         linkSecurityEnabled = true;
         priority            = OT_MESSAGE_PRIORITY_NORMAL;
+        lifetime            = 0;
     }
     else
     {
         linkSecurityEnabled = aSettings->mLinkSecurityEnabled;
         priority            = aSettings->mPriority;
+        lifetime            = aSettings->mLifetime;
     }
 
     message = New(aType, aReserved, priority);
     if (message)
     {
         message->SetLinkSecurityEnabled(linkSecurityEnabled);
+        message->SetLifetime(lifetime);
     }
 
     return message;
@@ -119,18 +163,21 @@ Message *MessagePool::New(uint8_t aType, uint16_t aReserved, const otMessageSett
 
 void MessagePool::Free(Message *aMessage)
 {
+    uint8_t bufferClass = aMessage->GetBufferClass();
+
     assert(aMessage->Next(MessageInfo::kListAll) == NULL && aMessage->Prev(MessageInfo::kListAll) == NULL);
 
     assert(aMessage->Next(MessageInfo::kListInterface) == NULL && aMessage->Prev(MessageInfo::kListInterface) == NULL);
 
-    FreeBuffers(static_cast<Buffer *>(aMessage));
+    ReleaseBufferClassBuffers(bufferClass, FreeBuffers(static_cast<Buffer *>(aMessage)));
 }
 
 Buffer *MessagePool::NewBuffer(uint8_t aPriority)
 {
     Buffer *buffer = NULL;
 
-    SuccessOrExit(ReclaimBuffers(1, aPriority));
+    // Lower priority messages must leave the reserved buffers free for network control messages.
+    SuccessOrExit(ReclaimBuffers((aPriority == Message::kPriorityNet) ? 1 : 1 + kNumReservedBuffers, aPriority));
 
 #if OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT
 
@@ -152,16 +199,70 @@ Buffer *MessagePool::NewBuffer(uint8_t aPriority)
     {
         otLogInfoMem("No available message buffer");
     }
+    else
+    {
+        mNumBufferAllocations++;
+        UpdateBufferStats();
+    }
+
+exit:
+    return buffer;
+}
+
+#if OPENTHREAD_CONFIG_NUM_MESSAGE_LARGE_BUFFERS
+Buffer *MessagePool::NewLargeBuffer(void)
+{
+    Buffer *buffer = mFreeLargeBuffers;
+
+    VerifyOrExit(buffer != NULL);
+
+    mFreeLargeBuffers = buffer->GetNextBuffer();
+    buffer->SetNextBuffer(NULL);
+    mNumFreeLargeBuffers--;
+    mNumBufferAllocations++;
 
 exit:
     return buffer;
 }
 
-void MessagePool::FreeBuffers(Buffer *aBuffer)
+bool MessagePool::IsLargeBuffer(const Buffer *aBuffer) const
+{
+    const uint8_t *buffer = reinterpret_cast<const uint8_t *>(aBuffer);
+
+    return (buffer >= mLargeBuffers[0].mBytes) && (buffer < mLargeBuffers[0].mBytes + sizeof(mLargeBuffers));
+}
+#endif // OPENTHREAD_CONFIG_NUM_MESSAGE_LARGE_BUFFERS
+
+uint16_t MessagePool::FreeBuffers(Buffer *aBuffer)
 {
+    uint16_t numFreed = 0;
+
     while (aBuffer != NULL)
     {
         Buffer *tmpBuffer = aBuffer->GetNextBuffer();
+
+        numFreed++;
+
+#if OPENTHREAD_CONFIG_ENABLE_SHARED_MESSAGE_BUFFERS
+        if (GetBufferShareCount(aBuffer) > 0)
+        {
+            // The buffer (and so the rest of the chain) is still used by another message.
+            GetBufferShareCount(aBuffer)--;
+            aBuffer = tmpBuffer;
+            continue;
+        }
+#endif
+
+#if OPENTHREAD_CONFIG_NUM_MESSAGE_LARGE_BUFFERS
+        if (IsLargeBuffer(aBuffer))
+        {
+            aBuffer->SetNextBuffer(mFreeLargeBuffers);
+            mFreeLargeBuffers = aBuffer;
+            mNumFreeLargeBuffers++;
+            aBuffer = tmpBuffer;
+            continue;
+        }
+#endif
 #if OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT
         otPlatMessagePoolFree(&GetInstance(), aBuffer);
 #else  // OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT
@@ -171,8 +272,81 @@ void MessagePool::FreeBuffers(Buffer *aBuffer)
 #endif // OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT
         aBuffer = tmpBuffer;
     }
+
+    UpdateBufferStats();
+
+    return numFreed;
 }
 
+#if OPENTHREAD_CONFIG_ENABLE_SHARED_MESSAGE_BUFFERS
+uint8_t &MessagePool::GetBufferShareCount(const Buffer *aBuffer)
+{
+#if OPENTHREAD_CONFIG_NUM_MESSAGE_LARGE_BUFFERS
+    if (IsLargeBuffer(aBuffer))
+    {
+        return mLargeBufferShareCount[reinterpret_cast<const LargeBuffer *>(aBuffer) - mLargeBuffers];
+    }
+#endif
+
+    return mBufferShareCount[aBuffer - mBuffers];
+}
+
+bool MessagePool::ShareBuffers(Buffer *aBuffer)
+{
+    bool rval = false;
+
+    for (Buffer *curBuffer = aBuffer; curBuffer != NULL; curBuffer = curBuffer->GetNextBuffer())
+    {
+        VerifyOrExit(GetBufferShareCount(curBuffer) < kMaxBufferShareCount);
+    }
+
+    for (Buffer *curBuffer = aBuffer; curBuffer != NULL; curBuffer = curBuffer->GetNextBuffer())
+    {
+        GetBufferShareCount(curBuffer)++;
+    }
+
+    rval = true;
+
+exit:
+    return rval;
+}
+
+Buffer *MessagePool::CopySharedBuffer(Buffer *aBuffer, uint8_t aPriority)
+{
+    Buffer * buffer;
+    uint16_t size = sizeof(Buffer);
+
+#if OPENTHREAD_CONFIG_NUM_MESSAGE_LARGE_BUFFERS
+    if (IsLargeBuffer(aBuffer))
+    {
+        buffer = NewLargeBuffer();
+        size   = kLargeBufferSize;
+    }
+    else
+#endif
+    {
+        buffer = NewBuffer(aPriority);
+    }
+
+    VerifyOrExit(buffer != NULL);
+
+    // Allocating a buffer may evict (free) the other messages sharing `aBuffer`.
+    if (GetBufferShareCount(aBuffer) == 0)
+    {
+        FreeBuffers(buffer);
+        ExitNow(buffer = aBuffer);
+    }
+
+    memcpy(buffer, aBuffer, size);
+
+    // The copy continues with the same (shared) subsequent buffers, so only the copied buffer loses an owner.
+    GetBufferShareCount(aBuffer)--;
+
+exit:
+    return buffer;
+}
+#endif // OPENTHREAD_CONFIG_ENABLE_SHARED_MESSAGE_BUFFERS
+
 otError MessagePool::ReclaimBuffers(int aNumBuffers, uint8_t aPriority)
 {
 #if OPENTHREAD_MTD || OPENTHREAD_FTD
@@ -193,6 +367,96 @@ exit:
     return (aNumBuffers < 0 || aNumBuffers <= GetFreeBufferCount()) ? OT_ERROR_NONE : OT_ERROR_NO_BUFS;
 }
 
+uint16_t MessagePool::GetBufferClassLimit(uint8_t aBufferClass)
+{
+    uint16_t limit = 0;
+
+    switch (aBufferClass)
+    {
+    case Message::kBufferClassIndirect:
+        limit = OPENTHREAD_CONFIG_MAX_INDIRECT_MESSAGE_BUFFERS;
+        break;
+
+    case Message::kBufferClassCoapCache:
+        limit = OPENTHREAD_CONFIG_MAX_COAP_CACHE_MESSAGE_BUFFERS;
+        break;
+
+    case Message::kBufferClassReassembly:
+        limit = OPENTHREAD_CONFIG_MAX_REASSEMBLY_MESSAGE_BUFFERS;
+        break;
+
+    default:
+        break;
+    }
+
+    return limit;
+}
+
+otError MessagePool::ClaimBufferClassBuffers(uint8_t aBufferClass, uint16_t aNumBuffers)
+{
+    otError  error = OT_ERROR_NONE;
+    uint16_t limit = GetBufferClassLimit(aBufferClass);
+
+    VerifyOrExit(limit == 0 || mBufferClassCount[aBufferClass] + aNumBuffers <= limit, error = OT_ERROR_NO_BUFS);
+    mBufferClassCount[aBufferClass] += aNumBuffers;
+
+exit:
+    return error;
+}
+
+void MessagePool::ReleaseBufferClassBuffers(uint8_t aBufferClass, uint16_t aNumBuffers)
+{
+    assert(mBufferClassCount[aBufferClass] >= aNumBuffers);
+    mBufferClassCount[aBufferClass] -= aNumBuffers;
+}
+
+void MessagePool::RecordAllocFailure(uint8_t aType, uint8_t aSubType)
+{
+    assert(aType < Message::kNumTypes && aSubType < Message::kNumSubTypes);
+
+    mTypeAllocFailures[aType]++;
+    mSubTypeAllocFailures[aSubType]++;
+}
+
+void MessagePool::UpdateBufferStats(void)
+{
+    uint16_t numFree = GetFreeBufferCount();
+    bool     isLow   = (numFree < kLowBufferThreshold);
+
+    if (kNumBuffers - numFree > mMaxUsedBuffers)
+    {
+        mMaxUsedBuffers = kNumBuffers - numFree;
+    }
+
+    if (isLow != mIsLowOnBuffers)
+    {
+        uint32_t now = TimerMilli::GetNow();
+
+        if (isLow)
+        {
+            mLowBufferStartTime = now;
+        }
+        else
+        {
+            mLowBufferTime += now - mLowBufferStartTime;
+        }
+
+        mIsLowOnBuffers = isLow;
+    }
+}
+
+uint32_t MessagePool::GetLowBufferTime(void) const
+{
+    uint32_t lowBufferTime = mLowBufferTime;
+
+    if (mIsLowOnBuffers)
+    {
+        lowBufferTime += TimerMilli::GetNow() - mLowBufferStartTime;
+    }
+
+    return lowBufferTime;
+}
+
 uint16_t MessagePool::GetFreeBufferCount(void) const
 {
     uint16_t rval;
@@ -272,16 +536,67 @@ otError Message::ResizeMessage(uint16_t aLength)
     Buffer * lastBuffer;
     uint16_t curLength = kHeadBufferDataSize;
 
+#if OPENTHREAD_CONFIG_ENABLE_SHARED_MESSAGE_BUFFERS
+    while (curLength < aLength && curBuffer->GetNextBuffer() != NULL)
+    {
+        curBuffer = curBuffer->GetNextBuffer();
+        curLength += GetBufferDataSize(curBuffer);
+    }
+
+    // Adding or removing buffers relinks the last kept buffer, which must then not be shared.
+    if (curLength < aLength || curBuffer->GetNextBuffer() != NULL)
+    {
+        SuccessOrExit(error = UnshareBuffers(aLength));
+    }
+
+    curBuffer = this;
+    curLength = kHeadBufferDataSize;
+#endif
+
     while (curLength < aLength)
     {
         if (curBuffer->GetNextBuffer() == NULL)
         {
-            curBuffer->SetNextBuffer(GetMessagePool()->NewBuffer(GetPriority()));
-            VerifyOrExit(curBuffer->GetNextBuffer() != NULL, error = OT_ERROR_NO_BUFS);
+            Buffer *newBuffer = NULL;
+
+            if ((error = GetMessagePool()->ClaimBufferClassBuffers(GetBufferClass(), 1)) != OT_ERROR_NONE)
+            {
+                GetMessagePool()->RecordAllocFailure(GetType(), GetSubType());
+                ExitNow();
+            }
+
+#if OPENTHREAD_CONFIG_NUM_MESSAGE_LARGE_BUFFERS
+            // Use a large buffer if the remaining length does not fit in a single standard buffer.
+            if (aLength - curLength > kBufferDataSize)
+            {
+                newBuffer = GetMessagePool()->NewLargeBuffer();
+            }
+#endif
+
+            if (newBuffer == NULL)
+            {
+                newBuffer = GetMessagePool()->NewBuffer(GetPriority());
+            }
+
+#if OPENTHREAD_CONFIG_NUM_MESSAGE_LARGE_BUFFERS
+            if (newBuffer == NULL)
+            {
+                newBuffer = GetMessagePool()->NewLargeBuffer();
+            }
+#endif
+
+            if (newBuffer == NULL)
+            {
+                GetMessagePool()->ReleaseBufferClassBuffers(GetBufferClass(), 1);
+                GetMessagePool()->RecordAllocFailure(GetType(), GetSubType());
+                ExitNow(error = OT_ERROR_NO_BUFS);
+            }
+
+            curBuffer->SetNextBuffer(newBuffer);
         }
 
         curBuffer = curBuffer->GetNextBuffer();
-        curLength += kBufferDataSize;
+        curLength += GetBufferDataSize(curBuffer);
     }
 
     // remove buffers
@@ -289,12 +604,55 @@ otError Message::ResizeMessage(uint16_t aLength)
     curBuffer  = curBuffer->GetNextBuffer();
     lastBuffer->SetNextBuffer(NULL);
 
-    GetMessagePool()->FreeBuffers(curBuffer);
+    GetMessagePool()->ReleaseBufferClassBuffers(GetBufferClass(), GetMessagePool()->FreeBuffers(curBuffer));
 
 exit:
     return error;
 }
 
+#if OPENTHREAD_CONFIG_ENABLE_SHARED_MESSAGE_BUFFERS
+otError Message::UnshareBuffers(uint16_t aLength)
+{
+    otError  error      = OT_ERROR_NONE;
+    Buffer * prevBuffer = this;
+    uint16_t curLength  = kHeadBufferDataSize;
+
+    while (curLength < aLength && prevBuffer->GetNextBuffer() != NULL)
+    {
+        Buffer *curBuffer = prevBuffer->GetNextBuffer();
+
+        if (GetMessagePool()->GetBufferShareCount(curBuffer) > 0)
+        {
+            if ((curBuffer = GetMessagePool()->CopySharedBuffer(curBuffer, GetPriority())) == NULL)
+            {
+                GetMessagePool()->RecordAllocFailure(GetType(), GetSubType());
+                ExitNow(error = OT_ERROR_NO_BUFS);
+            }
+
+            prevBuffer->SetNextBuffer(curBuffer);
+        }
+
+        prevBuffer = curBuffer;
+        curLength += GetBufferDataSize(curBuffer);
+    }
+
+exit:
+    return error;
+}
+#endif // OPENTHREAD_CONFIG_ENABLE_SHARED_MESSAGE_BUFFERS
+
+uint16_t Message::GetBufferDataSize(const Buffer *aBuffer) const
+{
+#if OPENTHREAD_CONFIG_NUM_MESSAGE_LARGE_BUFFERS
+    return GetMessagePool()->IsLargeBuffer(aBuffer) ? static_cast<uint16_t>(MessagePool::kLargeBufferDataSize)
+                                                    : static_cast<uint16_t>(kBufferDataSize);
+#else
+    OT_UNUSED_VARIABLE(aBuffer);
+
+    return kBufferDataSize;
+#endif
+}
+
 void Message::Free(void)
 {
     GetMessagePool()->Free(this);
@@ -341,7 +699,22 @@ otError Message::SetLength(uint16_t aLength)
         bufs -= (((totalLengthCurrent - kHeadBufferDataSize) - 1) / kBufferDataSize) + 1;
     }
 
-    SuccessOrExit(error = GetMessagePool()->ReclaimBuffers(bufs, GetPriority()));
+    if (bufs > 0 && GetPriority() != kPriorityNet)
+    {
+        bufs += MessagePool::GetReservedBufferCount();
+    }
+
+#if OPENTHREAD_CONFIG_NUM_MESSAGE_LARGE_BUFFERS
+    // Free large buffers are used before evicting messages to reclaim standard buffers (`ResizeMessage()`).
+    if (GetMessagePool()->GetFreeLargeBufferCount() == 0)
+#endif
+    {
+        if ((error = GetMessagePool()->ReclaimBuffers(bufs, GetPriority())) != OT_ERROR_NONE)
+        {
+            GetMessagePool()->RecordAllocFailure(GetType(), GetSubType());
+            ExitNow();
+        }
+    }
 
     SuccessOrExit(error = ResizeMessage(totalLengthRequest));
     mBuffer.mHead.mInfo.mLength = aLength;
@@ -440,6 +813,23 @@ exit:
     return error;
 }
 
+otError Message::SetBufferClass(uint8_t aBufferClass)
+{
+    otError error       = OT_ERROR_NONE;
+    uint8_t bufferCount = GetBufferCount();
+
+    assert(aBufferClass < kNumBufferClasses);
+
+    VerifyOrExit(aBufferClass != GetBufferClass());
+
+    SuccessOrExit(error = GetMessagePool()->ClaimBufferClassBuffers(aBufferClass, bufferCount));
+    GetMessagePool()->ReleaseBufferClassBuffers(GetBufferClass(), bufferCount);
+    mBuffer.mHead.mInfo.mBufferClass = aBufferClass;
+
+exit:
+    return error;
+}
+
 otError Message::Append(const void *aBuf, uint16_t aLength)
 {
     otError  error     = OT_ERROR_NONE;
@@ -463,10 +853,22 @@ otError Message::Prepend(const void *aBuf, uint16_t aLength)
 
     while (aLength > GetReserved())
     {
-        VerifyOrExit((newBuffer = GetMessagePool()->NewBuffer(GetPriority())) != NULL, error = OT_ERROR_NO_BUFS);
+        if ((error = GetMessagePool()->ClaimBufferClassBuffers(GetBufferClass(), 1)) != OT_ERROR_NONE)
+        {
+            GetMessagePool()->RecordAllocFailure(GetType(), GetSubType());
+            ExitNow();
+        }
+
+        if ((newBuffer = GetMessagePool()->NewBuffer(GetPriority())) == NULL)
+        {
+            GetMessagePool()->ReleaseBufferClassBuffers(GetBufferClass(), 1);
+            GetMessagePool()->RecordAllocFailure(GetType(), GetSubType());
+            ExitNow(error = OT_ERROR_NO_BUFS);
+        }
 
         newBuffer->SetNextBuffer(GetNextBuffer());
         SetNextBuffer(newBuffer);
+        GetMessagePool()->mNumPrependReallocations++;
 
         if (GetReserved() < sizeof(mBuffer.mHead.mData))
         {
@@ -482,6 +884,9 @@ otError Message::Prepend(const void *aBuf, uint16_t aLength)
     mBuffer.mHead.mInfo.mLength += aLength;
     SetOffset(GetOffset() + aLength);
 
+    // Any recorded transport information no longer matches the message layout.
+    mBuffer.mHead.mInfo.mHasPacketInfo = false;
+
     if (aBuf != NULL)
     {
         Write(0, aLength, aBuf);
@@ -498,6 +903,8 @@ otError Message::RemoveHeader(uint16_t aLength)
     mBuffer.mHead.mInfo.mReserved += aLength;
     mBuffer.mHead.mInfo.mLength -= aLength;
 
+    mBuffer.mHead.mInfo.mHasPacketInfo = false;
+
     if (mBuffer.mHead.mInfo.mOffset > aLength)
     {
         mBuffer.mHead.mInfo.mOffset -= aLength;
@@ -510,14 +917,16 @@ otError Message::RemoveHeader(uint16_t aLength)
     return OT_ERROR_NONE;
 }
 
-uint16_t Message::Read(uint16_t aOffset, uint16_t aLength, void *aBuf) const
+void Message::GetFirstChunk(uint16_t aOffset, uint16_t &aLength, Chunk &aChunk) const
 {
-    Buffer * curBuffer;
-    uint16_t bytesCopied = 0;
-    uint16_t bytesToCopy;
+    const Buffer *curBuffer;
+
+    aChunk.mLength = 0;
+    aChunk.mBuffer = NULL;
 
     if (aOffset >= GetLength())
     {
+        aLength = 0;
         ExitNow();
     }
 
@@ -531,132 +940,116 @@ uint16_t Message::Read(uint16_t aOffset, uint16_t aLength, void *aBuf) const
     // special case first buffer
     if (aOffset < kHeadBufferDataSize)
     {
-        bytesToCopy = kHeadBufferDataSize - aOffset;
-
-        if (bytesToCopy > aLength)
-        {
-            bytesToCopy = aLength;
-        }
-
-        memcpy(aBuf, GetFirstData() + aOffset, bytesToCopy);
-
-        aLength -= bytesToCopy;
-        bytesCopied += bytesToCopy;
-        aBuf = static_cast<uint8_t *>(aBuf) + bytesToCopy;
-
-        aOffset = 0;
+        aChunk.mData   = GetFirstData() + aOffset;
+        aChunk.mLength = kHeadBufferDataSize - aOffset;
+        aChunk.mBuffer = this;
     }
     else
     {
         aOffset -= kHeadBufferDataSize;
-    }
-
-    // advance to offset
-    curBuffer = GetNextBuffer();
-
-    while (aOffset >= kBufferDataSize)
-    {
-        assert(curBuffer != NULL);
-
-        curBuffer = curBuffer->GetNextBuffer();
-        aOffset -= kBufferDataSize;
-    }
-
-    // begin copy
-    while (aLength > 0)
-    {
-        assert(curBuffer != NULL);
 
-        bytesToCopy = kBufferDataSize - aOffset;
+        // advance to offset
+        curBuffer = GetNextBuffer();
 
-        if (bytesToCopy > aLength)
+        while (aOffset >= GetBufferDataSize(curBuffer))
         {
-            bytesToCopy = aLength;
+            assert(curBuffer != NULL);
+
+            aOffset -= GetBufferDataSize(curBuffer);
+            curBuffer = curBuffer->GetNextBuffer();
         }
 
-        memcpy(aBuf, curBuffer->GetData() + aOffset, bytesToCopy);
+        assert(curBuffer != NULL);
 
-        aLength -= bytesToCopy;
-        bytesCopied += bytesToCopy;
-        aBuf = static_cast<uint8_t *>(aBuf) + bytesToCopy;
+        aChunk.mData   = curBuffer->GetData() + aOffset;
+        aChunk.mLength = GetBufferDataSize(curBuffer) - aOffset;
+        aChunk.mBuffer = curBuffer;
+    }
 
-        curBuffer = curBuffer->GetNextBuffer();
-        aOffset   = 0;
+    if (aChunk.mLength > aLength)
+    {
+        aChunk.mLength = aLength;
     }
 
+    aLength -= aChunk.mLength;
+
 exit:
-    return bytesCopied;
+    return;
 }
 
-int Message::Write(uint16_t aOffset, uint16_t aLength, const void *aBuf)
+void Message::GetNextChunk(uint16_t &aLength, Chunk &aChunk) const
 {
-    Buffer * curBuffer;
-    uint16_t bytesCopied = 0;
-    uint16_t bytesToCopy;
+    VerifyOrExit(aLength > 0, aChunk.mLength = 0);
 
-    assert(aOffset + aLength <= GetLength());
+    aChunk.mBuffer = aChunk.mBuffer->GetNextBuffer();
+    assert(aChunk.mBuffer != NULL);
 
-    if (aOffset + aLength >= GetLength())
-    {
-        aLength = GetLength() - aOffset;
-    }
+    aChunk.mData   = aChunk.mBuffer->GetData();
+    aChunk.mLength = GetBufferDataSize(aChunk.mBuffer);
 
-    aOffset += GetReserved();
-
-    // special case first buffer
-    if (aOffset < kHeadBufferDataSize)
+    if (aChunk.mLength > aLength)
     {
-        bytesToCopy = kHeadBufferDataSize - aOffset;
-
-        if (bytesToCopy > aLength)
-        {
-            bytesToCopy = aLength;
-        }
+        aChunk.mLength = aLength;
+    }
 
-        memcpy(GetFirstData() + aOffset, aBuf, bytesToCopy);
+    aLength -= aChunk.mLength;
 
-        aLength -= bytesToCopy;
-        bytesCopied += bytesToCopy;
-        aBuf = static_cast<const uint8_t *>(aBuf) + bytesToCopy;
+exit:
+    return;
+}
 
-        aOffset = 0;
-    }
-    else
+void Message::GetFirstChunk(uint16_t aOffset, uint16_t &aLength, WritableChunk &aChunk)
+{
+#if OPENTHREAD_CONFIG_ENABLE_SHARED_MESSAGE_BUFFERS
+    if (UnshareBuffers(GetReserved() + aOffset + aLength) != OT_ERROR_NONE)
     {
-        aOffset -= kHeadBufferDataSize;
+        aChunk.mLength = 0;
+        aChunk.mBuffer = NULL;
+        aLength        = 0;
+        ExitNow();
     }
+#endif
 
-    // advance to offset
-    curBuffer = GetNextBuffer();
+    static_cast<const Message *>(this)->GetFirstChunk(aOffset, aLength, static_cast<Chunk &>(aChunk));
 
-    while (aOffset >= kBufferDataSize)
-    {
-        assert(curBuffer != NULL);
+#if OPENTHREAD_CONFIG_ENABLE_SHARED_MESSAGE_BUFFERS
+exit:
+#endif
+    return;
+}
 
-        curBuffer = curBuffer->GetNextBuffer();
-        aOffset -= kBufferDataSize;
-    }
+uint16_t Message::Read(uint16_t aOffset, uint16_t aLength, void *aBuf) const
+{
+    uint16_t bytesCopied = 0;
+    Chunk    chunk;
 
-    // begin copy
-    while (aLength > 0)
+    GetFirstChunk(aOffset, aLength, chunk);
+
+    while (chunk.mLength > 0)
     {
-        assert(curBuffer != NULL);
+        memcpy(static_cast<uint8_t *>(aBuf) + bytesCopied, chunk.mData, chunk.mLength);
+        bytesCopied += chunk.mLength;
+        GetNextChunk(aLength, chunk);
+    }
 
-        bytesToCopy = kBufferDataSize - aOffset;
+    return bytesCopied;
+}
 
-        if (bytesToCopy > aLength)
-        {
-            bytesToCopy = aLength;
-        }
+int Message::Write(uint16_t aOffset, uint16_t aLength, const void *aBuf)
+{
+    uint16_t      bytesCopied = 0;
+    WritableChunk chunk;
 
-        memcpy(curBuffer->GetData() + aOffset, aBuf, bytesToCopy);
+    assert(aOffset + aLength <= GetLength());
 
-        aLength -= bytesToCopy;
-        bytesCopied += bytesToCopy;
-        aBuf = static_cast<const uint8_t *>(aBuf) + bytesToCopy;
+    GetFirstChunk(aOffset, aLength, chunk);
 
-        curBuffer = curBuffer->GetNextBuffer();
-        aOffset   = 0;
+    while (chunk.mLength > 0)
+    {
+        // `memmove()` is used since `CopyTo()` may write a chunk of this same message to a lower offset.
+        memmove(chunk.GetData(), static_cast<const uint8_t *>(aBuf) + bytesCopied, chunk.mLength);
+        bytesCopied += chunk.mLength;
+        GetNextChunk(aLength, chunk);
     }
 
     return bytesCopied;
@@ -665,20 +1058,21 @@ int Message::Write(uint16_t aOffset, uint16_t aLength, const void *aBuf)
 int Message::CopyTo(uint16_t aSourceOffset, uint16_t aDestinationOffset, uint16_t aLength, Message &aMessage) const
 {
     uint16_t bytesCopied = 0;
-    uint16_t bytesToCopy;
-    uint8_t  buf[16];
+    Chunk    chunk;
 
-    while (aLength > 0)
-    {
-        bytesToCopy = (aLength < sizeof(buf)) ? aLength : sizeof(buf);
+    // The source chunks are written directly into the destination message. When copying within the same message,
+    // this is safe as long as the destination offset is not after the source offset.
 
-        Read(aSourceOffset, bytesToCopy, buf);
-        aMessage.Write(aDestinationOffset, bytesToCopy, buf);
+    assert(&aMessage != this || aDestinationOffset <= aSourceOffset);
 
-        aSourceOffset += bytesToCopy;
-        aDestinationOffset += bytesToCopy;
-        aLength -= bytesToCopy;
-        bytesCopied += bytesToCopy;
+    GetFirstChunk(aSourceOffset, aLength, chunk);
+
+    while (chunk.mLength > 0)
+    {
+        aMessage.Write(aDestinationOffset, chunk.mLength, chunk.mData);
+        aDestinationOffset += chunk.mLength;
+        bytesCopied += chunk.mLength;
+        GetNextChunk(aLength, chunk);
     }
 
     return bytesCopied;
@@ -691,14 +1085,36 @@ Message *Message::Clone(uint16_t aLength) const
 
     VerifyOrExit((messageCopy = GetMessagePool()->New(GetType(), GetReserved(), GetPriority())) != NULL,
                  error = OT_ERROR_NO_BUFS);
-    SuccessOrExit(error = messageCopy->SetLength(aLength));
-    CopyTo(0, 0, aLength, *messageCopy);
+
+#if OPENTHREAD_CONFIG_ENABLE_SHARED_MESSAGE_BUFFERS
+    if (aLength <= GetLength() && GetMessagePool()->ShareBuffers(GetNextBuffer()))
+    {
+        // The clone gets a copy of the head buffer data and references the subsequent buffers of this message.
+        memcpy(messageCopy->GetFirstData(), GetFirstData(), sizeof(mBuffer.mHead.mData));
+        messageCopy->SetNextBuffer(GetNextBuffer());
+        messageCopy->mBuffer.mHead.mInfo.mLength = aLength;
+        GetMessagePool()->mBufferClassCount[kBufferClassDefault] += GetBufferCount() - 1;
+    }
+    else
+#endif
+    {
+        SuccessOrExit(error = messageCopy->SetLength(aLength));
+        CopyTo(0, 0, aLength, *messageCopy);
+    }
 
     // Copy selected message information.
     messageCopy->SetOffset(GetOffset());
     messageCopy->SetInterfaceId(GetInterfaceId());
     messageCopy->SetSubType(GetSubType());
     messageCopy->SetLinkSecurityEnabled(IsLinkSecurityEnabled());
+    messageCopy->mBuffer.mHead.mInfo.mHasExpiry  = mBuffer.mHead.mInfo.mHasExpiry;
+    messageCopy->mBuffer.mHead.mInfo.mExpiryTime = mBuffer.mHead.mInfo.mExpiryTime;
+
+    if (aLength == GetLength())
+    {
+        messageCopy->mBuffer.mHead.mInfo.mHasPacketInfo = mBuffer.mHead.mInfo.mHasPacketInfo;
+        messageCopy->mBuffer.mHead.mInfo.mPacketInfo    = mBuffer.mHead.mInfo.mPacketInfo;
+    }
 #if OPENTHREAD_CONFIG_ENABLE_TIME_SYNC
     messageCopy->SetTimeSync(IsTimeSync());
 #endif
@@ -714,6 +1130,14 @@ exit:
     return messageCopy;
 }
 
+void Message::SetLifetime(uint32_t aLifetime)
+{
+    mBuffer.mHead.mInfo.mHasExpiry  = (aLifetime != 0);
+    mBuffer.mHead.mInfo.mExpiryTime = TimerMilli::GetNow() + aLifetime;
+}
+
+#if OPENTHREAD_FTD
+
 bool Message::GetChildMask(uint8_t aChildIndex) const
 {
     assert(aChildIndex < sizeof(mBuffer.mHead.mInfo.mChildMask) * 8);
@@ -748,86 +1172,96 @@ exit:
     return rval;
 }
 
+#else // OPENTHREAD_FTD
+
+bool Message::IsChildPending(void) const
+{
+    return false;
+}
+
+#endif // OPENTHREAD_FTD
+
 uint16_t Message::UpdateChecksum(uint16_t aChecksum, uint16_t aValue)
 {
     uint16_t result = aChecksum + aValue;
     return result + (result < aChecksum);
 }
 
-uint16_t Message::UpdateChecksum(uint16_t aChecksum, const void *aBuf, uint16_t aLength)
+#if !OPENTHREAD_CONFIG_PLATFORM_CHECKSUM
+static inline uint32_t AddWithCarry(uint32_t aSum, uint32_t aValue)
 {
-    const uint8_t *bytes = reinterpret_cast<const uint8_t *>(aBuf);
-
-    for (int i = 0; i < aLength; i++)
-    {
-        aChecksum = UpdateChecksum(aChecksum, (i & 1) ? bytes[i] : static_cast<uint16_t>(bytes[i] << 8));
-    }
-
-    return aChecksum;
+    aSum += aValue;
+    return aSum + (aSum < aValue);
 }
+#endif
 
-uint16_t Message::UpdateChecksum(uint16_t aChecksum, uint16_t aOffset, uint16_t aLength) const
+uint16_t Message::UpdateChecksum(uint16_t aChecksum, const void *aBuf, uint16_t aLength)
 {
-    Buffer * curBuffer;
-    uint16_t bytesCovered = 0;
-    uint16_t bytesToCover;
-
-    assert(aOffset + aLength <= GetLength());
+#if OPENTHREAD_CONFIG_PLATFORM_CHECKSUM
+    return otPlatChecksumUpdate(aChecksum, static_cast<const uint8_t *>(aBuf), aLength);
+#else
+    const uint8_t *bytes = static_cast<const uint8_t *>(aBuf);
+    uint32_t       sum   = 0;
+    uint32_t       word;
+    uint16_t       halfWord;
 
-    aOffset += GetReserved();
+    // The one's complement sum is independent of byte order (RFC 1071), so the buffer is added a 32-bit word at a
+    // time in host byte order (with end-around carry), then folded to 16 bits and swapped to network byte order.
 
-    // special case first buffer
-    if (aOffset < kHeadBufferDataSize)
+    while (aLength >= sizeof(word))
     {
-        bytesToCover = kHeadBufferDataSize - aOffset;
-
-        if (bytesToCover > aLength)
-        {
-            bytesToCover = aLength;
-        }
-
-        aChecksum = Message::UpdateChecksum(aChecksum, GetFirstData() + aOffset, bytesToCover);
-
-        aLength -= bytesToCover;
-        bytesCovered += bytesToCover;
+        memcpy(&word, bytes, sizeof(word));
+        sum = AddWithCarry(sum, word);
+        bytes += sizeof(word);
+        aLength -= sizeof(word);
+    }
 
-        aOffset = 0;
+    if (aLength >= sizeof(halfWord))
+    {
+        memcpy(&halfWord, bytes, sizeof(halfWord));
+        sum = AddWithCarry(sum, halfWord);
+        bytes += sizeof(halfWord);
+        aLength -= sizeof(halfWord);
     }
-    else
+
+    if (aLength > 0)
     {
-        aOffset -= kHeadBufferDataSize;
+        // The last odd byte is the high-order byte of a big-endian 16-bit word padded with zero.
+        sum = AddWithCarry(sum, Encoding::BigEndian::HostSwap16(static_cast<uint16_t>(*bytes << 8)));
     }
 
-    // advance to offset
-    curBuffer = GetNextBuffer();
+    sum = (sum & 0xffff) + (sum >> 16);
+    sum = (sum & 0xffff) + (sum >> 16);
 
-    while (aOffset >= kBufferDataSize)
-    {
-        assert(curBuffer != NULL);
+    return UpdateChecksum(aChecksum, Encoding::BigEndian::HostSwap16(static_cast<uint16_t>(sum)));
+#endif
+}
 
-        curBuffer = curBuffer->GetNextBuffer();
-        aOffset -= kBufferDataSize;
-    }
+uint16_t Message::UpdateChecksum(uint16_t aChecksum, uint16_t aOffset, uint16_t aLength) const
+{
+    uint16_t bytesCovered = 0;
+    Chunk    chunk;
 
-    // begin copy
-    while (aLength > 0)
-    {
-        assert(curBuffer != NULL);
+    assert(aOffset + aLength <= GetLength());
 
-        bytesToCover = kBufferDataSize - aOffset;
+    GetFirstChunk(aOffset, aLength, chunk);
 
-        if (bytesToCover > aLength)
+    while (chunk.mLength > 0)
+    {
+        const uint8_t *data   = chunk.mData;
+        uint16_t       length = chunk.mLength;
+
+        if (bytesCovered & 1)
         {
-            bytesToCover = aLength;
+            // The chunk starts at an odd position, so its first byte is the low-order byte of a 16-bit word.
+            aChecksum = Message::UpdateChecksum(aChecksum, static_cast<uint16_t>(*data));
+            data++;
+            length--;
         }
 
-        aChecksum = Message::UpdateChecksum(aChecksum, curBuffer->GetData() + aOffset, bytesToCover);
-
-        aLength -= bytesToCover;
-        bytesCovered += bytesToCover;
-
-        curBuffer = curBuffer->GetNextBuffer();
-        aOffset   = 0;
+        aChecksum = Message::UpdateChecksum(aChecksum, data, length);
+        bytesCovered += chunk.mLength;
+        GetNextChunk(aLength, chunk);
     }
 
     return aChecksum;
@@ -848,6 +1282,7 @@ void Message::SetPriorityQueue(PriorityQueue *aPriorityQueue)
 MessageQueue::MessageQueue(void)
 {
     SetTail(NULL);
+    mMaxBuffers = 0;
 }
 
 void MessageQueue::AddToList(uint8_t aList, Message &aMessage, QueuePosition aPosition)
@@ -917,6 +1352,39 @@ otError MessageQueue::Enqueue(Message &aMessage, QueuePosition aPosition)
     // Any new message is always added to the end of the `AllMessageQueue` list.
     aMessage.GetMessagePool()->GetAllMessagesQueue()->AddToList(MessageInfo::kListAll, aMessage);
 
+    UpdateMaxBufferCount();
+
+exit:
+    return error;
+}
+
+otError MessageQueue::EnqueueBefore(Message &aMessage, Message &aNext)
+{
+    otError  error = OT_ERROR_NONE;
+    Message *prev;
+
+    VerifyOrExit(!aMessage.IsInAQueue(), error = OT_ERROR_ALREADY);
+    VerifyOrExit(aNext.GetMessageQueue() == this, error = OT_ERROR_NOT_FOUND);
+
+    if (&aNext == GetHead())
+    {
+        ExitNow(error = Enqueue(aMessage, kQueuePositionHead));
+    }
+
+    aMessage.SetMessageQueue(this);
+
+    // `aNext` is not the head, so the new message goes between two existing ones and the tail does not change.
+    prev = aNext.Prev(MessageInfo::kListInterface);
+
+    aMessage.Next(MessageInfo::kListInterface) = &aNext;
+    aMessage.Prev(MessageInfo::kListInterface) = prev;
+    prev->Next(MessageInfo::kListInterface)    = &aMessage;
+    aNext.Prev(MessageInfo::kListInterface)    = &aMessage;
+
+    aMessage.GetMessagePool()->GetAllMessagesQueue()->AddToList(MessageInfo::kListAll, aMessage);
+
+    UpdateMaxBufferCount();
+
 exit:
     return error;
 }
@@ -948,12 +1416,27 @@ void MessageQueue::GetInfo(uint16_t &aMessageCount, uint16_t &aBufferCount) cons
     }
 }
 
+void MessageQueue::UpdateMaxBufferCount(void)
+{
+    uint16_t messageCount;
+    uint16_t bufferCount;
+
+    GetInfo(messageCount, bufferCount);
+
+    if (bufferCount > mMaxBuffers)
+    {
+        mMaxBuffers = bufferCount;
+    }
+}
+
 PriorityQueue::PriorityQueue(void)
 {
     for (int priority = 0; priority < Message::kNumPriorities; priority++)
     {
         mTails[priority] = NULL;
     }
+
+    mMaxBuffers = 0;
 }
 
 Message *PriorityQueue::FindFirstNonNullTail(uint8_t aStartPriorityLevel) const
@@ -1078,6 +1561,8 @@ otError PriorityQueue::Enqueue(Message &aMessage)
     AddToList(MessageInfo::kListInterface, aMessage);
     aMessage.GetMessagePool()->GetAllMessagesQueue()->AddToList(MessageInfo::kListAll, aMessage);
 
+    UpdateMaxBufferCount();
+
 exit:
     return error;
 }
@@ -1109,4 +1594,17 @@ void PriorityQueue::GetInfo(uint16_t &aMessageCount, uint16_t &aBufferCount) con
     }
 }
 
+void PriorityQueue::UpdateMaxBufferCount(void)
+{
+    uint16_t messageCount;
+    uint16_t bufferCount;
+
+    GetInfo(messageCount, bufferCount);
+
+    if (bufferCount > mMaxBuffers)
+    {
+        mMaxBuffers = bufferCount;
+    }
+}
+
 } // namespace ot
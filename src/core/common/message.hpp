@@ -43,6 +43,7 @@
 #include <openthread/platform/messagepool.h>
 
 #include "common/code_utils.hpp"
+#include "common/encoding.hpp"
 #include "common/locator.hpp"
 #include "mac/mac_frame.hpp"
 #include "thread/link_quality.hpp"
@@ -61,8 +62,10 @@ namespace ot {
 
 enum
 {
-    kNumBuffers = OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS,
-    kBufferSize = OPENTHREAD_CONFIG_MESSAGE_BUFFER_SIZE,
+    kNumBuffers      = OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS,
+    kBufferSize      = OPENTHREAD_CONFIG_MESSAGE_BUFFER_SIZE,
+    kNumLargeBuffers = OPENTHREAD_CONFIG_NUM_MESSAGE_LARGE_BUFFERS,
+    kLargeBufferSize = OPENTHREAD_CONFIG_MESSAGE_LARGE_BUFFER_SIZE,
 };
 
 class Message;
@@ -70,6 +73,19 @@ class MessagePool;
 class MessageQueue;
 class PriorityQueue;
 
+/**
+ * This structure contains the transport information of an IPv6 message, recorded once the IPv6 extension headers
+ * have been processed.
+ *
+ */
+struct PacketInfo
+{
+    uint16_t mTransportOffset; ///< The byte offset of the upper-layer header within the message.
+    uint16_t mSourcePort;      ///< The UDP/TCP source port (zero for other protocols).
+    uint16_t mDestinationPort; ///< The UDP/TCP destination port (zero for other protocols).
+    uint8_t  mIpProto;         ///< The upper-layer protocol (the next header following the extension headers).
+};
+
 /**
  * This structure contains metdata about a Message.
  *
@@ -98,26 +114,41 @@ struct MessageInfo
     uint16_t    mDatagramTag; ///< The datagram tag used for 6LoWPAN fragmentation.
     RssAverager mRssAverager; ///< The averager maintaining the received signal strength (RSS) average.
 
-    uint8_t mChildMask[8]; ///< A bit-vector to indicate which sleepy children need to receive this.
-    uint8_t mTimeout;      ///< Seconds remaining before dropping the message.
-    int8_t  mInterfaceId;  ///< The interface ID.
+    uint8_t mTimeout;     ///< Seconds remaining before dropping the message.
+    int8_t  mInterfaceId; ///< The interface ID.
     union
     {
         uint16_t mPanId;   ///< Used for MLE Discover Request and Response messages.
         uint8_t  mChannel; ///< Used for MLE Announce.
     } mPanIdChannel;       ///< Used for MLE Discover Request, Response, and Announce messages.
 
-    uint8_t mType : 2;         ///< Identifies the type of message.
-    uint8_t mSubType : 4;      ///< Identifies the message sub type.
-    bool    mDirectTx : 1;     ///< Used to indicate whether a direct transmission is required.
-    bool    mLinkSecurity : 1; ///< Indicates whether or not link security is enabled.
-    uint8_t mPriority : 2;     ///< Identifies the message priority level (lower value is higher priority).
-    bool    mInPriorityQ : 1;  ///< Indicates whether the message is queued in normal or priority queue.
-    bool    mTxSuccess : 1;    ///< Indicates whether the direct tx of the message was successful.
+    uint8_t mType : 2;          ///< Identifies the type of message.
+    uint8_t mSubType : 4;       ///< Identifies the message sub type.
+    bool    mDirectTx : 1;      ///< Used to indicate whether a direct transmission is required.
+    bool    mLinkSecurity : 1;  ///< Indicates whether or not link security is enabled.
+    uint8_t mPriority : 2;      ///< Identifies the message priority level (lower value is higher priority).
+    bool    mInPriorityQ : 1;   ///< Indicates whether the message is queued in normal or priority queue.
+    bool    mTxSuccess : 1;     ///< Indicates whether the direct tx of the message was successful.
+    uint8_t mBufferClass : 2;   ///< Identifies the buffer class (used for per-class buffer quotas).
+    bool    mHasExpiry : 1;     ///< Indicates whether `mExpiryTime` is valid.
+    bool    mHasPacketInfo : 1; ///< Indicates whether `mPacketInfo` is valid.
+#if OPENTHREAD_FTD
+    uint8_t mChildMask[BitVectorBytes(OPENTHREAD_CONFIG_MAX_CHILDREN)]; ///< Sleepy children that need to receive this.
+#endif
 #if OPENTHREAD_CONFIG_ENABLE_TIME_SYNC
     bool    mTimeSync : 1;      ///< Indicates whether the message is also used for time sync purpose.
     uint8_t mTimeSyncSeq;       ///< The time sync sequence.
     int64_t mNetworkTimeOffset; ///< The time offset to the Thread network time, in microseconds.
+#endif
+    uint32_t   mExpiryTime; ///< The time after which the message is discarded instead of sent (milliseconds).
+    PacketInfo mPacketInfo; ///< The transport information of an IPv6 message (valid if `mHasPacketInfo` is set).
+#if OPENTHREAD_CONFIG_ENABLE_SEND_QUEUE_AQM || OPENTHREAD_CONFIG_ENABLE_MESSAGE_TRACE
+    uint32_t mEnqueueTime; ///< The time the message was added to the send queue (milliseconds).
+#endif
+#if OPENTHREAD_CONFIG_ENABLE_MESSAGE_TRACE
+    uint32_t mDequeueTime; ///< The time the message was first picked from the send queue (milliseconds).
+    uint32_t mTxStartTime; ///< The time the first frame of the message was handed to the MAC (milliseconds).
+    uint32_t mTxDoneTime;  ///< The time the transmission of the message completed (milliseconds).
 #endif
 };
 
@@ -128,6 +159,7 @@ struct MessageInfo
 class Buffer : public ::otMessage
 {
     friend class Message;
+    friend class MessagePool;
 
 public:
     /**
@@ -194,6 +226,21 @@ private:
     } mBuffer;
 };
 
+#if OPENTHREAD_CONFIG_NUM_MESSAGE_LARGE_BUFFERS
+/**
+ * This type represents a large message buffer.
+ *
+ * A large buffer has the same layout as a `Buffer` but provides `kLargeBufferSize` bytes (instead of `kBufferSize`).
+ * Large buffers are only used as subsequent (non-head) buffers of a message.
+ *
+ */
+union LargeBuffer
+{
+    Buffer  mBuffer;                  ///< The buffer.
+    uint8_t mBytes[kLargeBufferSize]; ///< The storage for the large buffer.
+};
+#endif
+
 /**
  * This class represents a message.
  *
@@ -211,6 +258,8 @@ public:
         kType6lowpan     = 1, ///< A 6lowpan frame
         kTypeMacDataPoll = 2, ///< A MAC data poll message
         kTypeSupervision = 3, ///< A child supervision frame.
+
+        kNumTypes = OT_BUFFER_INFO_NUM_MESSAGE_TYPES, ///< Number of message types.
     };
 
     enum
@@ -225,6 +274,8 @@ public:
         kSubTypeJoinerFinalizeResponse = 7, ///< Joiner Finalize Response
         kSubTypeMleChildUpdateRequest  = 8, ///< MLE Child Update Request
         kSubTypeMleDataResponse        = 9, ///< MLE Data Response
+
+        kNumSubTypes = OT_BUFFER_INFO_NUM_MESSAGE_SUBTYPES, ///< Number of message sub types.
     };
 
     enum
@@ -237,6 +288,20 @@ public:
         kNumPriorities = 4, ///< Number of priority levels.
     };
 
+    /**
+     * This enumeration defines the buffer classes used by `MessagePool` to enforce per-class buffer quotas.
+     *
+     */
+    enum
+    {
+        kBufferClassDefault    = 0, ///< Messages not subject to a buffer quota.
+        kBufferClassIndirect   = 1, ///< Messages queued for indirect transmission to a sleepy child.
+        kBufferClassCoapCache  = 2, ///< Cached CoAP responses.
+        kBufferClassReassembly = 3, ///< Messages under 6LoWPAN reassembly.
+
+        kNumBufferClasses = 4, ///< Number of buffer classes.
+    };
+
     /**
      * This method frees this message buffer.
      *
@@ -367,6 +432,28 @@ public:
      */
     otError SetPriority(uint8_t aPriority);
 
+    /**
+     * This method returns the buffer class of the message.
+     *
+     * @returns The buffer class associated with this message.
+     *
+     */
+    uint8_t GetBufferClass(void) const { return mBuffer.mHead.mInfo.mBufferClass; }
+
+    /**
+     * This method sets the buffer class of the message.
+     *
+     * All buffers currently used by the message, and any buffers added to it later, are accounted against the
+     * buffer quota of the new class.
+     *
+     * @param[in]  aBufferClass  The buffer class.
+     *
+     * @retval OT_ERROR_NONE     Successfully set the buffer class for the message.
+     * @retval OT_ERROR_NO_BUFS  The message buffers would exceed the buffer quota of @p aBufferClass.
+     *
+     */
+    otError SetBufferClass(uint8_t aBufferClass);
+
     /**
      * This method prepends bytes to the front of the message.
      *
@@ -442,6 +529,92 @@ public:
      */
     int CopyTo(uint16_t aSourceOffset, uint16_t aDestinationOffset, uint16_t aLength, Message &aMessage) const;
 
+    /**
+     * This structure represents a contiguous chunk of bytes within a message.
+     *
+     * A chunk points directly into a message buffer, so it is only valid as long as the message is not modified
+     * (e.g., resized, prepended to, or freed).
+     *
+     */
+    struct Chunk
+    {
+        const uint8_t *mData;   ///< A pointer to the first byte of the chunk.
+        uint16_t       mLength; ///< The number of bytes in the chunk (zero indicates the end of iteration).
+        const Buffer * mBuffer; ///< The message buffer containing the chunk (used to get the next chunk).
+    };
+
+    /**
+     * This structure represents a contiguous chunk of bytes within a message which can be modified in place.
+     *
+     */
+    struct WritableChunk : public Chunk
+    {
+        /**
+         * This method returns a pointer to the first (writable) byte of the chunk.
+         *
+         * @returns A pointer to the first byte of the chunk.
+         *
+         */
+        uint8_t *GetData(void) const { return const_cast<uint8_t *>(mData); }
+    };
+
+    /**
+     * This method gets the first chunk of the message covering a given byte range.
+     *
+     * The chunk is the longest contiguous run of bytes starting at @p aOffset that lies within a single message
+     * buffer and does not exceed @p aLength bytes. On return, @p aLength is decremented by the length of the chunk
+     * (it is first clipped to the end of the message). `aChunk.mLength` is set to zero if @p aOffset is beyond the
+     * end of message.
+     *
+     * @param[in]     aOffset  Byte offset within the message of the first byte of the range.
+     * @param[inout]  aLength  On input, the number of bytes in the range. On output, the number of bytes remaining
+     *                         in the range after the returned chunk.
+     * @param[out]    aChunk   A reference to a chunk to output the result.
+     *
+     */
+    void GetFirstChunk(uint16_t aOffset, uint16_t &aLength, Chunk &aChunk) const;
+
+    /**
+     * This method gets the next chunk of the message, continuing from a chunk returned by `GetFirstChunk()` or a
+     * previous call to `GetNextChunk()`.
+     *
+     * `aChunk.mLength` is set to zero when there are no remaining bytes in the range.
+     *
+     * @param[inout]  aLength  On input, the number of bytes remaining in the range. On output, the number of bytes
+     *                         remaining after the returned chunk.
+     * @param[inout]  aChunk   On input, the previous chunk. On output, the next chunk.
+     *
+     */
+    void GetNextChunk(uint16_t &aLength, Chunk &aChunk) const;
+
+    /**
+     * This method gets the first writable chunk of the message covering a given byte range.
+     *
+     * When shared message buffers are enabled, the buffers covering the range are first made private to this message
+     * (copy-on-write). If that fails due to insufficient message buffers, `aChunk.mLength` and @p aLength are set
+     * to zero.
+     *
+     * @param[in]     aOffset  Byte offset within the message of the first byte of the range.
+     * @param[inout]  aLength  On input, the number of bytes in the range. On output, the number of bytes remaining
+     *                         in the range after the returned chunk.
+     * @param[out]    aChunk   A reference to a writable chunk to output the result.
+     *
+     */
+    void GetFirstChunk(uint16_t aOffset, uint16_t &aLength, WritableChunk &aChunk);
+
+    /**
+     * This method gets the next writable chunk of the message.
+     *
+     * @param[inout]  aLength  On input, the number of bytes remaining in the range. On output, the number of bytes
+     *                         remaining after the returned chunk.
+     * @param[inout]  aChunk   On input, the previous chunk. On output, the next chunk.
+     *
+     */
+    void GetNextChunk(uint16_t &aLength, WritableChunk &aChunk)
+    {
+        static_cast<const Message *>(this)->GetNextChunk(aLength, static_cast<Chunk &>(aChunk));
+    }
+
     /**
      * This method creates a copy of the message.
      *
@@ -449,6 +622,9 @@ public:
      * of the payload. The `Type`, `SubType`, `LinkSecurity`, `Offset`, `InterfaceId`, and `Priority` fields on the
      * cloned message are also copied from the original one.
      *
+     * When `OPENTHREAD_CONFIG_ENABLE_SHARED_MESSAGE_BUFFERS` is enabled, only the head buffer is allocated and the
+     * clone shares the subsequent buffers of the original message until either message modifies them.
+     *
      * @param[in] aLength  Number of payload bytes to copy.
      *
      * @returns A pointer to the message or NULL if insufficient message buffers are available.
@@ -484,6 +660,7 @@ public:
      */
     void SetDatagramTag(uint16_t aTag) { mBuffer.mHead.mInfo.mDatagramTag = aTag; }
 
+#if OPENTHREAD_FTD
     /**
      * This method returns whether or not the message forwarding is scheduled for the child.
      *
@@ -510,6 +687,7 @@ public:
      *
      */
     void SetChildMask(uint8_t aChildIndex);
+#endif // OPENTHREAD_FTD
 
     /**
      * This method returns whether or not the message forwarding is scheduled for at least one child.
@@ -592,6 +770,53 @@ public:
      */
     void SetInterfaceId(int8_t aInterfaceId) { mBuffer.mHead.mInfo.mInterfaceId = aInterfaceId; }
 
+    /**
+     * This method sets the lifetime of the message, after which it is discarded instead of being transmitted.
+     *
+     * @param[in]  aLifetime  The lifetime in milliseconds from now, or zero for no expiry.
+     *
+     */
+    void SetLifetime(uint32_t aLifetime);
+
+    /**
+     * This method indicates whether or not the lifetime of the message has expired.
+     *
+     * @param[in]  aNow  The current time (milliseconds).
+     *
+     * @retval TRUE   If the message has a lifetime which has expired.
+     * @retval FALSE  If the message has no lifetime or it has not expired.
+     *
+     */
+    bool IsExpired(uint32_t aNow) const
+    {
+        return mBuffer.mHead.mInfo.mHasExpiry && static_cast<int32_t>(aNow - mBuffer.mHead.mInfo.mExpiryTime) >= 0;
+    }
+
+    /**
+     * This method returns the transport information recorded for the IPv6 message.
+     *
+     * The information is invalidated whenever a header is prepended to or removed from the message.
+     *
+     * @returns A pointer to the transport information, or NULL if none is recorded.
+     *
+     */
+    const PacketInfo *GetPacketInfo(void) const
+    {
+        return mBuffer.mHead.mInfo.mHasPacketInfo ? &mBuffer.mHead.mInfo.mPacketInfo : NULL;
+    }
+
+    /**
+     * This method records the transport information of the IPv6 message.
+     *
+     * @param[in]  aPacketInfo  The transport information.
+     *
+     */
+    void SetPacketInfo(const PacketInfo &aPacketInfo)
+    {
+        mBuffer.mHead.mInfo.mPacketInfo    = aPacketInfo;
+        mBuffer.mHead.mInfo.mHasPacketInfo = true;
+    }
+
     /**
      * This method returns whether or not message forwarding is scheduled for direct transmission.
      *
@@ -774,6 +999,74 @@ public:
     uint8_t GetTimeSyncSeq(void) const { return mBuffer.mHead.mInfo.mTimeSyncSeq; }
 #endif // OPENTHREAD_CONFIG_ENABLE_TIME_SYNC
 
+#if OPENTHREAD_CONFIG_ENABLE_SEND_QUEUE_AQM || OPENTHREAD_CONFIG_ENABLE_MESSAGE_TRACE
+    /**
+     * This method returns the time the message was added to the send queue.
+     *
+     * @returns The enqueue time (milliseconds).
+     *
+     */
+    uint32_t GetEnqueueTime(void) const { return mBuffer.mHead.mInfo.mEnqueueTime; }
+
+    /**
+     * This method sets the time the message was added to the send queue.
+     *
+     * @param[in]  aEnqueueTime  The enqueue time (milliseconds).
+     *
+     */
+    void SetEnqueueTime(uint32_t aEnqueueTime) { mBuffer.mHead.mInfo.mEnqueueTime = aEnqueueTime; }
+#endif // OPENTHREAD_CONFIG_ENABLE_SEND_QUEUE_AQM || OPENTHREAD_CONFIG_ENABLE_MESSAGE_TRACE
+
+#if OPENTHREAD_CONFIG_ENABLE_MESSAGE_TRACE
+    /**
+     * This method returns the time the message was first picked from the send queue for transmission.
+     *
+     * @returns The dequeue time (milliseconds).
+     *
+     */
+    uint32_t GetDequeueTime(void) const { return mBuffer.mHead.mInfo.mDequeueTime; }
+
+    /**
+     * This method sets the time the message was first picked from the send queue for transmission.
+     *
+     * @param[in]  aDequeueTime  The dequeue time (milliseconds).
+     *
+     */
+    void SetDequeueTime(uint32_t aDequeueTime) { mBuffer.mHead.mInfo.mDequeueTime = aDequeueTime; }
+
+    /**
+     * This method returns the time the first frame of the message was handed to the MAC.
+     *
+     * @returns The first transmission attempt time (milliseconds).
+     *
+     */
+    uint32_t GetTxStartTime(void) const { return mBuffer.mHead.mInfo.mTxStartTime; }
+
+    /**
+     * This method sets the time the first frame of the message was handed to the MAC.
+     *
+     * @param[in]  aTxStartTime  The first transmission attempt time (milliseconds).
+     *
+     */
+    void SetTxStartTime(uint32_t aTxStartTime) { mBuffer.mHead.mInfo.mTxStartTime = aTxStartTime; }
+
+    /**
+     * This method returns the time the transmission of the message completed.
+     *
+     * @returns The transmission done time (milliseconds).
+     *
+     */
+    uint32_t GetTxDoneTime(void) const { return mBuffer.mHead.mInfo.mTxDoneTime; }
+
+    /**
+     * This method sets the time the transmission of the message completed.
+     *
+     * @param[in]  aTxDoneTime  The transmission done time (milliseconds).
+     *
+     */
+    void SetTxDoneTime(uint32_t aTxDoneTime) { mBuffer.mHead.mInfo.mTxDoneTime = aTxDoneTime; }
+#endif // OPENTHREAD_CONFIG_ENABLE_MESSAGE_TRACE
+
 private:
     /**
      * This method returns a pointer to the message pool to which this message belongs
@@ -882,6 +1175,32 @@ private:
      *
      */
     otError ResizeMessage(uint16_t aLength);
+
+#if OPENTHREAD_CONFIG_ENABLE_SHARED_MESSAGE_BUFFERS
+    /**
+     * This method makes the buffers holding the first bytes of the message private to this message.
+     *
+     * Every subsequent buffer holding any of the first @p aLength bytes (including the reserved header bytes) that is
+     * shared with another message is replaced by a copy, along with all the shared buffers preceding it.
+     *
+     * @param[in]  aLength  The number of bytes (including the reserved header bytes) to make private.
+     *
+     * @retval OT_ERROR_NONE     Successfully made the buffers private.
+     * @retval OT_ERROR_NO_BUFS  Insufficient available message buffers to copy a shared buffer.
+     *
+     */
+    otError UnshareBuffers(uint16_t aLength);
+#endif
+
+    /**
+     * This method returns the number of data bytes in a given subsequent (non-head) buffer of the message.
+     *
+     * @param[in]  aBuffer  A pointer to a subsequent buffer of the message.
+     *
+     * @returns The number of data bytes in @p aBuffer.
+     *
+     */
+    uint16_t GetBufferDataSize(const Buffer *aBuffer) const;
 };
 
 /**
@@ -942,6 +1261,19 @@ public:
      */
     otError Enqueue(Message &aMessage, QueuePosition aPosition);
 
+    /**
+     * This method adds a message to the list right before a given message (e.g., to keep the list sorted).
+     *
+     * @param[in]  aMessage  The message to add.
+     * @param[in]  aNext     The message (already in the list) to add @p aMessage before.
+     *
+     * @retval OT_ERROR_NONE       Successfully added the message to the list.
+     * @retval OT_ERROR_ALREADY    The message is already enqueued in a list.
+     * @retval OT_ERROR_NOT_FOUND  @p aNext is not enqueued in this list.
+     *
+     */
+    otError EnqueueBefore(Message &aMessage, Message &aNext);
+
     /**
      * This method removes a message from the list.
      *
@@ -962,6 +1294,14 @@ public:
      */
     void GetInfo(uint16_t &aMessageCount, uint16_t &aBufferCount) const;
 
+    /**
+     * This method returns the maximum number of buffers enqueued at the same time (sampled on enqueue).
+     *
+     * @returns The high-water mark of the number of buffers enqueued.
+     *
+     */
+    uint16_t GetMaxBufferCount(void) const { return mMaxBuffers; }
+
 private:
     /**
      * This method returns the tail of the list (last message in the list)
@@ -1006,6 +1346,12 @@ private:
      *
      */
     void RemoveFromList(uint8_t aListId, Message &aMessage);
+
+    /**
+     * This method updates the high-water mark of the number of buffers enqueued.
+     *
+     */
+    void UpdateMaxBufferCount(void);
 };
 
 /**
@@ -1075,6 +1421,14 @@ public:
      */
     void GetInfo(uint16_t &aMessageCount, uint16_t &aBufferCount) const;
 
+    /**
+     * This method returns the maximum number of buffers enqueued at the same time (sampled on enqueue).
+     *
+     * @returns The high-water mark of the number of buffers enqueued.
+     *
+     */
+    uint16_t GetMaxBufferCount(void) const { return mMaxBuffers; }
+
     /**
      * This method returns the tail of the list (last message in the list)
      *
@@ -1126,8 +1480,15 @@ private:
      */
     Message *FindFirstNonNullTail(uint8_t aStartPriorityLevel) const;
 
+    /**
+     * This method updates the high-water mark of the number of buffers enqueued.
+     *
+     */
+    void UpdateMaxBufferCount(void);
+
 private:
     Message *mTails[Message::kNumPriorities]; ///< Tail pointers associated with different priority levels.
+    uint16_t mMaxBuffers;                     ///< High-water mark of the number of buffers enqueued.
 };
 
 /**
@@ -1299,15 +1660,134 @@ public:
      */
     uint16_t GetFreeBufferCount(void) const;
 
+    /**
+     * This method returns the number of buffers reserved for network control (`Message::kPriorityNet`) messages.
+     *
+     * Messages with a lower priority cannot allocate a buffer when doing so would leave fewer free buffers than
+     * this.
+     *
+     * @returns The number of reserved buffers.
+     *
+     */
+    static uint16_t GetReservedBufferCount(void) { return kNumReservedBuffers; }
+
+    /**
+     * This method returns the number of buffers used by messages of a given buffer class.
+     *
+     * @param[in]  aBufferClass  The buffer class.
+     *
+     * @returns The number of buffers used by messages of @p aBufferClass.
+     *
+     */
+    uint16_t GetBufferClassCount(uint8_t aBufferClass) const { return mBufferClassCount[aBufferClass]; }
+
+    /**
+     * This method returns the maximum number of buffers for a given buffer class.
+     *
+     * @param[in]  aBufferClass  The buffer class.
+     *
+     * @returns The maximum number of buffers for @p aBufferClass, or zero if the class has no quota.
+     *
+     */
+    static uint16_t GetBufferClassLimit(uint8_t aBufferClass);
+
+    /**
+     * This method returns the maximum number of buffers in use at the same time (high-water mark).
+     *
+     * @returns The high-water mark of the number of buffers in use.
+     *
+     */
+    uint16_t GetMaxUsedBufferCount(void) const { return mMaxUsedBuffers; }
+
+    /**
+     * This method returns the number of buffers allocated so far (including large buffers).
+     *
+     * @returns The number of buffer allocations.
+     *
+     */
+    uint32_t GetBufferAllocationCount(void) const { return mNumBufferAllocations; }
+
+    /**
+     * This method returns the number of buffers added in front of a message because its reserved header space was
+     * too small for `Message::Prepend()`.
+     *
+     * @returns The number of prepend reallocations.
+     *
+     */
+    uint32_t GetPrependReallocationCount(void) const { return mNumPrependReallocations; }
+
+    /**
+     * This method returns the number of buffer allocation failures for messages of a given type.
+     *
+     * A failure is counted when a new message cannot be allocated, or when an existing message cannot grow due to
+     * lack of buffers (or due to its buffer class quota).
+     *
+     * @param[in]  aType  The message type.
+     *
+     * @returns The number of allocation failures for messages of type @p aType.
+     *
+     */
+    uint16_t GetAllocFailureCount(uint8_t aType) const { return mTypeAllocFailures[aType]; }
+
+    /**
+     * This method returns the number of buffer allocation failures for messages of a given sub type.
+     *
+     * New messages are counted as `Message::kSubTypeNone` since their sub type is not set yet when allocated.
+     *
+     * @param[in]  aSubType  The message sub type.
+     *
+     * @returns The number of allocation failures for messages of sub type @p aSubType.
+     *
+     */
+    uint16_t GetSubTypeAllocFailureCount(uint8_t aSubType) const { return mSubTypeAllocFailures[aSubType]; }
+
+    /**
+     * This method returns the total time the number of free buffers has been below the low buffer threshold
+     * (`OPENTHREAD_CONFIG_MESSAGE_LOW_BUFFER_THRESHOLD`).
+     *
+     * @returns The total time (in milliseconds) with free buffers below the low threshold.
+     *
+     */
+    uint32_t GetLowBufferTime(void) const;
+
+#if OPENTHREAD_CONFIG_NUM_MESSAGE_LARGE_BUFFERS
+    /**
+     * This method returns the number of free large buffers.
+     *
+     * @returns The number of free large buffers.
+     *
+     */
+    uint16_t GetFreeLargeBufferCount(void) const { return mNumFreeLargeBuffers; }
+#endif
+
 private:
     enum
     {
         kDefaultMessagePriority = Message::kPriorityNormal,
+        kNumReservedBuffers     = OPENTHREAD_CONFIG_NUM_MESSAGE_RESERVED_NET_BUFFERS,
+        kLowBufferThreshold     = OPENTHREAD_CONFIG_MESSAGE_LOW_BUFFER_THRESHOLD,
+        kMaxBufferShareCount    = 0xff,
+#if OPENTHREAD_CONFIG_NUM_MESSAGE_LARGE_BUFFERS
+        kLargeBufferDataSize    = kLargeBufferSize - sizeof(struct otMessage),
+#endif
     };
 
     Buffer *       NewBuffer(uint8_t aPriority);
-    void           FreeBuffers(Buffer *aBuffer);
+#if OPENTHREAD_CONFIG_NUM_MESSAGE_LARGE_BUFFERS
+    Buffer *       NewLargeBuffer(void);
+    bool           IsLargeBuffer(const Buffer *aBuffer) const;
+#endif
+    uint16_t       FreeBuffers(Buffer *aBuffer);
+#if OPENTHREAD_CONFIG_ENABLE_SHARED_MESSAGE_BUFFERS
+    uint8_t &      GetBufferShareCount(const Buffer *aBuffer);
+    bool           ShareBuffers(Buffer *aBuffer);
+    Buffer *       CopySharedBuffer(Buffer *aBuffer, uint8_t aPriority);
+#endif
     otError        ReclaimBuffers(int aNumBuffers, uint8_t aPriority);
+    otError        ClaimBufferClassBuffers(uint8_t aBufferClass, uint16_t aNumBuffers);
+    void           ReleaseBufferClassBuffers(uint8_t aBufferClass, uint16_t aNumBuffers);
+    void           RecordAllocFailure(uint8_t aType, uint8_t aSubType);
+    void           UpdateBufferStats(void);
     PriorityQueue *GetAllMessagesQueue(void) { return &mAllQueue; }
 
 #if OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT == 0
@@ -1316,6 +1796,29 @@ private:
     Buffer * mFreeBuffers;
 #endif
 
+#if OPENTHREAD_CONFIG_NUM_MESSAGE_LARGE_BUFFERS
+    uint16_t    mNumFreeLargeBuffers;
+    LargeBuffer mLargeBuffers[kNumLargeBuffers];
+    Buffer *    mFreeLargeBuffers;
+#endif
+
+#if OPENTHREAD_CONFIG_ENABLE_SHARED_MESSAGE_BUFFERS
+    // The number of additional messages sharing each buffer (zero if the buffer is owned by a single message).
+    uint8_t mBufferShareCount[kNumBuffers];
+#if OPENTHREAD_CONFIG_NUM_MESSAGE_LARGE_BUFFERS
+    uint8_t mLargeBufferShareCount[kNumLargeBuffers];
+#endif
+#endif
+
+    uint16_t      mBufferClassCount[Message::kNumBufferClasses];
+    uint16_t      mMaxUsedBuffers;
+    uint32_t      mNumBufferAllocations;
+    uint32_t      mNumPrependReallocations;
+    uint16_t      mTypeAllocFailures[Message::kNumTypes];
+    uint16_t      mSubTypeAllocFailures[Message::kNumSubTypes];
+    bool          mIsLowOnBuffers;
+    uint32_t      mLowBufferStartTime;
+    uint32_t      mLowBufferTime;
     PriorityQueue mAllQueue;
 };
 
@@ -41,10 +41,14 @@
 
 namespace ot {
 
-Notifier::Callback::Callback(Handler aHandler, void *aOwner)
+Notifier::Callback::Callback(Handler aHandler, void *aOwner, otChangedFlags aInterestMask, uint32_t aMinInterval)
     : OwnerLocator(aOwner)
     , mHandler(aHandler)
     , mNext(this)
+    , mInterestMask(aInterestMask)
+    , mPendingFlags(0)
+    , mMinInterval(aMinInterval)
+    , mLastInvokeTime(0)
 {
 }
 
@@ -53,6 +57,7 @@ Notifier::Notifier(Instance &aInstance)
     , mFlagsToSignal(0)
     , mSignaledFlags(0)
     , mTask(aInstance, &Notifier::HandleStateChanged, this)
+    , mTimer(aInstance, &Notifier::HandleTimer, this)
     , mCallbacks(NULL)
 {
     for (unsigned int i = 0; i < kMaxExternalHandlers; i++)
@@ -68,8 +73,10 @@ otError Notifier::RegisterCallback(Callback &aCallback)
 
     VerifyOrExit(aCallback.mNext == &aCallback, error = OT_ERROR_ALREADY);
 
-    aCallback.mNext = mCallbacks;
-    mCallbacks      = &aCallback;
+    aCallback.mNext           = mCallbacks;
+    aCallback.mPendingFlags   = 0;
+    aCallback.mLastInvokeTime = TimerMilli::GetNow() - aCallback.mMinInterval;
+    mCallbacks                = &aCallback;
 
 exit:
     return error;
@@ -95,7 +102,8 @@ void Notifier::RemoveCallback(Callback &aCallback)
     }
 
 exit:
-    aCallback.mNext = &aCallback;
+    aCallback.mNext         = &aCallback;
+    aCallback.mPendingFlags = 0;
 }
 
 otError Notifier::RegisterCallback(otStateChangedCallback aCallback, void *aContext)
@@ -180,13 +188,7 @@ void Notifier::HandleStateChanged(void)
 
     LogChangedFlags(flags);
 
-    for (Callback *callback = mCallbacks; callback != NULL; callback = callback->mNext)
-    {
-        if (callback->mHandler != NULL)
-        {
-            callback->mHandler(*callback, flags);
-        }
-    }
+    InvokeCallbacks(flags);
 
     for (unsigned int i = 0; i < kMaxExternalHandlers; i++)
     {
@@ -202,6 +204,60 @@ exit:
     return;
 }
 
+void Notifier::HandleTimer(Timer &aTimer)
+{
+    aTimer.GetOwner<Notifier>().HandleTimer();
+}
+
+void Notifier::HandleTimer(void)
+{
+    InvokeCallbacks(0);
+}
+
+void Notifier::InvokeCallbacks(otChangedFlags aFlags)
+{
+    uint32_t now        = TimerMilli::GetNow();
+    uint32_t nextDelay  = 0;
+    bool     isDeferred = false;
+
+    for (Callback *callback = mCallbacks; callback != NULL; callback = callback->mNext)
+    {
+        otChangedFlags flags;
+        uint32_t       elapsed;
+
+        callback->mPendingFlags |= (aFlags & callback->mInterestMask);
+
+        if (callback->mHandler == NULL || callback->mPendingFlags == 0)
+        {
+            continue;
+        }
+
+        elapsed = now - callback->mLastInvokeTime;
+
+        if (elapsed < callback->mMinInterval)
+        {
+            // Coalesce with any further changes until the minimum interval has passed.
+            if (!isDeferred || callback->mMinInterval - elapsed < nextDelay)
+            {
+                nextDelay = callback->mMinInterval - elapsed;
+            }
+
+            isDeferred = true;
+            continue;
+        }
+
+        flags                     = callback->mPendingFlags;
+        callback->mPendingFlags   = 0;
+        callback->mLastInvokeTime = now;
+        callback->mHandler(*callback, flags);
+    }
+
+    if (isDeferred)
+    {
+        mTimer.Start(nextDelay);
+    }
+}
+
 #if (OPENTHREAD_CONFIG_LOG_LEVEL >= OT_LOG_LEVEL_INFO) && (OPENTHREAD_CONFIG_LOG_MAC == 1)
 
 void Notifier::LogChangedFlags(otChangedFlags aFlags) const
@@ -44,6 +44,7 @@
 
 #include "common/locator.hpp"
 #include "common/tasklet.hpp"
+#include "common/timer.hpp"
 
 namespace ot {
 
@@ -62,6 +63,10 @@ namespace ot {
  *
  * It can be used to register callbacks to be notified of state or configuration changes within OpenThread.
  *
+ * Each registered `Callback` declares the flags it is interested in, and is only invoked when at least one of them has
+ * changed. A `Callback` may also request a minimum interval between invocations, in which case flags changing within
+ * that interval are accumulated and delivered together once it expires.
+ *
  */
 class Notifier : public InstanceLocator
 {
@@ -84,18 +89,46 @@ public:
          */
         typedef void (*Handler)(Callback &aCallback, otChangedFlags aFlags);
 
+        enum
+        {
+            kAllFlags = 0xffffffff, ///< Interest mask covering all flags.
+        };
+
         /**
          * This constructor initializes a `Callback` instance
          *
-         * @param[in] aHandler    A function pointer to the callback handler.
-         * @param[in] aOwner      A pointer to the owner of the `Callback` instance.
+         * @param[in] aHandler        A function pointer to the callback handler.
+         * @param[in] aOwner          A pointer to the owner of the `Callback` instance.
+         * @param[in] aInterestMask   A bit-field of the flags the handler should be invoked for.
+         * @param[in] aMinInterval    The minimum interval between handler invocations (in msec), or zero to invoke
+         *                            the handler as soon as the flags are signaled.
+         *
+         */
+        Callback(Handler aHandler, void *aOwner, otChangedFlags aInterestMask = kAllFlags, uint32_t aMinInterval = 0);
+
+        /**
+         * This method returns the bit-field of the flags the handler is invoked for.
+         *
+         * @returns The interest mask.
+         *
+         */
+        otChangedFlags GetInterestMask(void) const { return mInterestMask; }
+
+        /**
+         * This method returns the minimum interval between handler invocations.
+         *
+         * @returns The minimum interval (in msec).
          *
          */
-        Callback(Handler aHandler, void *aOwner);
+        uint32_t GetMinInterval(void) const { return mMinInterval; }
 
     private:
-        Handler   mHandler;
-        Callback *mNext;
+        Handler        mHandler;
+        Callback *     mNext;
+        otChangedFlags mInterestMask;
+        otChangedFlags mPendingFlags;
+        uint32_t       mMinInterval;
+        uint32_t       mLastInvokeTime;
     };
 
     /**
@@ -198,6 +231,9 @@ private:
 
     static void HandleStateChanged(Tasklet &aTasklet);
     void        HandleStateChanged(void);
+    static void HandleTimer(Timer &aTimer);
+    void        HandleTimer(void);
+    void        InvokeCallbacks(otChangedFlags aFlags);
 
     void        LogChangedFlags(otChangedFlags aFlags) const;
     const char *FlagToString(otChangedFlags aFlag) const;
@@ -205,6 +241,7 @@ private:
     otChangedFlags   mFlagsToSignal;
     otChangedFlags   mSignaledFlags;
     Tasklet          mTask;
+    TimerMilli       mTimer;
     Callback *       mCallbacks;
     ExternalCallback mExternalCallbacks[kMaxExternalHandlers];
 };
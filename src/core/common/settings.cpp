@@ -223,6 +223,117 @@ exit:
     return error;
 }
 
+otError Settings::SaveAddressCache(const AddressCacheEntry *aEntries, uint8_t aNumEntries)
+{
+    otError error;
+
+    SuccessOrExit(error = Save(kKeyAddressCache, aEntries, aNumEntries * sizeof(AddressCacheEntry)));
+    otLogInfoCore("Non-volatile: Saved %d AddressCache entries", aNumEntries);
+
+exit:
+    LogFailure(error, "saving AddressCache", false);
+    return error;
+}
+
+otError Settings::ReadAddressCache(AddressCacheEntry *aEntries, uint8_t aMaxEntries, uint8_t &aNumEntries) const
+{
+    uint16_t size;
+    otError  error;
+
+    SuccessOrExit(error = Read(kKeyAddressCache, aEntries, aMaxEntries * sizeof(AddressCacheEntry), size));
+    aNumEntries = static_cast<uint8_t>(size / sizeof(AddressCacheEntry));
+    otLogInfoCore("Non-volatile: Read %d AddressCache entries", aNumEntries);
+
+exit:
+    return error;
+}
+
+otError Settings::DeleteAddressCache(void)
+{
+    otError error;
+
+    SuccessOrExit(error = Delete(kKeyAddressCache));
+    otLogInfoCore("Non-volatile: Deleted AddressCache");
+
+exit:
+    LogFailure(error, "deleting AddressCache", true);
+    return error;
+}
+
+otError Settings::SaveFrameCounters(const FrameCounters &aFrameCounters)
+{
+    otError error;
+
+    SuccessOrExit(error = Save(kKeyFrameCounters, &aFrameCounters, sizeof(FrameCounters)));
+    otLogInfoCore("Non-volatile: Saved FrameCounters {keyseq:0x%x, mlefc:%u, macfc:%u}", aFrameCounters.mKeySequence,
+                  aFrameCounters.mMleFrameCounter, aFrameCounters.mMacFrameCounter);
+
+exit:
+    LogFailure(error, "saving FrameCounters", false);
+    return error;
+}
+
+otError Settings::ReadFrameCounters(FrameCounters &aFrameCounters) const
+{
+    otError error;
+
+    SuccessOrExit(error = ReadFixedSize(kKeyFrameCounters, &aFrameCounters, sizeof(FrameCounters)));
+    otLogInfoCore("Non-volatile: Read FrameCounters {keyseq:0x%x, mlefc:%u, macfc:%u}", aFrameCounters.mKeySequence,
+                  aFrameCounters.mMleFrameCounter, aFrameCounters.mMacFrameCounter);
+
+exit:
+    return error;
+}
+
+otError Settings::DeleteFrameCounters(void)
+{
+    otError error;
+
+    SuccessOrExit(error = Delete(kKeyFrameCounters));
+    otLogInfoCore("Non-volatile: Deleted FrameCounters");
+
+exit:
+    LogFailure(error, "deleting FrameCounters", true);
+    return error;
+}
+
+otError Settings::SaveNeighborRouters(const NeighborRouterInfo *aEntries, uint8_t aNumEntries)
+{
+    otError error;
+
+    SuccessOrExit(error = Save(kKeyNeighborRouters, aEntries, aNumEntries * sizeof(NeighborRouterInfo)));
+    otLogInfoCore("Non-volatile: Saved %d NeighborRouters entries", aNumEntries);
+
+exit:
+    LogFailure(error, "saving NeighborRouters", false);
+    return error;
+}
+
+otError Settings::ReadNeighborRouters(NeighborRouterInfo *aEntries, uint8_t aMaxEntries, uint8_t &aNumEntries) const
+{
+    uint16_t size;
+    otError  error;
+
+    SuccessOrExit(error = Read(kKeyNeighborRouters, aEntries, aMaxEntries * sizeof(NeighborRouterInfo), size));
+    aNumEntries = static_cast<uint8_t>(size / sizeof(NeighborRouterInfo));
+    otLogInfoCore("Non-volatile: Read %d NeighborRouters entries", aNumEntries);
+
+exit:
+    return error;
+}
+
+otError Settings::DeleteNeighborRouters(void)
+{
+    otError error;
+
+    SuccessOrExit(error = Delete(kKeyNeighborRouters));
+    otLogInfoCore("Non-volatile: Deleted NeighborRouters");
+
+exit:
+    LogFailure(error, "deleting NeighborRouters", true);
+    return error;
+}
+
 Settings::ChildInfoIterator::ChildInfoIterator(Instance &aInstance)
     : SettingsBase(aInstance)
     , mIndex(0)
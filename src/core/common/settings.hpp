@@ -115,6 +115,36 @@ public:
         uint8_t         mMode;       ///< The MLE device mode
     };
 
+    /**
+     * This structure represents an EID-to-RLOC cache entry for settings storage.
+     *
+     */
+    struct AddressCacheEntry
+    {
+        uint8_t  mTarget[OT_IP6_ADDRESS_SIZE]; ///< Target EID
+        uint16_t mRloc16;                      ///< RLOC16
+    };
+
+    /**
+     * This structure represents the frame counters for settings storage.
+     *
+     */
+    struct FrameCounters
+    {
+        uint32_t mKeySequence;     ///< Key Sequence the frame counters belong to
+        uint32_t mMleFrameCounter; ///< MLE Frame Counter
+        uint32_t mMacFrameCounter; ///< MAC Frame Counter
+    };
+
+    /**
+     * This structure represents a neighbor router entry for settings storage.
+     *
+     */
+    struct NeighborRouterInfo
+    {
+        Mac::ExtAddress mExtAddress; ///< Extended Address
+    };
+
 protected:
     /**
      * This enumeration defines the keys of settings.
@@ -128,6 +158,9 @@ protected:
         kKeyParentInfo      = 0x0004, ///< Parent information
         kKeyChildInfo       = 0x0005, ///< Child information
         kKeyThreadAutoStart = 0x0006, ///< Auto-start information
+        kKeyAddressCache    = 0x0007, ///< EID-to-RLOC cache entries
+        kKeyFrameCounters   = 0x0008, ///< MAC and MLE frame counters
+        kKeyNeighborRouters = 0x0009, ///< Neighbor routers
     };
 
     explicit SettingsBase(Instance &aInstance)
@@ -343,6 +376,108 @@ public:
      */
     otError DeleteChildInfo(void);
 
+    /**
+     * This method saves EID-to-RLOC cache entries, replacing any previously saved entries.
+     *
+     * @param[in]   aEntries              A pointer to an array of `AddressCacheEntry` structures.
+     * @param[in]   aNumEntries           The number of entries in @p aEntries.
+     *
+     * @retval OT_ERROR_NONE              Successfully saved the entries in settings.
+     * @retval OT_ERROR_NOT_IMPLEMENTED   The platform does not implement settings functionality.
+     *
+     */
+    otError SaveAddressCache(const AddressCacheEntry *aEntries, uint8_t aNumEntries);
+
+    /**
+     * This method reads saved EID-to-RLOC cache entries.
+     *
+     * @param[out]  aEntries              A pointer to an array of `AddressCacheEntry` structures to fill.
+     * @param[in]   aMaxEntries           The number of entries @p aEntries can hold.
+     * @param[out]  aNumEntries           A reference to return the number of entries read.
+     *
+     * @retval OT_ERROR_NONE              Successfully read the entries.
+     * @retval OT_ERROR_NOT_FOUND         No entries were saved.
+     * @retval OT_ERROR_NOT_IMPLEMENTED   The platform does not implement settings functionality.
+     *
+     */
+    otError ReadAddressCache(AddressCacheEntry *aEntries, uint8_t aMaxEntries, uint8_t &aNumEntries) const;
+
+    /**
+     * This method deletes the saved EID-to-RLOC cache entries.
+     *
+     * @retval OT_ERROR_NONE             Successfully deleted the value.
+     * @retval OT_ERROR_NOT_IMPLEMENTED  The platform does not implement settings functionality.
+     *
+     */
+    otError DeleteAddressCache(void);
+
+    /**
+     * This method saves Frame Counters.
+     *
+     * @param[in]   aFrameCounters        A reference to a `FrameCounters` structure to be saved.
+     *
+     * @retval OT_ERROR_NONE              Successfully saved Frame Counters in settings.
+     * @retval OT_ERROR_NOT_IMPLEMENTED   The platform does not implement settings functionality.
+     *
+     */
+    otError SaveFrameCounters(const FrameCounters &aFrameCounters);
+
+    /**
+     * This method reads Frame Counters.
+     *
+     * @param[out]   aFrameCounters       A reference to a `FrameCounters` structure to output the read content.
+     *
+     * @retval OT_ERROR_NONE              Successfully read the Frame Counters.
+     * @retval OT_ERROR_NOT_FOUND         No corresponding value in the setting store.
+     * @retval OT_ERROR_NOT_IMPLEMENTED   The platform does not implement settings functionality.
+     *
+     */
+    otError ReadFrameCounters(FrameCounters &aFrameCounters) const;
+
+    /**
+     * This method deletes Frame Counters from settings.
+     *
+     * @retval OT_ERROR_NONE             Successfully deleted the value.
+     * @retval OT_ERROR_NOT_IMPLEMENTED  The platform does not implement settings functionality.
+     *
+     */
+    otError DeleteFrameCounters(void);
+
+    /**
+     * This method saves the neighbor router entries, replacing any previously saved entries.
+     *
+     * @param[in]   aEntries              A pointer to an array of `NeighborRouterInfo` structures.
+     * @param[in]   aNumEntries           The number of entries in @p aEntries.
+     *
+     * @retval OT_ERROR_NONE              Successfully saved the entries in settings.
+     * @retval OT_ERROR_NOT_IMPLEMENTED   The platform does not implement settings functionality.
+     *
+     */
+    otError SaveNeighborRouters(const NeighborRouterInfo *aEntries, uint8_t aNumEntries);
+
+    /**
+     * This method reads the saved neighbor router entries.
+     *
+     * @param[out]  aEntries              A pointer to an array of `NeighborRouterInfo` structures to fill.
+     * @param[in]   aMaxEntries           The number of entries @p aEntries can hold.
+     * @param[out]  aNumEntries           A reference to return the number of entries read.
+     *
+     * @retval OT_ERROR_NONE              Successfully read the entries.
+     * @retval OT_ERROR_NOT_FOUND         No entries were saved.
+     * @retval OT_ERROR_NOT_IMPLEMENTED   The platform does not implement settings functionality.
+     *
+     */
+    otError ReadNeighborRouters(NeighborRouterInfo *aEntries, uint8_t aMaxEntries, uint8_t &aNumEntries) const;
+
+    /**
+     * This method deletes the saved neighbor router entries.
+     *
+     * @retval OT_ERROR_NONE             Successfully deleted the value.
+     * @retval OT_ERROR_NOT_IMPLEMENTED  The platform does not implement settings functionality.
+     *
+     */
+    otError DeleteNeighborRouters(void);
+
     /**
      * This class defines an iterator to access all Child Info entries in the settings.
      *
@@ -40,12 +40,14 @@
 
 namespace ot {
 
-Tasklet::Tasklet(Instance &aInstance, Handler aHandler, void *aOwner)
+Tasklet::Tasklet(Instance &aInstance, Handler aHandler, void *aOwner, Priority aPriority)
     : InstanceLocator(aInstance)
     , OwnerLocator(aOwner)
     , mHandler(aHandler)
     , mNext(NULL)
+    , mPriority(static_cast<uint8_t>(aPriority))
 {
+    assert(aPriority < kNumPriorities);
 }
 
 otError Tasklet::Post(void)
@@ -54,46 +56,71 @@ otError Tasklet::Post(void)
 }
 
 TaskletScheduler::TaskletScheduler(void)
-    : mHead(NULL)
-    , mTail(NULL)
 {
+    for (uint8_t priority = 0; priority < Tasklet::kNumPriorities; priority++)
+    {
+        mQueues[priority].mHead = NULL;
+        mQueues[priority].mTail = NULL;
+    }
 }
 
 otError TaskletScheduler::Post(Tasklet &aTasklet)
 {
     otError error = OT_ERROR_NONE;
+    Queue & queue = mQueues[aTasklet.mPriority];
 
-    VerifyOrExit(mTail != &aTasklet && aTasklet.mNext == NULL, error = OT_ERROR_ALREADY);
+    VerifyOrExit(queue.mTail != &aTasklet && aTasklet.mNext == NULL, error = OT_ERROR_ALREADY);
 
     VerifyOrExit(&aTasklet.GetInstance().Get<TaskletScheduler>() == this);
 
-    if (mTail == NULL)
+    if (queue.mTail == NULL)
     {
-        mHead = &aTasklet;
-        mTail = &aTasklet;
-        otTaskletsSignalPending(&aTasklet.GetInstance());
+        if (!AreTaskletsPending())
+        {
+            otTaskletsSignalPending(&aTasklet.GetInstance());
+        }
+
+        queue.mHead = &aTasklet;
+        queue.mTail = &aTasklet;
     }
     else
     {
-        mTail->mNext = &aTasklet;
-        mTail        = &aTasklet;
+        queue.mTail->mNext = &aTasklet;
+        queue.mTail        = &aTasklet;
     }
 
 exit:
     return error;
 }
 
-Tasklet *TaskletScheduler::PopTasklet(void)
+bool TaskletScheduler::AreTaskletsPending(void) const
 {
-    Tasklet *task = mHead;
+    bool rval = false;
+
+    for (uint8_t priority = 0; priority < Tasklet::kNumPriorities; priority++)
+    {
+        if (mQueues[priority].mHead != NULL)
+        {
+            ExitNow(rval = true);
+        }
+    }
+
+exit:
+    return rval;
+}
+
+Tasklet *TaskletScheduler::PopTasklet(uint8_t aPriority)
+{
+    Queue &  queue = mQueues[aPriority];
+    Tasklet *task  = queue.mHead;
 
     if (task != NULL)
     {
-        mHead = mHead->mNext;
+        queue.mHead = queue.mHead->mNext;
 
-        if (mHead == NULL)
+        if (queue.mHead == NULL)
         {
-            mTail = NULL;
+            queue.mTail = NULL;
         }
 
         task->mNext = NULL;
@@ -104,21 +131,71 @@ Tasklet *TaskletScheduler::PopTasklet(void)
 
 void TaskletScheduler::ProcessQueuedTasklets(void)
 {
-    Tasklet *tail = mTail;
-    Tasklet *cur;
+    Tasklet *tails[Tasklet::kNumPriorities];
+    uint16_t numRun = 0;
+
+    // Only process tasklets that were queued at the time this method was called, so that a tasklet re-posting
+    // itself cannot starve the platform. Within those, higher priority tasklets run first.
+
+    for (uint8_t priority = 0; priority < Tasklet::kNumPriorities; priority++)
+    {
+        tails[priority] = mQueues[priority].mTail;
+    }
 
-    while ((cur = PopTasklet()) != NULL)
+    for (uint8_t priority = 0; priority < Tasklet::kNumPriorities;)
     {
+        Tasklet *cur;
+
+        if (tails[priority] == NULL)
+        {
+            priority++;
+            continue;
+        }
+
+        if (kProcessBudget != 0 && numRun >= kProcessBudget)
+        {
+            break;
+        }
+
+        cur = PopTasklet(priority);
+        assert(cur != NULL);
+
+        if (cur == tails[priority])
+        {
+            tails[priority] = NULL;
+        }
+
+#if OPENTHREAD_CONFIG_ENABLE_HANDLER_PROFILER
+        {
+            HandlerProfiler &profiler  = cur->GetInstance().GetHandlerProfiler();
+            uintptr_t        handler   = reinterpret_cast<uintptr_t>(cur->mHandler);
+            uint32_t         startTime = HandlerProfiler::GetNow();
+
+            cur->RunTask();
+            profiler.Record(OT_HANDLER_TYPE_TASKLET, handler, startTime);
+        }
+#else
         cur->RunTask();
+#endif
+        numRun++;
 
-        // only process tasklets that were queued at the time this method was called
-        if (cur == tail)
+        // A higher priority tasklet may have been queued by the tasklet that just ran.
+        for (uint8_t higher = 0; higher < priority; higher++)
         {
-            if (mHead != NULL)
+            if (tails[higher] == NULL && mQueues[higher].mHead != NULL)
             {
-                otTaskletsSignalPending(&mHead->GetInstance());
+                tails[higher] = mQueues[higher].mTail;
+                priority      = higher;
+                break;
             }
+        }
+    }
 
+    for (uint8_t priority = 0; priority < Tasklet::kNumPriorities; priority++)
+    {
+        if (mQueues[priority].mHead != NULL)
+        {
+            otTaskletsSignalPending(&mQueues[priority].mHead->GetInstance());
             break;
         }
     }
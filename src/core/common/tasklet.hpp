@@ -73,15 +73,39 @@ public:
      */
     typedef void (*Handler)(Tasklet &aTasklet);
 
+    /**
+     * This enumeration defines the tasklet priority levels.
+     *
+     * Queued tasklets of a higher priority level always run before queued tasklets of a lower priority level.
+     *
+     */
+    enum Priority
+    {
+        kPriorityHigh   = 0, ///< High priority level (latency critical work, e.g., radio and MAC operations).
+        kPriorityNormal = 1, ///< Normal priority level (background work).
+        kPriorityLow    = 2, ///< Low priority level (work that may wait for all others, e.g., log output).
+
+        kNumPriorities = 3, ///< Number of priority levels.
+    };
+
     /**
      * This constructor creates a tasklet instance.
      *
      * @param[in]  aInstance   A reference to the instance object.
      * @param[in]  aHandler    A pointer to a function that is called when the tasklet is run.
      * @param[in]  aOwner      A pointer to owner of this `Tasklet` object.
+     * @param[in]  aPriority   The priority level of the tasklet.
      *
      */
-    Tasklet(Instance &aInstance, Handler aHandler, void *aOwner);
+    Tasklet(Instance &aInstance, Handler aHandler, void *aOwner, Priority aPriority = kPriorityNormal);
+
+    /**
+     * This method returns the priority level of the tasklet.
+     *
+     * @returns The priority level of the tasklet.
+     *
+     */
+    Priority GetPriority(void) const { return static_cast<Priority>(mPriority); }
 
     /**
      * This method puts the tasklet on the run queue.
@@ -94,6 +118,7 @@ private:
 
     Handler  mHandler;
     Tasklet *mNext;
+    uint8_t  mPriority;
 };
 
 /**
@@ -126,18 +151,33 @@ public:
      * @retval FALSE  If there are no tasklets pending.
      *
      */
-    bool AreTaskletsPending(void) { return mHead != NULL; }
+    bool AreTaskletsPending(void) const;
 
     /**
-     * This method processes all tasklets queued when this is called.
+     * This method processes the tasklets queued when this is called, in priority order.
+     *
+     * If `OPENTHREAD_CONFIG_TASKLETS_PROCESS_BUDGET` is non-zero, at most that many tasklets are run, and the
+     * remaining ones are left pending (signaled with `otTaskletsSignalPending()`) so that the platform can service
+     * other events (e.g., the radio) before processing them.
      *
      */
     void ProcessQueuedTasklets(void);
 
 private:
-    Tasklet *PopTasklet(void);
-    Tasklet *mHead;
-    Tasklet *mTail;
+    enum
+    {
+        kProcessBudget = OPENTHREAD_CONFIG_TASKLETS_PROCESS_BUDGET,
+    };
+
+    struct Queue
+    {
+        Tasklet *mHead;
+        Tasklet *mTail;
+    };
+
+    Tasklet *PopTasklet(uint8_t aPriority);
+
+    Queue mQueues[Tasklet::kNumPriorities];
 };
 
 /**
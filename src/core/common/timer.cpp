@@ -35,6 +35,8 @@
 
 #include "timer.hpp"
 
+#include "utils/wrap_string.h"
+
 #include "common/code_utils.hpp"
 #include "common/debug.hpp"
 #include "common/instance.hpp"
@@ -71,9 +73,20 @@ bool Timer::DoesFireBefore(const Timer &aSecondTimer, uint32_t aNow)
 
 void TimerMilli::StartAt(uint32_t aT0, uint32_t aDt)
 {
-    assert(aDt <= kMaxDt);
-    mFireTime = aT0 + aDt;
-    GetTimerMilliScheduler().Add(*this);
+    StartAtWithSlack(aT0, aDt, 0);
+}
+
+void TimerMilli::StartAtWithSlack(uint32_t aT0, uint32_t aDt, uint32_t aSlack)
+{
+    assert(aDt <= kMaxDt && aSlack <= kMaxSlack);
+
+#if OPENTHREAD_CONFIG_ENABLE_TIMER_SLACK
+    mSlack = static_cast<uint16_t>(aSlack);
+#else
+    OT_UNUSED_VARIABLE(aSlack);
+#endif
+
+    GetTimerMilliScheduler().Add(*this, aT0 + aDt);
 }
 
 void TimerMilli::Stop(void)
@@ -86,10 +99,158 @@ TimerMilliScheduler &TimerMilli::GetTimerMilliScheduler(void) const
     return GetInstance().GetTimerMilliScheduler();
 }
 
-void TimerScheduler::Add(Timer &aTimer, const AlarmApi &aAlarmApi)
+TimerScheduler::TimerScheduler(Instance &aInstance)
+    : InstanceLocator(aInstance)
+    , mHead(NULL)
+    , mAlarmStartCount(0)
+#if OPENTHREAD_CONFIG_ENABLE_TIMER_SLACK
+    , mAlarmFireTime(0)
+#endif
+{
+#if OPENTHREAD_CONFIG_ENABLE_TIMER_WHEEL
+    memset(mSlots, 0, sizeof(mSlots));
+#endif
+}
+
+#if OPENTHREAD_CONFIG_ENABLE_TIMER_WHEEL
+
+void TimerScheduler::Add(Timer &aTimer, uint32_t aFireTime, const AlarmApi &aAlarmApi)
 {
     Remove(aTimer, aAlarmApi);
 
+    aTimer.mFireTime = aFireTime;
+    AddToSlot(aTimer);
+
+    if (mHead == NULL || aTimer.DoesFireBefore(*mHead, aAlarmApi.AlarmGetNow()))
+    {
+        mHead = &aTimer;
+        SetAlarm(aAlarmApi);
+    }
+#if OPENTHREAD_CONFIG_ENABLE_TIMER_SLACK
+    else if (ShouldFireBeforeAlarm(aTimer, aAlarmApi.AlarmGetNow()))
+    {
+        SetAlarm(aAlarmApi);
+    }
+#endif
+}
+
+void TimerScheduler::Remove(Timer &aTimer, const AlarmApi &aAlarmApi)
+{
+    VerifyOrExit(aTimer.mNext != &aTimer);
+
+    RemoveFromSlot(aTimer);
+
+    if (mHead == &aTimer)
+    {
+        mHead = FindNextTimer(aTimer.mFireTime, aAlarmApi.AlarmGetNow());
+        SetAlarm(aAlarmApi);
+    }
+
+exit:
+    return;
+}
+
+void TimerScheduler::AddToSlot(Timer &aTimer)
+{
+    Timer *&first = mSlots[GetSlotIndex(aTimer.mFireTime)];
+
+    if (first == NULL)
+    {
+        first        = &aTimer;
+        aTimer.mPrev = &aTimer;
+    }
+    else
+    {
+        Timer *last = first->mPrev;
+
+        last->mNext  = &aTimer;
+        aTimer.mPrev = last;
+        first->mPrev = &aTimer;
+    }
+
+    aTimer.mNext = NULL;
+}
+
+void TimerScheduler::RemoveFromSlot(Timer &aTimer)
+{
+    Timer *&first = mSlots[GetSlotIndex(aTimer.mFireTime)];
+
+    if (first == &aTimer)
+    {
+        first = aTimer.mNext;
+
+        if (first != NULL)
+        {
+            first->mPrev = aTimer.mPrev;
+        }
+    }
+    else
+    {
+        aTimer.mPrev->mNext = aTimer.mNext;
+
+        if (aTimer.mNext != NULL)
+        {
+            aTimer.mNext->mPrev = aTimer.mPrev;
+        }
+        else
+        {
+            first->mPrev = aTimer.mPrev;
+        }
+    }
+
+    aTimer.mNext = &aTimer;
+    aTimer.mPrev = &aTimer;
+}
+
+Timer *TimerScheduler::FindNextTimer(uint32_t aStartTime, uint32_t aNow) const
+{
+    // All running timers fire at or after `aStartTime` (the fire time of the previous head). The slots are visited
+    // in order starting from the one covering `aStartTime`, and within each slot only the timers whose fire time is
+    // inside the current window of the wheel are considered. This way the first non-empty window gives the earliest
+    // timer. Timers in the same slot are kept in order of addition so that timers with the same fire time fire in the
+    // same order as they were started.
+
+    Timer *  next        = NULL;
+    uint32_t windowStart = aStartTime & ~static_cast<uint32_t>(kSlotWidth - 1);
+
+    for (uint16_t i = 0; i < kNumSlots; i++, windowStart += kSlotWidth)
+    {
+        for (Timer *cur = mSlots[GetSlotIndex(windowStart)]; cur != NULL; cur = cur->mNext)
+        {
+            if ((cur->mFireTime - windowStart) < kSlotWidth && (next == NULL || cur->DoesFireBefore(*next, aNow)))
+            {
+                next = cur;
+            }
+        }
+
+        VerifyOrExit(next == NULL);
+    }
+
+    // No timer fires within a full rotation of the wheel, fall back to checking all the timers.
+
+    for (uint16_t i = 0; i < kNumSlots; i++)
+    {
+        for (Timer *cur = mSlots[i]; cur != NULL; cur = cur->mNext)
+        {
+            if (next == NULL || cur->DoesFireBefore(*next, aNow))
+            {
+                next = cur;
+            }
+        }
+    }
+
+exit:
+    return next;
+}
+
+#else // OPENTHREAD_CONFIG_ENABLE_TIMER_WHEEL
+
+void TimerScheduler::Add(Timer &aTimer, uint32_t aFireTime, const AlarmApi &aAlarmApi)
+{
+    Remove(aTimer, aAlarmApi);
+
+    aTimer.mFireTime = aFireTime;
+
     if (mHead == NULL)
     {
         mHead        = &aTimer;
@@ -128,6 +289,13 @@ void TimerScheduler::Add(Timer &aTimer, const AlarmApi &aAlarmApi)
             prev->mNext  = &aTimer;
             aTimer.mNext = NULL;
         }
+
+#if OPENTHREAD_CONFIG_ENABLE_TIMER_SLACK
+        if ((mHead != &aTimer) && ShouldFireBeforeAlarm(aTimer, aAlarmApi.AlarmGetNow()))
+        {
+            SetAlarm(aAlarmApi);
+        }
+#endif
     }
 }
 
@@ -158,6 +326,8 @@ exit:
     return;
 }
 
+#endif // OPENTHREAD_CONFIG_ENABLE_TIMER_WHEEL
+
 void TimerScheduler::SetAlarm(const AlarmApi &aAlarmApi)
 {
     if (mHead == NULL)
@@ -166,13 +336,108 @@ void TimerScheduler::SetAlarm(const AlarmApi &aAlarmApi)
     }
     else
     {
-        uint32_t now       = aAlarmApi.AlarmGetNow();
-        uint32_t remaining = IsStrictlyBefore(now, mHead->mFireTime) ? (mHead->mFireTime - now) : 0;
+        uint32_t now = aAlarmApi.AlarmGetNow();
+#if OPENTHREAD_CONFIG_ENABLE_TIMER_SLACK
+        uint32_t fireTime = GetAlarmFireTime(now);
 
+        mAlarmFireTime = fireTime;
+#else
+        uint32_t fireTime = mHead->mFireTime;
+#endif
+        uint32_t remaining = IsStrictlyBefore(now, fireTime) ? (fireTime - now) : 0;
+
+        mAlarmStartCount++;
         aAlarmApi.AlarmStartAt(&GetInstance(), now, remaining);
     }
 }
 
+otError TimerScheduler::GetRemainingTime(const AlarmApi &aAlarmApi, uint32_t &aRemaining) const
+{
+    otError  error = OT_ERROR_NONE;
+    uint32_t now   = aAlarmApi.AlarmGetNow();
+    uint32_t fireTime;
+
+    VerifyOrExit(mHead != NULL, error = OT_ERROR_NOT_FOUND);
+
+#if OPENTHREAD_CONFIG_ENABLE_TIMER_SLACK
+    // The platform alarm is only started for the coalesced fire time, so that is when the next wakeup happens.
+    fireTime = mAlarmFireTime;
+#else
+    fireTime = mHead->mFireTime;
+#endif
+
+    aRemaining = IsStrictlyBefore(now, fireTime) ? (fireTime - now) : 0;
+
+exit:
+    return error;
+}
+
+#if OPENTHREAD_CONFIG_ENABLE_TIMER_SLACK
+uint32_t TimerScheduler::GetAlarmFireTime(uint32_t aNow) const
+{
+    // The alarm is set to the earliest "latest allowed fire time" (fire time plus slack) among the timers that fire
+    // before it. All the timers whose fire time has passed are then handled together when the alarm fires.
+
+    uint32_t startTime = mHead->mFireTime;
+    uint32_t fireTime  = startTime;
+
+    // If the head timer is already due, there is nothing to coalesce.
+    VerifyOrExit(IsStrictlyBefore(aNow, fireTime));
+
+    fireTime += mHead->mSlack;
+
+#if OPENTHREAD_CONFIG_ENABLE_TIMER_WHEEL
+    {
+        uint32_t windowStart = startTime & ~static_cast<uint32_t>(kSlotWidth - 1);
+
+        for (uint16_t i = 0; (i < kNumSlots) && !IsStrictlyBefore(fireTime, windowStart);
+             i++, windowStart += kSlotWidth)
+        {
+            for (Timer *cur = mSlots[GetSlotIndex(windowStart)]; cur != NULL; cur = cur->mNext)
+            {
+                uint32_t latest = cur->mFireTime + cur->mSlack;
+
+                if (((cur->mFireTime - windowStart) < kSlotWidth) && !IsStrictlyBefore(cur->mFireTime, startTime) &&
+                    !IsStrictlyBefore(fireTime, cur->mFireTime) && IsStrictlyBefore(latest, fireTime))
+                {
+                    fireTime = latest;
+                }
+            }
+        }
+    }
+#else
+    for (Timer *cur = mHead->mNext; (cur != NULL) && !IsStrictlyBefore(fireTime, cur->mFireTime); cur = cur->mNext)
+    {
+        uint32_t latest = cur->mFireTime + cur->mSlack;
+
+        if (IsStrictlyBefore(latest, fireTime))
+        {
+            fireTime = latest;
+        }
+    }
+#endif
+
+exit:
+    return fireTime;
+}
+
+bool TimerScheduler::ShouldFireBeforeAlarm(const Timer &aTimer, uint32_t aNow) const
+{
+    // Indicates whether a newly added (non-head) timer cannot be delayed until the currently scheduled alarm time
+    // (i.e., the alarm needs to be updated).
+
+    bool shouldFire = false;
+
+    VerifyOrExit(IsStrictlyBefore(aNow, mAlarmFireTime));
+
+    shouldFire = !IsStrictlyBefore(aNow, aTimer.mFireTime) ||
+                 ((aTimer.mFireTime + aTimer.mSlack - aNow) < (mAlarmFireTime - aNow));
+
+exit:
+    return shouldFire;
+}
+#endif // OPENTHREAD_CONFIG_ENABLE_TIMER_SLACK
+
 void TimerScheduler::ProcessTimers(const AlarmApi &aAlarmApi)
 {
     Timer *timer = mHead;
@@ -182,7 +447,17 @@ void TimerScheduler::ProcessTimers(const AlarmApi &aAlarmApi)
         if (!IsStrictlyBefore(aAlarmApi.AlarmGetNow(), timer->mFireTime))
         {
             Remove(*timer, aAlarmApi);
+#if OPENTHREAD_CONFIG_ENABLE_HANDLER_PROFILER
+            {
+                uintptr_t handler   = reinterpret_cast<uintptr_t>(timer->mHandler);
+                uint32_t  startTime = HandlerProfiler::GetNow();
+
+                timer->Fired();
+                GetInstance().GetHandlerProfiler().Record(OT_HANDLER_TYPE_TIMER, handler, startTime);
+            }
+#else
             timer->Fired();
+#endif
         }
         else
         {
@@ -225,8 +500,12 @@ const TimerScheduler::AlarmApi TimerMicroScheduler::sAlarmMicroApi = {&otPlatAla
 void TimerMicro::StartAt(uint32_t aT0, uint32_t aDt)
 {
     assert(aDt <= kMaxDt);
-    mFireTime = aT0 + aDt;
-    GetTimerMicroScheduler().Add(*this);
+
+#if OPENTHREAD_CONFIG_ENABLE_TIMER_SLACK
+    mSlack = 0;
+#endif
+
+    GetTimerMicroScheduler().Add(*this, aT0 + aDt);
 }
 
 void TimerMicro::Stop(void)
@@ -71,7 +71,8 @@ class Timer : public InstanceLocator, public OwnerLocator
 public:
     enum
     {
-        kMaxDt = (1UL << 31) - 1, //< Maximum permitted value for parameter `aDt` in `Start` and `StartAt` method.
+        kMaxDt    = (1UL << 31) - 1, //< Maximum permitted value for parameter `aDt` in `Start` and `StartAt` method.
+        kMaxSlack = 0xffff,          //< Maximum permitted value for parameter `aSlack` in `StartWithSlack` methods.
     };
 
     /**
@@ -96,6 +97,12 @@ public:
         , mHandler(aHandler)
         , mFireTime(0)
         , mNext(this)
+#if OPENTHREAD_CONFIG_ENABLE_TIMER_WHEEL
+        , mPrev(this)
+#endif
+#if OPENTHREAD_CONFIG_ENABLE_TIMER_SLACK
+        , mSlack(0)
+#endif
     {
     }
 
@@ -134,6 +141,12 @@ protected:
     Handler  mHandler;
     uint32_t mFireTime;
     Timer *  mNext;
+#if OPENTHREAD_CONFIG_ENABLE_TIMER_WHEEL
+    Timer *mPrev;
+#endif
+#if OPENTHREAD_CONFIG_ENABLE_TIMER_SLACK
+    uint16_t mSlack;
+#endif
 };
 
 /**
@@ -175,6 +188,35 @@ public:
      */
     void StartAt(uint32_t aT0, uint32_t aDt);
 
+    /**
+     * This method schedules the timer to fire within a window of @p aSlack milliseconds after @p aDt milliseconds from
+     * now.
+     *
+     * The timer scheduler may delay the timer by up to @p aSlack milliseconds so that it fires along with other
+     * timers, reducing the number of wake-ups. If `OPENTHREAD_CONFIG_ENABLE_TIMER_SLACK` is disabled, the slack is
+     * ignored and this method behaves as `Start()`.
+     *
+     * @param[in]  aDt     The expire time in milliseconds from now.
+     *                     (aDt must be smaller than or equal to kMaxDt).
+     * @param[in]  aSlack  The maximum amount of time in milliseconds the timer may fire after @p aDt.
+     *                     (aSlack must be smaller than or equal to kMaxSlack).
+     *
+     */
+    void StartWithSlack(uint32_t aDt, uint32_t aSlack) { StartAtWithSlack(GetNow(), aDt, aSlack); }
+
+    /**
+     * This method schedules the timer to fire within a window of @p aSlack milliseconds after @p aDt milliseconds
+     * from @p aT0.
+     *
+     * @param[in]  aT0     The start time in milliseconds.
+     * @param[in]  aDt     The expire time in milliseconds from @p aT0.
+     *                     (aDt must be smaller than or equal to kMaxDt).
+     * @param[in]  aSlack  The maximum amount of time in milliseconds the timer may fire after @p aDt.
+     *                     (aSlack must be smaller than or equal to kMaxSlack).
+     *
+     */
+    void StartAtWithSlack(uint32_t aT0, uint32_t aDt, uint32_t aSlack);
+
     /**
      * This method stops the timer.
      *
@@ -241,20 +283,29 @@ protected:
      * @param[in]  aInstance  A reference to the instance object.
      *
      */
-    TimerScheduler(Instance &aInstance)
-        : InstanceLocator(aInstance)
-        , mHead(NULL)
-    {
-    }
+    TimerScheduler(Instance &aInstance);
 
+public:
+    /**
+     * This method returns the number of times the platform alarm has been (re)started by the scheduler.
+     *
+     * @returns The number of platform alarm start calls.
+     *
+     */
+    uint32_t GetAlarmStartCount(void) const { return mAlarmStartCount; }
+
+protected:
     /**
      * This method adds a timer instance to the timer scheduler.
      *
+     * If the timer is already running, it is first removed and then added back with the new fire time.
+     *
      * @param[in]  aTimer     A reference to the timer instance.
+     * @param[in]  aFireTime  The fire time of the timer.
      * @param[in]  aAlarmApi  A reference to the Alarm APIs.
      *
      */
-    void Add(Timer &aTimer, const AlarmApi &aAlarmApi);
+    void Add(Timer &aTimer, uint32_t aFireTime, const AlarmApi &aAlarmApi);
 
     /**
      * This method removes a timer instance to the timer scheduler.
@@ -281,6 +332,18 @@ protected:
      */
     void SetAlarm(const AlarmApi &aAlarmApi);
 
+    /**
+     * This method gets the time remaining until the platform alarm fires for the next running timer.
+     *
+     * @param[in]   aAlarmApi   A reference to the Alarm APIs.
+     * @param[out]  aRemaining  A reference to output the remaining time (zero if the next timer is already due).
+     *
+     * @retval OT_ERROR_NONE       Successfully retrieved the remaining time.
+     * @retval OT_ERROR_NOT_FOUND  No timer is running.
+     *
+     */
+    otError GetRemainingTime(const AlarmApi &aAlarmApi, uint32_t &aRemaining) const;
+
     /**
      * This static method compares two times and indicates if the first time is strictly before (earlier) than the
      * second time.
@@ -296,7 +359,36 @@ protected:
      */
     static bool IsStrictlyBefore(uint32_t aTimeA, uint32_t aTimeB);
 
-    Timer *mHead;
+    Timer *  mHead;
+    uint32_t mAlarmStartCount;
+#if OPENTHREAD_CONFIG_ENABLE_TIMER_SLACK
+    uint32_t mAlarmFireTime;
+#endif
+
+private:
+#if OPENTHREAD_CONFIG_ENABLE_TIMER_SLACK
+    uint32_t GetAlarmFireTime(uint32_t aNow) const;
+    bool     ShouldFireBeforeAlarm(const Timer &aTimer, uint32_t aNow) const;
+#endif
+
+#if OPENTHREAD_CONFIG_ENABLE_TIMER_WHEEL
+    enum
+    {
+        kNumSlots  = OPENTHREAD_CONFIG_TIMER_WHEEL_NUM_SLOTS,
+        kSlotShift = OPENTHREAD_CONFIG_TIMER_WHEEL_SLOT_SHIFT,
+        kSlotWidth = (1UL << kSlotShift),
+    };
+
+    static uint16_t GetSlotIndex(uint32_t aFireTime) { return (aFireTime >> kSlotShift) & (kNumSlots - 1); }
+
+    void   AddToSlot(Timer &aTimer);
+    void   RemoveFromSlot(Timer &aTimer);
+    Timer *FindNextTimer(uint32_t aStartTime, uint32_t aNow) const;
+
+    // Each slot holds a list of timers in order of addition. The `mNext` of the last timer is NULL and the `mPrev` of
+    // the first timer points to the last one (so that a timer can be appended to a slot in constant time).
+    Timer *mSlots[kNumSlots];
+#endif // OPENTHREAD_CONFIG_ENABLE_TIMER_WHEEL
 };
 
 /**
@@ -320,10 +412,11 @@ public:
     /**
      * This method adds a timer instance to the timer scheduler.
      *
-     * @param[in]  aTimer  A reference to the timer instance.
+     * @param[in]  aTimer     A reference to the timer instance.
+     * @param[in]  aFireTime  The fire time of the timer.
      *
      */
-    void Add(TimerMilli &aTimer) { TimerScheduler::Add(aTimer, sAlarmMilliApi); }
+    void Add(TimerMilli &aTimer, uint32_t aFireTime) { TimerScheduler::Add(aTimer, aFireTime, sAlarmMilliApi); }
 
     /**
      * This method removes a timer instance to the timer scheduler.
@@ -339,6 +432,20 @@ public:
      */
     void ProcessTimers(void) { TimerScheduler::ProcessTimers(sAlarmMilliApi); }
 
+    /**
+     * This method gets the time (in milliseconds) remaining until the next millisecond timer fires.
+     *
+     * @param[out]  aRemaining  A reference to output the remaining time (zero if the next timer is already due).
+     *
+     * @retval OT_ERROR_NONE       Successfully retrieved the remaining time.
+     * @retval OT_ERROR_NOT_FOUND  No timer is running.
+     *
+     */
+    otError GetRemainingTime(uint32_t &aRemaining) const
+    {
+        return TimerScheduler::GetRemainingTime(sAlarmMilliApi, aRemaining);
+    }
+
 private:
     static const AlarmApi sAlarmMilliApi;
 };
@@ -430,10 +537,11 @@ public:
     /**
      * This method adds a timer instance to the timer scheduler.
      *
-     * @param[in]  aTimer  A reference to the timer instance.
+     * @param[in]  aTimer     A reference to the timer instance.
+     * @param[in]  aFireTime  The fire time of the timer.
      *
      */
-    void Add(TimerMicro &aTimer) { TimerScheduler::Add(aTimer, sAlarmMicroApi); }
+    void Add(TimerMicro &aTimer, uint32_t aFireTime) { TimerScheduler::Add(aTimer, aFireTime, sAlarmMicroApi); }
 
     /**
      * This method removes a timer instance to the timer scheduler.
@@ -449,6 +557,20 @@ public:
      */
     void ProcessTimers(void) { TimerScheduler::ProcessTimers(sAlarmMicroApi); }
 
+    /**
+     * This method gets the time (in microseconds) remaining until the next microsecond timer fires.
+     *
+     * @param[out]  aRemaining  A reference to output the remaining time (zero if the next timer is already due).
+     *
+     * @retval OT_ERROR_NONE       Successfully retrieved the remaining time.
+     * @retval OT_ERROR_NOT_FOUND  No timer is running.
+     *
+     */
+    otError GetRemainingTime(uint32_t &aRemaining) const
+    {
+        return TimerScheduler::GetRemainingTime(sAlarmMicroApi, aRemaining);
+    }
+
 private:
     static const AlarmApi sAlarmMicroApi;
 };
@@ -33,6 +33,8 @@
 
 #include "tlvs.hpp"
 
+#include "utils/wrap_string.h"
+
 #include "common/code_utils.hpp"
 #include "common/message.hpp"
 
@@ -136,4 +138,106 @@ exit:
     return error;
 }
 
+TlvIndex::TlvIndex(const Message &aMessage)
+    : mMessage(aMessage)
+{
+    uint16_t offset = aMessage.GetOffset();
+    uint16_t end    = aMessage.GetLength();
+    Tlv      tlv;
+
+    memset(mOffsets, 0xff, sizeof(mOffsets));
+
+    while (offset + sizeof(tlv) <= end)
+    {
+        uint32_t length = sizeof(tlv);
+
+        aMessage.Read(offset, sizeof(tlv), &tlv);
+
+        if (tlv.GetLength() != Tlv::kExtendedLength)
+        {
+            length += tlv.GetLength();
+        }
+        else
+        {
+            uint16_t extLength;
+
+            VerifyOrExit(sizeof(extLength) == aMessage.Read(offset + sizeof(tlv), sizeof(extLength), &extLength));
+            length += sizeof(extLength) + HostSwap16(extLength);
+        }
+
+        // As with `Tlv::GetOffset()`, TLVs following a malformed one are not found.
+        VerifyOrExit(offset + length <= end);
+
+        if (tlv.GetType() < kNumIndexedTypes && mOffsets[tlv.GetType()] == kNotPresent)
+        {
+            mOffsets[tlv.GetType()] = offset;
+        }
+
+        offset += static_cast<uint16_t>(length);
+    }
+
+exit:
+    return;
+}
+
+otError TlvIndex::Get(uint8_t aType, uint16_t aMaxLength, Tlv &aTlv) const
+{
+    otError  error;
+    uint16_t offset;
+
+    SuccessOrExit(error = GetOffset(aType, offset));
+    mMessage.Read(offset, sizeof(Tlv), &aTlv);
+
+    if (aMaxLength > sizeof(aTlv) + aTlv.GetLength())
+    {
+        aMaxLength = sizeof(aTlv) + aTlv.GetLength();
+    }
+
+    mMessage.Read(offset, aMaxLength, &aTlv);
+
+exit:
+    return error;
+}
+
+otError TlvIndex::GetOffset(uint8_t aType, uint16_t &aOffset) const
+{
+    otError error = OT_ERROR_NONE;
+
+    if (aType >= kNumIndexedTypes)
+    {
+        ExitNow(error = Tlv::GetOffset(mMessage, aType, aOffset));
+    }
+
+    VerifyOrExit(mOffsets[aType] != kNotPresent, error = OT_ERROR_NOT_FOUND);
+    aOffset = mOffsets[aType];
+
+exit:
+    return error;
+}
+
+otError TlvIndex::GetValueOffset(uint8_t aType, uint16_t &aOffset, uint16_t &aLength) const
+{
+    otError  error;
+    uint16_t offset;
+    Tlv      tlv;
+
+    SuccessOrExit(error = GetOffset(aType, offset));
+
+    mMessage.Read(offset, sizeof(tlv), &tlv);
+    offset += sizeof(tlv);
+    aLength = tlv.GetLength();
+
+    if (aLength == Tlv::kExtendedLength)
+    {
+        mMessage.Read(offset, sizeof(aLength), &aLength);
+        offset += sizeof(aLength);
+        aLength = HostSwap16(aLength);
+    }
+
+    aOffset = offset;
+
+exit:
+    return error;
+}
+
 } // namespace ot
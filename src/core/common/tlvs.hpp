@@ -181,6 +181,8 @@ protected:
     };
 
 private:
+    friend class TlvIndex;
+
     uint8_t mType;
     uint8_t mLength;
 } OT_TOOL_PACKED_END;
@@ -211,6 +213,75 @@ private:
     uint16_t mLength;
 } OT_TOOL_PACKED_END;
 
+/**
+ * This class implements an index of the TLVs in a message.
+ *
+ * The message is scanned once on construction and the offset of the first TLV of each low-numbered type is
+ * recorded, so that handlers looking up many TLVs in the same message do not re-read the buffer chain for each of
+ * them. Lookups of types beyond the index fall back to a linear scan. The message content and offset must not change
+ * while the index is in use.
+ *
+ */
+class TlvIndex
+{
+public:
+    /**
+     * This constructor indexes the TLVs of @p aMessage, starting from its current offset.
+     *
+     * @param[in]  aMessage  A reference to the message.
+     *
+     */
+    explicit TlvIndex(const Message &aMessage);
+
+    /**
+     * This method reads the requested TLV out of the message.
+     *
+     * @param[in]   aType       The Type value to search for.
+     * @param[in]   aMaxLength  Maximum number of bytes to read.
+     * @param[out]  aTlv        A reference to the TLV that will be copied to.
+     *
+     * @retval OT_ERROR_NONE       Successfully copied the TLV.
+     * @retval OT_ERROR_NOT_FOUND  Could not find the TLV with Type @p aType.
+     *
+     */
+    otError Get(uint8_t aType, uint16_t aMaxLength, Tlv &aTlv) const;
+
+    /**
+     * This method obtains the offset of a TLV within the message.
+     *
+     * @param[in]   aType       The Type value to search for.
+     * @param[out]  aOffset     A reference to the offset of the TLV.
+     *
+     * @retval OT_ERROR_NONE       Successfully found the TLV.
+     * @retval OT_ERROR_NOT_FOUND  Could not find the TLV with Type @p aType.
+     *
+     */
+    otError GetOffset(uint8_t aType, uint16_t &aOffset) const;
+
+    /**
+     * This method finds the offset and length of the value of a given TLV type.
+     *
+     * @param[in]   aType       The Type value to search for.
+     * @param[out]  aOffset     The offset where the value starts.
+     * @param[out]  aLength     The length of the value.
+     *
+     * @retval OT_ERROR_NONE       Successfully found the TLV.
+     * @retval OT_ERROR_NOT_FOUND  Could not find the TLV with Type @p aType.
+     *
+     */
+    otError GetValueOffset(uint8_t aType, uint16_t &aOffset, uint16_t &aLength) const;
+
+private:
+    enum
+    {
+        kNumIndexedTypes = 32,     ///< TLV types below this value are indexed.
+        kNotPresent      = 0xffff, ///< Offset value for a type that is not present.
+    };
+
+    const Message &mMessage;
+    uint16_t       mOffsets[kNumIndexedTypes];
+};
+
 } // namespace ot
 
 #endif // TLVS_HPP_
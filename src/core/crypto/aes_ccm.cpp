@@ -33,6 +33,9 @@
 
 #include "aes_ccm.hpp"
 
+#include <openthread/platform/crypto.h>
+#include <openthread/platform/toolchain.h>
+
 #include "common/code_utils.hpp"
 #include "common/debug.hpp"
 
@@ -42,6 +45,7 @@ namespace Crypto {
 otError AesCcm::SetKey(const uint8_t *aKey, uint16_t aKeyLength)
 {
     mEcb.SetKey(aKey, 8 * aKeyLength);
+    mKeySchedule = &mEcb;
     return OT_ERROR_NONE;
 }
 
@@ -121,7 +125,7 @@ otError AesCcm::Init(uint32_t    aHeaderLength,
     }
 
     // encrypt initial block
-    mEcb.Encrypt(mBlock, mBlock);
+    mKeySchedule->Encrypt(mBlock, mBlock);
 
     // process header
     if (aHeaderLength > 0)
@@ -180,7 +184,7 @@ void AesCcm::Header(const void *aHeader, uint32_t aHeaderLength)
     {
         if (mBlockLength == sizeof(mBlock))
         {
-            mEcb.Encrypt(mBlock, mBlock);
+            mKeySchedule->Encrypt(mBlock, mBlock);
             mBlockLength = 0;
         }
 
@@ -194,7 +198,7 @@ void AesCcm::Header(const void *aHeader, uint32_t aHeaderLength)
         // process remainder
         if (mBlockLength != 0)
         {
-            mEcb.Encrypt(mBlock, mBlock);
+            mKeySchedule->Encrypt(mBlock, mBlock);
         }
 
         mBlockLength = 0;
@@ -211,18 +215,9 @@ void AesCcm::Payload(void *plaintext, void *ciphertext, uint32_t len, bool aEncr
 
     for (unsigned i = 0; i < len; i++)
     {
-        if (mCtrLength == 16)
+        if (mCtrLength == sizeof(mCtrPad))
         {
-            for (int j = sizeof(mCtr) - 1; j > mNonceLength; j--)
-            {
-                if (++mCtr[j])
-                {
-                    break;
-                }
-            }
-
-            mEcb.Encrypt(mCtr, mCtrPad);
-            mCtrLength = 0;
+            GenerateCtrPad(mPlainTextLength - mPlainTextCur - i);
         }
 
         if (aEncrypt)
@@ -238,7 +233,7 @@ void AesCcm::Payload(void *plaintext, void *ciphertext, uint32_t len, bool aEncr
 
         if (mBlockLength == sizeof(mBlock))
         {
-            mEcb.Encrypt(mBlock, mBlock);
+            mKeySchedule->Encrypt(mBlock, mBlock);
             mBlockLength = 0;
         }
 
@@ -251,7 +246,7 @@ void AesCcm::Payload(void *plaintext, void *ciphertext, uint32_t len, bool aEncr
     {
         if (mBlockLength != 0)
         {
-            mEcb.Encrypt(mBlock, mBlock);
+            mKeySchedule->Encrypt(mBlock, mBlock);
         }
 
         // reset counter
@@ -262,6 +257,35 @@ void AesCcm::Payload(void *plaintext, void *ciphertext, uint32_t len, bool aEncr
     }
 }
 
+void AesCcm::GenerateCtrPad(uint32_t aRemainingLength)
+{
+    uint8_t  counters[sizeof(mCtrPad)];
+    uint16_t numBlocks = kCtrBatchBlocks;
+
+    // Do not run the block cipher for keystream beyond the end of the payload.
+    if (aRemainingLength < sizeof(mCtrPad))
+    {
+        numBlocks = static_cast<uint16_t>((aRemainingLength + AesEcb::kBlockSize - 1) / AesEcb::kBlockSize);
+    }
+
+    for (uint16_t block = 0; block < numBlocks; block++)
+    {
+        for (int j = sizeof(mCtr) - 1; j > mNonceLength; j--)
+        {
+            if (++mCtr[j])
+            {
+                break;
+            }
+        }
+
+        memcpy(&counters[block * AesEcb::kBlockSize], mCtr, sizeof(mCtr));
+    }
+
+    // The keystream is placed at the end of `mCtrPad`, so that it is always used up at `sizeof(mCtrPad)`.
+    mCtrLength = static_cast<uint16_t>(sizeof(mCtrPad) - numBlocks * AesEcb::kBlockSize);
+    mKeySchedule->Encrypt(counters, &mCtrPad[mCtrLength], numBlocks);
+}
+
 void AesCcm::Finalize(void *tag, uint8_t *aTagLength)
 {
     uint8_t *tagBytes = reinterpret_cast<uint8_t *>(tag);
@@ -270,7 +294,7 @@ void AesCcm::Finalize(void *tag, uint8_t *aTagLength)
 
     if (mTagLength > 0)
     {
-        mEcb.Encrypt(mCtr, mCtrPad);
+        mKeySchedule->Encrypt(mCtr, mCtrPad);
 
         for (int i = 0; i < mTagLength; i++)
         {
@@ -286,3 +310,30 @@ void AesCcm::Finalize(void *tag, uint8_t *aTagLength)
 
 } // namespace Crypto
 } // namespace ot
+
+#if OPENTHREAD_CONFIG_ENABLE_PLATFORM_AES_CCM
+OT_TOOL_WEAK otError otPlatCryptoAesCcm(const uint8_t *aKey,
+                                        const uint8_t *aNonce,
+                                        uint8_t        aNonceLength,
+                                        const uint8_t *aHeader,
+                                        uint16_t       aHeaderLength,
+                                        uint8_t *      aPayload,
+                                        uint16_t       aPayloadLength,
+                                        uint8_t *      aTag,
+                                        uint8_t        aTagLength,
+                                        bool           aEncrypt)
+{
+    OT_UNUSED_VARIABLE(aKey);
+    OT_UNUSED_VARIABLE(aNonce);
+    OT_UNUSED_VARIABLE(aNonceLength);
+    OT_UNUSED_VARIABLE(aHeader);
+    OT_UNUSED_VARIABLE(aHeaderLength);
+    OT_UNUSED_VARIABLE(aPayload);
+    OT_UNUSED_VARIABLE(aPayloadLength);
+    OT_UNUSED_VARIABLE(aTag);
+    OT_UNUSED_VARIABLE(aTagLength);
+    OT_UNUSED_VARIABLE(aEncrypt);
+
+    return OT_ERROR_NOT_IMPLEMENTED;
+}
+#endif // OPENTHREAD_CONFIG_ENABLE_PLATFORM_AES_CCM
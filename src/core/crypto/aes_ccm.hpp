@@ -68,6 +68,17 @@ public:
      */
     otError SetKey(const uint8_t *aKey, uint16_t aKeyLength);
 
+    /**
+     * This method sets the key from an already expanded AES key schedule.
+     *
+     * This avoids running the AES key expansion again for a key that is used repeatedly. The @p aKeySchedule object
+     * is referenced, not copied, and must remain valid and unchanged until the computation is finalized.
+     *
+     * @param[in]  aKeySchedule  A reference to the AES ECB object holding the expanded key.
+     *
+     */
+    void SetKey(const AesEcb &aKeySchedule) { mKeySchedule = &aKeySchedule; }
+
     /**
      * This method initializes the AES CCM computation.
      *
@@ -119,21 +130,25 @@ public:
 private:
     enum
     {
-        kTagLengthMin = 4,
+        kTagLengthMin   = 4,
+        kCtrBatchBlocks = OPENTHREAD_CONFIG_AES_CCM_CTR_BATCH_BLOCKS, ///< Keystream blocks generated at once.
     };
 
-    AesEcb   mEcb;
-    uint8_t  mBlock[AesEcb::kBlockSize];
-    uint8_t  mCtr[AesEcb::kBlockSize];
-    uint8_t  mCtrPad[AesEcb::kBlockSize];
-    uint8_t  mNonceLength;
-    uint32_t mHeaderLength;
-    uint32_t mHeaderCur;
-    uint32_t mPlainTextLength;
-    uint32_t mPlainTextCur;
-    uint16_t mBlockLength;
-    uint16_t mCtrLength;
-    uint8_t  mTagLength;
+    void GenerateCtrPad(uint32_t aRemainingLength);
+
+    AesEcb        mEcb;
+    const AesEcb *mKeySchedule;
+    uint8_t       mBlock[AesEcb::kBlockSize];
+    uint8_t       mCtr[AesEcb::kBlockSize];
+    uint8_t       mCtrPad[kCtrBatchBlocks * AesEcb::kBlockSize]; ///< Keystream, the unused part is at the end.
+    uint8_t       mNonceLength;
+    uint32_t      mHeaderLength;
+    uint32_t      mHeaderCur;
+    uint32_t      mPlainTextLength;
+    uint32_t      mPlainTextCur;
+    uint16_t      mBlockLength;
+    uint16_t      mCtrLength;
+    uint8_t       mTagLength;
 };
 
 /**
@@ -46,9 +46,19 @@ void AesEcb::SetKey(const uint8_t *aKey, uint16_t aKeyLength)
     mbedtls_aes_setkey_enc(&mContext, aKey, aKeyLength);
 }
 
-void AesEcb::Encrypt(const uint8_t aInput[kBlockSize], uint8_t aOutput[kBlockSize])
+void AesEcb::Encrypt(const uint8_t aInput[kBlockSize], uint8_t aOutput[kBlockSize]) const
 {
-    mbedtls_aes_crypt_ecb(&mContext, MBEDTLS_AES_ENCRYPT, aInput, aOutput);
+    // The expanded key is only read while encrypting.
+    mbedtls_aes_crypt_ecb(const_cast<mbedtls_aes_context *>(&mContext), MBEDTLS_AES_ENCRYPT, aInput, aOutput);
+}
+
+void AesEcb::Encrypt(const uint8_t *aInput, uint8_t *aOutput, uint16_t aNumBlocks) const
+{
+    // mbedTLS has no multi-block ECB call, its AES-NI or MBEDTLS_AES_ALT implementation is used per block.
+    for (uint16_t i = 0; i < aNumBlocks; i++)
+    {
+        Encrypt(aInput + i * kBlockSize, aOutput + i * kBlockSize);
+    }
 }
 
 AesEcb::~AesEcb()
@@ -88,7 +88,20 @@ public:
      * @param[out]  aOutput  A pointer to the output buffer.
      *
      */
-    void Encrypt(const uint8_t aInput[kBlockSize], uint8_t aOutput[kBlockSize]);
+    void Encrypt(const uint8_t aInput[kBlockSize], uint8_t aOutput[kBlockSize]) const;
+
+    /**
+     * This method encrypts a number of consecutive blocks.
+     *
+     * The blocks are independent (ECB), so an AES implementation which pipelines or vectorizes the block cipher can
+     * process them together.
+     *
+     * @param[in]   aInput      A pointer to the input buffer (@p aNumBlocks * `kBlockSize` bytes).
+     * @param[out]  aOutput     A pointer to the output buffer (@p aNumBlocks * `kBlockSize` bytes).
+     * @param[in]   aNumBlocks  The number of blocks.
+     *
+     */
+    void Encrypt(const uint8_t *aInput, uint8_t *aOutput, uint16_t aNumBlocks) const;
 
 private:
     mbedtls_aes_context mContext;
@@ -33,6 +33,8 @@
 
 #include "hmac_sha256.hpp"
 
+#include "common/message.hpp"
+
 namespace ot {
 namespace Crypto {
 
@@ -59,6 +61,19 @@ void HmacSha256::Update(const uint8_t *aBuf, uint16_t aBufLength)
     mbedtls_md_hmac_update(&mContext, aBuf, aBufLength);
 }
 
+void HmacSha256::Update(const Message &aMessage, uint16_t aOffset, uint16_t aLength)
+{
+    Message::Chunk chunk;
+
+    aMessage.GetFirstChunk(aOffset, aLength, chunk);
+
+    while (chunk.mLength > 0)
+    {
+        Update(chunk.mData, chunk.mLength);
+        aMessage.GetNextChunk(aLength, chunk);
+    }
+}
+
 void HmacSha256::Finish(uint8_t aHash[kHashSize])
 {
     mbedtls_md_hmac_finish(&mContext, aHash);
@@ -33,8 +33,11 @@
 
 #include "mbedtls.hpp"
 
+#include <string.h>
+
 #include <mbedtls/platform.h>
 
+#include "common/code_utils.hpp"
 #include "common/instance.hpp"
 
 #if !OPENTHREAD_ENABLE_MULTIPLE_INSTANCES
@@ -44,11 +47,32 @@ namespace Crypto {
 
 static void *CAlloc(size_t aCount, size_t aSize)
 {
+#if OPENTHREAD_CONFIG_DTLS_ARENA_SIZE
+    void *pointer = NULL;
+
+    if (aSize == 0 || aCount <= static_cast<size_t>(-1) / aSize)
+    {
+        pointer = MbedTlsArena::HandleCAlloc(aCount * aSize);
+    }
+
+    if (pointer != NULL)
+    {
+        return pointer;
+    }
+#endif
+
     return Instance::Get().GetHeap().CAlloc(aCount, aSize);
 }
 
 static void Free(void *aPointer)
 {
+#if OPENTHREAD_CONFIG_DTLS_ARENA_SIZE
+    if (MbedTlsArena::HandleFree(aPointer))
+    {
+        return;
+    }
+#endif
+
     Instance::Get().GetHeap().Free(aPointer);
 }
 
@@ -57,6 +81,146 @@ MbedTls::MbedTls(void)
     mbedtls_platform_set_calloc_free(CAlloc, Free);
 }
 
+#if OPENTHREAD_CONFIG_DTLS_ARENA_SIZE
+
+MbedTlsArena *MbedTlsArena::sActive = NULL;
+MbedTlsArena *MbedTlsArena::sList   = NULL;
+
+MbedTlsArena::Scope::Scope(MbedTlsArena &aArena)
+    : mPrevious(sActive)
+{
+    sActive = &aArena;
+}
+
+MbedTlsArena::Scope::~Scope(void)
+{
+    sActive = mPrevious;
+}
+
+MbedTlsArena::MbedTlsArena(void)
+    : mBuffer(NULL)
+    , mUsed(0)
+    , mLastOffset(0)
+    , mPeakUsage(0)
+    , mAllocations(0)
+    , mFallbackCount(0)
+    , mNext(NULL)
+{
+}
+
+otError MbedTlsArena::Start(void)
+{
+    otError error = OT_ERROR_NONE;
+
+    mPeakUsage     = mUsed;
+    mFallbackCount = 0;
+
+    VerifyOrExit(mBuffer == NULL);
+
+    mBuffer = static_cast<uint8_t *>(Instance::Get().GetHeap().CAlloc(1, OPENTHREAD_CONFIG_DTLS_ARENA_SIZE));
+    VerifyOrExit(mBuffer != NULL, error = OT_ERROR_NO_BUFS);
+
+    mUsed        = 0;
+    mLastOffset  = 0;
+    mAllocations = 0;
+    mNext        = sList;
+    sList        = this;
+
+exit:
+    return error;
+}
+
+void MbedTlsArena::Stop(void)
+{
+    VerifyOrExit(mBuffer != NULL && mAllocations == 0);
+
+    for (MbedTlsArena **arena = &sList; *arena != NULL; arena = &(*arena)->mNext)
+    {
+        if (*arena == this)
+        {
+            *arena = mNext;
+            break;
+        }
+    }
+
+    Instance::Get().GetHeap().Free(mBuffer);
+    mBuffer = NULL;
+    mUsed   = 0;
+
+exit:
+    return;
+}
+
+void *MbedTlsArena::HandleCAlloc(size_t aSize)
+{
+    return (sActive != NULL) ? sActive->CAlloc(aSize) : NULL;
+}
+
+bool MbedTlsArena::HandleFree(void *aPointer)
+{
+    bool rval = false;
+
+    for (MbedTlsArena *arena = sList; arena != NULL && !rval; arena = arena->mNext)
+    {
+        rval = arena->Free(aPointer);
+    }
+
+    return rval;
+}
+
+void *MbedTlsArena::CAlloc(size_t aSize)
+{
+    void * pointer = NULL;
+    size_t size    = (aSize + kAlignment - 1) & ~static_cast<size_t>(kAlignment - 1);
+
+    VerifyOrExit(mBuffer != NULL && aSize > 0);
+
+    if (size < aSize || size > OPENTHREAD_CONFIG_DTLS_ARENA_SIZE - mUsed || mAllocations == 0xffff)
+    {
+        mFallbackCount++;
+        ExitNow();
+    }
+
+    pointer     = mBuffer + mUsed;
+    mLastOffset = mUsed;
+    mUsed += size;
+    mAllocations++;
+
+    if (mUsed > mPeakUsage)
+    {
+        mPeakUsage = mUsed;
+    }
+
+    memset(pointer, 0, size);
+
+exit:
+    return pointer;
+}
+
+bool MbedTlsArena::Free(void *aPointer)
+{
+    uint8_t *pointer = static_cast<uint8_t *>(aPointer);
+    bool     rval    = false;
+
+    VerifyOrExit(mBuffer != NULL && pointer >= mBuffer && pointer < mBuffer + OPENTHREAD_CONFIG_DTLS_ARENA_SIZE);
+    rval = true;
+
+    if (--mAllocations == 0)
+    {
+        mUsed = 0;
+    }
+    else if (pointer == mBuffer + mLastOffset)
+    {
+        // Reclaim the most recent allocation, e.g. a buffer that mbedTLS released right after growing it.
+        mUsed = mLastOffset;
+    }
+
+exit:
+    return rval;
+}
+
+#endif // OPENTHREAD_CONFIG_DTLS_ARENA_SIZE
+
 } // namespace Crypto
 } // namespace ot
 
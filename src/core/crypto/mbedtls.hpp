@@ -36,8 +36,12 @@
 
 #include "openthread-core-config.h"
 
+#include <stddef.h>
+
 #include <openthread/instance.h>
 
+#include "utils/wrap_stdint.h"
+
 #if !OPENTHREAD_ENABLE_MULTIPLE_INSTANCES
 
 namespace ot {
@@ -64,6 +68,127 @@ public:
     MbedTls(void);
 };
 
+#if OPENTHREAD_CONFIG_DTLS_ARENA_SIZE
+
+/**
+ * This class implements an arena that serves the mbedTLS allocations of one DTLS session.
+ *
+ * The arena takes a single `OPENTHREAD_CONFIG_DTLS_ARENA_SIZE` block from the heap and hands out memory from it
+ * sequentially. Freed memory is reclaimed only when it is the most recent allocation or when no allocation remains.
+ * Allocations made while no arena is active, or that do not fit, are served by the heap.
+ *
+ */
+class MbedTlsArena
+{
+public:
+    /**
+     * This class activates an arena for the mbedTLS allocations made during its lifetime.
+     *
+     */
+    class Scope
+    {
+    public:
+        /**
+         * This constructor activates @p aArena.
+         *
+         * @param[in]  aArena  A reference to the arena.
+         *
+         */
+        explicit Scope(MbedTlsArena &aArena);
+
+        /**
+         * This destructor restores the previously active arena.
+         *
+         */
+        ~Scope(void);
+
+    private:
+        MbedTlsArena *mPrevious;
+    };
+
+    /**
+     * This constructor initializes the object.
+     *
+     */
+    MbedTlsArena(void);
+
+    /**
+     * This method takes the arena block from the heap, if not already taken, and clears the usage statistics.
+     *
+     * @retval OT_ERROR_NONE     Successfully took the arena block.
+     * @retval OT_ERROR_NO_BUFS  Insufficient heap, allocations will be served by the heap.
+     *
+     */
+    otError Start(void);
+
+    /**
+     * This method returns the arena block to the heap.
+     *
+     * The block is kept if some of its allocations have not been freed.
+     *
+     */
+    void Stop(void);
+
+    /**
+     * This method returns the highest number of arena bytes in use since `Start()`.
+     *
+     * @returns The peak usage in bytes.
+     *
+     */
+    size_t GetPeakUsage(void) const { return mPeakUsage; }
+
+    /**
+     * This method returns the number of allocations served by the heap because they did not fit in the arena.
+     *
+     * @returns The number of heap fallbacks since `Start()`.
+     *
+     */
+    uint16_t GetFallbackCount(void) const { return mFallbackCount; }
+
+    /**
+     * This static method allocates zeroed memory from the active arena.
+     *
+     * @param[in]  aSize  The number of bytes to allocate.
+     *
+     * @returns A pointer to the memory, or NULL if no arena is active or the active arena is exhausted.
+     *
+     */
+    static void *HandleCAlloc(size_t aSize);
+
+    /**
+     * This static method frees memory if it belongs to an arena.
+     *
+     * @param[in]  aPointer  A pointer to the memory.
+     *
+     * @retval TRUE   @p aPointer belonged to an arena and has been freed.
+     * @retval FALSE  @p aPointer does not belong to any arena.
+     *
+     */
+    static bool HandleFree(void *aPointer);
+
+private:
+    enum
+    {
+        kAlignment = sizeof(long),
+    };
+
+    void *CAlloc(size_t aSize);
+    bool  Free(void *aPointer);
+
+    uint8_t *     mBuffer;
+    size_t        mUsed;
+    size_t        mLastOffset;
+    size_t        mPeakUsage;
+    uint16_t      mAllocations;
+    uint16_t      mFallbackCount;
+    MbedTlsArena *mNext;
+
+    static MbedTlsArena *sActive;
+    static MbedTlsArena *sList;
+};
+
+#endif // OPENTHREAD_CONFIG_DTLS_ARENA_SIZE
+
 /**
  * @}
  *
@@ -33,6 +33,8 @@
 
 #include "sha256.hpp"
 
+#include "common/message.hpp"
+
 namespace ot {
 namespace Crypto {
 
@@ -56,6 +58,19 @@ void Sha256::Update(const uint8_t *aBuf, uint16_t aBufLength)
     mbedtls_sha256_update_ret(&mContext, aBuf, aBufLength);
 }
 
+void Sha256::Update(const Message &aMessage, uint16_t aOffset, uint16_t aLength)
+{
+    Message::Chunk chunk;
+
+    aMessage.GetFirstChunk(aOffset, aLength, chunk);
+
+    while (chunk.mLength > 0)
+    {
+        Update(chunk.mData, chunk.mLength);
+        aMessage.GetNextChunk(aLength, chunk);
+    }
+}
+
 void Sha256::Finish(uint8_t aHash[kHashSize])
 {
     mbedtls_sha256_finish_ret(&mContext, aHash);
@@ -41,6 +41,9 @@
 #include <mbedtls/sha256.h>
 
 namespace ot {
+
+class Message;
+
 namespace Crypto {
 
 /**
@@ -89,6 +92,18 @@ public:
      */
     void Update(const uint8_t *aBuf, uint16_t aBufLength);
 
+    /**
+     * This method inputs bytes read from a message into the SHA-256 computation.
+     *
+     * The bytes are processed directly from the message buffers, without copying them.
+     *
+     * @param[in]  aMessage  A reference to the message.
+     * @param[in]  aOffset   The offset in @p aMessage of the first byte to input.
+     * @param[in]  aLength   The number of bytes to input (clipped to the end of @p aMessage).
+     *
+     */
+    void Update(const Message &aMessage, uint16_t aOffset, uint16_t aLength);
+
     /**
      * This method finalizes the hash computation.
      *
@@ -53,7 +53,7 @@ namespace Mac {
 
 LinkRaw::LinkRaw(Instance &aInstance)
     : InstanceLocator(aInstance)
-    , mOperationTask(aInstance, &LinkRaw::HandleOperationTask, this)
+    , mOperationTask(aInstance, &LinkRaw::HandleOperationTask, this, Tasklet::kPriorityHigh)
     , mPendingTransmitData(false)
 #if OPENTHREAD_LINKRAW_TIMER_REQUIRED
     , mTimer(aInstance, &LinkRaw::HandleTimer, this)
@@ -70,6 +70,11 @@ LinkRaw::LinkRaw(Instance &aInstance)
 #if OPENTHREAD_CONFIG_ENABLE_SOFTWARE_RETRANSMIT
     , mTransmitRetries(0)
 #endif // OPENTHREAD_CONFIG_ENABLE_SOFTWARE_RETRANSMIT
+#if OPENTHREAD_CONFIG_LINK_RAW_TRANSMIT_BATCH_SIZE
+    , mBatchCount(0)
+    , mBatchIndex(0)
+    , mTransmitBatchDoneCallback(NULL)
+#endif
     , mReceiveChannel(OPENTHREAD_CONFIG_DEFAULT_CHANNEL)
     , mReceiveDoneCallback(NULL)
     , mTransmitDoneCallback(NULL)
@@ -114,6 +119,14 @@ otError LinkRaw::SetEnabled(bool aEnabled)
 
     mEnabled = aEnabled;
 
+#if OPENTHREAD_CONFIG_LINK_RAW_TRANSMIT_BATCH_SIZE
+    if (!aEnabled)
+    {
+        // Any batch in progress is dropped, as its remaining frames can no longer be sent.
+        mBatchCount = 0;
+    }
+#endif
+
 #if OPENTHREAD_MTD || OPENTHREAD_FTD
 exit:
 #endif // OPENTHREAD_MTD || OPENTHREAD_FTD
@@ -259,6 +272,9 @@ otError LinkRaw::Transmit(otLinkRawTransmitDone aCallback)
     otError error = OT_ERROR_NONE;
 
     VerifyOrExit(mEnabled, error = OT_ERROR_INVALID_STATE);
+#if OPENTHREAD_CONFIG_LINK_RAW_TRANSMIT_BATCH_SIZE
+    VerifyOrExit(mBatchCount == 0, error = OT_ERROR_INVALID_STATE);
+#endif
 
     mTransmitDoneCallback = aCallback;
 
@@ -346,8 +362,6 @@ void LinkRaw::InvokeTransmitDone(otRadioFrame *aFrame, otRadioFrame *aAckFrame,
     // Transition back to receive state on previous channel
     otPlatRadioReceive(&GetInstance(), mReceiveChannel);
 
-    VerifyOrExit(mTransmitDoneCallback != NULL);
-
     switch (aError)
     {
     case OT_ERROR_NONE:
@@ -360,12 +374,104 @@ void LinkRaw::InvokeTransmitDone(otRadioFrame *aFrame, otRadioFrame *aAckFrame,
         break;
     }
 
+#if OPENTHREAD_CONFIG_LINK_RAW_TRANSMIT_BATCH_SIZE
+    if (mBatchCount != 0)
+    {
+        ExitNow(HandleBatchFrameDone(aError));
+    }
+#endif
+
+    VerifyOrExit(mTransmitDoneCallback != NULL);
+
     mTransmitDoneCallback(&GetInstance(), aFrame, aAckFrame, aError);
 
 exit:
     return;
 }
 
+#if OPENTHREAD_CONFIG_LINK_RAW_TRANSMIT_BATCH_SIZE
+
+otError LinkRaw::TransmitBatch(const otLinkRawBatchFrame *aFrames, uint8_t aCount, otLinkRawTransmitBatchDone aCallback)
+{
+    otError error = OT_ERROR_NONE;
+
+    VerifyOrExit(mEnabled && mBatchCount == 0, error = OT_ERROR_INVALID_STATE);
+    VerifyOrExit(aCount > 0 && aCount <= kTransmitBatchSize, error = OT_ERROR_INVALID_ARGS);
+
+    for (uint8_t i = 0; i < aCount; i++)
+    {
+        BatchFrame &batchFrame = mBatchFrames[i];
+
+        VerifyOrExit(aFrames[i].mLength <= OT_RADIO_FRAME_MAX_SIZE, error = OT_ERROR_INVALID_ARGS);
+
+        memcpy(batchFrame.mPsdu, aFrames[i].mPsdu, aFrames[i].mLength);
+        batchFrame.mLength          = aFrames[i].mLength;
+        batchFrame.mChannel         = aFrames[i].mChannel;
+        batchFrame.mMaxCsmaBackoffs = aFrames[i].mMaxCsmaBackoffs;
+        batchFrame.mMaxFrameRetries = aFrames[i].mMaxFrameRetries;
+        batchFrame.mCsmaCaEnabled   = aFrames[i].mCsmaCaEnabled;
+    }
+
+    mTransmitBatchDoneCallback = aCallback;
+    mBatchCount                = aCount;
+    mBatchIndex                = 0;
+
+    StartBatchFrame();
+
+exit:
+    return error;
+}
+
+void LinkRaw::StartBatchFrame(void)
+{
+    const BatchFrame &batchFrame = mBatchFrames[mBatchIndex];
+
+    memcpy(mTransmitFrame->mPsdu, batchFrame.mPsdu, batchFrame.mLength);
+    mTransmitFrame->mLength                        = batchFrame.mLength;
+    mTransmitFrame->mChannel                       = batchFrame.mChannel;
+    mTransmitFrame->mInfo.mTxInfo.mMaxCsmaBackoffs = batchFrame.mMaxCsmaBackoffs;
+    mTransmitFrame->mInfo.mTxInfo.mMaxFrameRetries = batchFrame.mMaxFrameRetries;
+    mTransmitFrame->SetCsmaCaEnabled(batchFrame.mCsmaCaEnabled);
+
+#if OPENTHREAD_CONFIG_ENABLE_SOFTWARE_CSMA_BACKOFF
+    mCsmaBackoffs = 0;
+#endif
+
+#if OPENTHREAD_CONFIG_ENABLE_SOFTWARE_RETRANSMIT
+    mTransmitRetries = 0;
+#endif
+
+    StartTransmit();
+}
+
+void LinkRaw::HandleBatchFrameDone(otError aError)
+{
+    uint8_t count;
+
+    mBatchErrors[mBatchIndex++] = aError;
+
+    if (mBatchIndex < mBatchCount)
+    {
+        // The next frame is started right away, without a round trip to the caller.
+        ExitNow(StartBatchFrame());
+    }
+
+    count       = mBatchCount;
+    mBatchCount = 0;
+
+    otLogDebgPlat("LinkRaw Transmit Batch Done (%d frames)", count);
+
+    if (mTransmitBatchDoneCallback != NULL)
+    {
+        mTransmitBatchDoneCallback(&GetInstance(), mBatchErrors, count);
+    }
+
+exit:
+    return;
+}
+
+#endif // OPENTHREAD_CONFIG_LINK_RAW_TRANSMIT_BATCH_SIZE
+
 otError LinkRaw::EnergyScan(uint8_t aScanChannel, uint16_t aScanDuration, otLinkRawEnergyScanDone aCallback)
 {
     otError error = OT_ERROR_INVALID_STATE;
@@ -560,6 +666,20 @@ extern "C" void otPlatRadioReceiveDone(otInstance *aInstance, otRadioFrame *aFra
     static_cast<ot::Instance *>(aInstance)->GetLinkRaw().InvokeReceiveDone(aFrame, aError);
 }
 
+#if OPENTHREAD_CONFIG_RADIO_RX_QUEUE
+extern "C" void otPlatRadioReceivePending(otInstance *aInstance)
+{
+    otRadioFrame *frame;
+
+    // Frames are processed in order of reception, each buffer going back to the driver as soon as it is done with.
+    while ((frame = otPlatRadioGetReceivedFrame(aInstance)) != NULL)
+    {
+        otPlatRadioReceiveDone(aInstance, frame, OT_ERROR_NONE);
+        otPlatRadioReleaseReceivedFrame(aInstance, frame);
+    }
+}
+#endif
+
 extern "C" void otPlatRadioTxDone(otInstance *aInstance, otRadioFrame *aFrame, otRadioFrame *aAckFrame, otError aError)
 {
     static_cast<ot::Instance *>(aInstance)->GetLinkRaw().InvokeTransmitDone(aFrame, aAckFrame, aError);
@@ -580,6 +700,16 @@ exit:
     return;
 }
 
+extern "C" void otPlatRadioEnergyScanMultiChannelDone(otInstance *  aInstance,
+                                                      uint32_t      aScanChannels,
+                                                      const int8_t *aMaxRssi)
+{
+    // Note: Multi-channel energy scans are only issued by the MAC, never in Radio Only mode.
+    (void)aInstance;
+    (void)aScanChannels;
+    (void)aMaxRssi;
+}
+
 #if OPENTHREAD_CONFIG_HEADER_IE_SUPPORT
 extern "C" void otPlatRadioFrameUpdated(otInstance *aInstance, otRadioFrame *aFrame)
 {
@@ -139,6 +139,27 @@ public:
      */
     void InvokeTransmitDone(otRadioFrame *aFrame, otRadioFrame *aAckFrame, otError aError);
 
+#if OPENTHREAD_CONFIG_LINK_RAW_TRANSMIT_BATCH_SIZE
+    /**
+     * This method starts a batched Transmit of several frames on the link-layer.
+     *
+     * The frames are copied and sent back-to-back, each with its own CSMA-CA and retry parameters, and the callback
+     * is invoked once with the outcome of every frame.
+     *
+     * @note The callback @p aCallback will not be called if this call does not return OT_ERROR_NONE.
+     *
+     * @param[in]  aFrames              A pointer to an array of frames.
+     * @param[in]  aCount               The number of frames in @p aFrames.
+     * @param[in]  aCallback            A pointer to a function called on completion of the batch.
+     *
+     * @retval OT_ERROR_NONE            Successfully started the batch.
+     * @retval OT_ERROR_INVALID_STATE   The raw link-layer isn't enabled or a batch is already in progress.
+     * @retval OT_ERROR_INVALID_ARGS    @p aCount is zero or too large, or a frame is too long.
+     *
+     */
+    otError TransmitBatch(const otLinkRawBatchFrame *aFrames, uint8_t aCount, otLinkRawTransmitBatchDone aCallback);
+#endif
+
     /**
      * This method starts a (single) Enery Scan on the link-layer.
      *
@@ -293,6 +314,32 @@ private:
 
 #endif // OPENTHREAD_CONFIG_ENABLE_SOFTWARE_RETRANSMIT
 
+#if OPENTHREAD_CONFIG_LINK_RAW_TRANSMIT_BATCH_SIZE
+    enum
+    {
+        kTransmitBatchSize = OPENTHREAD_CONFIG_LINK_RAW_TRANSMIT_BATCH_SIZE,
+    };
+
+    struct BatchFrame
+    {
+        uint8_t mPsdu[OT_RADIO_FRAME_MAX_SIZE];
+        uint8_t mLength;
+        uint8_t mChannel;
+        uint8_t mMaxCsmaBackoffs;
+        uint8_t mMaxFrameRetries;
+        bool    mCsmaCaEnabled;
+    };
+
+    void StartBatchFrame(void);
+    void HandleBatchFrameDone(otError aError);
+
+    BatchFrame                 mBatchFrames[kTransmitBatchSize];
+    otError                    mBatchErrors[kTransmitBatchSize];
+    uint8_t                    mBatchCount; // Number of frames in the current batch, zero if no batch in progress.
+    uint8_t                    mBatchIndex; // Index of the frame being transmitted.
+    otLinkRawTransmitBatchDone mTransmitBatchDoneCallback;
+#endif // OPENTHREAD_CONFIG_LINK_RAW_TRANSMIT_BATCH_SIZE
+
 #if OPENTHREAD_CONFIG_ENABLE_SOFTWARE_ENERGY_SCAN
 
     enum
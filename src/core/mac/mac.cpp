@@ -38,6 +38,8 @@
 #include <stdio.h>
 #include "utils/wrap_string.h"
 
+#include <openthread/platform/crypto.h>
+
 #include "common/code_utils.hpp"
 #include "common/debug.hpp"
 #include "common/encoding.hpp"
@@ -84,10 +86,34 @@ Mac::Mac(Instance &aInstance)
 #if OPENTHREAD_CONFIG_STAY_AWAKE_BETWEEN_FRAGMENTS
     , mDelaySleep(false)
 #endif
-    , mOperationTask(aInstance, &Mac::HandleOperationTask, this)
+#if OPENTHREAD_CONFIG_ENABLE_CSL
+    , mCslReceiving(false)
+#endif
+#if OPENTHREAD_CONFIG_MAC_RADIO_ARBITRATION
+    , mWaitingForRadioGrant(false)
+    , mRadioGrantTimedOut(false)
+#endif
+#if OPENTHREAD_CONFIG_MAC_TSCH
+    , mTschActive(false)
+    , mTschReceiving(false)
+    , mTschTransmitPending(false)
+    , mTschTransmitShared(false)
+#endif
+    , mOperationTask(aInstance, &Mac::HandleOperationTask, this, Tasklet::kPriorityHigh)
     , mMacTimer(aInstance, &Mac::HandleMacTimer, this)
     , mBackoffTimer(aInstance, &Mac::HandleBackoffTimer, this)
     , mReceiveTimer(aInstance, &Mac::HandleReceiveTimer, this)
+#if OPENTHREAD_CONFIG_ENABLE_CSL
+    , mCslTimer(aInstance, &Mac::HandleCslTimer, this)
+    , mCslSampleTime(0)
+    , mCslPeriod(0)
+#endif
+#if OPENTHREAD_CONFIG_MAC_TSCH
+    , mTschTimer(aInstance, &Mac::HandleTschTimer, this)
+    , mTschSchedule()
+    , mTschRxChannel(OPENTHREAD_CONFIG_DEFAULT_CHANNEL)
+    , mTschTxChannel(OPENTHREAD_CONFIG_DEFAULT_CHANNEL)
+#endif
     , mShortAddress(kShortAddrInvalid)
     , mPanId(kPanIdBroadcast)
     , mPanChannel(OPENTHREAD_CONFIG_DEFAULT_CHANNEL)
@@ -114,13 +140,43 @@ Mac::Mac(Instance &aInstance)
     , mTxFrame(static_cast<Frame *>(otPlatRadioGetTransmitBuffer(&aInstance)))
     , mOobFrame(NULL)
     , mKeyIdMode2FrameCounter(0)
+#if OPENTHREAD_CONFIG_ENABLE_MAC_OPERATION_STATS
+    , mOperationRequestMask(0)
+    , mOperationStartTime(0)
+    , mOperationQueueTime(0)
+#endif
+#if OPENTHREAD_CONFIG_ENABLE_RADIO_TIME_STATS
+    , mRadioTimeLastUpdate(otPlatTimeGet())
+    , mRadioTimeState(OT_RADIO_TIME_STATE_SLEEP)
+    , mRadioTimeDataPoll(false)
+#endif
     , mCcaSampleCount(0)
     , mEnabled(true)
+#if OPENTHREAD_CONFIG_MAC_RX_QUEUE_SIZE
+    , mRxQueueHead(0)
+    , mRxQueueTail(0)
+    , mRxQueueTask(aInstance, &Mac::HandleRxQueueTask, this)
+#endif
+#if OPENTHREAD_CONFIG_ENABLE_ADAPTIVE_CSMA
+    , mCsmaMinBe(kMinBE)
+    , mCsmaMaxBe(kMaxBE)
+    , mCsmaExtraBackoffs(0)
+#endif
 {
     mExtAddress.GenerateRandom();
     mCcaSuccessRateTracker.Reset();
     memset(&mCounters, 0, sizeof(otMacCounters));
+#if OPENTHREAD_CONFIG_ENABLE_MAC_OPERATION_STATS
+    memset(mOperationStats, 0, sizeof(mOperationStats));
+    memset(mOperationRequestTime, 0, sizeof(mOperationRequestTime));
+#endif
+#if OPENTHREAD_CONFIG_ENABLE_RADIO_TIME_STATS
+    memset(&mRadioTimeStats, 0, sizeof(mRadioTimeStats));
+#endif
     memset(&mNetworkName, 0, sizeof(otNetworkName));
+#if OPENTHREAD_CONFIG_MAC_TSCH
+    mTschSchedule.SetHoppingSequence(mSupportedChannelMask);
+#endif
 
     otPlatRadioEnable(&GetInstance());
 
@@ -197,6 +253,38 @@ bool Mac::IsInTransmitState(void)
            (mOperation == kOperationTransmitOutOfBandFrame);
 }
 
+bool Mac::IsRadioInUse(void)
+{
+    bool inUse = (mOperation != kOperationIdle) || mPendingActiveScan || mPendingEnergyScan || mPendingTransmitBeacon ||
+                 mPendingTransmitData || mPendingTransmitOobFrame || mPendingWaitingForData;
+    bool rxOnWhenIdle;
+
+    VerifyOrExit(!inUse);
+
+    // This mirrors the decision made by `UpdateIdleMode()`.
+
+    rxOnWhenIdle = mRxOnWhenIdle;
+
+#if OPENTHREAD_CONFIG_MAC_TSCH
+    if (mTschActive)
+    {
+        rxOnWhenIdle = mTschReceiving;
+    }
+#endif
+
+    inUse = rxOnWhenIdle || mReceiveTimer.IsRunning() || otPlatRadioGetPromiscuous(&GetInstance());
+
+#if OPENTHREAD_CONFIG_ENABLE_CSL
+    inUse = inUse || mCslReceiving;
+#endif
+#if OPENTHREAD_CONFIG_STAY_AWAKE_BETWEEN_FRAGMENTS
+    inUse = inUse || mDelaySleep;
+#endif
+
+exit:
+    return inUse;
+}
+
 otError Mac::ConvertBeaconToActiveScanResult(Frame *aBeaconFrame, otActiveScanResult &aResult)
 {
     otError        error = OT_ERROR_NONE;
@@ -271,8 +359,34 @@ void Mac::PerformEnergyScan(void)
 {
     otError error = OT_ERROR_NONE;
 
+    if ((mScanChannel == ChannelMask::kChannelIteratorFirst) &&
+        (otPlatRadioGetCaps(&GetInstance()) & OT_RADIO_CAPS_MULTI_ENERGY_SCAN))
+    {
+        VerifyOrExit(mEnabled, error = OT_ERROR_ABORT);
+
+#if OPENTHREAD_CONFIG_MAC_RADIO_ARBITRATION
+        IgnoreReturnValue(otPlatRadioRequestSlot(&GetInstance(), OT_RADIO_SLOT_SCAN,
+                                                 mScanChannelMask.GetNumberOfChannels() * mScanDuration * 1000UL));
+#endif
+
+        // Measure all channels with a single radio request, so data traffic is held off for one scan duration
+        // rather than one per channel. The sequential sweep below is used if the radio declines the request.
+        if (otPlatRadioEnergyScanMultiChannel(&GetInstance(), mScanChannelMask.GetMask(), mScanDuration) ==
+            OT_ERROR_NONE)
+        {
+#if OPENTHREAD_CONFIG_ENABLE_RADIO_TIME_STATS
+            UpdateRadioTime(OT_RADIO_TIME_STATE_RECEIVE);
+#endif
+            ExitNow();
+        }
+    }
+
     SuccessOrExit(error = UpdateScanChannel());
 
+#if OPENTHREAD_CONFIG_MAC_RADIO_ARBITRATION
+    IgnoreReturnValue(otPlatRadioRequestSlot(&GetInstance(), OT_RADIO_SLOT_SCAN, mScanDuration * 1000UL));
+#endif
+
     if (mScanDuration == 0)
     {
         while (true)
@@ -296,6 +410,9 @@ void Mac::PerformEnergyScan(void)
     else
     {
         SuccessOrExit(error = otPlatRadioEnergyScan(&GetInstance(), mScanChannel, mScanDuration));
+#if OPENTHREAD_CONFIG_ENABLE_RADIO_TIME_STATS
+        UpdateRadioTime(OT_RADIO_TIME_STATE_RECEIVE);
+#endif
     }
 
 exit:
@@ -349,6 +466,46 @@ void Mac::EnergyScanDone(int8_t aRssi)
     PerformEnergyScan();
 }
 
+extern "C" void otPlatRadioEnergyScanMultiChannelDone(otInstance *  aInstance,
+                                                      uint32_t      aScanChannels,
+                                                      const int8_t *aMaxRssi)
+{
+    Instance *instance = static_cast<Instance *>(aInstance);
+
+    VerifyOrExit(instance->IsInitialized());
+
+#if OPENTHREAD_ENABLE_RAW_LINK_API
+    VerifyOrExit(!instance->GetLinkRaw().IsEnabled());
+#endif
+
+    instance->GetThreadNetif().GetMac().EnergyScanMultiChannelDone(aScanChannels, aMaxRssi);
+
+exit:
+    return;
+}
+
+void Mac::EnergyScanMultiChannelDone(uint32_t aScanChannels, const int8_t *aMaxRssi)
+{
+    ChannelMask scanned(aScanChannels);
+    uint8_t     index = 0;
+
+    VerifyOrExit(mOperation == kOperationEnergyScan);
+
+    mScanChannel = ChannelMask::kChannelIteratorFirst;
+
+    while (scanned.GetNextChannel(mScanChannel) == OT_ERROR_NONE)
+    {
+        ReportEnergyScanResult(aMaxRssi[index++]);
+    }
+
+    // Every requested channel has been measured, so the next step finishes the scan operation.
+    mScanChannelMask.Clear();
+    PerformEnergyScan();
+
+exit:
+    return;
+}
+
 void Mac::SampleRssi(void)
 {
     int8_t rssi;
@@ -392,6 +549,204 @@ exit:
     return;
 }
 
+#if OPENTHREAD_CONFIG_ENABLE_CSL
+otError Mac::SetCslPeriod(uint16_t aPeriod)
+{
+    otError error = OT_ERROR_NONE;
+
+    VerifyOrExit(aPeriod == 0 || aPeriod >= kMinCslPeriod, error = OT_ERROR_INVALID_ARGS);
+
+    mCslPeriod = aPeriod;
+
+    // The receive windows are restarted on the next acknowledged data
+    // poll, which also re-synchronizes the parent.
+    StopCslSampling();
+
+exit:
+    return error;
+}
+
+void Mac::StopCslSampling(void)
+{
+    mCslTimer.Stop();
+
+    if (mCslReceiving)
+    {
+        mCslReceiving = false;
+        UpdateIdleMode();
+    }
+}
+
+void Mac::HandleCslTimer(Timer &aTimer)
+{
+    aTimer.GetOwner<Mac>().HandleCslTimer();
+}
+
+void Mac::HandleCslTimer(void)
+{
+    if (mCslReceiving)
+    {
+        // End of the receive window, schedule the next one.
+        mCslReceiving = false;
+        mCslTimer.StartAt(mCslSampleTime, mCslPeriod);
+        mCslSampleTime += mCslPeriod;
+    }
+    else
+    {
+        // The windows stop when the device becomes rx-on-when-idle,
+        // and resume on the next acknowledged data poll.
+        VerifyOrExit(!mRxOnWhenIdle && mCslPeriod != 0);
+        mCslReceiving = true;
+        mCslTimer.StartAt(mCslSampleTime, kCslReceiveWindow);
+#if OPENTHREAD_CONFIG_MAC_RADIO_ARBITRATION
+        IgnoreReturnValue(otPlatRadioRequestSlot(&GetInstance(), OT_RADIO_SLOT_RECEIVE, kCslReceiveWindow * 1000UL));
+#endif
+    }
+
+    UpdateIdleMode();
+
+exit:
+    return;
+}
+#endif // OPENTHREAD_CONFIG_ENABLE_CSL
+
+#if OPENTHREAD_CONFIG_MAC_TSCH
+void Mac::SetTschSlotframeLength(uint16_t aLength)
+{
+    mTschSchedule.SetSlotframeLength(aLength);
+    HandleTschTimer();
+}
+
+otError Mac::AddTschCell(const TschSchedule::Cell &aCell)
+{
+    otError error;
+
+    SuccessOrExit(error = mTschSchedule.AddCell(aCell));
+    HandleTschTimer();
+
+exit:
+    return error;
+}
+
+otError Mac::RemoveTschCell(uint16_t aSlotOffset)
+{
+    otError error;
+
+    SuccessOrExit(error = mTschSchedule.RemoveCell(aSlotOffset));
+    HandleTschTimer();
+
+exit:
+    return error;
+}
+
+bool Mac::GetTschTime(uint64_t &aAsn, uint32_t &aSlotRemaining)
+{
+    const uint64_t slotLength = static_cast<uint64_t>(kTschTimeslotLength) * 1000;
+    bool           rval       = false;
+    uint64_t       networkTime;
+
+    VerifyOrExit(mTschSchedule.IsEnabled());
+    VerifyOrExit(GetNetif().GetTimeSync().GetTime(networkTime) == OT_NETWORK_TIME_SYNCHRONIZED);
+
+    aAsn           = networkTime / slotLength;
+    aSlotRemaining = static_cast<uint32_t>(slotLength - (networkTime % slotLength));
+    rval           = true;
+
+exit:
+    return rval;
+}
+
+void Mac::HandleTschTimer(Timer &aTimer)
+{
+    aTimer.GetOwner<Mac>().HandleTschTimer();
+}
+
+void Mac::HandleTschTimer(void)
+{
+    const TschSchedule::Cell *cell;
+    uint64_t                  asn;
+    uint64_t                  cellAsn;
+    uint32_t                  slotRemaining;
+    uint32_t                  delay;
+
+    mTschTimer.Stop();
+    mTschReceiving = false;
+    mTschActive    = GetTschTime(asn, slotRemaining);
+
+    if (!mTschActive)
+    {
+        // Check again every slotframe until the network time is synchronized.
+        if (mTschSchedule.IsEnabled())
+        {
+            mTschTimer.Start(static_cast<uint32_t>(kTschTimeslotLength) * mTschSchedule.GetSlotframeLength());
+        }
+
+        ExitNow();
+    }
+
+    cell = mTschSchedule.FindNextCell(asn, OT_LINK_TSCH_CELL_OPTION_RX, cellAsn);
+
+    if (cell == NULL)
+    {
+        // Without receive cells, re-check the network time status every slotframe.
+        delay = slotRemaining + (mTschSchedule.GetSlotframeLength() - 1U) * kTschTimeslotLength * 1000U;
+    }
+    else if (cellAsn == asn)
+    {
+        // Listen until the end of the current timeslot.
+        mTschReceiving = true;
+        mTschRxChannel = mTschSchedule.GetChannel(asn, cell->mChannelOffset);
+        delay          = slotRemaining;
+#if OPENTHREAD_CONFIG_MAC_RADIO_ARBITRATION
+        IgnoreReturnValue(otPlatRadioRequestSlot(&GetInstance(), OT_RADIO_SLOT_RECEIVE, delay));
+#endif
+    }
+    else
+    {
+        delay = slotRemaining + static_cast<uint32_t>(cellAsn - asn - 1) * kTschTimeslotLength * 1000;
+    }
+
+    // Round up so that the timer fires inside the next timeslot of interest.
+    mTschTimer.Start((delay + 999) / 1000);
+
+exit:
+    UpdateIdleMode();
+}
+
+bool Mac::ScheduleTschTransmit(void)
+{
+    const TschSchedule::Cell *cell;
+    uint64_t                  asn;
+    uint64_t                  cellAsn;
+    uint32_t                  slotRemaining;
+    uint32_t                  delay;
+    bool                      rval = false;
+
+    VerifyOrExit(GetTschTime(asn, slotRemaining));
+
+    // Transmissions start at a timeslot boundary, so the earliest cell is in the next timeslot.
+    cell = mTschSchedule.FindNextCell(asn + 1, OT_LINK_TSCH_CELL_OPTION_TX, cellAsn);
+    VerifyOrExit(cell != NULL);
+
+    mTschTransmitPending = true;
+    mTschTransmitShared  = ((cell->mOptions & OT_LINK_TSCH_CELL_OPTION_SHARED) != 0);
+    mTschTxChannel       = mTschSchedule.GetChannel(cellAsn, cell->mChannelOffset);
+
+    delay = slotRemaining + static_cast<uint32_t>(cellAsn - asn - 1) * kTschTimeslotLength * 1000;
+
+#if OPENTHREAD_CONFIG_ENABLE_PLATFORM_USEC_TIMER
+    mBackoffTimer.Start(delay);
+#else
+    mBackoffTimer.Start((delay + 999) / 1000);
+#endif
+
+    rval = true;
+
+exit:
+    return rval;
+}
+#endif // OPENTHREAD_CONFIG_MAC_TSCH
+
 void Mac::SetExtAddress(const ExtAddress &aExtAddress)
 {
     otExtAddress address;
@@ -493,6 +848,10 @@ void Mac::SetSupportedChannelMask(const ChannelMask &aMask)
     VerifyOrExit(newMask != mSupportedChannelMask, GetNotifier().SignalIfFirst(OT_CHANGED_SUPPORTED_CHANNEL_MASK));
 
     mSupportedChannelMask = newMask;
+#if OPENTHREAD_CONFIG_MAC_TSCH
+    mTschSchedule.SetHoppingSequence(mSupportedChannelMask);
+    HandleTschTimer();
+#endif
     GetNotifier().Signal(OT_CHANGED_SUPPORTED_CHANNEL_MASK);
 
 exit:
@@ -574,9 +933,30 @@ exit:
 
 void Mac::UpdateIdleMode(void)
 {
+    bool rxOnWhenIdle = mRxOnWhenIdle;
+
     VerifyOrExit(mOperation == kOperationIdle);
 
-    if (!mRxOnWhenIdle && !mReceiveTimer.IsRunning() && !otPlatRadioGetPromiscuous(&GetInstance()))
+#if OPENTHREAD_CONFIG_MAC_TSCH
+    if (mTschActive)
+    {
+        if (mTschReceiving)
+        {
+            otLogDebgMac("Idle mode: Radio receiving in TSCH cell on channel %d", mTschRxChannel);
+            RadioReceive(mTschRxChannel);
+            ExitNow();
+        }
+
+        // Outside of receive cells, the radio only listens while waiting for data.
+        rxOnWhenIdle = false;
+    }
+#endif
+
+#if OPENTHREAD_CONFIG_ENABLE_CSL
+    if (!rxOnWhenIdle && !mReceiveTimer.IsRunning() && !mCslReceiving && !otPlatRadioGetPromiscuous(&GetInstance()))
+#else
+    if (!rxOnWhenIdle && !mReceiveTimer.IsRunning() && !otPlatRadioGetPromiscuous(&GetInstance()))
+#endif
     {
         if (RadioSleep() != OT_ERROR_INVALID_STATE)
         {
@@ -601,6 +981,9 @@ void Mac::StartOperation(Operation aOperation)
     if (aOperation != kOperationIdle)
     {
         otLogDebgMac("Request to start operation \"%s\"", OperationToString(aOperation));
+#if OPENTHREAD_CONFIG_ENABLE_MAC_OPERATION_STATS
+        RecordOperationRequest(aOperation);
+#endif
     }
 
     switch (aOperation)
@@ -664,10 +1047,83 @@ void Mac::HandleOperationTask(void)
     }
 }
 
+#if OPENTHREAD_CONFIG_MAC_RX_QUEUE_SIZE
+
+uint16_t Mac::GetRxQueueLength(void) const
+{
+    return static_cast<uint16_t>((mRxQueueTail + 2 * kRxQueueSize - mRxQueueHead) % (2 * kRxQueueSize));
+}
+
+void Mac::QueueReceivedFrame(const Frame &aFrame)
+{
+    RxQueueEntry &entry = mRxQueue[mRxQueueTail % kRxQueueSize];
+
+    // The radio reuses its receive buffer, so the PSDU and the header IE information are copied.
+    entry.mFrame       = aFrame;
+    entry.mFrame.mPsdu = entry.mPsdu;
+    memcpy(entry.mPsdu, aFrame.GetPsdu(), aFrame.GetPsduLength());
+
+    if (aFrame.mIeInfo != NULL)
+    {
+        entry.mIeInfo        = *aFrame.mIeInfo;
+        entry.mFrame.mIeInfo = &entry.mIeInfo;
+    }
+
+    // The entry is published only once it is completely written.
+    mRxQueueTail = (mRxQueueTail + 1) % (2 * kRxQueueSize);
+    mRxQueueTask.Post();
+}
+
+void Mac::HandleRxQueueTask(Tasklet &aTasklet)
+{
+    aTasklet.GetOwner<Mac>().HandleRxQueueTask();
+}
+
+void Mac::HandleRxQueueTask(void)
+{
+    ProcessRxQueue(kRxQueueBatchSize);
+
+    if (GetRxQueueLength() > 0)
+    {
+        mRxQueueTask.Post();
+    }
+}
+
+// Hands up to `aMaxFrames` queued frames (all of them if zero) to the `MeshForwarder`.
+void Mac::ProcessRxQueue(uint16_t aMaxFrames)
+{
+    MeshForwarder &meshForwarder = GetNetif().GetMeshForwarder();
+    uint16_t       length        = GetRxQueueLength();
+
+    if (aMaxFrames != 0 && length > aMaxFrames)
+    {
+        length = aMaxFrames;
+    }
+
+    for (; length > 0; length--)
+    {
+        // Frames queued before the MAC was disabled are discarded.
+        if (mEnabled)
+        {
+            meshForwarder.HandleReceivedFrame(mRxQueue[mRxQueueHead % kRxQueueSize].mFrame);
+        }
+
+        // The entry is released only after it has been processed.
+        mRxQueueHead = (mRxQueueHead + 1) % (2 * kRxQueueSize);
+    }
+}
+
+#endif // OPENTHREAD_CONFIG_MAC_RX_QUEUE_SIZE
+
 void Mac::PerformNextOperation(void)
 {
     VerifyOrExit(mOperation == kOperationIdle);
 
+#if OPENTHREAD_CONFIG_ENABLE_RADIO_TIME_STATS
+    // Close the idle interval so the radio time of the next operation is attributed to it.
+    UpdateRadioTime(mRadioTimeState);
+#endif
+
     if (!mEnabled)
     {
         mPendingWaitingForData   = false;
@@ -677,6 +1133,9 @@ void Mac::PerformNextOperation(void)
         mPendingTransmitBeacon   = false;
         mPendingTransmitData     = false;
         mOobFrame                = NULL;
+#if OPENTHREAD_CONFIG_ENABLE_MAC_OPERATION_STATS
+        mOperationRequestMask = 0;
+#endif
         ExitNow();
     }
 
@@ -687,6 +1146,9 @@ void Mac::PerformNextOperation(void)
     {
         mPendingWaitingForData = false;
         mOperation             = kOperationWaitingForData;
+#if OPENTHREAD_CONFIG_MAC_RADIO_ARBITRATION
+        IgnoreReturnValue(otPlatRadioRequestSlot(&GetInstance(), OT_RADIO_SLOT_RECEIVE, kDataPollTimeout * 1000UL));
+#endif
         RadioReceive(mRadioChannel);
     }
     else if (mPendingTransmitOobFrame)
@@ -727,6 +1189,9 @@ void Mac::PerformNextOperation(void)
     if (mOperation != kOperationIdle)
     {
         otLogDebgMac("Starting operation \"%s\"", OperationToString(mOperation));
+#if OPENTHREAD_CONFIG_ENABLE_MAC_OPERATION_STATS
+        RecordOperationStart();
+#endif
     }
 
 exit:
@@ -736,9 +1201,155 @@ exit:
 void Mac::FinishOperation(void)
 {
     otLogDebgMac("Finishing operation \"%s\"", OperationToString(mOperation));
+#if OPENTHREAD_CONFIG_ENABLE_MAC_OPERATION_STATS
+    RecordOperationFinish();
+#endif
+#if OPENTHREAD_CONFIG_ENABLE_RADIO_TIME_STATS
+    UpdateRadioTime(mRadioTimeState);
+    mRadioTimeDataPoll = false;
+#endif
     mOperation = kOperationIdle;
 }
 
+#if OPENTHREAD_CONFIG_ENABLE_MAC_OPERATION_STATS
+void Mac::RecordOperationRequest(Operation aOperation)
+{
+    uint8_t mask = static_cast<uint8_t>(1U << (aOperation - 1));
+
+    // Keep the earliest request time if the operation is already pending.
+    VerifyOrExit((mOperationRequestMask & mask) == 0);
+
+    mOperationRequestMask |= mask;
+    mOperationRequestTime[aOperation - 1] = TimerMilli::GetNow();
+
+exit:
+    return;
+}
+
+void Mac::RecordOperationStart(void)
+{
+    uint8_t mask = static_cast<uint8_t>(1U << (mOperation - 1));
+
+    mOperationStartTime = TimerMilli::GetNow();
+    mOperationQueueTime = 0;
+
+    if (mOperationRequestMask & mask)
+    {
+        mOperationRequestMask &= ~mask;
+        mOperationQueueTime = mOperationStartTime - mOperationRequestTime[mOperation - 1];
+    }
+}
+
+void Mac::RecordOperationFinish(void)
+{
+    otMacOperationStats *stats;
+    uint32_t             executionTime;
+
+    VerifyOrExit(mOperation != kOperationIdle);
+
+    stats         = &mOperationStats[mOperation - 1];
+    executionTime = TimerMilli::GetNow() - mOperationStartTime;
+
+    stats->mCount++;
+    stats->mTotalQueueTime += mOperationQueueTime;
+    stats->mTotalExecutionTime += executionTime;
+
+    if (mOperationQueueTime > stats->mMaxQueueTime)
+    {
+        stats->mMaxQueueTime = mOperationQueueTime;
+    }
+
+    if (executionTime > stats->mMaxExecutionTime)
+    {
+        stats->mMaxExecutionTime = executionTime;
+    }
+
+    AddToHistogram(stats->mQueueTimeHistogram, mOperationQueueTime);
+    AddToHistogram(stats->mExecutionTimeHistogram, executionTime);
+
+exit:
+    return;
+}
+
+void Mac::AddToHistogram(uint32_t *aHistogram, uint32_t aTime)
+{
+    uint8_t bin = 0;
+
+    // Bin 0 is below 1 ms, bin `i` is `[2^(i-1), 2^i)` ms, the last bin
+    // collects everything longer.
+    while ((aTime > 0) && (bin < OT_MAC_OPERATION_HISTOGRAM_BINS - 1))
+    {
+        aTime >>= 1;
+        bin++;
+    }
+
+    aHistogram[bin]++;
+}
+
+const otMacOperationStats *Mac::GetOperationStats(otMacOperation aOperation) const
+{
+    return (aOperation < OT_MAC_NUM_OPERATIONS) ? &mOperationStats[aOperation] : NULL;
+}
+#endif // OPENTHREAD_CONFIG_ENABLE_MAC_OPERATION_STATS
+
+#if OPENTHREAD_CONFIG_ENABLE_RADIO_TIME_STATS
+void Mac::UpdateRadioTime(otRadioTimeState aState)
+{
+    uint64_t now     = otPlatTimeGet();
+    uint64_t elapsed = now - mRadioTimeLastUpdate;
+
+    mRadioTimeStats.mStateTime[mRadioTimeState] += elapsed;
+    mRadioTimeStats.mCauseTime[GetRadioTimeCause()][mRadioTimeState] += elapsed;
+
+    mRadioTimeLastUpdate = now;
+    mRadioTimeState      = aState;
+}
+
+otRadioTimeCause Mac::GetRadioTimeCause(void) const
+{
+    otRadioTimeCause cause = OT_RADIO_TIME_CAUSE_IDLE;
+
+    switch (mOperation)
+    {
+    case kOperationIdle:
+        break;
+
+    case kOperationActiveScan:
+        cause = OT_RADIO_TIME_CAUSE_ACTIVE_SCAN;
+        break;
+
+    case kOperationEnergyScan:
+        cause = OT_RADIO_TIME_CAUSE_ENERGY_SCAN;
+        break;
+
+    case kOperationTransmitBeacon:
+        cause = OT_RADIO_TIME_CAUSE_TRANSMIT_BEACON;
+        break;
+
+    case kOperationTransmitData:
+        cause = mRadioTimeDataPoll ? OT_RADIO_TIME_CAUSE_DATA_POLL : OT_RADIO_TIME_CAUSE_TRANSMIT_DATA;
+        break;
+
+    case kOperationWaitingForData:
+        cause = OT_RADIO_TIME_CAUSE_WAITING_FOR_DATA;
+        break;
+
+    case kOperationTransmitOutOfBandFrame:
+        cause = OT_RADIO_TIME_CAUSE_TRANSMIT_OOB;
+        break;
+    }
+
+    return cause;
+}
+
+const otRadioTimeStats &Mac::GetRadioTimeStats(void)
+{
+    UpdateRadioTime(mRadioTimeState);
+
+    return mRadioTimeStats;
+}
+#endif // OPENTHREAD_CONFIG_ENABLE_RADIO_TIME_STATS
+
 void Mac::GenerateNonce(const ExtAddress &aAddress, uint32_t aFrameCounter, uint8_t aSecurityLevel, uint8_t *aNonce)
 {
     // source address
@@ -849,6 +1460,11 @@ exit:
 }
 
 void Mac::ProcessTransmitAesCcm(Frame &aFrame, const ExtAddress *aExtAddress)
+{
+    ProcessTransmitAesCcm(aFrame, aExtAddress, NULL);
+}
+
+void Mac::ProcessTransmitAesCcm(Frame &aFrame, const ExtAddress *aExtAddress, const Crypto::AesEcb *aKeySchedule)
 {
     uint32_t       frameCounter = 0;
     uint8_t        securityLevel;
@@ -862,15 +1478,37 @@ void Mac::ProcessTransmitAesCcm(Frame &aFrame, const ExtAddress *aExtAddress)
 
     GenerateNonce(*aExtAddress, frameCounter, securityLevel, nonce);
 
-    aesCcm.SetKey(aFrame.GetAesKey(), 16);
     tagLength = aFrame.GetFooterLength() - Frame::kFcsSize;
 
+#if OPENTHREAD_CONFIG_ENABLE_PLATFORM_AES_CCM
+    if (otPlatCryptoAesCcm(aFrame.GetAesKey(), nonce, sizeof(nonce), aFrame.GetHeader(), aFrame.GetHeaderLength(),
+                           aFrame.GetPayload(), aFrame.GetPayloadLength(), aFrame.GetFooter(), tagLength,
+                           true) == OT_ERROR_NONE)
+    {
+        ExitNow();
+    }
+#endif
+
+    if (aKeySchedule != NULL)
+    {
+        aesCcm.SetKey(*aKeySchedule);
+    }
+    else
+    {
+        aesCcm.SetKey(aFrame.GetAesKey(), 16);
+    }
+
     error = aesCcm.Init(aFrame.GetHeaderLength(), aFrame.GetPayloadLength(), tagLength, nonce, sizeof(nonce));
     assert(error == OT_ERROR_NONE);
 
     aesCcm.Header(aFrame.GetHeader(), aFrame.GetHeaderLength());
     aesCcm.Payload(aFrame.GetPayload(), aFrame.GetPayload(), aFrame.GetPayloadLength(), true);
     aesCcm.Finalize(aFrame.GetFooter(), &tagLength);
+
+#if OPENTHREAD_CONFIG_ENABLE_PLATFORM_AES_CCM
+exit:
+#endif
+    return;
 }
 
 void Mac::ProcessTransmitSecurity(Frame &aFrame, bool aProcessAesCcm)
@@ -938,6 +1576,16 @@ void Mac::ProcessTransmitSecurity(Frame &aFrame, bool aProcessAesCcm)
 
     if (aProcessAesCcm)
     {
+#if OPENTHREAD_CONFIG_ENABLE_KEY_SCHEDULE_CACHE
+        if (keyIdMode == Frame::kKeyIdMode1)
+        {
+            const Crypto::AesEcb &keySchedule = keyManager.GetMacKeySchedule(keyManager.GetCurrentKeySequence());
+
+            ProcessTransmitAesCcm(aFrame, extAddress, &keySchedule);
+            ExitNow();
+        }
+#endif
+
         ProcessTransmitAesCcm(aFrame, extAddress);
     }
 
@@ -945,12 +1593,87 @@ exit:
     return;
 }
 
+#if OPENTHREAD_CONFIG_ENABLE_ADAPTIVE_CSMA
+uint16_t Mac::GetChannelCongestion(void)
+{
+    uint16_t congestion = (mCcaSampleCount > 0) ? mCcaSuccessRateTracker.GetFailureRate() : 0;
+
+#if OPENTHREAD_ENABLE_CHANNEL_MONITOR
+    Utils::ChannelMonitor &channelMonitor = GetInstance().GetChannelMonitor();
+
+    if (channelMonitor.IsRunning() && (channelMonitor.GetSampleCount() > 0))
+    {
+        uint16_t occupancy = channelMonitor.GetChannelOccupancy(mPanChannel);
+
+        if (occupancy > congestion)
+        {
+            congestion = occupancy;
+        }
+    }
+#endif
+
+    return congestion;
+}
+
+void Mac::UpdateCsmaParameters(void)
+{
+    uint16_t congestion = GetChannelCongestion();
+
+    if (congestion < kAdaptiveCsmaLowCongestion)
+    {
+        mCsmaMinBe         = kMinBE - 1;
+        mCsmaMaxBe         = kMaxBE;
+        mCsmaExtraBackoffs = 0;
+    }
+    else if (congestion < kAdaptiveCsmaHighCongestion)
+    {
+        mCsmaMinBe         = kMinBE;
+        mCsmaMaxBe         = kMaxBE;
+        mCsmaExtraBackoffs = 0;
+    }
+    else
+    {
+        mCsmaMinBe         = kMinBE + 1;
+        mCsmaMaxBe         = kMaxBE + 1;
+        mCsmaExtraBackoffs = 1;
+    }
+}
+#endif // OPENTHREAD_CONFIG_ENABLE_ADAPTIVE_CSMA
+
+uint8_t Mac::GetMaxCsmaBackoffs(const Frame &aFrame) const
+{
+    uint8_t maxCsmaBackoffs = aFrame.GetMaxCsmaBackoffs();
+
+#if OPENTHREAD_CONFIG_ENABLE_ADAPTIVE_CSMA
+    // Only extend frames that allow CSMA retries (e.g. not indirect ones).
+    if (maxCsmaBackoffs > 0)
+    {
+        maxCsmaBackoffs += mCsmaExtraBackoffs;
+
+        if (maxCsmaBackoffs > kAdaptiveCsmaMaxBackoffs)
+        {
+            maxCsmaBackoffs = kAdaptiveCsmaMaxBackoffs;
+        }
+    }
+#endif
+
+    return maxCsmaBackoffs;
+}
+
 void Mac::StartCsmaBackoff(void)
 {
-    uint32_t backoffExponent = kMinBE + mTransmitRetries + mCsmaBackoffs;
+    uint32_t backoffExponent;
+    uint32_t maxBackoffExponent;
     uint32_t backoff;
     bool     shouldReceive;
 
+#if OPENTHREAD_CONFIG_MAC_TSCH
+    mTschTransmitPending = false;
+
+    // Data frames wait for the next transmit cell instead of a random backoff.
+    VerifyOrExit(mOperation != kOperationTransmitData || !ScheduleTschTransmit());
+#endif
+
     if (RadioSupportsCsmaBackoff())
     {
         // If the radio supports CSMA back off logic, immediately schedule the send.
@@ -970,9 +1693,22 @@ void Mac::StartCsmaBackoff(void)
     }
 #endif
 
-    if (backoffExponent > kMaxBE)
+#if OPENTHREAD_CONFIG_ENABLE_ADAPTIVE_CSMA
+    if (mCsmaBackoffs == 0)
+    {
+        UpdateCsmaParameters();
+    }
+
+    backoffExponent    = mCsmaMinBe + mTransmitRetries + mCsmaBackoffs;
+    maxBackoffExponent = mCsmaMaxBe;
+#else
+    backoffExponent    = kMinBE + mTransmitRetries + mCsmaBackoffs;
+    maxBackoffExponent = kMaxBE;
+#endif
+
+    if (backoffExponent > maxBackoffExponent)
     {
-        backoffExponent = kMaxBE;
+        backoffExponent = maxBackoffExponent;
     }
 
     backoff = Random::GetUint32InRange(0, 1U << backoffExponent);
@@ -1027,23 +1763,79 @@ void Mac::HandleBackoffTimer(Timer &aTimer)
 
 void Mac::HandleBackoffTimer(void)
 {
-    // The backoff timer serves two purposes:
+    // The backoff timer serves the following purposes:
     //
     // (a) It is used to add CSMA backoff delay before a frame transmission.
     // (b) While performing Energy Scan, it is used to add delay between
     //     RSSI samples.
+    // (c) With radio arbitration, it bounds the wait for the radio after
+    //     a denied slot request.
 
     if (mOperation == kOperationEnergyScan)
     {
         SampleRssi();
         mBackoffTimer.StartAt(mBackoffTimer.GetFireTime(), kEnergyScanRssiSampleInterval);
     }
+#if OPENTHREAD_CONFIG_MAC_RADIO_ARBITRATION
+    else if (mWaitingForRadioGrant)
+    {
+        otLogInfoMac("Radio grant timed out");
+        mWaitingForRadioGrant = false;
+        mRadioGrantTimedOut   = true;
+        HandleTransmitDone(GetOperationFrame(), NULL, OT_ERROR_CHANNEL_ACCESS_FAILURE);
+    }
+#endif
     else
     {
         BeginTransmit();
     }
 }
 
+#if OPENTHREAD_CONFIG_MAC_RADIO_ARBITRATION
+extern "C" void otPlatRadioSlotGranted(otInstance *aInstance)
+{
+    Instance *instance = static_cast<Instance *>(aInstance);
+
+    VerifyOrExit(instance->IsInitialized());
+    instance->GetThreadNetif().GetMac().HandleRadioSlotGranted();
+
+exit:
+    return;
+}
+
+void Mac::HandleRadioSlotGranted(void)
+{
+    VerifyOrExit(mWaitingForRadioGrant);
+
+    mWaitingForRadioGrant = false;
+    mBackoffTimer.Stop();
+    BeginTransmit();
+
+exit:
+    return;
+}
+
+extern "C" OT_TOOL_WEAK otError otPlatRadioRequestSlot(otInstance *aInstance, otRadioSlotType aType, uint32_t aDuration)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+    OT_UNUSED_VARIABLE(aType);
+    OT_UNUSED_VARIABLE(aDuration);
+
+    return OT_ERROR_NONE;
+}
+#endif // OPENTHREAD_CONFIG_MAC_RADIO_ARBITRATION
+
+extern "C" OT_TOOL_WEAK otError otPlatRadioEnergyScanMultiChannel(otInstance *aInstance,
+                                                                  uint32_t    aScanChannels,
+                                                                  uint16_t    aScanDuration)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+    OT_UNUSED_VARIABLE(aScanChannels);
+    OT_UNUSED_VARIABLE(aScanDuration);
+
+    return OT_ERROR_NOT_IMPLEMENTED;
+}
+
 Frame *Mac::GetOperationFrame(void)
 {
     Frame *frame = NULL;
@@ -1076,6 +1868,23 @@ void Mac::BeginTransmit(void)
 
     VerifyOrExit(mEnabled, error = OT_ERROR_ABORT);
 
+#if OPENTHREAD_CONFIG_MAC_RADIO_ARBITRATION
+    if (otPlatRadioRequestSlot(&GetInstance(),
+                               (mOperation == kOperationActiveScan) ? OT_RADIO_SLOT_SCAN : OT_RADIO_SLOT_TRANSMIT,
+                               kTransmitSlotDuration) != OT_ERROR_NONE)
+    {
+        // The radio is used by another protocol, wait for the grant (bounded by the backoff timer).
+        otLogDebgMac("Waiting for radio grant");
+        mWaitingForRadioGrant = true;
+#if OPENTHREAD_CONFIG_ENABLE_PLATFORM_USEC_TIMER
+        mBackoffTimer.Start(kRadioGrantTimeout * 1000UL);
+#else
+        mBackoffTimer.Start(kRadioGrantTimeout);
+#endif
+        ExitNow();
+    }
+#endif
+
     if (mCsmaBackoffs == 0 && mTransmitRetries == 0 && mBroadcastTransmitCount == 0)
     {
         switch (mOperation)
@@ -1150,9 +1959,27 @@ void Mac::BeginTransmit(void)
         sendFrame.SetCsmaCaEnabled(true);
     }
 
+#if OPENTHREAD_CONFIG_MAC_TSCH
+    if (mTschTransmitPending)
+    {
+        // Only shared cells are contended, dedicated cells are transmitted without CSMA-CA.
+        mTschTransmitPending = false;
+        sendFrame.SetChannel(mTschTxChannel);
+
+        if (!mTschTransmitShared)
+        {
+            sendFrame.SetCsmaCaEnabled(false);
+        }
+    }
+#endif
+
     error = RadioReceive(sendFrame.GetChannel());
     assert(error == OT_ERROR_NONE);
 
+#if OPENTHREAD_CONFIG_ENABLE_RADIO_TIME_STATS
+    mRadioTimeDataPoll = sendFrame.IsDataRequestCommand();
+#endif
+
     error = RadioTransmit(&sendFrame);
     assert(error == OT_ERROR_NONE);
 
@@ -1227,6 +2054,11 @@ void Mac::HandleTransmitDone(otRadioFrame *aFrame, otRadioFrame *aAckFrame, otEr
     bool      ackRequested;
     Neighbor *neighbor;
 
+#if OPENTHREAD_CONFIG_ENABLE_RADIO_TIME_STATS
+    // The radio returns to receive once the transmission (including the ack wait) is done.
+    UpdateRadioTime(OT_RADIO_TIME_STATE_RECEIVE);
+#endif
+
     // Stop the ack timer.
 
     mMacTimer.Stop();
@@ -1242,6 +2074,15 @@ void Mac::HandleTransmitDone(otRadioFrame *aFrame, otRadioFrame *aAckFrame, otEr
     case OT_ERROR_CHANNEL_ACCESS_FAILURE:
         ccaSuccess = false;
 
+#if OPENTHREAD_CONFIG_MAC_RADIO_ARBITRATION
+        if (mRadioGrantTimedOut)
+        {
+            // The radio was used by another protocol, this says nothing about the channel.
+            mRadioGrantTimedOut = false;
+            break;
+        }
+#endif
+
         // fall through
 
     case OT_ERROR_NONE:
@@ -1270,7 +2111,7 @@ void Mac::HandleTransmitDone(otRadioFrame *aFrame, otRadioFrame *aAckFrame, otEr
     {
         mCounters.mTxErrCca++;
 
-        if (!RadioSupportsCsmaBackoff() && mCsmaBackoffs < sendFrame.GetMaxCsmaBackoffs())
+        if (!RadioSupportsCsmaBackoff() && mCsmaBackoffs < GetMaxCsmaBackoffs(sendFrame))
         {
             mCsmaBackoffs++;
             StartCsmaBackoff();
@@ -1414,6 +2255,18 @@ void Mac::HandleTransmitDone(otRadioFrame *aFrame, otRadioFrame *aAckFrame, otEr
                 StartOperation(kOperationWaitingForData);
             }
 
+#if OPENTHREAD_CONFIG_ENABLE_CSL
+            // An acknowledged data poll is the synchronization point
+            // shared with the parent for the CSL receive windows.
+
+            if (mCslPeriod != 0 && aError == OT_ERROR_NONE)
+            {
+                mCslSampleTime = TimerMilli::GetNow();
+                mCslTimer.StartAt(mCslSampleTime, mCslPeriod);
+                mCslSampleTime += mCslPeriod;
+            }
+#endif
+
             mCounters.mTxDataPoll++;
         }
         else
@@ -1466,6 +2319,9 @@ otError Mac::RadioTransmit(Frame *aSendFrame)
 #endif
 
     SuccessOrExit(error = otPlatRadioTransmit(&GetInstance(), static_cast<otRadioFrame *>(aSendFrame)));
+#if OPENTHREAD_CONFIG_ENABLE_RADIO_TIME_STATS
+    UpdateRadioTime(OT_RADIO_TIME_STATE_TRANSMIT);
+#endif
 
 exit:
 
@@ -1492,6 +2348,9 @@ otError Mac::RadioReceive(uint8_t aChannel)
 #endif
 
     SuccessOrExit(error = otPlatRadioReceive(&GetInstance(), aChannel));
+#if OPENTHREAD_CONFIG_ENABLE_RADIO_TIME_STATS
+    UpdateRadioTime(OT_RADIO_TIME_STATE_RECEIVE);
+#endif
 
 exit:
 
@@ -1526,6 +2385,12 @@ otError Mac::RadioSleep(void)
 #endif
 
     error = otPlatRadioSleep(&GetInstance());
+#if OPENTHREAD_CONFIG_ENABLE_RADIO_TIME_STATS
+    if (error == OT_ERROR_NONE)
+    {
+        UpdateRadioTime(OT_RADIO_TIME_STATE_SLEEP);
+    }
+#endif
     VerifyOrExit(error != OT_ERROR_NONE);
 
     otLogWarnMac("otPlatRadioSleep() failed with error %s", otThreadErrorToString(error));
@@ -1639,25 +2504,32 @@ otError Mac::ProcessReceiveSecurity(Frame &aFrame, const Address &aSrcAddr, Neig
         {
             // same key index
             keySequence = keyManager.GetCurrentKeySequence();
-            macKey      = keyManager.GetCurrentMacKey();
         }
         else if (keyid == ((keyManager.GetCurrentKeySequence() - 1) & 0x7f))
         {
             // previous key index
             keySequence = keyManager.GetCurrentKeySequence() - 1;
-            macKey      = keyManager.GetTemporaryMacKey(keySequence);
         }
         else if (keyid == ((keyManager.GetCurrentKeySequence() + 1) & 0x7f))
         {
             // next key index
             keySequence = keyManager.GetCurrentKeySequence() + 1;
-            macKey      = keyManager.GetTemporaryMacKey(keySequence);
         }
         else
         {
             ExitNow(error = OT_ERROR_SECURITY);
         }
 
+#if OPENTHREAD_CONFIG_ENABLE_KEY_SCHEDULE_CACHE
+        // The cached key schedule of `keySequence` is used for the software
+        // AES-CCM (see below), so the key itself is only looked up when
+        // it is readily available.
+        macKey = (keySequence == keyManager.GetCurrentKeySequence()) ? keyManager.GetCurrentMacKey() : NULL;
+#else
+        macKey = (keySequence == keyManager.GetCurrentKeySequence()) ? keyManager.GetCurrentMacKey()
+                                                                      : keyManager.GetTemporaryMacKey(keySequence);
+#endif
+
         // If the frame is from a neighbor not in valid state (e.g., it is from a child being
         // restored), skip the key sequence and frame counter checks but continue to verify
         // the tag/MIC. Such a frame is later filtered in `RxDoneTask` which only allows MAC
@@ -1700,20 +2572,36 @@ otError Mac::ProcessReceiveSecurity(Frame &aFrame, const Address &aSrcAddr, Neig
     GenerateNonce(*extAddress, frameCounter, securityLevel, nonce);
     tagLength = aFrame.GetFooterLength() - Frame::kFcsSize;
 
-    aesCcm.SetKey(macKey, 16);
+#if OPENTHREAD_CONFIG_ENABLE_PLATFORM_AES_CCM
+    if ((macKey == NULL) ||
+        (otPlatCryptoAesCcm(macKey, nonce, sizeof(nonce), aFrame.GetHeader(), aFrame.GetHeaderLength(),
+                            aFrame.GetPayload(), aFrame.GetPayloadLength(), tag, tagLength, false) != OT_ERROR_NONE))
+#endif
+    {
+#if OPENTHREAD_CONFIG_ENABLE_KEY_SCHEDULE_CACHE
+        if (keyIdMode == Frame::kKeyIdMode1)
+        {
+            aesCcm.SetKey(keyManager.GetMacKeySchedule(keySequence));
+        }
+        else
+#endif
+        {
+            aesCcm.SetKey(macKey, 16);
+        }
 
-    error = aesCcm.Init(aFrame.GetHeaderLength(), aFrame.GetPayloadLength(), tagLength, nonce, sizeof(nonce));
-    VerifyOrExit(error == OT_ERROR_NONE, error = OT_ERROR_SECURITY);
+        error = aesCcm.Init(aFrame.GetHeaderLength(), aFrame.GetPayloadLength(), tagLength, nonce, sizeof(nonce));
+        VerifyOrExit(error == OT_ERROR_NONE, error = OT_ERROR_SECURITY);
 
-    aesCcm.Header(aFrame.GetHeader(), aFrame.GetHeaderLength());
+        aesCcm.Header(aFrame.GetHeader(), aFrame.GetHeaderLength());
 #ifndef FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION
-    aesCcm.Payload(aFrame.GetPayload(), aFrame.GetPayload(), aFrame.GetPayloadLength(), false);
+        aesCcm.Payload(aFrame.GetPayload(), aFrame.GetPayload(), aFrame.GetPayloadLength(), false);
 #else
-    // for fuzz tests, execute AES but do not alter the payload
-    uint8_t fuzz[OT_RADIO_FRAME_MAX_SIZE];
-    aesCcm.Payload(fuzz, aFrame.GetPayload(), aFrame.GetPayloadLength(), false);
+        // for fuzz tests, execute AES but do not alter the payload
+        uint8_t fuzz[OT_RADIO_FRAME_MAX_SIZE];
+        aesCcm.Payload(fuzz, aFrame.GetPayload(), aFrame.GetPayloadLength(), false);
 #endif
-    aesCcm.Finalize(tag, &tagLength);
+        aesCcm.Finalize(tag, &tagLength);
+    }
 
 #ifndef FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION
     VerifyOrExit(memcmp(tag, aFrame.GetFooter(), tagLength) == 0, error = OT_ERROR_SECURITY);
@@ -1761,6 +2649,20 @@ exit:
     return;
 }
 
+#if OPENTHREAD_CONFIG_RADIO_RX_QUEUE
+extern "C" void otPlatRadioReceivePending(otInstance *aInstance)
+{
+    otRadioFrame *frame;
+
+    // Frames are processed in order of reception, each buffer going back to the driver as soon as it is done with.
+    while ((frame = otPlatRadioGetReceivedFrame(aInstance)) != NULL)
+    {
+        otPlatRadioReceiveDone(aInstance, frame, OT_ERROR_NONE);
+        otPlatRadioReleaseReceivedFrame(aInstance, frame);
+    }
+}
+#endif
+
 void Mac::HandleReceivedFrame(Frame *aFrame, otError aError)
 {
     ThreadNetif &netif = GetNetif();
@@ -1788,7 +2690,7 @@ void Mac::HandleReceivedFrame(Frame *aFrame, otError aError)
 
     // Ensure we have a valid frame before attempting to read any contents of
     // the buffer received from the radio.
-    SuccessOrExit(error = aFrame->ValidatePsdu());
+    SuccessOrExit(error = aFrame->ParsePsdu());
 
     aFrame->GetSrcAddr(srcaddr);
     aFrame->GetDstAddr(dstaddr);
@@ -2025,6 +2927,21 @@ void Mac::HandleReceivedFrame(Frame *aFrame, otError aError)
     if (receive)
     {
         otDumpDebgMac("RX", aFrame->GetHeader(), aFrame->GetLength());
+
+#if OPENTHREAD_CONFIG_MAC_RX_QUEUE_SIZE
+
+        // Data frames are processed in batches from `mRxQueueTask`. Other frames (or a data frame when the queue is
+        // full) are processed right away, after the queued frames to keep the order of reception.
+        if (aFrame->GetType() == Frame::kFcfFrameData && GetRxQueueLength() < kRxQueueSize)
+        {
+            QueueReceivedFrame(*aFrame);
+            ExitNow();
+        }
+
+        ProcessRxQueue(0);
+
+#endif
+
         netif.GetMeshForwarder().HandleReceivedFrame(*aFrame);
     }
 
@@ -2152,6 +3069,13 @@ otError Mac::SetEnabled(bool aEnable)
 void Mac::ResetCounters(void)
 {
     memset(&mCounters, 0, sizeof(mCounters));
+#if OPENTHREAD_CONFIG_ENABLE_MAC_OPERATION_STATS
+    memset(mOperationStats, 0, sizeof(mOperationStats));
+#endif
+#if OPENTHREAD_CONFIG_ENABLE_RADIO_TIME_STATS
+    memset(&mRadioTimeStats, 0, sizeof(mRadioTimeStats));
+    mRadioTimeLastUpdate = otPlatTimeGet();
+#endif
 }
 
 int8_t Mac::GetNoiseFloor(void)
@@ -45,6 +45,7 @@
 #include "mac/channel_mask.hpp"
 #include "mac/mac_filter.hpp"
 #include "mac/mac_frame.hpp"
+#include "mac/mac_tsch.hpp"
 #include "thread/key_manager.hpp"
 #include "thread/link_quality.hpp"
 #include "thread/topology.hpp"
@@ -93,7 +94,22 @@ enum
     kMaxFrameRetriesIndirect =
         OPENTHREAD_CONFIG_MAC_MAX_FRAME_RETRIES_INDIRECT, ///< macMaxFrameRetries for indirect transmissions
 
-    kTxNumBcast = OPENTHREAD_CONFIG_TX_NUM_BCAST ///< Number of times each broadcast frame is transmitted
+    kTxNumBcast = OPENTHREAD_CONFIG_TX_NUM_BCAST, ///< Number of times each broadcast frame is transmitted
+
+#if OPENTHREAD_CONFIG_ENABLE_CSL
+    kCslReceiveWindow = OPENTHREAD_CONFIG_CSL_RECEIVE_WINDOW, ///< Duration of a CSL receive window (milliseconds).
+    kMinCslPeriod     = 4 * kCslReceiveWindow,                ///< Minimum CSL period (milliseconds).
+#endif
+
+#if OPENTHREAD_CONFIG_MAC_TSCH
+    kTschTimeslotLength = OPENTHREAD_CONFIG_MAC_TSCH_TIMESLOT_LENGTH, ///< Duration of a TSCH timeslot (milliseconds).
+#endif
+
+#if OPENTHREAD_CONFIG_MAC_RADIO_ARBITRATION
+    kRadioGrantTimeout = OPENTHREAD_CONFIG_MAC_RADIO_GRANT_TIMEOUT, ///< Max wait for a radio grant (milliseconds).
+    kTransmitSlotDuration =
+        (OT_RADIO_FRAME_MAX_SIZE + 6) * 2 * OT_RADIO_SYMBOL_TIME + kAckTimeout * 1000, ///< Tx slot (microseconds).
+#endif
 };
 
 /**
@@ -182,6 +198,15 @@ public:
      */
     void EnergyScanDone(int8_t aEnergyScanMaxRssi);
 
+    /**
+     * This method indicates a multi-channel energy scan is complete.
+     *
+     * @param[in]  aScanChannels  The bit vector of scanned channels.
+     * @param[in]  aMaxRssi       The maximum RSSI of each channel in @p aScanChannels, in ascending channel order.
+     *
+     */
+    void EnergyScanMultiChannelDone(uint32_t aScanChannels, const int8_t *aMaxRssi);
+
     /**
      * This method indicates whether or not IEEE 802.15.4 Beacon transmissions are enabled.
      *
@@ -214,6 +239,78 @@ public:
      */
     void SetRxOnWhenIdle(bool aRxOnWhenIdle);
 
+#if OPENTHREAD_CONFIG_ENABLE_CSL
+    /**
+     * This method returns the CSL period.
+     *
+     * @returns The CSL period in milliseconds, or zero if CSL receive mode is disabled.
+     *
+     */
+    uint16_t GetCslPeriod(void) const { return mCslPeriod; }
+
+    /**
+     * This method sets the CSL period.
+     *
+     * When the CSL period is non-zero and rx-on-when-idle is disabled, the radio is turned on for
+     * `kCslReceiveWindow` every CSL period. The receive windows are synchronized to the last acknowledged data poll.
+     *
+     * @param[in]  aPeriod  The CSL period in milliseconds, or zero to disable CSL receive mode.
+     *
+     * @retval OT_ERROR_NONE          Successfully set the CSL period.
+     * @retval OT_ERROR_INVALID_ARGS  @p aPeriod is non-zero and smaller than `kMinCslPeriod`.
+     *
+     */
+    otError SetCslPeriod(uint16_t aPeriod);
+
+    /**
+     * This method stops the CSL receive windows until the next acknowledged data poll.
+     *
+     */
+    void StopCslSampling(void);
+#endif // OPENTHREAD_CONFIG_ENABLE_CSL
+
+#if OPENTHREAD_CONFIG_MAC_TSCH
+    /**
+     * This method returns the TSCH schedule.
+     *
+     * @returns A reference to the TSCH schedule.
+     *
+     */
+    const TschSchedule &GetTschSchedule(void) const { return mTschSchedule; }
+
+    /**
+     * This method sets the TSCH slotframe length.
+     *
+     * @param[in]  aLength  The number of timeslots in the slotframe, or zero to disable TSCH.
+     *
+     */
+    void SetTschSlotframeLength(uint16_t aLength);
+
+    /**
+     * This method adds a cell to the TSCH schedule.
+     *
+     * @param[in]  aCell  A reference to the cell to add.
+     *
+     * @retval OT_ERROR_NONE          Successfully added the cell.
+     * @retval OT_ERROR_INVALID_ARGS  The slot offset is outside the slotframe or the cell has no TX or RX option.
+     * @retval OT_ERROR_ALREADY       A cell with the same slot offset already exists.
+     * @retval OT_ERROR_NO_BUFS       The schedule is full.
+     *
+     */
+    otError AddTschCell(const TschSchedule::Cell &aCell);
+
+    /**
+     * This method removes a cell from the TSCH schedule.
+     *
+     * @param[in]  aSlotOffset  The slot offset of the cell to remove.
+     *
+     * @retval OT_ERROR_NONE       Successfully removed the cell.
+     * @retval OT_ERROR_NOT_FOUND  There is no cell with the given slot offset.
+     *
+     */
+    otError RemoveTschCell(uint16_t aSlotOffset);
+#endif // OPENTHREAD_CONFIG_MAC_TSCH
+
     /**
      * This method requests a new MAC frame transmission.
      *
@@ -456,6 +553,14 @@ public:
      */
     void HandleTransmitDone(otRadioFrame *aFrame, otRadioFrame *aAckFrame, otError aError);
 
+#if OPENTHREAD_CONFIG_MAC_RADIO_ARBITRATION
+    /**
+     * This method is called when the radio is granted after a denied `otPlatRadioRequestSlot()`.
+     *
+     */
+    void HandleRadioSlotGranted(void);
+#endif
+
     /**
      * This method returns if an active scan is in progress.
      *
@@ -478,6 +583,19 @@ public:
      */
     bool IsInTransmitState(void);
 
+    /**
+     * This method indicates whether the MAC layer needs the radio, i.e. a MAC operation is in progress or pending, or
+     * the radio is kept in receive while idle (rx-on-when-idle, a receive window, or promiscuous mode).
+     *
+     * When this method returns FALSE the radio is asleep and stays so until the next timer fires or a new operation is
+     * requested.
+     *
+     * @retval TRUE   The radio is in use.
+     * @retval FALSE  The radio is not in use.
+     *
+     */
+    bool IsRadioInUse(void);
+
     /**
      * This method registers a callback to provide received raw IEEE 802.15.4 frames.
      *
@@ -521,6 +639,28 @@ public:
      */
     otMacCounters &GetCounters(void) { return mCounters; }
 
+#if OPENTHREAD_CONFIG_ENABLE_MAC_OPERATION_STATS
+    /**
+     * This method returns the latency statistics of a MAC operation.
+     *
+     * @param[in]  aOperation  The MAC operation.
+     *
+     * @returns A pointer to the statistics of @p aOperation, or NULL if @p aOperation is not valid.
+     *
+     */
+    const otMacOperationStats *GetOperationStats(otMacOperation aOperation) const;
+#endif
+
+#if OPENTHREAD_CONFIG_ENABLE_RADIO_TIME_STATS
+    /**
+     * This method returns the radio time statistics, updated up to the current time.
+     *
+     * @returns A reference to the radio time statistics.
+     *
+     */
+    const otRadioTimeStats &GetRadioTimeStats(void);
+#endif
+
     /**
      * This method returns the noise floor value (currently use the radio receive sensitivity value).
      *
@@ -619,6 +759,18 @@ private:
         kOperationTransmitOutOfBandFrame,
     };
 
+#if OPENTHREAD_CONFIG_ENABLE_MAC_OPERATION_STATS
+    void        RecordOperationRequest(Operation aOperation);
+    void        RecordOperationStart(void);
+    void        RecordOperationFinish(void);
+    static void AddToHistogram(uint32_t *aHistogram, uint32_t aTime);
+#endif
+
+#if OPENTHREAD_CONFIG_ENABLE_RADIO_TIME_STATS
+    void             UpdateRadioTime(otRadioTimeState aState);
+    otRadioTimeCause GetRadioTimeCause(void) const;
+#endif
+
     /**
      * This method processes transmit security on the frame which is going to be sent.
      *
@@ -632,6 +784,8 @@ private:
      */
     void ProcessTransmitSecurity(Frame &aFrame, bool aProcessAesCcm);
 
+    static void ProcessTransmitAesCcm(Frame &aFrame, const ExtAddress *aExtAddress, const Crypto::AesEcb *aKeySchedule);
+
     static void GenerateNonce(const ExtAddress &aAddress,
                               uint32_t          aFrameCounter,
                               uint8_t           aSecurityLevel,
@@ -656,10 +810,32 @@ private:
     void        HandleBackoffTimer(void);
     static void HandleReceiveTimer(Timer &aTimer);
     void        HandleReceiveTimer(void);
+#if OPENTHREAD_CONFIG_ENABLE_CSL
+    static void HandleCslTimer(Timer &aTimer);
+    void        HandleCslTimer(void);
+#endif
+#if OPENTHREAD_CONFIG_MAC_TSCH
+    static void HandleTschTimer(Timer &aTimer);
+    void        HandleTschTimer(void);
+    bool        GetTschTime(uint64_t &aAsn, uint32_t &aSlotRemaining);
+    bool        ScheduleTschTransmit(void);
+#endif
     static void HandleOperationTask(Tasklet &aTasklet);
     void        HandleOperationTask(void);
+#if OPENTHREAD_CONFIG_MAC_RX_QUEUE_SIZE
+    uint16_t    GetRxQueueLength(void) const;
+    void        QueueReceivedFrame(const Frame &aFrame);
+    static void HandleRxQueueTask(Tasklet &aTasklet);
+    void        HandleRxQueueTask(void);
+    void        ProcessRxQueue(uint16_t aMaxFrames);
+#endif
 
     void StartCsmaBackoff(void);
+#if OPENTHREAD_CONFIG_ENABLE_ADAPTIVE_CSMA
+    uint16_t GetChannelCongestion(void);
+    void     UpdateCsmaParameters(void);
+#endif
+    uint8_t GetMaxCsmaBackoffs(const Frame &aFrame) const;
 
     void    Scan(Operation aScanOperation, uint32_t aScanChannels, uint16_t aScanDuration, void *aContext);
     otError UpdateScanChannel(void);
@@ -697,6 +873,19 @@ private:
 #if OPENTHREAD_CONFIG_STAY_AWAKE_BETWEEN_FRAGMENTS
     bool mDelaySleep : 1;
 #endif
+#if OPENTHREAD_CONFIG_ENABLE_CSL
+    bool mCslReceiving : 1;
+#endif
+#if OPENTHREAD_CONFIG_MAC_RADIO_ARBITRATION
+    bool mWaitingForRadioGrant : 1;
+    bool mRadioGrantTimedOut : 1;
+#endif
+#if OPENTHREAD_CONFIG_MAC_TSCH
+    bool mTschActive : 1;
+    bool mTschReceiving : 1;
+    bool mTschTransmitPending : 1;
+    bool mTschTransmitShared : 1;
+#endif
 
     Tasklet mOperationTask;
 
@@ -707,6 +896,17 @@ private:
     TimerMilli mBackoffTimer;
 #endif
     TimerMilli mReceiveTimer;
+#if OPENTHREAD_CONFIG_ENABLE_CSL
+    TimerMilli mCslTimer;
+    uint32_t   mCslSampleTime;
+    uint16_t   mCslPeriod;
+#endif
+#if OPENTHREAD_CONFIG_MAC_TSCH
+    TimerMilli   mTschTimer;
+    TschSchedule mTschSchedule;
+    uint8_t      mTschRxChannel;
+    uint8_t      mTschTxChannel;
+#endif
 
     ExtAddress   mExtAddress;
     ShortAddress mShortAddress;
@@ -749,9 +949,66 @@ private:
     otMacCounters mCounters;
     uint32_t      mKeyIdMode2FrameCounter;
 
+#if OPENTHREAD_CONFIG_ENABLE_MAC_OPERATION_STATS
+    // Stats and request times are indexed by `Operation - 1`, i.e. in
+    // `otMacOperation` order.
+    otMacOperationStats mOperationStats[OT_MAC_NUM_OPERATIONS];
+    uint32_t            mOperationRequestTime[OT_MAC_NUM_OPERATIONS];
+    uint8_t             mOperationRequestMask;
+    uint32_t            mOperationStartTime;
+    uint32_t            mOperationQueueTime;
+#endif
+
+#if OPENTHREAD_CONFIG_ENABLE_RADIO_TIME_STATS
+    otRadioTimeStats mRadioTimeStats;
+    uint64_t         mRadioTimeLastUpdate;
+    otRadioTimeState mRadioTimeState;
+    bool             mRadioTimeDataPoll;
+#endif
+
     SuccessRateTracker mCcaSuccessRateTracker;
     uint16_t           mCcaSampleCount;
     bool               mEnabled;
+
+#if OPENTHREAD_CONFIG_MAC_RX_QUEUE_SIZE
+    enum
+    {
+        kRxQueueSize      = OPENTHREAD_CONFIG_MAC_RX_QUEUE_SIZE,
+        kRxQueueBatchSize = OPENTHREAD_CONFIG_MAC_RX_QUEUE_BATCH_SIZE,
+    };
+
+    /**
+     * This structure holds a copy of a received frame waiting to be processed by the upper layers.
+     *
+     */
+    struct RxQueueEntry
+    {
+        Frame         mFrame;
+        uint8_t       mPsdu[OT_RADIO_FRAME_MAX_SIZE];
+        otRadioIeInfo mIeInfo;
+    };
+
+    // The queue is a single-producer/single-consumer ring: `mRxQueueTail` is only written when a frame is queued and
+    // `mRxQueueHead` only when a frame is handed to the upper layers. Both count modulo `2 * kRxQueueSize`, so a full
+    // queue is distinguished from an empty one without giving up an entry.
+    RxQueueEntry mRxQueue[kRxQueueSize];
+    uint16_t     mRxQueueHead;
+    uint16_t     mRxQueueTail;
+    Tasklet      mRxQueueTask;
+#endif
+
+#if OPENTHREAD_CONFIG_ENABLE_ADAPTIVE_CSMA
+    enum
+    {
+        kAdaptiveCsmaLowCongestion  = SuccessRateTracker::kMaxRateValue / 10,     ///< 10% channel congestion.
+        kAdaptiveCsmaHighCongestion = SuccessRateTracker::kMaxRateValue * 3 / 10, ///< 30% channel congestion.
+        kAdaptiveCsmaMaxBackoffs    = 5, ///< Upper bound of macMaxCsmaBackoffs (IEEE 802.15.4-2006).
+    };
+
+    uint8_t mCsmaMinBe;
+    uint8_t mCsmaMaxBe;
+    uint8_t mCsmaExtraBackoffs;
+#endif
 };
 
 /**
@@ -46,23 +46,46 @@ Filter::Filter(void)
     : mAddressMode(OT_MAC_FILTER_ADDRESS_MODE_DISABLED)
     , mRssIn(OT_MAC_FILTER_FIXED_RSS_DISABLED)
 {
-    for (int i = 0; i < GetMaxEntries(); i++)
+    for (uint16_t i = 0; i < GetMaxEntries(); i++)
     {
         memset(&mEntries[i], 0, sizeof(Entry));
 
         mEntries[i].mFiltered = false;
         mEntries[i].mRssIn    = OT_MAC_FILTER_FIXED_RSS_DISABLED;
+        mEntryNext[i]         = kInvalidIndex;
     }
+
+    for (uint16_t i = 0; i < kNumBuckets; i++)
+    {
+        mBuckets[i] = kInvalidIndex;
+    }
+}
+
+uint16_t Filter::GetBucket(const ExtAddress &aExtAddress)
+{
+    uint32_t hash = 0;
+
+    for (uint8_t i = 0; i < sizeof(aExtAddress.m8); i++)
+    {
+        hash = hash * 31 + aExtAddress.m8[i];
+    }
+
+    return static_cast<uint16_t>(hash % kNumBuckets);
+}
+
+bool Filter::IsInUse(const Entry &aEntry)
+{
+    return aEntry.mFiltered || aEntry.mRssIn != OT_MAC_FILTER_FIXED_RSS_DISABLED;
 }
 
 Filter::Entry *Filter::FindEntry(const ExtAddress &aExtAddress)
 {
     Entry *entry = NULL;
 
-    for (uint8_t i = 0; i < GetMaxEntries(); i++)
+    // Only in-use entries are linked into the buckets.
+    for (uint16_t i = mBuckets[GetBucket(aExtAddress)]; i != kInvalidIndex; i = mEntryNext[i])
     {
-        if ((mEntries[i].mFiltered || mEntries[i].mRssIn != OT_MAC_FILTER_FIXED_RSS_DISABLED) &&
-            (aExtAddress == static_cast<const ExtAddress &>(mEntries[i].mExtAddress)))
+        if (aExtAddress == static_cast<const ExtAddress &>(mEntries[i].mExtAddress))
         {
             ExitNow(entry = &mEntries[i]);
         }
@@ -76,9 +99,9 @@ Filter::Entry *Filter::FindAvailEntry(void)
 {
     Entry *entry = NULL;
 
-    for (uint8_t i = 0; i < GetMaxEntries(); i++)
+    for (uint16_t i = 0; i < GetMaxEntries(); i++)
     {
-        if (!mEntries[i].mFiltered && mEntries[i].mRssIn == OT_MAC_FILTER_FIXED_RSS_DISABLED)
+        if (!IsInUse(mEntries[i]))
         {
             ExitNow(entry = &mEntries[i]);
         }
@@ -88,6 +111,37 @@ exit:
     return entry;
 }
 
+void Filter::LinkEntry(Entry &aEntry)
+{
+    uint16_t  index  = static_cast<uint16_t>(&aEntry - mEntries);
+    uint16_t &bucket = mBuckets[GetBucket(static_cast<const ExtAddress &>(aEntry.mExtAddress))];
+
+    mEntryNext[index] = bucket;
+    bucket            = index;
+}
+
+void Filter::ReleaseEntryIfUnused(Entry &aEntry)
+{
+    uint16_t  index = static_cast<uint16_t>(&aEntry - mEntries);
+    uint16_t *link;
+
+    VerifyOrExit(!IsInUse(aEntry));
+
+    for (link = &mBuckets[GetBucket(static_cast<const ExtAddress &>(aEntry.mExtAddress))]; *link != kInvalidIndex;
+         link = &mEntryNext[*link])
+    {
+        if (*link == index)
+        {
+            *link             = mEntryNext[index];
+            mEntryNext[index] = kInvalidIndex;
+            break;
+        }
+    }
+
+exit:
+    return;
+}
+
 otError Filter::SetAddressMode(otMacFilterAddressMode aMode)
 {
     otError error = OT_ERROR_NONE;
@@ -111,6 +165,9 @@ otError Filter::AddAddress(const ExtAddress &aExtAddress)
     {
         VerifyOrExit((entry = FindAvailEntry()) != NULL, error = OT_ERROR_NO_BUFS);
         entry->mExtAddress = aExtAddress;
+        entry->mFiltered   = true;
+        LinkEntry(*entry);
+        ExitNow();
     }
 
     if (entry->mFiltered)
@@ -135,6 +192,7 @@ otError Filter::RemoveAddress(const ExtAddress &aExtAddress)
     }
 
     entry->mFiltered = false;
+    ReleaseEntryIfUnused(*entry);
 
 exit:
     return error;
@@ -142,23 +200,27 @@ exit:
 
 void Filter::ClearAddresses(void)
 {
-    for (uint8_t i = 0; i < GetMaxEntries(); i++)
+    for (uint16_t i = 0; i < GetMaxEntries(); i++)
     {
-        mEntries[i].mFiltered = false;
+        if (mEntries[i].mFiltered)
+        {
+            mEntries[i].mFiltered = false;
+            ReleaseEntryIfUnused(mEntries[i]);
+        }
     }
 }
 
 otError Filter::GetNextAddress(otMacFilterIterator &aIterator, Entry &aEntry)
 {
-    otError error = OT_ERROR_NOT_FOUND;
-    uint8_t i     = *reinterpret_cast<uint8_t *>(&aIterator);
+    otError  error = OT_ERROR_NOT_FOUND;
+    uint16_t i     = aIterator;
 
     for (; i < GetMaxEntries(); i++)
     {
         if (mEntries[i].mFiltered)
         {
             aEntry    = mEntries[i];
-            aIterator = *reinterpret_cast<otMacFilterIterator *>(&(++i));
+            aIterator = ++i;
             ExitNow(error = OT_ERROR_NONE);
         }
     }
@@ -185,6 +247,9 @@ otError Filter::AddRssIn(const ExtAddress *aExtAddress, int8_t aRss)
         {
             VerifyOrExit((entry = FindAvailEntry()) != NULL, error = OT_ERROR_NO_BUFS);
             entry->mExtAddress = static_cast<const otExtAddress &>(*aExtAddress);
+            entry->mRssIn      = aRss;
+            LinkEntry(*entry);
+            ExitNow();
         }
 
         entry->mRssIn = aRss;
@@ -207,6 +272,7 @@ otError Filter::RemoveRssIn(const ExtAddress *aExtAddress)
         Entry *entry = FindEntry(*aExtAddress);
         VerifyOrExit(entry != NULL, error = OT_ERROR_NOT_FOUND);
         entry->mRssIn = OT_MAC_FILTER_FIXED_RSS_DISABLED;
+        ReleaseEntryIfUnused(*entry);
     }
 
 exit:
@@ -217,23 +283,27 @@ void Filter::ClearRssIn(void)
 {
     mRssIn = OT_MAC_FILTER_FIXED_RSS_DISABLED;
 
-    for (uint8_t i = 0; i < GetMaxEntries(); i++)
+    for (uint16_t i = 0; i < GetMaxEntries(); i++)
     {
-        mEntries[i].mRssIn = OT_MAC_FILTER_FIXED_RSS_DISABLED;
+        if (mEntries[i].mRssIn != OT_MAC_FILTER_FIXED_RSS_DISABLED)
+        {
+            mEntries[i].mRssIn = OT_MAC_FILTER_FIXED_RSS_DISABLED;
+            ReleaseEntryIfUnused(mEntries[i]);
+        }
     }
 }
 
 otError Filter::GetNextRssIn(otMacFilterIterator &aIterator, Entry &aEntry)
 {
-    otError error = OT_ERROR_NOT_FOUND;
-    uint8_t i     = *reinterpret_cast<uint8_t *>(&aIterator);
+    otError  error = OT_ERROR_NOT_FOUND;
+    uint16_t i     = aIterator;
 
     for (; i < GetMaxEntries(); i++)
     {
         if (mEntries[i].mRssIn != OT_MAC_FILTER_FIXED_RSS_DISABLED)
         {
             aEntry    = mEntries[i];
-            aIterator = *reinterpret_cast<otMacFilterIterator *>(&(++i));
+            aIterator = ++i;
             ExitNow(error = OT_ERROR_NONE);
         }
     }
@@ -243,7 +313,7 @@ otError Filter::GetNextRssIn(otMacFilterIterator &aIterator, Entry &aEntry)
     {
         memset(&aEntry.mExtAddress, 0xff, OT_EXT_ADDRESS_SIZE);
         aEntry.mRssIn = mRssIn;
-        aIterator     = *reinterpret_cast<otMacFilterIterator *>(&(++i));
+        aIterator     = ++i;
         ExitNow(error = OT_ERROR_NONE);
     }
 
@@ -64,6 +64,7 @@ public:
     enum
     {
         kMaxEntries = OPENTHREAD_CONFIG_MAC_FILTER_SIZE,
+        kNumBuckets = OPENTHREAD_CONFIG_MAC_FILTER_NUM_BUCKETS,
     };
 
     /**
@@ -78,7 +79,7 @@ public:
      * @returns The maximum number of filter entries.
      *
      */
-    uint8_t GetMaxEntries(void) const { return kMaxEntries; }
+    uint16_t GetMaxEntries(void) const { return kMaxEntries; }
 
     /**
      * This function gets the address mode of the filter.
@@ -204,10 +205,22 @@ public:
     otError Apply(const ExtAddress &aExtAddress, int8_t &aRss);
 
 private:
+    enum
+    {
+        kInvalidIndex = 0xffff,
+    };
+
+    static uint16_t GetBucket(const ExtAddress &aExtAddress);
+    static bool     IsInUse(const Entry &aEntry);
+
     Entry *FindAvailEntry(void);
     Entry *FindEntry(const ExtAddress &aExtAddress);
+    void   LinkEntry(Entry &aEntry);
+    void   ReleaseEntryIfUnused(Entry &aEntry);
 
     Entry                  mEntries[kMaxEntries];
+    uint16_t               mEntryNext[kMaxEntries];
+    uint16_t               mBuckets[kNumBuckets];
     otMacFilterAddressMode mAddressMode;
     int8_t                 mRssIn;
 };
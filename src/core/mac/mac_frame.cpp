@@ -83,6 +83,31 @@ void Address::SetExtended(const uint8_t *aBuffer, bool aReverse)
     }
 }
 
+bool Address::operator==(const Address &aOther) const
+{
+    bool rval = false;
+
+    VerifyOrExit(mType == aOther.mType);
+
+    switch (mType)
+    {
+    case kTypeNone:
+        rval = true;
+        break;
+
+    case kTypeShort:
+        rval = (GetShort() == aOther.GetShort());
+        break;
+
+    case kTypeExtended:
+        rval = (GetExtended() == aOther.GetExtended());
+        break;
+    }
+
+exit:
+    return rval;
+}
+
 Address::InfoString Address::ToString(void) const
 {
     return (mType == kTypeExtended) ? GetExtended().ToString()
@@ -94,6 +119,8 @@ otError Frame::InitMacHeader(uint16_t aFcf, uint8_t aSecurityControl)
     uint8_t *bytes  = GetPsdu();
     uint8_t  length = 0;
 
+    mParsedInfo.mValid = false;
+
     // Frame Control Field
     Encoding::LittleEndian::WriteUint16(aFcf, bytes);
     length += kFcfSize;
@@ -201,6 +228,33 @@ exit:
     return error;
 }
 
+otError Frame::ParsePsdu(void)
+{
+    otError error = OT_ERROR_NONE;
+
+    // Compute the offsets with the cache disabled.
+    mParsedInfo.mValid = false;
+
+    SuccessOrExit(error = ValidatePsdu());
+
+    mParsedInfo.mFcf                 = GetFrameControlField();
+    mParsedInfo.mLength              = GetPsduLength();
+    mParsedInfo.mSrcAddrIndex        = FindSrcAddrIndex();
+    mParsedInfo.mSecurityHeaderIndex = FindSecurityHeaderIndex();
+    mParsedInfo.mPayloadIndex        = FindPayloadIndex();
+    mParsedInfo.mFooterLength        = GetFooterLength();
+    mParsedInfo.mValid               = true;
+
+exit:
+    return error;
+}
+
+bool Frame::IsPsduParsed(void) const
+{
+    return mParsedInfo.mValid && (mParsedInfo.mFcf == GetFrameControlField()) &&
+           (mParsedInfo.mLength == GetPsduLength());
+}
+
 void Frame::SetAckRequest(bool aAckRequest)
 {
     if (aAckRequest)
@@ -420,6 +474,8 @@ uint8_t Frame::FindSrcAddrIndex(void) const
     uint8_t  index = 0;
     uint16_t fcf   = GetFrameControlField();
 
+    VerifyOrExit(!IsPsduParsed(), index = mParsedInfo.mSrcAddrIndex);
+
     // Frame Control Field and Sequence Number
     index += kFcfSize + kDsnSize;
 
@@ -441,6 +497,7 @@ uint8_t Frame::FindSrcAddrIndex(void) const
         index += sizeof(PanId);
     }
 
+exit:
     return index;
 }
 
@@ -526,6 +583,7 @@ uint8_t Frame::FindSecurityHeaderIndex(void) const
     uint8_t  index = 0;
     uint16_t fcf   = GetFrameControlField();
 
+    VerifyOrExit(!IsPsduParsed(), index = mParsedInfo.mSecurityHeaderIndex);
     VerifyOrExit((fcf & kFcfSecurityEnabled) != 0, index = kInvalidIndex);
 
     // Frame Control Field and  Sequence Number
@@ -758,9 +816,15 @@ uint8_t Frame::GetHeaderLength(void) const
 uint8_t Frame::GetFooterLength(void) const
 {
     uint8_t footerLength = 0;
-    uint8_t index        = FindSecurityHeaderIndex();
+    uint8_t index;
 
-    VerifyOrExit(index != kInvalidIndex);
+    if (IsPsduParsed())
+    {
+        ExitNow(footerLength = mParsedInfo.mFooterLength);
+    }
+
+    index = FindSecurityHeaderIndex();
+    VerifyOrExit(index != kInvalidIndex, footerLength = kFcsSize);
 
     switch ((GetPsdu() + index)[0] & kSecLevelMask)
     {
@@ -785,10 +849,10 @@ uint8_t Frame::GetFooterLength(void) const
         break;
     }
 
-exit:
     // Frame Check Sequence
     footerLength += kFcsSize;
 
+exit:
     return footerLength;
 }
 
@@ -899,16 +963,20 @@ exit:
 
 uint8_t Frame::FindPayloadIndex(void) const
 {
-    uint8_t index = SkipSecurityHeaderIndex();
+    uint8_t index;
 #if OPENTHREAD_CONFIG_HEADER_IE_SUPPORT
     uint8_t *cur    = NULL;
-    uint8_t *footer = GetFooter();
+    uint8_t *footer = NULL;
 #endif
 
+    VerifyOrExit(!IsPsduParsed(), index = mParsedInfo.mPayloadIndex);
+
+    index = SkipSecurityHeaderIndex();
     VerifyOrExit(index != kInvalidIndex);
 
 #if OPENTHREAD_CONFIG_HEADER_IE_SUPPORT
-    cur = GetPsdu() + index;
+    footer = GetFooter();
+    cur    = GetPsdu() + index;
 
     if (IsIePresent())
     {
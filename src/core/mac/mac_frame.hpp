@@ -365,6 +365,30 @@ public:
      */
     bool IsShortAddrInvalid(void) const { return ((mType == kTypeShort) && (GetShort() == kShortAddrInvalid)); }
 
+    /**
+     * This method evaluates whether or not the addresses match.
+     *
+     * Two addresses match if they have the same type and the same Short or Extended Address value.
+     *
+     * @param[in]  aOther  The address to compare.
+     *
+     * @retval TRUE   If the addresses match.
+     * @retval FALSE  If the addresses do not match.
+     *
+     */
+    bool operator==(const Address &aOther) const;
+
+    /**
+     * This method evaluates whether or not the addresses match.
+     *
+     * @param[in]  aOther  The address to compare.
+     *
+     * @retval TRUE   If the addresses do not match.
+     * @retval FALSE  If the addresses match.
+     *
+     */
+    bool operator!=(const Address &aOther) const { return !(*this == aOther); }
+
     /**
      * This method converts an address to a null-terminated string
      *
@@ -567,6 +591,18 @@ public:
      */
     otError ValidatePsdu(void) const;
 
+    /**
+     * This method validates the frame and caches the offsets of its header fields.
+     *
+     * After a successful call, accessors for the source address, security header, payload and footer are
+     * constant-time as long as the Frame Control Field and the PSDU length are not changed.
+     *
+     * @retval OT_ERROR_NONE    Successfully parsed the MAC header.
+     * @retval OT_ERROR_PARSE   Failed to parse through the MAC header.
+     *
+     */
+    otError ParsePsdu(void);
+
     /**
      * This method returns the IEEE 802.15.4 Frame Type.
      *
@@ -1273,6 +1309,7 @@ private:
     };
 
     uint16_t GetFrameControlField(void) const;
+    bool     IsPsduParsed(void) const;
     uint8_t  FindDstPanIdIndex(void) const;
     uint8_t  FindDstAddrIndex(void) const;
     uint8_t  FindSrcPanIdIndex(void) const;
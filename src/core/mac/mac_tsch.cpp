@@ -0,0 +1,168 @@
+/*
+ *  Copyright (c) 2018, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the Time-Slotted Channel Hopping (TSCH) schedule.
+ */
+
+#include "mac_tsch.hpp"
+
+#include <string.h>
+
+#include "common/code_utils.hpp"
+#include "common/debug.hpp"
+
+#if OPENTHREAD_CONFIG_MAC_TSCH
+
+namespace ot {
+namespace Mac {
+
+TschSchedule::TschSchedule(void)
+    : mSlotframeLength(0)
+    , mNumCells(0)
+    , mNumChannels(0)
+{
+}
+
+void TschSchedule::SetSlotframeLength(uint16_t aLength)
+{
+    mSlotframeLength = aLength;
+
+    // Cells are sorted by slot offset, so the ones outside the slotframe are at the end.
+    while ((mNumCells > 0) && (mCells[mNumCells - 1].mSlotOffset >= aLength))
+    {
+        mNumCells--;
+    }
+}
+
+otError TschSchedule::AddCell(const Cell &aCell)
+{
+    otError error = OT_ERROR_NONE;
+    uint8_t index;
+
+    VerifyOrExit(aCell.mSlotOffset < mSlotframeLength, error = OT_ERROR_INVALID_ARGS);
+    VerifyOrExit(aCell.mOptions & (OT_LINK_TSCH_CELL_OPTION_TX | OT_LINK_TSCH_CELL_OPTION_RX),
+                 error = OT_ERROR_INVALID_ARGS);
+
+    for (index = 0; index < mNumCells; index++)
+    {
+        VerifyOrExit(mCells[index].mSlotOffset != aCell.mSlotOffset, error = OT_ERROR_ALREADY);
+
+        if (mCells[index].mSlotOffset > aCell.mSlotOffset)
+        {
+            break;
+        }
+    }
+
+    VerifyOrExit(mNumCells < kMaxCells, error = OT_ERROR_NO_BUFS);
+
+    memmove(&mCells[index + 1], &mCells[index], (mNumCells - index) * sizeof(Cell));
+    mCells[index] = aCell;
+    mNumCells++;
+
+exit:
+    return error;
+}
+
+otError TschSchedule::RemoveCell(uint16_t aSlotOffset)
+{
+    otError error = OT_ERROR_NOT_FOUND;
+
+    for (uint8_t index = 0; index < mNumCells; index++)
+    {
+        if (mCells[index].mSlotOffset == aSlotOffset)
+        {
+            mNumCells--;
+            memmove(&mCells[index], &mCells[index + 1], (mNumCells - index) * sizeof(Cell));
+            error = OT_ERROR_NONE;
+            break;
+        }
+    }
+
+    return error;
+}
+
+void TschSchedule::SetHoppingSequence(const ChannelMask &aMask)
+{
+    uint8_t channel = ChannelMask::kChannelIteratorFirst;
+
+    mNumChannels = 0;
+
+    while (aMask.GetNextChannel(channel) == OT_ERROR_NONE)
+    {
+        mHoppingSequence[mNumChannels++] = channel;
+    }
+}
+
+uint8_t TschSchedule::GetChannel(uint64_t aAsn, uint8_t aChannelOffset) const
+{
+    assert(mNumChannels != 0);
+
+    return mHoppingSequence[(aAsn + aChannelOffset) % mNumChannels];
+}
+
+const TschSchedule::Cell *TschSchedule::FindNextCell(uint64_t aAsn, uint8_t aOptions, uint64_t &aCellAsn) const
+{
+    const Cell *cell = NULL;
+    uint16_t    slot;
+
+    VerifyOrExit(mSlotframeLength != 0);
+
+    slot = static_cast<uint16_t>(aAsn % mSlotframeLength);
+
+    // Look for the first matching cell in the rest of the current slotframe.
+    for (uint8_t index = 0; index < mNumCells; index++)
+    {
+        if ((mCells[index].mSlotOffset >= slot) && (mCells[index].mOptions & aOptions))
+        {
+            cell     = &mCells[index];
+            aCellAsn = aAsn + (cell->mSlotOffset - slot);
+            ExitNow();
+        }
+    }
+
+    // Otherwise, wrap around to the first matching cell of the next slotframe.
+    for (uint8_t index = 0; index < mNumCells; index++)
+    {
+        if (mCells[index].mOptions & aOptions)
+        {
+            cell     = &mCells[index];
+            aCellAsn = aAsn + (mSlotframeLength - slot) + cell->mSlotOffset;
+            ExitNow();
+        }
+    }
+
+exit:
+    return cell;
+}
+
+} // namespace Mac
+} // namespace ot
+
+#endif // OPENTHREAD_CONFIG_MAC_TSCH
@@ -0,0 +1,204 @@
+/*
+ *  Copyright (c) 2018, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the Time-Slotted Channel Hopping (TSCH) schedule.
+ */
+
+#ifndef MAC_TSCH_HPP_
+#define MAC_TSCH_HPP_
+
+#include "openthread-core-config.h"
+
+#include <openthread/link.h>
+#include <openthread/platform/radio.h>
+
+#include "mac/channel_mask.hpp"
+
+#if OPENTHREAD_CONFIG_MAC_TSCH
+
+namespace ot {
+namespace Mac {
+
+/**
+ * @addtogroup core-mac
+ *
+ * @{
+ *
+ */
+
+/**
+ * This class implements a TSCH slotframe with its cell schedule and channel hopping sequence.
+ *
+ * Time is divided into timeslots numbered by the Absolute Slot Number (ASN). The slotframe repeats every
+ * `GetSlotframeLength()` timeslots, and a cell assigns a timeslot of the slotframe to transmission and/or reception
+ * on a channel offset. The channel used by a cell changes every slotframe following the hopping sequence.
+ *
+ */
+class TschSchedule
+{
+public:
+    /**
+     * This type represents a cell.
+     *
+     */
+    typedef otLinkTschCell Cell;
+
+    enum
+    {
+        kMaxCells = OPENTHREAD_CONFIG_MAC_TSCH_MAX_CELLS, ///< Maximum number of cells.
+    };
+
+    /**
+     * This constructor initializes the schedule with no slotframe and no cells.
+     *
+     */
+    TschSchedule(void);
+
+    /**
+     * This method indicates whether the schedule can be used (has a slotframe, a cell and a hopping sequence).
+     *
+     * @retval TRUE   The schedule can be used.
+     * @retval FALSE  The schedule cannot be used.
+     *
+     */
+    bool IsEnabled(void) const { return (mSlotframeLength != 0) && (mNumCells != 0) && (mNumChannels != 0); }
+
+    /**
+     * This method returns the slotframe length.
+     *
+     * @returns The number of timeslots in the slotframe, or zero if no slotframe is configured.
+     *
+     */
+    uint16_t GetSlotframeLength(void) const { return mSlotframeLength; }
+
+    /**
+     * This method sets the slotframe length.
+     *
+     * Cells whose slot offset does not fit in the new slotframe are removed.
+     *
+     * @param[in]  aLength  The number of timeslots in the slotframe, or zero to remove the slotframe.
+     *
+     */
+    void SetSlotframeLength(uint16_t aLength);
+
+    /**
+     * This method adds a cell to the schedule.
+     *
+     * @param[in]  aCell  A reference to the cell to add.
+     *
+     * @retval OT_ERROR_NONE          Successfully added the cell.
+     * @retval OT_ERROR_INVALID_ARGS  The slot offset is outside the slotframe or the cell has no TX or RX option.
+     * @retval OT_ERROR_ALREADY       A cell with the same slot offset already exists.
+     * @retval OT_ERROR_NO_BUFS       The schedule is full.
+     *
+     */
+    otError AddCell(const Cell &aCell);
+
+    /**
+     * This method removes a cell from the schedule.
+     *
+     * @param[in]  aSlotOffset  The slot offset of the cell to remove.
+     *
+     * @retval OT_ERROR_NONE       Successfully removed the cell.
+     * @retval OT_ERROR_NOT_FOUND  There is no cell with the given slot offset.
+     *
+     */
+    otError RemoveCell(uint16_t aSlotOffset);
+
+    /**
+     * This method returns the number of cells in the schedule.
+     *
+     * @returns The number of cells.
+     *
+     */
+    uint8_t GetNumCells(void) const { return mNumCells; }
+
+    /**
+     * This method returns a cell by its index.
+     *
+     * Cells are ordered by slot offset.
+     *
+     * @param[in]  aIndex  The index of the cell.
+     *
+     * @returns A pointer to the cell, or NULL if @p aIndex is out of range.
+     *
+     */
+    const Cell *GetCell(uint8_t aIndex) const { return (aIndex < mNumCells) ? &mCells[aIndex] : NULL; }
+
+    /**
+     * This method sets the channel hopping sequence to the channels of a channel mask, in ascending order.
+     *
+     * @param[in]  aMask  The channel mask.
+     *
+     */
+    void SetHoppingSequence(const ChannelMask &aMask);
+
+    /**
+     * This method returns the channel of a cell in a given timeslot.
+     *
+     * @param[in]  aAsn            The Absolute Slot Number.
+     * @param[in]  aChannelOffset  The channel offset of the cell.
+     *
+     * @returns The channel to use.
+     *
+     */
+    uint8_t GetChannel(uint64_t aAsn, uint8_t aChannelOffset) const;
+
+    /**
+     * This method finds the first timeslot at or after a given one that is scheduled with any of the given options.
+     *
+     * @param[in]   aAsn       The Absolute Slot Number to start from.
+     * @param[in]   aOptions   The cell options to look for (`OT_LINK_TSCH_CELL_OPTION_*`).
+     * @param[out]  aCellAsn   The Absolute Slot Number of the found timeslot.
+     *
+     * @returns A pointer to the cell scheduled in the found timeslot, or NULL if no cell has any of @p aOptions.
+     *
+     */
+    const Cell *FindNextCell(uint64_t aAsn, uint8_t aOptions, uint64_t &aCellAsn) const;
+
+private:
+    uint16_t mSlotframeLength;
+    uint8_t  mNumCells;
+    uint8_t  mNumChannels;
+    Cell     mCells[kMaxCells];
+    uint8_t  mHoppingSequence[OT_RADIO_CHANNEL_MAX - OT_RADIO_CHANNEL_MIN + 1];
+};
+
+/**
+ * @}
+ *
+ */
+
+} // namespace Mac
+} // namespace ot
+
+#endif // OPENTHREAD_CONFIG_MAC_TSCH
+
+#endif // MAC_TSCH_HPP_
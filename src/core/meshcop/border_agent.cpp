@@ -314,6 +314,10 @@ BorderAgent::BorderAgent(Instance &aInstance)
     , mUdpReceiver(BorderAgent::HandleUdpReceive, this)
     , mTimer(aInstance, HandleTimeout, this)
     , mState(OT_BORDER_AGENT_STATE_STOPPED)
+#if OPENTHREAD_CONFIG_BORDER_AGENT_PROXY_RATE_LIMIT
+    , mProxyTokenTime(0)
+    , mProxyTokens(OPENTHREAD_CONFIG_BORDER_AGENT_PROXY_BURST)
+#endif
 {
 }
 
@@ -326,6 +330,10 @@ void BorderAgent::HandleProxyTransmit(const Coap::Header &aHeader, const Message
 
     OT_UNUSED_VARIABLE(aHeader);
 
+#if OPENTHREAD_CONFIG_BORDER_AGENT_PROXY_RATE_LIMIT
+    VerifyOrExit(ConsumeProxyToken(), error = OT_ERROR_BUSY);
+#endif
+
     {
         UdpEncapsulationTlv tlv;
 
@@ -364,6 +372,48 @@ exit:
     }
 }
 
+#if OPENTHREAD_CONFIG_BORDER_AGENT_PROXY_RATE_LIMIT
+bool BorderAgent::ConsumeProxyToken(void)
+{
+    enum
+    {
+        kRate           = OPENTHREAD_CONFIG_BORDER_AGENT_PROXY_RATE_LIMIT,
+        kBurst          = OPENTHREAD_CONFIG_BORDER_AGENT_PROXY_BURST,
+        kFullBucketTime = 1000 * kBurst / kRate, ///< Time to refill an empty bucket (milliseconds)
+    };
+
+    bool     rval    = false;
+    uint32_t now     = TimerMilli::GetNow();
+    uint32_t elapsed = now - mProxyTokenTime;
+
+    if (elapsed >= kFullBucketTime)
+    {
+        mProxyTokens    = kBurst;
+        mProxyTokenTime = now;
+    }
+    else
+    {
+        uint32_t refill = elapsed * kRate / 1000;
+
+        // Only the time accounted for by whole tokens is consumed, the remainder carries over.
+        mProxyTokens += static_cast<uint16_t>(refill);
+        mProxyTokenTime += refill * 1000 / kRate;
+
+        if (mProxyTokens > kBurst)
+        {
+            mProxyTokens = kBurst;
+        }
+    }
+
+    VerifyOrExit(mProxyTokens > 0);
+    mProxyTokens--;
+    rval = true;
+
+exit:
+    return rval;
+}
+#endif // OPENTHREAD_CONFIG_BORDER_AGENT_PROXY_RATE_LIMIT
+
 bool BorderAgent::HandleUdpReceive(const Message &aMessage, const Ip6::MessageInfo &aMessageInfo)
 {
     Coap::Header header;
@@ -624,6 +674,10 @@ void BorderAgent::HandleConnected(bool aConnected)
     if (aConnected)
     {
         otLogInfoMeshCoP("Commissioner connected");
+#if OPENTHREAD_CONFIG_BORDER_AGENT_PROXY_RATE_LIMIT
+        mProxyTokens    = OPENTHREAD_CONFIG_BORDER_AGENT_PROXY_BURST;
+        mProxyTokenTime = TimerMilli::GetNow();
+#endif
         SetState(OT_BORDER_AGENT_STATE_ACTIVE);
         mTimer.Start(kKeepAliveTimeout);
     }
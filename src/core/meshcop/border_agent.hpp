@@ -133,6 +133,10 @@ private:
 
     void SetState(otBorderAgentState aState);
 
+#if OPENTHREAD_CONFIG_BORDER_AGENT_PROXY_RATE_LIMIT
+    bool ConsumeProxyToken(void);
+#endif
+
     enum
     {
         kBorderAgentUdpPort = 49191,     ///< UDP port of border agent service.
@@ -159,6 +163,11 @@ private:
 
     TimerMilli         mTimer;
     otBorderAgentState mState;
+
+#if OPENTHREAD_CONFIG_BORDER_AGENT_PROXY_RATE_LIMIT
+    uint32_t mProxyTokenTime;
+    uint16_t mProxyTokens;
+#endif
 };
 
 } // namespace MeshCoP
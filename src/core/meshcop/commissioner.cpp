@@ -60,12 +60,16 @@ namespace MeshCoP {
 
 Commissioner::Commissioner(Instance &aInstance)
     : InstanceLocator(aInstance)
+    , mSteeringDataRebuild(false)
     , mJoinerPort(0)
     , mJoinerRloc(0)
     , mJoinerExpirationTimer(aInstance, HandleJoinerExpirationTimer, this)
     , mTimer(aInstance, HandleTimer, this)
     , mSessionId(0)
     , mTransmitAttempts(0)
+#if OPENTHREAD_CONFIG_COMMISSIONER_SET_DELAY
+    , mCommissionerSetTimer(aInstance, &Commissioner::HandleCommissionerSetTimer, this)
+#endif
     , mRelayReceive(OT_URI_PATH_RELAY_RX, &Commissioner::HandleRelayReceive, this)
     , mDatasetChanged(OT_URI_PATH_DATASET_CHANGED, &Commissioner::HandleDatasetChanged, this)
     , mJoinerFinalize(OT_URI_PATH_JOINER_FINALIZE, &Commissioner::HandleJoinerFinalize, this)
@@ -75,6 +79,12 @@ Commissioner::Commissioner(Instance &aInstance)
     , mState(OT_COMMISSIONER_STATE_DISABLED)
 {
     memset(mJoiners, 0, sizeof(mJoiners));
+    mSteeringData.Init();
+    mSteeringData.Clear();
+#if OPENTHREAD_CONFIG_COMMISSIONER_PSKC_CACHE_SIZE
+    memset(mPSKcCache, 0, sizeof(mPSKcCache));
+    mPSKcCacheNext = 0;
+#endif
 }
 
 void Commissioner::AddCoapResources(void)
@@ -128,6 +138,9 @@ otError Commissioner::Stop(void)
     mTransmitAttempts = 0;
 
     mTimer.Stop();
+#if OPENTHREAD_CONFIG_COMMISSIONER_SET_DELAY
+    mCommissionerSetTimer.Stop();
+#endif
 
     GetNetif().GetDtls().Stop();
 
@@ -141,42 +154,38 @@ otError Commissioner::SendCommissionerSet(void)
 {
     otError                error;
     otCommissioningDataset dataset;
-    SteeringDataTlv        steeringData;
-    Mac::ExtAddress        joinerId;
 
     VerifyOrExit(mState == OT_COMMISSIONER_STATE_ACTIVE, error = OT_ERROR_INVALID_STATE);
 
+#if OPENTHREAD_CONFIG_COMMISSIONER_SET_DELAY
+    mCommissionerSetTimer.Stop();
+#endif
+
     memset(&dataset, 0, sizeof(dataset));
 
     // session id
     dataset.mSessionId      = mSessionId;
     dataset.mIsSessionIdSet = true;
 
-    // compute bloom filter
-    steeringData.Init();
-    steeringData.Clear();
-
-    for (size_t i = 0; i < OT_ARRAY_LENGTH(mJoiners); i++)
+    // A Bloom filter cannot drop a single joiner, so it is only recomputed after a removal.
+    if (mSteeringDataRebuild)
     {
-        if (!mJoiners[i].mValid)
-        {
-            continue;
-        }
+        mSteeringData.Init();
+        mSteeringData.Clear();
+        mSteeringDataRebuild = false;
 
-        if (mJoiners[i].mAny)
+        for (size_t i = 0; i < OT_ARRAY_LENGTH(mJoiners); i++)
         {
-            steeringData.SetLength(1);
-            steeringData.Set();
-            break;
+            if (mJoiners[i].mValid)
+            {
+                AddToSteeringData(mJoiners[i]);
+            }
         }
-
-        ComputeJoinerId(mJoiners[i].mEui64, joinerId);
-        steeringData.ComputeBloomFilter(joinerId);
     }
 
     // set bloom filter
-    memcpy(dataset.mSteeringData.m8, steeringData.GetValue(), steeringData.GetLength());
-    dataset.mSteeringData.mLength = steeringData.GetLength();
+    memcpy(dataset.mSteeringData.m8, mSteeringData.GetValue(), mSteeringData.GetLength());
+    dataset.mSteeringData.mLength = mSteeringData.GetLength();
     dataset.mIsSteeringDataSet    = true;
 
     SuccessOrExit(error = SendMgmtCommissionerSetRequest(dataset, NULL, 0));
@@ -185,6 +194,43 @@ exit:
     return error;
 }
 
+void Commissioner::ScheduleCommissionerSet(void)
+{
+#if OPENTHREAD_CONFIG_COMMISSIONER_SET_DELAY
+    VerifyOrExit(mState == OT_COMMISSIONER_STATE_ACTIVE);
+
+    if (!mCommissionerSetTimer.IsRunning())
+    {
+        mCommissionerSetTimer.Start(OPENTHREAD_CONFIG_COMMISSIONER_SET_DELAY);
+    }
+
+exit:
+    return;
+#else
+    SendCommissionerSet();
+#endif
+}
+
+#if OPENTHREAD_CONFIG_COMMISSIONER_SET_DELAY
+void Commissioner::HandleCommissionerSetTimer(Timer &aTimer)
+{
+    aTimer.GetOwner<Commissioner>().SendCommissionerSet();
+}
+#endif
+
+void Commissioner::AddToSteeringData(const Joiner &aJoiner)
+{
+    if (aJoiner.mAny)
+    {
+        mSteeringData.SetLength(1);
+        mSteeringData.Set();
+    }
+    else if (!mSteeringData.DoesAllowAny())
+    {
+        mSteeringData.ComputeBloomFilter(aJoiner.mJoinerId);
+    }
+}
+
 void Commissioner::ClearJoiners(void)
 {
     for (size_t i = 0; i < OT_ARRAY_LENGTH(mJoiners); i++)
@@ -192,6 +238,10 @@ void Commissioner::ClearJoiners(void)
         mJoiners[i].mValid = false;
     }
 
+    mSteeringData.Init();
+    mSteeringData.Clear();
+    mSteeringDataRebuild = false;
+
     SendCommissionerSet();
 }
 
@@ -214,6 +264,7 @@ otError Commissioner::AddJoiner(const Mac::ExtAddress *aEui64, const char *aPSKd
         if (aEui64 != NULL)
         {
             memcpy(&mJoiners[i].mEui64, aEui64, sizeof(mJoiners[i].mEui64));
+            ComputeJoinerId(mJoiners[i].mEui64, mJoiners[i].mJoinerId);
             mJoiners[i].mAny = false;
         }
         else
@@ -227,7 +278,12 @@ otError Commissioner::AddJoiner(const Mac::ExtAddress *aEui64, const char *aPSKd
 
         UpdateJoinerExpirationTimer();
 
-        SendCommissionerSet();
+        if (!mSteeringDataRebuild)
+        {
+            AddToSteeringData(mJoiners[i]);
+        }
+
+        ScheduleCommissionerSet();
 
         ExitNow(error = OT_ERROR_NONE);
     }
@@ -286,9 +342,10 @@ otError Commissioner::RemoveJoiner(const Mac::ExtAddress *aEui64, uint32_t aDela
         }
         else
         {
-            mJoiners[i].mValid = false;
+            mJoiners[i].mValid   = false;
+            mSteeringDataRebuild = true;
             UpdateJoinerExpirationTimer();
-            SendCommissionerSet();
+            ScheduleCommissionerSet();
         }
 
         ExitNow(error = OT_ERROR_NONE);
@@ -803,7 +860,6 @@ void Commissioner::HandleRelayReceive(Coap::Header &aHeader, Message &aMessage,
     uint16_t               offset;
     uint16_t               length;
     bool                   enableJoiner = false;
-    Mac::ExtAddress        joinerId;
 
     VerifyOrExit(mState == OT_COMMISSIONER_STATE_ACTIVE, error = OT_ERROR_INVALID_STATE);
 
@@ -833,9 +889,7 @@ void Commissioner::HandleRelayReceive(Coap::Header &aHeader, Message &aMessage,
                 continue;
             }
 
-            ComputeJoinerId(mJoiners[i].mEui64, joinerId);
-
-            if (mJoiners[i].mAny || !memcmp(&joinerId, mJoinerIid, sizeof(joinerId)))
+            if (mJoiners[i].mAny || !memcmp(&mJoiners[i].mJoinerId, mJoinerIid, sizeof(mJoiners[i].mJoinerId)))
             {
                 error = netif.GetCoapSecure().SetPsk(reinterpret_cast<const uint8_t *>(mJoiners[i].mPsk),
                                                      static_cast<uint8_t>(strlen(mJoiners[i].mPsk)));
@@ -1095,6 +1149,93 @@ exit:
     return error;
 }
 
+otError Commissioner::GetPSKc(const char *           aPassPhrase,
+                              const char *           aNetworkName,
+                              const otExtendedPanId &aExtPanId,
+                              uint8_t *              aPSKc)
+{
+#if OPENTHREAD_CONFIG_COMMISSIONER_PSKC_CACHE_SIZE
+    otError error = OT_ERROR_NONE;
+    uint8_t key[Crypto::Sha256::kHashSize];
+
+    ComputePSKcCacheKey(aPassPhrase, aNetworkName, aExtPanId, key);
+
+    for (uint8_t i = 0; i < OPENTHREAD_CONFIG_COMMISSIONER_PSKC_CACHE_SIZE; i++)
+    {
+        if (mPSKcCache[i].mValid && memcmp(mPSKcCache[i].mKey, key, sizeof(key)) == 0)
+        {
+            memcpy(aPSKc, mPSKcCache[i].mPSKc, OT_PSKC_MAX_SIZE);
+            ExitNow();
+        }
+    }
+
+    SuccessOrExit(error = GeneratePSKc(aPassPhrase, aNetworkName, aExtPanId, aPSKc));
+    AddPSKcCacheEntry(key, aPSKc);
+
+exit:
+    return error;
+#else
+    return GeneratePSKc(aPassPhrase, aNetworkName, aExtPanId, aPSKc);
+#endif
+}
+
+#if OPENTHREAD_CONFIG_COMMISSIONER_PSKC_CACHE_SIZE
+otError Commissioner::SetPSKc(const char *           aPassPhrase,
+                              const char *           aNetworkName,
+                              const otExtendedPanId &aExtPanId,
+                              const uint8_t *        aPSKc)
+{
+    otError error = OT_ERROR_NONE;
+    uint8_t key[Crypto::Sha256::kHashSize];
+
+    VerifyOrExit((strlen(aPassPhrase) >= OT_COMMISSIONING_PASSPHRASE_MIN_SIZE) &&
+                     (strlen(aPassPhrase) <= OT_COMMISSIONING_PASSPHRASE_MAX_SIZE),
+                 error = OT_ERROR_INVALID_ARGS);
+
+    ComputePSKcCacheKey(aPassPhrase, aNetworkName, aExtPanId, key);
+
+    for (uint8_t i = 0; i < OPENTHREAD_CONFIG_COMMISSIONER_PSKC_CACHE_SIZE; i++)
+    {
+        if (mPSKcCache[i].mValid && memcmp(mPSKcCache[i].mKey, key, sizeof(key)) == 0)
+        {
+            memcpy(mPSKcCache[i].mPSKc, aPSKc, OT_PSKC_MAX_SIZE);
+            ExitNow();
+        }
+    }
+
+    AddPSKcCacheEntry(key, aPSKc);
+
+exit:
+    return error;
+}
+
+void Commissioner::ComputePSKcCacheKey(const char *           aPassPhrase,
+                                       const char *           aNetworkName,
+                                       const otExtendedPanId &aExtPanId,
+                                       uint8_t *              aKey)
+{
+    Crypto::Sha256 sha256;
+
+    // The terminating null characters keep the passphrase and network name boundaries unambiguous.
+    sha256.Start();
+    sha256.Update(reinterpret_cast<const uint8_t *>(aPassPhrase), static_cast<uint16_t>(strlen(aPassPhrase) + 1));
+    sha256.Update(reinterpret_cast<const uint8_t *>(aNetworkName), static_cast<uint16_t>(strlen(aNetworkName) + 1));
+    sha256.Update(aExtPanId.m8, sizeof(aExtPanId));
+    sha256.Finish(aKey);
+}
+
+void Commissioner::AddPSKcCacheEntry(const uint8_t *aKey, const uint8_t *aPSKc)
+{
+    PSKcCacheEntry &entry = mPSKcCache[mPSKcCacheNext];
+
+    memcpy(entry.mKey, aKey, sizeof(entry.mKey));
+    memcpy(entry.mPSKc, aPSKc, sizeof(entry.mPSKc));
+    entry.mValid = true;
+
+    mPSKcCacheNext = (mPSKcCacheNext + 1) % OPENTHREAD_CONFIG_COMMISSIONER_PSKC_CACHE_SIZE;
+}
+#endif // OPENTHREAD_CONFIG_COMMISSIONER_PSKC_CACHE_SIZE
+
 } // namespace MeshCoP
 } // namespace ot
 
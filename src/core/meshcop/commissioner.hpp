@@ -42,6 +42,7 @@
 #include "coap/coap_secure.hpp"
 #include "common/locator.hpp"
 #include "common/timer.hpp"
+#include "crypto/sha256.hpp"
 #include "mac/mac_frame.hpp"
 #include "meshcop/announce_begin_client.hpp"
 #include "meshcop/dtls.hpp"
@@ -215,6 +216,42 @@ public:
                                 const otExtendedPanId &aExtPanId,
                                 uint8_t *              aPSKc);
 
+    /**
+     * This method gets PSKc, reusing a value previously generated or supplied for the same inputs.
+     *
+     * @param[in]  aPassPhrase   The commissioning passphrase.
+     * @param[in]  aNetworkName  The network name for PSKc computation.
+     * @param[in]  aExtPanId     The extended pan id for PSKc computation.
+     * @param[out] aPSKc         A pointer to where the PSKc will be placed.
+     *
+     * @retval OT_ERROR_NONE          Successfully got PSKc.
+     * @retval OT_ERROR_INVALID_ARGS  If the length of passphrase is out of range.
+     *
+     */
+    otError GetPSKc(const char *           aPassPhrase,
+                    const char *           aNetworkName,
+                    const otExtendedPanId &aExtPanId,
+                    uint8_t *              aPSKc);
+
+#if OPENTHREAD_CONFIG_COMMISSIONER_PSKC_CACHE_SIZE
+    /**
+     * This method supplies a precomputed PSKc for the given inputs so that `GetPSKc()` returns it.
+     *
+     * @param[in]  aPassPhrase   The commissioning passphrase.
+     * @param[in]  aNetworkName  The network name for PSKc computation.
+     * @param[in]  aExtPanId     The extended pan id for PSKc computation.
+     * @param[in]  aPSKc         A pointer to the precomputed PSKc.
+     *
+     * @retval OT_ERROR_NONE          Successfully cached PSKc.
+     * @retval OT_ERROR_INVALID_ARGS  If the length of passphrase is out of range.
+     *
+     */
+    otError SetPSKc(const char *           aPassPhrase,
+                    const char *           aNetworkName,
+                    const otExtendedPanId &aExtPanId,
+                    const uint8_t *        aPSKc);
+#endif
+
     /**
      * This method returns a reference to the AnnounceBeginClient instance.
      *
@@ -260,6 +297,10 @@ private:
 
     void UpdateJoinerExpirationTimer(void);
 
+#if OPENTHREAD_CONFIG_COMMISSIONER_SET_DELAY
+    static void HandleCommissionerSetTimer(Timer &aTimer);
+#endif
+
     static void HandleMgmtCommissionerSetResponse(void *               aContext,
                                                   otCoapHeader *       aHeader,
                                                   otMessage *          aMessage,
@@ -321,12 +362,14 @@ private:
     otError        SendRelayTransmit(Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
 
     otError SendCommissionerSet(void);
+    void    ScheduleCommissionerSet(void);
     otError SendPetition(void);
     otError SendKeepAlive(void);
 
     struct Joiner
     {
         Mac::ExtAddress mEui64;
+        Mac::ExtAddress mJoinerId;
         uint32_t        mExpirationTime;
         char            mPsk[Dtls::kPskMaxLength + 1];
         bool            mValid : 1;
@@ -334,6 +377,11 @@ private:
     };
     Joiner mJoiners[OPENTHREAD_CONFIG_MAX_JOINER_ENTRIES];
 
+    void AddToSteeringData(const Joiner &aJoiner);
+
+    SteeringDataTlv mSteeringData;
+    bool            mSteeringDataRebuild;
+
     uint8_t    mJoinerIid[8];
     uint16_t   mJoinerPort;
     uint16_t   mJoinerRloc;
@@ -343,6 +391,10 @@ private:
     uint16_t   mSessionId;
     uint8_t    mTransmitAttempts;
 
+#if OPENTHREAD_CONFIG_COMMISSIONER_SET_DELAY
+    TimerMilli mCommissionerSetTimer;
+#endif
+
     Coap::Resource mRelayReceive;
     Coap::Resource mDatasetChanged;
     Coap::Resource mJoinerFinalize;
@@ -354,6 +406,23 @@ private:
     Ip6::NetifUnicastAddress mCommissionerAloc;
 
     otCommissionerState mState;
+
+#if OPENTHREAD_CONFIG_COMMISSIONER_PSKC_CACHE_SIZE
+    static void ComputePSKcCacheKey(const char *           aPassPhrase,
+                                    const char *           aNetworkName,
+                                    const otExtendedPanId &aExtPanId,
+                                    uint8_t *              aKey);
+    void        AddPSKcCacheEntry(const uint8_t *aKey, const uint8_t *aPSKc);
+
+    struct PSKcCacheEntry
+    {
+        uint8_t mKey[Crypto::Sha256::kHashSize];
+        uint8_t mPSKc[OT_PSKC_MAX_SIZE];
+        bool    mValid;
+    };
+    PSKcCacheEntry mPSKcCache[OPENTHREAD_CONFIG_COMMISSIONER_PSKC_CACHE_SIZE];
+    uint8_t        mPSKcCacheNext;
+#endif
 };
 
 } // namespace MeshCoP
@@ -75,6 +75,28 @@ exit:
     return rval;
 }
 
+bool Dataset::IsEqual(const Dataset &aDataset) const
+{
+    bool       rval = true;
+    const Tlv *cur  = reinterpret_cast<const Tlv *>(mTlvs);
+    const Tlv *end  = reinterpret_cast<const Tlv *>(mTlvs + mLength);
+
+    VerifyOrExit(mLength == aDataset.mLength, rval = false);
+
+    // Each TLV type appears at most once, so equal sizes and all TLVs found means the same set of TLVs.
+    for (; cur < end; cur = cur->GetNext())
+    {
+        const Tlv *other = aDataset.Get(cur->GetType());
+
+        VerifyOrExit(other != NULL && other->GetLength() == cur->GetLength() &&
+                         memcmp(other, cur, sizeof(Tlv) + cur->GetLength()) == 0,
+                     rval = false);
+    }
+
+exit:
+    return rval;
+}
+
 Tlv *Dataset::Get(Tlv::Type aType)
 {
     Tlv *cur  = reinterpret_cast<Tlv *>(mTlvs);
@@ -423,6 +445,13 @@ otError Dataset::Set(const Tlv &aTlv)
 
     VerifyOrExit(sizeof(Tlv) + aTlv.GetLength() <= bytesAvailable, error = OT_ERROR_NO_BUFS);
 
+    if (old != NULL && old->GetLength() == aTlv.GetLength())
+    {
+        memcpy(old, &aTlv, sizeof(Tlv) + aTlv.GetLength());
+        mUpdateTime = TimerMilli::GetNow();
+        ExitNow();
+    }
+
     // remove old TLV
     if (old != NULL)
     {
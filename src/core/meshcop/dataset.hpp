@@ -79,6 +79,18 @@ public:
      */
     bool IsValid(void) const;
 
+    /**
+     * This method indicates whether or not the dataset contains the same TLVs as another dataset.
+     *
+     * The TLVs may appear in a different order.
+     *
+     * @param[in]  aDataset  A reference to the dataset to compare with.
+     *
+     * @returns TRUE if both datasets contain the same TLVs, FALSE otherwise.
+     *
+     */
+    bool IsEqual(const Dataset &aDataset) const;
+
     /**
      * This method returns a pointer to the TLV.
      *
@@ -158,6 +170,8 @@ public:
     /**
      * This method sets a TLV in the Dataset.
      *
+     * An existing TLV of the same type and length is overwritten in place, keeping the order of the TLVs.
+     *
      * @param[in]  aTlv  A reference to the TLV.
      *
      * @retval OT_ERROR_NONE     Successfully set the TLV.
@@ -173,8 +173,20 @@ otError DatasetLocal::Set(const Dataset &aDataset)
     }
     else
     {
-        error = GetInstance().GetSettings().SaveOperationalDataset(IsActive(), aDataset);
-        otLogInfoMeshCoP("%s dataset set", mType == Tlv::kActiveTimestamp ? "Active" : "Pending");
+        Dataset saved(mType);
+
+        // Avoid rewriting non-volatile storage when the dataset did not change.
+        if (GetInstance().GetSettings().ReadOperationalDataset(IsActive(), saved) == OT_ERROR_NONE &&
+            saved.IsEqual(aDataset))
+        {
+            error = OT_ERROR_NONE;
+            otLogInfoMeshCoP("%s dataset unchanged", mType == Tlv::kActiveTimestamp ? "Active" : "Pending");
+        }
+        else
+        {
+            error = GetInstance().GetSettings().SaveOperationalDataset(IsActive(), aDataset);
+            otLogInfoMeshCoP("%s dataset set", mType == Tlv::kActiveTimestamp ? "Active" : "Pending");
+        }
     }
 
     SuccessOrExit(error);
@@ -107,6 +107,10 @@ Dtls::Dtls(Instance &aInstance)
     memset(&mCookieCtx, 0, sizeof(mCookieCtx));
 #endif
 
+#if OPENTHREAD_CONFIG_DTLS_SESSION_CACHE_SIZE
+    ClearSessionCache();
+#endif
+
     mProvisioningUrl.Init();
 }
 
@@ -144,6 +148,10 @@ otError Dtls::Start(bool             aClient,
     otExtAddress eui64;
     int          rval;
 
+#if OPENTHREAD_CONFIG_DTLS_ARENA_SIZE && !OPENTHREAD_ENABLE_MULTIPLE_INSTANCES
+    Crypto::MbedTlsArena::Scope arenaScope(mArena);
+#endif
+
     mConnectedHandler = aConnectedHandler;
     mReceiveHandler   = aReceiveHandler;
     mSendHandler      = aSendHandler;
@@ -154,6 +162,10 @@ otError Dtls::Start(bool             aClient,
     // do not handle new connection before guard time expired
     VerifyOrExit(mGuardTimerSet == false, rval = MBEDTLS_ERR_SSL_TIMEOUT);
 
+#if OPENTHREAD_CONFIG_DTLS_ARENA_SIZE && !OPENTHREAD_ENABLE_MULTIPLE_INSTANCES
+    mArena.Start();
+#endif
+
     mbedtls_ssl_init(&mSsl);
     mbedtls_ssl_config_init(&mConf);
     mbedtls_ctr_drbg_init(&mCtrDrbg);
@@ -208,6 +220,13 @@ otError Dtls::Start(bool             aClient,
     }
 #endif // OPENTHREAD_ENABLE_BORDER_AGENT || OPENTHREAD_ENABLE_COMMISSIONER || OPENTHREAD_ENABLE_APPLICATION_COAP_SECURE
 
+#if OPENTHREAD_CONFIG_DTLS_SESSION_CACHE_SIZE
+    if (!aClient && mCipherSuites[0] == MBEDTLS_TLS_ECJPAKE_WITH_AES_128_CCM_8)
+    {
+        mbedtls_ssl_conf_session_cache(&mConf, this, &Dtls::HandleMbedtlsGetCache, &Dtls::HandleMbedtlsSetCache);
+    }
+#endif
+
     rval = mbedtls_ssl_setup(&mSsl, &mConf);
     VerifyOrExit(rval == 0);
 
@@ -334,6 +353,12 @@ void Dtls::Close(void)
 #endif // MBEDTLS_KEY_EXCHANGE_ECDHE_ECDSA_ENABLED
 #endif // OPENTHREAD_ENABLE_APPLICATION_COAP_SECURE
 
+#if OPENTHREAD_CONFIG_DTLS_ARENA_SIZE && !OPENTHREAD_ENABLE_MULTIPLE_INSTANCES
+    otLogInfoMeshCoP("DTLS arena peak usage %u bytes, %u heap fallbacks",
+                     static_cast<unsigned int>(mArena.GetPeakUsage()), mArena.GetFallbackCount());
+    mArena.Stop();
+#endif
+
     if (mConnectedHandler != NULL)
     {
         mConnectedHandler(mContext, false);
@@ -354,6 +379,14 @@ otError Dtls::SetPsk(const uint8_t *aPsk, uint8_t aPskLength)
 
     VerifyOrExit(aPskLength <= sizeof(mPsk), error = OT_ERROR_INVALID_ARGS);
 
+#if OPENTHREAD_CONFIG_DTLS_SESSION_CACHE_SIZE
+    // Sessions established with another PSK must not be resumed with this one.
+    if (aPskLength != mPskLength || memcmp(mPsk, aPsk, aPskLength) != 0)
+    {
+        ClearSessionCache();
+    }
+#endif
+
     memcpy(mPsk, aPsk, aPskLength);
     mPskLength       = aPskLength;
     mCipherSuites[0] = MBEDTLS_TLS_ECJPAKE_WITH_AES_128_CCM_8;
@@ -468,6 +501,10 @@ otError Dtls::Send(Message &aMessage, uint16_t aLength)
     otError error = OT_ERROR_NONE;
     uint8_t buffer[kApplicationDataMaxLength];
 
+#if OPENTHREAD_CONFIG_DTLS_ARENA_SIZE && !OPENTHREAD_ENABLE_MULTIPLE_INSTANCES
+    Crypto::MbedTlsArena::Scope arenaScope(mArena);
+#endif
+
     VerifyOrExit(aLength <= kApplicationDataMaxLength, error = OT_ERROR_NO_BUFS);
 
     // Store message specific sub type.
@@ -689,6 +726,90 @@ int Dtls::HandleMbedtlsExportKeys(const unsigned char *aMasterSecret,
     return 0;
 }
 
+#if OPENTHREAD_CONFIG_DTLS_SESSION_CACHE_SIZE
+int Dtls::HandleMbedtlsGetCache(void *aContext, mbedtls_ssl_session *aSession)
+{
+    return static_cast<Dtls *>(aContext)->HandleMbedtlsGetCache(*aSession);
+}
+
+int Dtls::HandleMbedtlsGetCache(mbedtls_ssl_session &aSession)
+{
+    int      rval = -1;
+    uint32_t now  = TimerMilli::GetNow();
+
+    for (uint8_t i = 0; i < OPENTHREAD_CONFIG_DTLS_SESSION_CACHE_SIZE; i++)
+    {
+        SessionCacheEntry &entry = mSessionCache[i];
+
+        if (entry.mSession.id_len == 0 || entry.mSession.id_len != aSession.id_len ||
+            memcmp(entry.mSession.id, aSession.id, aSession.id_len) != 0)
+        {
+            continue;
+        }
+
+        if (now - entry.mTimestamp >= TimerMilli::SecToMsec(OPENTHREAD_CONFIG_DTLS_SESSION_CACHE_TIMEOUT) ||
+            entry.mSession.ciphersuite != aSession.ciphersuite)
+        {
+            memset(&entry, 0, sizeof(entry));
+            break;
+        }
+
+        memcpy(&aSession, &entry.mSession, sizeof(aSession));
+        otLogInfoMeshCoP("Resuming DTLS session");
+        ExitNow(rval = 0);
+    }
+
+exit:
+    return rval;
+}
+
+int Dtls::HandleMbedtlsSetCache(void *aContext, const mbedtls_ssl_session *aSession)
+{
+    return static_cast<Dtls *>(aContext)->HandleMbedtlsSetCache(*aSession);
+}
+
+int Dtls::HandleMbedtlsSetCache(const mbedtls_ssl_session &aSession)
+{
+    uint32_t           now    = TimerMilli::GetNow();
+    SessionCacheEntry *oldest = &mSessionCache[0];
+
+    // Replace an unused entry, or else the one of the oldest session.
+    for (uint8_t i = 0; i < OPENTHREAD_CONFIG_DTLS_SESSION_CACHE_SIZE; i++)
+    {
+        SessionCacheEntry &entry = mSessionCache[i];
+
+        if (entry.mSession.id_len == 0)
+        {
+            oldest = &entry;
+            break;
+        }
+
+        if (now - entry.mTimestamp > now - oldest->mTimestamp)
+        {
+            oldest = &entry;
+        }
+    }
+
+    memcpy(&oldest->mSession, &aSession, sizeof(oldest->mSession));
+#if defined(MBEDTLS_X509_CRT_PARSE_C)
+    // The peer certificate belongs to the live session, it is not needed for resumption with EC-JPAKE.
+    oldest->mSession.peer_cert = NULL;
+#endif
+#if defined(MBEDTLS_SSL_SESSION_TICKETS) && defined(MBEDTLS_SSL_CLI_C)
+    oldest->mSession.ticket     = NULL;
+    oldest->mSession.ticket_len = 0;
+#endif
+    oldest->mTimestamp = now;
+
+    return 0;
+}
+
+void Dtls::ClearSessionCache(void)
+{
+    memset(mSessionCache, 0, sizeof(mSessionCache));
+}
+#endif // OPENTHREAD_CONFIG_DTLS_SESSION_CACHE_SIZE
+
 void Dtls::HandleTimer(Timer &aTimer)
 {
     aTimer.GetOwner<Dtls>().HandleTimer();
@@ -713,6 +834,10 @@ void Dtls::Process(void)
     bool    shouldClose = false;
     int     rval;
 
+#if OPENTHREAD_CONFIG_DTLS_ARENA_SIZE && !OPENTHREAD_ENABLE_MULTIPLE_INSTANCES
+    Crypto::MbedTlsArena::Scope arenaScope(mArena);
+#endif
+
     while (mStarted)
     {
         if (mSsl.state != MBEDTLS_SSL_HANDSHAKE_OVER)
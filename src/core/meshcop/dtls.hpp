@@ -58,6 +58,7 @@
 #include "common/locator.hpp"
 #include "common/message.hpp"
 #include "common/timer.hpp"
+#include "crypto/mbedtls.hpp"
 #include "crypto/sha256.hpp"
 #include "meshcop/meshcop_tlvs.hpp"
 
@@ -359,6 +360,16 @@ private:
 
     static int HandleMbedtlsEntropyPoll(void *aData, unsigned char *aOutput, size_t aInLen, size_t *aOutLen);
 
+#if OPENTHREAD_CONFIG_DTLS_SESSION_CACHE_SIZE
+    static int HandleMbedtlsGetCache(void *aContext, mbedtls_ssl_session *aSession);
+    int        HandleMbedtlsGetCache(mbedtls_ssl_session &aSession);
+
+    static int HandleMbedtlsSetCache(void *aContext, const mbedtls_ssl_session *aSession);
+    int        HandleMbedtlsSetCache(const mbedtls_ssl_session &aSession);
+
+    void ClearSessionCache(void);
+#endif
+
     void Close(void);
     void Process(void);
 
@@ -401,6 +412,10 @@ private:
 
     bool mStarted;
 
+#if OPENTHREAD_CONFIG_DTLS_ARENA_SIZE && !OPENTHREAD_ENABLE_MULTIPLE_INSTANCES
+    Crypto::MbedTlsArena mArena;
+#endif
+
     TimerMilli mTimer;
     uint32_t   mTimerIntermediate;
     bool       mTimerSet;
@@ -417,6 +432,16 @@ private:
 
     uint8_t mMessageSubType;
     uint8_t mMessageDefaultSubType;
+
+#if OPENTHREAD_CONFIG_DTLS_SESSION_CACHE_SIZE
+    struct SessionCacheEntry
+    {
+        mbedtls_ssl_session mSession;   ///< The session, `id_len` is zero for an unused entry.
+        uint32_t            mTimestamp; ///< Time the session was established (milliseconds).
+    };
+
+    SessionCacheEntry mSessionCache[OPENTHREAD_CONFIG_DTLS_SESSION_CACHE_SIZE];
+#endif
 };
 
 } // namespace MeshCoP
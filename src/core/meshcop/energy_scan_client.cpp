@@ -61,6 +61,7 @@ EnergyScanClient::EnergyScanClient(Instance &aInstance)
 {
     mContext  = NULL;
     mCallback = NULL;
+    memset(mSummary, 0, sizeof(mSummary));
     GetNetif().GetCoap().AddResource(mEnergyScan);
 }
 
@@ -123,6 +124,7 @@ otError EnergyScanClient::SendQuery(uint32_t                           aChannelM
 
     mCallback = aCallback;
     mContext  = aContext;
+    memset(mSummary, 0, sizeof(mSummary));
 
 exit:
 
@@ -149,13 +151,9 @@ void EnergyScanClient::HandleReport(Coap::Header &aHeader, Message &aMessage, co
     ThreadNetif &           netif = GetNetif();
     MeshCoP::ChannelMaskTlv channelMask;
     Ip6::MessageInfo        responseInfo(aMessageInfo);
-
-    OT_TOOL_PACKED_BEGIN
-    struct
-    {
-        MeshCoP::EnergyListTlv tlv;
-        uint8_t                list[OPENTHREAD_CONFIG_MAX_ENERGY_RESULTS];
-    } OT_TOOL_PACKED_END energyList;
+    uint8_t                 energyList[OPENTHREAD_CONFIG_MAX_ENERGY_RESULTS];
+    uint16_t                offset;
+    uint16_t                length;
 
     VerifyOrExit(aHeader.GetType() == OT_COAP_TYPE_CONFIRMABLE && aHeader.GetCode() == OT_COAP_CODE_POST);
 
@@ -164,12 +162,15 @@ void EnergyScanClient::HandleReport(Coap::Header &aHeader, Message &aMessage, co
     SuccessOrExit(MeshCoP::Tlv::GetTlv(aMessage, MeshCoP::Tlv::kChannelMask, sizeof(channelMask), channelMask));
     VerifyOrExit(channelMask.IsValid() && channelMask.GetChannelPage() == OT_RADIO_CHANNEL_PAGE);
 
-    SuccessOrExit(MeshCoP::Tlv::GetTlv(aMessage, MeshCoP::Tlv::kEnergyList, sizeof(energyList), energyList.tlv));
-    VerifyOrExit(energyList.tlv.IsValid());
+    SuccessOrExit(MeshCoP::Tlv::GetValueOffset(aMessage, MeshCoP::Tlv::kEnergyList, offset, length));
+
+    // The summary covers the whole list, the callback gets at most OPENTHREAD_CONFIG_MAX_ENERGY_RESULTS entries.
+    UpdateSummary(channelMask.GetMask(), aMessage, offset, length);
 
     if (mCallback != NULL)
     {
-        mCallback(channelMask.GetMask(), energyList.list, energyList.tlv.GetLength(), mContext);
+        length = aMessage.Read(offset, (length < sizeof(energyList)) ? length : sizeof(energyList), energyList);
+        mCallback(channelMask.GetMask(), energyList, static_cast<uint8_t>(length), mContext);
     }
 
     SuccessOrExit(netif.GetCoap().SendEmptyAck(aHeader, responseInfo));
@@ -180,6 +181,80 @@ exit:
     return;
 }
 
+void EnergyScanClient::UpdateSummary(uint32_t       aChannelMask,
+                                     const Message &aMessage,
+                                     uint16_t       aOffset,
+                                     uint16_t       aLength)
+{
+    uint8_t        channels[kNumChannels];
+    uint8_t        numChannels = 0;
+    uint8_t        index       = 0;
+    Message::Chunk chunk;
+
+    // The list holds one measurement per channel in the mask, lowest channel first, repeated for each scan.
+    for (uint8_t channel = OT_RADIO_CHANNEL_MIN; channel <= OT_RADIO_CHANNEL_MAX; channel++)
+    {
+        if (aChannelMask & (1UL << channel))
+        {
+            channels[numChannels++] = channel - OT_RADIO_CHANNEL_MIN;
+        }
+    }
+
+    VerifyOrExit(numChannels > 0);
+
+    aMessage.GetFirstChunk(aOffset, aLength, chunk);
+
+    while (chunk.mLength > 0)
+    {
+        for (uint16_t i = 0; i < chunk.mLength; i++)
+        {
+            ChannelSummary &summary = mSummary[channels[index]];
+            int8_t          rssi    = static_cast<int8_t>(chunk.mData[i]);
+
+            if (summary.mCount < 0xffff)
+            {
+                if (summary.mCount == 0 || rssi > summary.mMaxRssi)
+                {
+                    summary.mMaxRssi = rssi;
+                }
+
+                summary.mRssiSum += rssi;
+                summary.mCount++;
+            }
+
+            index = (index + 1) % numChannels;
+        }
+
+        aMessage.GetNextChunk(aLength, chunk);
+    }
+
+exit:
+    return;
+}
+
+otError EnergyScanClient::GetSummary(uint8_t aChannel, otEnergyScanChannelSummary &aSummary) const
+{
+    otError error = OT_ERROR_NONE;
+
+    VerifyOrExit(aChannel >= OT_RADIO_CHANNEL_MIN && aChannel <= OT_RADIO_CHANNEL_MAX, error = OT_ERROR_INVALID_ARGS);
+
+    {
+        const ChannelSummary &summary = mSummary[aChannel - OT_RADIO_CHANNEL_MIN];
+
+        memset(&aSummary, 0, sizeof(aSummary));
+        aSummary.mMeasurementCount = summary.mCount;
+
+        if (summary.mCount > 0)
+        {
+            aSummary.mMaxRssi     = summary.mMaxRssi;
+            aSummary.mAverageRssi = static_cast<int8_t>(summary.mRssiSum / summary.mCount);
+        }
+    }
+
+exit:
+    return error;
+}
+
 } // namespace ot
 
 #endif // OPENTHREAD_ENABLE_COMMISSIONER && OPENTHREAD_FTD
@@ -37,6 +37,7 @@
 #include "openthread-core-config.h"
 
 #include <openthread/commissioner.h>
+#include <openthread/platform/radio.h>
 
 #include "coap/coap.hpp"
 #include "common/locator.hpp"
@@ -81,16 +82,44 @@ public:
                       otCommissionerEnergyReportCallback aCallback,
                       void *                             aContext);
 
+    /**
+     * This method gets the per-channel summary of the Energy Reports received since the last Energy Scan Query.
+     *
+     * @param[in]   aChannel  The channel.
+     * @param[out]  aSummary  A reference to where the channel summary is placed.
+     *
+     * @retval OT_ERROR_NONE          Successfully retrieved the channel summary.
+     * @retval OT_ERROR_INVALID_ARGS  @p aChannel is not a supported channel.
+     *
+     */
+    otError GetSummary(uint8_t aChannel, otEnergyScanChannelSummary &aSummary) const;
+
 private:
+    enum
+    {
+        kNumChannels = OT_RADIO_CHANNEL_MAX - OT_RADIO_CHANNEL_MIN + 1,
+    };
+
+    struct ChannelSummary
+    {
+        int32_t  mRssiSum;
+        uint16_t mCount;
+        int8_t   mMaxRssi;
+    };
+
     static void HandleReport(void *               aContext,
                              otCoapHeader *       aHeader,
                              otMessage *          aMessage,
                              const otMessageInfo *aMessageInfo);
     void        HandleReport(Coap::Header &aHeader, Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
 
+    void UpdateSummary(uint32_t aChannelMask, const Message &aMessage, uint16_t aOffset, uint16_t aLength);
+
     otCommissionerEnergyReportCallback mCallback;
     void *                             mContext;
 
+    ChannelSummary mSummary[kNumChannels];
+
     Coap::Resource mEnergyScan;
 };
 
@@ -107,11 +107,8 @@ otError Joiner::Start(const char *     aPSKd,
     netif.GetMac().SetExtAddress(joinerId);
     netif.GetMle().UpdateLinkLocalAddress();
 
-    for (size_t i = 0; i < sizeof(joinerId); i++)
-    {
-        ccitt.Update(joinerId.m8[i]);
-        ansi.Update(joinerId.m8[i]);
-    }
+    ccitt.Update(joinerId.m8, sizeof(joinerId.m8));
+    ansi.Update(joinerId.m8, sizeof(joinerId.m8));
 
     mCcitt = ccitt.Get();
     mAnsi  = ansi.Get();
@@ -61,11 +61,18 @@ JoinerRouter::JoinerRouter(Instance &aInstance)
     , mSocket(aInstance.GetThreadNetif().GetIp6().GetUdp())
     , mRelayTransmit(OT_URI_PATH_RELAY_TX, &JoinerRouter::HandleRelayTransmit, this)
     , mTimer(aInstance, &JoinerRouter::HandleTimer, this)
-    , mNotifierCallback(&JoinerRouter::HandleStateChanged, this)
+    , mNotifierCallback(&JoinerRouter::HandleStateChanged, this, OT_CHANGED_THREAD_NETDATA)
     , mJoinerUdpPort(0)
     , mIsJoinerPortConfigured(false)
     , mExpectJoinEntRsp(false)
+#if OPENTHREAD_CONFIG_JOINER_ROUTER_RELAY_COALESCE_DELAY
+    , mRelayRxTimer(aInstance, &JoinerRouter::HandleRelayRxTimer, this)
+    , mPendingRelayRx(NULL)
+    , mPendingRelayRxTlvOffset(0)
+    , mPendingRelayRxPort(0)
+#endif
 {
+    ResetCounters();
     GetNetif().GetCoap().AddResource(mRelayTransmit);
     aInstance.GetNotifier().RegisterCallback(mNotifierCallback);
 }
@@ -137,21 +144,72 @@ void JoinerRouter::HandleUdpReceive(void *aContext, otMessage *aMessage, const o
 }
 
 void JoinerRouter::HandleUdpReceive(Message &aMessage, const Ip6::MessageInfo &aMessageInfo)
+{
+    otError  error   = OT_ERROR_NONE;
+    Message *message = NULL;
+    uint16_t tlvOffset;
+
+    otLogInfoMeshCoP("JoinerRouter::HandleUdpReceive");
+
+    mCounters.mRelayRxDatagrams++;
+
+#if OPENTHREAD_CONFIG_JOINER_ROUTER_RELAY_COALESCE_DELAY
+    if (mPendingRelayRx != NULL)
+    {
+        uint16_t pendingLength = mPendingRelayRx->GetLength() - mPendingRelayRxTlvOffset - sizeof(ExtendedTlv);
+
+        // DTLS allows several records in one datagram, so consecutive datagrams from the same joiner are merged.
+        if (mPendingRelayRxPort == aMessageInfo.GetPeerPort() &&
+            memcmp(mPendingRelayRxIid, aMessageInfo.GetPeerAddr().mFields.m8 + 8, sizeof(mPendingRelayRxIid)) == 0 &&
+            pendingLength + aMessage.GetLength() - aMessage.GetOffset() <= kRelayCoalesceMaxLength)
+        {
+            ExitNow(error = AppendRelayRxPayload(*mPendingRelayRx, mPendingRelayRxTlvOffset, aMessage));
+        }
+
+        SendPendingRelayRx();
+    }
+#endif
+
+    VerifyOrExit((message = NewRelayRx(aMessageInfo, tlvOffset)) != NULL, error = OT_ERROR_NO_BUFS);
+    SuccessOrExit(error = AppendRelayRxPayload(*message, tlvOffset, aMessage));
+
+#if OPENTHREAD_CONFIG_JOINER_ROUTER_RELAY_COALESCE_DELAY
+    if (aMessage.GetLength() - aMessage.GetOffset() < kRelayCoalesceMaxLength)
+    {
+        mPendingRelayRx          = message;
+        mPendingRelayRxTlvOffset = tlvOffset;
+        mPendingRelayRxPort      = aMessageInfo.GetPeerPort();
+        memcpy(mPendingRelayRxIid, aMessageInfo.GetPeerAddr().mFields.m8 + 8, sizeof(mPendingRelayRxIid));
+        mRelayRxTimer.Start(OPENTHREAD_CONFIG_JOINER_ROUTER_RELAY_COALESCE_DELAY);
+        ExitNow();
+    }
+#endif
+
+    SuccessOrExit(error = SendRelayRx(*message));
+
+exit:
+
+    if (error != OT_ERROR_NONE)
+    {
+        mCounters.mDropped++;
+
+        if (message != NULL)
+        {
+            message->Free();
+        }
+    }
+}
+
+Message *JoinerRouter::NewRelayRx(const Ip6::MessageInfo &aMessageInfo, uint16_t &aTlvOffset)
 {
     ThreadNetif &          netif = GetNetif();
     otError                error;
     Message *              message = NULL;
     Coap::Header           header;
-    Ip6::MessageInfo       messageInfo;
     JoinerUdpPortTlv       udpPort;
     JoinerIidTlv           iid;
     JoinerRouterLocatorTlv rloc;
     ExtendedTlv            tlv;
-    uint16_t               borderAgentRloc;
-
-    otLogInfoMeshCoP("JoinerRouter::HandleUdpReceive");
-
-    SuccessOrExit(error = GetBorderAgentRloc(GetNetif(), borderAgentRloc));
 
     header.Init(OT_COAP_TYPE_NON_CONFIRMABLE, OT_COAP_CODE_POST);
     header.SetToken(Coap::Header::kDefaultTokenLength);
@@ -172,42 +230,88 @@ void JoinerRouter::HandleUdpReceive(Message &aMessage, const Ip6::MessageInfo &a
     rloc.SetJoinerRouterLocator(netif.GetMle().GetRloc16());
     SuccessOrExit(error = message->Append(&rloc, sizeof(rloc)));
 
+    aTlvOffset = message->GetLength();
     tlv.SetType(Tlv::kJoinerDtlsEncapsulation);
-    tlv.SetLength(aMessage.GetLength() - aMessage.GetOffset());
+    tlv.SetLength(0);
     SuccessOrExit(error = message->Append(&tlv, sizeof(tlv)));
 
-    while (aMessage.GetOffset() < aMessage.GetLength())
+exit:
+
+    if (error != OT_ERROR_NONE && message != NULL)
     {
-        uint16_t length = aMessage.GetLength() - aMessage.GetOffset();
-        uint8_t  tmp[16];
+        message->Free();
+        message = NULL;
+    }
 
-        if (length >= sizeof(tmp))
-        {
-            length = sizeof(tmp);
-        }
+    return message;
+}
 
-        aMessage.Read(aMessage.GetOffset(), length, tmp);
-        aMessage.MoveOffset(length);
+otError JoinerRouter::AppendRelayRxPayload(Message &aRelayRx, uint16_t aTlvOffset, const Message &aMessage)
+{
+    otError     error;
+    uint16_t    length = aMessage.GetLength() - aMessage.GetOffset();
+    uint16_t    start  = aRelayRx.GetLength();
+    ExtendedTlv tlv;
 
-        SuccessOrExit(error = message->Append(tmp, length));
-    }
+    SuccessOrExit(error = aRelayRx.SetLength(start + length));
+    aMessage.CopyTo(aMessage.GetOffset(), start, length, aRelayRx);
+
+    aRelayRx.Read(aTlvOffset, sizeof(tlv), &tlv);
+    tlv.SetLength(tlv.GetLength() + length);
+    aRelayRx.Write(aTlvOffset, sizeof(tlv), &tlv);
+
+exit:
+    return error;
+}
+
+otError JoinerRouter::SendRelayRx(Message &aRelayRx)
+{
+    ThreadNetif &    netif = GetNetif();
+    otError          error;
+    Ip6::MessageInfo messageInfo;
+    uint16_t         borderAgentRloc;
+
+    SuccessOrExit(error = GetBorderAgentRloc(netif, borderAgentRloc));
 
     messageInfo.SetSockAddr(netif.GetMle().GetMeshLocal16());
     messageInfo.SetPeerAddr(netif.GetMle().GetMeshLocal16());
     messageInfo.GetPeerAddr().mFields.m16[7] = HostSwap16(borderAgentRloc);
     messageInfo.SetPeerPort(kCoapUdpPort);
 
-    SuccessOrExit(error = netif.GetCoap().SendMessage(*message, messageInfo));
+    SuccessOrExit(error = netif.GetCoap().SendMessage(aRelayRx, messageInfo));
 
+    mCounters.mRelayRxMessages++;
     otLogInfoMeshCoP("Sent relay rx");
 
 exit:
+    return error;
+}
 
-    if (error != OT_ERROR_NONE && message != NULL)
+#if OPENTHREAD_CONFIG_JOINER_ROUTER_RELAY_COALESCE_DELAY
+void JoinerRouter::HandleRelayRxTimer(Timer &aTimer)
+{
+    aTimer.GetOwner<JoinerRouter>().SendPendingRelayRx();
+}
+
+void JoinerRouter::SendPendingRelayRx(void)
+{
+    Message *message = mPendingRelayRx;
+
+    mPendingRelayRx = NULL;
+    mRelayRxTimer.Stop();
+
+    VerifyOrExit(message != NULL);
+
+    if (SendRelayRx(*message) != OT_ERROR_NONE)
     {
+        mCounters.mDropped++;
         message->Free();
     }
+
+exit:
+    return;
 }
+#endif // OPENTHREAD_CONFIG_JOINER_ROUTER_RELAY_COALESCE_DELAY
 
 void JoinerRouter::HandleRelayTransmit(void *               aContext,
                                        otCoapHeader *       aHeader,
@@ -228,7 +332,7 @@ void JoinerRouter::HandleRelayTransmit(Coap::Header &aHeader, Message &aMessage,
     uint16_t           offset;
     uint16_t           length;
     Message *          message  = NULL;
-    otMessageSettings  settings = {false, static_cast<otMessagePriority>(kMeshCoPMessagePriority)};
+    otMessageSettings  settings = {false, static_cast<otMessagePriority>(kMeshCoPMessagePriority), 0};
     Ip6::MessageInfo   messageInfo;
 
     VerifyOrExit(aHeader.GetType() == OT_COAP_TYPE_NON_CONFIRMABLE && aHeader.GetCode() == OT_COAP_CODE_POST,
@@ -272,6 +376,8 @@ void JoinerRouter::HandleRelayTransmit(Coap::Header &aHeader, Message &aMessage,
 
     SuccessOrExit(error = mSocket.SendTo(*message, messageInfo));
 
+    mCounters.mRelayTxMessages++;
+
     if (Tlv::GetTlv(aMessage, Tlv::kJoinerRouterKek, sizeof(kek), kek) == OT_ERROR_NONE)
     {
         otLogInfoMeshCoP("Received kek");
@@ -282,9 +388,14 @@ void JoinerRouter::HandleRelayTransmit(Coap::Header &aHeader, Message &aMessage,
 exit:
     OT_UNUSED_VARIABLE(aMessageInfo);
 
-    if (error != OT_ERROR_NONE && message != NULL)
+    if (error != OT_ERROR_NONE)
     {
-        message->Free();
+        mCounters.mDropped++;
+
+        if (message != NULL)
+        {
+            message->Free();
+        }
     }
 }
 
@@ -469,6 +580,7 @@ otError JoinerRouter::SendJoinerEntrust(Message &aMessage, const Ip6::MessageInf
     otLogInfoMeshCoP("Sent joiner entrust length = %d", aMessage.GetLength());
     otLogCertMeshCoP("[THCI] direction=send | type=JOIN_ENT.ntf");
 
+    mCounters.mJoinerEntrusts++;
     mExpectJoinEntRsp = true;
 
 exit:
@@ -36,6 +36,8 @@
 
 #include "openthread-core-config.h"
 
+#include <openthread/thread_ftd.h>
+
 #include "coap/coap.hpp"
 #include "coap/coap_header.hpp"
 #include "common/locator.hpp"
@@ -80,10 +82,25 @@ public:
      */
     otError SetJoinerUdpPort(uint16_t aJoinerUdpPort);
 
+    /**
+     * This method returns the relay counters.
+     *
+     * @returns A reference to the relay counters.
+     *
+     */
+    const otJoinerRouterCounters &GetCounters(void) const { return mCounters; }
+
+    /**
+     * This method resets the relay counters.
+     *
+     */
+    void ResetCounters(void) { memset(&mCounters, 0, sizeof(mCounters)); }
+
 private:
     enum
     {
-        kDelayJoinEnt = 50, ///< milliseconds
+        kDelayJoinEnt           = 50,  ///< milliseconds
+        kRelayCoalesceMaxLength = 256, ///< Maximum DTLS payload carried by a coalesced RLY_RX.ntf (bytes)
     };
 
     static void HandleStateChanged(Notifier::Callback &aCallback, otChangedFlags aFlags);
@@ -92,6 +109,15 @@ private:
     static void HandleUdpReceive(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo);
     void        HandleUdpReceive(Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
 
+    Message *NewRelayRx(const Ip6::MessageInfo &aMessageInfo, uint16_t &aTlvOffset);
+    otError  AppendRelayRxPayload(Message &aRelayRx, uint16_t aTlvOffset, const Message &aMessage);
+    otError  SendRelayRx(Message &aRelayRx);
+
+#if OPENTHREAD_CONFIG_JOINER_ROUTER_RELAY_COALESCE_DELAY
+    static void HandleRelayRxTimer(Timer &aTimer);
+    void        SendPendingRelayRx(void);
+#endif
+
     static void HandleRelayTransmit(void *               aContext,
                                     otCoapHeader *       aHeader,
                                     otMessage *          aMessage,
@@ -127,6 +153,16 @@ private:
 
     bool mIsJoinerPortConfigured : 1;
     bool mExpectJoinEntRsp : 1;
+
+#if OPENTHREAD_CONFIG_JOINER_ROUTER_RELAY_COALESCE_DELAY
+    TimerMilli mRelayRxTimer;
+    Message *  mPendingRelayRx;
+    uint16_t   mPendingRelayRxTlvOffset;
+    uint16_t   mPendingRelayRxPort;
+    uint8_t    mPendingRelayRxIid[8];
+#endif
+
+    otJoinerRouterCounters mCounters;
 };
 
 /**
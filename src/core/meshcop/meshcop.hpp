@@ -57,7 +57,7 @@ enum
  */
 inline Message *NewMeshCoPMessage(Coap::CoapBase &aCoap, const Coap::Header &aHeader)
 {
-    otMessageSettings settings = {true, static_cast<otMessagePriority>(kMeshCoPMessagePriority)};
+    otMessageSettings settings = {true, static_cast<otMessagePriority>(kMeshCoPMessagePriority), 0};
     return aCoap.NewMessage(aHeader, &settings);
 }
 
@@ -60,8 +60,14 @@ Dhcp6Server::Dhcp6Server(Instance &aInstance)
         memset(&mAgentsAloc[i], 0, sizeof(mAgentsAloc[i]));
     }
 
-    mPrefixAgentsCount = 0;
-    mPrefixAgentsMask  = 0;
+    mPrefixAgentsCount     = 0;
+    mPrefixAgentsMask      = 0;
+    mPrefixAgentsValidMask = 0;
+    memset(&mCounters, 0, sizeof(mCounters));
+
+#if OPENTHREAD_CONFIG_DHCP6_SERVER_NUM_BINDINGS
+    memset(mBindings, 0, sizeof(mBindings));
+#endif
 }
 
 otError Dhcp6Server::UpdateService(void)
@@ -201,6 +207,11 @@ otError Dhcp6Server::Start(void)
 otError Dhcp6Server::Stop(void)
 {
     mSocket.Close();
+
+#if OPENTHREAD_CONFIG_DHCP6_SERVER_NUM_BINDINGS
+    memset(mBindings, 0, sizeof(mBindings));
+#endif
+
     return OT_ERROR_NONE;
 }
 
@@ -216,6 +227,7 @@ otError Dhcp6Server::AddPrefixAgent(otIp6Prefix &aIp6Prefix)
         }
 
         mPrefixAgents[i].SetPrefix(aIp6Prefix);
+        mPrefixAgentsValidMask |= (1 << i);
         mPrefixAgentsCount++;
         ExitNow(error = OT_ERROR_NONE);
     }
@@ -242,7 +254,11 @@ otError Dhcp6Server::RemovePrefixAgent(const uint8_t *aIp6Address)
             prefix->mLength)
         {
             memset(&(mPrefixAgents[i]), 0, sizeof(PrefixAgent));
+            mPrefixAgentsValidMask &= ~(1 << i);
             mPrefixAgentsCount--;
+#if OPENTHREAD_CONFIG_DHCP6_SERVER_NUM_BINDINGS
+            ClearBindings(static_cast<uint8_t>(1 << i));
+#endif
             ExitNow(error = OT_ERROR_NONE);
         }
     }
@@ -276,36 +292,107 @@ exit:
 
 void Dhcp6Server::ProcessSolicit(Message &aMessage, otIp6Address &aDst, uint8_t *aTransactionId)
 {
+    otError          error = OT_ERROR_NONE;
     IaNa             iana;
     ClientIdentifier clientIdentifier;
-    uint16_t         optionOffset;
-    uint16_t         offset = aMessage.GetOffset();
-    uint16_t         length = aMessage.GetLength() - aMessage.GetOffset();
+    Dhcp6Option      option;
+    uint16_t         clientIdentifierOffset = 0;
+    uint16_t         elapsedTimeOffset      = 0;
+    uint16_t         iaNaOffset             = 0;
+    bool             hasServerIdentifier    = false;
+    bool             hasRapidCommit         = false;
+    bool             renewed                = false;
+    uint16_t         offset                 = aMessage.GetOffset();
+    uint16_t         end                    = aMessage.GetLength();
+
+    mCounters.mSolicits++;
+
+    // locate all options of interest in a single pass
+    while (offset + sizeof(option) <= end)
+    {
+        VerifyOrExit(aMessage.Read(offset, sizeof(option), &option) == sizeof(option), error = OT_ERROR_PARSE);
+        VerifyOrExit(option.GetLength() <= end - offset - sizeof(option), error = OT_ERROR_PARSE);
+
+        switch (option.GetCode())
+        {
+        case kOptionClientIdentifier:
+            clientIdentifierOffset = (clientIdentifierOffset == 0) ? offset : clientIdentifierOffset;
+            break;
+
+        case kOptionServerIdentifier:
+            hasServerIdentifier = true;
+            break;
+
+        case kOptionRapidCommit:
+            hasRapidCommit = true;
+            break;
+
+        case kOptionElapsedTime:
+            elapsedTimeOffset = (elapsedTimeOffset == 0) ? offset : elapsedTimeOffset;
+            break;
+
+        case kOptionIaNa:
+            iaNaOffset = (iaNaOffset == 0) ? offset : iaNaOffset;
+            break;
+
+        default:
+            break;
+        }
+
+        offset += sizeof(option) + option.GetLength();
+    }
 
     // Client Identifier (discard if not present)
-    VerifyOrExit((optionOffset = FindOption(aMessage, offset, length, kOptionClientIdentifier)) > 0);
-    SuccessOrExit(ProcessClientIdentifier(aMessage, optionOffset, clientIdentifier));
+    VerifyOrExit(clientIdentifierOffset > 0, error = OT_ERROR_PARSE);
+    SuccessOrExit(error = ProcessClientIdentifier(aMessage, clientIdentifierOffset, clientIdentifier));
 
     // Server Identifier (assuming Rapid Commit, discard if present)
-    VerifyOrExit(FindOption(aMessage, offset, length, kOptionServerIdentifier) == 0);
+    VerifyOrExit(!hasServerIdentifier, error = OT_ERROR_PARSE);
 
     // Rapid Commit (assuming Rapid Commit, discard if not present)
-    VerifyOrExit(FindOption(aMessage, offset, length, kOptionRapidCommit) > 0);
+    VerifyOrExit(hasRapidCommit, error = OT_ERROR_PARSE);
 
     // Elapsed Time if present
-    if ((optionOffset = FindOption(aMessage, offset, length, kOptionElapsedTime)) > 0)
+    if (elapsedTimeOffset > 0)
     {
-        SuccessOrExit(ProcessElapsedTime(aMessage, optionOffset));
+        SuccessOrExit(error = ProcessElapsedTime(aMessage, elapsedTimeOffset));
     }
 
     // IA_NA (discard if not present)
-    VerifyOrExit((optionOffset = FindOption(aMessage, offset, length, kOptionIaNa)) > 0);
-    SuccessOrExit(ProcessIaNa(aMessage, optionOffset, iana));
+    VerifyOrExit(iaNaOffset > 0, error = OT_ERROR_PARSE);
+    SuccessOrExit(error = ProcessIaNa(aMessage, iaNaOffset, iana));
+
+    // if no known prefix is requested, lease all configured prefixes
+    if (mPrefixAgentsMask == 0)
+    {
+        mPrefixAgentsMask = mPrefixAgentsValidMask;
+    }
+
+    // a failure to send is not a malformed request, so it is not counted as a discard
+    VerifyOrExit(SendReply(aDst, aTransactionId, clientIdentifier, iana) == OT_ERROR_NONE);
+
+#if OPENTHREAD_CONFIG_DHCP6_SERVER_NUM_BINDINGS
+    renewed = UpdateBinding(*reinterpret_cast<const Mac::ExtAddress *>(clientIdentifier.GetDuidLinkLayerAddress()),
+                            mPrefixAgentsMask);
+#endif
+
+    mCounters.mReplies++;
 
-    SuccessOrExit(SendReply(aDst, aTransactionId, clientIdentifier, iana));
+    if (renewed)
+    {
+        mCounters.mRenewedLeases++;
+    }
+    else
+    {
+        mCounters.mNewLeases++;
+    }
 
 exit:
-    return;
+
+    if (error != OT_ERROR_NONE)
+    {
+        mCounters.mDiscards++;
+    }
 }
 
 uint16_t Dhcp6Server::FindOption(Message &aMessage, uint16_t aOffset, uint16_t aLength, Code aCode)
@@ -329,6 +416,24 @@ uint16_t Dhcp6Server::FindOption(Message &aMessage, uint16_t aOffset, uint16_t a
 exit:
     return rval;
 }
+
+uint8_t Dhcp6Server::GetPrefixAgentIndex(const otIp6Address &aAddress) const
+{
+    uint8_t i;
+
+    for (i = 0; i < OPENTHREAD_CONFIG_NUM_DHCP_PREFIXES; i++)
+    {
+        const otIp6Prefix &prefix = *mPrefixAgents[i].GetPrefix();
+
+        if ((mPrefixAgentsValidMask & (1 << i)) && (otIp6PrefixMatch(&aAddress, &prefix.mPrefix) >= prefix.mLength))
+        {
+            break;
+        }
+    }
+
+    return i;
+}
+
 otError Dhcp6Server::ProcessClientIdentifier(Message &aMessage, uint16_t aOffset, ClientIdentifier &aClient)
 {
     otError error = OT_ERROR_NONE;
@@ -383,29 +488,18 @@ exit:
 
 otError Dhcp6Server::ProcessIaAddress(Message &aMessage, uint16_t aOffset)
 {
-    otError      error  = OT_ERROR_NONE;
-    otIp6Prefix *prefix = NULL;
-    IaAddress    option;
+    otError   error = OT_ERROR_NONE;
+    uint8_t   index;
+    IaAddress option;
 
     VerifyOrExit(((aMessage.Read(aOffset, sizeof(option), &option) == sizeof(option)) &&
                   option.GetLength() == (sizeof(option) - sizeof(Dhcp6Option))),
                  error = OT_ERROR_PARSE);
 
     // mask matching prefix
-    for (uint8_t i = 0; i < OPENTHREAD_CONFIG_NUM_DHCP_PREFIXES; i++)
+    if ((index = GetPrefixAgentIndex(*option.GetAddress())) < OPENTHREAD_CONFIG_NUM_DHCP_PREFIXES)
     {
-        prefix = mPrefixAgents[i].GetPrefix();
-
-        if (prefix->mLength == 0)
-        {
-            continue;
-        }
-
-        if (otIp6PrefixMatch(option.GetAddress(), &(prefix->mPrefix)) >= prefix->mLength)
-        {
-            mPrefixAgentsMask |= (1 << i);
-            break;
-        }
+        mPrefixAgentsMask |= (1 << index);
     }
 
 exit:
@@ -476,19 +570,9 @@ otError Dhcp6Server::AppendIaNa(Message &aMessage, IaNa &aIaNa)
     otError  error  = OT_ERROR_NONE;
     uint16_t length = 0;
 
-    if (mPrefixAgentsMask)
+    for (uint8_t mask = mPrefixAgentsMask; mask != 0; mask &= (mask - 1))
     {
-        for (uint8_t i = 0; i < OPENTHREAD_CONFIG_NUM_DHCP_PREFIXES; i++)
-        {
-            if ((mPrefixAgentsMask & (1 << i)))
-            {
-                length += sizeof(IaAddress);
-            }
-        }
-    }
-    else
-    {
-        length += sizeof(IaAddress) * mPrefixAgentsCount;
+        length += sizeof(IaAddress);
     }
 
     length += sizeof(IaNa) + sizeof(StatusCode) - sizeof(Dhcp6Option);
@@ -513,33 +597,14 @@ otError Dhcp6Server::AppendStatusCode(Message &aMessage, Status aStatus)
 
 otError Dhcp6Server::AppendIaAddress(Message &aMessage, ClientIdentifier &aClient)
 {
-    otError      error  = OT_ERROR_NONE;
-    otIp6Prefix *prefix = NULL;
+    otError error = OT_ERROR_NONE;
 
-    // if specified, only apply specified prefixes
-    if (mPrefixAgentsMask)
-    {
-        for (uint8_t i = 0; i < OPENTHREAD_CONFIG_NUM_DHCP_PREFIXES; i++)
-        {
-            if (mPrefixAgentsMask & (1 << i))
-            {
-                prefix = mPrefixAgents[i].GetPrefix();
-                SuccessOrExit(error = AddIaAddress(aMessage, *prefix, aClient));
-            }
-        }
-    }
-    else // if not specified, apply all configured prefixes
+    // `mPrefixAgentsMask` holds either the requested prefixes or all configured ones
+    for (uint8_t i = 0; i < OPENTHREAD_CONFIG_NUM_DHCP_PREFIXES; i++)
     {
-        for (uint8_t i = 0; i < OPENTHREAD_CONFIG_NUM_DHCP_PREFIXES; i++)
+        if (mPrefixAgentsMask & (1 << i))
         {
-            prefix = mPrefixAgents[i].GetPrefix();
-
-            if (prefix->mLength == 0)
-            {
-                continue;
-            }
-
-            SuccessOrExit(error = AddIaAddress(aMessage, *prefix, aClient));
+            SuccessOrExit(error = AddIaAddress(aMessage, *mPrefixAgents[i].GetPrefix(), aClient));
         }
     }
 
@@ -571,6 +636,68 @@ otError Dhcp6Server::AppendRapidCommit(Message &aMessage)
     return aMessage.Append(&option, sizeof(option));
 }
 
+#if OPENTHREAD_CONFIG_DHCP6_SERVER_NUM_BINDINGS
+
+uint16_t Dhcp6Server::GetBindingIndex(const Mac::ExtAddress &aClient)
+{
+    uint8_t hash = 0;
+
+    for (uint8_t i = 0; i < sizeof(aClient.m8); i++)
+    {
+        hash ^= aClient.m8[i];
+    }
+
+    return hash % OPENTHREAD_CONFIG_DHCP6_SERVER_NUM_BINDINGS;
+}
+
+bool Dhcp6Server::UpdateBinding(const Mac::ExtAddress &aClient, uint8_t aPrefixMask)
+{
+    uint16_t home    = GetBindingIndex(aClient);
+    Binding *entry   = NULL;
+    bool     renewed = false;
+
+    // Open addressing with linear probing. Entries are only reused, never removed, so probe sequences stay intact.
+    for (uint16_t i = 0; i < OPENTHREAD_CONFIG_DHCP6_SERVER_NUM_BINDINGS; i++)
+    {
+        Binding &binding = mBindings[(home + i) % OPENTHREAD_CONFIG_DHCP6_SERVER_NUM_BINDINGS];
+
+        if (!binding.mValid)
+        {
+            entry = &binding;
+            break;
+        }
+
+        if (binding.mClient == aClient)
+        {
+            renewed = (binding.mPrefixMask == aPrefixMask);
+            entry   = &binding;
+            break;
+        }
+    }
+
+    // table is full, evict the client occupying the home slot
+    if (entry == NULL)
+    {
+        entry = &mBindings[home];
+    }
+
+    entry->mClient     = aClient;
+    entry->mPrefixMask = aPrefixMask;
+    entry->mValid      = true;
+
+    return renewed;
+}
+
+void Dhcp6Server::ClearBindings(uint8_t aPrefixMask)
+{
+    for (uint16_t i = 0; i < OPENTHREAD_CONFIG_DHCP6_SERVER_NUM_BINDINGS; i++)
+    {
+        mBindings[i].mPrefixMask &= ~aPrefixMask;
+    }
+}
+
+#endif // OPENTHREAD_CONFIG_DHCP6_SERVER_NUM_BINDINGS
+
 } // namespace Dhcp6
 } // namespace ot
 
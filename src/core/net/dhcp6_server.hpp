@@ -36,6 +36,8 @@
 
 #include "openthread-core-config.h"
 
+#include <openthread/dhcp6_server.h>
+
 #include "common/locator.hpp"
 #include "mac/mac.hpp"
 #include "mac/mac_frame.hpp"
@@ -83,6 +85,14 @@ public:
      */
     otIp6Prefix *GetPrefix(void) { return &mIp6Prefix; }
 
+    /**
+     * This method returns the reference to the IPv6 prefix.
+     *
+     * @returns A reference to the IPv6 prefix.
+     *
+     */
+    const otIp6Prefix *GetPrefix(void) const { return &mIp6Prefix; }
+
     /**
      * This method sets the IPv6 prefix.
      *
@@ -112,7 +122,39 @@ public:
      */
     otError UpdateService();
 
+    /**
+     * This method returns the DHCPv6 server counters.
+     *
+     * @returns A reference to the DHCPv6 server counters.
+     *
+     */
+    const otDhcp6ServerCounters &GetCounters(void) const { return mCounters; }
+
+    /**
+     * This method resets the DHCPv6 server counters.
+     *
+     */
+    void ResetCounters(void) { memset(&mCounters, 0, sizeof(mCounters)); }
+
 private:
+#if OPENTHREAD_CONFIG_DHCP6_SERVER_NUM_BINDINGS
+    /**
+     * This structure represents a client binding, i.e. the prefixes leased to a client identified by its DUID-LL.
+     *
+     */
+    struct Binding
+    {
+        Mac::ExtAddress mClient;     ///< The EUI-64 carried in the client's DUID-LL.
+        uint8_t         mPrefixMask; ///< The prefix agents leased to the client (bit index into `mPrefixAgents`).
+        bool            mValid;      ///< Whether the entry is in use.
+    };
+
+    bool            UpdateBinding(const Mac::ExtAddress &aClient, uint8_t aPrefixMask);
+    void            ClearBindings(uint8_t aPrefixMask);
+    static uint16_t GetBindingIndex(const Mac::ExtAddress &aClient);
+#endif
+
+
     otError Start(void);
     otError Stop(void);
 
@@ -136,6 +178,7 @@ private:
     void ProcessSolicit(Message &aMessage, otIp6Address &aDst, uint8_t *aTransactionId);
 
     uint16_t FindOption(Message &aMessage, uint16_t aOffset, uint16_t aLength, Code aCode);
+    uint8_t  GetPrefixAgentIndex(const otIp6Address &aAddress) const;
     otError  ProcessClientIdentifier(Message &aMessage, uint16_t aOffset, ClientIdentifier &aClient);
     otError  ProcessIaNa(Message &aMessage, uint16_t aOffset, IaNa &aIaNa);
     otError  ProcessIaAddress(Message &aMessage, uint16_t aOffset);
@@ -148,7 +191,13 @@ private:
     Ip6::NetifUnicastAddress mAgentsAloc[OPENTHREAD_CONFIG_NUM_DHCP_PREFIXES];
     PrefixAgent              mPrefixAgents[OPENTHREAD_CONFIG_NUM_DHCP_PREFIXES];
     uint8_t                  mPrefixAgentsMask;
+    uint8_t                  mPrefixAgentsValidMask;
     uint8_t                  mPrefixAgentsCount;
+    otDhcp6ServerCounters    mCounters;
+
+#if OPENTHREAD_CONFIG_DHCP6_SERVER_NUM_BINDINGS
+    Binding mBindings[OPENTHREAD_CONFIG_DHCP6_SERVER_NUM_BINDINGS];
+#endif
 };
 
 } // namespace Dhcp6
@@ -92,6 +92,10 @@ otError Client::Query(const otDnsQuery *aQuery, otDnsResponseHandler aHandler, v
 
     VerifyOrExit(aQuery->mHostname != NULL && aQuery->mMessageInfo != NULL, error = OT_ERROR_INVALID_ARGS);
 
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENTRIES
+    VerifyOrExit(!ResolveFromCache(aQuery->mHostname, aHandler, aContext), error = OT_ERROR_NONE);
+#endif
+
     header.SetMessageId(mMessageId++);
     header.SetType(Header::kTypeQuery);
     header.SetQueryType(Header::kQueryTypeStandard);
@@ -380,6 +384,115 @@ void Client::FinalizeDnsTransaction(Message &            aQuery,
     }
 }
 
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENTRIES
+Client::CacheEntry *Client::FindCacheEntry(const char *aHostname)
+{
+    CacheEntry *entry = NULL;
+
+    for (uint8_t i = 0; i < kCacheEntries; i++)
+    {
+        const char *cached = mCache[i].mHostname;
+        const char *name   = aHostname;
+
+        // Hostnames are compared case-insensitively (ASCII only).
+        while (*cached != '\0' && (*cached | 0x20) == (*name | 0x20))
+        {
+            cached++;
+            name++;
+        }
+
+        if (mCache[i].mHostname[0] != '\0' && *cached == '\0' && *name == '\0')
+        {
+            ExitNow(entry = &mCache[i]);
+        }
+    }
+
+exit:
+    return entry;
+}
+
+bool Client::ResolveFromCache(const char *aHostname, otDnsResponseHandler aHandler, void *aContext)
+{
+    uint32_t     now   = TimerMilli::GetNow();
+    CacheEntry * entry = FindCacheEntry(aHostname);
+    otIp6Address address;
+    uint32_t     ttl;
+
+    VerifyOrExit(entry != NULL);
+
+    if (static_cast<int32_t>(entry->mExpireTime - now) <= 0)
+    {
+        // The entry has expired.
+        entry->mHostname[0] = '\0';
+        ExitNow(entry = NULL);
+    }
+
+    if (aHandler != NULL)
+    {
+        if (entry->mResult == OT_ERROR_NONE)
+        {
+            address = entry->mAddress;
+            ttl     = (entry->mExpireTime - now + 999) / 1000;
+            aHandler(aContext, aHostname, &address, ttl, OT_ERROR_NONE);
+        }
+        else
+        {
+            aHandler(aContext, aHostname, NULL, 0, entry->mResult);
+        }
+    }
+
+exit:
+    return (entry != NULL);
+}
+
+void Client::UpdateCache(const char *aHostname, const otIp6Address *aAddress, uint32_t aTtl, otError aResult)
+{
+    uint32_t    now   = TimerMilli::GetNow();
+    CacheEntry *entry = FindCacheEntry(aHostname);
+
+    VerifyOrExit(strlen(aHostname) <= kCacheMaxHostnameLength);
+
+    if (aTtl == 0)
+    {
+        // A zero TTL indicates the answer must not be cached.
+        if (entry != NULL)
+        {
+            entry->mHostname[0] = '\0';
+        }
+
+        ExitNow();
+    }
+
+    if (entry == NULL)
+    {
+        // Use an unused entry, or else replace the entry expiring first.
+        entry = &mCache[0];
+
+        for (uint8_t i = 0; i < kCacheEntries && entry->mHostname[0] != '\0'; i++)
+        {
+            if (mCache[i].mHostname[0] == '\0' ||
+                static_cast<int32_t>(mCache[i].mExpireTime - entry->mExpireTime) < 0)
+            {
+                entry = &mCache[i];
+            }
+        }
+
+        strcpy(entry->mHostname, aHostname);
+    }
+
+    if (aAddress != NULL)
+    {
+        entry->mAddress = *aAddress;
+    }
+
+    entry->mResult     = aResult;
+    entry->mExpireTime = now + TimerMilli::SecToMsec(aTtl < kCacheMaxTtl ? aTtl : static_cast<uint32_t>(kCacheMaxTtl));
+
+exit:
+    return;
+}
+#endif // OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENTRIES
+
 void Client::HandleRetransmissionTimer(Timer &aTimer)
 {
     aTimer.GetOwner<Client>().HandleRetransmissionTimer();
@@ -471,11 +584,21 @@ void Client::HandleUdpReceive(Message &aMessage, const Ip6::MessageInfo &aMessag
 
     VerifyOrExit((message = FindRelatedQuery(responseHeader, queryMetadata)) != NULL);
 
-    VerifyOrExit(responseHeader.GetResponseCode() == Header::kResponseSuccess, error = OT_ERROR_FAILED);
+    VerifyOrExit(responseHeader.GetResponseCode() == Header::kResponseSuccess ||
+                     responseHeader.GetResponseCode() == Header::kResponseNameError,
+                 error = OT_ERROR_FAILED);
 
     // Parse and check the question section.
     SuccessOrExit(error = CompareQuestions(aMessage, *message, offset));
 
+    if (responseHeader.GetResponseCode() == Header::kResponseNameError)
+    {
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENTRIES
+        UpdateCache(queryMetadata.mHostname, NULL, kCacheNegativeTtl, OT_ERROR_FAILED);
+#endif
+        ExitNow(error = OT_ERROR_FAILED);
+    }
+
     // Parse and check the answer section.
     for (uint32_t index = 0; index < responseHeader.GetAnswerCount(); index++)
     {
@@ -494,12 +617,20 @@ void Client::HandleUdpReceive(Message &aMessage, const Ip6::MessageInfo &aMessag
             continue;
         }
 
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENTRIES
+        UpdateCache(queryMetadata.mHostname, &record.GetAddress(), record.GetTtl(), OT_ERROR_NONE);
+#endif
+
         // Return the first found IPv6 address.
         FinalizeDnsTransaction(*message, queryMetadata, &record.GetAddress(), record.GetTtl(), OT_ERROR_NONE);
 
         ExitNow();
     }
 
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENTRIES
+    UpdateCache(queryMetadata.mHostname, NULL, kCacheNegativeTtl, OT_ERROR_NOT_FOUND);
+#endif
+
     ExitNow(error = OT_ERROR_NOT_FOUND);
 
 exit:
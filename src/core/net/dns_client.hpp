@@ -161,7 +161,12 @@ public:
     Client(Ip6::Netif &aNetif)
         : mSocket(aNetif.GetIp6().GetUdp())
         , mMessageId(0)
-        , mRetransmissionTimer(aNetif.GetInstance(), &Client::HandleRetransmissionTimer, this){};
+        , mRetransmissionTimer(aNetif.GetInstance(), &Client::HandleRetransmissionTimer, this)
+    {
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENTRIES
+        memset(mCache, 0, sizeof(mCache));
+#endif
+    };
 
     /**
      * This method starts the DNS client.
@@ -182,11 +187,14 @@ public:
     /**
      * This method sends a DNS query.
      *
+     * If the DNS client cache holds an unexpired result for the hostname, @p aHandler is called with the cached
+     * result (and the remaining TTL) before this method returns, and no query is sent.
+     *
      * @param[in]  aQuery    A pointer to specify DNS query parameters.
      * @param[in]  aHandler  A function pointer that shall be called on response reception or time-out.
      * @param[in]  aContext  A pointer to arbitrary context information.
      *
-     * @retval OT_ERROR_NONE          Successfully sent DNS query.
+     * @retval OT_ERROR_NONE          Successfully sent DNS query (or answered it from the cache).
      * @retval OT_ERROR_NO_BUFS       Failed to allocate retransmission data.
      * @retval OT_ERROR_INVALID_ARGS  Invalid arguments supplied.
      *
@@ -222,6 +230,28 @@ private:
         kBufSize = 16
     };
 
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENTRIES
+    enum
+    {
+        kCacheEntries           = OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENTRIES,
+        kCacheMaxHostnameLength = OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_HOSTNAME_LENGTH,
+        kCacheMaxTtl            = OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_TTL,      ///< In seconds.
+        kCacheNegativeTtl       = OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_NEGATIVE_TTL, ///< In seconds.
+    };
+
+    struct CacheEntry
+    {
+        char         mHostname[kCacheMaxHostnameLength + 1]; ///< Empty string if the entry is unused.
+        otIp6Address mAddress;
+        uint32_t     mExpireTime; ///< In milliseconds.
+        otError      mResult;     ///< `OT_ERROR_NONE` for an answer, or the error of a negative answer.
+    };
+
+    CacheEntry *FindCacheEntry(const char *aHostname);
+    bool        ResolveFromCache(const char *aHostname, otDnsResponseHandler aHandler, void *aContext);
+    void        UpdateCache(const char *aHostname, const otIp6Address *aAddress, uint32_t aTtl, otError aResult);
+#endif
+
     Message *NewMessage(const Header &aHeader);
     Message *CopyAndEnqueueMessage(const Message &aMessage, const QueryMetadata &aQueryMetadata);
     void     DequeueMessage(Message &aMessage);
@@ -250,6 +280,10 @@ private:
     uint16_t     mMessageId;
     MessageQueue mPendingQueries;
     TimerMilli   mRetransmissionTimer;
+
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENTRIES
+    CacheEntry mCache[kCacheEntries];
+#endif
 };
 
 } // namespace Dns
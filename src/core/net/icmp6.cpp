@@ -42,6 +42,7 @@
 #include "common/instance.hpp"
 #include "common/logging.hpp"
 #include "common/message.hpp"
+#include "common/timer.hpp"
 #include "net/ip6.hpp"
 
 using ot::Encoding::BigEndian::HostSwap16;
@@ -54,6 +55,10 @@ Icmp::Icmp(Instance &aInstance)
     , mHandlers(NULL)
     , mEchoSequence(1)
     , mEchoMode(OT_ICMP6_ECHO_HANDLER_ALL)
+#if OPENTHREAD_CONFIG_ICMP6_RESPONSE_RATE_LIMIT
+    , mResponseTokens(kResponseBurst)
+    , mResponseTokenTime(TimerMilli::GetNow())
+#endif
 {
 }
 
@@ -116,6 +121,10 @@ otError Icmp::SendError(IcmpHeader::Type   aType,
 
     messageInfoLocal = aMessageInfo;
 
+#if OPENTHREAD_CONFIG_ICMP6_RESPONSE_RATE_LIMIT
+    VerifyOrExit(ConsumeResponseToken(), error = OT_ERROR_BUSY);
+#endif
+
     VerifyOrExit((message = GetIp6().NewMessage(0)) != NULL, error = OT_ERROR_NO_BUFS);
     SuccessOrExit(error = message->SetLength(sizeof(icmp6Header) + sizeof(aHeader)));
 
@@ -210,6 +219,14 @@ otError Icmp::HandleEchoRequest(Message &aRequestMessage, const MessageInfo &aMe
 
     otLogInfoIcmp("Received Echo Request");
 
+#if OPENTHREAD_CONFIG_ICMP6_RESPONSE_RATE_LIMIT
+    if (!ConsumeResponseToken())
+    {
+        otLogDebgIcmp("Echo Reply rate limited");
+        ExitNow();
+    }
+#endif
+
     icmp6Header.Init();
     icmp6Header.SetType(IcmpHeader::kTypeEchoReply);
 
@@ -250,6 +267,33 @@ exit:
     return error;
 }
 
+#if OPENTHREAD_CONFIG_ICMP6_RESPONSE_RATE_LIMIT
+bool Icmp::ConsumeResponseToken(void)
+{
+    bool     rval   = false;
+    uint32_t now    = TimerMilli::GetNow();
+    uint32_t refill = (now - mResponseTokenTime) / kResponseTokenInterval;
+
+    if (refill >= static_cast<uint32_t>(kResponseBurst - mResponseTokens))
+    {
+        mResponseTokens    = kResponseBurst;
+        mResponseTokenTime = now;
+    }
+    else
+    {
+        mResponseTokens += static_cast<uint16_t>(refill);
+        mResponseTokenTime += refill * kResponseTokenInterval;
+    }
+
+    VerifyOrExit(mResponseTokens > 0);
+    mResponseTokens--;
+    rval = true;
+
+exit:
+    return rval;
+}
+#endif // OPENTHREAD_CONFIG_ICMP6_RESPONSE_RATE_LIMIT
+
 otError Icmp::UpdateChecksum(Message &aMessage, uint16_t aChecksum)
 {
     aChecksum = aMessage.UpdateChecksum(aChecksum, aMessage.GetOffset(), aMessage.GetLength() - aMessage.GetOffset());
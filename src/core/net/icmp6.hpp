@@ -347,10 +347,25 @@ public:
 private:
     otError HandleEchoRequest(Message &aMessage, const MessageInfo &aMessageInfo);
 
+#if OPENTHREAD_CONFIG_ICMP6_RESPONSE_RATE_LIMIT
+    enum
+    {
+        kResponseBurst         = OPENTHREAD_CONFIG_ICMP6_RESPONSE_BURST,
+        kResponseTokenInterval = 1000 / OPENTHREAD_CONFIG_ICMP6_RESPONSE_RATE_LIMIT, ///< In milliseconds.
+    };
+
+    bool ConsumeResponseToken(void);
+#endif
+
     IcmpHandler *mHandlers;
 
     uint16_t        mEchoSequence;
     otIcmp6EchoMode mEchoMode;
+
+#if OPENTHREAD_CONFIG_ICMP6_RESPONSE_RATE_LIMIT
+    uint16_t mResponseTokens;    ///< Number of responses which can be sent right away.
+    uint32_t mResponseTokenTime; ///< The time the last token was added (milliseconds).
+#endif
 };
 
 /**
@@ -48,6 +48,11 @@
 #include "net/udp6.hpp"
 #include "thread/mle.hpp"
 
+#if OPENTHREAD_CONFIG_MESSAGE_TRACE_TIMESTAMP_OPTION && \
+    !(OPENTHREAD_CONFIG_ENABLE_MESSAGE_TRACE && OPENTHREAD_CONFIG_ENABLE_TIME_SYNC)
+#error "OPENTHREAD_CONFIG_MESSAGE_TRACE_TIMESTAMP_OPTION requires MESSAGE_TRACE and TIME_SYNC"
+#endif
+
 namespace ot {
 namespace Ip6 {
 
@@ -58,13 +63,33 @@ Ip6::Ip6(Instance &aInstance)
     , mReceiveIp6DatagramCallback(NULL)
     , mReceiveIp6DatagramCallbackContext(NULL)
     , mNetifListHead(NULL)
+#if OPENTHREAD_CONFIG_IP6_SOURCE_ADDRESS_CACHE_ENTRIES
+    , mSourceAddressCacheNext(0)
+#endif
+#if OPENTHREAD_CONFIG_IP6_REASSEMBLY_MAX_DATAGRAMS
+    , mReassemblyTimer(aInstance, &Ip6::HandleReassemblyTimer, this)
+#endif
     , mSendQueue()
     , mSendQueueTask(aInstance, HandleSendQueue, this)
     , mRoutes(aInstance)
     , mIcmp(aInstance)
     , mUdp(aInstance)
+#if OPENTHREAD_CONFIG_ENABLE_TCP
+    , mTcp(aInstance)
+#endif
     , mMpl(aInstance)
 {
+    InvalidateSourceAddressCache();
+    ResetDropCounters();
+
+#if OPENTHREAD_CONFIG_IP6_REASSEMBLY_MAX_DATAGRAMS
+    for (uint8_t i = 0; i < kReassemblyMaxDatagrams; i++)
+    {
+        mReassemblyEntries[i].mMessage = NULL;
+    }
+
+    memset(&mReassemblyCounters, 0, sizeof(mReassemblyCounters));
+#endif
 }
 
 Message *Ip6::NewMessage(uint16_t aReserved, const otMessageSettings *aSettings)
@@ -73,6 +98,25 @@ Message *Ip6::NewMessage(uint16_t aReserved, const otMessageSettings *aSettings)
         Message::kTypeIp6, sizeof(Header) + sizeof(HopByHopHeader) + sizeof(OptionMpl) + aReserved, aSettings);
 }
 
+Message *Ip6::NewMessage(uint16_t aReserved, const Address &aDestination, const otMessageSettings *aSettings)
+{
+    return GetInstance().GetMessagePool().New(Message::kTypeIp6, GetHeaderReserve(aDestination) + aReserved,
+                                              aSettings);
+}
+
+uint16_t Ip6::GetHeaderReserve(const Address &aDestination)
+{
+    // The hop-by-hop header with the MPL option (including padding) or the timestamp option fits in 8 bytes.
+    uint16_t reserve = sizeof(Header) + sizeof(HopByHopHeader) + sizeof(OptionMpl);
+
+    if (aDestination.IsMulticastLargerThanRealmLocal())
+    {
+        reserve += sizeof(Header) + sizeof(HopByHopHeader) + sizeof(OptionMpl);
+    }
+
+    return reserve;
+}
+
 uint8_t Ip6::DscpToPriority(uint8_t aDscp)
 {
     uint8_t priority;
@@ -179,6 +223,49 @@ exit:
     return error;
 }
 
+#if OPENTHREAD_CONFIG_MESSAGE_TRACE_TIMESTAMP_OPTION
+otError Ip6::AddTimestampOption(Message &aMessage, Header &aHeader)
+{
+    otError         error = OT_ERROR_NONE;
+    HopByHopHeader  hbhHeader;
+    OptionTimestamp timestampOption;
+    uint64_t        now;
+
+    // The latency is only meaningful if the receiver shares the same clock.
+    VerifyOrExit(GetInstance().GetThreadNetif().GetTimeSync().GetTime(now) == OT_NETWORK_TIME_SYNCHRONIZED);
+
+    hbhHeader.SetNextHeader(aHeader.GetNextHeader());
+    hbhHeader.SetLength(0);
+    timestampOption.Init(static_cast<uint32_t>(now));
+
+    // The header and the option fill exactly 8 bytes, so no padding is needed.
+    SuccessOrExit(error = aMessage.Prepend(&timestampOption, sizeof(timestampOption)));
+    SuccessOrExit(error = aMessage.Prepend(&hbhHeader, sizeof(hbhHeader)));
+    aHeader.SetPayloadLength(aHeader.GetPayloadLength() + sizeof(hbhHeader) + sizeof(timestampOption));
+    aHeader.SetNextHeader(kProtoHopOpts);
+
+exit:
+    return error;
+}
+
+void Ip6::HandleTimestampOption(const Message &aMessage)
+{
+    OptionTimestamp timestampOption;
+    uint64_t        now;
+
+    VerifyOrExit(aMessage.Read(aMessage.GetOffset(), sizeof(timestampOption), &timestampOption) ==
+                 sizeof(timestampOption));
+    VerifyOrExit(timestampOption.IsValid());
+    VerifyOrExit(GetInstance().GetThreadNetif().GetTimeSync().GetTime(now) == OT_NETWORK_TIME_SYNCHRONIZED);
+
+    GetInstance().GetThreadNetif().GetMeshForwarder().RecordPathLatency(
+        (static_cast<uint32_t>(now) - timestampOption.GetTimestamp()) / 1000);
+
+exit:
+    return;
+}
+#endif // OPENTHREAD_CONFIG_MESSAGE_TRACE_TIMESTAMP_OPTION
+
 otError Ip6::AddTunneledMplOption(Message &aMessage, Header &aHeader, MessageInfo &aMessageInfo)
 {
     otError                    error = OT_ERROR_NONE;
@@ -438,6 +525,12 @@ otError Ip6::SendDatagram(Message &aMessage, MessageInfo &aMessageInfo, IpProto
     {
         SuccessOrExit(error = AddMplOption(aMessage, header));
     }
+#if OPENTHREAD_CONFIG_MESSAGE_TRACE_TIMESTAMP_OPTION
+    else if (!aMessageInfo.GetPeerAddr().IsMulticast())
+    {
+        SuccessOrExit(error = AddTimestampOption(aMessage, header));
+    }
+#endif
 
     SuccessOrExit(error = aMessage.Prepend(&header, sizeof(header)));
 
@@ -450,6 +543,12 @@ otError Ip6::SendDatagram(Message &aMessage, MessageInfo &aMessageInfo, IpProto
         SuccessOrExit(error = mUdp.UpdateChecksum(aMessage, checksum));
         break;
 
+#if OPENTHREAD_CONFIG_ENABLE_TCP
+    case kProtoTcp:
+        SuccessOrExit(error = mTcp.UpdateChecksum(aMessage, checksum));
+        break;
+#endif
+
     case kProtoIcmp6:
         SuccessOrExit(error = mIcmp.UpdateChecksum(aMessage, checksum));
         break;
@@ -486,6 +585,10 @@ exit:
         aMessage.SetInterfaceId(aMessageInfo.GetInterfaceId());
         EnqueueDatagram(aMessage);
     }
+    else
+    {
+        mDropCounters.mTx[GetDropReason(error)]++;
+    }
 
     return error;
 }
@@ -506,16 +609,13 @@ void Ip6::HandleSendQueue(void)
     }
 }
 
-otError Ip6::HandleOptions(Message &aMessage, Header &aHeader, bool &aForward)
+otError Ip6::HandleOptions(Message &aMessage, Header &aHeader, const ExtensionHeader &aExtHeader, bool &aForward)
 {
-    otError        error = OT_ERROR_NONE;
-    HopByHopHeader hbhHeader;
-    OptionHeader   optionHeader;
-    uint16_t       endOffset;
+    otError      error = OT_ERROR_NONE;
+    OptionHeader optionHeader;
+    uint16_t     endOffset;
 
-    VerifyOrExit(aMessage.Read(aMessage.GetOffset(), sizeof(hbhHeader), &hbhHeader) == sizeof(hbhHeader),
-                 error = OT_ERROR_DROP);
-    endOffset = aMessage.GetOffset() + (hbhHeader.GetLength() + 1) * 8;
+    endOffset = aMessage.GetOffset() + (aExtHeader.GetLength() + 1) * 8;
 
     VerifyOrExit(endOffset <= aMessage.GetLength(), error = OT_ERROR_DROP);
 
@@ -541,6 +641,16 @@ otError Ip6::HandleOptions(Message &aMessage, Header &aHeader, bool &aForward)
             SuccessOrExit(error = mMpl.ProcessOption(aMessage, aHeader.GetSource(), aForward));
             break;
 
+#if OPENTHREAD_CONFIG_MESSAGE_TRACE_TIMESTAMP_OPTION
+        case OptionTimestamp::kType:
+            if (!aForward)
+            {
+                HandleTimestampOption(aMessage);
+            }
+
+            break;
+#endif
+
         default:
             switch (optionHeader.GetAction())
             {
@@ -569,7 +679,11 @@ exit:
     return error;
 }
 
-otError Ip6::HandleFragment(Message &aMessage)
+otError Ip6::HandleFragment(Message & aMessage,
+                           Header &  aHeader,
+                           uint16_t  aNextHeaderOffset,
+                           bool      aForward,
+                           Message *&aDatagram)
 {
     otError        error = OT_ERROR_NONE;
     FragmentHeader fragmentHeader;
@@ -577,40 +691,340 @@ otError Ip6::HandleFragment(Message &aMessage)
     VerifyOrExit(aMessage.Read(aMessage.GetOffset(), sizeof(fragmentHeader), &fragmentHeader) == sizeof(fragmentHeader),
                  error = OT_ERROR_DROP);
 
-    VerifyOrExit(fragmentHeader.GetOffset() == 0 && fragmentHeader.IsMoreFlagSet() == false, error = OT_ERROR_DROP);
+    if (fragmentHeader.GetOffset() != 0 || fragmentHeader.IsMoreFlagSet())
+    {
+#if OPENTHREAD_CONFIG_IP6_REASSEMBLY_MAX_DATAGRAMS
+        // Fragments are only reassembled when they are not forwarded as well (the offset is left on the
+        // Fragment header to indicate that the fragment was consumed).
+        VerifyOrExit(!aForward, error = OT_ERROR_DROP);
+        AddFragment(aMessage, aHeader, fragmentHeader, aNextHeaderOffset, aDatagram);
+        ExitNow();
+#else
+        OT_UNUSED_VARIABLE(aHeader);
+        OT_UNUSED_VARIABLE(aNextHeaderOffset);
+        OT_UNUSED_VARIABLE(aForward);
+        OT_UNUSED_VARIABLE(aDatagram);
+        ExitNow(error = OT_ERROR_DROP);
+#endif
+    }
 
+    // Atomic fragment (RFC 6946), processed as a regular datagram.
     aMessage.MoveOffset(sizeof(fragmentHeader));
 
 exit:
     return error;
 }
 
-otError Ip6::HandleExtensionHeaders(Message &aMessage,
-                                    Header & aHeader,
-                                    uint8_t &aNextHeader,
-                                    bool     aForward,
-                                    bool     aReceive)
+#if OPENTHREAD_CONFIG_IP6_REASSEMBLY_MAX_DATAGRAMS
+void Ip6::AddFragment(Message &             aMessage,
+                      const Header &        aHeader,
+                      const FragmentHeader &aFragmentHeader,
+                      uint16_t              aNextHeaderOffset,
+                      Message *&            aDatagram)
 {
-    otError         error = OT_ERROR_NONE;
+    otError          error        = OT_ERROR_NONE;
+    uint16_t         headerLength = aMessage.GetOffset();
+    uint16_t         dataOffset   = headerLength + sizeof(FragmentHeader);
+    uint16_t         start        = aFragmentHeader.GetOffset() * kFragmentOffsetUnit;
+    uint16_t         length       = aMessage.GetLength() - dataOffset;
+    uint16_t         end          = start + length;
+    ReassemblyEntry *entry        = NULL;
+    uint8_t          nextHeader;
+    uint16_t         payloadLength;
+
+    mReassemblyCounters.mRxFragments++;
+
+    // Every fragment except the last one carries a non-zero multiple of 8 bytes (RFC 8200 section 4.5).
+    VerifyOrExit(length > 0 && (!aFragmentHeader.IsMoreFlagSet() || (length % kFragmentOffsetUnit) == 0),
+                 error = OT_ERROR_PARSE);
+    VerifyOrExit(static_cast<uint32_t>(headerLength) + start + length <= kMaxDatagramLength, error = OT_ERROR_PARSE);
+
+    entry = FindReassemblyEntry(aHeader, aFragmentHeader.GetIdentification());
+
+    if (entry == NULL)
+    {
+        VerifyOrExit((entry = AddReassemblyEntry(aMessage, aHeader, aFragmentHeader.GetIdentification())) != NULL,
+                     error = OT_ERROR_NO_BUFS);
+    }
+
+    for (uint8_t i = 0; i < entry->mNumRanges; i++)
+    {
+        // A fragment within a received range is dropped as a duplicate without disturbing the datagram.
+        if (start >= entry->mRanges[i].mStart && end <= entry->mRanges[i].mEnd)
+        {
+            mReassemblyCounters.mRxDuplicateFragments++;
+            entry = NULL;
+            ExitNow(error = OT_ERROR_DUPLICATED);
+        }
+
+        // Any other overlap abandons the reassembly (RFC 8200 section 4.5).
+        VerifyOrExit(end <= entry->mRanges[i].mStart || start >= entry->mRanges[i].mEnd, error = OT_ERROR_PARSE);
+    }
+
+    if (aFragmentHeader.IsMoreFlagSet())
+    {
+        VerifyOrExit(entry->mPayloadLength == 0 || end <= entry->mPayloadLength, error = OT_ERROR_PARSE);
+    }
+    else
+    {
+        // The last fragment determines the length of the fragmentable part.
+        VerifyOrExit(entry->mPayloadLength == 0, error = OT_ERROR_PARSE);
+        VerifyOrExit(entry->mHeaderLength + end >= entry->mMessage->GetLength(), error = OT_ERROR_PARSE);
+        entry->mPayloadLength = end;
+    }
+
+    if (!aMessage.IsLinkSecurityEnabled())
+    {
+        entry->mMessage->SetLinkSecurityEnabled(false);
+    }
+
+    SuccessOrExit(error = AddReassemblyRange(*entry, start, end));
+
+    if (entry->mHeaderLength + end > entry->mMessage->GetLength())
+    {
+        SuccessOrExit(error = entry->mMessage->SetLength(entry->mHeaderLength + end));
+    }
+
+    aMessage.CopyTo(dataOffset, entry->mHeaderLength + start, length, *entry->mMessage);
+
+    if (start == 0)
+    {
+        // The unfragmentable part of the first fragment becomes the header of the reassembled datagram, with the
+        // Next Header value of the last unfragmentable header taken from the Fragment header.
+        VerifyOrExit(static_cast<uint32_t>(headerLength) + entry->mMessage->GetLength() <= kMaxDatagramLength,
+                     error = OT_ERROR_PARSE);
+        SuccessOrExit(error = entry->mMessage->Prepend(NULL, headerLength));
+        aMessage.CopyTo(0, 0, headerLength, *entry->mMessage);
+
+        nextHeader = static_cast<uint8_t>(aFragmentHeader.GetNextHeader());
+        entry->mMessage->Write(aNextHeaderOffset, sizeof(nextHeader), &nextHeader);
+        entry->mHeaderLength = headerLength;
+    }
+
+    if (entry->mHeaderLength != 0 && entry->mPayloadLength != 0 && entry->mNumRanges == 1 &&
+        entry->mRanges[0].mStart == 0 && entry->mRanges[0].mEnd == entry->mPayloadLength)
+    {
+        payloadLength = HostSwap16(entry->mMessage->GetLength() - sizeof(Header));
+        entry->mMessage->Write(Header::GetPayloadLengthOffset(), sizeof(payloadLength), &payloadLength);
+
+        // Fragments received without link security are filtered individually, so check the datagram as well.
+        VerifyOrExit(GetInstance().GetThreadNetif().GetIp6Filter().Accept(*entry->mMessage),
+                     error = OT_ERROR_SECURITY);
+
+        entry->mMessage->SetBufferClass(Message::kBufferClassDefault);
+
+        aDatagram       = entry->mMessage;
+        entry->mMessage = NULL;
+        entry           = NULL;
+
+        mReassemblyCounters.mRxReassembled++;
+    }
+
+exit:
+
+    if (error != OT_ERROR_NONE)
+    {
+        if (error != OT_ERROR_DUPLICATED)
+        {
+            mReassemblyCounters.mRxFragmentDrops++;
+        }
+
+        if (entry != NULL)
+        {
+            FreeReassemblyEntry(*entry);
+        }
+
+        mDropCounters.mRx[GetDropReason(error)]++;
+        otLogInfoIp6("Dropped IPv6 fragment: %s", otThreadErrorToString(error));
+    }
+}
+
+Ip6::ReassemblyEntry *Ip6::FindReassemblyEntry(const Header &aHeader, uint32_t aIdentification)
+{
+    ReassemblyEntry *entry = NULL;
+
+    for (uint8_t i = 0; i < kReassemblyMaxDatagrams; i++)
+    {
+        ReassemblyEntry &cur = mReassemblyEntries[i];
+
+        if (cur.mMessage != NULL && cur.mIdentification == aIdentification && cur.mSource == aHeader.GetSource() &&
+            cur.mDestination == aHeader.GetDestination())
+        {
+            ExitNow(entry = &cur);
+        }
+    }
+
+exit:
+    return entry;
+}
+
+Ip6::ReassemblyEntry *Ip6::AddReassemblyEntry(const Message &aMessage, const Header &aHeader, uint32_t aIdentification)
+{
+    ReassemblyEntry *entry     = NULL;
+    uint8_t          numSource = 0;
+    Message *        message;
+
+    for (uint8_t i = 0; i < kReassemblyMaxDatagrams; i++)
+    {
+        if (mReassemblyEntries[i].mMessage == NULL)
+        {
+            if (entry == NULL)
+            {
+                entry = &mReassemblyEntries[i];
+            }
+        }
+        else if (mReassemblyEntries[i].mSource == aHeader.GetSource())
+        {
+            numSource++;
+        }
+    }
+
+    VerifyOrExit(entry != NULL && numSource < kReassemblyMaxPerSource, entry = NULL);
+
+    VerifyOrExit((message = GetInstance().GetMessagePool().New(Message::kTypeIp6, 0, aMessage.GetPriority())) != NULL,
+                 entry = NULL);
+
+    if (message->SetBufferClass(Message::kBufferClassReassembly) != OT_ERROR_NONE)
+    {
+        message->Free();
+        ExitNow(entry = NULL);
+    }
+
+    message->SetInterfaceId(aMessage.GetInterfaceId());
+    message->SetLinkSecurityEnabled(aMessage.IsLinkSecurityEnabled());
+
+    entry->mMessage        = message;
+    entry->mSource         = aHeader.GetSource();
+    entry->mDestination    = aHeader.GetDestination();
+    entry->mIdentification = aIdentification;
+    entry->mStartTime      = TimerMilli::GetNow();
+    entry->mHeaderLength   = 0;
+    entry->mPayloadLength  = 0;
+    entry->mNumRanges      = 0;
+
+    if (!mReassemblyTimer.IsRunning())
+    {
+        mReassemblyTimer.Start(TimerMilli::SecToMsec(kReassemblyTimeout));
+    }
+
+exit:
+    return entry;
+}
+
+void Ip6::FreeReassemblyEntry(ReassemblyEntry &aEntry)
+{
+    aEntry.mMessage->Free();
+    aEntry.mMessage = NULL;
+}
+
+otError Ip6::AddReassemblyRange(ReassemblyEntry &aEntry, uint16_t aStart, uint16_t aEnd)
+{
+    otError error = OT_ERROR_NONE;
+    uint8_t i     = 0;
+
+    // Merge the new range with adjacent ones, so that a complete datagram ends up with a single range.
+    while (i < aEntry.mNumRanges)
+    {
+        ReassemblyRange &range = aEntry.mRanges[i];
+
+        if (range.mEnd == aStart || range.mStart == aEnd)
+        {
+            aStart = (range.mStart < aStart) ? range.mStart : aStart;
+            aEnd   = (range.mEnd > aEnd) ? range.mEnd : aEnd;
+            range  = aEntry.mRanges[--aEntry.mNumRanges];
+            continue;
+        }
+
+        i++;
+    }
+
+    VerifyOrExit(aEntry.mNumRanges < kReassemblyMaxRanges, error = OT_ERROR_NO_BUFS);
+
+    aEntry.mRanges[aEntry.mNumRanges].mStart = aStart;
+    aEntry.mRanges[aEntry.mNumRanges].mEnd   = aEnd;
+    aEntry.mNumRanges++;
+
+exit:
+    return error;
+}
+
+void Ip6::HandleReassemblyTimer(Timer &aTimer)
+{
+    aTimer.GetOwner<Ip6>().HandleReassemblyTimer();
+}
+
+void Ip6::HandleReassemblyTimer(void)
+{
+    uint32_t now       = TimerMilli::GetNow();
+    uint32_t timeout   = TimerMilli::SecToMsec(kReassemblyTimeout);
+    uint32_t nextDelay = timeout + 1;
+    uint32_t elapsed;
+
+    for (uint8_t i = 0; i < kReassemblyMaxDatagrams; i++)
+    {
+        if (mReassemblyEntries[i].mMessage == NULL)
+        {
+            continue;
+        }
+
+        elapsed = now - mReassemblyEntries[i].mStartTime;
+
+        if (elapsed < timeout)
+        {
+            if (timeout - elapsed < nextDelay)
+            {
+                nextDelay = timeout - elapsed;
+            }
+
+            continue;
+        }
+
+        FreeReassemblyEntry(mReassemblyEntries[i]);
+        mReassemblyCounters.mRxReassemblyTimeout++;
+        mDropCounters.mRx[OT_IP6_DROP_REASON_REASSEMBLY]++;
+    }
+
+    if (nextDelay <= timeout)
+    {
+        mReassemblyTimer.Start(nextDelay);
+    }
+}
+#endif // OPENTHREAD_CONFIG_IP6_REASSEMBLY_MAX_DATAGRAMS
+
+otError Ip6::HandleExtensionHeaders(Message & aMessage,
+                                    Header &  aHeader,
+                                    uint8_t & aNextHeader,
+                                    bool      aForward,
+                                    bool      aReceive,
+                                    Message *&aDatagram)
+{
+    otError         error            = OT_ERROR_NONE;
+    uint16_t        nextHeaderOffset = Header::GetNextHeaderOffset();
+    uint16_t        headerOffset;
     ExtensionHeader extHeader;
 
     while (aReceive == true || aNextHeader == kProtoHopOpts)
     {
-        VerifyOrExit(aMessage.Read(aMessage.GetOffset(), sizeof(extHeader), &extHeader) == sizeof(extHeader),
+        headerOffset = aMessage.GetOffset();
+
+        VerifyOrExit(aMessage.Read(headerOffset, sizeof(extHeader), &extHeader) == sizeof(extHeader),
                      error = OT_ERROR_DROP);
 
         switch (aNextHeader)
         {
         case kProtoHopOpts:
-            SuccessOrExit(error = HandleOptions(aMessage, aHeader, aForward));
+            SuccessOrExit(error = HandleOptions(aMessage, aHeader, extHeader, aForward));
             break;
 
         case kProtoFragment:
-            SuccessOrExit(error = HandleFragment(aMessage));
+            SuccessOrExit(error = HandleFragment(aMessage, aHeader, nextHeaderOffset, aForward, aDatagram));
+
+            // Processing stops (with `aNextHeader` left as `kProtoFragment`) if the fragment was reassembled.
+            VerifyOrExit(aMessage.GetOffset() != headerOffset);
             break;
 
         case kProtoDstOpts:
-            SuccessOrExit(error = HandleOptions(aMessage, aHeader, aForward));
+            SuccessOrExit(error = HandleOptions(aMessage, aHeader, extHeader, aForward));
             break;
 
         case kProtoIp6:
@@ -624,13 +1038,35 @@ otError Ip6::HandleExtensionHeaders(Message &aMessage,
             ExitNow();
         }
 
-        aNextHeader = static_cast<uint8_t>(extHeader.GetNextHeader());
+        aNextHeader      = static_cast<uint8_t>(extHeader.GetNextHeader());
+        nextHeaderOffset = headerOffset;
     }
 
 exit:
     return error;
 }
 
+void Ip6::RecordPacketInfo(Message &aMessage, uint8_t aIpProto)
+{
+    PacketInfo packetInfo;
+    uint16_t   ports[2];
+
+    packetInfo.mTransportOffset = aMessage.GetOffset();
+    packetInfo.mSourcePort      = 0;
+    packetInfo.mDestinationPort = 0;
+    packetInfo.mIpProto         = aIpProto;
+
+    // UDP and TCP headers both start with the source and destination ports.
+    if ((aIpProto == kProtoUdp || aIpProto == kProtoTcp) &&
+        aMessage.Read(aMessage.GetOffset(), sizeof(ports), ports) == sizeof(ports))
+    {
+        packetInfo.mSourcePort      = HostSwap16(ports[0]);
+        packetInfo.mDestinationPort = HostSwap16(ports[1]);
+    }
+
+    aMessage.SetPacketInfo(packetInfo);
+}
+
 otError Ip6::HandlePayload(Message &aMessage, MessageInfo &aMessageInfo, uint8_t aIpProto)
 {
     otError error = OT_ERROR_NONE;
@@ -640,6 +1076,11 @@ otError Ip6::HandlePayload(Message &aMessage, MessageInfo &aMessageInfo, uint8_t
     case kProtoUdp:
         ExitNow(error = mUdp.HandleMessage(aMessage, aMessageInfo));
 
+#if OPENTHREAD_CONFIG_ENABLE_TCP
+    case kProtoTcp:
+        ExitNow(error = mTcp.HandleMessage(aMessage, aMessageInfo));
+#endif
+
     case kProtoIcmp6:
         ExitNow(error = mIcmp.HandleMessage(aMessage, aMessageInfo));
     }
@@ -800,6 +1241,7 @@ otError Ip6::HandleDatagram(Message &   aMessage,
     uint8_t     nextHeader;
     uint8_t     hopLimit;
     int8_t      forwardInterfaceId;
+    Message *   datagram = NULL;
 
     SuccessOrExit(error = header.Init(aMessage));
 
@@ -855,7 +1297,20 @@ otError Ip6::HandleDatagram(Message &   aMessage,
 
     // process IPv6 Extension Headers
     nextHeader = static_cast<uint8_t>(header.GetNextHeader());
-    SuccessOrExit(error = HandleExtensionHeaders(aMessage, header, nextHeader, forward, receive));
+    SuccessOrExit(error = HandleExtensionHeaders(aMessage, header, nextHeader, forward, receive, datagram));
+
+    if (receive && nextHeader == kProtoFragment)
+    {
+        // The fragment was added to a datagram under reassembly, which is processed once complete.
+        if (datagram != NULL)
+        {
+            HandleDatagram(*datagram, aNetif, aInterfaceId, aLinkMessageInfo, aFromNcpHost);
+        }
+
+        ExitNow();
+    }
+
+    RecordPacketInfo(aMessage, nextHeader);
 
     // process IPv6 Payload
     if (receive)
@@ -917,6 +1372,19 @@ otError Ip6::HandleDatagram(Message &   aMessage,
 
 exit:
 
+    if (error != OT_ERROR_NONE)
+    {
+        // Datagrams handled without a receiving interface are sent by this device or the host.
+        if (aNetif == NULL)
+        {
+            mDropCounters.mTx[GetDropReason(error)]++;
+        }
+        else
+        {
+            mDropCounters.mRx[GetDropReason(error)]++;
+        }
+    }
+
     if (!tunnel && (error != OT_ERROR_NONE || !forward))
     {
         aMessage.Free();
@@ -982,6 +1450,7 @@ otError Ip6::AddNetif(Netif &aNetif)
     }
 
     aNetif.mNext = NULL;
+    InvalidateSourceAddressCache();
 
 exit:
     return error;
@@ -1013,6 +1482,7 @@ otError Ip6::RemoveNetif(Netif &aNetif)
     }
 
     aNetif.mNext = NULL;
+    InvalidateSourceAddressCache();
 
 exit:
     return error;
@@ -1052,10 +1522,66 @@ exit:
     return rval;
 }
 
+void Ip6::InvalidateSourceAddressCache(void)
+{
+#if OPENTHREAD_CONFIG_IP6_SOURCE_ADDRESS_CACHE_ENTRIES
+    for (uint8_t i = 0; i < OT_ARRAY_LENGTH(mSourceAddressCache); i++)
+    {
+        mSourceAddressCache[i].mSource = NULL;
+    }
+#endif
+}
+
 const NetifUnicastAddress *Ip6::SelectSourceAddress(MessageInfo &aMessageInfo)
 {
-    Address *                  destination = &aMessageInfo.GetPeerAddr();
-    int                        interfaceId = aMessageInfo.mInterfaceId;
+    const NetifUnicastAddress *rval;
+    int8_t                     interfaceId = aMessageInfo.mInterfaceId;
+
+#if OPENTHREAD_CONFIG_IP6_SOURCE_ADDRESS_CACHE_ENTRIES
+    SourceAddressCacheEntry *entry;
+
+    for (uint8_t i = 0; i < OT_ARRAY_LENGTH(mSourceAddressCache); i++)
+    {
+        entry = &mSourceAddressCache[i];
+
+        if (entry->mSource != NULL && entry->mInterfaceId == interfaceId &&
+            entry->mDestination == aMessageInfo.GetPeerAddr())
+        {
+            aMessageInfo.mInterfaceId = entry->mSelectedInterfaceId;
+            ExitNow(rval = entry->mSource);
+        }
+    }
+#endif
+
+    rval = SelectSourceAddress(aMessageInfo.GetPeerAddr(), interfaceId);
+
+#if OPENTHREAD_CONFIG_IP6_SOURCE_ADDRESS_CACHE_ENTRIES
+    if (rval != NULL)
+    {
+        // Replace the entries in round-robin order.
+        entry = &mSourceAddressCache[mSourceAddressCacheNext];
+
+        entry->mDestination         = aMessageInfo.GetPeerAddr();
+        entry->mSource              = rval;
+        entry->mInterfaceId         = aMessageInfo.mInterfaceId;
+        entry->mSelectedInterfaceId = interfaceId;
+
+        mSourceAddressCacheNext = (mSourceAddressCacheNext + 1) % OT_ARRAY_LENGTH(mSourceAddressCache);
+    }
+#endif
+
+    aMessageInfo.mInterfaceId = interfaceId;
+
+#if OPENTHREAD_CONFIG_IP6_SOURCE_ADDRESS_CACHE_ENTRIES
+exit:
+#endif
+    return rval;
+}
+
+const NetifUnicastAddress *Ip6::SelectSourceAddress(const Address &aDestination, int8_t &aInterfaceId)
+{
+    const Address *            destination = &aDestination;
+    int8_t                     interfaceId = aInterfaceId;
     const NetifUnicastAddress *rvalAddr    = NULL;
     const Address *            candidateAddr;
     int8_t                     candidateId;
@@ -1154,8 +1680,7 @@ const NetifUnicastAddress *Ip6::SelectSourceAddress(MessageInfo &aMessageInfo)
                 rvalIface         = candidateId;
                 rvalPrefixMatched = candidatePrefixMatched;
             }
-            else if (aMessageInfo.mInterfaceId != 0 && aMessageInfo.mInterfaceId == candidateId &&
-                     rvalIface != candidateId)
+            else if (interfaceId != 0 && interfaceId == candidateId && rvalIface != candidateId)
             {
                 // Rule 4: Prefer home address
                 // Rule 5: Prefer outgoing interface
@@ -1176,7 +1701,7 @@ const NetifUnicastAddress *Ip6::SelectSourceAddress(MessageInfo &aMessageInfo)
     }
 
 exit:
-    aMessageInfo.mInterfaceId = rvalIface;
+    aInterfaceId = rvalIface;
     return rvalAddr;
 }
 
@@ -1199,6 +1724,49 @@ exit:
     return rval;
 }
 
+otIp6DropReason Ip6::GetDropReason(otError aError)
+{
+    otIp6DropReason reason;
+
+    switch (aError)
+    {
+    case OT_ERROR_NO_ROUTE:
+        reason = OT_IP6_DROP_REASON_NO_ROUTE;
+        break;
+
+    case OT_ERROR_ADDRESS_QUERY:
+        reason = OT_IP6_DROP_REASON_ADDRESS_QUERY;
+        break;
+
+    case OT_ERROR_REASSEMBLY_TIMEOUT:
+    case OT_ERROR_NO_FRAME_RECEIVED:
+        reason = OT_IP6_DROP_REASON_REASSEMBLY;
+        break;
+
+    case OT_ERROR_SECURITY:
+        reason = OT_IP6_DROP_REASON_SECURITY;
+        break;
+
+    case OT_ERROR_DUPLICATED:
+        reason = OT_IP6_DROP_REASON_DUPLICATE;
+        break;
+
+    case OT_ERROR_NO_BUFS:
+        reason = OT_IP6_DROP_REASON_NO_BUFS;
+        break;
+
+    case OT_ERROR_PARSE:
+        reason = OT_IP6_DROP_REASON_MALFORMED;
+        break;
+
+    default:
+        reason = OT_IP6_DROP_REASON_OTHER;
+        break;
+    }
+
+    return reason;
+}
+
 const char *Ip6::IpProtoToString(IpProto aIpProto)
 {
     const char *retval;
@@ -37,6 +37,7 @@
 #include "openthread-core-config.h"
 
 #include <stddef.h>
+#include <string.h>
 
 #include <openthread/ip6.h>
 #include <openthread/udp.h>
@@ -44,6 +45,7 @@
 #include "common/encoding.hpp"
 #include "common/locator.hpp"
 #include "common/message.hpp"
+#include "common/timer.hpp"
 #include "net/icmp6.hpp"
 #include "net/ip6_address.hpp"
 #include "net/ip6_headers.hpp"
@@ -51,6 +53,7 @@
 #include "net/ip6_routes.hpp"
 #include "net/netif.hpp"
 #include "net/socket.hpp"
+#include "net/tcp.hpp"
 #include "net/udp6.hpp"
 
 using ot::Encoding::BigEndian::HostSwap16;
@@ -121,6 +124,36 @@ public:
      */
     Message *NewMessage(uint16_t aReserved, const otMessageSettings *aSettings = NULL);
 
+    /**
+     * This method allocates a new message buffer from the buffer pool, reserving enough header space for all the
+     * headers added when the message is sent to a given destination.
+     *
+     * @note If @p aSettings is 'NULL', the link layer security is enabled and the message priority is set to
+     * OT_MESSAGE_PRIORITY_NORMAL by default.
+     *
+     * @param[in]  aReserved     The number of header bytes to reserve following the IPv6 header.
+     * @param[in]  aDestination  The IPv6 destination address the message will be sent to.
+     * @param[in]  aSettings     A pointer to the message settings or NULL to set default settings.
+     *
+     * @returns A pointer to the message or NULL if insufficient message buffers are available.
+     *
+     */
+    Message *NewMessage(uint16_t aReserved, const Address &aDestination, const otMessageSettings *aSettings = NULL);
+
+    /**
+     * This static method returns the worst-case length of the headers `SendDatagram()` prepends to a message sent to
+     * a given destination.
+     *
+     * This covers the IPv6 header with a hop-by-hop (MPL or timestamp) option and, for multicast destinations larger
+     * than realm-local scope, the IPv6-in-IPv6 tunnel header with its own MPL option.
+     *
+     * @param[in]  aDestination  The IPv6 destination address.
+     *
+     * @returns The number of header bytes to reserve.
+     *
+     */
+    static uint16_t GetHeaderReserve(const Address &aDestination);
+
     /**
      * This method converts the message priority level to IPv6 DSCP value.
      *
@@ -344,6 +377,14 @@ public:
      */
     const NetifUnicastAddress *SelectSourceAddress(MessageInfo &aMessageInfo);
 
+    /**
+     * This method invalidates the cached source address selections.
+     *
+     * It must be called whenever a unicast address is added to or removed from any network interface.
+     *
+     */
+    void InvalidateSourceAddressCache(void);
+
     /**
      * This method determines which network interface @p aAddress is on-link, if any.
      *
@@ -386,6 +427,16 @@ public:
      */
     Udp &GetUdp(void) { return mUdp; }
 
+#if OPENTHREAD_CONFIG_ENABLE_TCP
+    /**
+     * This method returns a reference to the TCP controller instance.
+     *
+     * @returns A reference to the TCP instance.
+     *
+     */
+    Tcp &GetTcp(void) { return mTcp; }
+#endif
+
     /**
      * This method returns a reference to the UDMPL message processing controller instance.
      *
@@ -402,6 +453,40 @@ public:
      */
     static const char *IpProtoToString(IpProto aIpProto);
 
+#if OPENTHREAD_CONFIG_IP6_REASSEMBLY_MAX_DATAGRAMS
+    /**
+     * This method returns the IPv6 fragment reassembly counters.
+     *
+     * @returns A reference to the IPv6 fragment reassembly counters.
+     *
+     */
+    const otIp6ReassemblyCounters &GetReassemblyCounters(void) const { return mReassemblyCounters; }
+#endif
+
+    /**
+     * This method returns the IPv6 layer drop counters.
+     *
+     * @returns A reference to the IPv6 layer drop counters.
+     *
+     */
+    const otIp6DropCounters &GetDropCounters(void) const { return mDropCounters; }
+
+    /**
+     * This method resets the IPv6 layer drop counters.
+     *
+     */
+    void ResetDropCounters(void) { memset(&mDropCounters, 0, sizeof(mDropCounters)); }
+
+    /**
+     * This static method maps the error a datagram or frame was dropped with to a drop reason.
+     *
+     * @param[in]  aError  The error the datagram or frame was dropped with.
+     *
+     * @returns The drop reason corresponding to @p aError.
+     *
+     */
+    static otIp6DropReason GetDropReason(otError aError);
+
 private:
     enum
     {
@@ -415,25 +500,101 @@ private:
                                    const MessageInfo &aMessageInfo,
                                    uint8_t            aIpProto,
                                    bool               aFromNcpHost);
-    otError HandleExtensionHeaders(Message &aMessage,
-                                   Header & aHeader,
-                                   uint8_t &aNextHeader,
-                                   bool     aForward,
-                                   bool     aReceive);
-    otError HandleFragment(Message &aMessage);
+    otError HandleExtensionHeaders(Message & aMessage,
+                                   Header &  aHeader,
+                                   uint8_t & aNextHeader,
+                                   bool      aForward,
+                                   bool      aReceive,
+                                   Message *&aDatagram);
+    otError HandleFragment(Message & aMessage,
+                           Header &  aHeader,
+                           uint16_t  aNextHeaderOffset,
+                           bool      aForward,
+                           Message *&aDatagram);
     otError AddMplOption(Message &aMessage, Header &aHeader);
     otError AddTunneledMplOption(Message &aMessage, Header &aHeader, MessageInfo &aMessageInfo);
     otError InsertMplOption(Message &aMessage, Header &aHeader, MessageInfo &aMessageInfo);
     otError RemoveMplOption(Message &aMessage);
-    otError HandleOptions(Message &aMessage, Header &aHeader, bool &aForward);
+#if OPENTHREAD_CONFIG_MESSAGE_TRACE_TIMESTAMP_OPTION
+    otError AddTimestampOption(Message &aMessage, Header &aHeader);
+    void    HandleTimestampOption(const Message &aMessage);
+#endif
+    otError HandleOptions(Message &aMessage, Header &aHeader, const ExtensionHeader &aExtHeader, bool &aForward);
+    void    RecordPacketInfo(Message &aMessage, uint8_t aIpProto);
     otError HandlePayload(Message &aMessage, MessageInfo &aMessageInfo, uint8_t aIpProto);
     int8_t  FindForwardInterfaceId(const MessageInfo &aMessageInfo);
 
+    const NetifUnicastAddress *SelectSourceAddress(const Address &aDestination, int8_t &aInterfaceId);
+
+#if OPENTHREAD_CONFIG_IP6_REASSEMBLY_MAX_DATAGRAMS
+    enum
+    {
+        kReassemblyMaxDatagrams = OPENTHREAD_CONFIG_IP6_REASSEMBLY_MAX_DATAGRAMS,
+        kReassemblyMaxPerSource = OPENTHREAD_CONFIG_IP6_REASSEMBLY_MAX_DATAGRAMS_PER_SOURCE,
+        kReassemblyMaxRanges    = OPENTHREAD_CONFIG_IP6_REASSEMBLY_MAX_RANGES,
+        kReassemblyTimeout      = OPENTHREAD_CONFIG_IP6_REASSEMBLY_TIMEOUT, ///< In seconds.
+        kFragmentOffsetUnit     = 8,                                        ///< Fragment offset unit (in bytes).
+    };
+
+    struct ReassemblyRange
+    {
+        uint16_t mStart; ///< Offset of the first byte within the fragmentable part.
+        uint16_t mEnd;   ///< Offset after the last byte within the fragmentable part.
+    };
+
+    struct ReassemblyEntry
+    {
+        Message *       mMessage; ///< The datagram under reassembly (NULL if the entry is unused).
+        Address         mSource;
+        Address         mDestination;
+        uint32_t        mIdentification;
+        uint32_t        mStartTime;
+        uint16_t        mHeaderLength;  ///< Length of the unfragmentable part (zero until the first fragment).
+        uint16_t        mPayloadLength; ///< Length of the fragmentable part (zero until the last fragment).
+        uint8_t         mNumRanges;
+        ReassemblyRange mRanges[kReassemblyMaxRanges]; ///< The byte ranges of the fragmentable part received.
+    };
+
+    void             AddFragment(Message &             aMessage,
+                                 const Header &        aHeader,
+                                 const FragmentHeader &aFragmentHeader,
+                                 uint16_t              aNextHeaderOffset,
+                                 Message *&            aDatagram);
+    ReassemblyEntry *FindReassemblyEntry(const Header &aHeader, uint32_t aIdentification);
+    ReassemblyEntry *AddReassemblyEntry(const Message &aMessage, const Header &aHeader, uint32_t aIdentification);
+    void             FreeReassemblyEntry(ReassemblyEntry &aEntry);
+    otError          AddReassemblyRange(ReassemblyEntry &aEntry, uint16_t aStart, uint16_t aEnd);
+    static void      HandleReassemblyTimer(Timer &aTimer);
+    void             HandleReassemblyTimer(void);
+#endif
+
+#if OPENTHREAD_CONFIG_IP6_SOURCE_ADDRESS_CACHE_ENTRIES
+    struct SourceAddressCacheEntry
+    {
+        Address                    mDestination;
+        const NetifUnicastAddress *mSource; ///< NULL if the entry is unused.
+        int8_t                     mInterfaceId;
+        int8_t                     mSelectedInterfaceId;
+    };
+#endif
+
     bool                 mForwardingEnabled;
     bool                 mIsReceiveIp6FilterEnabled;
     otIp6ReceiveCallback mReceiveIp6DatagramCallback;
     void *               mReceiveIp6DatagramCallbackContext;
     Netif *              mNetifListHead;
+    otIp6DropCounters    mDropCounters;
+
+#if OPENTHREAD_CONFIG_IP6_SOURCE_ADDRESS_CACHE_ENTRIES
+    SourceAddressCacheEntry mSourceAddressCache[OPENTHREAD_CONFIG_IP6_SOURCE_ADDRESS_CACHE_ENTRIES];
+    uint8_t                 mSourceAddressCacheNext;
+#endif
+
+#if OPENTHREAD_CONFIG_IP6_REASSEMBLY_MAX_DATAGRAMS
+    ReassemblyEntry         mReassemblyEntries[kReassemblyMaxDatagrams];
+    TimerMilli              mReassemblyTimer;
+    otIp6ReassemblyCounters mReassemblyCounters;
+#endif
 
     PriorityQueue mSendQueue;
     Tasklet       mSendQueueTask;
@@ -441,7 +602,10 @@ private:
     Routes mRoutes;
     Icmp   mIcmp;
     Udp    mUdp;
-    Mpl    mMpl;
+#if OPENTHREAD_CONFIG_ENABLE_TCP
+    Tcp mTcp;
+#endif
+    Mpl mMpl;
 };
 
 /**
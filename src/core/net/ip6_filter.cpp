@@ -36,12 +36,13 @@
 #include <stdio.h>
 
 #include "common/code_utils.hpp"
+#include "common/encoding.hpp"
 #include "common/instance.hpp"
 #include "net/ip6.hpp"
-#include "net/tcp.hpp"
-#include "net/udp6.hpp"
 #include "thread/mle.hpp"
 
+using ot::Encoding::BigEndian::HostSwap16;
+
 namespace ot {
 namespace Ip6 {
 
@@ -52,11 +53,11 @@ Filter::Filter(void)
 
 bool Filter::Accept(Message &aMessage) const
 {
-    bool      rval = false;
-    Header    ip6;
-    UdpHeader udp;
-    TcpHeader tcp;
-    uint16_t  dstport;
+    bool              rval       = false;
+    const PacketInfo *packetInfo = aMessage.GetPacketInfo();
+    Address           destination;
+    uint8_t           ipProto;
+    uint16_t          dstport;
 
     // Allow all received IPv6 datagrams with link security enabled
     if (aMessage.IsLinkSecurityEnabled())
@@ -64,45 +65,44 @@ bool Filter::Accept(Message &aMessage) const
         ExitNow(rval = true);
     }
 
-    // Read IPv6 header
-    VerifyOrExit(sizeof(ip6) == aMessage.Read(0, sizeof(ip6), &ip6));
+    // Read only the IPv6 header fields used by the filter
+    VerifyOrExit(sizeof(destination) ==
+                 aMessage.Read(Header::GetDestinationOffset(), sizeof(destination), &destination));
 
     // Allow only link-local unicast or multicast
-    VerifyOrExit(ip6.GetDestination().IsLinkLocal() || ip6.GetDestination().IsLinkLocalMulticast());
+    VerifyOrExit(destination.IsLinkLocal() || destination.IsLinkLocalMulticast());
 
-    switch (ip6.GetNextHeader())
+    if (packetInfo != NULL)
     {
-    case kProtoUdp:
-        // Read the UDP header and get the dst port
-        VerifyOrExit(sizeof(udp) == aMessage.Read(sizeof(ip6), sizeof(udp), &udp));
-
-        dstport = udp.GetDestinationPort();
-
-        // Allow MLE traffic
-        if (dstport == Mle::kUdpPort)
-        {
-            ExitNow(rval = true);
-        }
-
-        break;
-
-    case kProtoTcp:
-        // Read the TCP header and get the dst port
-        VerifyOrExit(sizeof(tcp) == aMessage.Read(sizeof(ip6), sizeof(tcp), &tcp));
+        // The transport information was already recorded, including past any extension headers
+        ipProto = packetInfo->mIpProto;
+        dstport = packetInfo->mDestinationPort;
+    }
+    else
+    {
+        VerifyOrExit(sizeof(ipProto) == aMessage.Read(Header::GetNextHeaderOffset(), sizeof(ipProto), &ipProto));
+    }
 
-        dstport = tcp.GetDestinationPort();
+    // Allow UDP or TCP traffic only
+    VerifyOrExit(ipProto == kProtoUdp || ipProto == kProtoTcp);
 
-        break;
+    if (packetInfo == NULL)
+    {
+        // UDP and TCP headers both start with the source port followed by the destination port
+        VerifyOrExit(sizeof(dstport) == aMessage.Read(sizeof(Header) + sizeof(uint16_t), sizeof(dstport), &dstport));
+        dstport = HostSwap16(dstport);
+    }
 
-    default:
-        // Allow UDP or TCP traffic only
-        ExitNow();
+    // Allow MLE traffic
+    if (ipProto == kProtoUdp && dstport == Mle::kUdpPort)
+    {
+        ExitNow(rval = true);
     }
 
-    // Check against allowed unsecure port list
-    for (int i = 0; i < kMaxUnsecurePorts; i++)
+    // Check against allowed unsecure port list (kept compacted, so it ends at the first unused entry)
+    for (int i = 0; i < kMaxUnsecurePorts && mUnsecurePorts[i] != 0; i++)
     {
-        if (mUnsecurePorts[i] != 0 && mUnsecurePorts[i] == dstport)
+        if (mUnsecurePorts[i] == dstport)
         {
             ExitNow(rval = true);
         }
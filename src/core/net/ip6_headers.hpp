@@ -266,6 +266,14 @@ public:
      */
     Address &GetSource(void) { return static_cast<Address &>(mSource); }
 
+    /**
+     * This method returns the IPv6 Source address.
+     *
+     * @returns A const reference to the IPv6 Source address.
+     *
+     */
+    const Address &GetSource(void) const { return static_cast<const Address &>(mSource); }
+
     /**
      * This method sets the IPv6 Source address.
      *
@@ -282,6 +290,14 @@ public:
      */
     Address &GetDestination(void) { return static_cast<Address &>(mDestination); }
 
+    /**
+     * This method returns the IPv6 Destination address.
+     *
+     * @returns A const reference to the IPv6 Destination address.
+     *
+     */
+    const Address &GetDestination(void) const { return static_cast<const Address &>(mDestination); }
+
     /**
      * This method sets the IPv6 Destination address.
      *
@@ -298,6 +314,14 @@ public:
      */
     static uint8_t GetPayloadLengthOffset(void) { return offsetof(HeaderPoD, mPayloadLength); }
 
+    /**
+     * This static method returns the byte offset of the IPv6 Next Header field.
+     *
+     * @returns The byte offset of the IPv6 Next Header field.
+     *
+     */
+    static uint8_t GetNextHeaderOffset(void) { return offsetof(HeaderPoD, mNextHeader); }
+
     /**
      * This static method returns the byte offset of the IPv6 Hop Limit field.
      *
@@ -528,6 +552,55 @@ private:
     uint8_t mType;
 } OT_TOOL_PACKED_END;
 
+/**
+ * This class implements the timestamp IPv6 Option used for end-to-end latency profiling.
+ *
+ * The option uses an experimental option type (RFC 4727) that is skipped by nodes that do not understand it.
+ *
+ */
+OT_TOOL_PACKED_BEGIN
+class OptionTimestamp : public OptionHeader
+{
+public:
+    enum
+    {
+        kType = 0x1e, ///< Experimental option type (00 0 11110): skip if unrecognized, not changed en route.
+    };
+
+    /**
+     * This method initializes the timestamp option.
+     *
+     * @param[in]  aTimestamp  The send time (microseconds, truncated network time).
+     *
+     */
+    void Init(uint32_t aTimestamp)
+    {
+        OptionHeader::SetType(kType);
+        OptionHeader::SetLength(sizeof(*this) - sizeof(OptionHeader));
+        mTimestamp = HostSwap32(aTimestamp);
+    }
+
+    /**
+     * This method indicates whether or not the option length is valid.
+     *
+     * @retval TRUE   If the option length is valid.
+     * @retval FALSE  If the option length is not valid.
+     *
+     */
+    bool IsValid(void) const { return OptionHeader::GetLength() == sizeof(*this) - sizeof(OptionHeader); }
+
+    /**
+     * This method returns the send time.
+     *
+     * @returns The send time (microseconds, truncated network time).
+     *
+     */
+    uint32_t GetTimestamp(void) const { return HostSwap32(mTimestamp); }
+
+private:
+    uint32_t mTimestamp;
+} OT_TOOL_PACKED_END;
+
 /**
  * This class implements IPv6 Fragment Header generation and parsing.
  *
@@ -568,7 +641,7 @@ public:
      * @returns The Fragment Offset value.
      *
      */
-    uint16_t GetOffset(void) { return (HostSwap16(mOffsetMore) & kOffsetMask) >> kOffsetOffset; }
+    uint16_t GetOffset(void) const { return (HostSwap16(mOffsetMore) & kOffsetMask) >> kOffsetOffset; }
 
     /**
      * This method sets the Fragment Offset value.
@@ -588,7 +661,7 @@ public:
      * @returns The M flag value.
      *
      */
-    bool IsMoreFlagSet(void) { return HostSwap16(mOffsetMore) & kMoreFlag; }
+    bool IsMoreFlagSet(void) const { return HostSwap16(mOffsetMore) & kMoreFlag; }
 
     /**
      * This method clears the M flag value.
@@ -602,6 +675,14 @@ public:
      */
     void SetMoreFlag(void) { mOffsetMore = HostSwap16(HostSwap16(mOffsetMore) | kMoreFlag); }
 
+    /**
+     * This method returns the Identification value.
+     *
+     * @returns The Identification value.
+     *
+     */
+    uint32_t GetIdentification(void) const { return HostSwap32(mIdentification); }
+
 private:
     uint8_t mNextHeader;
     uint8_t mReserved;
@@ -61,8 +61,45 @@ Mpl::Mpl(Instance &aInstance)
     , mSeedSetTimer(aInstance, &Mpl::HandleSeedSetTimer, this)
     , mRetransmissionTimer(aInstance, &Mpl::HandleRetransmissionTimer, this)
     , mMatchingAddress(NULL)
+    , mSeedFreeList(0)
 {
     memset(mSeedSet, 0, sizeof(mSeedSet));
+
+    for (uint16_t i = 0; i < kNumSeedEntries; i++)
+    {
+        mSeedSet[i].SetNext((i + 1 < kNumSeedEntries) ? i + 1 : static_cast<uint16_t>(kInvalidSeedIndex));
+    }
+
+    for (uint16_t i = 0; i < kNumSeedBuckets; i++)
+    {
+        mSeedBuckets[i] = kInvalidSeedIndex;
+    }
+}
+
+otError MplSeedEntry::UpdateSequence(uint8_t aSequence)
+{
+    otError error = OT_ERROR_NONE;
+    int8_t  diff  = static_cast<int8_t>(aSequence - mSequence);
+
+    if (diff > 0)
+    {
+        // Slide the window up to the new highest sequence.
+        mWindow   = (diff < kWindowSize) ? static_cast<uint16_t>((mWindow << diff) | 1) : 1;
+        mSequence = aSequence;
+    }
+    else
+    {
+        uint16_t bit;
+
+        VerifyOrExit(-diff < kWindowSize, error = OT_ERROR_DROP);
+
+        bit = static_cast<uint16_t>(1 << -diff);
+        VerifyOrExit((mWindow & bit) == 0, error = OT_ERROR_DROP);
+        mWindow |= bit;
+    }
+
+exit:
+    return error;
 }
 
 void Mpl::InitOption(OptionMpl &aOption, const Address &aAddress)
@@ -85,45 +122,57 @@ void Mpl::InitOption(OptionMpl &aOption, const Address &aAddress)
     }
 }
 
+uint16_t Mpl::GetSeedBucket(uint16_t aSeedId)
+{
+    // Seed Ids are usually RLOC16s, mix the Router Id and Child Id bits.
+    return static_cast<uint16_t>((aSeedId ^ (aSeedId >> 8)) % kNumSeedBuckets);
+}
+
 otError Mpl::UpdateSeedSet(uint16_t aSeedId, uint8_t aSequence)
 {
-    otError       error = OT_ERROR_NONE;
-    MplSeedEntry *entry = NULL;
-    int8_t        diff;
+    otError       error  = OT_ERROR_NONE;
+    uint16_t &    bucket = mSeedBuckets[GetSeedBucket(aSeedId)];
+    uint16_t      index;
+    MplSeedEntry *entry;
 
-    for (uint32_t i = 0; i < kNumSeedEntries; i++)
+    for (index = bucket; index != kInvalidSeedIndex; index = mSeedSet[index].GetNext())
     {
-        if (mSeedSet[i].GetLifetime() == 0)
+        if (mSeedSet[index].GetSeedId() == aSeedId)
         {
-            // Start allocating from the first possible entry to speed up process of searching.
-            if (entry == NULL)
-            {
-                entry = &mSeedSet[i];
-            }
-        }
-        else if (mSeedSet[i].GetSeedId() == aSeedId)
-        {
-            entry = &mSeedSet[i];
-            diff  = static_cast<int8_t>(aSequence - entry->GetSequence());
-
-            VerifyOrExit(diff > 0, error = OT_ERROR_DROP);
-
             break;
         }
     }
 
-    VerifyOrExit(entry != NULL, error = OT_ERROR_DROP);
+    if (index != kInvalidSeedIndex)
+    {
+        entry = &mSeedSet[index];
+        SuccessOrExit(error = entry->UpdateSequence(aSequence));
+    }
+    else
+    {
+        VerifyOrExit(mSeedFreeList != kInvalidSeedIndex, error = OT_ERROR_DROP);
+
+        index         = mSeedFreeList;
+        entry         = &mSeedSet[index];
+        mSeedFreeList = entry->GetNext();
+
+        entry->Init(aSeedId, aSequence);
+        entry->SetNext(bucket);
+        bucket = index;
+    }
 
-    entry->SetSeedId(aSeedId);
-    entry->SetSequence(aSequence);
     entry->SetLifetime(kSeedEntryLifetime);
-    mSeedSetTimer.Start(kSeedEntryLifetimeDt);
+
+    if (!mSeedSetTimer.IsRunning())
+    {
+        mSeedSetTimer.Start(kSeedEntryLifetimeDt);
+    }
 
 exit:
     return error;
 }
 
-void Mpl::UpdateBufferedSet(uint16_t aSeedId, uint8_t aSequence)
+void Mpl::UpdateBufferedSet(uint16_t aSeedId, uint8_t aSequence, bool aIsOutbound)
 {
     int8_t                     diff;
     MplBufferedMessageMetadata messageMetadata;
@@ -148,9 +197,25 @@ void Mpl::UpdateBufferedSet(uint16_t aSeedId, uint8_t aSequence)
                 // Stop retransmitting MPL Data Message that is consider to be old.
                 mBufferedMessageSet.Dequeue(*message);
                 message->Free();
+                break;
             }
 
+#if OPENTHREAD_CONFIG_MPL_DATA_MESSAGE_REDUNDANCY_CONSTANT
+            if (diff == 0)
+            {
+                // Another forwarder transmitted the buffered MPL Data Message (a Trickle consistent transmission).
+                if (!aIsOutbound && messageMetadata.GetReceivedCount() < 0xff)
+                {
+                    messageMetadata.SetReceivedCount(messageMetadata.GetReceivedCount() + 1);
+                    messageMetadata.UpdateIn(*message);
+                }
+
+                break;
+            }
+#else
+            OT_UNUSED_VARIABLE(aIsOutbound);
             break;
+#endif
         }
 
         message = nextMessage;
@@ -237,7 +302,7 @@ otError Mpl::ProcessOption(Message &aMessage, const Address &aAddress, bool aIsO
     }
 
     // Check MPL Data Messages in the MPL Buffered Set against sequence number.
-    UpdateBufferedSet(option.GetSeedId(), option.GetSequence());
+    UpdateBufferedSet(option.GetSeedId(), option.GetSequence(), aIsOutbound);
 
     // Check if the MPL Data Message is new.
     error = UpdateSeedSet(option.GetSeedId(), option.GetSequence());
@@ -291,7 +356,12 @@ void Mpl::HandleRetransmissionTimer(void)
 
             if (messageMetadata.GetTransmissionCount() < GetTimerExpirations())
             {
-                Message *messageCopy = message->Clone(message->GetLength() - sizeof(MplBufferedMessageMetadata));
+                Message *messageCopy = NULL;
+
+                if (!IsTransmissionSuppressed(messageMetadata))
+                {
+                    messageCopy = message->Clone(message->GetLength() - sizeof(MplBufferedMessageMetadata));
+                }
 
                 if (messageCopy != NULL)
                 {
@@ -303,6 +373,7 @@ void Mpl::HandleRetransmissionTimer(void)
                     GetIp6().EnqueueDatagram(*messageCopy);
                 }
 
+                messageMetadata.SetReceivedCount(0);
                 messageMetadata.GenerateNextTransmissionTime(now, kDataMessageInterval);
                 messageMetadata.UpdateIn(*message);
 
@@ -316,7 +387,8 @@ void Mpl::HandleRetransmissionTimer(void)
             {
                 mBufferedMessageSet.Dequeue(*message);
 
-                if (messageMetadata.GetTransmissionCount() == GetTimerExpirations())
+                if (messageMetadata.GetTransmissionCount() == GetTimerExpirations() &&
+                    !IsTransmissionSuppressed(messageMetadata))
                 {
                     if (messageMetadata.GetTransmissionCount() > 1)
                     {
@@ -329,7 +401,8 @@ void Mpl::HandleRetransmissionTimer(void)
                 }
                 else
                 {
-                    // Stop retransmitting if the number of timer expirations is already exceeded.
+                    // Stop retransmitting if the number of timer expirations is already exceeded (or the last
+                    // transmission is suppressed).
                     message->Free();
                 }
             }
@@ -344,6 +417,11 @@ void Mpl::HandleRetransmissionTimer(void)
     }
 }
 
+bool Mpl::IsTransmissionSuppressed(const MplBufferedMessageMetadata &aMetadata)
+{
+    return (kRedundancyConstant != 0) && (aMetadata.GetReceivedCount() >= kRedundancyConstant);
+}
+
 void Mpl::HandleSeedSetTimer(Timer &aTimer)
 {
     aTimer.GetOwner<Mpl>().HandleSeedSetTimer();
@@ -353,12 +431,40 @@ void Mpl::HandleSeedSetTimer(void)
 {
     bool startTimer = false;
 
-    for (int i = 0; i < kNumSeedEntries; i++)
+    for (uint16_t i = 0; i < kNumSeedBuckets; i++)
     {
-        if (mSeedSet[i].GetLifetime() > 0)
+        uint16_t prev  = kInvalidSeedIndex;
+        uint16_t index = mSeedBuckets[i];
+
+        while (index != kInvalidSeedIndex)
         {
-            mSeedSet[i].SetLifetime(mSeedSet[i].GetLifetime() - 1);
-            startTimer = true;
+            MplSeedEntry &entry = mSeedSet[index];
+            uint16_t      next  = entry.GetNext();
+
+            entry.SetLifetime(entry.GetLifetime() - 1);
+
+            if (entry.GetLifetime() > 0)
+            {
+                startTimer = true;
+                prev       = index;
+            }
+            else
+            {
+                // Move the expired entry to the free list.
+                if (prev == kInvalidSeedIndex)
+                {
+                    mSeedBuckets[i] = next;
+                }
+                else
+                {
+                    mSeedSet[prev].SetNext(next);
+                }
+
+                entry.SetNext(mSeedFreeList);
+                mSeedFreeList = index;
+            }
+
+            index = next;
         }
     }
 
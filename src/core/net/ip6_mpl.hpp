@@ -189,6 +189,36 @@ private:
 class MplSeedEntry
 {
 public:
+    enum
+    {
+        kWindowSize = 16, ///< The number of sequence values tracked below the highest received one.
+    };
+
+    /**
+     * This method initializes the entry for a new MPL Seed.
+     *
+     * @param[in]  aSeedId    The MPL Seed Id value.
+     * @param[in]  aSequence  The first received MPL Sequence value.
+     *
+     */
+    void Init(uint16_t aSeedId, uint8_t aSequence)
+    {
+        mSeedId   = aSeedId;
+        mSequence = aSequence;
+        mWindow   = 1;
+    }
+
+    /**
+     * This method records a received MPL Sequence value in the sliding window of the entry.
+     *
+     * @param[in]  aSequence  The received MPL Sequence value.
+     *
+     * @retval OT_ERROR_NONE  The sequence was not received before and has been recorded.
+     * @retval OT_ERROR_DROP  The sequence is a duplicate or is older than the window.
+     *
+     */
+    otError UpdateSequence(uint8_t aSequence);
+
     /**
      * This method returns the MPL Seed Id value.
      *
@@ -206,21 +236,13 @@ public:
     void SetSeedId(uint16_t aSeedId) { mSeedId = aSeedId; }
 
     /**
-     * This method returns the MPL Sequence value.
+     * This method returns the highest received MPL Sequence value.
      *
      * @returns The MPL Sequence value.
      *
      */
     uint8_t GetSequence(void) const { return mSequence; }
 
-    /**
-     * This method sets the MPL Sequence value.
-     *
-     * @param[in]  aSequence  The MPL Sequence value.
-     *
-     */
-    void SetSequence(uint8_t aSequence) { mSequence = aSequence; }
-
     /**
      * This method returns the MPL Seed Set entry's remaining lifetime.
      *
@@ -237,10 +259,28 @@ public:
      */
     void SetLifetime(uint8_t aLifetime) { mLifetime = aLifetime; }
 
+    /**
+     * This method returns the index of the next entry in the same hash bucket (or free list).
+     *
+     * @returns The index of the next entry.
+     *
+     */
+    uint16_t GetNext(void) const { return mNext; }
+
+    /**
+     * This method sets the index of the next entry in the same hash bucket (or free list).
+     *
+     * @param[in]  aNext  The index of the next entry.
+     *
+     */
+    void SetNext(uint16_t aNext) { mNext = aNext; }
+
 private:
     uint16_t mSeedId;
     uint8_t  mSequence;
     uint8_t  mLifetime;
+    uint16_t mWindow; ///< Bit `i` is set if sequence `mSequence - i` was received.
+    uint16_t mNext;
 };
 
 /**
@@ -260,7 +300,8 @@ public:
         , mSequence(0)
         , mTransmissionCount(0)
         , mTransmissionTime(0)
-        , mIntervalOffset(0){};
+        , mIntervalOffset(0)
+        , mReceivedCount(0){};
 
     /**
      * This method appends MPL Buffered Message metadata to the message.
@@ -409,6 +450,23 @@ public:
      */
     void SetIntervalOffset(uint8_t aIntervalOffset) { mIntervalOffset = aIntervalOffset; }
 
+    /**
+     * This method returns the number of times the MPL Data Message was heard from other forwarders since the previous
+     * transmission (the Trickle consistency counter).
+     *
+     * @returns The number of copies heard.
+     *
+     */
+    uint8_t GetReceivedCount(void) const { return mReceivedCount; }
+
+    /**
+     * This method sets the number of times the MPL Data Message was heard from other forwarders.
+     *
+     * @param[in]  aReceivedCount  The number of copies heard.
+     *
+     */
+    void SetReceivedCount(uint8_t aReceivedCount) { mReceivedCount = aReceivedCount; }
+
     /**
      * This method generates the next transmission time for the MPL Data Message.
      *
@@ -423,6 +481,7 @@ private:
     uint8_t  mTransmissionCount;
     uint32_t mTransmissionTime;
     uint8_t  mIntervalOffset;
+    uint8_t  mReceivedCount;
 } OT_TOOL_PACKED_END;
 
 /**
@@ -519,14 +578,19 @@ private:
     enum
     {
         kNumSeedEntries      = OPENTHREAD_CONFIG_MPL_SEED_SET_ENTRIES,
+        kNumSeedBuckets      = OPENTHREAD_CONFIG_MPL_SEED_SET_NUM_BUCKETS,
+        kInvalidSeedIndex    = 0xffff,
         kSeedEntryLifetime   = OPENTHREAD_CONFIG_MPL_SEED_SET_ENTRY_LIFETIME,
         kSeedEntryLifetimeDt = 1000,
-        kDataMessageInterval = 64
+        kDataMessageInterval = 64,
+        kRedundancyConstant  = OPENTHREAD_CONFIG_MPL_DATA_MESSAGE_REDUNDANCY_CONSTANT,
     };
 
-    otError UpdateSeedSet(uint16_t aSeedId, uint8_t aSequence);
-    void    UpdateBufferedSet(uint16_t aSeedId, uint8_t aSequence);
-    void    AddBufferedMessage(Message &aMessage, uint16_t aSeedId, uint8_t aSequence, bool aIsOutbound);
+    static uint16_t GetSeedBucket(uint16_t aSeedId);
+    otError         UpdateSeedSet(uint16_t aSeedId, uint8_t aSequence);
+    void            UpdateBufferedSet(uint16_t aSeedId, uint8_t aSequence, bool aIsOutbound);
+    void            AddBufferedMessage(Message &aMessage, uint16_t aSeedId, uint8_t aSequence, bool aIsOutbound);
+    static bool     IsTransmissionSuppressed(const MplBufferedMessageMetadata &aMetadata);
 
     static void HandleSeedSetTimer(Timer &aTimer);
     void        HandleSeedSetTimer(void);
@@ -544,6 +608,8 @@ private:
     const Address *mMatchingAddress;
 
     MplSeedEntry mSeedSet[kNumSeedEntries];
+    uint16_t     mSeedBuckets[kNumSeedBuckets];
+    uint16_t     mSeedFreeList;
     MessageQueue mBufferedMessageSet;
 };
 
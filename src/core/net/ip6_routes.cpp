@@ -50,15 +50,30 @@ Routes::Routes(Instance &aInstance)
 
 otError Routes::Add(Route &aRoute)
 {
-    otError error = OT_ERROR_NONE;
+    otError error  = OT_ERROR_NONE;
+    Route **insert = NULL;
+    Route **cur;
 
-    for (Route *cur = mRoutes; cur; cur = cur->mNext)
+    // The list is kept sorted by decreasing prefix length (routes of equal length in the order they were added),
+    // so that the first matching route found by `Lookup()` is the longest prefix match.
+
+    for (cur = &mRoutes; *cur != NULL; cur = &(*cur)->mNext)
     {
-        VerifyOrExit(cur != &aRoute, error = OT_ERROR_ALREADY);
+        VerifyOrExit(*cur != &aRoute, error = OT_ERROR_ALREADY);
+
+        if (insert == NULL && (*cur)->mPrefixLength < aRoute.mPrefixLength)
+        {
+            insert = cur;
+        }
     }
 
-    aRoute.mNext = mRoutes;
-    mRoutes      = &aRoute;
+    if (insert == NULL)
+    {
+        insert = cur;
+    }
+
+    aRoute.mNext = *insert;
+    *insert      = &aRoute;
 
 exit:
     return error;
@@ -66,62 +81,44 @@ exit:
 
 otError Routes::Remove(Route &aRoute)
 {
-    if (&aRoute == mRoutes)
-    {
-        mRoutes = aRoute.mNext;
-    }
-    else
+    otError error = OT_ERROR_NOT_FOUND;
+
+    for (Route **cur = &mRoutes; *cur != NULL; cur = &(*cur)->mNext)
     {
-        for (Route *cur = mRoutes; cur; cur = cur->mNext)
+        if (*cur == &aRoute)
         {
-            if (cur->mNext == &aRoute)
-            {
-                cur->mNext = aRoute.mNext;
-                break;
-            }
+            *cur         = aRoute.mNext;
+            aRoute.mNext = NULL;
+            ExitNow(error = OT_ERROR_NONE);
         }
     }
 
-    aRoute.mNext = NULL;
-
-    return OT_ERROR_NONE;
+exit:
+    return error;
 }
 
 int8_t Routes::Lookup(const Address &aSource, const Address &aDestination)
 {
-    int8_t  maxPrefixMatch = -1;
+    int16_t maxPrefixMatch = -1;
     uint8_t prefixMatch;
     int8_t  rval = -1;
 
     for (Route *cur = mRoutes; cur; cur = cur->mNext)
     {
-        prefixMatch = cur->mPrefix.PrefixMatch(aDestination);
-
-        if (prefixMatch < cur->mPrefixLength)
+        if (cur->mPrefix.PrefixMatch(aDestination) >= cur->mPrefixLength)
         {
-            continue;
+            // The routes are sorted by decreasing prefix length, so the first match is the longest one.
+            maxPrefixMatch = cur->mPrefixLength;
+            rval           = cur->mInterfaceId;
+            break;
         }
-
-        if (prefixMatch > cur->mPrefixLength)
-        {
-            prefixMatch = cur->mPrefixLength;
-        }
-
-        if (maxPrefixMatch > static_cast<int8_t>(prefixMatch))
-        {
-            continue;
-        }
-
-        maxPrefixMatch = static_cast<int8_t>(prefixMatch);
-        rval           = cur->mInterfaceId;
     }
 
     for (Netif *netif = GetIp6().GetNetifList(); netif; netif = netif->GetNext())
     {
-        if (netif->RouteLookup(aSource, aDestination, &prefixMatch) == OT_ERROR_NONE &&
-            static_cast<int8_t>(prefixMatch) > maxPrefixMatch)
+        if (netif->RouteLookup(aSource, aDestination, &prefixMatch) == OT_ERROR_NONE && prefixMatch > maxPrefixMatch)
         {
-            maxPrefixMatch = static_cast<int8_t>(prefixMatch);
+            maxPrefixMatch = prefixMatch;
             rval           = netif->GetInterfaceId();
         }
     }
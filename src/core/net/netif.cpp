@@ -101,12 +101,45 @@ Netif::Netif(Instance &aInstance, int8_t aInterfaceId)
         // To mark the address as unused/available, set the `mNext` to point back to itself.
         mExtMulticastAddresses[i].mNext = &mExtMulticastAddresses[i];
     }
+
+    memset(mMulticastFilter, 0, sizeof(mMulticastFilter));
+}
+
+uint8_t Netif::GetMulticastFilterIndex(const Address &aAddress)
+{
+    // Use the flags/scope byte and the 32-bit group ID, which stay fixed for subscribed addresses whose prefix is
+    // updated in place (e.g. the mesh-local prefix based all-Thread-nodes addresses).
+    const uint8_t *bytes = aAddress.mFields.m8;
+
+    return (bytes[1] ^ bytes[12] ^ bytes[13] ^ bytes[14] ^ bytes[15]) & (kMulticastFilterSize - 1);
+}
+
+void Netif::UpdateMulticastFilter(const otNetifMulticastAddress *aStart,
+                                  const otNetifMulticastAddress *aEnd,
+                                  bool                           aSubscribe)
+{
+    for (const otNetifMulticastAddress *entry = aStart; entry != aEnd; entry = entry->mNext)
+    {
+        uint8_t &counter = mMulticastFilter[GetMulticastFilterIndex(*static_cast<const Address *>(&entry->mAddress))];
+
+        if (aSubscribe)
+        {
+            counter++;
+        }
+        else
+        {
+            assert(counter > 0);
+            counter--;
+        }
+    }
 }
 
 bool Netif::IsMulticastSubscribed(const Address &aAddress) const
 {
     bool rval = false;
 
+    VerifyOrExit(mMulticastFilter[GetMulticastFilterIndex(aAddress)] != 0);
+
     for (NetifMulticastAddress *cur = mMulticastAddresses; cur; cur = cur->GetNext())
     {
         if (cur->GetAddress() == aAddress)
@@ -125,6 +158,7 @@ void Netif::SubscribeAllNodesMulticast(void)
 
     mMulticastAddresses = static_cast<NetifMulticastAddress *>(
         const_cast<otNetifMulticastAddress *>(&kLinkLocalAllNodesMulticastAddress));
+    UpdateMulticastFilter(&kLinkLocalAllNodesMulticastAddress, NULL, true);
 
     if (mAddressCallback != NULL)
     {
@@ -142,6 +176,11 @@ void Netif::UnsubscribeAllNodesMulticast(void)
 {
     assert(mMulticastAddresses == NULL || mMulticastAddresses == &kLinkLocalAllNodesMulticastAddress);
 
+    if (mMulticastAddresses != NULL)
+    {
+        UpdateMulticastFilter(&kLinkLocalAllNodesMulticastAddress, NULL, false);
+    }
+
     mMulticastAddresses = NULL;
 
     if (mAddressCallback != NULL)
@@ -182,6 +221,8 @@ otError Netif::SubscribeAllRoutersMulticast(void)
         }
     }
 
+    UpdateMulticastFilter(&kLinkLocalAllRoutersMulticastAddress, &kLinkLocalAllNodesMulticastAddress, true);
+
     if (mAddressCallback != NULL)
     {
         for (const otNetifMulticastAddress *entry                = &kLinkLocalAllRoutersMulticastAddress;
@@ -223,6 +264,8 @@ exit:
 
     if (error != OT_ERROR_NOT_FOUND)
     {
+        UpdateMulticastFilter(&kLinkLocalAllRoutersMulticastAddress, &kLinkLocalAllNodesMulticastAddress, false);
+
         if (mAddressCallback != NULL)
         {
             for (const otNetifMulticastAddress *entry                = &kLinkLocalAllRoutersMulticastAddress;
@@ -252,6 +295,7 @@ otError Netif::SubscribeMulticast(NetifMulticastAddress &aAddress)
 
     aAddress.mNext      = mMulticastAddresses;
     mMulticastAddresses = &aAddress;
+    UpdateMulticastFilter(&aAddress, aAddress.mNext, true);
 
     if (mAddressCallback != NULL)
     {
@@ -291,6 +335,8 @@ exit:
 
     if (error != OT_ERROR_NOT_FOUND)
     {
+        UpdateMulticastFilter(&aAddress, aAddress.mNext, false);
+
         if (mAddressCallback != NULL)
         {
             mAddressCallback(&aAddress.mAddress, kMulticastPrefixLength, false, mAddressCallbackContext);
@@ -355,6 +401,7 @@ otError Netif::SubscribeExternalMulticast(const Address &aAddress)
     entry->mAddress     = aAddress;
     entry->mNext        = mMulticastAddresses;
     mMulticastAddresses = entry;
+    UpdateMulticastFilter(entry, entry->mNext, true);
     GetNotifier().Signal(OT_CHANGED_IP6_MULTICAST_SUBSRCRIBED);
 
 exit:
@@ -392,6 +439,8 @@ otError Netif::UnsubscribeExternalMulticast(const Address &aAddress)
 
     VerifyOrExit(entry != NULL, error = OT_ERROR_NOT_FOUND);
 
+    UpdateMulticastFilter(entry, entry->mNext, false);
+
     // To mark the address entry as unused/available, set the `mNext` pointer back to the entry itself.
     entry->mNext = entry;
 
@@ -435,6 +484,7 @@ otError Netif::AddUnicastAddress(NetifUnicastAddress &aAddress)
 
     aAddress.mNext    = mUnicastAddresses;
     mUnicastAddresses = &aAddress;
+    GetIp6().InvalidateSourceAddressCache();
 
     if (mAddressCallback != NULL)
     {
@@ -474,6 +524,8 @@ exit:
 
     if (error != OT_ERROR_NOT_FOUND)
     {
+        GetIp6().InvalidateSourceAddressCache();
+
         if (mAddressCallback != NULL)
         {
             mAddressCallback(&aAddress.mAddress, aAddress.mPrefixLength, false, mAddressCallbackContext);
@@ -503,6 +555,7 @@ otError Netif::AddExternalUnicastAddress(const NetifUnicastAddress &aAddress)
             entry->mPrefixLength = aAddress.mPrefixLength;
             entry->mPreferred    = aAddress.mPreferred;
             entry->mValid        = aAddress.mValid;
+            GetIp6().InvalidateSourceAddressCache();
             ExitNow();
         }
     }
@@ -523,6 +576,7 @@ otError Netif::AddExternalUnicastAddress(const NetifUnicastAddress &aAddress)
     *entry            = aAddress;
     entry->mNext      = mUnicastAddresses;
     mUnicastAddresses = entry;
+    GetIp6().InvalidateSourceAddressCache();
 
     GetNotifier().Signal(OT_CHANGED_IP6_ADDRESS_ADDED);
 
@@ -563,6 +617,7 @@ otError Netif::RemoveExternalUnicastAddress(const Address &aAddress)
 
     // To mark the address entry as unused/available, set the `mNext` pointer back to the entry itself.
     entry->mNext = entry;
+    GetIp6().InvalidateSourceAddressCache();
 
     GetNotifier().Signal(OT_CHANGED_IP6_ADDRESS_REMOVED);
 
@@ -475,8 +475,14 @@ private:
     enum
     {
         kMulticastPrefixLength = 128, ///< Multicast prefix length used to notify internal address changes.
+        kMulticastFilterSize   = 32,  ///< Number of counters in the multicast subscription filter (power of two).
     };
 
+    static uint8_t GetMulticastFilterIndex(const Address &aAddress);
+    void           UpdateMulticastFilter(const otNetifMulticastAddress *aStart,
+                                         const otNetifMulticastAddress *aEnd,
+                                         bool                           aSubscribe);
+
     NetifUnicastAddress *  mUnicastAddresses;
     NetifMulticastAddress *mMulticastAddresses;
     int8_t                 mInterfaceId;
@@ -489,6 +495,10 @@ private:
     NetifUnicastAddress   mExtUnicastAddresses[OPENTHREAD_CONFIG_MAX_EXT_IP_ADDRS];
     NetifMulticastAddress mExtMulticastAddresses[OPENTHREAD_CONFIG_MAX_EXT_MULTICAST_IP_ADDRS];
 
+    // Counting filter over subscribed addresses, indexed by `GetMulticastFilterIndex()`. A zero counter means that
+    // no subscribed address hashes to the index, so `IsMulticastSubscribed()` can return without walking the list.
+    uint8_t mMulticastFilter[kMulticastFilterSize];
+
     static const otNetifMulticastAddress kRealmLocalAllMplForwardersMulticastAddress;
     static const otNetifMulticastAddress kLinkLocalAllNodesMulticastAddress;
     static const otNetifMulticastAddress kRealmLocalAllNodesMulticastAddress;
@@ -0,0 +1,1146 @@
+/*
+ *  Copyright (c) 2018, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * @file
+ *   This file implements TCP/IPv6 sockets.
+ */
+
+#include "tcp.hpp"
+
+#include "common/code_utils.hpp"
+#include "common/encoding.hpp"
+#include "common/instance.hpp"
+#include "common/random.hpp"
+#include "net/ip6.hpp"
+
+#if OPENTHREAD_CONFIG_ENABLE_TCP
+
+using ot::Encoding::BigEndian::HostSwap16;
+
+namespace ot {
+namespace Ip6 {
+
+// Sequence numbers and timestamps wrap around, so they are compared with serial number arithmetic.
+static bool IsBefore(uint32_t aFirst, uint32_t aSecond)
+{
+    return static_cast<int32_t>(aFirst - aSecond) < 0;
+}
+
+static bool IsAfter(uint32_t aFirst, uint32_t aSecond)
+{
+    return IsBefore(aSecond, aFirst);
+}
+
+TcpSocket::TcpSocket(Tcp &aTcp)
+    : InstanceLocator(aTcp.GetInstance())
+{
+}
+
+Tcp &TcpSocket::GetTcp(void)
+{
+    return GetIp6().GetTcp();
+}
+
+otError TcpSocket::Open(otTcpReceive aReceiveHandler, otTcpEventHandler aEventHandler, void *aContext)
+{
+    otError error = OT_ERROR_NONE;
+
+    VerifyOrExit(!GetTcp().IsSocketOpen(*this), error = OT_ERROR_ALREADY);
+
+    memset(&mSockName, 0, sizeof(mSockName));
+    memset(&mPeerName, 0, sizeof(mPeerName));
+    mReceiveHandler = aReceiveHandler;
+    mEventHandler   = aEventHandler;
+    mContext        = aContext;
+    mSendBuffer     = NULL;
+    mState          = kStateClosed;
+    InitConnection();
+
+    GetTcp().AddSocket(*this);
+
+exit:
+    return error;
+}
+
+otError TcpSocket::Bind(const SockAddr &aSockAddr)
+{
+    otError error = OT_ERROR_NONE;
+
+    VerifyOrExit(mState == kStateClosed, error = OT_ERROR_INVALID_STATE);
+
+    mSockName = aSockAddr;
+
+    if (mSockName.mPort == 0)
+    {
+        mSockName.mPort = GetTcp().GetEphemeralPort();
+    }
+
+exit:
+    return error;
+}
+
+otError TcpSocket::Listen(void)
+{
+    otError error = OT_ERROR_NONE;
+
+    VerifyOrExit(mState == kStateClosed && mSockName.mPort != 0, error = OT_ERROR_INVALID_STATE);
+    mState = kStateListen;
+
+exit:
+    return error;
+}
+
+otError TcpSocket::Connect(const SockAddr &aPeerName)
+{
+    otError error = OT_ERROR_NONE;
+
+    VerifyOrExit(mState == kStateClosed, error = OT_ERROR_INVALID_STATE);
+    VerifyOrExit(!aPeerName.GetAddress().IsUnspecified() && aPeerName.mPort != 0, error = OT_ERROR_INVALID_ARGS);
+
+    mPeerName = aPeerName;
+
+    if (mSockName.mPort == 0)
+    {
+        mSockName.mPort = GetTcp().GetEphemeralPort();
+    }
+
+    InitConnection();
+    SuccessOrExit(error = SendSegment(TcpHeader::kFlagSyn, mSendUnacked, 0, 0));
+
+    mSendNext = mSendUnacked + 1;
+    mState    = kStateSynSent;
+    StartTimer(mRetransmitTimeout);
+
+exit:
+    return error;
+}
+
+otError TcpSocket::Send(const void *aBuf, uint16_t aLength)
+{
+    otError error = OT_ERROR_NONE;
+
+    VerifyOrExit(mState == kStateSynSent || mState == kStateSynReceived || CanSendData(),
+                 error = OT_ERROR_INVALID_STATE);
+    VerifyOrExit(!(mFlags & kFlagFinPending), error = OT_ERROR_INVALID_STATE);
+    VerifyOrExit(aLength <= GetSendBufferSpace(), error = OT_ERROR_NO_BUFS);
+
+    if (mSendBuffer == NULL)
+    {
+        VerifyOrExit((mSendBuffer = GetInstance().GetMessagePool().New(Message::kTypeIp6, 0)) != NULL,
+                     error = OT_ERROR_NO_BUFS);
+    }
+
+    SuccessOrExit(error = GetSendBuffer().Append(aBuf, aLength));
+
+    Transmit(false);
+
+exit:
+    return error;
+}
+
+uint16_t TcpSocket::GetSendBufferSpace(void) const
+{
+    return kSendBufferSize - GetSendBufferLength();
+}
+
+otError TcpSocket::Close(void)
+{
+    otError error = OT_ERROR_NONE;
+
+    switch (mState)
+    {
+    case kStateClosed:
+    case kStateListen:
+    case kStateSynSent:
+        Release();
+        break;
+
+    case kStateSynReceived:
+    case kStateEstablished:
+    case kStateCloseWait:
+        VerifyOrExit(!(mFlags & kFlagFinPending), error = OT_ERROR_INVALID_STATE);
+
+        // The FIN is sent once all queued data has been sent, see `Transmit()`.
+        mFlags |= kFlagFinPending;
+        Transmit(false);
+        break;
+
+    default:
+        error = OT_ERROR_INVALID_STATE;
+        break;
+    }
+
+exit:
+    return error;
+}
+
+void TcpSocket::Abort(void)
+{
+    if (mState >= kStateSynReceived && mState != kStateTimeWait)
+    {
+        SendSegment(TcpHeader::kFlagRst, mSendNext, 0, 0);
+    }
+
+    Release();
+}
+
+void TcpSocket::InitConnection(void)
+{
+    mSendUnacked        = Random::GetUint32();
+    mSendNext           = mSendUnacked;
+    mReceiveNext        = 0;
+    mSendWindow         = 0;
+    mMaxSegmentSize     = kMaxSegmentSize;
+    mCongestionWindow   = 2 * kMaxSegmentSize;
+    mSlowStartThreshold = 0xffff;
+    mSmoothedRtt        = 0;
+    mRttVariance        = 0;
+    mRetransmitTimeout  = kInitialRto;
+    mRetransmitCount    = 0;
+    mDuplicateAckCount  = 0;
+    mFlags              = 0;
+}
+
+uint16_t TcpSocket::GetSendBufferLength(void) const
+{
+    return (mSendBuffer != NULL) ? static_cast<const Message *>(mSendBuffer)->GetLength() : 0;
+}
+
+uint16_t TcpSocket::GetBytesInFlight(void) const
+{
+    // The FIN occupies one sequence number but no byte of the send buffer.
+    return static_cast<uint16_t>(mSendNext - mSendUnacked - ((mFlags & kFlagFinSent) ? 1 : 0));
+}
+
+void TcpSocket::HandleSegment(Message &aMessage, const MessageInfo &aMessageInfo, const TcpHeader &aHeader)
+{
+    uint8_t flags = aHeader.GetControlFlags();
+
+    switch (mState)
+    {
+    case kStateListen:
+        VerifyOrExit((flags & (TcpHeader::kFlagSyn | TcpHeader::kFlagRst | TcpHeader::kFlagAck)) ==
+                     TcpHeader::kFlagSyn);
+
+        GetPeerName().GetAddress() = aMessageInfo.GetPeerAddr();
+        mPeerName.mPort            = aHeader.GetSourcePort();
+        GetSockName().GetAddress() = aMessageInfo.GetSockAddr();
+
+        InitConnection();
+        mReceiveNext = aHeader.GetSequenceNumber() + 1;
+        mSendWindow  = aHeader.GetWindow();
+        ParseOptions(aMessage, aHeader);
+
+        mState = kStateSynReceived;
+        SendSegment(TcpHeader::kFlagSyn | TcpHeader::kFlagAck, mSendUnacked, 0, 0);
+        mSendNext = mSendUnacked + 1;
+        StartTimer(mRetransmitTimeout);
+        break;
+
+    case kStateSynSent:
+        if (flags & TcpHeader::kFlagAck)
+        {
+            VerifyOrExit(aHeader.GetAcknowledgmentNumber() == mSendNext);
+        }
+
+        if (flags & TcpHeader::kFlagRst)
+        {
+            // The peer refused the connection.
+            if (flags & TcpHeader::kFlagAck)
+            {
+                Terminate(OT_TCP_EVENT_ABORTED);
+            }
+
+            ExitNow();
+        }
+
+        VerifyOrExit(flags & TcpHeader::kFlagSyn);
+
+        mReceiveNext = aHeader.GetSequenceNumber() + 1;
+        mSendWindow  = aHeader.GetWindow();
+        ParseOptions(aMessage, aHeader);
+
+        if (flags & TcpHeader::kFlagAck)
+        {
+            mSendUnacked     = mSendNext;
+            mState           = kStateEstablished;
+            mRetransmitCount = 0;
+            StopTimer();
+
+            // Acknowledge the SYN, along with any data queued while connecting.
+            Transmit(true);
+            Notify(OT_TCP_EVENT_CONNECTED);
+        }
+        else
+        {
+            // Simultaneous open.
+            mState = kStateSynReceived;
+            SendSegment(TcpHeader::kFlagSyn | TcpHeader::kFlagAck, mSendUnacked, 0, 0);
+        }
+
+        break;
+
+    case kStateClosed:
+        break;
+
+    default:
+        HandleSynchronizedSegment(aMessage, aHeader);
+        break;
+    }
+
+exit:
+    return;
+}
+
+void TcpSocket::HandleSynchronizedSegment(Message &aMessage, const TcpHeader &aHeader)
+{
+    uint8_t  flags      = aHeader.GetControlFlags();
+    uint32_t sequence   = aHeader.GetSequenceNumber();
+    uint16_t length     = aMessage.GetLength() - aMessage.GetOffset();
+    bool     sendAck    = false;
+    bool     connected  = false;
+    bool     peerClosed = false;
+    bool     hasPayload = (length > 0) || (flags & TcpHeader::kFlagFin);
+
+    // Skip the part of a retransmitted segment that has already been received.
+    if (IsBefore(sequence, mReceiveNext) && IsAfter(sequence + length, mReceiveNext))
+    {
+        uint16_t duplicate = static_cast<uint16_t>(mReceiveNext - sequence);
+
+        aMessage.MoveOffset(duplicate);
+        length -= duplicate;
+        sequence = mReceiveNext;
+    }
+
+    if (sequence != mReceiveNext)
+    {
+        // Out-of-order data is not buffered. The duplicate acknowledgment lets the peer fast-retransmit the segment
+        // that is missing, after which it resends the rest of its window.
+        if (!(flags & TcpHeader::kFlagRst))
+        {
+            SendSegment(TcpHeader::kFlagAck, mSendNext, 0, 0);
+        }
+
+        ExitNow();
+    }
+
+    if (flags & TcpHeader::kFlagRst)
+    {
+        Terminate(OT_TCP_EVENT_ABORTED);
+        ExitNow();
+    }
+
+    if (flags & TcpHeader::kFlagSyn)
+    {
+        SendSegment(TcpHeader::kFlagRst, mSendNext, 0, 0);
+        Terminate(OT_TCP_EVENT_ABORTED);
+        ExitNow();
+    }
+
+    VerifyOrExit(flags & TcpHeader::kFlagAck);
+
+    if (mState == kStateSynReceived)
+    {
+        VerifyOrExit(aHeader.GetAcknowledgmentNumber() == mSendNext);
+
+        mSendUnacked     = mSendNext;
+        mState           = kStateEstablished;
+        mRetransmitCount = 0;
+        StopTimer();
+        connected = true;
+    }
+
+    VerifyOrExit(HandleAck(aHeader, hasPayload));
+
+    if (length > 0)
+    {
+        if (mState == kStateEstablished || mState == kStateFinWait1 || mState == kStateFinWait2)
+        {
+            mReceiveNext += length;
+
+            if (mReceiveHandler != NULL)
+            {
+                mReceiveHandler(mContext, this, &aMessage);
+                VerifyOrExit(mState != kStateClosed);
+            }
+        }
+
+        sendAck = true;
+    }
+
+    if (flags & TcpHeader::kFlagFin)
+    {
+        mReceiveNext++;
+        sendAck = true;
+
+        switch (mState)
+        {
+        case kStateEstablished:
+            mState     = kStateCloseWait;
+            peerClosed = true;
+            break;
+
+        case kStateFinWait1:
+            // Our FIN is not acknowledged yet, otherwise `HandleAck()` would have moved to FIN-WAIT-2.
+            mState = kStateClosing;
+            break;
+
+        case kStateFinWait2:
+            mState = kStateTimeWait;
+            StartTimer(kTimeWaitTimeout);
+            break;
+
+        default:
+            break;
+        }
+    }
+
+    Transmit(sendAck);
+
+    if (connected)
+    {
+        Notify(OT_TCP_EVENT_CONNECTED);
+    }
+
+    if (peerClosed && mState == kStateCloseWait)
+    {
+        Notify(OT_TCP_EVENT_PEER_CLOSED);
+    }
+
+exit:
+    return;
+}
+
+bool TcpSocket::HandleAck(const TcpHeader &aHeader, bool aHasPayload)
+{
+    uint32_t ack      = aHeader.GetAcknowledgmentNumber();
+    uint16_t window   = aHeader.GetWindow();
+    uint32_t sendMax  = mSendUnacked + GetSendBufferLength() + ((mFlags & kFlagFinPending) ? 1 : 0);
+    bool     finAcked = false;
+    bool     rval     = true;
+    uint16_t acked;
+    uint32_t congestionWindow;
+
+    if (IsAfter(ack, sendMax))
+    {
+        // Acknowledges data that was never sent.
+        SendSegment(TcpHeader::kFlagAck, mSendNext, 0, 0);
+        ExitNow(rval = false);
+    }
+
+    if (IsAfter(ack, mSendNext))
+    {
+        // After a retransmission timeout `mSendNext` goes back to `mSendUnacked`, while segments sent before may
+        // still be acknowledged.
+        mSendNext = ack;
+
+        if ((mFlags & kFlagFinPending) && ack == sendMax)
+        {
+            mFlags |= kFlagFinSent;
+        }
+    }
+
+    if (!IsAfter(ack, mSendUnacked))
+    {
+        // A duplicate acknowledgment (RFC 5681) signals a segment that was lost while later ones arrived.
+        if (ack == mSendUnacked && !aHasPayload && window == mSendWindow && mSendNext != mSendUnacked &&
+            ++mDuplicateAckCount == kDupAckThreshold)
+        {
+            uint16_t length = GetSendBufferLength();
+            uint8_t  flags  = TcpHeader::kFlagAck;
+
+            if (length > mMaxSegmentSize)
+            {
+                length = mMaxSegmentSize;
+            }
+            else if (mFlags & kFlagFinSent)
+            {
+                flags |= TcpHeader::kFlagFin;
+            }
+
+            EnterLossRecovery();
+            mCongestionWindow = mSlowStartThreshold;
+            SendSegment(flags, mSendUnacked, 0, length);
+        }
+
+        mSendWindow = window;
+        ExitNow();
+    }
+
+    acked = static_cast<uint16_t>(ack - mSendUnacked);
+
+    if ((mFlags & kFlagFinSent) && ack == mSendNext)
+    {
+        finAcked = true;
+        acked--;
+    }
+
+    if (acked > 0)
+    {
+        GetSendBuffer().RemoveHeader(acked);
+    }
+
+    mSendUnacked = ack;
+
+    if ((mFlags & kFlagRttTiming) && IsAfter(ack, mRttSequence))
+    {
+        mFlags &= ~kFlagRttTiming;
+        UpdateRtt(TimerMilli::GetNow() - mRttStartTime);
+    }
+
+    // Slow start and congestion avoidance (RFC 5681). The window never needs to exceed the send buffer.
+    if (mCongestionWindow < mSlowStartThreshold)
+    {
+        congestionWindow = mCongestionWindow + ((acked < mMaxSegmentSize) ? acked : mMaxSegmentSize);
+    }
+    else
+    {
+        congestionWindow = mCongestionWindow + (mMaxSegmentSize * mMaxSegmentSize) / mCongestionWindow + 1;
+    }
+
+    if (congestionWindow > kSendBufferSize)
+    {
+        congestionWindow = kSendBufferSize;
+    }
+
+    mCongestionWindow  = static_cast<uint16_t>(congestionWindow);
+    mSendWindow        = window;
+    mDuplicateAckCount = 0;
+    mRetransmitCount   = 0;
+
+    if (mSendUnacked == mSendNext)
+    {
+        StopTimer();
+    }
+    else
+    {
+        StartTimer(mRetransmitTimeout);
+    }
+
+    if (finAcked)
+    {
+        HandleFinAcked();
+        VerifyOrExit(mState != kStateClosed, rval = false);
+    }
+
+    if (acked > 0)
+    {
+        Notify(OT_TCP_EVENT_SENT);
+        VerifyOrExit(mState != kStateClosed, rval = false);
+    }
+
+exit:
+    return rval;
+}
+
+void TcpSocket::HandleFinAcked(void)
+{
+    switch (mState)
+    {
+    case kStateFinWait1:
+        mState = kStateFinWait2;
+        break;
+
+    case kStateClosing:
+        mState = kStateTimeWait;
+        StartTimer(kTimeWaitTimeout);
+        break;
+
+    case kStateLastAck:
+        Terminate(OT_TCP_EVENT_CLOSED);
+        break;
+
+    default:
+        break;
+    }
+}
+
+void TcpSocket::ParseOptions(const Message &aMessage, const TcpHeader &aHeader)
+{
+    // The message offset is at the payload, the options are between the fixed header and the payload.
+    uint16_t offset = aMessage.GetOffset() - aHeader.GetHeaderLength() + sizeof(TcpHeader);
+    uint8_t  option[TcpHeader::kOptionMaxSegmentSizeLen];
+
+    while (offset < aMessage.GetOffset())
+    {
+        VerifyOrExit(aMessage.Read(offset, 1, option) == 1);
+
+        if (option[0] == TcpHeader::kOptionEnd)
+        {
+            break;
+        }
+
+        if (option[0] == TcpHeader::kOptionNop)
+        {
+            offset++;
+            continue;
+        }
+
+        VerifyOrExit(aMessage.Read(offset, 2, option) == 2);
+        VerifyOrExit(option[1] >= 2 && offset + option[1] <= aMessage.GetOffset());
+
+        if (option[0] == TcpHeader::kOptionMaxSegmentSize && option[1] == TcpHeader::kOptionMaxSegmentSizeLen)
+        {
+            uint16_t maxSegmentSize;
+
+            aMessage.Read(offset, sizeof(option), option);
+            maxSegmentSize = static_cast<uint16_t>((option[2] << 8) | option[3]);
+
+            if (maxSegmentSize > 0 && maxSegmentSize < mMaxSegmentSize)
+            {
+                mMaxSegmentSize = maxSegmentSize;
+            }
+        }
+
+        offset += option[1];
+    }
+
+exit:
+    mCongestionWindow = 2 * mMaxSegmentSize;
+}
+
+void TcpSocket::UpdateRtt(uint32_t aRtt)
+{
+    uint16_t rtt;
+    uint32_t retransmitTimeout;
+
+    if (aRtt > kMaxRto)
+    {
+        aRtt = kMaxRto;
+    }
+
+    rtt = static_cast<uint16_t>((aRtt > 0) ? aRtt : 1);
+
+    // RFC 6298, with `mSmoothedRtt` of zero meaning there is no measurement yet.
+    if (mSmoothedRtt == 0)
+    {
+        mSmoothedRtt = rtt;
+        mRttVariance = rtt / 2;
+    }
+    else
+    {
+        uint16_t delta = (mSmoothedRtt > rtt) ? (mSmoothedRtt - rtt) : (rtt - mSmoothedRtt);
+
+        mRttVariance = static_cast<uint16_t>((3 * static_cast<uint32_t>(mRttVariance) + delta) / 4);
+        mSmoothedRtt = static_cast<uint16_t>((7 * static_cast<uint32_t>(mSmoothedRtt) + rtt) / 8);
+    }
+
+    retransmitTimeout = mSmoothedRtt + 4 * static_cast<uint32_t>(mRttVariance);
+
+    if (retransmitTimeout < kMinRto)
+    {
+        retransmitTimeout = kMinRto;
+    }
+    else if (retransmitTimeout > kMaxRto)
+    {
+        retransmitTimeout = kMaxRto;
+    }
+
+    mRetransmitTimeout = static_cast<uint16_t>(retransmitTimeout);
+}
+
+void TcpSocket::EnterLossRecovery(void)
+{
+    uint16_t threshold = GetBytesInFlight() / 2;
+
+    mSlowStartThreshold = (threshold > 2 * mMaxSegmentSize) ? threshold : 2 * mMaxSegmentSize;
+    mDuplicateAckCount  = 0;
+    mFlags &= ~kFlagRttTiming;
+}
+
+void TcpSocket::Transmit(bool aForceAck)
+{
+    bool sent = false;
+
+    // FIN-WAIT-2 and TIME-WAIT have nothing left to send, but the other synchronized states may have data or a FIN
+    // to (re)transmit.
+    while (IsSynchronized() && mState != kStateFinWait2 && mState != kStateTimeWait)
+    {
+        uint16_t length = GetSendBufferLength();
+        uint16_t offset = GetBytesInFlight();
+        uint16_t window = (mSendWindow < mCongestionWindow) ? mSendWindow : mCongestionWindow;
+        uint8_t  flags  = TcpHeader::kFlagAck;
+        uint16_t segmentLength;
+
+        if (offset >= length)
+        {
+            VerifyOrExit((mFlags & kFlagFinPending) && !(mFlags & kFlagFinSent));
+            segmentLength = 0;
+            flags |= TcpHeader::kFlagFin;
+        }
+        else
+        {
+            VerifyOrExit(offset < window);
+
+            segmentLength = length - offset;
+
+            if (segmentLength > window - offset)
+            {
+                segmentLength = window - offset;
+            }
+
+            if (segmentLength > mMaxSegmentSize)
+            {
+                segmentLength = mMaxSegmentSize;
+            }
+
+            if (offset + segmentLength == length)
+            {
+                flags |= TcpHeader::kFlagPsh;
+
+                if (mFlags & kFlagFinPending)
+                {
+                    flags |= TcpHeader::kFlagFin;
+                }
+            }
+        }
+
+        SuccessOrExit(SendSegment(flags, mSendNext, offset, segmentLength));
+        sent = true;
+
+        if (!(mFlags & kFlagRttTiming) && mRetransmitCount == 0)
+        {
+            mFlags |= kFlagRttTiming;
+            mRttSequence  = mSendNext;
+            mRttStartTime = TimerMilli::GetNow();
+        }
+
+        mSendNext += segmentLength;
+
+        if (flags & TcpHeader::kFlagFin)
+        {
+            mSendNext++;
+            mFlags |= kFlagFinSent;
+
+            if (mState == kStateEstablished)
+            {
+                mState = kStateFinWait1;
+            }
+            else if (mState == kStateCloseWait)
+            {
+                mState = kStateLastAck;
+            }
+        }
+    }
+
+exit:
+    if (aForceAck && !sent)
+    {
+        SendSegment(TcpHeader::kFlagAck, mSendNext, 0, 0);
+    }
+
+    // Keep the timer running while data is in flight, or as a persist timer while data waits for the window.
+    if (!(mFlags & kFlagTimerRunning) && IsSynchronized() && mState != kStateTimeWait &&
+        (mSendNext != mSendUnacked || GetSendBufferLength() > 0))
+    {
+        StartTimer(mRetransmitTimeout);
+    }
+}
+
+void TcpSocket::Retransmit(void)
+{
+    switch (mState)
+    {
+    case kStateSynSent:
+        SendSegment(TcpHeader::kFlagSyn, mSendUnacked, 0, 0);
+        break;
+
+    case kStateSynReceived:
+        SendSegment(TcpHeader::kFlagSyn | TcpHeader::kFlagAck, mSendUnacked, 0, 0);
+        break;
+
+    default:
+        EnterLossRecovery();
+        mCongestionWindow = mMaxSegmentSize;
+
+        if (mSendWindow == 0 && mSendNext == mSendUnacked && GetSendBufferLength() > 0)
+        {
+            // Probe the closed window of the peer with a single byte.
+            SuccessOrExit(SendSegment(TcpHeader::kFlagAck, mSendUnacked, 0, 1));
+            mSendNext++;
+        }
+        else
+        {
+            // Go back to the oldest unacknowledged byte, resending the FIN too if it was already sent.
+            mSendNext = mSendUnacked;
+            mFlags &= ~kFlagFinSent;
+            Transmit(false);
+        }
+
+        break;
+    }
+
+exit:
+    return;
+}
+
+otError TcpSocket::SendSegment(uint8_t aFlags, uint32_t aSequence, uint16_t aOffset, uint16_t aLength)
+{
+    otError     error        = OT_ERROR_NONE;
+    Message *   message      = NULL;
+    uint8_t     headerLength = sizeof(TcpHeader);
+    MessageInfo messageInfo;
+    TcpHeader   header;
+    uint8_t     option[TcpHeader::kOptionMaxSegmentSizeLen];
+
+    if (aFlags & TcpHeader::kFlagSyn)
+    {
+        headerLength += sizeof(option);
+    }
+
+    VerifyOrExit((message = GetIp6().NewMessage(0)) != NULL, error = OT_ERROR_NO_BUFS);
+    SuccessOrExit(error = message->SetLength(headerLength + aLength));
+
+    header.Init(headerLength);
+    header.SetSourcePort(mSockName.mPort);
+    header.SetDestinationPort(mPeerName.mPort);
+    header.SetSequenceNumber(aSequence);
+    header.SetControlFlags(aFlags);
+    header.SetWindow(kReceiveWindow);
+
+    if (aFlags & TcpHeader::kFlagAck)
+    {
+        header.SetAcknowledgmentNumber(mReceiveNext);
+    }
+
+    message->Write(0, sizeof(header), &header);
+
+    if (aFlags & TcpHeader::kFlagSyn)
+    {
+        option[0] = TcpHeader::kOptionMaxSegmentSize;
+        option[1] = TcpHeader::kOptionMaxSegmentSizeLen;
+        option[2] = static_cast<uint8_t>(kMaxSegmentSize >> 8);
+        option[3] = static_cast<uint8_t>(kMaxSegmentSize & 0xff);
+        message->Write(sizeof(header), sizeof(option), option);
+    }
+
+    if (aLength > 0)
+    {
+        GetSendBuffer().CopyTo(aOffset, headerLength, aLength, *message);
+    }
+
+    messageInfo.SetPeerAddr(GetPeerName().GetAddress());
+    messageInfo.SetSockAddr(GetSockName().GetAddress());
+
+    SuccessOrExit(error = GetIp6().SendDatagram(*message, messageInfo, kProtoTcp));
+
+exit:
+
+    if (error != OT_ERROR_NONE && message != NULL)
+    {
+        message->Free();
+    }
+
+    return error;
+}
+
+void TcpSocket::StartTimer(uint32_t aDelay)
+{
+    mTimerFireTime = TimerMilli::GetNow() + aDelay;
+    mFlags |= kFlagTimerRunning;
+    GetTcp().ScheduleTimer();
+}
+
+void TcpSocket::HandleTimer(void)
+{
+    switch (mState)
+    {
+    case kStateClosed:
+    case kStateListen:
+    case kStateFinWait2:
+        break;
+
+    case kStateTimeWait:
+        Terminate(OT_TCP_EVENT_CLOSED);
+        break;
+
+    default:
+        if (mRetransmitCount >= kMaxRetransmissions)
+        {
+            Abort();
+            Notify(OT_TCP_EVENT_ABORTED);
+            ExitNow();
+        }
+
+        mRetransmitCount++;
+        // Exponential backoff (RFC 6298), bounded by `kMaxRto`.
+        mRetransmitTimeout = (mRetransmitTimeout > kMaxRto / 2) ? static_cast<uint16_t>(kMaxRto)
+                                                                 : static_cast<uint16_t>(2 * mRetransmitTimeout);
+
+        Retransmit();
+        StartTimer(mRetransmitTimeout);
+        break;
+    }
+
+exit:
+    return;
+}
+
+void TcpSocket::Terminate(otTcpEvent aEvent)
+{
+    Release();
+    Notify(aEvent);
+}
+
+void TcpSocket::Release(void)
+{
+    if (mSendBuffer != NULL)
+    {
+        GetSendBuffer().Free();
+        mSendBuffer = NULL;
+    }
+
+    mState = kStateClosed;
+    StopTimer();
+    GetTcp().RemoveSocket(*this);
+}
+
+void TcpSocket::Notify(otTcpEvent aEvent)
+{
+    if (mEventHandler != NULL)
+    {
+        mEventHandler(mContext, this, aEvent);
+    }
+}
+
+Tcp::Tcp(Instance &aInstance)
+    : InstanceLocator(aInstance)
+    , mSockets(NULL)
+    , mEphemeralPort(kDynamicPortMin)
+    , mTimer(aInstance, &Tcp::HandleTimer, this)
+{
+}
+
+bool Tcp::IsSocketOpen(const TcpSocket &aSocket) const
+{
+    bool rval = false;
+
+    for (TcpSocket *socket = mSockets; socket != NULL; socket = socket->GetNext())
+    {
+        VerifyOrExit(socket != &aSocket, rval = true);
+    }
+
+exit:
+    return rval;
+}
+
+void Tcp::AddSocket(TcpSocket &aSocket)
+{
+    aSocket.SetNext(mSockets);
+    mSockets = &aSocket;
+}
+
+void Tcp::RemoveSocket(TcpSocket &aSocket)
+{
+    if (mSockets == &aSocket)
+    {
+        mSockets = aSocket.GetNext();
+    }
+    else
+    {
+        for (TcpSocket *socket = mSockets; socket != NULL; socket = socket->GetNext())
+        {
+            if (socket->GetNext() == &aSocket)
+            {
+                socket->SetNext(aSocket.GetNext());
+                break;
+            }
+        }
+    }
+
+    aSocket.SetNext(NULL);
+}
+
+TcpSocket *Tcp::FindSocket(const MessageInfo &aMessageInfo)
+{
+    TcpSocket *listener = NULL;
+    TcpSocket *socket;
+
+    // A connection matching both endpoints takes precedence over a listening socket.
+    for (socket = mSockets; socket != NULL; socket = socket->GetNext())
+    {
+        if (socket->mState == TcpSocket::kStateClosed || socket->GetSockName().mPort != aMessageInfo.GetSockPort())
+        {
+            continue;
+        }
+
+        if (!socket->GetSockName().GetAddress().IsUnspecified() &&
+            socket->GetSockName().GetAddress() != aMessageInfo.GetSockAddr())
+        {
+            continue;
+        }
+
+        if (socket->mState == TcpSocket::kStateListen)
+        {
+            if (listener == NULL)
+            {
+                listener = socket;
+            }
+
+            continue;
+        }
+
+        if (socket->GetPeerName().mPort == aMessageInfo.GetPeerPort() &&
+            socket->GetPeerName().GetAddress() == aMessageInfo.GetPeerAddr())
+        {
+            ExitNow();
+        }
+    }
+
+    socket = listener;
+
+exit:
+    return socket;
+}
+
+uint16_t Tcp::GetEphemeralPort(void)
+{
+    uint16_t rval = mEphemeralPort;
+
+    if (mEphemeralPort < kDynamicPortMax)
+    {
+        mEphemeralPort++;
+    }
+    else
+    {
+        mEphemeralPort = kDynamicPortMin;
+    }
+
+    return rval;
+}
+
+void Tcp::ScheduleTimer(void)
+{
+    TcpSocket *next = NULL;
+
+    for (TcpSocket *socket = mSockets; socket != NULL; socket = socket->GetNext())
+    {
+        if ((socket->mFlags & TcpSocket::kFlagTimerRunning) &&
+            (next == NULL || IsBefore(socket->mTimerFireTime, next->mTimerFireTime)))
+        {
+            next = socket;
+        }
+    }
+
+    if (next == NULL)
+    {
+        mTimer.Stop();
+    }
+    else
+    {
+        uint32_t now = TimerMilli::GetNow();
+
+        mTimer.StartAt(now, IsAfter(next->mTimerFireTime, now) ? next->mTimerFireTime - now : 0);
+    }
+}
+
+void Tcp::HandleTimer(Timer &aTimer)
+{
+    aTimer.GetOwner<Tcp>().HandleTimer();
+}
+
+void Tcp::HandleTimer(void)
+{
+    uint32_t   now = TimerMilli::GetNow();
+    TcpSocket *socket;
+
+    // Handling a socket may release any socket, so the list is searched again after each one.
+    do
+    {
+        for (socket = mSockets; socket != NULL; socket = socket->GetNext())
+        {
+            if ((socket->mFlags & TcpSocket::kFlagTimerRunning) && !IsBefore(now, socket->mTimerFireTime))
+            {
+                break;
+            }
+        }
+
+        if (socket != NULL)
+        {
+            socket->StopTimer();
+            socket->HandleTimer();
+        }
+    } while (socket != NULL);
+
+    ScheduleTimer();
+}
+
+otError Tcp::HandleMessage(Message &aMessage, MessageInfo &aMessageInfo)
+{
+    otError    error = OT_ERROR_NONE;
+    TcpHeader  tcpHeader;
+    uint16_t   payloadLength;
+    uint16_t   checksum;
+    TcpSocket *socket;
+
+    payloadLength = aMessage.GetLength() - aMessage.GetOffset();
+
+    // check length
+    VerifyOrExit(payloadLength >= sizeof(TcpHeader), error = OT_ERROR_PARSE);
+
+    // verify checksum
+    checksum = Ip6::ComputePseudoheaderChecksum(aMessageInfo.GetPeerAddr(), aMessageInfo.GetSockAddr(), payloadLength,
+                                                kProtoTcp);
+    checksum = aMessage.UpdateChecksum(checksum, aMessage.GetOffset(), payloadLength);
+
+#ifndef FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION
+    VerifyOrExit(checksum == 0xffff, error = OT_ERROR_DROP);
+#endif
+
+    aMessage.Read(aMessage.GetOffset(), sizeof(tcpHeader), &tcpHeader);
+    VerifyOrExit(tcpHeader.GetHeaderLength() >= sizeof(tcpHeader) && tcpHeader.GetHeaderLength() <= payloadLength,
+                 error = OT_ERROR_PARSE);
+    VerifyOrExit(!aMessageInfo.GetSockAddr().IsMulticast(), error = OT_ERROR_DROP);
+
+    aMessageInfo.mPeerPort = tcpHeader.GetSourcePort();
+    aMessageInfo.mSockPort = tcpHeader.GetDestinationPort();
+
+    // Segments for unknown connections are not reset, a host-side TCP stack may be handling them.
+    VerifyOrExit((socket = FindSocket(aMessageInfo)) != NULL);
+
+    aMessage.MoveOffset(tcpHeader.GetHeaderLength());
+    socket->HandleSegment(aMessage, aMessageInfo, tcpHeader);
+
+exit:
+    return error;
+}
+
+otError Tcp::UpdateChecksum(Message &aMessage, uint16_t aChecksum)
+{
+    aChecksum = aMessage.UpdateChecksum(aChecksum, aMessage.GetOffset(), aMessage.GetLength() - aMessage.GetOffset());
+    aChecksum = HostSwap16(~aChecksum);
+    aMessage.Write(aMessage.GetOffset() + TcpHeader::GetChecksumOffset(), sizeof(aChecksum), &aChecksum);
+    return OT_ERROR_NONE;
+}
+
+} // namespace Ip6
+} // namespace ot
+
+#endif // OPENTHREAD_CONFIG_ENABLE_TCP
@@ -28,7 +28,7 @@
 
 /**
  * @file
- *   This file includes definitions for parsing TCP header.
+ *   This file includes definitions for the TCP header and TCP/IPv6 sockets.
  */
 
 #ifndef TCP_HPP_
@@ -36,6 +36,12 @@
 
 #include "openthread-core-config.h"
 
+#include <string.h>
+
+#include <openthread/tcp.h>
+
+#include "common/locator.hpp"
+#include "common/timer.hpp"
 #include "net/ip6_headers.hpp"
 
 namespace ot {
@@ -45,7 +51,7 @@ namespace Ip6 {
  * @addtogroup core-tcp
  *
  * @brief
- *   This module includes definitions for parsing TCP header
+ *   This module includes definitions for the TCP header and TCP/IPv6 sockets.
  *
  * @{
  *
@@ -65,13 +71,51 @@ struct TcpHeaderPoD
 } OT_TOOL_PACKED_END;
 
 /**
- * This class implements TCP header parsing.
+ * This class implements TCP header generation and parsing.
  *
  */
 OT_TOOL_PACKED_BEGIN
 class TcpHeader : private TcpHeaderPoD
 {
 public:
+    /**
+     * TCP control flags.
+     *
+     */
+    enum
+    {
+        kFlagFin = 1 << 0, ///< No more data from sender.
+        kFlagSyn = 1 << 1, ///< Synchronize sequence numbers.
+        kFlagRst = 1 << 2, ///< Reset the connection.
+        kFlagPsh = 1 << 3, ///< Push function.
+        kFlagAck = 1 << 4, ///< Acknowledgment field significant.
+        kFlagUrg = 1 << 5, ///< Urgent pointer field significant.
+    };
+
+    /**
+     * TCP option kinds.
+     *
+     */
+    enum
+    {
+        kOptionEnd               = 0, ///< End of option list.
+        kOptionNop               = 1, ///< No-operation.
+        kOptionMaxSegmentSize    = 2, ///< Maximum segment size.
+        kOptionMaxSegmentSizeLen = 4, ///< Length of the maximum segment size option.
+    };
+
+    /**
+     * This method initializes the TCP header with the header length set and all other fields zeroed.
+     *
+     * @param[in]  aHeaderLength  The TCP header length in bytes, including options.
+     *
+     */
+    void Init(uint8_t aHeaderLength)
+    {
+        memset(this, 0, sizeof(*this));
+        mFlags = HostSwap16(static_cast<uint16_t>((aHeaderLength / 4) << kDataOffsetShift));
+    }
+
     /**
      * This method returns the TCP Source Port.
      *
@@ -80,6 +124,14 @@ public:
      */
     uint16_t GetSourcePort(void) const { return HostSwap16(mSource); }
 
+    /**
+     * This method sets the TCP Source Port.
+     *
+     * @param[in]  aPort  The TCP Source Port.
+     *
+     */
+    void SetSourcePort(uint16_t aPort) { mSource = HostSwap16(aPort); }
+
     /**
      * This method returns the TCP Destination Port.
      *
@@ -88,6 +140,14 @@ public:
      */
     uint16_t GetDestinationPort(void) const { return HostSwap16(mDestination); }
 
+    /**
+     * This method sets the TCP Destination Port.
+     *
+     * @param[in]  aPort  The TCP Destination Port.
+     *
+     */
+    void SetDestinationPort(uint16_t aPort) { mDestination = HostSwap16(aPort); }
+
     /**
      * This method returns the TCP Sequence Number.
      *
@@ -96,6 +156,14 @@ public:
      */
     uint32_t GetSequenceNumber(void) const { return HostSwap32(mSequenceNumber); }
 
+    /**
+     * This method sets the TCP Sequence Number.
+     *
+     * @param[in]  aSequenceNumber  The TCP Sequence Number.
+     *
+     */
+    void SetSequenceNumber(uint32_t aSequenceNumber) { mSequenceNumber = HostSwap32(aSequenceNumber); }
+
     /**
      * This method returns the TCP Acknowledgment Sequence Number.
      *
@@ -104,6 +172,14 @@ public:
      */
     uint32_t GetAcknowledgmentNumber(void) const { return HostSwap32(mAckNumber); }
 
+    /**
+     * This method sets the TCP Acknowledgment Sequence Number.
+     *
+     * @param[in]  aAckNumber  The TCP Acknowledgment Sequence Number.
+     *
+     */
+    void SetAcknowledgmentNumber(uint32_t aAckNumber) { mAckNumber = HostSwap32(aAckNumber); }
+
     /**
      * This method returns the TCP Flags.
      *
@@ -112,6 +188,33 @@ public:
      */
     uint16_t GetFlags(void) const { return HostSwap16(mFlags); }
 
+    /**
+     * This method returns the TCP control flags (the `kFlag*` bits).
+     *
+     * @returns The TCP control flags.
+     *
+     */
+    uint8_t GetControlFlags(void) const { return static_cast<uint8_t>(GetFlags() & kControlFlagsMask); }
+
+    /**
+     * This method sets the TCP control flags (the `kFlag*` bits), keeping the header length.
+     *
+     * @param[in]  aFlags  The TCP control flags.
+     *
+     */
+    void SetControlFlags(uint8_t aFlags)
+    {
+        mFlags = HostSwap16(static_cast<uint16_t>((GetFlags() & ~kControlFlagsMask) | aFlags));
+    }
+
+    /**
+     * This method returns the TCP header length, including options.
+     *
+     * @returns The TCP header length in bytes.
+     *
+     */
+    uint8_t GetHeaderLength(void) const { return static_cast<uint8_t>((GetFlags() >> kDataOffsetShift) * 4); }
+
     /**
      * This method returns the TCP Window.
      *
@@ -120,6 +223,14 @@ public:
      */
     uint16_t GetWindow(void) const { return HostSwap16(mWindow); }
 
+    /**
+     * This method sets the TCP Window.
+     *
+     * @param[in]  aWindow  The TCP Window.
+     *
+     */
+    void SetWindow(uint16_t aWindow) { mWindow = HostSwap16(aWindow); }
+
     /**
      * This method returns the TCP Checksum.
      *
@@ -136,8 +247,290 @@ public:
      */
     uint16_t GetUrgentPointer(void) const { return HostSwap16(mUrgentPointer); }
 
+    /**
+     * This static method returns the byte offset for the TCP Checksum.
+     *
+     * @returns The byte offset for the TCP Checksum.
+     *
+     */
+    static uint8_t GetChecksumOffset(void) { return offsetof(TcpHeaderPoD, mChecksum); }
+
+private:
+    enum
+    {
+        kDataOffsetShift  = 12,
+        kControlFlagsMask = 0x3f,
+    };
 } OT_TOOL_PACKED_END;
 
+#if OPENTHREAD_CONFIG_ENABLE_TCP
+
+class Tcp;
+
+/**
+ * This class implements a TCP/IPv6 socket.
+ *
+ * A socket carries a single connection. Data queued with `Send()` is kept in a message from the message pool until
+ * the peer acknowledges it, and received data is handed to the application in order as it arrives.
+ *
+ */
+class TcpSocket : public otTcpSocket, public InstanceLocator
+{
+    friend class Tcp;
+
+public:
+    /**
+     * This enumeration represents the TCP connection states.
+     *
+     */
+    enum State
+    {
+        kStateClosed      = 0,  ///< No connection.
+        kStateListen      = 1,  ///< Waiting for a connection request.
+        kStateSynSent     = 2,  ///< Waiting for a matching connection request after sending one.
+        kStateSynReceived = 3,  ///< Waiting for the acknowledgment of the connection request.
+        kStateEstablished = 4,  ///< The connection is open.
+        kStateFinWait1    = 5,  ///< Waiting for the acknowledgment of our FIN.
+        kStateFinWait2    = 6,  ///< Waiting for the FIN of the peer.
+        kStateCloseWait   = 7,  ///< The peer has closed, waiting for the local close.
+        kStateClosing     = 8,  ///< Both sides closed simultaneously, waiting for the acknowledgment of our FIN.
+        kStateLastAck     = 9,  ///< Waiting for the acknowledgment of our FIN after the peer closed.
+        kStateTimeWait    = 10, ///< Waiting for delayed segments of the closed connection to expire.
+    };
+
+    /**
+     * This constructor initializes the object.
+     *
+     * @param[in]  aTcp  A reference to the TCP transport object.
+     *
+     */
+    explicit TcpSocket(Tcp &aTcp);
+
+    /**
+     * This method opens the TCP socket.
+     *
+     * @param[in]  aReceiveHandler  A pointer to a function that is called when receiving data.
+     * @param[in]  aEventHandler    A pointer to a function that is called on socket events.
+     * @param[in]  aContext         A pointer to arbitrary context information.
+     *
+     * @retval OT_ERROR_NONE     Successfully opened the socket.
+     * @retval OT_ERROR_ALREADY  The socket is already open.
+     *
+     */
+    otError Open(otTcpReceive aReceiveHandler, otTcpEventHandler aEventHandler, void *aContext);
+
+    /**
+     * This method binds the TCP socket.
+     *
+     * @param[in]  aSockAddr  A reference to the socket address.
+     *
+     * @retval OT_ERROR_NONE           Successfully bound the socket.
+     * @retval OT_ERROR_INVALID_STATE  The socket is not closed.
+     *
+     */
+    otError Bind(const SockAddr &aSockAddr);
+
+    /**
+     * This method makes the TCP socket wait for an incoming connection.
+     *
+     * @retval OT_ERROR_NONE           The socket is listening.
+     * @retval OT_ERROR_INVALID_STATE  The socket is not closed or not bound to a port.
+     *
+     */
+    otError Listen(void);
+
+    /**
+     * This method starts establishing a connection to a peer.
+     *
+     * @param[in]  aPeerName  A reference to the peer socket address.
+     *
+     * @retval OT_ERROR_NONE           Successfully sent the connection request.
+     * @retval OT_ERROR_INVALID_ARGS   The peer address or port is unspecified.
+     * @retval OT_ERROR_INVALID_STATE  The socket is not closed.
+     * @retval OT_ERROR_NO_BUFS        Insufficient buffers to send the connection request.
+     *
+     */
+    otError Connect(const SockAddr &aPeerName);
+
+    /**
+     * This method queues data for transmission.
+     *
+     * @param[in]  aBuf     A pointer to the data.
+     * @param[in]  aLength  The number of bytes.
+     *
+     * @retval OT_ERROR_NONE           Successfully queued all of the data.
+     * @retval OT_ERROR_INVALID_STATE  The socket cannot send data in its current state.
+     * @retval OT_ERROR_NO_BUFS        The send buffer does not have room for @p aLength bytes.
+     *
+     */
+    otError Send(const void *aBuf, uint16_t aLength);
+
+    /**
+     * This method returns the free space in the send buffer.
+     *
+     * @returns The number of bytes that can currently be queued.
+     *
+     */
+    uint16_t GetSendBufferSpace(void) const;
+
+    /**
+     * This method closes the connection gracefully, after all queued data has been delivered.
+     *
+     * @retval OT_ERROR_NONE           Successfully started closing the connection.
+     * @retval OT_ERROR_INVALID_STATE  The connection is already closing.
+     *
+     */
+    otError Close(void);
+
+    /**
+     * This method resets the connection, if any, and releases the socket.
+     *
+     */
+    void Abort(void);
+
+    /**
+     * This method returns the connection state.
+     *
+     * @returns The connection state.
+     *
+     */
+    State GetState(void) const { return static_cast<State>(mState); }
+
+    /**
+     * This method returns the local socket address.
+     *
+     * @returns A reference to the local socket address.
+     *
+     */
+    SockAddr &GetSockName(void) { return *static_cast<SockAddr *>(&mSockName); }
+
+    /**
+     * This method returns the peer's socket address.
+     *
+     * @returns A reference to the peer's socket address.
+     *
+     */
+    SockAddr &GetPeerName(void) { return *static_cast<SockAddr *>(&mPeerName); }
+
+private:
+    enum
+    {
+        kFlagFinPending   = 1 << 0, ///< The application closed the connection, a FIN follows the queued data.
+        kFlagFinSent      = 1 << 1, ///< The FIN has been sent and occupies `mSendNext - 1`.
+        kFlagTimerRunning = 1 << 2, ///< `mTimerFireTime` is valid.
+        kFlagRttTiming    = 1 << 3, ///< `mRttSequence` is being timed.
+    };
+
+    enum
+    {
+        kInitialRto         = 1000,  ///< Initial retransmission timeout in ms (RFC 6298).
+        kMinRto             = 1000,  ///< Minimum retransmission timeout in ms (RFC 6298).
+        kMaxRto             = 60000, ///< Maximum retransmission timeout in ms.
+        kMaxRetransmissions = 8,     ///< Number of retransmissions before the connection is aborted.
+        kDupAckThreshold    = 3,     ///< Number of duplicate acknowledgments that trigger a fast retransmit.
+        kTimeWaitTimeout    = 10000, ///< Time spent in TIME-WAIT in ms.
+        kSendBufferSize     = OPENTHREAD_CONFIG_TCP_SEND_BUFFER_SIZE,
+        kReceiveWindow      = OPENTHREAD_CONFIG_TCP_RECEIVE_WINDOW,
+        kMaxSegmentSize     = OPENTHREAD_CONFIG_TCP_MSS,
+    };
+
+    TcpSocket *GetNext(void) { return static_cast<TcpSocket *>(mNext); }
+    void       SetNext(TcpSocket *aSocket) { mNext = static_cast<otTcpSocket *>(aSocket); }
+
+    Tcp &    GetTcp(void);
+    Message &GetSendBuffer(void) { return *static_cast<Message *>(mSendBuffer); }
+
+    bool IsSynchronized(void) const { return mState >= kStateEstablished; }
+    bool CanSendData(void) const { return mState == kStateEstablished || mState == kStateCloseWait; }
+
+    void     InitConnection(void);
+    uint16_t GetSendBufferLength(void) const;
+    uint16_t GetBytesInFlight(void) const;
+    void     HandleSegment(Message &aMessage, const MessageInfo &aMessageInfo, const TcpHeader &aHeader);
+    void     HandleSynchronizedSegment(Message &aMessage, const TcpHeader &aHeader);
+    bool     HandleAck(const TcpHeader &aHeader, bool aHasPayload);
+    void     HandleFinAcked(void);
+    void     ParseOptions(const Message &aMessage, const TcpHeader &aHeader);
+    void     UpdateRtt(uint32_t aRtt);
+    void     EnterLossRecovery(void);
+    void     Transmit(bool aForceAck);
+    void     Retransmit(void);
+    otError  SendSegment(uint8_t aFlags, uint32_t aSequence, uint16_t aOffset, uint16_t aLength);
+    void     StartTimer(uint32_t aDelay);
+    void     StopTimer(void) { mFlags &= ~kFlagTimerRunning; }
+    void     HandleTimer(void);
+    void     Terminate(otTcpEvent aEvent);
+    void     Release(void);
+    void     Notify(otTcpEvent aEvent);
+};
+
+/**
+ * This class implements core TCP message handling.
+ *
+ */
+class Tcp : public InstanceLocator
+{
+    friend class TcpSocket;
+
+public:
+    /**
+     * This constructor initializes the object.
+     *
+     * @param[in]  aInstance  A reference to OpenThread instance.
+     *
+     */
+    explicit Tcp(Instance &aInstance);
+
+    /**
+     * This method handles a received TCP segment.
+     *
+     * Segments that match no socket are silently dropped, since they may be meant for a host-side TCP stack.
+     *
+     * @param[in]  aMessage      A reference to the TCP segment to process.
+     * @param[in]  aMessageInfo  A reference to the message info associated with @p aMessage.
+     *
+     * @retval OT_ERROR_NONE   Successfully processed the TCP segment.
+     * @retval OT_ERROR_PARSE  The TCP segment is malformed.
+     * @retval OT_ERROR_DROP   The TCP segment has an invalid checksum.
+     *
+     */
+    otError HandleMessage(Message &aMessage, MessageInfo &aMessageInfo);
+
+    /**
+     * This method updates the TCP checksum.
+     *
+     * @param[in]  aMessage               A reference to the TCP segment.
+     * @param[in]  aPseudoHeaderChecksum  The pseudo-header checksum value.
+     *
+     * @retval OT_ERROR_NONE  Successfully updated the TCP checksum.
+     *
+     */
+    otError UpdateChecksum(Message &aMessage, uint16_t aPseudoHeaderChecksum);
+
+private:
+    enum
+    {
+        kDynamicPortMin = 49152, ///< Service Name and Transport Protocol Port Number Registry
+        kDynamicPortMax = 65535, ///< Service Name and Transport Protocol Port Number Registry
+    };
+
+    bool       IsSocketOpen(const TcpSocket &aSocket) const;
+    void       AddSocket(TcpSocket &aSocket);
+    void       RemoveSocket(TcpSocket &aSocket);
+    TcpSocket *FindSocket(const MessageInfo &aMessageInfo);
+    uint16_t   GetEphemeralPort(void);
+    void       ScheduleTimer(void);
+
+    static void HandleTimer(Timer &aTimer);
+    void        HandleTimer(void);
+
+    TcpSocket *mSockets;
+    uint16_t   mEphemeralPort;
+    TimerMilli mTimer;
+};
+
+#endif // OPENTHREAD_CONFIG_ENABLE_TCP
+
 /**
  * @}
  *
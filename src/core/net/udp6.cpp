@@ -74,6 +74,11 @@ Message *UdpSocket::NewMessage(uint16_t aReserved, const otMessageSettings *aSet
     return GetUdp().NewMessage(aReserved, aSettings);
 }
 
+Message *UdpSocket::NewMessage(uint16_t aReserved, const Address &aDestination, const otMessageSettings *aSettings)
+{
+    return GetUdp().NewMessage(aReserved, aDestination, aSettings);
+}
+
 otError UdpSocket::Open(otUdpReceive aHandler, void *aContext)
 {
     otError error;
@@ -94,7 +99,8 @@ exit:
 
 otError UdpSocket::Bind(const SockAddr &aSockAddr)
 {
-    otError error = OT_ERROR_NONE;
+    otError  error   = OT_ERROR_NONE;
+    uint16_t oldPort = mSockName.mPort;
 
     mSockName = aSockAddr;
 
@@ -115,6 +121,8 @@ otError UdpSocket::Bind(const SockAddr &aSockAddr)
     }
 #endif
 
+    GetUdp().RehashSocket(*this, oldPort);
+
     return error;
 }
 
@@ -195,12 +203,44 @@ exit:
     return error;
 }
 
+otError UdpSocket::SendTo(const void *aBuf, uint16_t aLength, const MessageInfo &aMessageInfo)
+{
+    otError  error = OT_ERROR_NONE;
+    Message *message;
+
+    if (aMessageInfo.GetPeerAddr().IsUnspecified())
+    {
+        message = NewMessage(0, GetPeerName().GetAddress());
+    }
+    else
+    {
+        message = NewMessage(0, aMessageInfo.GetPeerAddr());
+    }
+
+    VerifyOrExit(message != NULL, error = OT_ERROR_NO_BUFS);
+
+    SuccessOrExit(error = message->SetLength(aLength));
+    message->Write(0, aLength, aBuf);
+
+    error = SendTo(*message, aMessageInfo);
+
+exit:
+
+    if (error != OT_ERROR_NONE && message != NULL)
+    {
+        message->Free();
+    }
+
+    return error;
+}
+
 Udp::Udp(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mEphemeralPort(kDynamicPortMin)
     , mReceivers(NULL)
     , mSockets(NULL)
 {
+    memset(mSocketBuckets, 0, sizeof(mSocketBuckets));
 }
 
 otError Udp::AddReceiver(UdpReceiver &aReceiver)
@@ -253,8 +293,23 @@ otError Udp::AddSocket(UdpSocket &aSocket)
         }
     }
 
-    aSocket.SetNext(mSockets);
-    mSockets = &aSocket;
+    // Sockets hashing to the same bucket are kept adjacent in `mSockets`, with the bucket
+    // pointing to the first one, so that the whole list remains available to the platform.
+    {
+        UdpSocket *&head = mSocketBuckets[GetSocketBucket(aSocket.GetSockName().mPort)];
+
+        if (head != NULL)
+        {
+            aSocket.SetNext(head->GetNext());
+            head->SetNext(&aSocket);
+        }
+        else
+        {
+            aSocket.SetNext(mSockets);
+            mSockets = &aSocket;
+            head     = &aSocket;
+        }
+    }
 
 exit:
     return OT_ERROR_NONE;
@@ -262,25 +317,65 @@ exit:
 
 otError Udp::RemoveSocket(UdpSocket &aSocket)
 {
-    if (mSockets == &aSocket)
+    UnlinkSocket(aSocket, GetSocketBucket(aSocket.GetSockName().mPort));
+
+    return OT_ERROR_NONE;
+}
+
+bool Udp::UnlinkSocket(UdpSocket &aSocket, uint8_t aBucket)
+{
+    UdpSocket *prev  = NULL;
+    UdpSocket *next  = aSocket.GetNext();
+    bool       found = false;
+
+    for (UdpSocket *socket = mSockets; socket; prev = socket, socket = socket->GetNext())
+    {
+        if (socket == &aSocket)
+        {
+            found = true;
+            break;
+        }
+    }
+
+    VerifyOrExit(found);
+
+    if (prev == NULL)
     {
-        mSockets = mSockets->GetNext();
+        mSockets = next;
     }
     else
     {
-        for (UdpSocket *socket = mSockets; socket; socket = socket->GetNext())
+        prev->SetNext(next);
+    }
+
+    if (mSocketBuckets[aBucket] == &aSocket)
+    {
+        if (next != NULL && GetSocketBucket(next->GetSockName().mPort) == aBucket)
         {
-            if (socket->GetNext() == &aSocket)
-            {
-                socket->SetNext(aSocket.GetNext());
-                break;
-            }
+            mSocketBuckets[aBucket] = next;
+        }
+        else
+        {
+            mSocketBuckets[aBucket] = NULL;
         }
     }
 
     aSocket.SetNext(NULL);
 
-    return OT_ERROR_NONE;
+exit:
+    return found;
+}
+
+void Udp::RehashSocket(UdpSocket &aSocket, uint16_t aOldPort)
+{
+    uint8_t oldBucket = GetSocketBucket(aOldPort);
+
+    VerifyOrExit(oldBucket != GetSocketBucket(aSocket.GetSockName().mPort));
+    VerifyOrExit(UnlinkSocket(aSocket, oldBucket));
+    AddSocket(aSocket);
+
+exit:
+    return;
 }
 
 uint16_t Udp::GetEphemeralPort(void)
@@ -304,6 +399,11 @@ Message *Udp::NewMessage(uint16_t aReserved, const otMessageSettings *aSettings)
     return GetIp6().NewMessage(sizeof(UdpHeader) + aReserved, aSettings);
 }
 
+Message *Udp::NewMessage(uint16_t aReserved, const Address &aDestination, const otMessageSettings *aSettings)
+{
+    return GetIp6().NewMessage(sizeof(UdpHeader) + aReserved, aDestination, aSettings);
+}
+
 otError Udp::SendDatagram(Message &aMessage, MessageInfo &aMessageInfo, IpProto aIpProto)
 {
     otError error = OT_ERROR_NONE;
@@ -380,8 +480,11 @@ exit:
 
 void Udp::HandlePayload(Message &aMessage, MessageInfo &aMessageInfo)
 {
+    uint8_t bucket = GetSocketBucket(aMessageInfo.GetSockPort());
+
     // find socket
-    for (UdpSocket *socket = mSockets; socket; socket = socket->GetNext())
+    for (UdpSocket *socket = mSocketBuckets[bucket];
+         socket != NULL && GetSocketBucket(socket->GetSockName().mPort) == bucket; socket = socket->GetNext())
     {
         if (socket->GetSockName().mPort != aMessageInfo.GetSockPort())
         {
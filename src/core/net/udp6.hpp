@@ -120,6 +120,21 @@ public:
      */
     Message *NewMessage(uint16_t aReserved, const otMessageSettings *aSettings = NULL);
 
+    /**
+     * This method returns a new UDP message with enough header space reserved for sending it to a given destination.
+     *
+     * @note If @p aSettings is 'NULL', the link layer security is enabled and the message priority is set to
+     * OT_MESSAGE_PRIORITY_NORMAL by default.
+     *
+     * @param[in]  aReserved     The number of header bytes to reserve after the UDP header.
+     * @param[in]  aDestination  The IPv6 destination address the message will be sent to.
+     * @param[in]  aSettings     A pointer to the message settings or NULL to set default settings.
+     *
+     * @returns A pointer to the message or NULL if no buffers are available.
+     *
+     */
+    Message *NewMessage(uint16_t aReserved, const Address &aDestination, const otMessageSettings *aSettings = NULL);
+
     /**
      * This method opens the UDP socket.
      *
@@ -172,6 +187,23 @@ public:
      */
     otError SendTo(Message &aMessage, const MessageInfo &aMessageInfo);
 
+    /**
+     * This method sends a UDP datagram with a payload taken from a buffer.
+     *
+     * The message is allocated with the header space needed for the destination and sized in a single step, so it
+     * uses as few buffers as possible (a large buffer for the payload, if available).
+     *
+     * @param[in]  aBuf          A pointer to the payload.
+     * @param[in]  aLength       The length of the payload in bytes.
+     * @param[in]  aMessageInfo  The message info associated with the datagram.
+     *
+     * @retval OT_ERROR_NONE          Successfully sent the UDP datagram.
+     * @retval OT_ERROR_INVALID_ARGS  If no peer is specified in @p aMessageInfo or by connect().
+     * @retval OT_ERROR_NO_BUFS       Insufficient available buffers for the datagram.
+     *
+     */
+    otError SendTo(const void *aBuf, uint16_t aLength, const MessageInfo &aMessageInfo);
+
     /**
      * This method returns the local socket address.
      *
@@ -257,6 +289,17 @@ public:
      */
     otError RemoveSocket(UdpSocket &aSocket);
 
+    /**
+     * This method moves a UDP socket to the hash bucket of its current local port.
+     *
+     * This method must be called whenever the local port of an added socket changes.
+     *
+     * @param[in]  aSocket   A reference to the UDP socket.
+     * @param[in]  aOldPort  The local port the socket was hashed with.
+     *
+     */
+    void RehashSocket(UdpSocket &aSocket, uint16_t aOldPort);
+
     /**
      * This method returns a new ephemeral port.
      *
@@ -276,6 +319,18 @@ public:
      */
     Message *NewMessage(uint16_t aReserved, const otMessageSettings *aSettings = NULL);
 
+    /**
+     * This method returns a new UDP message with enough header space reserved for sending it to a given destination.
+     *
+     * @param[in]  aReserved     The number of header bytes to reserve after the UDP header.
+     * @param[in]  aDestination  The IPv6 destination address the message will be sent to.
+     * @param[in]  aSettings     A pointer to the message settings or NULL to set default settings.
+     *
+     * @returns A pointer to the message or NULL if no buffers are available.
+     *
+     */
+    Message *NewMessage(uint16_t aReserved, const Address &aDestination, const otMessageSettings *aSettings = NULL);
+
     /**
      * This method sends an IPv6 datagram.
      *
@@ -348,9 +403,19 @@ private:
         kDynamicPortMax = 65535, ///< Service Name and Transport Protocol Port Number Registry
     };
 
+    enum
+    {
+        kNumSocketBuckets = OPENTHREAD_CONFIG_UDP_SOCKET_HASH_BUCKETS,
+    };
+
+    static uint8_t GetSocketBucket(uint16_t aPort) { return static_cast<uint8_t>(aPort & (kNumSocketBuckets - 1)); }
+
+    bool UnlinkSocket(UdpSocket &aSocket, uint8_t aBucket);
+
     uint16_t     mEphemeralPort;
     UdpReceiver *mReceivers;
     UdpSocket *  mSockets;
+    UdpSocket *  mSocketBuckets[kNumSocketBuckets];
 #if OPENTHREAD_ENABLE_UDP_FORWARD
     void *         mUdpForwarderContext;
     otUdpForwarder mUdpForwarder;
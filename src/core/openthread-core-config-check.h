@@ -53,4 +53,234 @@
     "OPENTHREAD_CONFIG_MAX_TX_ATTEMPTS_INDIRECT_PER_POLL was replaced by OPENTHREAD_CONFIG_MAC_MAX_FRAME_RETRIES_INDIRECT."
 #endif
 
+/*
+ * Sanity checks for the configuration values.
+ *
+ */
+
+#if OPENTHREAD_CONFIG_ENABLE_TIMER_WHEEL
+#if (OPENTHREAD_CONFIG_TIMER_WHEEL_NUM_SLOTS & (OPENTHREAD_CONFIG_TIMER_WHEEL_NUM_SLOTS - 1)) != 0
+#error "OPENTHREAD_CONFIG_TIMER_WHEEL_NUM_SLOTS must be a power of two."
+#endif
+#endif
+
+#if OPENTHREAD_CONFIG_NUM_MESSAGE_LARGE_BUFFERS
+#if OPENTHREAD_CONFIG_MESSAGE_LARGE_BUFFER_SIZE <= OPENTHREAD_CONFIG_MESSAGE_BUFFER_SIZE
+#error "OPENTHREAD_CONFIG_MESSAGE_LARGE_BUFFER_SIZE must be larger than OPENTHREAD_CONFIG_MESSAGE_BUFFER_SIZE."
+#endif
+#endif
+
+#if OPENTHREAD_CONFIG_ENABLE_SHARED_MESSAGE_BUFFERS && OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT
+#error "OPENTHREAD_CONFIG_ENABLE_SHARED_MESSAGE_BUFFERS is not supported with platform message management."
+#endif
+
+#if OPENTHREAD_CONFIG_NUM_MESSAGE_RESERVED_NET_BUFFERS >= OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS
+#error "OPENTHREAD_CONFIG_NUM_MESSAGE_RESERVED_NET_BUFFERS must be smaller than OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS."
+#endif
+
+#if OPENTHREAD_CONFIG_IP6_REASSEMBLY_MAX_DATAGRAMS > 254
+#error "OPENTHREAD_CONFIG_IP6_REASSEMBLY_MAX_DATAGRAMS must be smaller than 255."
+#endif
+
+#if OPENTHREAD_CONFIG_IP6_REASSEMBLY_MAX_DATAGRAMS_PER_SOURCE < 1 || OPENTHREAD_CONFIG_IP6_REASSEMBLY_MAX_RANGES < 1
+#error "OPENTHREAD_CONFIG_IP6_REASSEMBLY_MAX_DATAGRAMS_PER_SOURCE and _MAX_RANGES must be at least 1."
+#endif
+
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_TTL > 2147483 || OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_NEGATIVE_TTL > 2147483
+#error "OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_TTL and _NEGATIVE_TTL must not exceed 2147483 seconds."
+#endif
+
+#if (OPENTHREAD_CONFIG_ADDRESS_CACHE_HASH_BUCKETS & (OPENTHREAD_CONFIG_ADDRESS_CACHE_HASH_BUCKETS - 1)) != 0
+#error "OPENTHREAD_CONFIG_ADDRESS_CACHE_HASH_BUCKETS must be a power of two."
+#endif
+
+#if (OPENTHREAD_CONFIG_UDP_SOCKET_HASH_BUCKETS == 0) || \
+    ((OPENTHREAD_CONFIG_UDP_SOCKET_HASH_BUCKETS & (OPENTHREAD_CONFIG_UDP_SOCKET_HASH_BUCKETS - 1)) != 0)
+#error "OPENTHREAD_CONFIG_UDP_SOCKET_HASH_BUCKETS must be a non-zero power of two."
+#endif
+
+#if (OPENTHREAD_CONFIG_COAP_RESOURCE_HASH_BUCKETS == 0) || \
+    ((OPENTHREAD_CONFIG_COAP_RESOURCE_HASH_BUCKETS & (OPENTHREAD_CONFIG_COAP_RESOURCE_HASH_BUCKETS - 1)) != 0)
+#error "OPENTHREAD_CONFIG_COAP_RESOURCE_HASH_BUCKETS must be a non-zero power of two."
+#endif
+
+#if (OPENTHREAD_CONFIG_COAP_SERVER_MAX_CACHED_RESPONSES < 1) || (OPENTHREAD_CONFIG_COAP_SERVER_MAX_CACHED_RESPONSES > 254)
+#error "OPENTHREAD_CONFIG_COAP_SERVER_MAX_CACHED_RESPONSES must be between 1 and 254."
+#endif
+
+#if (OPENTHREAD_CONFIG_COAP_MAX_BLOCK_LENGTH < 16) || (OPENTHREAD_CONFIG_COAP_MAX_BLOCK_LENGTH > 1024) || \
+    ((OPENTHREAD_CONFIG_COAP_MAX_BLOCK_LENGTH & (OPENTHREAD_CONFIG_COAP_MAX_BLOCK_LENGTH - 1)) != 0)
+#error "OPENTHREAD_CONFIG_COAP_MAX_BLOCK_LENGTH must be a power of two between 16 and 1024."
+#endif
+
+#if OPENTHREAD_CONFIG_COAP_MAX_OBSERVERS < 1
+#error "OPENTHREAD_CONFIG_COAP_MAX_OBSERVERS must be at least 1."
+#endif
+
+#if OPENTHREAD_CONFIG_COAP_RTO_ESTIMATOR_ENTRIES < 1
+#error "OPENTHREAD_CONFIG_COAP_RTO_ESTIMATOR_ENTRIES must be at least 1."
+#endif
+
+#if (OPENTHREAD_CONFIG_COAP_NSTART < 1) || (OPENTHREAD_CONFIG_COAP_NSTART > 255)
+#error "OPENTHREAD_CONFIG_COAP_NSTART must be between 1 and 255."
+#endif
+
+#if OPENTHREAD_CONFIG_MAX_CHILDREN > 255
+#error "OPENTHREAD_CONFIG_MAX_CHILDREN must not exceed 255."
+#endif
+
+#if OPENTHREAD_CONFIG_ADDRESS_CACHE_ENTRIES >= 0xffff
+#error "OPENTHREAD_CONFIG_ADDRESS_CACHE_ENTRIES must be smaller than 0xffff."
+#endif
+
+#if OPENTHREAD_CONFIG_ENABLE_ADDRESS_CACHE_SNOOPING
+#if OPENTHREAD_CONFIG_ADDRESS_CACHE_SNOOP_TIMEOUT < 1 || OPENTHREAD_CONFIG_ADDRESS_CACHE_SNOOP_TIMEOUT > 255
+#error "OPENTHREAD_CONFIG_ADDRESS_CACHE_SNOOP_TIMEOUT must be between 1 and 255."
+#endif
+#endif
+
+#if OPENTHREAD_CONFIG_ENABLE_ADDRESS_CACHE_PERSISTENCE
+#if OPENTHREAD_CONFIG_ADDRESS_CACHE_MAX_SAVED_ENTRIES < 1 || OPENTHREAD_CONFIG_ADDRESS_CACHE_MAX_SAVED_ENTRIES > 255
+#error "OPENTHREAD_CONFIG_ADDRESS_CACHE_MAX_SAVED_ENTRIES must be between 1 and 255."
+#endif
+#endif
+
+#if OPENTHREAD_CONFIG_ENABLE_ADDRESS_QUERY_BATCHING
+#if OPENTHREAD_CONFIG_ADDRESS_QUERY_MAX_BATCH_TARGETS < 1
+#error "OPENTHREAD_CONFIG_ADDRESS_QUERY_MAX_BATCH_TARGETS must be at least 1."
+#endif
+#endif
+
+#if OPENTHREAD_CONFIG_HEAP_SEGREGATED_FIT
+#if OPENTHREAD_CONFIG_HEAP_NUM_SMALL_SIZE_CLASSES < 1
+#error "OPENTHREAD_CONFIG_HEAP_NUM_SMALL_SIZE_CLASSES must be at least 1."
+#endif
+#endif
+
+#if OPENTHREAD_CONFIG_MAC_FILTER_SIZE >= 0xffff
+#error "OPENTHREAD_CONFIG_MAC_FILTER_SIZE must be less than 65535."
+#endif
+
+#if OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_MAX_DATAGRAMS < 1 || OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_MAX_DATAGRAMS > 254
+#error "OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_MAX_DATAGRAMS must be between 1 and 254."
+#endif
+
+#if OPENTHREAD_CONFIG_ENABLE_FAIR_QUEUEING && OPENTHREAD_CONFIG_FAIR_QUEUEING_MAX_FLOWS < 1
+#error "OPENTHREAD_CONFIG_FAIR_QUEUEING_MAX_FLOWS must be at least 1."
+#endif
+
+#if OPENTHREAD_CONFIG_ENABLE_SEND_QUEUE_AQM
+#if OPENTHREAD_CONFIG_SEND_QUEUE_AQM_TARGET < 1
+#error "OPENTHREAD_CONFIG_SEND_QUEUE_AQM_TARGET must be at least 1."
+#endif
+#if OPENTHREAD_CONFIG_SEND_QUEUE_AQM_INTERVAL < OPENTHREAD_CONFIG_SEND_QUEUE_AQM_TARGET
+#error "OPENTHREAD_CONFIG_SEND_QUEUE_AQM_INTERVAL must be at least OPENTHREAD_CONFIG_SEND_QUEUE_AQM_TARGET."
+#endif
+#endif
+
+#if OPENTHREAD_CONFIG_MAC_RX_QUEUE_SIZE > 255
+#error "OPENTHREAD_CONFIG_MAC_RX_QUEUE_SIZE must be at most 255."
+#endif
+
+#if OPENTHREAD_CONFIG_MPL_SEED_SET_ENTRIES < 1 || OPENTHREAD_CONFIG_MPL_SEED_SET_ENTRIES >= 0xffff
+#error "OPENTHREAD_CONFIG_MPL_SEED_SET_ENTRIES must be between 1 and 0xfffe."
+#endif
+
+#if OPENTHREAD_CONFIG_MPL_SEED_SET_NUM_BUCKETS < 1
+#error "OPENTHREAD_CONFIG_MPL_SEED_SET_NUM_BUCKETS must be at least 1."
+#endif
+
+#if OPENTHREAD_CONFIG_MAC_FILTER_NUM_BUCKETS < 1
+#error "OPENTHREAD_CONFIG_MAC_FILTER_NUM_BUCKETS must be at least 1."
+#endif
+
+#if OPENTHREAD_CONFIG_ENABLE_ADAPTIVE_FRAME_RETRIES
+#if !OPENTHREAD_CONFIG_ENABLE_TX_ERROR_RATE_TRACKING
+#error "OPENTHREAD_CONFIG_ENABLE_ADAPTIVE_FRAME_RETRIES requires OPENTHREAD_CONFIG_ENABLE_TX_ERROR_RATE_TRACKING."
+#endif
+#if OPENTHREAD_CONFIG_ADAPTIVE_FRAME_RETRIES_MIN > OPENTHREAD_CONFIG_ADAPTIVE_FRAME_RETRIES_MAX
+#error "OPENTHREAD_CONFIG_ADAPTIVE_FRAME_RETRIES_MIN must not exceed OPENTHREAD_CONFIG_ADAPTIVE_FRAME_RETRIES_MAX."
+#endif
+#endif
+
+#if OPENTHREAD_CONFIG_ENABLE_ETX_LINK_COST && !OPENTHREAD_CONFIG_ENABLE_TX_ERROR_RATE_TRACKING
+#error "OPENTHREAD_CONFIG_ENABLE_ETX_LINK_COST requires OPENTHREAD_CONFIG_ENABLE_TX_ERROR_RATE_TRACKING."
+#endif
+
+#if OPENTHREAD_CONFIG_CHILD_ADDRESS_POOL_SIZE >= 0xffff
+#error "OPENTHREAD_CONFIG_CHILD_ADDRESS_POOL_SIZE must be at most 0xfffe."
+#endif
+
+#if OPENTHREAD_CONFIG_ENABLE_CHILD_INDIRECT_LIMITS
+#if OPENTHREAD_CONFIG_CHILD_INDIRECT_MAX_MESSAGES < OPENTHREAD_CONFIG_DEFAULT_SED_DATAGRAM_COUNT || \
+    OPENTHREAD_CONFIG_CHILD_INDIRECT_MAX_MESSAGES > 0xffff
+#error "OPENTHREAD_CONFIG_CHILD_INDIRECT_MAX_MESSAGES must be between the SED datagram count and 0xffff."
+#endif
+#if OPENTHREAD_CONFIG_CHILD_INDIRECT_MAX_BYTES < OPENTHREAD_CONFIG_DEFAULT_SED_BUFFER_SIZE || \
+    OPENTHREAD_CONFIG_CHILD_INDIRECT_MAX_BYTES > 0xffff
+#error "OPENTHREAD_CONFIG_CHILD_INDIRECT_MAX_BYTES must be between the SED buffer size and 0xffff."
+#endif
+#endif
+
+#if OPENTHREAD_CONFIG_ICMP6_RESPONSE_RATE_LIMIT
+#if OPENTHREAD_CONFIG_ICMP6_RESPONSE_RATE_LIMIT > 1000
+#error "OPENTHREAD_CONFIG_ICMP6_RESPONSE_RATE_LIMIT must be at most 1000 (responses per second)."
+#endif
+#if OPENTHREAD_CONFIG_ICMP6_RESPONSE_BURST < 1 || OPENTHREAD_CONFIG_ICMP6_RESPONSE_BURST > 0xffff
+#error "OPENTHREAD_CONFIG_ICMP6_RESPONSE_BURST must be between 1 and 0xffff."
+#endif
+#endif
+
+#if OPENTHREAD_CONFIG_NCP_RAW_STREAM_BATCH_SIZE && \
+    (OPENTHREAD_CONFIG_NCP_RAW_STREAM_BATCH_SIZE + 16 > OPENTHREAD_CONFIG_NCP_TX_BUFFER_SIZE)
+#error "OPENTHREAD_CONFIG_NCP_RAW_STREAM_BATCH_SIZE must leave room for the spinel header in the NCP TX buffer."
+#endif
+
+#if OPENTHREAD_CONFIG_NCP_TX_BUFFER_MESSAGE_SPILL && OPENTHREAD_RADIO
+#error "OPENTHREAD_CONFIG_NCP_TX_BUFFER_MESSAGE_SPILL is not supported in radio-only builds."
+#endif
+
+#if OPENTHREAD_CONFIG_NCP_TX_BUFFER_SPILL_HIGH_PRIORITY_RESERVE > \
+    OPENTHREAD_CONFIG_NCP_TX_BUFFER_SPILL_LOW_PRIORITY_RESERVE
+#error "NCP TX buffer spill reserve for high priority frames must not exceed the one for low priority frames."
+#endif
+
+#if OPENTHREAD_CONFIG_MAC_TSCH && !OPENTHREAD_CONFIG_ENABLE_TIME_SYNC
+#error "OPENTHREAD_CONFIG_MAC_TSCH requires OPENTHREAD_CONFIG_ENABLE_TIME_SYNC"
+#endif
+
+#if OPENTHREAD_CONFIG_ENABLE_TCP
+#if OPENTHREAD_CONFIG_TCP_MSS < 64 || OPENTHREAD_CONFIG_TCP_MSS > 1220
+#error "OPENTHREAD_CONFIG_TCP_MSS must be between 64 and 1220 (IPv6 minimum MTU without IPv6 and TCP headers)."
+#endif
+#if OPENTHREAD_CONFIG_TCP_SEND_BUFFER_SIZE < OPENTHREAD_CONFIG_TCP_MSS || \
+    OPENTHREAD_CONFIG_TCP_SEND_BUFFER_SIZE > 0x7fff
+#error "OPENTHREAD_CONFIG_TCP_SEND_BUFFER_SIZE must be between OPENTHREAD_CONFIG_TCP_MSS and 0x7fff."
+#endif
+#if OPENTHREAD_CONFIG_TCP_RECEIVE_WINDOW < OPENTHREAD_CONFIG_TCP_MSS || OPENTHREAD_CONFIG_TCP_RECEIVE_WINDOW > 0xffff
+#error "OPENTHREAD_CONFIG_TCP_RECEIVE_WINDOW must be between OPENTHREAD_CONFIG_TCP_MSS and 0xffff."
+#endif
+#endif
+
+#if OPENTHREAD_CONFIG_LINK_RAW_TRANSMIT_BATCH_SIZE > 255
+#error "OPENTHREAD_CONFIG_LINK_RAW_TRANSMIT_BATCH_SIZE must not exceed 255."
+#endif
+
+#if OPENTHREAD_CONFIG_MLE_ADDRESS_SOLICIT_BATCH_WINDOW
+#if OPENTHREAD_CONFIG_MLE_ADDRESS_SOLICIT_BATCH_WINDOW >= OPENTHREAD_CONFIG_COAP_ACK_TIMEOUT * 1000
+#error "OPENTHREAD_CONFIG_MLE_ADDRESS_SOLICIT_BATCH_WINDOW must be less than the CoAP ACK timeout."
+#endif
+#if OPENTHREAD_CONFIG_MLE_ADDRESS_SOLICIT_BATCH_SIZE < 1 || OPENTHREAD_CONFIG_MLE_ADDRESS_SOLICIT_BATCH_SIZE > 255
+#error "OPENTHREAD_CONFIG_MLE_ADDRESS_SOLICIT_BATCH_SIZE must be between 1 and 255."
+#endif
+#endif
+
+#if OPENTHREAD_CONFIG_AES_CCM_CTR_BATCH_BLOCKS < 1 || OPENTHREAD_CONFIG_AES_CCM_CTR_BATCH_BLOCKS > 16
+#error "OPENTHREAD_CONFIG_AES_CCM_CTR_BATCH_BLOCKS must be between 1 and 16."
+#endif
+
+#if OPENTHREAD_CONFIG_NCP_BUFFER_COUNTERS_LOW_THRESHOLD && !OPENTHREAD_CONFIG_NCP_BUFFER_COUNTERS_STREAM_INTERVAL
+#error "OPENTHREAD_CONFIG_NCP_BUFFER_COUNTERS_LOW_THRESHOLD requires a non-zero stream interval."
+#endif
+
 #endif // OPENTHREAD_CORE_CONFIG_CHECK_H_
@@ -105,6 +105,109 @@
 #define OPENTHREAD_CONFIG_MESSAGE_BUFFER_SIZE 128
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_NUM_MESSAGE_LARGE_BUFFERS
+ *
+ * The number of large message buffers in the buffer pool (in addition to `OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS`).
+ *
+ * Large buffers are used as subsequent (non-head) buffers of messages whose length does not fit in a single standard
+ * buffer, so that large datagrams use fewer buffers (and shorter buffer chains). When large buffers are used, the
+ * standard buffer size (`OPENTHREAD_CONFIG_MESSAGE_BUFFER_SIZE`) can be reduced to save RAM for small messages.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NUM_MESSAGE_LARGE_BUFFERS
+#define OPENTHREAD_CONFIG_NUM_MESSAGE_LARGE_BUFFERS 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MESSAGE_LARGE_BUFFER_SIZE
+ *
+ * The size of a large message buffer in bytes.
+ *
+ * Applicable only if `OPENTHREAD_CONFIG_NUM_MESSAGE_LARGE_BUFFERS` is non-zero.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MESSAGE_LARGE_BUFFER_SIZE
+#define OPENTHREAD_CONFIG_MESSAGE_LARGE_BUFFER_SIZE 512
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_ENABLE_SHARED_MESSAGE_BUFFERS
+ *
+ * Define as 1 to let cloned messages share the (non-head) buffers of the original message.
+ *
+ * A clone gets its own head buffer (holding the message metadata) and references the buffer chain of the original.
+ * A shared buffer is copied only when one of the messages writes to it or changes the buffer chain (copy-on-write).
+ * This reduces buffer usage and copying for retransmission copies, multicast loopback and MPL buffered messages.
+ *
+ * Not supported with `OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT`.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_ENABLE_SHARED_MESSAGE_BUFFERS
+#define OPENTHREAD_CONFIG_ENABLE_SHARED_MESSAGE_BUFFERS 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_NUM_MESSAGE_RESERVED_NET_BUFFERS
+ *
+ * The number of message buffers reserved for network control (e.g., MLE) messages.
+ *
+ * Messages with a priority lower than network control cannot use the last reserved free buffers.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NUM_MESSAGE_RESERVED_NET_BUFFERS
+#define OPENTHREAD_CONFIG_NUM_MESSAGE_RESERVED_NET_BUFFERS 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MESSAGE_LOW_BUFFER_THRESHOLD
+ *
+ * The number of free message buffers below which the message pool is considered low on buffers.
+ *
+ * The message pool accumulates the time it spends low on buffers (reported in `otBufferInfo`).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MESSAGE_LOW_BUFFER_THRESHOLD
+#define OPENTHREAD_CONFIG_MESSAGE_LOW_BUFFER_THRESHOLD (OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS / 8)
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MAX_INDIRECT_MESSAGE_BUFFERS
+ *
+ * The maximum number of message buffers used by messages queued for indirect transmission to sleepy children.
+ *
+ * Zero indicates no limit.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MAX_INDIRECT_MESSAGE_BUFFERS
+#define OPENTHREAD_CONFIG_MAX_INDIRECT_MESSAGE_BUFFERS 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MAX_COAP_CACHE_MESSAGE_BUFFERS
+ *
+ * The maximum number of message buffers used by cached CoAP responses. Oldest cached responses are dropped to
+ * make room for new ones.
+ *
+ * Zero indicates no limit.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MAX_COAP_CACHE_MESSAGE_BUFFERS
+#define OPENTHREAD_CONFIG_MAX_COAP_CACHE_MESSAGE_BUFFERS 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MAX_REASSEMBLY_MESSAGE_BUFFERS
+ *
+ * The maximum number of message buffers used by messages under 6LoWPAN reassembly.
+ *
+ * Zero indicates no limit.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MAX_REASSEMBLY_MESSAGE_BUFFERS
+#define OPENTHREAD_CONFIG_MAX_REASSEMBLY_MESSAGE_BUFFERS 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_DEFAULT_CHANNEL
  *
@@ -173,6 +276,45 @@
 #define OPENTHREAD_CONFIG_MAC_MAX_FRAME_RETRIES_INDIRECT 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_RADIO_RX_QUEUE
+ *
+ * Define as 1 to support radio drivers which queue received frames in several buffers and report them with
+ * `otPlatRadioReceivePending()`. The driver must then implement `otPlatRadioGetReceivedFrame()` and
+ * `otPlatRadioReleaseReceivedFrame()`.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_RADIO_RX_QUEUE
+#define OPENTHREAD_CONFIG_RADIO_RX_QUEUE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MAC_RX_QUEUE_SIZE
+ *
+ * The number of received data frames that may be queued for processing by the upper layers.
+ *
+ * When non-zero, received data frames are copied after MAC processing and handed to the `MeshForwarder` in batches
+ * from a tasklet, keeping the radio receive callback short. Zero processes each frame from the receive callback.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MAC_RX_QUEUE_SIZE
+#define OPENTHREAD_CONFIG_MAC_RX_QUEUE_SIZE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MAC_RX_QUEUE_BATCH_SIZE
+ *
+ * The maximum number of queued received frames handed to the upper layers per run of the MAC receive tasklet
+ * (applicable when `OPENTHREAD_CONFIG_MAC_RX_QUEUE_SIZE` is non-zero). Zero hands over all queued frames.
+ *
+ * The tasklet re-posts itself when frames remain, so that radio events are handled in between batches and long upper
+ * layer processing of a burst of frames does not delay them.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MAC_RX_QUEUE_BATCH_SIZE
+#define OPENTHREAD_CONFIG_MAC_RX_QUEUE_BATCH_SIZE 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_MAX_TX_ATTEMPTS_INDIRECT_POLLS
  *
@@ -204,6 +346,19 @@
 #define OPENTHREAD_CONFIG_TX_NUM_BCAST 1
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_PREPARE_NEXT_FRAGMENT_DURING_TX
+ *
+ * Define as 1 for OpenThread to build the next fragment frame of a direct transmission into a separate frame buffer
+ * while the current fragment is being transmitted, so that the frame is ready as soon as the radio becomes available.
+ *
+ * This shortens the gap between consecutive fragment frames at the cost of one additional frame buffer.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_PREPARE_NEXT_FRAGMENT_DURING_TX
+#define OPENTHREAD_CONFIG_PREPARE_NEXT_FRAGMENT_DURING_TX 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_DROP_MESSAGE_ON_FRAGMENT_TX_FAILURE
  *
@@ -230,6 +385,20 @@
 #define OPENTHREAD_CONFIG_ATTACH_DATA_POLL_PERIOD 100
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_ENABLE_ADAPTIVE_DATA_POLL
+ *
+ * Define to 1 to enable adaptive data polling on sleepy end devices.
+ *
+ * When enabled, sending a data frame to the parent is followed by a burst of fast polls so that a response is picked
+ * up without waiting for the next regular poll. The burst ends as soon as a frame is received, and its length adapts
+ * to how long responses took to arrive in earlier bursts, shrinking when bursts come back empty.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_ENABLE_ADAPTIVE_DATA_POLL
+#define OPENTHREAD_CONFIG_ENABLE_ADAPTIVE_DATA_POLL 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_ADDRESS_CACHE_ENTRIES
  *
@@ -240,6 +409,118 @@
 #define OPENTHREAD_CONFIG_ADDRESS_CACHE_ENTRIES 10
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_ADDRESS_CACHE_HASH_BUCKETS
+ *
+ * The number of hash buckets used to look up EID-to-RLOC cache entries by EID (must be a power of two).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_ADDRESS_CACHE_HASH_BUCKETS
+#define OPENTHREAD_CONFIG_ADDRESS_CACHE_HASH_BUCKETS 8
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_ENABLE_ADDRESS_CACHE_SNOOPING
+ *
+ * Define as 1 to add provisional EID-to-RLOC cache entries from the source EID and RLOC16 of received traffic.
+ *
+ * Snooped entries only use free cache entries, and are dropped if they are not used within
+ * `OPENTHREAD_CONFIG_ADDRESS_CACHE_SNOOP_TIMEOUT`.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_ENABLE_ADDRESS_CACHE_SNOOPING
+#define OPENTHREAD_CONFIG_ENABLE_ADDRESS_CACHE_SNOOPING 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_ADDRESS_CACHE_SNOOP_TIMEOUT
+ *
+ * The time (in seconds) a snooped EID-to-RLOC cache entry is kept without being used or refreshed by traffic.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_ADDRESS_CACHE_SNOOP_TIMEOUT
+#define OPENTHREAD_CONFIG_ADDRESS_CACHE_SNOOP_TIMEOUT 30
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_ENABLE_ADDRESS_CACHE_PERSISTENCE
+ *
+ * Define as 1 to save the most recently used EID-to-RLOC cache entries in non-volatile settings, and restore them
+ * as provisional entries when the device restores its router role after a reset.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_ENABLE_ADDRESS_CACHE_PERSISTENCE
+#define OPENTHREAD_CONFIG_ENABLE_ADDRESS_CACHE_PERSISTENCE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_ADDRESS_CACHE_SAVE_INTERVAL
+ *
+ * The minimum time (in seconds) between two saves of the EID-to-RLOC cache to non-volatile settings.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_ADDRESS_CACHE_SAVE_INTERVAL
+#define OPENTHREAD_CONFIG_ADDRESS_CACHE_SAVE_INTERVAL 300
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_ADDRESS_CACHE_MAX_SAVED_ENTRIES
+ *
+ * The maximum number of EID-to-RLOC cache entries saved to non-volatile settings.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_ADDRESS_CACHE_MAX_SAVED_ENTRIES
+#define OPENTHREAD_CONFIG_ADDRESS_CACHE_MAX_SAVED_ENTRIES 8
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_ENABLE_NEIGHBOR_ROUTER_PERSISTENCE
+ *
+ * Define as 1 to save the Extended Addresses of the neighbor routers in non-volatile settings, so that a router
+ * restoring its role after a reset sends unicast Link Requests to its known neighbors right away, in addition to the
+ * multicast Link Request. Unicast requests are acknowledged (and retried) at the MAC layer and answered without the
+ * random delay of multicast requests.
+ *
+ * The list is saved on the state update tick whenever the set of neighbor routers has changed.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_ENABLE_NEIGHBOR_ROUTER_PERSISTENCE
+#define OPENTHREAD_CONFIG_ENABLE_NEIGHBOR_ROUTER_PERSISTENCE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_ENABLE_ADDRESS_QUERY_BATCHING
+ *
+ * Define as 1 to combine Address Queries requested within `OPENTHREAD_CONFIG_ADDRESS_QUERY_BATCH_WINDOW` into a
+ * single multicast Address Query carrying multiple Target TLVs.
+ *
+ * All routers in the network should be able to process multi-target Address Queries before this is enabled.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_ENABLE_ADDRESS_QUERY_BATCHING
+#define OPENTHREAD_CONFIG_ENABLE_ADDRESS_QUERY_BATCHING 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_ADDRESS_QUERY_BATCH_WINDOW
+ *
+ * The time (in milliseconds) Address Query requests are collected before being sent together.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_ADDRESS_QUERY_BATCH_WINDOW
+#define OPENTHREAD_CONFIG_ADDRESS_QUERY_BATCH_WINDOW 20
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_ADDRESS_QUERY_MAX_BATCH_TARGETS
+ *
+ * The maximum number of Target TLVs included in one batched Address Query.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_ADDRESS_QUERY_MAX_BATCH_TARGETS
+#define OPENTHREAD_CONFIG_ADDRESS_QUERY_MAX_BATCH_TARGETS 4
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_ADDRESS_QUERY_TIMEOUT
  *
@@ -306,6 +587,27 @@
 #define OPENTHREAD_CONFIG_CLI_UART_TX_BUFFER_SIZE 1024
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_CLI_BENCHMARK
+ *
+ * Define as 1 to add the CLI `benchmark` command, which times core kernels (AES-CCM*, CRC16, 6LoWPAN compression
+ * and message copy) on the target with `otPlatGetCycleCount()`.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_CLI_BENCHMARK
+#define OPENTHREAD_CONFIG_CLI_BENCHMARK 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_CLI_PERF
+ *
+ * Define as 1 to add the CLI `perf` command, a UDP traffic generator reporting goodput, loss, jitter and RTT.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_CLI_PERF
+#define OPENTHREAD_CONFIG_CLI_PERF 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_MAX_ROUTERS
  *
@@ -322,7 +624,9 @@
 /**
  * @def OPENTHREAD_CONFIG_MAX_CHILDREN
  *
- * The maximum number of children.
+ * The maximum number of children (up to 255).
+ *
+ * Each message reserves one bit per child in its head buffer on FTD builds to track pending indirect transmissions.
  *
  */
 #ifndef OPENTHREAD_CONFIG_MAX_CHILDREN
@@ -349,6 +653,21 @@
 #define OPENTHREAD_CONFIG_IP_ADDRS_PER_CHILD 4
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_CHILD_ADDRESS_POOL_SIZE
+ *
+ * The number of IPv6 address registrations shared by all children (zero to disable).
+ *
+ * When non-zero, the registered (non mesh-local) IPv6 addresses of all children are kept in a single pool of this
+ * size which is indexed by address, instead of a fixed array of `OPENTHREAD_CONFIG_IP_ADDRS_PER_CHILD` entries in
+ * each child. A child can then register any number of addresses as long as the pool has room, and looking up the
+ * child owning an address does not need to go through every child.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_CHILD_ADDRESS_POOL_SIZE
+#define OPENTHREAD_CONFIG_CHILD_ADDRESS_POOL_SIZE 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_IP_ADDRS_TO_REGISTER
  *
@@ -400,1299 +719,2682 @@
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_MPL_SEED_SET_ENTRIES
+ * @def OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_MAX_DATAGRAMS
  *
- * The number of MPL Seed Set entries for duplicate detection.
+ * The maximum number of 6LoWPAN datagrams that may be under reassembly at the same time.
  *
  */
-#ifndef OPENTHREAD_CONFIG_MPL_SEED_SET_ENTRIES
-#define OPENTHREAD_CONFIG_MPL_SEED_SET_ENTRIES 32
+#ifndef OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_MAX_DATAGRAMS
+#define OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_MAX_DATAGRAMS 8
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_MPL_SEED_SET_ENTRY_LIFETIME
+ * @def OPENTHREAD_CONFIG_ENABLE_FRAGMENT_FORWARDING
  *
- * The MPL Seed Set entry lifetime in seconds.
+ * Define as 1 for a router to forward 6LoWPAN fragments of datagrams it relays as each fragment arrives, instead of
+ * reassembling the whole datagram first.
  *
  */
-#ifndef OPENTHREAD_CONFIG_MPL_SEED_SET_ENTRY_LIFETIME
-#define OPENTHREAD_CONFIG_MPL_SEED_SET_ENTRY_LIFETIME 5
+#ifndef OPENTHREAD_CONFIG_ENABLE_FRAGMENT_FORWARDING
+#define OPENTHREAD_CONFIG_ENABLE_FRAGMENT_FORWARDING 0
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_JOINER_UDP_PORT
+ * @def OPENTHREAD_CONFIG_FRAGMENT_FORWARDING_MAX_DATAGRAMS
  *
- * The default Joiner UDP port.
+ * The maximum number of fragmented datagrams that may be forwarded without reassembly at the same time.
  *
  */
-#ifndef OPENTHREAD_CONFIG_JOINER_UDP_PORT
-#define OPENTHREAD_CONFIG_JOINER_UDP_PORT 1000
+#ifndef OPENTHREAD_CONFIG_FRAGMENT_FORWARDING_MAX_DATAGRAMS
+#define OPENTHREAD_CONFIG_FRAGMENT_FORWARDING_MAX_DATAGRAMS 4
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_MAX_ENERGY_RESULTS
+ * @def OPENTHREAD_CONFIG_ENABLE_FAIR_QUEUEING
  *
- * The maximum number of Energy List entries.
+ * Define as 1 to share the direct transmissions of each message priority level fairly (by bytes sent) between flows,
+ * where a flow is identified by the next hop and the IPv6 addresses and ports of a message. Otherwise messages of the
+ * same priority are sent in FIFO order.
  *
  */
-#ifndef OPENTHREAD_CONFIG_MAX_ENERGY_RESULTS
-#define OPENTHREAD_CONFIG_MAX_ENERGY_RESULTS 64
+#ifndef OPENTHREAD_CONFIG_ENABLE_FAIR_QUEUEING
+#define OPENTHREAD_CONFIG_ENABLE_FAIR_QUEUEING 0
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_MAX_JOINER_ENTRIES
+ * @def OPENTHREAD_CONFIG_FAIR_QUEUEING_MAX_FLOWS
  *
- * The maximum number of Joiner entries maintained by the Commissioner.
+ * The number of recently served flows whose transmitted byte count is tracked by the fair queueing scheduler.
  *
  */
-#ifndef OPENTHREAD_CONFIG_MAX_JOINER_ENTRIES
-#define OPENTHREAD_CONFIG_MAX_JOINER_ENTRIES 2
+#ifndef OPENTHREAD_CONFIG_FAIR_QUEUEING_MAX_FLOWS
+#define OPENTHREAD_CONFIG_FAIR_QUEUEING_MAX_FLOWS 8
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_MAX_JOINER_ENTRIES
+ * @def OPENTHREAD_CONFIG_ENABLE_SEND_QUEUE_AQM
  *
- * The maximum number of Joiner Router entries that can be queued by the Joiner.
+ * Define as 1 to enable CoDel active queue management of the direct transmissions in the send queue: messages are
+ * dropped when they start transmission once the time they spent in the send queue has stayed above
+ * `OPENTHREAD_CONFIG_SEND_QUEUE_AQM_TARGET` for `OPENTHREAD_CONFIG_SEND_QUEUE_AQM_INTERVAL`.
+ *
+ * Messages of the network control priority level are never dropped.
  *
  */
-#ifndef OPENTHREAD_CONFIG_MAX_JOINER_ROUTER_ENTRIES
-#define OPENTHREAD_CONFIG_MAX_JOINER_ROUTER_ENTRIES 2
+#ifndef OPENTHREAD_CONFIG_ENABLE_SEND_QUEUE_AQM
+#define OPENTHREAD_CONFIG_ENABLE_SEND_QUEUE_AQM 0
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_MAX_STATECHANGE_HANDLERS
+ * @def OPENTHREAD_CONFIG_SEND_QUEUE_AQM_TARGET
  *
- * The maximum number of state-changed callback handlers (set using `otSetStateChangedCallback()`).
+ * The acceptable time a message spends in the send queue (in milliseconds).
  *
  */
-#ifndef OPENTHREAD_CONFIG_MAX_STATECHANGE_HANDLERS
-#define OPENTHREAD_CONFIG_MAX_STATECHANGE_HANDLERS 1
+#ifndef OPENTHREAD_CONFIG_SEND_QUEUE_AQM_TARGET
+#define OPENTHREAD_CONFIG_SEND_QUEUE_AQM_TARGET 100
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_COAP_ACK_TIMEOUT
+ * @def OPENTHREAD_CONFIG_SEND_QUEUE_AQM_INTERVAL
  *
- * Minimum spacing before first retransmission when ACK is not received (RFC7252 default value is 2).
+ * The time the send queue delay needs to stay above the target before messages are dropped (in milliseconds).
  *
  */
-#ifndef OPENTHREAD_CONFIG_COAP_ACK_TIMEOUT
-#define OPENTHREAD_CONFIG_COAP_ACK_TIMEOUT 2
+#ifndef OPENTHREAD_CONFIG_SEND_QUEUE_AQM_INTERVAL
+#define OPENTHREAD_CONFIG_SEND_QUEUE_AQM_INTERVAL 1000
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_COAP_ACK_RANDOM_FACTOR_NUMERATOR
+ * @def OPENTHREAD_CONFIG_ENABLE_MESSAGE_TRACE
  *
- * Numerator of ACK_RANDOM_FACTOR used to calculate maximum spacing before first retransmission when
- * ACK is not received (RFC7252 default value of ACK_RANDOM_FACTOR is 1.5, must not be decreased below 1).
+ * Define as 1 to timestamp messages when they are added to the send queue, start transmission, hand their first
+ * frame to the MAC and complete transmission, and to collect per-priority queueing and airtime histograms (see
+ * `otMessageGetTraceHistograms()`).
  *
  */
-#ifndef OPENTHREAD_CONFIG_COAP_ACK_RANDOM_FACTOR_NUMERATOR
-#define OPENTHREAD_CONFIG_COAP_ACK_RANDOM_FACTOR_NUMERATOR 3
+#ifndef OPENTHREAD_CONFIG_ENABLE_MESSAGE_TRACE
+#define OPENTHREAD_CONFIG_ENABLE_MESSAGE_TRACE 0
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_COAP_ACK_RANDOM_FACTOR_DENOMINATOR
+ * @def OPENTHREAD_CONFIG_MESSAGE_TRACE_TIMESTAMP_OPTION
  *
- * Denominator of ACK_RANDOM_FACTOR used to calculate maximum spacing before first retransmission when
- * ACK is not received (RFC7252 default value of ACK_RANDOM_FACTOR is 1.5, must not be decreased below 1).
+ * Define as 1 to add a hop-by-hop option carrying the network time to unicast datagrams sent while the network time
+ * is synchronized, and to record the end-to-end latency of received datagrams carrying it.
+ *
+ * Requires `OPENTHREAD_CONFIG_ENABLE_MESSAGE_TRACE` and `OPENTHREAD_CONFIG_ENABLE_TIME_SYNC`.
  *
  */
-#ifndef OPENTHREAD_CONFIG_COAP_ACK_RANDOM_FACTOR_DENOMINATOR
-#define OPENTHREAD_CONFIG_COAP_ACK_RANDOM_FACTOR_DENOMINATOR 2
+#ifndef OPENTHREAD_CONFIG_MESSAGE_TRACE_TIMESTAMP_OPTION
+#define OPENTHREAD_CONFIG_MESSAGE_TRACE_TIMESTAMP_OPTION 0
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_COAP_MAX_RETRANSMIT
+ * @def OPENTHREAD_CONFIG_IP6_SOURCE_ADDRESS_CACHE_ENTRIES
  *
- * Maximum number of retransmissions for CoAP Confirmable messages (RFC7252 default value is 4).
+ * The number of destinations for which the selected IPv6 source address is cached.
+ *
+ * The cache is flushed whenever a unicast address is added to or removed from a network interface. Set to zero to
+ * run source address selection for every message.
  *
  */
-#ifndef OPENTHREAD_CONFIG_COAP_MAX_RETRANSMIT
-#define OPENTHREAD_CONFIG_COAP_MAX_RETRANSMIT 4
+#ifndef OPENTHREAD_CONFIG_IP6_SOURCE_ADDRESS_CACHE_ENTRIES
+#define OPENTHREAD_CONFIG_IP6_SOURCE_ADDRESS_CACHE_ENTRIES 4
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_COAP_SERVER_MAX_CACHED_RESPONSES
+ * @def OPENTHREAD_CONFIG_IP6_REASSEMBLY_MAX_DATAGRAMS
  *
- * Maximum number of cached responses for CoAP Confirmable messages.
+ * The maximum number of IPv6 datagrams that may be under IPv6 fragment reassembly (RFC 8200) at the same time.
  *
- * Cached responses are used for message deduplication.
+ * Set to zero to disable IPv6 reassembly, in which case only atomic fragments are accepted. Reassembly messages use
+ * the reassembly buffer class (`OPENTHREAD_CONFIG_MAX_REASSEMBLY_MESSAGE_BUFFERS`).
  *
  */
-#ifndef OPENTHREAD_CONFIG_COAP_SERVER_MAX_CACHED_RESPONSES
-#define OPENTHREAD_CONFIG_COAP_SERVER_MAX_CACHED_RESPONSES 10
+#ifndef OPENTHREAD_CONFIG_IP6_REASSEMBLY_MAX_DATAGRAMS
+#define OPENTHREAD_CONFIG_IP6_REASSEMBLY_MAX_DATAGRAMS 0
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_DNS_RESPONSE_TIMEOUT
+ * @def OPENTHREAD_CONFIG_IP6_REASSEMBLY_MAX_DATAGRAMS_PER_SOURCE
  *
- * Maximum time that DNS Client waits for response in milliseconds.
+ * The maximum number of IPv6 datagrams from the same source address that may be under reassembly at the same time.
  *
  */
-#ifndef OPENTHREAD_CONFIG_DNS_RESPONSE_TIMEOUT
-#define OPENTHREAD_CONFIG_DNS_RESPONSE_TIMEOUT 3000
+#ifndef OPENTHREAD_CONFIG_IP6_REASSEMBLY_MAX_DATAGRAMS_PER_SOURCE
+#define OPENTHREAD_CONFIG_IP6_REASSEMBLY_MAX_DATAGRAMS_PER_SOURCE 2
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_DNS_MAX_RETRANSMIT
+ * @def OPENTHREAD_CONFIG_IP6_REASSEMBLY_MAX_RANGES
  *
- * Maximum number of retransmissions for DNS client.
+ * The maximum number of disjoint byte ranges (i.e., gaps left by fragments received out of order) tracked for an
+ * IPv6 datagram under reassembly. A datagram needing more ranges is dropped.
  *
  */
-#ifndef OPENTHREAD_CONFIG_DNS_MAX_RETRANSMIT
-#define OPENTHREAD_CONFIG_DNS_MAX_RETRANSMIT 2
+#ifndef OPENTHREAD_CONFIG_IP6_REASSEMBLY_MAX_RANGES
+#define OPENTHREAD_CONFIG_IP6_REASSEMBLY_MAX_RANGES 4
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_SNTP_RESPONSE_TIMEOUT
+ * @def OPENTHREAD_CONFIG_IP6_REASSEMBLY_TIMEOUT
  *
- * Maximum time that SNTP Client waits for response in milliseconds.
+ * The IPv6 fragment reassembly timeout in seconds.
  *
  */
-#ifndef OPENTHREAD_CONFIG_SNTP_RESPONSE_TIMEOUT
-#define OPENTHREAD_CONFIG_SNTP_RESPONSE_TIMEOUT 3000
+#ifndef OPENTHREAD_CONFIG_IP6_REASSEMBLY_TIMEOUT
+#define OPENTHREAD_CONFIG_IP6_REASSEMBLY_TIMEOUT 60
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_SNTP_MAX_RETRANSMIT
+ * @def OPENTHREAD_CONFIG_UDP_SOCKET_HASH_BUCKETS
  *
- * Maximum number of retransmissions for SNTP client.
+ * The number of hash buckets used to look up UDP sockets by local port (must be a power of two).
  *
  */
-#ifndef OPENTHREAD_CONFIG_SNTP_MAX_RETRANSMIT
-#define OPENTHREAD_CONFIG_SNTP_MAX_RETRANSMIT 2
+#ifndef OPENTHREAD_CONFIG_UDP_SOCKET_HASH_BUCKETS
+#define OPENTHREAD_CONFIG_UDP_SOCKET_HASH_BUCKETS 8
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_JOIN_BEACON_VERSION
+ * @def OPENTHREAD_CONFIG_ENABLE_TCP
  *
- * The Beacon version to use when the beacon join flag is set.
+ * Define as 1 to enable the TCP transport and the `otTcp*` socket API.
  *
  */
-#ifndef OPENTHREAD_CONFIG_JOIN_BEACON_VERSION
-#define OPENTHREAD_CONFIG_JOIN_BEACON_VERSION kProtocolVersion
+#ifndef OPENTHREAD_CONFIG_ENABLE_TCP
+#define OPENTHREAD_CONFIG_ENABLE_TCP 0
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT
+ * @def OPENTHREAD_CONFIG_TCP_MSS
  *
- * The message pool is managed by platform defined logic when this flag is set.
- * This feature would typically be used when operating in a multi-threaded system
- * and multiple threads need to access the message pool.
+ * The maximum TCP segment size in bytes, as sent and advertised by a TCP socket.
+ *
+ * Smaller segments need fewer 6LoWPAN fragments, so losing a single frame costs less to recover.
  *
  */
-#ifndef OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT
-#define OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT 0
+#ifndef OPENTHREAD_CONFIG_TCP_MSS
+#define OPENTHREAD_CONFIG_TCP_MSS 512
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_MAC_FILTER_SIZE
+ * @def OPENTHREAD_CONFIG_TCP_SEND_BUFFER_SIZE
  *
- * The number of MAC Filter entries.
+ * The maximum number of bytes a TCP socket keeps queued or unacknowledged, which also bounds its send window.
+ *
+ * The data is held in message buffers from the message pool.
  *
  */
-#ifndef OPENTHREAD_CONFIG_MAC_FILTER_SIZE
-#define OPENTHREAD_CONFIG_MAC_FILTER_SIZE 32
+#ifndef OPENTHREAD_CONFIG_TCP_SEND_BUFFER_SIZE
+#define OPENTHREAD_CONFIG_TCP_SEND_BUFFER_SIZE 2048
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_STORE_FRAME_COUNTER_AHEAD
+ * @def OPENTHREAD_CONFIG_TCP_RECEIVE_WINDOW
  *
- *  The value ahead of the current frame counter for persistent storage
+ * The receive window in bytes advertised by a TCP socket.
+ *
+ * Received data is handed to the application as it arrives, so the window only limits how much the peer sends ahead.
  *
  */
-#ifndef OPENTHREAD_CONFIG_STORE_FRAME_COUNTER_AHEAD
-#define OPENTHREAD_CONFIG_STORE_FRAME_COUNTER_AHEAD 1000
+#ifndef OPENTHREAD_CONFIG_TCP_RECEIVE_WINDOW
+#define OPENTHREAD_CONFIG_TCP_RECEIVE_WINDOW 2048
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_MESHCOP_PENDING_DATASET_MINIMUM_DELAY
+ * @def OPENTHREAD_CONFIG_ENABLE_KEY_SCHEDULE_CACHE
  *
- * Minimum Delay Timer value for a Pending Operational Dataset (in ms).
+ * Define as 1 to keep the expanded AES key schedules of the MAC and MLE keys for the current, previous and next key
+ * sequence, so that secured frames and MLE messages do not run the AES key expansion each time.
  *
- * Thread specification defines this value as 30,000 ms. Changing from the specified value should be done for testing
- * only.
+ * This uses RAM for six AES contexts.
  *
  */
-#ifndef OPENTHREAD_CONFIG_MESHCOP_PENDING_DATASET_MINIMUM_DELAY
-#define OPENTHREAD_CONFIG_MESHCOP_PENDING_DATASET_MINIMUM_DELAY 30000
+#ifndef OPENTHREAD_CONFIG_ENABLE_KEY_SCHEDULE_CACHE
+#define OPENTHREAD_CONFIG_ENABLE_KEY_SCHEDULE_CACHE 0
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_MESHCOP_PENDING_DATASET_DEFAULT_DELAY
+ * @def OPENTHREAD_CONFIG_AES_CCM_CTR_BATCH_BLOCKS
  *
- * Default Delay Timer value for a Pending Operational Dataset (in ms).
+ * The number of AES-CCM* CTR keystream blocks generated together through the multi-block `AesEcb::Encrypt()`.
  *
- * Thread specification defines this value as 300,000 ms. Changing from the specified value should be done for testing
- * only.
+ * Values above 1 let a pipelined or vectorized AES implementation process several counter blocks at once, at the
+ * cost of 32 bytes of stack per additional block in each AES-CCM* computation.
  *
  */
-#ifndef OPENTHREAD_CONFIG_MESHCOP_PENDING_DATASET_DEFAULT_DELAY
-#define OPENTHREAD_CONFIG_MESHCOP_PENDING_DATASET_DEFAULT_DELAY 300000
+#ifndef OPENTHREAD_CONFIG_AES_CCM_CTR_BATCH_BLOCKS
+#define OPENTHREAD_CONFIG_AES_CCM_CTR_BATCH_BLOCKS 1
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_LOG_OUTPUT
- *
- * Selects if, and where the LOG output goes to.
+ * @def OPENTHREAD_CONFIG_ENABLE_PLATFORM_AES_CCM
  *
- * There are several options available
- * - @sa OPENTHREAD_CONFIG_LOG_OUTPUT_NONE
- * - @sa OPENTHREAD_CONFIG_LOG_OUTPUT_DEBUG_UART
- * - @sa OPENTHREAD_CONFIG_LOG_OUTPUT_APP
- * - @sa OPENTHREAD_CONFIG_LOG_OUTPUT_PLATFORM_DEFINED
- * - @sa OPENTHREAD_CONFIG_LOG_OUTPUT_NCP_SPINEL
- * - and others
+ * Define as 1 to offer IEEE 802.15.4 frame AES-CCM* processing to the platform through `otPlatCryptoAesCcm()`.
  *
- * Note:
+ * The software implementation is used whenever the platform returns `OT_ERROR_NOT_IMPLEMENTED`.
  *
- * 1) Because the default is: OPENTHREAD_CONFIG_LOG_OUTPUT_PLATFORM_DEFINED
- *    The platform is expected to provide at least a stub for `otPlatLog()`
+ */
+#ifndef OPENTHREAD_CONFIG_ENABLE_PLATFORM_AES_CCM
+#define OPENTHREAD_CONFIG_ENABLE_PLATFORM_AES_CCM 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MPL_SEED_SET_ENTRIES
  *
- * 2) This is effectively an ENUM so it can be if/else/endif at compile time.
+ * The number of MPL Seed Set entries for duplicate detection.
  *
  */
-#ifndef OPENTHREAD_CONFIG_LOG_OUTPUT
-#define OPENTHREAD_CONFIG_LOG_OUTPUT OPENTHREAD_CONFIG_LOG_OUTPUT_PLATFORM_DEFINED
+#ifndef OPENTHREAD_CONFIG_MPL_SEED_SET_ENTRIES
+#define OPENTHREAD_CONFIG_MPL_SEED_SET_ENTRIES 32
 #endif
 
-/** Log output goes to the bit bucket (disabled) */
-#define OPENTHREAD_CONFIG_LOG_OUTPUT_NONE 0
-/** Log output goes to the debug uart - requires OPENTHREAD_CONFIG_ENABLE_DEBUG_UART to be enabled */
-#define OPENTHREAD_CONFIG_LOG_OUTPUT_DEBUG_UART 1
-/** Log output goes to the "application" provided otPlatLog() in NCP and CLI code */
-#define OPENTHREAD_CONFIG_LOG_OUTPUT_APP 2
-/** Log output is handled by a platform defined function */
-#define OPENTHREAD_CONFIG_LOG_OUTPUT_PLATFORM_DEFINED 3
-/** Log output for NCP goes to Spinel `STREAM_LOG` property (for CLI platform defined function is expected) */
-#define OPENTHREAD_CONFIG_LOG_OUTPUT_NCP_SPINEL 4
-
 /**
- * @def OPENTHREAD_CONFIG_LOG_LEVEL
+ * @def OPENTHREAD_CONFIG_MPL_SEED_SET_NUM_BUCKETS
  *
- * The log level (used at compile time).
+ * The number of hash buckets used to look up MPL Seed Set entries by Seed Id.
  *
  */
-#ifndef OPENTHREAD_CONFIG_LOG_LEVEL
-#define OPENTHREAD_CONFIG_LOG_LEVEL OT_LOG_LEVEL_CRIT
+#ifndef OPENTHREAD_CONFIG_MPL_SEED_SET_NUM_BUCKETS
+#define OPENTHREAD_CONFIG_MPL_SEED_SET_NUM_BUCKETS 8
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_ENABLE_DYNAMIC_LOG_LEVEL
+ * @def OPENTHREAD_CONFIG_MPL_DATA_MESSAGE_REDUNDANCY_CONSTANT
  *
- * Define as 1 to enable dynamic log level control.
+ * The Trickle redundancy constant (k) of buffered MPL Data Messages: a retransmission is suppressed when the same
+ * MPL Data Message was heard from other forwarders at least this many times since the previous transmission.
  *
- * Note that the OPENTHREAD_CONFIG_LOG_LEVEL determines the log level at
- * compile time. The dynamic log level control (if enabled) only allows
- * decreasing the log level from the compile time value.
+ * Zero disables the suppression (every Trickle timer expiration retransmits the message).
  *
  */
-#ifndef OPENTHREAD_CONFIG_ENABLE_DYNAMIC_LOG_LEVEL
-#define OPENTHREAD_CONFIG_ENABLE_DYNAMIC_LOG_LEVEL 0
+#ifndef OPENTHREAD_CONFIG_MPL_DATA_MESSAGE_REDUNDANCY_CONSTANT
+#define OPENTHREAD_CONFIG_MPL_DATA_MESSAGE_REDUNDANCY_CONSTANT 0
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_LOG_API
+ * @def OPENTHREAD_CONFIG_MPL_SEED_SET_ENTRY_LIFETIME
  *
- * Define to enable OpenThread API logging.
+ * The MPL Seed Set entry lifetime in seconds.
  *
  */
-#ifndef OPENTHREAD_CONFIG_LOG_API
-#define OPENTHREAD_CONFIG_LOG_API 1
+#ifndef OPENTHREAD_CONFIG_MPL_SEED_SET_ENTRY_LIFETIME
+#define OPENTHREAD_CONFIG_MPL_SEED_SET_ENTRY_LIFETIME 5
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_LOG_MLE
+ * @def OPENTHREAD_CONFIG_JOINER_UDP_PORT
  *
- * Define to enable MLE logging.
+ * The default Joiner UDP port.
  *
  */
-#ifndef OPENTHREAD_CONFIG_LOG_MLE
-#define OPENTHREAD_CONFIG_LOG_MLE 1
+#ifndef OPENTHREAD_CONFIG_JOINER_UDP_PORT
+#define OPENTHREAD_CONFIG_JOINER_UDP_PORT 1000
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_LOG_ARP
+ * @def OPENTHREAD_CONFIG_MAX_ENERGY_RESULTS
  *
- * Define to enable EID-to-RLOC map logging.
+ * The maximum number of Energy List entries.
  *
  */
-#ifndef OPENTHREAD_CONFIG_LOG_ARP
-#define OPENTHREAD_CONFIG_LOG_ARP 1
+#ifndef OPENTHREAD_CONFIG_MAX_ENERGY_RESULTS
+#define OPENTHREAD_CONFIG_MAX_ENERGY_RESULTS 64
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_LOG_NETDATA
+ * @def OPENTHREAD_CONFIG_BORDER_AGENT_PROXY_RATE_LIMIT
  *
- * Define to enable Network Data logging.
+ * The maximum rate (in messages per second) at which the Border Agent forwards PROXY_TX.ntf payloads from the
+ * external commissioner session into the Thread network.
+ *
+ * 0 disables rate limiting.
  *
  */
-#ifndef OPENTHREAD_CONFIG_LOG_NETDATA
-#define OPENTHREAD_CONFIG_LOG_NETDATA 1
+#ifndef OPENTHREAD_CONFIG_BORDER_AGENT_PROXY_RATE_LIMIT
+#define OPENTHREAD_CONFIG_BORDER_AGENT_PROXY_RATE_LIMIT 0
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_LOG_ICMP
+ * @def OPENTHREAD_CONFIG_BORDER_AGENT_PROXY_BURST
  *
- * Define to enable ICMPv6 logging.
+ * The number of PROXY_TX.ntf payloads the Border Agent forwards back-to-back before
+ * `OPENTHREAD_CONFIG_BORDER_AGENT_PROXY_RATE_LIMIT` applies.
  *
  */
-#ifndef OPENTHREAD_CONFIG_LOG_ICMP
-#define OPENTHREAD_CONFIG_LOG_ICMP 1
+#ifndef OPENTHREAD_CONFIG_BORDER_AGENT_PROXY_BURST
+#define OPENTHREAD_CONFIG_BORDER_AGENT_PROXY_BURST 8
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_LOG_IP6
+ * @def OPENTHREAD_CONFIG_MAX_JOINER_ENTRIES
  *
- * Define to enable IPv6 logging.
+ * The maximum number of Joiner entries maintained by the Commissioner.
  *
  */
-#ifndef OPENTHREAD_CONFIG_LOG_IP6
-#define OPENTHREAD_CONFIG_LOG_IP6 1
+#ifndef OPENTHREAD_CONFIG_MAX_JOINER_ENTRIES
+#define OPENTHREAD_CONFIG_MAX_JOINER_ENTRIES 2
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_LOG_MAC
+ * @def OPENTHREAD_CONFIG_COMMISSIONER_PSKC_CACHE_SIZE
  *
- * Define to enable IEEE 802.15.4 MAC logging.
+ * The number of PSKc values cached by the Commissioner, keyed on passphrase, network name and extended PAN ID.
+ *
+ * A cache hit avoids re-running the 16384 PBKDF2-AES-CMAC iterations. 0 disables the cache.
  *
  */
-#ifndef OPENTHREAD_CONFIG_LOG_MAC
-#define OPENTHREAD_CONFIG_LOG_MAC 1
+#ifndef OPENTHREAD_CONFIG_COMMISSIONER_PSKC_CACHE_SIZE
+#define OPENTHREAD_CONFIG_COMMISSIONER_PSKC_CACHE_SIZE 0
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_LOG_MEM
+ * @def OPENTHREAD_CONFIG_COMMISSIONER_SET_DELAY
  *
- * Define to enable memory logging.
+ * The delay (in milliseconds) the Commissioner waits after a Joiner entry is added or removed before sending
+ * MGMT_COMMISSIONER_SET.request, so that a batch of changes is announced to the Leader in a single message.
+ *
+ * 0 sends the updated steering data immediately on each change.
  *
  */
-#ifndef OPENTHREAD_CONFIG_LOG_MEM
-#define OPENTHREAD_CONFIG_LOG_MEM 1
+#ifndef OPENTHREAD_CONFIG_COMMISSIONER_SET_DELAY
+#define OPENTHREAD_CONFIG_COMMISSIONER_SET_DELAY 0
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_LOG_PKT_DUMP
+ * @def OPENTHREAD_CONFIG_MAX_JOINER_ENTRIES
  *
- * Define to enable log content of packets.
+ * The maximum number of Joiner Router entries that can be queued by the Joiner.
  *
  */
-#ifndef OPENTHREAD_CONFIG_LOG_PKT_DUMP
-#define OPENTHREAD_CONFIG_LOG_PKT_DUMP 1
+#ifndef OPENTHREAD_CONFIG_MAX_JOINER_ROUTER_ENTRIES
+#define OPENTHREAD_CONFIG_MAX_JOINER_ROUTER_ENTRIES 2
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_LOG_NETDIAG
+ * @def OPENTHREAD_CONFIG_JOINER_ROUTER_RELAY_COALESCE_DELAY
  *
- * Define to enable network diagnostic logging.
+ * The time (in milliseconds) the Joiner Router holds a small DTLS datagram from a joiner, so that further datagrams
+ * from the same joiner can be appended to the same RLY_RX.ntf message.
+ *
+ * 0 relays each datagram in its own RLY_RX.ntf message.
  *
  */
-#ifndef OPENTHREAD_CONFIG_LOG_NETDIAG
-#define OPENTHREAD_CONFIG_LOG_NETDIAG 1
+#ifndef OPENTHREAD_CONFIG_JOINER_ROUTER_RELAY_COALESCE_DELAY
+#define OPENTHREAD_CONFIG_JOINER_ROUTER_RELAY_COALESCE_DELAY 0
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_LOG_PLATFORM
+ * @def OPENTHREAD_CONFIG_MAX_STATECHANGE_HANDLERS
  *
- * Define to enable platform region logging.
+ * The maximum number of state-changed callback handlers (set using `otSetStateChangedCallback()`).
  *
  */
-#ifndef OPENTHREAD_CONFIG_LOG_PLATFORM
-#define OPENTHREAD_CONFIG_LOG_PLATFORM 0
+#ifndef OPENTHREAD_CONFIG_MAX_STATECHANGE_HANDLERS
+#define OPENTHREAD_CONFIG_MAX_STATECHANGE_HANDLERS 1
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_LOG_CLI
+ * @def OPENTHREAD_CONFIG_COAP_ACK_TIMEOUT
  *
- * Define to enable CLI logging.
+ * Minimum spacing before first retransmission when ACK is not received (RFC7252 default value is 2).
  *
  */
-#ifndef OPENTHREAD_CONFIG_LOG_CLI
-#define OPENTHREAD_CONFIG_LOG_CLI 1
+#ifndef OPENTHREAD_CONFIG_COAP_ACK_TIMEOUT
+#define OPENTHREAD_CONFIG_COAP_ACK_TIMEOUT 2
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_LOG_COAP
+ * @def OPENTHREAD_CONFIG_COAP_ACK_RANDOM_FACTOR_NUMERATOR
  *
- * Define to enable COAP logging.
+ * Numerator of ACK_RANDOM_FACTOR used to calculate maximum spacing before first retransmission when
+ * ACK is not received (RFC7252 default value of ACK_RANDOM_FACTOR is 1.5, must not be decreased below 1).
  *
  */
-#ifndef OPENTHREAD_CONFIG_LOG_COAP
-#define OPENTHREAD_CONFIG_LOG_COAP 1
+#ifndef OPENTHREAD_CONFIG_COAP_ACK_RANDOM_FACTOR_NUMERATOR
+#define OPENTHREAD_CONFIG_COAP_ACK_RANDOM_FACTOR_NUMERATOR 3
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_LOG_CORE
+ * @def OPENTHREAD_CONFIG_COAP_ACK_RANDOM_FACTOR_DENOMINATOR
  *
- * Define to enable OpenThread Core logging.
+ * Denominator of ACK_RANDOM_FACTOR used to calculate maximum spacing before first retransmission when
+ * ACK is not received (RFC7252 default value of ACK_RANDOM_FACTOR is 1.5, must not be decreased below 1).
  *
  */
-#ifndef OPENTHREAD_CONFIG_LOG_CORE
-#define OPENTHREAD_CONFIG_LOG_CORE 1
+#ifndef OPENTHREAD_CONFIG_COAP_ACK_RANDOM_FACTOR_DENOMINATOR
+#define OPENTHREAD_CONFIG_COAP_ACK_RANDOM_FACTOR_DENOMINATOR 2
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_LOG_UTIL
+ * @def OPENTHREAD_CONFIG_COAP_MAX_RETRANSMIT
  *
- * Define to enable OpenThread Utility module logging.
+ * Maximum number of retransmissions for CoAP Confirmable messages (RFC7252 default value is 4).
  *
  */
-#ifndef OPENTHREAD_CONFIG_LOG_UTIL
-#define OPENTHREAD_CONFIG_LOG_UTIL 1
+#ifndef OPENTHREAD_CONFIG_COAP_MAX_RETRANSMIT
+#define OPENTHREAD_CONFIG_COAP_MAX_RETRANSMIT 4
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_LOG_PREPEND_LEVEL
+ * @def OPENTHREAD_CONFIG_COAP_SERVER_MAX_CACHED_RESPONSES
  *
- * Define to prepend the log level to all log messages
+ * Maximum number of cached responses for CoAP Confirmable messages.
+ *
+ * Cached responses are used for message deduplication.
  *
  */
-#ifndef OPENTHREAD_CONFIG_LOG_PREPEND_LEVEL
-#define OPENTHREAD_CONFIG_LOG_PREPEND_LEVEL 1
+#ifndef OPENTHREAD_CONFIG_COAP_SERVER_MAX_CACHED_RESPONSES
+#define OPENTHREAD_CONFIG_COAP_SERVER_MAX_CACHED_RESPONSES 10
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_LOG_PREPEND_REGION
+ * @def OPENTHREAD_CONFIG_COAP_RESOURCE_HASH_BUCKETS
  *
- * Define to prepend the log region to all log messages
+ * The number of hash buckets used to look up CoAP resources by Uri-Path (must be a power of two).
  *
  */
-#ifndef OPENTHREAD_CONFIG_LOG_PREPEND_REGION
-#define OPENTHREAD_CONFIG_LOG_PREPEND_REGION 1
+#ifndef OPENTHREAD_CONFIG_COAP_RESOURCE_HASH_BUCKETS
+#define OPENTHREAD_CONFIG_COAP_RESOURCE_HASH_BUCKETS 8
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_LOG_SUFFIX
+ * @def OPENTHREAD_CONFIG_ENABLE_COAP_BLOCKWISE_TRANSFER
  *
- * Define suffix to append at the end of logs.
+ * Define as 1 to enable CoAP block-wise transfer (RFC 7959).
+ *
+ * Payloads are produced and consumed one block at a time through application hooks, so only one block of a large
+ * transfer is held in message buffers at any time.
  *
  */
-#ifndef OPENTHREAD_CONFIG_LOG_SUFFIX
-#define OPENTHREAD_CONFIG_LOG_SUFFIX ""
+#ifndef OPENTHREAD_CONFIG_ENABLE_COAP_BLOCKWISE_TRANSFER
+#define OPENTHREAD_CONFIG_ENABLE_COAP_BLOCKWISE_TRANSFER 0
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_LOG_SRC_DST_IP_ADDRESSES
+ * @def OPENTHREAD_CONFIG_COAP_MAX_BLOCK_LENGTH
  *
- * If defined as 1 when IPv6 message info is logged in mesh-forwarder, the source and destination IPv6 addresses of
- * messages are also included.
+ * The largest CoAP block size (in bytes) used for block-wise transfer (a power of two between 16 and 1024).
+ *
+ * Larger received blocks are passed to the receive hooks in parts of this size.
  *
  */
-#ifndef OPENTHREAD_CONFIG_LOG_SRC_DST_IP_ADDRESSES
-#define OPENTHREAD_CONFIG_LOG_SRC_DST_IP_ADDRESSES 1
+#ifndef OPENTHREAD_CONFIG_COAP_MAX_BLOCK_LENGTH
+#define OPENTHREAD_CONFIG_COAP_MAX_BLOCK_LENGTH 256
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_PLAT_LOG_FUNCTION
+ * @def OPENTHREAD_CONFIG_ENABLE_COAP_OBSERVE
  *
- * Defines the name of function/macro used for logging inside OpenThread, by default it is set to `otPlatLog()`.
+ * Define as 1 to enable CoAP resource observation (RFC 7641).
  *
  */
-#ifndef OPENTHREAD_CONFIG_PLAT_LOG_FUNCTION
-#define OPENTHREAD_CONFIG_PLAT_LOG_FUNCTION otPlatLog
+#ifndef OPENTHREAD_CONFIG_ENABLE_COAP_OBSERVE
+#define OPENTHREAD_CONFIG_ENABLE_COAP_OBSERVE 0
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_NUM_DHCP_PREFIXES
+ * @def OPENTHREAD_CONFIG_COAP_MAX_OBSERVERS
  *
- * The number of dhcp prefixes.
+ * The maximum number of observers a CoAP server keeps track of.
  *
  */
-#ifndef OPENTHREAD_CONFIG_NUM_DHCP_PREFIXES
-#define OPENTHREAD_CONFIG_NUM_DHCP_PREFIXES 4
+#ifndef OPENTHREAD_CONFIG_COAP_MAX_OBSERVERS
+#define OPENTHREAD_CONFIG_COAP_MAX_OBSERVERS 4
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_NUM_SLAAC_ADDRESSES
+ * @def OPENTHREAD_CONFIG_ENABLE_COAP_ADAPTIVE_RTO
  *
- * The number of auto-configured SLAAC addresses.
+ * Define as 1 to enable adaptive CoAP retransmission timeouts.
+ *
+ * The initial retransmission timeout and the backoff factor of confirmable messages are derived from round-trip time
+ * estimates kept per destination, as specified by CoCoA (draft-ietf-core-cocoa), instead of the fixed
+ * `OPENTHREAD_CONFIG_COAP_ACK_TIMEOUT` and binary exponential backoff.
  *
  */
-#ifndef OPENTHREAD_CONFIG_NUM_SLAAC_ADDRESSES
-#define OPENTHREAD_CONFIG_NUM_SLAAC_ADDRESSES 4
+#ifndef OPENTHREAD_CONFIG_ENABLE_COAP_ADAPTIVE_RTO
+#define OPENTHREAD_CONFIG_ENABLE_COAP_ADAPTIVE_RTO 0
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_NCP_TX_BUFFER_SIZE
+ * @def OPENTHREAD_CONFIG_COAP_RTO_ESTIMATOR_ENTRIES
  *
- *  The size of NCP message buffer in bytes
+ * The number of destinations for which CoAP round-trip time estimates are kept.
+ *
+ * The least recently updated destination is replaced when the table is full.
  *
  */
-#ifndef OPENTHREAD_CONFIG_NCP_TX_BUFFER_SIZE
-#define OPENTHREAD_CONFIG_NCP_TX_BUFFER_SIZE 512
+#ifndef OPENTHREAD_CONFIG_COAP_RTO_ESTIMATOR_ENTRIES
+#define OPENTHREAD_CONFIG_COAP_RTO_ESTIMATOR_ENTRIES 8
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_NCP_UART_TX_CHUNK_SIZE
+ * @def OPENTHREAD_CONFIG_ENABLE_COAP_REQUEST_WINDOW
  *
- *  The size of NCP UART TX chunk in bytes
+ * Define as 1 to limit the number of outstanding CoAP requests per destination.
+ *
+ * Requests exceeding the window are queued and sent once an outstanding request is acknowledged or completed.
  *
  */
-#ifndef OPENTHREAD_CONFIG_NCP_UART_TX_CHUNK_SIZE
-#define OPENTHREAD_CONFIG_NCP_UART_TX_CHUNK_SIZE 128
+#ifndef OPENTHREAD_CONFIG_ENABLE_COAP_REQUEST_WINDOW
+#define OPENTHREAD_CONFIG_ENABLE_COAP_REQUEST_WINDOW 0
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_NCP_UART_RX_BUFFER_SIZE
+ * @def OPENTHREAD_CONFIG_COAP_NSTART
  *
- *  The size of NCP UART RX buffer in bytes
+ * The default number of outstanding CoAP interactions per destination (NSTART, RFC 7252).
  *
  */
-#ifndef OPENTHREAD_CONFIG_NCP_UART_RX_BUFFER_SIZE
-#if OPENTHREAD_RADIO
-#define OPENTHREAD_CONFIG_NCP_UART_RX_BUFFER_SIZE 512
-#else
-#define OPENTHREAD_CONFIG_NCP_UART_RX_BUFFER_SIZE 1300
+#ifndef OPENTHREAD_CONFIG_COAP_NSTART
+#define OPENTHREAD_CONFIG_COAP_NSTART 1
 #endif
-#endif // OPENTHREAD_CONFIG_NCP_UART_RX_BUFFER_SIZE
 
 /**
- * @def OPENTHREAD_CONFIG_NCP_SPI_BUFFER_SIZE
+ * @def OPENTHREAD_CONFIG_DNS_RESPONSE_TIMEOUT
  *
- *  The size of NCP SPI (RX/TX) buffer in bytes
+ * Maximum time that DNS Client waits for response in milliseconds.
  *
  */
-#ifndef OPENTHREAD_CONFIG_NCP_SPI_BUFFER_SIZE
-#if OPENTHREAD_RADIO
-#define OPENTHREAD_CONFIG_NCP_SPI_BUFFER_SIZE 512
-#else
-#define OPENTHREAD_CONFIG_NCP_SPI_BUFFER_SIZE 1300
+#ifndef OPENTHREAD_CONFIG_DNS_RESPONSE_TIMEOUT
+#define OPENTHREAD_CONFIG_DNS_RESPONSE_TIMEOUT 3000
 #endif
-#endif // OPENTHREAD_CONFIG_NCP_SPI_BUFFER_SIZE
 
 /**
- * @def OPENTHREAD_CONFIG_NCP_SPINEL_ENCRYPTER_EXTRA_DATA_SIZE
+ * @def OPENTHREAD_CONFIG_DNS_MAX_RETRANSMIT
  *
- *  The size of extra data to be allocated in UART buffer,
- *  needed by NCP Spinel Encrypter.
+ * Maximum number of retransmissions for DNS client.
  *
  */
-#ifndef OPENTHREAD_CONFIG_NCP_SPINEL_ENCRYPTER_EXTRA_DATA_SIZE
-#define OPENTHREAD_CONFIG_NCP_SPINEL_ENCRYPTER_EXTRA_DATA_SIZE 0
+#ifndef OPENTHREAD_CONFIG_DNS_MAX_RETRANSMIT
+#define OPENTHREAD_CONFIG_DNS_MAX_RETRANSMIT 2
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_NCP_SPINEL_LOG_MAX_SIZE
+ * @def OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENTRIES
  *
- * The maximum OpenThread log string size (number of chars) supported by NCP using Spinel `StreamWrite`.
+ * The number of entries in the DNS client cache of AAAA query results.
+ *
+ * Cached answers (and negative answers) are returned to subsequent queries for the same hostname, without sending a
+ * query, until their TTL expires. Set to zero to disable the cache.
  *
  */
-#ifndef OPENTHREAD_CONFIG_NCP_SPINEL_LOG_MAX_SIZE
-#define OPENTHREAD_CONFIG_NCP_SPINEL_LOG_MAX_SIZE 150
+#ifndef OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENTRIES
+#define OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENTRIES 0
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_PLATFORM_ASSERT_MANAGEMENT
+ * @def OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_HOSTNAME_LENGTH
+ *
+ * The maximum length of a hostname stored in the DNS client cache. Results for longer hostnames are not cached.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_HOSTNAME_LENGTH
+#define OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_HOSTNAME_LENGTH 63
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_TTL
+ *
+ * The maximum time in seconds that the DNS client caches an answer (regardless of a larger record TTL).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_TTL
+#define OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_TTL 86400
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_NEGATIVE_TTL
+ *
+ * The time in seconds that the DNS client caches a negative answer (a non-existent name or no AAAA record).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_NEGATIVE_TTL
+#define OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_NEGATIVE_TTL 30
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_SNTP_RESPONSE_TIMEOUT
+ *
+ * Maximum time that SNTP Client waits for response in milliseconds.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_SNTP_RESPONSE_TIMEOUT
+#define OPENTHREAD_CONFIG_SNTP_RESPONSE_TIMEOUT 3000
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_SNTP_MAX_RETRANSMIT
+ *
+ * Maximum number of retransmissions for SNTP client.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_SNTP_MAX_RETRANSMIT
+#define OPENTHREAD_CONFIG_SNTP_MAX_RETRANSMIT 2
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_JOIN_BEACON_VERSION
+ *
+ * The Beacon version to use when the beacon join flag is set.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_JOIN_BEACON_VERSION
+#define OPENTHREAD_CONFIG_JOIN_BEACON_VERSION kProtocolVersion
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT
+ *
+ * The message pool is managed by platform defined logic when this flag is set.
+ * This feature would typically be used when operating in a multi-threaded system
+ * and multiple threads need to access the message pool.
+ *
+ * `examples/platforms/utils/message_pool.c` provides a lock-free implementation which can be used by such platforms.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT
+#define OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_PLATFORM_CHECKSUM
+ *
+ * The Internet checksum of message contents is computed by the platform (`otPlatChecksumUpdate()`) when this flag
+ * is set, e.g., to use a hardware accelerator or a hand-optimized routine.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_PLATFORM_CHECKSUM
+#define OPENTHREAD_CONFIG_PLATFORM_CHECKSUM 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MAC_FILTER_SIZE
+ *
+ * The number of MAC Filter entries.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MAC_FILTER_SIZE
+#define OPENTHREAD_CONFIG_MAC_FILTER_SIZE 32
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MAC_FILTER_NUM_BUCKETS
+ *
+ * The number of hash buckets used to look up MAC Filter entries by Extended Address.
+ *
+ * Lookups take constant time on average when this is close to OPENTHREAD_CONFIG_MAC_FILTER_SIZE.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MAC_FILTER_NUM_BUCKETS
+#define OPENTHREAD_CONFIG_MAC_FILTER_NUM_BUCKETS 8
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_STORE_FRAME_COUNTER_AHEAD
+ *
+ *  The value ahead of the current frame counter for persistent storage
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_STORE_FRAME_COUNTER_AHEAD
+#define OPENTHREAD_CONFIG_STORE_FRAME_COUNTER_AHEAD 1000
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_STORE_FRAME_COUNTERS_SEPARATELY
+ *
+ * Define as 1 to persist the MAC and MLE frame counters under their own small settings key when they cross the
+ * stored value, instead of rewriting the whole network information record.
+ *
+ * The network information record is still written on role and key sequence changes. On restore, the larger of the
+ * two stored values is used for each frame counter.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_STORE_FRAME_COUNTERS_SEPARATELY
+#define OPENTHREAD_CONFIG_STORE_FRAME_COUNTERS_SEPARATELY 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MESHCOP_PENDING_DATASET_MINIMUM_DELAY
+ *
+ * Minimum Delay Timer value for a Pending Operational Dataset (in ms).
+ *
+ * Thread specification defines this value as 30,000 ms. Changing from the specified value should be done for testing
+ * only.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MESHCOP_PENDING_DATASET_MINIMUM_DELAY
+#define OPENTHREAD_CONFIG_MESHCOP_PENDING_DATASET_MINIMUM_DELAY 30000
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MESHCOP_PENDING_DATASET_DEFAULT_DELAY
+ *
+ * Default Delay Timer value for a Pending Operational Dataset (in ms).
+ *
+ * Thread specification defines this value as 300,000 ms. Changing from the specified value should be done for testing
+ * only.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MESHCOP_PENDING_DATASET_DEFAULT_DELAY
+#define OPENTHREAD_CONFIG_MESHCOP_PENDING_DATASET_DEFAULT_DELAY 300000
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_LOG_OUTPUT
+ *
+ * Selects if, and where the LOG output goes to.
+ *
+ * There are several options available
+ * - @sa OPENTHREAD_CONFIG_LOG_OUTPUT_NONE
+ * - @sa OPENTHREAD_CONFIG_LOG_OUTPUT_DEBUG_UART
+ * - @sa OPENTHREAD_CONFIG_LOG_OUTPUT_APP
+ * - @sa OPENTHREAD_CONFIG_LOG_OUTPUT_PLATFORM_DEFINED
+ * - @sa OPENTHREAD_CONFIG_LOG_OUTPUT_NCP_SPINEL
+ * - and others
+ *
+ * Note:
+ *
+ * 1) Because the default is: OPENTHREAD_CONFIG_LOG_OUTPUT_PLATFORM_DEFINED
+ *    The platform is expected to provide at least a stub for `otPlatLog()`
+ *
+ * 2) This is effectively an ENUM so it can be if/else/endif at compile time.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_LOG_OUTPUT
+#define OPENTHREAD_CONFIG_LOG_OUTPUT OPENTHREAD_CONFIG_LOG_OUTPUT_PLATFORM_DEFINED
+#endif
+
+/** Log output goes to the bit bucket (disabled) */
+#define OPENTHREAD_CONFIG_LOG_OUTPUT_NONE 0
+/** Log output goes to the debug uart - requires OPENTHREAD_CONFIG_ENABLE_DEBUG_UART to be enabled */
+#define OPENTHREAD_CONFIG_LOG_OUTPUT_DEBUG_UART 1
+/** Log output goes to the "application" provided otPlatLog() in NCP and CLI code */
+#define OPENTHREAD_CONFIG_LOG_OUTPUT_APP 2
+/** Log output is handled by a platform defined function */
+#define OPENTHREAD_CONFIG_LOG_OUTPUT_PLATFORM_DEFINED 3
+/** Log output for NCP goes to Spinel `STREAM_LOG` property (for CLI platform defined function is expected) */
+#define OPENTHREAD_CONFIG_LOG_OUTPUT_NCP_SPINEL 4
+
+/**
+ * @def OPENTHREAD_CONFIG_LOG_LEVEL
+ *
+ * The log level (used at compile time).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_LOG_LEVEL
+#define OPENTHREAD_CONFIG_LOG_LEVEL OT_LOG_LEVEL_CRIT
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_ENABLE_DYNAMIC_LOG_LEVEL
+ *
+ * Define as 1 to enable dynamic log level control.
+ *
+ * Note that the OPENTHREAD_CONFIG_LOG_LEVEL determines the log level at
+ * compile time. The dynamic log level control (if enabled) only allows
+ * decreasing the log level from the compile time value.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_ENABLE_DYNAMIC_LOG_LEVEL
+#define OPENTHREAD_CONFIG_ENABLE_DYNAMIC_LOG_LEVEL 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_LOG_DEFERRED
+ *
+ * Define as 1 to defer the output of log lines to a tasklet.
+ *
+ * Log lines are formatted by the caller into a fixed-size ring buffer and handed to the platform log function later,
+ * one line per tasklet run. Lines that do not fit in the buffer are dropped and counted.
+ *
+ * Not supported along with multiple OpenThread instances (`OPENTHREAD_ENABLE_MULTIPLE_INSTANCES`).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_LOG_DEFERRED
+#define OPENTHREAD_CONFIG_LOG_DEFERRED 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_LOG_DEFERRED_BUFFER_SIZE
+ *
+ * The size (in bytes) of the ring buffer holding deferred log lines.
+ *
+ * Applicable only if deferred logging is enabled (i.e., `OPENTHREAD_CONFIG_LOG_DEFERRED` is set).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_LOG_DEFERRED_BUFFER_SIZE
+#define OPENTHREAD_CONFIG_LOG_DEFERRED_BUFFER_SIZE 1024
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_LOG_API
+ *
+ * Define to enable OpenThread API logging.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_LOG_API
+#define OPENTHREAD_CONFIG_LOG_API 1
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_LOG_MLE
+ *
+ * Define to enable MLE logging.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_LOG_MLE
+#define OPENTHREAD_CONFIG_LOG_MLE 1
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_LOG_ARP
+ *
+ * Define to enable EID-to-RLOC map logging.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_LOG_ARP
+#define OPENTHREAD_CONFIG_LOG_ARP 1
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_LOG_NETDATA
+ *
+ * Define to enable Network Data logging.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_LOG_NETDATA
+#define OPENTHREAD_CONFIG_LOG_NETDATA 1
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_LOG_ICMP
+ *
+ * Define to enable ICMPv6 logging.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_LOG_ICMP
+#define OPENTHREAD_CONFIG_LOG_ICMP 1
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_LOG_IP6
+ *
+ * Define to enable IPv6 logging.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_LOG_IP6
+#define OPENTHREAD_CONFIG_LOG_IP6 1
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_LOG_MAC
+ *
+ * Define to enable IEEE 802.15.4 MAC logging.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_LOG_MAC
+#define OPENTHREAD_CONFIG_LOG_MAC 1
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_LOG_MEM
+ *
+ * Define to enable memory logging.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_LOG_MEM
+#define OPENTHREAD_CONFIG_LOG_MEM 1
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_LOG_PKT_DUMP
+ *
+ * Define to enable log content of packets.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_LOG_PKT_DUMP
+#define OPENTHREAD_CONFIG_LOG_PKT_DUMP 1
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_LOG_NETDIAG
+ *
+ * Define to enable network diagnostic logging.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_LOG_NETDIAG
+#define OPENTHREAD_CONFIG_LOG_NETDIAG 1
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_LOG_PLATFORM
+ *
+ * Define to enable platform region logging.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_LOG_PLATFORM
+#define OPENTHREAD_CONFIG_LOG_PLATFORM 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_LOG_CLI
+ *
+ * Define to enable CLI logging.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_LOG_CLI
+#define OPENTHREAD_CONFIG_LOG_CLI 1
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_LOG_COAP
+ *
+ * Define to enable COAP logging.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_LOG_COAP
+#define OPENTHREAD_CONFIG_LOG_COAP 1
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_LOG_CORE
+ *
+ * Define to enable OpenThread Core logging.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_LOG_CORE
+#define OPENTHREAD_CONFIG_LOG_CORE 1
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_LOG_UTIL
+ *
+ * Define to enable OpenThread Utility module logging.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_LOG_UTIL
+#define OPENTHREAD_CONFIG_LOG_UTIL 1
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_LOG_PREPEND_LEVEL
+ *
+ * Define to prepend the log level to all log messages
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_LOG_PREPEND_LEVEL
+#define OPENTHREAD_CONFIG_LOG_PREPEND_LEVEL 1
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_LOG_PREPEND_REGION
+ *
+ * Define to prepend the log region to all log messages
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_LOG_PREPEND_REGION
+#define OPENTHREAD_CONFIG_LOG_PREPEND_REGION 1
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_LOG_SUFFIX
+ *
+ * Define suffix to append at the end of logs.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_LOG_SUFFIX
+#define OPENTHREAD_CONFIG_LOG_SUFFIX ""
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_LOG_SRC_DST_IP_ADDRESSES
+ *
+ * If defined as 1 when IPv6 message info is logged in mesh-forwarder, the source and destination IPv6 addresses of
+ * messages are also included.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_LOG_SRC_DST_IP_ADDRESSES
+#define OPENTHREAD_CONFIG_LOG_SRC_DST_IP_ADDRESSES 1
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_PLAT_LOG_FUNCTION
+ *
+ * Defines the name of function/macro used for logging inside OpenThread, by default it is set to `otPlatLog()`.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_PLAT_LOG_FUNCTION
+#define OPENTHREAD_CONFIG_PLAT_LOG_FUNCTION otPlatLog
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_NUM_DHCP_PREFIXES
+ *
+ * The number of dhcp prefixes.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NUM_DHCP_PREFIXES
+#define OPENTHREAD_CONFIG_NUM_DHCP_PREFIXES 4
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_DHCP6_SERVER_NUM_BINDINGS
+ *
+ * The number of client bindings (client DUID to leased prefixes) tracked by the DHCPv6 server.
+ *
+ * Leased addresses are always derived from the prefix and the client's EUI-64, so the table is not needed to answer a
+ * Solicit. It allows the server to tell new leases from repeated ones (e.g. after a border router restart). Set to
+ * zero to disable the table.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_DHCP6_SERVER_NUM_BINDINGS
+#define OPENTHREAD_CONFIG_DHCP6_SERVER_NUM_BINDINGS 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_NUM_SLAAC_ADDRESSES
+ *
+ * The number of auto-configured SLAAC addresses.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NUM_SLAAC_ADDRESSES
+#define OPENTHREAD_CONFIG_NUM_SLAAC_ADDRESSES 4
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_NCP_TX_BUFFER_SIZE
+ *
+ *  The size of NCP message buffer in bytes
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NCP_TX_BUFFER_SIZE
+#define OPENTHREAD_CONFIG_NCP_TX_BUFFER_SIZE 512
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_NCP_TX_BUFFER_MESSAGE_SPILL
+ *
+ * Define to 1 to let the NCP TX frame buffer move frame data that does not fit in the remaining buffer space into a
+ * message allocated from the OpenThread message pool, instead of dropping the frame.
+ *
+ * This allows a smaller `OPENTHREAD_CONFIG_NCP_TX_BUFFER_SIZE`, with bursts of large frames (e.g., raw/pcap frames)
+ * absorbed by the message buffers. Not supported in radio-only builds.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NCP_TX_BUFFER_MESSAGE_SPILL
+#define OPENTHREAD_CONFIG_NCP_TX_BUFFER_MESSAGE_SPILL 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_NCP_TX_BUFFER_SPILL_LOW_PRIORITY_RESERVE
+ *
+ * The number of message buffers that must remain free for a low priority NCP frame to move data into the message
+ * pool (applicable when `OPENTHREAD_CONFIG_NCP_TX_BUFFER_MESSAGE_SPILL` is enabled).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NCP_TX_BUFFER_SPILL_LOW_PRIORITY_RESERVE
+#define OPENTHREAD_CONFIG_NCP_TX_BUFFER_SPILL_LOW_PRIORITY_RESERVE 16
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_NCP_TX_BUFFER_SPILL_HIGH_PRIORITY_RESERVE
+ *
+ * The number of message buffers that must remain free for a high priority NCP frame to move data into the message
+ * pool (applicable when `OPENTHREAD_CONFIG_NCP_TX_BUFFER_MESSAGE_SPILL` is enabled).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NCP_TX_BUFFER_SPILL_HIGH_PRIORITY_RESERVE
+#define OPENTHREAD_CONFIG_NCP_TX_BUFFER_SPILL_HIGH_PRIORITY_RESERVE 4
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_NCP_UART_TX_CHUNK_SIZE
+ *
+ *  The size of NCP UART TX chunk in bytes
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NCP_UART_TX_CHUNK_SIZE
+#define OPENTHREAD_CONFIG_NCP_UART_TX_CHUNK_SIZE 128
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_NCP_UART_RX_BUFFER_SIZE
+ *
+ *  The size of NCP UART RX buffer in bytes
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NCP_UART_RX_BUFFER_SIZE
+#if OPENTHREAD_RADIO
+#define OPENTHREAD_CONFIG_NCP_UART_RX_BUFFER_SIZE 512
+#else
+#define OPENTHREAD_CONFIG_NCP_UART_RX_BUFFER_SIZE 1300
+#endif
+#endif // OPENTHREAD_CONFIG_NCP_UART_RX_BUFFER_SIZE
+
+/**
+ * @def OPENTHREAD_CONFIG_NCP_SPI_BUFFER_SIZE
+ *
+ *  The size of NCP SPI (RX/TX) buffer in bytes
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NCP_SPI_BUFFER_SIZE
+#if OPENTHREAD_RADIO
+#define OPENTHREAD_CONFIG_NCP_SPI_BUFFER_SIZE 512
+#else
+#define OPENTHREAD_CONFIG_NCP_SPI_BUFFER_SIZE 1300
+#endif
+#endif // OPENTHREAD_CONFIG_NCP_SPI_BUFFER_SIZE
+
+/**
+ * @def OPENTHREAD_CONFIG_NCP_SPI_ENABLE_DOUBLE_BUFFER
+ *
+ * Define as 1 to use two NCP SPI TX buffers, so that the next outbound spinel frame is staged while the current SPI
+ * transaction is in progress and is sent in the immediately following transaction.
+ *
+ * This doubles the RAM used for the NCP SPI TX buffer (`OPENTHREAD_CONFIG_NCP_SPI_BUFFER_SIZE`).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NCP_SPI_ENABLE_DOUBLE_BUFFER
+#define OPENTHREAD_CONFIG_NCP_SPI_ENABLE_DOUBLE_BUFFER 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_NCP_SPINEL_ENCRYPTER_EXTRA_DATA_SIZE
+ *
+ *  The size of extra data to be allocated in UART buffer,
+ *  needed by NCP Spinel Encrypter.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NCP_SPINEL_ENCRYPTER_EXTRA_DATA_SIZE
+#define OPENTHREAD_CONFIG_NCP_SPINEL_ENCRYPTER_EXTRA_DATA_SIZE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_NCP_SPINEL_LOG_MAX_SIZE
+ *
+ * The maximum OpenThread log string size (number of chars) supported by NCP using Spinel `StreamWrite`.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NCP_SPINEL_LOG_MAX_SIZE
+#define OPENTHREAD_CONFIG_NCP_SPINEL_LOG_MAX_SIZE 150
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_NCP_ENABLE_TOKENIZED_LOG
+ *
+ * Define as 1 to send OpenThread logs to host in tokenized form via `SPINEL_PROP_STREAM_LOG_TOKENIZED` instead of
+ * formatting them on NCP and sending the text via `SPINEL_PROP_STREAM_LOG`.
+ *
+ * A tokenized log carries a 32-bit hash of the format string followed by the raw argument values. The host resolves
+ * the token using a table generated from the NCP firmware image (see `tools/spinel-log-tokens`).
+ *
+ * Applicable only when `OPENTHREAD_CONFIG_LOG_OUTPUT` is set to `OPENTHREAD_CONFIG_LOG_OUTPUT_NCP_SPINEL`.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NCP_ENABLE_TOKENIZED_LOG
+#define OPENTHREAD_CONFIG_NCP_ENABLE_TOKENIZED_LOG 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_NCP_RAW_STREAM_BATCH_SIZE
+ *
+ * The size (in bytes) of the NCP buffer used to batch captured raw/pcap frames into `SPINEL_PROP_STREAM_RAW_BATCH`
+ * updates. Set to zero to remove support for `SPINEL_PROP_MAC_RAW_STREAM_BATCH_ENABLED`.
+ *
+ * Captured frames are collected in this buffer while the NCP TX buffer is busy and sent to host as a single spinel
+ * frame, so it should be smaller than `OPENTHREAD_CONFIG_NCP_TX_BUFFER_SIZE`.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NCP_RAW_STREAM_BATCH_SIZE
+#define OPENTHREAD_CONFIG_NCP_RAW_STREAM_BATCH_SIZE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_NCP_ENABLE_STREAM_NET_LOWPAN
+ *
+ * Define as 1 to support `SPINEL_PROP_STREAM_NET_LOWPAN`, which carries IPv6 datagrams between host and NCP with
+ * their IPv6/UDP headers compressed using the 6LoWPAN contexts from the Thread network data.
+ *
+ * Compression saves up to ~40 bytes per datagram on the host interface, at the cost of the host tracking the
+ * network data contexts.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NCP_ENABLE_STREAM_NET_LOWPAN
+#define OPENTHREAD_CONFIG_NCP_ENABLE_STREAM_NET_LOWPAN 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_PLATFORM_ASSERT_MANAGEMENT
  *
  * The assert is managed by platform defined logic when this flag is set.
  *
  */
-#ifndef OPENTHREAD_CONFIG_PLATFORM_ASSERT_MANAGEMENT
-#define OPENTHREAD_CONFIG_PLATFORM_ASSERT_MANAGEMENT 0
+#ifndef OPENTHREAD_CONFIG_PLATFORM_ASSERT_MANAGEMENT
+#define OPENTHREAD_CONFIG_PLATFORM_ASSERT_MANAGEMENT 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_ENABLE_SOFTWARE_ACK_TIMEOUT
+ *
+ * Define to 1 if you want to enable software ACK timeout logic.
+ *
+ * Applicable only if raw link layer API is enabled (i.e., `OPENTHREAD_ENABLE_RAW_LINK_API` is set).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_ENABLE_SOFTWARE_ACK_TIMEOUT
+#define OPENTHREAD_CONFIG_ENABLE_SOFTWARE_ACK_TIMEOUT 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_ENABLE_SOFTWARE_RETRANSMIT
+ *
+ * Define to 1 if you want to enable software retransmission logic.
+ *
+ * Applicable only if raw link layer API is enabled (i.e., `OPENTHREAD_ENABLE_RAW_LINK_API` is set).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_ENABLE_SOFTWARE_RETRANSMIT
+#define OPENTHREAD_CONFIG_ENABLE_SOFTWARE_RETRANSMIT 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_ENABLE_SOFTWARE_CSMA_BACKOFF
+ *
+ * Define to 1 if you want to enable software CSMA-CA backoff logic.
+ *
+ * Applicable only if raw link layer API is enabled (i.e., `OPENTHREAD_ENABLE_RAW_LINK_API` is set).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_ENABLE_SOFTWARE_CSMA_BACKOFF
+#define OPENTHREAD_CONFIG_ENABLE_SOFTWARE_CSMA_BACKOFF 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_ENABLE_SOFTWARE_ENERGY_SCAN
+ *
+ * Define to 1 if you want to enable software energy scanning logic.
+ *
+ * Applicable only if raw link layer API is enabled (i.e., `OPENTHREAD_ENABLE_RAW_LINK_API` is set).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_ENABLE_SOFTWARE_ENERGY_SCAN
+#define OPENTHREAD_CONFIG_ENABLE_SOFTWARE_ENERGY_SCAN 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_LINK_RAW_TRANSMIT_BATCH_SIZE
+ *
+ * The maximum number of frames in a batched raw link-layer transmission (`otLinkRawTransmitBatch()`). Set to zero to
+ * remove support for batched transmissions.
+ *
+ * Each frame of a batch needs `OT_RADIO_FRAME_MAX_SIZE` bytes of RAM.
+ *
+ * Applicable only if raw link layer API is enabled (i.e., `OPENTHREAD_ENABLE_RAW_LINK_API` is set).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_LINK_RAW_TRANSMIT_BATCH_SIZE
+#define OPENTHREAD_CONFIG_LINK_RAW_TRANSMIT_BATCH_SIZE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_ENABLE_PLATFORM_USEC_TIMER
+ *
+ * Define to 1 if you want to enable microsecond backoff timer implemented in platform.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_ENABLE_PLATFORM_USEC_TIMER
+#define OPENTHREAD_CONFIG_ENABLE_PLATFORM_USEC_TIMER 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_ENABLE_TIMER_WHEEL
+ *
+ * Define to 1 to use a hashed timer wheel in the timer scheduler instead of a single sorted list.
+ *
+ * With the timer wheel, starting and stopping a timer take constant time (independent of the number of running
+ * timers) at the cost of one extra pointer per timer and `OPENTHREAD_CONFIG_TIMER_WHEEL_NUM_SLOTS` pointers per
+ * scheduler.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_ENABLE_TIMER_WHEEL
+#define OPENTHREAD_CONFIG_ENABLE_TIMER_WHEEL 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_TIMER_WHEEL_NUM_SLOTS
+ *
+ * The number of slots in the timer wheel (MUST be a power of two).
+ *
+ * Applicable only if timer wheel is enabled (`OPENTHREAD_CONFIG_ENABLE_TIMER_WHEEL`).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_TIMER_WHEEL_NUM_SLOTS
+#define OPENTHREAD_CONFIG_TIMER_WHEEL_NUM_SLOTS 32
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_TIMER_WHEEL_SLOT_SHIFT
+ *
+ * The width of a timer wheel slot as a power of two (in alarm ticks, i.e., milliseconds or microseconds).
+ *
+ * The default value of 5 along with 32 slots gives a wheel rotation covering 1024 ticks.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_TIMER_WHEEL_SLOT_SHIFT
+#define OPENTHREAD_CONFIG_TIMER_WHEEL_SLOT_SHIFT 5
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_ENABLE_TIMER_SLACK
+ *
+ * Define to 1 to enable support for timer slack (`TimerMilli::StartWithSlack()`).
+ *
+ * When enabled, the timer scheduler can delay a timer by up to its slack so that it fires along with other nearby
+ * timers, reducing the number of alarm wake-ups (useful for low-power sleepy devices).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_ENABLE_TIMER_SLACK
+#define OPENTHREAD_CONFIG_ENABLE_TIMER_SLACK 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_TASKLETS_PROCESS_BUDGET
+ *
+ * The maximum number of tasklets run by a single call to `otTaskletsProcess()`.
+ *
+ * When the budget is reached, `otTaskletsProcess()` returns early (and signals the remaining tasklets as pending)
+ * allowing the platform to service the radio and other events. Zero indicates no limit.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_TASKLETS_PROCESS_BUDGET
+#define OPENTHREAD_CONFIG_TASKLETS_PROCESS_BUDGET 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_ENABLE_PLATFORM_EUI64_CUSTOM_SOURCE
+ *
+ * Allows to define custom otPlatRadioGetIeeeEui64 function to retrieve EUI-64.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_ENABLE_PLATFORM_EUI64_CUSTOM_SOURCE
+#define OPENTHREAD_CONFIG_ENABLE_PLATFORM_EUI64_CUSTOM_SOURCE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_ENABLE_AUTO_START_SUPPORT
+ *
+ * Define to 1 if you want to enable auto start logic.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_ENABLE_AUTO_START_SUPPORT
+#define OPENTHREAD_CONFIG_ENABLE_AUTO_START_SUPPORT 1
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_ENABLE_BOOT_TIMESTAMPS
+ *
+ * Define to 1 to record the time of each instance start-up phase (settings initialization, restoring network
+ * information, auto start and the first attach), available via `otInstanceGetBootTimestamps()`.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_ENABLE_BOOT_TIMESTAMPS
+#define OPENTHREAD_CONFIG_ENABLE_BOOT_TIMESTAMPS 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_ENABLE_BEACON_RSP_WHEN_JOINABLE
+ *
+ * Define to 1 to enable IEEE 802.15.4 Beacons when joining is enabled.
+ *
+ * @note When this feature is enabled, the device will transmit IEEE 802.15.4 Beacons in response to IEEE 802.15.4
+ * Beacon Requests even while the device is not router capable and detached.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_ENABLE_BEACON_RSP_WHEN_JOINABLE
+#define OPENTHREAD_CONFIG_ENABLE_BEACON_RSP_WHEN_JOINABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_HEAP_SIZE
+ *
+ * The size of heap buffer when DTLS is enabled.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_HEAP_SIZE
+#if OPENTHREAD_ENABLE_APPLICATION_COAP_SECURE
+#define OPENTHREAD_CONFIG_HEAP_SIZE (3072 * sizeof(void *))
+#else
+#define OPENTHREAD_CONFIG_HEAP_SIZE (1536 * sizeof(void *))
+#endif // OPENTHREAD_ENABLE_APPLICATION_COAP_SECURE
+#endif // OPENTHREAD_CONFIG_HEAP_SIZE
+
+/**
+ * @def OPENTHREAD_CONFIG_HEAP_SIZE_NO_DTLS
+ *
+ * The size of heap buffer when DTLS is disabled.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_HEAP_SIZE_NO_DTLS
+#define OPENTHREAD_CONFIG_HEAP_SIZE_NO_DTLS 384
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_HEAP_SEGREGATED_FIT
+ *
+ * Define as 1 to keep heap free blocks in segregated size-class lists instead of a single size-sorted list.
+ *
+ * Small blocks are then allocated and freed in constant time, which suits the many short-lived allocations mbedTLS
+ * makes during a DTLS handshake.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_HEAP_SEGREGATED_FIT
+#define OPENTHREAD_CONFIG_HEAP_SEGREGATED_FIT 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_HEAP_NUM_SMALL_SIZE_CLASSES
+ *
+ * The number of exact-size free lists used for small blocks when `OPENTHREAD_CONFIG_HEAP_SEGREGATED_FIT` is enabled.
+ *
+ * Size classes are `sizeof(long)` bytes apart. Larger blocks share one size-sorted free list.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_HEAP_NUM_SMALL_SIZE_CLASSES
+#define OPENTHREAD_CONFIG_HEAP_NUM_SMALL_SIZE_CLASSES 16
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_DTLS_ARENA_SIZE
+ *
+ * The size (in bytes) of the arena each DTLS session takes from the heap to serve its mbedTLS allocations.
+ *
+ * The arena is released as a whole when the session closes, instead of leaving the heap fragmented by the individual
+ * allocations. Allocations that do not fit in the arena are served by the heap. The arena peak usage is logged when
+ * the session closes. Define as 0 to serve all mbedTLS allocations directly from the heap.
+ *
+ * This setting is ignored when multiple OpenThread instances are enabled.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_DTLS_ARENA_SIZE
+#define OPENTHREAD_CONFIG_DTLS_ARENA_SIZE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_DTLS_APPLICATION_DATA_MAX_LENGTH
+ *
+ * The size of dtls application data when the CoAP Secure API is enabled.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_DTLS_APPLICATION_DATA_MAX_LENGTH
+#define OPENTHREAD_CONFIG_DTLS_APPLICATION_DATA_MAX_LENGTH 1400
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_DTLS_SESSION_CACHE_SIZE
+ *
+ * The number of DTLS sessions a DTLS server (e.g. the Border Agent) remembers for session resumption.
+ *
+ * A client reconnecting with the session ID of a cached session skips the EC-JPAKE key exchange. Sessions are only
+ * cached for EC-JPAKE and the cache is flushed whenever the PSK changes. Set to 0 to disable session resumption.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_DTLS_SESSION_CACHE_SIZE
+#define OPENTHREAD_CONFIG_DTLS_SESSION_CACHE_SIZE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_DTLS_SESSION_CACHE_TIMEOUT
+ *
+ * The time (in seconds) a cached DTLS session can be resumed after it was established.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_DTLS_SESSION_CACHE_TIMEOUT
+#define OPENTHREAD_CONFIG_DTLS_SESSION_CACHE_TIMEOUT 3600
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_ENABLE_STEERING_DATA_SET_OOB
+ *
+ * Enable setting steering data out of band.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_ENABLE_STEERING_DATA_SET_OOB
+#define OPENTHREAD_CONFIG_ENABLE_STEERING_DATA_SET_OOB 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_CCA_FAILURE_RATE_AVERAGING_WINDOW
+ *
+ * OpenThread's MAC implementation maintains the average failure rate of CCA (Clear Channel Assessment) operation on
+ * frame transmissions. This value specifies the window (in terms of number of transmissions or samples) over which the
+ * average rate is maintained. Practically, the average value can be considered as the percentage of CCA failures in
+ * (approximately) last AVERAGING_WINDOW frame transmissions.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_CCA_FAILURE_RATE_AVERAGING_WINDOW
+#define OPENTHREAD_CONFIG_CCA_FAILURE_RATE_AVERAGING_WINDOW 512
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_ENABLE_TX_ERROR_RATE_TRACKING
+ *
+ * Define as 1 to enable transmission error rate tracking (for both MAC frames and IPv6 messages)
+ *
+ * When enabled, OpenThread will track average error rate of MAC frame transmissions and IPv6 message error rate for
+ * every neighbor.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_ENABLE_TX_ERROR_RATE_TRACKING
+#define OPENTHREAD_CONFIG_ENABLE_TX_ERROR_RATE_TRACKING 1
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_FRAME_TX_ERR_RATE_AVERAGING_WINDOW
+ *
+ * Applicable only if error rate tracking is enabled (i.e., `OPENTHREAD_CONFIG_ENABLE_TX_ERROR_RATE_TRACKING` is set).
+ *
+ * OpenThread's MAC implementation maintains the average error rate of MAC frame transmissions per neighbor. This
+ * parameter specifies the window (in terms of number of frames/sample) over which the average error rate is maintained.
+ * Practically, the average value can be considered as the percentage of failed (no ack) MAC frame transmissions  over
+ * (approximately) last AVERAGING_WINDOW frame transmission attempts to a specific neighbor.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_FRAME_TX_ERR_RATE_AVERAGING_WINDOW
+#define OPENTHREAD_CONFIG_FRAME_TX_ERR_RATE_AVERAGING_WINDOW 128
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_IPV6_TX_ERR_RATE_AVERAGING_WINDOW
+ *
+ * Applicable only if error rate tracking is enabled (i.e., `OPENTHREAD_CONFIG_ENABLE_TX_ERROR_RATE_TRACKING` is set).
+ *
+ * OpenThread maintains the average error rate of IPv6 messages per neighbor. This parameter specifies the
+ * window (in terms of number of messages) over which the average error rate is maintained. Practically, the average
+ * value can be considered as the percentage of failed (no ack) messages over (approximately) last AVERAGING_WINDOW
+ * IPv6 messages sent to a specific neighbor.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_IPV6_TX_ERR_RATE_AVERAGING_WINDOW
+#define OPENTHREAD_CONFIG_IPV6_TX_ERR_RATE_AVERAGING_WINDOW 128
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_CHANNEL_MONITOR_SAMPLE_INTERVAL
+ *
+ * The sample interval in milliseconds used by Channel Monitoring feature.
+
+ * When enabled, a zero-duration Energy Scan is performed, collecting a single RSSI sample per channel during each
+ * interval.
+ *
+ * Applicable only if Channel Monitoring feature is enabled (i.e., `OPENTHREAD_ENABLE_CHANNEL_MONITOR` is set).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_CHANNEL_MONITOR_SAMPLE_INTERVAL
+#define OPENTHREAD_CONFIG_CHANNEL_MONITOR_SAMPLE_INTERVAL 41000
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_CHANNEL_MONITOR_RSSI_THRESHOLD
+ *
+ * The RSSI threshold in dBm used by Channel Monitoring feature.
+ *
+ * The RSSI samples are compared with the given threshold. Channel monitoring reports the average rate of RSSI samples
+ * that are above this threshold within an observation window (per channel).
+ *
+ * It is recommended that this value is set to same value as the CCA threshold used by radio.
+ *
+ * Applicable only if Channel Monitoring feature is enabled (i.e., `OPENTHREAD_ENABLE_CHANNEL_MONITOR` is set).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_CHANNEL_MONITOR_RSSI_THRESHOLD
+#define OPENTHREAD_CONFIG_CHANNEL_MONITOR_RSSI_THRESHOLD -75
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_CHANNEL_MONITOR_SAMPLE_WINDOW
+ *
+ * The averaging sample window length (in units of channel sample interval) used by Channel Monitoring feature.
+ *
+ * Channel monitoring will sample all channels every sample interval. It maintains the average rate of RSSI samples
+ * that are above the RSSI threshold within (approximately) this sample window.
+ *
+ * Applicable only if Channel Monitoring feature is enabled (i.e., `OPENTHREAD_ENABLE_CHANNEL_MONITOR` is set).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_CHANNEL_MONITOR_SAMPLE_WINDOW
+#define OPENTHREAD_CONFIG_CHANNEL_MONITOR_SAMPLE_WINDOW 960
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_CHANNEL_MONITOR_SHORT_SAMPLE_WINDOW
+ *
+ * The averaging sample window length (in units of channel sample interval) of the short-term channel occupancy
+ * maintained by Channel Monitoring feature, next to the one over `OPENTHREAD_CONFIG_CHANNEL_MONITOR_SAMPLE_WINDOW`.
+ *
+ * A short-term occupancy well above the long-term one indicates bursty interference. When enabled, the Channel
+ * Manager compares channels using the higher of the two. Define as 0 to disable the short-term occupancy.
+ *
+ * Applicable only if Channel Monitoring feature is enabled (i.e., `OPENTHREAD_ENABLE_CHANNEL_MONITOR` is set).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_CHANNEL_MONITOR_SHORT_SAMPLE_WINDOW
+#define OPENTHREAD_CONFIG_CHANNEL_MONITOR_SHORT_SAMPLE_WINDOW 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_CHANNEL_MONITOR_RSSI_HISTOGRAM
+ *
+ * Define as 1 for Channel Monitoring feature to keep a compact per-channel RSSI histogram, from which the minimum,
+ * maximum, median and 90th percentile RSSI of each channel are provided.
+ *
+ * Applicable only if Channel Monitoring feature is enabled (i.e., `OPENTHREAD_ENABLE_CHANNEL_MONITOR` is set).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_CHANNEL_MONITOR_RSSI_HISTOGRAM
+#define OPENTHREAD_CONFIG_CHANNEL_MONITOR_RSSI_HISTOGRAM 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_CHANNEL_MONITOR_FULL_SCAN_PERIOD
+ *
+ * The period (in units of channel sample interval) at which Channel Monitoring feature samples all channels.
+ *
+ * In the other sample intervals only the candidate channels are sampled, i.e. the current channel and the channels
+ * with the lowest occupancy, which reduces the radio time spent on monitoring. Define as 0 to sample all channels in
+ * every sample interval.
+ *
+ * Applicable only if Channel Monitoring feature is enabled (i.e., `OPENTHREAD_ENABLE_CHANNEL_MONITOR` is set).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_CHANNEL_MONITOR_FULL_SCAN_PERIOD
+#define OPENTHREAD_CONFIG_CHANNEL_MONITOR_FULL_SCAN_PERIOD 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_CHANNEL_MONITOR_START_ON_ATTACH
+ *
+ * Define to 1 to start channel monitoring once the device has attached, instead of when the Thread interface comes
+ * up, so that its energy scans do not compete with the attach process.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_CHANNEL_MONITOR_START_ON_ATTACH
+#define OPENTHREAD_CONFIG_CHANNEL_MONITOR_START_ON_ATTACH 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_CHANNEL_MANAGER_MINIMUM_DELAY
+ *
+ * The minimum delay (in seconds) used by Channel Manager module for performing a channel change.
+ *
+ * The minimum delay should preferably be longer than maximum data poll interval used by all sleepy-end-devices within
+ * the Thread network.
+ *
+ * Applicable only if Channel Manager feature is enabled (i.e., `OPENTHREAD_ENABLE_CHANNEL_MANAGER` is set).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_CHANNEL_MANAGER_MINIMUM_DELAY
+#define OPENTHREAD_CONFIG_CHANNEL_MANAGER_MINIMUM_DELAY 120
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_CHANNEL_MANAGER_MINIMUM_MONITOR_SAMPLE_COUNT
+ *
+ * The minimum number of RSSI samples per channel by Channel Monitoring feature before the collected data can be used
+ * by the Channel Manager module to (auto) select a better channel.
+ *
+ * Applicable only if Channel Manager and Channel Monitoring features are both enabled (i.e.,
+ * `OPENTHREAD_ENABLE_CHANNEL_MANAGER` and `OPENTHREAD_ENABLE_CHANNEL_MONITOR` are set).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_CHANNEL_MANAGER_MINIMUM_MONITOR_SAMPLE_COUNT
+#define OPENTHREAD_CONFIG_CHANNEL_MANAGER_MINIMUM_MONITOR_SAMPLE_COUNT 500
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_CHANNEL_MANAGER_THRESHOLD_TO_SKIP_FAVORED
+ *
+ * This threshold specifies the minimum occupancy rate difference between two channels for the Channel Manager to
+ * prefer an unfavored channel over the best favored one. This is used when (auto) selecting a channel based on the
+ * collected channel quality data by "channel monitor" feature.
+ *
+ * The difference is based on the `ChannelMonitor::GetChannelOccupancy()` definition which provides the average
+ * percentage of RSSI samples (within a time window) indicating that channel was busy (i.e., RSSI value higher than
+ * a threshold). Value 0 maps to 0% and 0xffff maps to 100%.
+ *
+ * Applicable only if Channel Manager feature is enabled (i.e., `OPENTHREAD_ENABLE_CHANNEL_MANAGER` is set).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_CHANNEL_MANAGER_THRESHOLD_TO_SKIP_FAVORED
+#define OPENTHREAD_CONFIG_CHANNEL_MANAGER_THRESHOLD_TO_SKIP_FAVORED (0xffff * 7 / 100)
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_ENABLE_SOFTWARE_ACK_TIMEOUT
+ * @def OPENTHREAD_CONFIG_CHANNEL_MANAGER_THRESHOLD_TO_CHANGE_CHANNEL
  *
- * Define to 1 if you want to enable software ACK timeout logic.
+ * This threshold specifies the minimum occupancy rate difference required between the current channel and a newly
+ * selected channel for Channel Manager to allow channel change to the new channel.
  *
- * Applicable only if raw link layer API is enabled (i.e., `OPENTHREAD_ENABLE_RAW_LINK_API` is set).
+ * The difference is based on the `ChannelMonitor::GetChannelOccupancy()` definition which provides the average
+ * percentage of RSSI samples (within a time window) indicating that channel was busy (i.e., RSSI value higher than
+ * a threshold). Value 0 maps to 0% rate and 0xffff maps to 100%.
+ *
+ * Applicable only if Channel Manager feature is enabled (i.e., `OPENTHREAD_ENABLE_CHANNEL_MANAGER` is set).
  *
  */
-#ifndef OPENTHREAD_CONFIG_ENABLE_SOFTWARE_ACK_TIMEOUT
-#define OPENTHREAD_CONFIG_ENABLE_SOFTWARE_ACK_TIMEOUT 0
+#ifndef OPENTHREAD_CONFIG_CHANNEL_MANAGER_THRESHOLD_TO_CHANGE_CHANNEL
+#define OPENTHREAD_CONFIG_CHANNEL_MANAGER_THRESHOLD_TO_CHANGE_CHANNEL (0xffff * 10 / 100)
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_ENABLE_SOFTWARE_RETRANSMIT
+ * @def OPENTHREAD_CONFIG_CHANNEL_MANAGER_DEFAULT_AUTO_SELECT_INTERVAL
  *
- * Define to 1 if you want to enable software retransmission logic.
+ * The default time interval (in seconds) used by Channel Manager for auto-channel-selection functionality.
  *
- * Applicable only if raw link layer API is enabled (i.e., `OPENTHREAD_ENABLE_RAW_LINK_API` is set).
+ * Applicable only if Channel Manager feature is enabled (i.e., `OPENTHREAD_ENABLE_CHANNEL_MANAGER` is set).
  *
  */
-#ifndef OPENTHREAD_CONFIG_ENABLE_SOFTWARE_RETRANSMIT
-#define OPENTHREAD_CONFIG_ENABLE_SOFTWARE_RETRANSMIT 0
+#ifndef OPENTHREAD_CONFIG_CHANNEL_MANAGER_DEFAULT_AUTO_SELECT_INTERVAL
+#define OPENTHREAD_CONFIG_CHANNEL_MANAGER_DEFAULT_AUTO_SELECT_INTERVAL (3 * 60 * 60)
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_ENABLE_SOFTWARE_CSMA_BACKOFF
+ * @def OPENTHREAD_CONFIG_CHANNEL_MANAGER_CCA_FAILURE_THRESHOLD
  *
- * Define to 1 if you want to enable software CSMA-CA backoff logic.
+ * Minimum CCA failure rate threshold on current channel before Channel Manager starts channel selection attempt.
  *
- * Applicable only if raw link layer API is enabled (i.e., `OPENTHREAD_ENABLE_RAW_LINK_API` is set).
+ * Value 0 maps to 0% and 0xffff maps to 100%.
+ *
+ * Applicable only if Channel Manager feature is enabled (i.e., `OPENTHREAD_ENABLE_CHANNEL_MANAGER` is set).
  *
  */
-#ifndef OPENTHREAD_CONFIG_ENABLE_SOFTWARE_CSMA_BACKOFF
-#define OPENTHREAD_CONFIG_ENABLE_SOFTWARE_CSMA_BACKOFF 0
+#ifndef OPENTHREAD_CONFIG_CHANNEL_MANAGER_CCA_FAILURE_THRESHOLD
+#define OPENTHREAD_CONFIG_CHANNEL_MANAGER_CCA_FAILURE_THRESHOLD (0xffff * 14 / 100)
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_ENABLE_SOFTWARE_ENERGY_SCAN
+ * @def OPENTHREAD_CONFIG_CHANNEL_MANAGER_CONFIRMATION_COUNT
  *
- * Define to 1 if you want to enable software energy scanning logic.
+ * The number of consecutive channel selections (with quality check) that must pick the same better channel before
+ * Channel Manager starts a channel change to it.
  *
- * Applicable only if raw link layer API is enabled (i.e., `OPENTHREAD_ENABLE_RAW_LINK_API` is set).
+ * A value larger than 1 adds hysteresis, so a transient occupancy difference does not trigger a network-wide channel
+ * change. The value 1 changes channel on the first selection.
+ *
+ * Applicable only if Channel Manager feature is enabled (i.e., `OPENTHREAD_ENABLE_CHANNEL_MANAGER` is set).
  *
  */
-#ifndef OPENTHREAD_CONFIG_ENABLE_SOFTWARE_ENERGY_SCAN
-#define OPENTHREAD_CONFIG_ENABLE_SOFTWARE_ENERGY_SCAN 0
+#ifndef OPENTHREAD_CONFIG_CHANNEL_MANAGER_CONFIRMATION_COUNT
+#define OPENTHREAD_CONFIG_CHANNEL_MANAGER_CONFIRMATION_COUNT 1
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_ENABLE_PLATFORM_USEC_TIMER
+ * @def OPENTHREAD_CONFIG_CHANNEL_MANAGER_HISTORY_SLOTS
  *
- * Define to 1 if you want to enable microsecond backoff timer implemented in platform.
+ * The number of time slots per day over which Channel Manager keeps a history of channel occupancy (at most 32).
+ *
+ * While auto-channel-selection is enabled, the occupancy of every channel is recorded at the end of each slot and
+ * averaged with the value of the same slot on previous days. Channels are then compared by their current occupancy
+ * combined with their history for the current slot, so that interference recurring at the same time of day is taken
+ * into account. The history is most useful with `OPENTHREAD_CONFIG_CHANNEL_MONITOR_SHORT_SAMPLE_WINDOW` enabled.
+ * Define as 0 to disable the history.
+ *
+ * Applicable only if Channel Manager and Channel Monitoring features are both enabled (i.e.,
+ * `OPENTHREAD_ENABLE_CHANNEL_MANAGER` and `OPENTHREAD_ENABLE_CHANNEL_MONITOR` are set).
  *
  */
-#ifndef OPENTHREAD_CONFIG_ENABLE_PLATFORM_USEC_TIMER
-#define OPENTHREAD_CONFIG_ENABLE_PLATFORM_USEC_TIMER 0
+#ifndef OPENTHREAD_CONFIG_CHANNEL_MANAGER_HISTORY_SLOTS
+#define OPENTHREAD_CONFIG_CHANNEL_MANAGER_HISTORY_SLOTS 0
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_ENABLE_PLATFORM_EUI64_CUSTOM_SOURCE
+ * @def OPENTHREAD_CONFIG_JAM_DETECTOR_CHANNEL_MONITOR
  *
- * Allows to define custom otPlatRadioGetIeeeEui64 function to retrieve EUI-64.
+ * Define as 1 for Jam Detection to also track the jam state of every channel from the RSSI samples collected by
+ * Channel Monitoring, without any additional sampling.
+ *
+ * A channel is considered jammed when, among its most recent samples, the ratio of samples at or above the jam
+ * detection RSSI threshold is at least the ratio of busy period to window. Channel Manager does not select jammed
+ * channels.
+ *
+ * Applicable only if Jam Detection and Channel Monitoring features are both enabled (i.e.,
+ * `OPENTHREAD_ENABLE_JAM_DETECTION` and `OPENTHREAD_ENABLE_CHANNEL_MONITOR` are set).
  *
  */
-#ifndef OPENTHREAD_CONFIG_ENABLE_PLATFORM_EUI64_CUSTOM_SOURCE
-#define OPENTHREAD_CONFIG_ENABLE_PLATFORM_EUI64_CUSTOM_SOURCE 0
+#ifndef OPENTHREAD_CONFIG_JAM_DETECTOR_CHANNEL_MONITOR
+#define OPENTHREAD_CONFIG_JAM_DETECTOR_CHANNEL_MONITOR 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_CHILD_SUPERVISION_INTERVAL
+ *
+ * The default supervision interval in seconds used by parent. Set to zero to disable the supervision process on the
+ * parent.
+ *
+ * Applicable only if child supervision feature is enabled (i.e., `OPENTHREAD_ENABLE_CHILD_SUPERVISION ` is set).
+ *
+ * Child supervision feature provides a mechanism for parent to ensure that a message is sent to each sleepy child
+ * within the supervision interval. If there is no transmission to the child within the supervision interval, child
+ * supervisor will enqueue and send a supervision message (a data message with empty payload) to the child.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_CHILD_SUPERVISION_INTERVAL
+#define OPENTHREAD_CONFIG_CHILD_SUPERVISION_INTERVAL 129
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_SUPERVISION_CHECK_TIMEOUT
+ *
+ * The default supervision check timeout interval (in seconds) used by a device in child state. Set to zero to disable
+ * the supervision check process on the child.
+ *
+ * Applicable only if child supervision feature is enabled (i.e., `OPENTHREAD_ENABLE_CHILD_SUPERVISION` is set).
+ *
+ * If the sleepy child does not hear from its parent within the specified timeout interval, it initiates the re-attach
+ * process (MLE Child Update Request/Response exchange with its parent).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_SUPERVISION_CHECK_TIMEOUT
+#define OPENTHREAD_CONFIG_SUPERVISION_CHECK_TIMEOUT 190
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_SUPERVISION_MSG_NO_ACK_REQUEST
+ *
+ * Define as 1 to clear/disable 15.4 ack request in the MAC header of a supervision message.
+ *
+ * Applicable only if child supervision feature is enabled (i.e., `OPENTHREAD_ENABLE_CHILD_SUPERVISION` is set).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_SUPERVISION_MSG_NO_ACK_REQUEST
+#define OPENTHREAD_CONFIG_SUPERVISION_MSG_NO_ACK_REQUEST 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_INFORM_PREVIOUS_PARENT_ON_REATTACH
+ *
+ * Define as 1 for a child to inform its previous parent when it attaches to a new parent.
+ *
+ * If this feature is enabled, when a device attaches to a new parent, it will send an IP message (with empty payload
+ * and mesh-local IP address as the source address) to its previous parent.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_INFORM_PREVIOUS_PARENT_ON_REATTACH
+#define OPENTHREAD_CONFIG_INFORM_PREVIOUS_PARENT_ON_REATTACH 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_ENABLE_PERIODIC_PARENT_SEARCH
+ *
+ * Define as 1 to enable periodic parent search feature.
+ *
+ * When this feature is enabled an end-device/child (while staying attached) will periodically search for a possible
+ * better parent and will switch parent if a better one is found.
+ *
+ * The child will periodically check the average RSS value for the current parent, and only if it is below a specific
+ * threshold, a parent search is performed. The `OPENTHREAD_CONFIG_PARENT_SEARCH_CHECK_INTERVAL` specifies the the
+ * check interval (in seconds) and `OPENTHREAD_CONFIG_PARENT_SEARCH_RSS_THRESHOLD` gives the RSS threshold.
+ *
+ * Since the parent search process can be power consuming (child needs to stays in RX mode to collect parent response)
+ * and to limit its impact on battery-powered devices, after a parent search is triggered, the child will not trigger
+ * another one before a specified backoff interval specified by `OPENTHREAD_CONFIG_PARENT_SEARCH_BACKOFF_INTERVAL`
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_ENABLE_PERIODIC_PARENT_SEARCH
+#define OPENTHREAD_CONFIG_ENABLE_PERIODIC_PARENT_SEARCH 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_PARENT_SEARCH_CHECK_INTERVAL
+ *
+ * Specifies the interval in seconds for a child to check the trigger condition to perform a parent search.
+ *
+ * Applicable only if periodic parent search feature is enabled (see `OPENTHREAD_CONFIG_ENABLE_PERIODIC_PARENT_SEARCH`).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_PARENT_SEARCH_CHECK_INTERVAL
+#define OPENTHREAD_CONFIG_PARENT_SEARCH_CHECK_INTERVAL (9 * 60)
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_PARENT_SEARCH_BACKOFF_INTERVAL
+ *
+ * Specifies the backoff interval in seconds for a child to not perform a parent search after triggering one.
+ *
+ * Applicable only if periodic parent search feature is enabled (see `OPENTHREAD_CONFIG_ENABLE_PERIODIC_PARENT_SEARCH`).
+ *
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_PARENT_SEARCH_BACKOFF_INTERVAL
+#define OPENTHREAD_CONFIG_PARENT_SEARCH_BACKOFF_INTERVAL (10 * 60 * 60)
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_PARENT_SEARCH_RSS_THRESHOLD
+ *
+ * Specifies the RSS threshold used to trigger a parent search.
+ *
+ * Applicable only if periodic parent search feature is enabled (see `OPENTHREAD_CONFIG_ENABLE_PERIODIC_PARENT_SEARCH`).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_PARENT_SEARCH_RSS_THRESHOLD
+#define OPENTHREAD_CONFIG_PARENT_SEARCH_RSS_THRESHOLD -65
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_ENABLE_ATTACH_BACKOFF
+ *
+ * Define as 1 to enable attach backoff feature
+ *
+ * When this feature is enabled, an exponentially increasing backoff wait time is added between attach attempts.
+ * If device is sleepy, the radio will be put to sleep during the wait time. This ensures that a battery-powered sleepy
+ * end-device does not drain its battery by continuously searching for a parent to attach to (when there is no
+ * router/parent for it to attach).
+ *
+ * The backoff time starts from a minimum interval specified by `OPENTHREAD_CONFIG_ATTACH_BACKOFF_MINIMUM_INTERVAL`,
+ * and every attach attempt the wait time is doubled up to `OPENTHREAD_CONFIG_ATTACH_BACKOFF_MAXIMUM_INTERVAL` which
+ * specifies the maximum wait time.
+ *
+ * Once the wait time reaches the maximum, a random jitter interval is added to it. The maximum value for jitter is
+ * specified by `OPENTHREAD_CONFIG_ATTACH_BACKOFF_JITTER_INTERVAL`. The random jitter is selected uniformly within
+ * range `[-JITTER, +JITTER]`. It is only added when the backoff wait interval is at maximum value.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_ENABLE_ATTACH_BACKOFF
+#define OPENTHREAD_CONFIG_ENABLE_ATTACH_BACKOFF 1
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_ATTACH_BACKOFF_MINIMUM_INTERVAL
+ *
+ * Specifies the minimum backoff wait interval (in milliseconds) used by attach backoff feature.
+ *
+ * Applicable only if attach backoff feature is enabled (see `OPENTHREAD_CONFIG_ENABLE_ATTACH_BACKOFF`).
+ *
+ * Please see `OPENTHREAD_CONFIG_ENABLE_ATTACH_BACKOFF` description for more details.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_ATTACH_BACKOFF_MINIMUM_INTERVAL
+#define OPENTHREAD_CONFIG_ATTACH_BACKOFF_MINIMUM_INTERVAL 251
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_ATTACH_BACKOFF_MAXIMUM_INTERVAL
+ *
+ * Specifies the maximum backoff wait interval (in milliseconds) used by attach backoff feature.
+ *
+ * Applicable only if attach backoff feature is enabled (see `OPENTHREAD_CONFIG_ENABLE_ATTACH_BACKOFF`).
+ *
+ * Please see `OPENTHREAD_CONFIG_ENABLE_ATTACH_BACKOFF` description for more details.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_ATTACH_BACKOFF_MAXIMUM_INTERVAL
+#define OPENTHREAD_CONFIG_ATTACH_BACKOFF_MAXIMUM_INTERVAL 1200000 // 1200 seconds = 20 minutes
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_ATTACH_BACKOFF_JITTER_INTERVAL
+ *
+ * Specifies the maximum jitter interval (in milliseconds) used by attach backoff feature.
+ *
+ * Applicable only if attach backoff feature is enabled (see `OPENTHREAD_CONFIG_ENABLE_ATTACH_BACKOFF`).
+ *
+ * Please see `OPENTHREAD_CONFIG_ENABLE_ATTACH_BACKOFF` description for more details.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_ATTACH_BACKOFF_JITTER_INTERVAL
+#define OPENTHREAD_CONFIG_ATTACH_BACKOFF_JITTER_INTERVAL 2000
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_ENABLE_AUTO_START_SUPPORT
+ * @def OPENTHREAD_CONFIG_SEND_UNICAST_ANNOUNCE_RESPONSE
  *
- * Define to 1 if you want to enable auto start logic.
+ * Define as 1 to enable sending of a unicast MLE Announce message in response to a received Announce message from
+ * a device.
+ *
+ * @note The unicast MLE announce message is sent in addition to (and after) the multicast MLE Announce.
  *
  */
-#ifndef OPENTHREAD_CONFIG_ENABLE_AUTO_START_SUPPORT
-#define OPENTHREAD_CONFIG_ENABLE_AUTO_START_SUPPORT 1
+#ifndef OPENTHREAD_CONFIG_SEND_UNICAST_ANNOUNCE_RESPONSE
+#define OPENTHREAD_CONFIG_SEND_UNICAST_ANNOUNCE_RESPONSE 1
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_ENABLE_BEACON_RSP_WHEN_JOINABLE
+ * @def OPENTHREAD_CONFIG_ENABLE_ANNOUNCE_SENDER
  *
- * Define to 1 to enable IEEE 802.15.4 Beacons when joining is enabled.
+ * Define as 1 to enable `AnnounceSender` which will periodically send MLE Announce message on all channels.
  *
- * @note When this feature is enabled, the device will transmit IEEE 802.15.4 Beacons in response to IEEE 802.15.4
- * Beacon Requests even while the device is not router capable and detached.
+ * The list of channels is determined from the Operational Dataset's ChannelMask. The period intervals are determined
+ * by `OPENTHREAD_CONFIG_ANNOUNCE_SENDER_INTERVAL_ROUTER` and `OPENTHREAD_CONFIG_ANNOUNCE_SENDER_INTERVAL_REED`
+ * configuration options.
  *
  */
-#ifndef OPENTHREAD_CONFIG_ENABLE_BEACON_RSP_WHEN_JOINABLE
-#define OPENTHREAD_CONFIG_ENABLE_BEACON_RSP_WHEN_JOINABLE 0
+#ifndef OPENTHREAD_CONFIG_ENABLE_ANNOUNCE_SENDER
+#define OPENTHREAD_CONFIG_ENABLE_ANNOUNCE_SENDER 0
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_HEAP_SIZE
+ * @def OPENTHREAD_CONFIG_ANNOUNCE_SENDER_INTERVAL_ROUTER
  *
- * The size of heap buffer when DTLS is enabled.
+ * Specifies the time interval (in milliseconds) between `AnnounceSender` transmit cycles on a device in Router role.
  *
- */
-#ifndef OPENTHREAD_CONFIG_HEAP_SIZE
-#if OPENTHREAD_ENABLE_APPLICATION_COAP_SECURE
-#define OPENTHREAD_CONFIG_HEAP_SIZE (3072 * sizeof(void *))
-#else
-#define OPENTHREAD_CONFIG_HEAP_SIZE (1536 * sizeof(void *))
-#endif // OPENTHREAD_ENABLE_APPLICATION_COAP_SECURE
-#endif // OPENTHREAD_CONFIG_HEAP_SIZE
-
-/**
- * @def OPENTHREAD_CONFIG_HEAP_SIZE_NO_DTLS
+ * In a cycle, the `AnnounceSender` sends MLE Announcement on all channels in Active Operational Dataset's ChannelMask.
+ * The transmissions on different channels happen uniformly over the given interval (i.e., if there are 16 channels,
+ * there will be 16 MLE Announcement messages each on one channel with `interval / 16`  between two consecutive MLE
+ * Announcement transmissions).
  *
- * The size of heap buffer when DTLS is disabled.
+ * Applicable only if `AnnounceSender` feature is enabled (see `OPENTHREAD_CONFIG_ENABLE_ANNOUNCE_SENDER`).
  *
  */
-#ifndef OPENTHREAD_CONFIG_HEAP_SIZE_NO_DTLS
-#define OPENTHREAD_CONFIG_HEAP_SIZE_NO_DTLS 384
+#ifndef OPENTHREAD_CONFIG_ANNOUNCE_SENDER_INTERVAL_ROUTER
+#define OPENTHREAD_CONFIG_ANNOUNCE_SENDER_INTERVAL_ROUTER 688000 // 668 seconds = 11 min and 28 sec.
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_DTLS_APPLICATION_DATA_MAX_LENGTH
+ * @def OPENTHREAD_CONFIG_ANNOUNCE_SENDER_INTERVAL_REED
  *
- * The size of dtls application data when the CoAP Secure API is enabled.
+ * Specifies the time interval (in milliseconds) between `AnnounceSender` transmit cycles on a device in REED role.
+ *
+ * This is similar to `OPENTHREAD_CONFIG_ANNOUNCE_SENDER_INTERVAL_ROUTER` but used when device is in REED role.
+ *
+ * Applicable only if `AnnounceSender` feature is enabled (see `OPENTHREAD_CONFIG_ENABLE_ANNOUNCE_SENDER`).
  *
  */
-#ifndef OPENTHREAD_CONFIG_DTLS_APPLICATION_DATA_MAX_LENGTH
-#define OPENTHREAD_CONFIG_DTLS_APPLICATION_DATA_MAX_LENGTH 1400
+#ifndef OPENTHREAD_CONFIG_ANNOUNCE_SENDER_INTERVAL_REED
+#define OPENTHREAD_CONFIG_ANNOUNCE_SENDER_INTERVAL_REED (668000 * 3)
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_ENABLE_STEERING_DATA_SET_OOB
+ * @def OPENTHREAD_CONFIG_NCP_ENABLE_PEEK_POKE
  *
- * Enable setting steering data out of band.
+ * Define as 1 to enable peek/poke functionality on NCP.
+ *
+ * Peek/Poke allows the host to read/write to memory addresses on NCP. This is intended for debugging.
  *
  */
-#ifndef OPENTHREAD_CONFIG_ENABLE_STEERING_DATA_SET_OOB
-#define OPENTHREAD_CONFIG_ENABLE_STEERING_DATA_SET_OOB 0
+#ifndef OPENTHREAD_CONFIG_NCP_ENABLE_PEEK_POKE
+#define OPENTHREAD_CONFIG_NCP_ENABLE_PEEK_POKE 0
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_CCA_FAILURE_RATE_AVERAGING_WINDOW
+ * @def OPENTHREAD_CONFIG_NCP_SPINEL_RESPONSE_QUEUE_SIZE
  *
- * OpenThread's MAC implementation maintains the average failure rate of CCA (Clear Channel Assessment) operation on
- * frame transmissions. This value specifies the window (in terms of number of transmissions or samples) over which the
- * average rate is maintained. Practically, the average value can be considered as the percentage of CCA failures in
- * (approximately) last AVERAGING_WINDOW frame transmissions.
+ * Size of NCP Spinel command response queue.
+ *
+ * NCP guarantees that it can respond up to `OPENTHREAD_CONFIG_NCP_SPINEL_RESPONSE_QUEUE_SIZE` spinel commands at the
+ * same time. The spinel protocol defines a Transaction ID (TID) as part of spinel command frame (the TID can be
+ * a value 0-15 where TID 0 is used for frames which require no response). Spinel protocol can support at most support
+ * 15 simultaneous commands.
+ *
+ * The host driver implementation may further limit the number of simultaneous Spinel command frames (e.g., wpantund
+ * limits this to two). This configuration option can be used to reduce the response queue size.
  *
  */
-#ifndef OPENTHREAD_CONFIG_CCA_FAILURE_RATE_AVERAGING_WINDOW
-#define OPENTHREAD_CONFIG_CCA_FAILURE_RATE_AVERAGING_WINDOW 512
+#ifndef OPENTHREAD_CONFIG_NCP_SPINEL_RESPONSE_QUEUE_SIZE
+#define OPENTHREAD_CONFIG_NCP_SPINEL_RESPONSE_QUEUE_SIZE 15
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_ENABLE_TX_ERROR_RATE_TRACKING
+ * @def OPENTHREAD_CONFIG_NCP_ENABLE_MCU_POWER_STATE_CONTROL
  *
- * Define as 1 to enable transmission error rate tracking (for both MAC frames and IPv6 messages)
+ * Define to 1 to enable support controlling of desired power state of NCP's micro-controller.
  *
- * When enabled, OpenThread will track average error rate of MAC frame transmissions and IPv6 message error rate for
- * every neighbor.
+ * The power state specifies the desired power state of NCP's micro-controller (MCU) when the underlying platform's
+ * operating system enters idle mode (i.e., all active tasks/events are processed and the MCU can potentially enter a
+ * energy-saving power state).
+ *
+ * The power state primarily determines how the host should interact with the NCP and whether the host needs an
+ * external trigger (a "poke") before it can communicate with the NCP or not.
+ *
+ * When enabled, the platform is expected to provide `otPlatSetMcuPowerState()` and `otPlatGetMcuPowerState()`
+ * functions (please see `openthread/platform/misc.h`). Host can then control the power state using
+ * `SPINEL_PROP_MCU_POWER_STATE`.
  *
  */
-#ifndef OPENTHREAD_CONFIG_ENABLE_TX_ERROR_RATE_TRACKING
-#define OPENTHREAD_CONFIG_ENABLE_TX_ERROR_RATE_TRACKING 1
+#ifndef OPENTHREAD_CONFIG_NCP_ENABLE_MCU_POWER_STATE_CONTROL
+#define OPENTHREAD_CONFIG_NCP_ENABLE_MCU_POWER_STATE_CONTROL 0
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_FRAME_TX_ERR_RATE_AVERAGING_WINDOW
+ * @def OPENTHREAD_CONFIG_NCP_CHANGED_PROPS_MIN_INTERVAL
  *
- * Applicable only if error rate tracking is enabled (i.e., `OPENTHREAD_CONFIG_ENABLE_TX_ERROR_RATE_TRACKING` is set).
+ * Minimum interval (in milliseconds) between two unsolicited updates of the same rate-limited NCP property.
  *
- * OpenThread's MAC implementation maintains the average error rate of MAC frame transmissions per neighbor. This
- * parameter specifies the window (in terms of number of frames/sample) over which the average error rate is maintained.
- * Practically, the average value can be considered as the percentage of failed (no ack) MAC frame transmissions  over
- * (approximately) last AVERAGING_WINDOW frame transmission attempts to a specific neighbor.
+ * Rate-limited properties (e.g., child table, on-mesh prefixes, IPv6 address table) that change again within this
+ * interval after an update was sent are held back and coalesced, so the host receives a single update carrying the
+ * latest value once the interval has elapsed. The actual hold-off is between one and two times this interval.
+ *
+ * Define as 0 to disable rate-limiting and send every update as soon as possible.
  *
  */
-#ifndef OPENTHREAD_CONFIG_FRAME_TX_ERR_RATE_AVERAGING_WINDOW
-#define OPENTHREAD_CONFIG_FRAME_TX_ERR_RATE_AVERAGING_WINDOW 128
+#ifndef OPENTHREAD_CONFIG_NCP_CHANGED_PROPS_MIN_INTERVAL
+#define OPENTHREAD_CONFIG_NCP_CHANGED_PROPS_MIN_INTERVAL 0
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_IPV6_TX_ERR_RATE_AVERAGING_WINDOW
+ * @def OPENTHREAD_CONFIG_NCP_TX_CREDITS_POLL_INTERVAL
  *
- * Applicable only if error rate tracking is enabled (i.e., `OPENTHREAD_CONFIG_ENABLE_TX_ERROR_RATE_TRACKING` is set).
+ * Interval (in milliseconds) at which NCP re-evaluates the IPv6 transmit credits advertised to the host through
+ * `SPINEL_PROP_STREAM_NET_TX_CREDITS`.
  *
- * OpenThread maintains the average error rate of IPv6 messages per neighbor. This parameter specifies the
- * window (in terms of number of messages) over which the average error rate is maintained. Practically, the average
- * value can be considered as the percentage of failed (no ack) messages over (approximately) last AVERAGING_WINDOW
- * IPv6 messages sent to a specific neighbor.
+ * Message buffer releases are not signaled to NCP, so after the host writes IPv6 datagrams NCP polls the free buffer
+ * count at this interval until the credits stop changing.
  *
  */
-#ifndef OPENTHREAD_CONFIG_IPV6_TX_ERR_RATE_AVERAGING_WINDOW
-#define OPENTHREAD_CONFIG_IPV6_TX_ERR_RATE_AVERAGING_WINDOW 128
+#ifndef OPENTHREAD_CONFIG_NCP_TX_CREDITS_POLL_INTERVAL
+#define OPENTHREAD_CONFIG_NCP_TX_CREDITS_POLL_INTERVAL 100
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_CHANNEL_MONITOR_SAMPLE_INTERVAL
+ * @def OPENTHREAD_CONFIG_NCP_BUFFER_COUNTERS_STREAM_INTERVAL
  *
- * The sample interval in milliseconds used by Channel Monitoring feature.
-
- * When enabled, a zero-duration Energy Scan is performed, collecting a single RSSI sample per channel during each
- * interval.
+ * Interval (in milliseconds) at which NCP samples the message buffer and queue counters and pushes them to the host
+ * as unsolicited `SPINEL_PROP_MSG_BUFFER_COUNTERS` updates (see `OPENTHREAD_CONFIG_NCP_BUFFER_COUNTERS_LOW_THRESHOLD`
+ * for pushing only when low on buffers). The host can stop the updates through `SPINEL_PROP_UNSOL_UPDATE_FILTER`.
  *
- * Applicable only if Channel Monitoring feature is enabled (i.e., `OPENTHREAD_ENABLE_CHANNEL_MONITOR` is set).
+ * Define as 0 to disable the unsolicited updates (the host can still poll the property).
  *
  */
-#ifndef OPENTHREAD_CONFIG_CHANNEL_MONITOR_SAMPLE_INTERVAL
-#define OPENTHREAD_CONFIG_CHANNEL_MONITOR_SAMPLE_INTERVAL 41000
+#ifndef OPENTHREAD_CONFIG_NCP_BUFFER_COUNTERS_STREAM_INTERVAL
+#define OPENTHREAD_CONFIG_NCP_BUFFER_COUNTERS_STREAM_INTERVAL 0
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_CHANNEL_MONITOR_RSSI_THRESHOLD
- *
- * The RSSI threshold in dBm used by Channel Monitoring feature.
- *
- * The RSSI samples are compared with the given threshold. Channel monitoring reports the average rate of RSSI samples
- * that are above this threshold within an observation window (per channel).
+ * @def OPENTHREAD_CONFIG_NCP_BUFFER_COUNTERS_LOW_THRESHOLD
  *
- * It is recommended that this value is set to same value as the CCA threshold used by radio.
+ * Number of free message buffers at or below which sampled buffer counters are pushed to the host.
  *
- * Applicable only if Channel Monitoring feature is enabled (i.e., `OPENTHREAD_ENABLE_CHANNEL_MONITOR` is set).
+ * When non-zero, only the samples taken while free buffers are at or below this threshold, and the first sample after
+ * recovering above it, are pushed. Define as 0 to push every sample (periodic updates).
  *
  */
-#ifndef OPENTHREAD_CONFIG_CHANNEL_MONITOR_RSSI_THRESHOLD
-#define OPENTHREAD_CONFIG_CHANNEL_MONITOR_RSSI_THRESHOLD -75
+#ifndef OPENTHREAD_CONFIG_NCP_BUFFER_COUNTERS_LOW_THRESHOLD
+#define OPENTHREAD_CONFIG_NCP_BUFFER_COUNTERS_LOW_THRESHOLD 0
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_CHANNEL_MONITOR_SAMPLE_WINDOW
+ * @def OPENTHREAD_CONFIG_STAY_AWAKE_BETWEEN_FRAGMENTS
  *
- * The averaging sample window length (in units of channel sample interval) used by Channel Monitoring feature.
+ * Define as 1 to stay awake between fragments while transmitting a large packet,
+ * and to stay awake after receiving a packet with frame pending set to true.
  *
- * Channel monitoring will sample all channels every sample interval. It maintains the average rate of RSSI samples
- * that are above the RSSI threshold within (approximately) this sample window.
+ */
+#ifndef OPENTHREAD_CONFIG_STAY_AWAKE_BETWEEN_FRAGMENTS
+#define OPENTHREAD_CONFIG_STAY_AWAKE_BETWEEN_FRAGMENTS 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MLE_SEND_LINK_REQUEST_ON_ADV_TIMEOUT
  *
- * Applicable only if Channel Monitoring feature is enabled (i.e., `OPENTHREAD_ENABLE_CHANNEL_MONITOR` is set).
+ * Define to 1 to send an MLE Link Request when MAX_NEIGHBOR_AGE is reached for a neighboring router.
  *
  */
-#ifndef OPENTHREAD_CONFIG_CHANNEL_MONITOR_SAMPLE_WINDOW
-#define OPENTHREAD_CONFIG_CHANNEL_MONITOR_SAMPLE_WINDOW 960
+#ifndef OPENTHREAD_CONFIG_MLE_SEND_LINK_REQUEST_ON_ADV_TIMEOUT
+#define OPENTHREAD_CONFIG_MLE_SEND_LINK_REQUEST_ON_ADV_TIMEOUT 0
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_CHANNEL_MANAGER_MINIMUM_DELAY
+ * @def OPENTHREAD_CONFIG_MLE_LINK_REQUEST_MARGIN_MIN
  *
- * The minimum delay (in seconds) used by Channel Manager module for performing a channel change.
+ * Specifies the minimum link margin in dBm required before attempting to establish a link with a neighboring router.
  *
- * The minimum delay should preferably be longer than maximum data poll interval used by all sleepy-end-devices within
- * the Thread network.
+ */
+#ifndef OPENTHREAD_CONFIG_MLE_LINK_REQUEST_MARGIN_MIN
+#define OPENTHREAD_CONFIG_MLE_LINK_REQUEST_MARGIN_MIN 10
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MLE_PARTITION_MERGE_MARGIN_MIN
  *
- * Applicable only if Channel Manager feature is enabled (i.e., `OPENTHREAD_ENABLE_CHANNEL_MANAGER` is set).
+ * Specifies the minimum link margin in dBm required before attempting to merge to a different partition.
  *
  */
-#ifndef OPENTHREAD_CONFIG_CHANNEL_MANAGER_MINIMUM_DELAY
-#define OPENTHREAD_CONFIG_CHANNEL_MANAGER_MINIMUM_DELAY 120
+#ifndef OPENTHREAD_CONFIG_MLE_PARTITION_MERGE_MARGIN_MIN
+#define OPENTHREAD_CONFIG_MLE_PARTITION_MERGE_MARGIN_MIN 10
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_CHANNEL_MANAGER_MINIMUM_MONITOR_SAMPLE_COUNT
+ * @def OPENTHREAD_CONFIG_MLE_FAST_PARTITION_MERGE
  *
- * The minimum number of RSSI samples per channel by Channel Monitoring feature before the collected data can be used
- * by the Channel Manager module to (auto) select a better channel.
+ * Define as 1 for a router which attaches to a better partition to request its previous Router ID from the new leader
+ * right away, even when it has no children.
  *
- * Applicable only if Channel Manager and Channel Monitoring features are both enabled (i.e.,
- * `OPENTHREAD_ENABLE_CHANNEL_MANAGER` and `OPENTHREAD_ENABLE_CHANNEL_MONITOR` are set).
+ * The router then keeps its role across the merge and advertises the new partition immediately, so its neighboring
+ * routers in the losing partition merge in parallel instead of one by one after timing out their leader.
  *
  */
-#ifndef OPENTHREAD_CONFIG_CHANNEL_MANAGER_MINIMUM_MONITOR_SAMPLE_COUNT
-#define OPENTHREAD_CONFIG_CHANNEL_MANAGER_MINIMUM_MONITOR_SAMPLE_COUNT 500
+#ifndef OPENTHREAD_CONFIG_MLE_FAST_PARTITION_MERGE
+#define OPENTHREAD_CONFIG_MLE_FAST_PARTITION_MERGE 0
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_CHANNEL_MANAGER_THRESHOLD_TO_SKIP_FAVORED
- *
- * This threshold specifies the minimum occupancy rate difference between two channels for the Channel Manager to
- * prefer an unfavored channel over the best favored one. This is used when (auto) selecting a channel based on the
- * collected channel quality data by "channel monitor" feature.
+ * @def OPENTHREAD_CONFIG_MLE_ADVERTISE_SUPPRESSION
  *
- * The difference is based on the `ChannelMonitor::GetChannelOccupancy()` definition which provides the average
- * percentage of RSSI samples (within a time window) indicating that channel was busy (i.e., RSSI value higher than
- * a threshold). Value 0 maps to 0% and 0xffff maps to 100%.
+ * Define as 1 to let a router skip an MLE Advertisement when routes have been stable and enough of its neighbor
+ * routers have already advertised unchanged routes in the current trickle interval.
  *
- * Applicable only if Channel Manager feature is enabled (i.e., `OPENTHREAD_ENABLE_CHANNEL_MANAGER` is set).
+ * The trickle redundancy constant grows with the number of neighbor routers (half of them), so the suppression only
+ * kicks in for dense router sets. A router never skips two advertisements in a row, which keeps its links to the
+ * neighbor routers alive. The leader never skips advertisements.
  *
  */
-#ifndef OPENTHREAD_CONFIG_CHANNEL_MANAGER_THRESHOLD_TO_SKIP_FAVORED
-#define OPENTHREAD_CONFIG_CHANNEL_MANAGER_THRESHOLD_TO_SKIP_FAVORED (0xffff * 7 / 100)
+#ifndef OPENTHREAD_CONFIG_MLE_ADVERTISE_SUPPRESSION
+#define OPENTHREAD_CONFIG_MLE_ADVERTISE_SUPPRESSION 0
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_CHANNEL_MANAGER_THRESHOLD_TO_CHANGE_CHANNEL
- *
- * This threshold specifies the minimum occupancy rate difference required between the current channel and a newly
- * selected channel for Channel Manager to allow channel change to the new channel.
- *
- * The difference is based on the `ChannelMonitor::GetChannelOccupancy()` definition which provides the average
- * percentage of RSSI samples (within a time window) indicating that channel was busy (i.e., RSSI value higher than
- * a threshold). Value 0 maps to 0% rate and 0xffff maps to 100%.
+ * @def OPENTHREAD_CONFIG_MLE_ADVERTISE_SUPPRESSION_MIN_NEIGHBORS
  *
- * Applicable only if Channel Manager feature is enabled (i.e., `OPENTHREAD_ENABLE_CHANNEL_MANAGER` is set).
+ * The minimum number of neighbor routers for a router to skip MLE Advertisements (applicable when
+ * `OPENTHREAD_CONFIG_MLE_ADVERTISE_SUPPRESSION` is enabled).
  *
  */
-#ifndef OPENTHREAD_CONFIG_CHANNEL_MANAGER_THRESHOLD_TO_CHANGE_CHANNEL
-#define OPENTHREAD_CONFIG_CHANNEL_MANAGER_THRESHOLD_TO_CHANGE_CHANNEL (0xffff * 10 / 100)
+#ifndef OPENTHREAD_CONFIG_MLE_ADVERTISE_SUPPRESSION_MIN_NEIGHBORS
+#define OPENTHREAD_CONFIG_MLE_ADVERTISE_SUPPRESSION_MIN_NEIGHBORS 6
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_CHANNEL_MANAGER_DEFAULT_AUTO_SELECT_INTERVAL
+ * @def OPENTHREAD_CONFIG_MLE_ROUTER_SELECTION_RANKED
  *
- * The default time interval (in seconds) used by Channel Manager for auto-channel-selection functionality.
+ * Define as 1 to derive the router selection jitter from the neighbor routers instead of a random value only.
  *
- * Applicable only if Channel Manager feature is enabled (i.e., `OPENTHREAD_ENABLE_CHANNEL_MANAGER` is set).
+ * Each valid neighbor router adds its two-way link quality to a rank. A REED with a low rank (few or poor router
+ * links, where it extends coverage most) upgrades first, while a router with a high rank (many good router links,
+ * where it is most redundant) downgrades first. The jitter window is split in slots by rank with a random offset
+ * within the slot. A REED whose rank grew while waiting (e.g., a nearby REED has upgraded) backs off further before
+ * upgrading.
  *
  */
-#ifndef OPENTHREAD_CONFIG_CHANNEL_MANAGER_DEFAULT_AUTO_SELECT_INTERVAL
-#define OPENTHREAD_CONFIG_CHANNEL_MANAGER_DEFAULT_AUTO_SELECT_INTERVAL (3 * 60 * 60)
+#ifndef OPENTHREAD_CONFIG_MLE_ROUTER_SELECTION_RANKED
+#define OPENTHREAD_CONFIG_MLE_ROUTER_SELECTION_RANKED 0
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_CHANNEL_MANAGER_CCA_FAILURE_THRESHOLD
+ * @def OPENTHREAD_CONFIG_MLE_CHILD_STORE_DELAY
  *
- * Minimum CCA failure rate threshold on current channel before Channel Manager starts channel selection attempt.
+ * Specifies the delay (in milliseconds) a router waits before writing child table changes to non-volatile memory.
  *
- * Value 0 maps to 0% and 0xffff maps to 100%.
+ * When non-zero, storing or removing a child only marks the stored child information as stale. Once the delay
+ * expires, the stored entries are compared with the child table and only the entries that differ are deleted or
+ * added, so a burst of child attaches results in a single batch of flash writes.
  *
- * Applicable only if Channel Manager feature is enabled (i.e., `OPENTHREAD_ENABLE_CHANNEL_MANAGER` is set).
+ * Define to 0 to write every change to non-volatile memory immediately.
  *
  */
-#ifndef OPENTHREAD_CONFIG_CHANNEL_MANAGER_CCA_FAILURE_THRESHOLD
-#define OPENTHREAD_CONFIG_CHANNEL_MANAGER_CCA_FAILURE_THRESHOLD (0xffff * 14 / 100)
+#ifndef OPENTHREAD_CONFIG_MLE_CHILD_STORE_DELAY
+#define OPENTHREAD_CONFIG_MLE_CHILD_STORE_DELAY 0
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_CHILD_SUPERVISION_INTERVAL
- *
- * The default supervision interval in seconds used by parent. Set to zero to disable the supervision process on the
- * parent.
+ * @def OPENTHREAD_CONFIG_MLE_MAX_CONCURRENT_CHILD_ATTACHES
  *
- * Applicable only if child supervision feature is enabled (i.e., `OPENTHREAD_ENABLE_CHILD_SUPERVISION ` is set).
+ * Specifies the maximum number of new children a router attaches at the same time, counting children it has sent a
+ * Parent Response to or is answering a Child ID Request from. Parent Requests from further unknown devices are
+ * ignored until one of these attaches completes or times out. Children already in the child table, including ones
+ * restored from non-volatile memory, are not limited.
  *
- * Child supervision feature provides a mechanism for parent to ensure that a message is sent to each sleepy child
- * within the supervision interval. If there is no transmission to the child within the supervision interval, child
- * supervisor will enqueue and send a supervision message (a data message with empty payload) to the child.
+ * Define to 0 to disable the limit.
  *
  */
-#ifndef OPENTHREAD_CONFIG_CHILD_SUPERVISION_INTERVAL
-#define OPENTHREAD_CONFIG_CHILD_SUPERVISION_INTERVAL 129
+#ifndef OPENTHREAD_CONFIG_MLE_MAX_CONCURRENT_CHILD_ATTACHES
+#define OPENTHREAD_CONFIG_MLE_MAX_CONCURRENT_CHILD_ATTACHES 4
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_SUPERVISION_CHECK_TIMEOUT
- *
- * The default supervision check timeout interval (in seconds) used by a device in child state. Set to zero to disable
- * the supervision check process on the child.
- *
- * Applicable only if child supervision feature is enabled (i.e., `OPENTHREAD_ENABLE_CHILD_SUPERVISION` is set).
+ * @def OPENTHREAD_CONFIG_MLE_CHILD_ATTACH_MIN_FREE_BUFFERS
  *
- * If the sleepy child does not hear from its parent within the specified timeout interval, it initiates the re-attach
- * process (MLE Child Update Request/Response exchange with its parent).
+ * Specifies the minimum number of free message buffers a router requires before it answers a Parent Request from an
+ * unknown device, so that Child ID Responses to devices already attaching do not run out of buffers.
  *
  */
-#ifndef OPENTHREAD_CONFIG_SUPERVISION_CHECK_TIMEOUT
-#define OPENTHREAD_CONFIG_SUPERVISION_CHECK_TIMEOUT 190
+#ifndef OPENTHREAD_CONFIG_MLE_CHILD_ATTACH_MIN_FREE_BUFFERS
+#define OPENTHREAD_CONFIG_MLE_CHILD_ATTACH_MIN_FREE_BUFFERS 8
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_SUPERVISION_MSG_NO_ACK_REQUEST
+ * @def OPENTHREAD_CONFIG_MLE_ADDRESS_SOLICIT_BATCH_WINDOW
  *
- * Define as 1 to clear/disable 15.4 ack request in the MAC header of a supervision message.
+ * Specifies the window (in milliseconds) over which the leader batches Address Solicit requests.
  *
- * Applicable only if child supervision feature is enabled (i.e., `OPENTHREAD_ENABLE_CHILD_SUPERVISION` is set).
+ * When non-zero, router ids are still allocated as requests arrive, but the Router ID Sequence is updated only once
+ * and all the responses are sent together when the window expires, so a burst of REED upgrades (e.g., during network
+ * formation) results in a single routing table change. The window must be well below the CoAP ACK timeout.
+ *
+ * Define to 0 to answer every Address Solicit immediately.
  *
  */
-#ifndef OPENTHREAD_CONFIG_SUPERVISION_MSG_NO_ACK_REQUEST
-#define OPENTHREAD_CONFIG_SUPERVISION_MSG_NO_ACK_REQUEST 0
+#ifndef OPENTHREAD_CONFIG_MLE_ADDRESS_SOLICIT_BATCH_WINDOW
+#define OPENTHREAD_CONFIG_MLE_ADDRESS_SOLICIT_BATCH_WINDOW 0
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_INFORM_PREVIOUS_PARENT_ON_REATTACH
+ * @def OPENTHREAD_CONFIG_MLE_ADDRESS_SOLICIT_BATCH_SIZE
  *
- * Define as 1 for a child to inform its previous parent when it attaches to a new parent.
- *
- * If this feature is enabled, when a device attaches to a new parent, it will send an IP message (with empty payload
- * and mesh-local IP address as the source address) to its previous parent.
+ * Specifies the maximum number of Address Solicit responses the leader holds back within one batch window. The
+ * batch is sent early once it is full.
  *
  */
-#ifndef OPENTHREAD_CONFIG_INFORM_PREVIOUS_PARENT_ON_REATTACH
-#define OPENTHREAD_CONFIG_INFORM_PREVIOUS_PARENT_ON_REATTACH 0
+#ifndef OPENTHREAD_CONFIG_MLE_ADDRESS_SOLICIT_BATCH_SIZE
+#define OPENTHREAD_CONFIG_MLE_ADDRESS_SOLICIT_BATCH_SIZE 4
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_ENABLE_PERIODIC_PARENT_SEARCH
- *
- * Define as 1 to enable periodic parent search feature.
+ * @def OPENTHREAD_CONFIG_MLE_NETWORK_DATA_DELTA
  *
- * When this feature is enabled an end-device/child (while staying attached) will periodically search for a possible
- * better parent and will switch parent if a better one is found.
+ * Define to 1 to distribute Network Data changes as deltas.
  *
- * The child will periodically check the average RSS value for the current parent, and only if it is below a specific
- * threshold, a parent search is performed. The `OPENTHREAD_CONFIG_PARENT_SEARCH_CHECK_INTERVAL` specifies the the
- * check interval (in seconds) and `OPENTHREAD_CONFIG_PARENT_SEARCH_RSS_THRESHOLD` gives the RSS threshold.
+ * When enabled, routers remember the Network Data of the previous version and, instead of the full Network Data TLV,
+ * send a Network Data Delta TLV holding only the changed bytes to neighbors known to hold that version. A device that
+ * cannot apply a delta falls back to requesting the full Network Data with an MLE Data Request.
  *
- * Since the parent search process can be power consuming (child needs to stays in RX mode to collect parent response)
- * and to limit its impact on battery-powered devices, after a parent search is triggered, the child will not trigger
- * another one before a specified backoff interval specified by `OPENTHREAD_CONFIG_PARENT_SEARCH_BACKOFF_INTERVAL`
+ * The Network Data Delta TLV is not part of the Thread specification. It is meant for networks where all routers
+ * enable this option, since devices without it request the full Network Data after every multicast delta.
  *
  */
-#ifndef OPENTHREAD_CONFIG_ENABLE_PERIODIC_PARENT_SEARCH
-#define OPENTHREAD_CONFIG_ENABLE_PERIODIC_PARENT_SEARCH 0
+#ifndef OPENTHREAD_CONFIG_MLE_NETWORK_DATA_DELTA
+#define OPENTHREAD_CONFIG_MLE_NETWORK_DATA_DELTA 0
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_PARENT_SEARCH_CHECK_INTERVAL
+ * @def OPENTHREAD_CONFIG_NETWORK_DATA_REGISTER_DELAY
  *
- * Specifies the interval in seconds for a child to check the trigger condition to perform a parent search.
+ * Specifies the time (in milliseconds) for which registrations of the local Network Data with the leader (Server Data
+ * Notifications) are held back and coalesced.
  *
- * Applicable only if periodic parent search feature is enabled (see `OPENTHREAD_CONFIG_ENABLE_PERIODIC_PARENT_SEARCH`).
+ * A border router applying its configuration one prefix, route or service at a time then sends a single registration
+ * carrying the final local Network Data, instead of one per change.
+ *
+ * Set to 0 to register immediately.
  *
  */
-#ifndef OPENTHREAD_CONFIG_PARENT_SEARCH_CHECK_INTERVAL
-#define OPENTHREAD_CONFIG_PARENT_SEARCH_CHECK_INTERVAL (9 * 60)
+#ifndef OPENTHREAD_CONFIG_NETWORK_DATA_REGISTER_DELAY
+#define OPENTHREAD_CONFIG_NETWORK_DATA_REGISTER_DELAY 0
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_PARENT_SEARCH_BACKOFF_INTERVAL
- *
- * Specifies the backoff interval in seconds for a child to not perform a parent search after triggering one.
+ * @def OPENTHREAD_CONFIG_NETWORK_DIAGNOSTIC_ANSWER_MAX_DELAY
  *
- * Applicable only if periodic parent search feature is enabled (see `OPENTHREAD_CONFIG_ENABLE_PERIODIC_PARENT_SEARCH`).
+ * Specifies the maximum random delay (in milliseconds) before answering a multicast Network Diagnostic Get query
+ * (DIAG_GET.qry), so that the answers of many devices to a bulk query do not all arrive at once.
  *
+ * Set to 0 to answer immediately.
  *
  */
-#ifndef OPENTHREAD_CONFIG_PARENT_SEARCH_BACKOFF_INTERVAL
-#define OPENTHREAD_CONFIG_PARENT_SEARCH_BACKOFF_INTERVAL (10 * 60 * 60)
+#ifndef OPENTHREAD_CONFIG_NETWORK_DIAGNOSTIC_ANSWER_MAX_DELAY
+#define OPENTHREAD_CONFIG_NETWORK_DIAGNOSTIC_ANSWER_MAX_DELAY 0
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_PARENT_SEARCH_RSS_THRESHOLD
+ * @def OPENTHREAD_CONFIG_NETWORK_DIAGNOSTIC_ANSWER_MAX_LENGTH
  *
- * Specifies the RSS threshold used to trigger a parent search.
+ * Specifies the maximum length (in bytes) of a Network Diagnostic Get answer (DIAG_GET.ans) message.
  *
- * Applicable only if periodic parent search feature is enabled (see `OPENTHREAD_CONFIG_ENABLE_PERIODIC_PARENT_SEARCH`).
+ * Answers that would be longer are split across several messages, each sent once the previous one is acknowledged.
+ * List TLVs (Child Table, IPv6 Address List) are split by entries, each part being a valid TLV on its own.
+ *
+ * Set to 0 to always send a single answer.
  *
  */
-#ifndef OPENTHREAD_CONFIG_PARENT_SEARCH_RSS_THRESHOLD
-#define OPENTHREAD_CONFIG_PARENT_SEARCH_RSS_THRESHOLD -65
+#ifndef OPENTHREAD_CONFIG_NETWORK_DIAGNOSTIC_ANSWER_MAX_LENGTH
+#define OPENTHREAD_CONFIG_NETWORK_DIAGNOSTIC_ANSWER_MAX_LENGTH 0
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_ENABLE_ATTACH_BACKOFF
+ * @def OPENTHREAD_CONFIG_ENABLE_DEBUG_UART
  *
- * Define as 1 to enable attach backoff feature
+ * Enable the "Debug Uart" platform feature.
  *
- * When this feature is enabled, an exponentially increasing backoff wait time is added between attach attempts.
- * If device is sleepy, the radio will be put to sleep during the wait time. This ensures that a battery-powered sleepy
- * end-device does not drain its battery by continuously searching for a parent to attach to (when there is no
- * router/parent for it to attach).
+ * In the embedded world, the CLI application uses a UART as a console
+ * and the NCP application can be configured to use either a UART or
+ * a SPI type device to transfer data to the host.
  *
- * The backoff time starts from a minimum interval specified by `OPENTHREAD_CONFIG_ATTACH_BACKOFF_MINIMUM_INTERVAL`,
- * and every attach attempt the wait time is doubled up to `OPENTHREAD_CONFIG_ATTACH_BACKOFF_MAXIMUM_INTERVAL` which
- * specifies the maximum wait time.
+ * The Debug UART is or requires a second uart on the platform.
  *
- * Once the wait time reaches the maximum, a random jitter interval is added to it. The maximum value for jitter is
- * specified by `OPENTHREAD_CONFIG_ATTACH_BACKOFF_JITTER_INTERVAL`. The random jitter is selected uniformly within
- * range `[-JITTER, +JITTER]`. It is only added when the backoff wait interval is at maximum value.
+ * The Debug Uart has two uses:
  *
+ * Use #1 - for random 'debug printf' type messages a developer may need
+ * Use #2 (selected via DEBUG_LOG_OUTPUT) is a log output.
+ *
+ * See #include <openthread/platform/debug_uart.h> for more details
  */
-#ifndef OPENTHREAD_CONFIG_ENABLE_ATTACH_BACKOFF
-#define OPENTHREAD_CONFIG_ENABLE_ATTACH_BACKOFF 1
+#ifndef OPENTHREAD_CONFIG_ENABLE_DEBUG_UART
+#define OPENTHREAD_CONFIG_ENABLE_DEBUG_UART 0
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_ATTACH_BACKOFF_MINIMUM_INTERVAL
- *
- * Specifies the minimum backoff wait interval (in milliseconds) used by attach backoff feature.
+ * @def OPENTHREAD_CONFIG_ENABLE_DYNAMIC_MPL_INTERVAL
  *
- * Applicable only if attach backoff feature is enabled (see `OPENTHREAD_CONFIG_ENABLE_ATTACH_BACKOFF`).
+ * Define as 1 to enable dynamic MPL interval feature.
  *
- * Please see `OPENTHREAD_CONFIG_ENABLE_ATTACH_BACKOFF` description for more details.
+ * If this feature is enabled, the MPL forward interval will be adjusted dynamically according to
+ * the network scale, which helps to reduce multicast latency.
  *
  */
-#ifndef OPENTHREAD_CONFIG_ATTACH_BACKOFF_MINIMUM_INTERVAL
-#define OPENTHREAD_CONFIG_ATTACH_BACKOFF_MINIMUM_INTERVAL 251
+#ifndef OPENTHREAD_CONFIG_ENABLE_DYNAMIC_MPL_INTERVAL
+#define OPENTHREAD_CONFIG_ENABLE_DYNAMIC_MPL_INTERVAL 0
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_ATTACH_BACKOFF_MAXIMUM_INTERVAL
- *
- * Specifies the maximum backoff wait interval (in milliseconds) used by attach backoff feature.
- *
- * Applicable only if attach backoff feature is enabled (see `OPENTHREAD_CONFIG_ENABLE_ATTACH_BACKOFF`).
+ * @def OPENTHREAD_CONFIG_DISABLE_CSMA_CA_ON_LAST_ATTEMPT
  *
- * Please see `OPENTHREAD_CONFIG_ENABLE_ATTACH_BACKOFF` description for more details.
+ * Define as 1 to disable CSMA-CA on the last transmit attempt
  *
  */
-#ifndef OPENTHREAD_CONFIG_ATTACH_BACKOFF_MAXIMUM_INTERVAL
-#define OPENTHREAD_CONFIG_ATTACH_BACKOFF_MAXIMUM_INTERVAL 1200000 // 1200 seconds = 20 minutes
+#ifndef OPENTHREAD_CONFIG_DISABLE_CSMA_CA_ON_LAST_ATTEMPT
+#define OPENTHREAD_CONFIG_DISABLE_CSMA_CA_ON_LAST_ATTEMPT 0
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_ATTACH_BACKOFF_JITTER_INTERVAL
+ * @def OPENTHREAD_CONFIG_ENABLE_ADAPTIVE_CSMA
  *
- * Specifies the maximum jitter interval (in milliseconds) used by attach backoff feature.
+ * Define as 1 to adapt the CSMA-CA parameters (macMinBE, macMaxBE and macMaxCsmaBackoffs) to the observed
+ * congestion on the PAN channel.
  *
- * Applicable only if attach backoff feature is enabled (see `OPENTHREAD_CONFIG_ENABLE_ATTACH_BACKOFF`).
+ * Congestion is estimated from the recent CCA failure rate and, when `OPENTHREAD_ENABLE_CHANNEL_MONITOR` is
+ * enabled and the channel monitor is running, from the measured channel occupancy. Backoffs are shortened on a
+ * quiet channel and lengthened (with an extra CSMA attempt) on a busy one.
  *
- * Please see `OPENTHREAD_CONFIG_ENABLE_ATTACH_BACKOFF` description for more details.
+ * This feature only applies when the CSMA-CA backoff is performed by OpenThread (i.e., the radio does not
+ * support `OT_RADIO_CAPS_CSMA_BACKOFF`).
  *
  */
-#ifndef OPENTHREAD_CONFIG_ATTACH_BACKOFF_JITTER_INTERVAL
-#define OPENTHREAD_CONFIG_ATTACH_BACKOFF_JITTER_INTERVAL 2000
+#ifndef OPENTHREAD_CONFIG_ENABLE_ADAPTIVE_CSMA
+#define OPENTHREAD_CONFIG_ENABLE_ADAPTIVE_CSMA 0
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_SEND_UNICAST_ANNOUNCE_RESPONSE
+ * @def OPENTHREAD_CONFIG_ENABLE_MAC_OPERATION_STATS
  *
- * Define as 1 to enable sending of a unicast MLE Announce message in response to a received Announce message from
- * a device.
+ * Define as 1 to track per MAC operation counts and latency histograms (queue and execution time).
  *
- * @note The unicast MLE announce message is sent in addition to (and after) the multicast MLE Announce.
+ * The statistics are available through `otLinkGetOperationStats()` and the `SPINEL_PROP_CNTR_MAC_OPERATION_STATS`
+ * NCP property.
  *
  */
-#ifndef OPENTHREAD_CONFIG_SEND_UNICAST_ANNOUNCE_RESPONSE
-#define OPENTHREAD_CONFIG_SEND_UNICAST_ANNOUNCE_RESPONSE 1
+#ifndef OPENTHREAD_CONFIG_ENABLE_MAC_OPERATION_STATS
+#define OPENTHREAD_CONFIG_ENABLE_MAC_OPERATION_STATS 0
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_ENABLE_ANNOUNCE_SENDER
+ * @def OPENTHREAD_CONFIG_ENABLE_RADIO_TIME_STATS
  *
- * Define as 1 to enable `AnnounceSender` which will periodically send MLE Announce message on all channels.
+ * Define as 1 to account the time the radio spends sleeping, receiving and transmitting, attributed to the MAC
+ * operation (or data poll) that caused it, for radio duty cycle and energy budgeting.
  *
- * The list of channels is determined from the Operational Dataset's ChannelMask. The period intervals are determined
- * by `OPENTHREAD_CONFIG_ANNOUNCE_SENDER_INTERVAL_ROUTER` and `OPENTHREAD_CONFIG_ANNOUNCE_SENDER_INTERVAL_REED`
- * configuration options.
+ * The time is measured with the platform microsecond clock `otPlatTimeGet()`, which the platform must provide. The
+ * statistics are available through `otLinkGetRadioTimeStats()`, the CLI `counter radio` command and the
+ * `SPINEL_PROP_CNTR_RADIO_TIME_STATS` NCP property.
  *
  */
-#ifndef OPENTHREAD_CONFIG_ENABLE_ANNOUNCE_SENDER
-#define OPENTHREAD_CONFIG_ENABLE_ANNOUNCE_SENDER 0
+#ifndef OPENTHREAD_CONFIG_ENABLE_RADIO_TIME_STATS
+#define OPENTHREAD_CONFIG_ENABLE_RADIO_TIME_STATS 0
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_ANNOUNCE_SENDER_INTERVAL_ROUTER
+ * @def OPENTHREAD_CONFIG_ENABLE_ADAPTIVE_FRAME_RETRIES
  *
- * Specifies the time interval (in milliseconds) between `AnnounceSender` transmit cycles on a device in Router role.
+ * Define as 1 to adapt the maximum number of MAC retries of direct unicast frames to the recent frame tx error rate
+ * of the destination neighbor (instead of always using `OPENTHREAD_CONFIG_MAC_MAX_FRAME_RETRIES_DIRECT`).
  *
- * In a cycle, the `AnnounceSender` sends MLE Announcement on all channels in Active Operational Dataset's ChannelMask.
- * The transmissions on different channels happen uniformly over the given interval (i.e., if there are 16 channels,
- * there will be 16 MLE Announcement messages each on one channel with `interval / 16`  between two consecutive MLE
- * Announcement transmissions).
+ * Links with an occasional loss get up to `OPENTHREAD_CONFIG_ADAPTIVE_FRAME_RETRIES_MAX` retries, while links where
+ * most frames fail get only `OPENTHREAD_CONFIG_ADAPTIVE_FRAME_RETRIES_MIN` retries, so that airtime is not spent on
+ * frames that are unlikely to get through.
  *
- * Applicable only if `AnnounceSender` feature is enabled (see `OPENTHREAD_CONFIG_ENABLE_ANNOUNCE_SENDER`).
+ * This feature requires `OPENTHREAD_CONFIG_ENABLE_TX_ERROR_RATE_TRACKING`.
  *
  */
-#ifndef OPENTHREAD_CONFIG_ANNOUNCE_SENDER_INTERVAL_ROUTER
-#define OPENTHREAD_CONFIG_ANNOUNCE_SENDER_INTERVAL_ROUTER 688000 // 668 seconds = 11 min and 28 sec.
+#ifndef OPENTHREAD_CONFIG_ENABLE_ADAPTIVE_FRAME_RETRIES
+#define OPENTHREAD_CONFIG_ENABLE_ADAPTIVE_FRAME_RETRIES 0
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_ANNOUNCE_SENDER_INTERVAL_REED
- *
- * Specifies the time interval (in milliseconds) between `AnnounceSender` transmit cycles on a device in REED role.
+ * @def OPENTHREAD_CONFIG_ADAPTIVE_FRAME_RETRIES_MIN
  *
- * This is similar to `OPENTHREAD_CONFIG_ANNOUNCE_SENDER_INTERVAL_ROUTER` but used when device is in REED role.
+ * The number of MAC retries of direct frames to a neighbor with a very high frame tx error rate.
  *
- * Applicable only if `AnnounceSender` feature is enabled (see `OPENTHREAD_CONFIG_ENABLE_ANNOUNCE_SENDER`).
+ * Applicable only if `OPENTHREAD_CONFIG_ENABLE_ADAPTIVE_FRAME_RETRIES` is set.
  *
  */
-#ifndef OPENTHREAD_CONFIG_ANNOUNCE_SENDER_INTERVAL_REED
-#define OPENTHREAD_CONFIG_ANNOUNCE_SENDER_INTERVAL_REED (668000 * 3)
+#ifndef OPENTHREAD_CONFIG_ADAPTIVE_FRAME_RETRIES_MIN
+#define OPENTHREAD_CONFIG_ADAPTIVE_FRAME_RETRIES_MIN 1
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_NCP_ENABLE_PEEK_POKE
+ * @def OPENTHREAD_CONFIG_ADAPTIVE_FRAME_RETRIES_MAX
  *
- * Define as 1 to enable peek/poke functionality on NCP.
+ * The number of MAC retries of direct frames to a neighbor with a moderate frame tx error rate.
  *
- * Peek/Poke allows the host to read/write to memory addresses on NCP. This is intended for debugging.
+ * Applicable only if `OPENTHREAD_CONFIG_ENABLE_ADAPTIVE_FRAME_RETRIES` is set.
  *
  */
-#ifndef OPENTHREAD_CONFIG_NCP_ENABLE_PEEK_POKE
-#define OPENTHREAD_CONFIG_NCP_ENABLE_PEEK_POKE 0
+#ifndef OPENTHREAD_CONFIG_ADAPTIVE_FRAME_RETRIES_MAX
+#define OPENTHREAD_CONFIG_ADAPTIVE_FRAME_RETRIES_MAX (OPENTHREAD_CONFIG_MAC_MAX_FRAME_RETRIES_DIRECT + 2)
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_NCP_SPINEL_RESPONSE_QUEUE_SIZE
+ * @def OPENTHREAD_CONFIG_ENABLE_ETX_LINK_COST
  *
- * Size of NCP Spinel command response queue.
+ * Define as 1 to scale the link cost derived from the link quality by the expected transmission count (ETX) of the
+ * link, estimated from the frame tx error rate tracked for the neighbor.
  *
- * NCP guarantees that it can respond up to `OPENTHREAD_CONFIG_NCP_SPINEL_RESPONSE_QUEUE_SIZE` spinel commands at the
- * same time. The spinel protocol defines a Transaction ID (TID) as part of spinel command frame (the TID can be
- * a value 0-15 where TID 0 is used for frames which require no response). Spinel protocol can support at most support
- * 15 simultaneous commands.
+ * Links with a good RSS but heavy interference then get a higher cost, both in route selection and in the leader
+ * cost advertised to prospective children, which also prefer the parent with the lower leader cost.
  *
- * The host driver implementation may further limit the number of simultaneous Spinel command frames (e.g., wpantund
- * limits this to two). This configuration option can be used to reduce the response queue size.
+ * This feature requires `OPENTHREAD_CONFIG_ENABLE_TX_ERROR_RATE_TRACKING`.
  *
  */
-#ifndef OPENTHREAD_CONFIG_NCP_SPINEL_RESPONSE_QUEUE_SIZE
-#define OPENTHREAD_CONFIG_NCP_SPINEL_RESPONSE_QUEUE_SIZE 15
+#ifndef OPENTHREAD_CONFIG_ENABLE_ETX_LINK_COST
+#define OPENTHREAD_CONFIG_ENABLE_ETX_LINK_COST 0
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_NCP_ENABLE_MCU_POWER_STATE_CONTROL
+ * @def OPENTHREAD_CONFIG_ENABLE_PARENT_LOAD_BALANCING
  *
- * Define to 1 to enable support controlling of desired power state of NCP's micro-controller.
- *
- * The power state specifies the desired power state of NCP's micro-controller (MCU) when the underlying platform's
- * operating system enters idle mode (i.e., all active tasks/events are processed and the MCU can potentially enter a
- * energy-saving power state).
- *
- * The power state primarily determines how the host should interact with the NCP and whether the host needs an
- * external trigger (a "poke") before it can communicate with the NCP or not.
+ * Define as 1 to spread children more evenly over the parents.
  *
- * When enabled, the platform is expected to provide `otPlatSetMcuPowerState()` and `otPlatGetMcuPowerState()`
- * functions (please see `openthread/platform/misc.h`). Host can then control the power state using
- * `SPINEL_PROP_MCU_POWER_STATE`.
+ * Routers and REEDs advertise their load (child table occupancy or message buffer usage, whichever is higher) in the
+ * reserved bits of the Connectivity TLV, and attaching children prefer a clearly less loaded parent among candidates
+ * with the same link quality, router state and parent priority. Devices which do not support the extension advertise
+ * a zero load.
  *
  */
-#ifndef OPENTHREAD_CONFIG_NCP_ENABLE_MCU_POWER_STATE_CONTROL
-#define OPENTHREAD_CONFIG_NCP_ENABLE_MCU_POWER_STATE_CONTROL 0
+#ifndef OPENTHREAD_CONFIG_ENABLE_PARENT_LOAD_BALANCING
+#define OPENTHREAD_CONFIG_ENABLE_PARENT_LOAD_BALANCING 0
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_STAY_AWAKE_BETWEEN_FRAGMENTS
+ * @def OPENTHREAD_CONFIG_ENABLE_CSL
  *
- * Define as 1 to stay awake between fragments while transmitting a large packet,
- * and to stay awake after receiving a packet with frame pending set to true.
+ * Define as 1 to enable the Coordinated Sampled Listening (CSL) style receive mode for sleepy children.
+ *
+ * A sleepy child with a non-zero CSL period opens a short receive window every CSL period, synchronized to its last
+ * data poll. The parent learns the CSL period from the MLE Child ID / Child Update Request and transmits queued
+ * indirect frames at the child's next receive window instead of waiting for the next data poll.
  *
  */
-#ifndef OPENTHREAD_CONFIG_STAY_AWAKE_BETWEEN_FRAGMENTS
-#define OPENTHREAD_CONFIG_STAY_AWAKE_BETWEEN_FRAGMENTS 0
+#ifndef OPENTHREAD_CONFIG_ENABLE_CSL
+#define OPENTHREAD_CONFIG_ENABLE_CSL 0
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_MLE_SEND_LINK_REQUEST_ON_ADV_TIMEOUT
+ * @def OPENTHREAD_CONFIG_CSL_RECEIVE_WINDOW
  *
- * Define to 1 to send an MLE Link Request when MAX_NEIGHBOR_AGE is reached for a neighboring router.
+ * The duration of each CSL receive window on a sleepy child (in milliseconds).
+ *
+ * The parent aims its transmission at the middle of the window, so the window should cover the CSMA-CA backoff and
+ * the clock drift accumulated between two data polls.
  *
  */
-#ifndef OPENTHREAD_CONFIG_MLE_SEND_LINK_REQUEST_ON_ADV_TIMEOUT
-#define OPENTHREAD_CONFIG_MLE_SEND_LINK_REQUEST_ON_ADV_TIMEOUT 0
+#ifndef OPENTHREAD_CONFIG_CSL_RECEIVE_WINDOW
+#define OPENTHREAD_CONFIG_CSL_RECEIVE_WINDOW 10
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_MLE_LINK_REQUEST_MARGIN_MIN
+ * @def OPENTHREAD_CONFIG_MAC_TSCH
  *
- * Specifies the minimum link margin in dBm required before attempting to establish a link with a neighboring router.
+ * Define as 1 to enable the Time-Slotted Channel Hopping (TSCH) MAC mode.
+ *
+ * With a slotframe and cells configured (see `otLinkTschSetSlotframeLength()`), data frames are only transmitted at
+ * the start of transmit cells and the radio only listens in receive cells, each cell hopping over the supported
+ * channels every slotframe. Timeslots are numbered from the network time, so the feature requires
+ * `OPENTHREAD_CONFIG_ENABLE_TIME_SYNC`. While the network time is not synchronized, the MAC uses CSMA-CA on the PAN
+ * channel as usual.
  *
  */
-#ifndef OPENTHREAD_CONFIG_MLE_LINK_REQUEST_MARGIN_MIN
-#define OPENTHREAD_CONFIG_MLE_LINK_REQUEST_MARGIN_MIN 10
+#ifndef OPENTHREAD_CONFIG_MAC_TSCH
+#define OPENTHREAD_CONFIG_MAC_TSCH 0
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_MLE_PARTITION_MERGE_MARGIN_MIN
+ * @def OPENTHREAD_CONFIG_MAC_TSCH_TIMESLOT_LENGTH
  *
- * Specifies the minimum link margin in dBm required before attempting to merge to a different partition.
+ * The duration of a TSCH timeslot (in milliseconds).
+ *
+ * The timeslot must cover a maximum-size frame, its acknowledgment and the network time error between neighbors.
  *
  */
-#ifndef OPENTHREAD_CONFIG_MLE_PARTITION_MERGE_MARGIN_MIN
-#define OPENTHREAD_CONFIG_MLE_PARTITION_MERGE_MARGIN_MIN 10
+#ifndef OPENTHREAD_CONFIG_MAC_TSCH_TIMESLOT_LENGTH
+#define OPENTHREAD_CONFIG_MAC_TSCH_TIMESLOT_LENGTH 10
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_ENABLE_DEBUG_UART
- *
- * Enable the "Debug Uart" platform feature.
- *
- * In the embedded world, the CLI application uses a UART as a console
- * and the NCP application can be configured to use either a UART or
- * a SPI type device to transfer data to the host.
- *
- * The Debug UART is or requires a second uart on the platform.
- *
- * The Debug Uart has two uses:
+ * @def OPENTHREAD_CONFIG_MAC_TSCH_MAX_CELLS
  *
- * Use #1 - for random 'debug printf' type messages a developer may need
- * Use #2 (selected via DEBUG_LOG_OUTPUT) is a log output.
+ * The maximum number of cells in the TSCH schedule.
  *
- * See #include <openthread/platform/debug_uart.h> for more details
  */
-#ifndef OPENTHREAD_CONFIG_ENABLE_DEBUG_UART
-#define OPENTHREAD_CONFIG_ENABLE_DEBUG_UART 0
+#ifndef OPENTHREAD_CONFIG_MAC_TSCH_MAX_CELLS
+#define OPENTHREAD_CONFIG_MAC_TSCH_MAX_CELLS 8
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_ENABLE_DYNAMIC_MPL_INTERVAL
+ * @def OPENTHREAD_CONFIG_MAC_RADIO_ARBITRATION
  *
- * Define as 1 to enable dynamic MPL interval feature.
+ * Define as 1 for the MAC to request radio time from the platform with `otPlatRadioRequestSlot()`, for radios shared
+ * with another protocol such as BLE.
  *
- * If this feature is enabled, the MPL forward interval will be adjusted dynamically according to
- * the network scale, which helps to reduce multicast latency.
+ * Transmissions, receive windows after data polls, CSL and TSCH receive windows and scans are announced to the
+ * platform arbiter as time slots, so it can plan the other protocol around them instead of preempting the radio in
+ * the middle of an acknowledgment or a data poll exchange.
  *
  */
-#ifndef OPENTHREAD_CONFIG_ENABLE_DYNAMIC_MPL_INTERVAL
-#define OPENTHREAD_CONFIG_ENABLE_DYNAMIC_MPL_INTERVAL 0
+#ifndef OPENTHREAD_CONFIG_MAC_RADIO_ARBITRATION
+#define OPENTHREAD_CONFIG_MAC_RADIO_ARBITRATION 0
 #endif
 
 /**
- * @def OPENTHREAD_CONFIG_DISABLE_CSMA_CA_ON_LAST_ATTEMPT
+ * @def OPENTHREAD_CONFIG_MAC_RADIO_GRANT_TIMEOUT
  *
- * Define as 1 to disable CSMA-CA on the last transmit attempt
+ * The maximum time (in milliseconds) a transmission waits for the radio after a denied `otPlatRadioRequestSlot()`
+ * before the attempt fails as a channel access failure (applicable when `OPENTHREAD_CONFIG_MAC_RADIO_ARBITRATION`
+ * is enabled).
  *
  */
-#ifndef OPENTHREAD_CONFIG_DISABLE_CSMA_CA_ON_LAST_ATTEMPT
-#define OPENTHREAD_CONFIG_DISABLE_CSMA_CA_ON_LAST_ATTEMPT 0
+#ifndef OPENTHREAD_CONFIG_MAC_RADIO_GRANT_TIMEOUT
+#define OPENTHREAD_CONFIG_MAC_RADIO_GRANT_TIMEOUT 20
 #endif
 
 /**
@@ -1812,6 +3514,16 @@
 #define OPENTHREAD_CONFIG_POSIX_SETTINGS_PATH "tmp"
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_POSIX_SETTINGS_SYNC_INTERVAL
+ *
+ * The number of settings journal records written between two `fsync()` calls on posix platform.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_POSIX_SETTINGS_SYNC_INTERVAL
+#define OPENTHREAD_CONFIG_POSIX_SETTINGS_SYNC_INTERVAL 16
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_FAILED_CHILD_TRANSMISSIONS
  *
@@ -1867,6 +3579,45 @@
 #define OPENTHREAD_CONFIG_DEFAULT_SED_DATAGRAM_COUNT 1
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_ENABLE_CHILD_INDIRECT_LIMITS
+ *
+ * Define as 1 to limit the number of messages and bytes queued for indirect transmission to each sleepy child.
+ *
+ * A message which would take a child over its limits is not queued for that child, so a child with a large backlog
+ * cannot hold most of the message buffers. Network control (MLE) messages and supervision messages are not limited.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_ENABLE_CHILD_INDIRECT_LIMITS
+#define OPENTHREAD_CONFIG_ENABLE_CHILD_INDIRECT_LIMITS 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_CHILD_INDIRECT_MAX_MESSAGES
+ *
+ * The maximum number of messages queued for indirect transmission to a sleepy child.
+ *
+ * Applicable only if `OPENTHREAD_CONFIG_ENABLE_CHILD_INDIRECT_LIMITS` is set. It must be at least
+ * `OPENTHREAD_CONFIG_DEFAULT_SED_DATAGRAM_COUNT`.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_CHILD_INDIRECT_MAX_MESSAGES
+#define OPENTHREAD_CONFIG_CHILD_INDIRECT_MAX_MESSAGES 8
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_CHILD_INDIRECT_MAX_BYTES
+ *
+ * The maximum total length (in bytes) of the messages queued for indirect transmission to a sleepy child.
+ *
+ * Applicable only if `OPENTHREAD_CONFIG_ENABLE_CHILD_INDIRECT_LIMITS` is set. It must be at least
+ * `OPENTHREAD_CONFIG_DEFAULT_SED_BUFFER_SIZE`.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_CHILD_INDIRECT_MAX_BYTES
+#define OPENTHREAD_CONFIG_CHILD_INDIRECT_MAX_BYTES (4 * OPENTHREAD_CONFIG_DEFAULT_SED_BUFFER_SIZE)
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_IPV6_DEFAULT_HOP_LIMIT
  *
@@ -1877,6 +3628,29 @@
 #define OPENTHREAD_CONFIG_IPV6_DEFAULT_HOP_LIMIT 64
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_ICMP6_RESPONSE_RATE_LIMIT
+ *
+ * The maximum sustained number of ICMPv6 echo replies and error messages sent per second (zero for no limit).
+ *
+ * The responses are limited by a token bucket of `OPENTHREAD_CONFIG_ICMP6_RESPONSE_BURST` tokens, refilled at this
+ * rate. Echo requests and errors arriving while the bucket is empty are not answered.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_ICMP6_RESPONSE_RATE_LIMIT
+#define OPENTHREAD_CONFIG_ICMP6_RESPONSE_RATE_LIMIT 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_ICMP6_RESPONSE_BURST
+ *
+ * The maximum number of ICMPv6 responses which can be sent back-to-back when rate limiting is enabled.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_ICMP6_RESPONSE_BURST
+#define OPENTHREAD_CONFIG_ICMP6_RESPONSE_BURST 5
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_IPV6_DEFAULT_MAX_DATAGRAM
  *
@@ -1897,4 +3671,43 @@
 #ifndef OPENTHREAD_CONFIG_TIME_SYNC_JUMP_NOTIF_MIN_US
 #define OPENTHREAD_CONFIG_TIME_SYNC_JUMP_NOTIF_MIN_US 10000
 #endif
+
+/**
+ * @def OPENTHREAD_CONFIG_TIME_SYNC_DRIFT_COMPENSATION
+ *
+ * Define as 1 to estimate the drift of the local clock against the network time from successive time sync messages
+ * and compensate for it between synchronizations.
+ *
+ * The drift is only estimated when the radio reports `OT_RADIO_CAPS_SFD_TIMESTAMP`, and an estimate larger than the
+ * local XTAL accuracy plus the XTAL threshold is discarded.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_TIME_SYNC_DRIFT_COMPENSATION
+#define OPENTHREAD_CONFIG_TIME_SYNC_DRIFT_COMPENSATION 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_ENABLE_HANDLER_PROFILER
+ *
+ * Define as 1 to profile the tasklet and timer handlers run by the tasklet and timer schedulers.
+ *
+ * For each handler the number of invocations, the cumulative and the maximum execution time are recorded using the
+ * platform microsecond clock `otPlatTimeGet()`, which the platform must provide. The profiles are available through
+ * `otTaskletGetNextHandlerProfile()`, the CLI `profile` command and the `SPINEL_PROP_CNTR_HANDLER_PROFILE` property.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_ENABLE_HANDLER_PROFILER
+#define OPENTHREAD_CONFIG_ENABLE_HANDLER_PROFILER 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_HANDLER_PROFILER_MAX_ENTRIES
+ *
+ * The maximum number of distinct handlers tracked by the handler profiler. Invocations of handlers beyond this limit
+ * are accumulated in a single overflow entry.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_HANDLER_PROFILER_MAX_ENTRIES
+#define OPENTHREAD_CONFIG_HANDLER_PROFILER_MAX_ENTRIES 32
+#endif
 #endif // OPENTHREAD_CORE_DEFAULT_CONFIG_H_
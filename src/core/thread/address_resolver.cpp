@@ -46,6 +46,7 @@
 #include "common/instance.hpp"
 #include "common/logging.hpp"
 #include "common/owner-locator.hpp"
+#include "common/settings.hpp"
 #include "mac/mac_frame.hpp"
 #include "thread/mesh_forwarder.hpp"
 #include "thread/mle_router.hpp"
@@ -63,8 +64,16 @@ AddressResolver::AddressResolver(Instance &aInstance)
     , mAddressNotification(OT_URI_PATH_ADDRESS_NOTIFY, &AddressResolver::HandleAddressNotification, this)
     , mIcmpHandler(&AddressResolver::HandleIcmpReceive, this)
     , mTimer(aInstance, &AddressResolver::HandleTimer, this)
+#if OPENTHREAD_CONFIG_ENABLE_ADDRESS_QUERY_BATCHING
+    , mBatchTimer(aInstance, &AddressResolver::HandleBatchTimer, this)
+#endif
+#if OPENTHREAD_CONFIG_ENABLE_ADDRESS_CACHE_PERSISTENCE
+    , mSaveTimer(aInstance, &AddressResolver::HandleSaveTimer, this)
+    , mSavedHash(0)
+#endif
 {
     Clear();
+    ResetCounters();
 
     GetNetif().GetCoap().AddResource(mAddressError);
     GetNetif().GetCoap().AddResource(mAddressQuery);
@@ -77,26 +86,157 @@ void AddressResolver::Clear(void)
 {
     memset(&mCache, 0, sizeof(mCache));
 
-    for (uint8_t i = 0; i < kCacheEntries; i++)
+    mLruHead = kInvalidIndex;
+    mLruTail = kInvalidIndex;
+
+    for (uint16_t i = 0; i < kCacheEntries; i++)
+    {
+        mCache[i].mHashNext = kInvalidIndex;
+        AddToLruTail(mCache[i]);
+    }
+
+    for (uint16_t i = 0; i < kHashBuckets; i++)
     {
-        mCache[i].mAge = i;
+        mHashHeads[i] = kInvalidIndex;
     }
 }
 
 otError AddressResolver::GetEntry(uint8_t aIndex, otEidCacheEntry &aEntry) const
 {
-    otError error = OT_ERROR_NONE;
+    otError  error = OT_ERROR_NONE;
+    uint16_t age   = 0;
 
     VerifyOrExit(aIndex < kCacheEntries, error = OT_ERROR_INVALID_ARGS);
+
+    for (uint16_t index = mLruHead; index != aIndex; index = mCache[index].mLruNext)
+    {
+        age++;
+    }
+
     memcpy(&aEntry.mTarget, &mCache[aIndex].mTarget, sizeof(aEntry.mTarget));
     aEntry.mRloc16 = mCache[aIndex].mRloc16;
-    aEntry.mAge    = mCache[aIndex].mAge;
-    aEntry.mValid  = mCache[aIndex].mState == Cache::kStateCached;
+    aEntry.mAge    = (age < 0xff) ? static_cast<uint8_t>(age) : 0xff;
+    aEntry.mValid  = (mCache[aIndex].mState == Cache::kStateCached || mCache[aIndex].mState == Cache::kStateSnooped);
 
 exit:
     return error;
 }
 
+uint16_t AddressResolver::GetHashBucket(const Ip6::Address &aEid)
+{
+    uint16_t hash = 0;
+
+    for (uint8_t i = 0; i < sizeof(aEid.mFields.m16) / sizeof(aEid.mFields.m16[0]); i++)
+    {
+        hash ^= aEid.mFields.m16[i];
+    }
+
+    hash ^= (hash >> 8);
+
+    return hash & (kHashBuckets - 1);
+}
+
+AddressResolver::Cache *AddressResolver::FindCacheEntry(const Ip6::Address &aEid)
+{
+    Cache *rval = NULL;
+
+    for (uint16_t index = mHashHeads[GetHashBucket(aEid)]; index != kInvalidIndex; index = mCache[index].mHashNext)
+    {
+        if (mCache[index].mTarget == aEid)
+        {
+            rval = &mCache[index];
+            break;
+        }
+    }
+
+    return rval;
+}
+
+void AddressResolver::AddToHash(Cache &aEntry)
+{
+    uint16_t &head = mHashHeads[GetHashBucket(aEntry.mTarget)];
+
+    aEntry.mHashNext = head;
+    head             = GetCacheIndex(aEntry);
+}
+
+void AddressResolver::RemoveFromHash(Cache &aEntry)
+{
+    const uint16_t entryIndex = GetCacheIndex(aEntry);
+    uint16_t *     link       = &mHashHeads[GetHashBucket(aEntry.mTarget)];
+
+    while (*link != kInvalidIndex)
+    {
+        if (*link == entryIndex)
+        {
+            *link            = aEntry.mHashNext;
+            aEntry.mHashNext = kInvalidIndex;
+            break;
+        }
+
+        link = &mCache[*link].mHashNext;
+    }
+}
+
+void AddressResolver::RemoveFromLru(Cache &aEntry)
+{
+    if (aEntry.mLruPrev == kInvalidIndex)
+    {
+        mLruHead = aEntry.mLruNext;
+    }
+    else
+    {
+        mCache[aEntry.mLruPrev].mLruNext = aEntry.mLruNext;
+    }
+
+    if (aEntry.mLruNext == kInvalidIndex)
+    {
+        mLruTail = aEntry.mLruPrev;
+    }
+    else
+    {
+        mCache[aEntry.mLruNext].mLruPrev = aEntry.mLruPrev;
+    }
+}
+
+void AddressResolver::AddToLruHead(Cache &aEntry)
+{
+    const uint16_t entryIndex = GetCacheIndex(aEntry);
+
+    aEntry.mLruPrev = kInvalidIndex;
+    aEntry.mLruNext = mLruHead;
+
+    if (mLruHead == kInvalidIndex)
+    {
+        mLruTail = entryIndex;
+    }
+    else
+    {
+        mCache[mLruHead].mLruPrev = entryIndex;
+    }
+
+    mLruHead = entryIndex;
+}
+
+void AddressResolver::AddToLruTail(Cache &aEntry)
+{
+    const uint16_t entryIndex = GetCacheIndex(aEntry);
+
+    aEntry.mLruPrev = mLruTail;
+    aEntry.mLruNext = kInvalidIndex;
+
+    if (mLruTail == kInvalidIndex)
+    {
+        mLruHead = entryIndex;
+    }
+    else
+    {
+        mCache[mLruTail].mLruNext = entryIndex;
+    }
+
+    mLruTail = entryIndex;
+}
+
 void AddressResolver::Remove(uint8_t aRouterId)
 {
     for (int i = 0; i < kCacheEntries; i++)
@@ -123,21 +263,25 @@ AddressResolver::Cache *AddressResolver::NewCacheEntry(void)
 {
     Cache *rval = NULL;
 
-    for (int i = 0; i < kCacheEntries; i++)
+    // Invalid entries are kept at the tail, so this normally stops at the first entry.
+    for (uint16_t index = mLruTail; index != kInvalidIndex; index = mCache[index].mLruPrev)
     {
-        if (mCache[i].mState == Cache::kStateQuery && mCache[i].mFailures == 0)
+        if (mCache[index].mState == Cache::kStateQuery && mCache[index].mFailures == 0)
         {
             continue;
         }
 
-        if (rval == NULL || rval->mAge < mCache[i].mAge)
-        {
-            rval = &mCache[i];
-        }
+        rval = &mCache[index];
+        break;
     }
 
     if (rval != NULL)
     {
+        if (rval->mState != Cache::kStateInvalid)
+        {
+            mCounters.mEvictions++;
+        }
+
         InvalidateCacheEntry(*rval, kReasonEvictingForNewEntry);
     }
 
@@ -146,15 +290,8 @@ AddressResolver::Cache *AddressResolver::NewCacheEntry(void)
 
 void AddressResolver::MarkCacheEntryAsUsed(Cache &aEntry)
 {
-    for (int i = 0; i < kCacheEntries; i++)
-    {
-        if (mCache[i].mAge < aEntry.mAge)
-        {
-            mCache[i].mAge++;
-        }
-    }
-
-    aEntry.mAge = 0;
+    RemoveFromLru(aEntry);
+    AddToLruHead(aEntry);
 }
 
 const char *AddressResolver::ConvertInvalidationReasonToString(InvalidationReason aReason)
@@ -178,6 +315,10 @@ const char *AddressResolver::ConvertInvalidationReasonToString(InvalidationReaso
     case kReasonEvictingForNewEntry:
         str = "evicting for new entry";
         break;
+
+    case kReasonSnoopTimeout:
+        str = "snooped entry timed out";
+        break;
     }
 
     return str;
@@ -185,17 +326,18 @@ const char *AddressResolver::ConvertInvalidationReasonToString(InvalidationReaso
 
 void AddressResolver::InvalidateCacheEntry(Cache &aEntry, InvalidationReason aReason)
 {
-    for (int i = 0; i < kCacheEntries; i++)
+    if (aEntry.mState != Cache::kStateInvalid)
     {
-        if (mCache[i].mAge > aEntry.mAge)
-        {
-            mCache[i].mAge--;
-        }
+        RemoveFromHash(aEntry);
     }
 
+    RemoveFromLru(aEntry);
+    AddToLruTail(aEntry);
+
     switch (aEntry.mState)
     {
     case Cache::kStateCached:
+    case Cache::kStateSnooped:
         otLogNoteArp("Cache entry removed: %s, 0x%04x - %s", aEntry.mTarget.ToString().AsCString(), aEntry.mRloc16,
                      ConvertInvalidationReasonToString(aReason));
         break;
@@ -210,7 +352,6 @@ void AddressResolver::InvalidateCacheEntry(Cache &aEntry, InvalidationReason aRe
         break;
     }
 
-    aEntry.mAge   = kCacheEntries - 1;
     aEntry.mState = Cache::kStateInvalid;
 
     OT_UNUSED_VARIABLE(aReason);
@@ -218,56 +359,90 @@ void AddressResolver::InvalidateCacheEntry(Cache &aEntry, InvalidationReason aRe
 
 void AddressResolver::UpdateCacheEntry(const Ip6::Address &aEid, Mac::ShortAddress aRloc16)
 {
-    for (int i = 0; i < kCacheEntries; i++)
+    Cache *entry = FindCacheEntry(aEid);
+
+#if OPENTHREAD_CONFIG_ENABLE_ADDRESS_CACHE_SNOOPING
+    if (entry == NULL)
     {
-        if (mCache[i].mState == Cache::kStateInvalid || mCache[i].mTarget != aEid)
-        {
-            continue;
-        }
+        AddSnoopedCacheEntry(aEid, aRloc16);
+        ExitNow();
+    }
 
-        if (mCache[i].mRloc16 != aRloc16)
-        {
-            // not updating the age here is intentional because this cache entry is not actually being used
-            mCache[i].mRloc16 = aRloc16;
+    if (entry->mState == Cache::kStateSnooped)
+    {
+        // Traffic keeps confirming the mapping, so keep the entry from timing out.
+        entry->mRloc16  = aRloc16;
+        entry->mTimeout = kSnoopTimeout;
+        ExitNow();
+    }
+#endif
 
-            if (mCache[i].mState != Cache::kStateCached)
-            {
-                mCache[i].mRetryTimeout        = 0;
-                mCache[i].mLastTransactionTime = static_cast<uint32_t>(kLastTransactionTimeInvalid);
-                mCache[i].mTimeout             = 0;
-                mCache[i].mFailures            = 0;
-                mCache[i].mState               = Cache::kStateCached;
+    VerifyOrExit(entry != NULL && entry->mRloc16 != aRloc16);
 
-                GetNetif().GetMeshForwarder().HandleResolved(aEid, OT_ERROR_NONE);
-            }
+    // not updating the age here is intentional because this cache entry is not actually being used
+    entry->mRloc16 = aRloc16;
 
-            otLogNoteArp("Cache entry updated (snoop): %s, 0x%04x", aEid.ToString().AsCString(), aRloc16);
-        }
+    if (entry->mState != Cache::kStateCached)
+    {
+        entry->mRetryTimeout        = 0;
+        entry->mLastTransactionTime = static_cast<uint32_t>(kLastTransactionTimeInvalid);
+        entry->mTimeout             = 0;
+        entry->mFailures            = 0;
+        entry->mState               = Cache::kStateCached;
 
-        ExitNow();
+        GetNetif().GetMeshForwarder().HandleResolved(aEid, OT_ERROR_NONE);
     }
 
+#if OPENTHREAD_CONFIG_ENABLE_ADDRESS_CACHE_PERSISTENCE
+    ScheduleSave();
+#endif
+
+    otLogNoteArp("Cache entry updated (snoop): %s, 0x%04x", aEid.ToString().AsCString(), aRloc16);
+
 exit:
     return;
 }
 
-otError AddressResolver::Resolve(const Ip6::Address &aEid, uint16_t &aRloc16)
+#if OPENTHREAD_CONFIG_ENABLE_ADDRESS_CACHE_SNOOPING
+void AddressResolver::AddSnoopedCacheEntry(const Ip6::Address &aEid, Mac::ShortAddress aRloc16)
 {
-    otError error = OT_ERROR_NONE;
-    Cache * entry = NULL;
+    Cache *entry;
+
+    VerifyOrExit(!aEid.IsMulticast() && !aEid.IsLinkLocal() && !aEid.IsRoutingLocator() &&
+                 !aEid.IsAnycastRoutingLocator());
+    VerifyOrExit(aRloc16 != Mac::kShortAddrInvalid && aRloc16 != GetNetif().GetMac().GetShortAddress());
+
+    // Only take a free entry, so that snooping never evicts resolved or pending entries.
+    entry = &mCache[mLruTail];
+    VerifyOrExit(entry->mState == Cache::kStateInvalid);
+
+    entry->mTarget              = aEid;
+    entry->mRloc16              = aRloc16;
+    entry->mLastTransactionTime = static_cast<uint32_t>(kLastTransactionTimeInvalid);
+    entry->mRetryTimeout        = 0;
+    entry->mTimeout             = kSnoopTimeout;
+    entry->mFailures            = 0;
+    entry->mState               = Cache::kStateSnooped;
+    AddToHash(*entry);
+    MarkCacheEntryAsUsed(*entry);
 
-    for (int i = 0; i < kCacheEntries; i++)
+    if (mTimer.IsRunning() == false)
     {
-        if (mCache[i].mState != Cache::kStateInvalid)
-        {
-            if (mCache[i].mTarget == aEid)
-            {
-                entry = &mCache[i];
-                break;
-            }
-        }
+        mTimer.Start(kStateUpdatePeriod);
     }
 
+    otLogInfoArp("Cache entry added (snoop): %s, 0x%04x", aEid.ToString().AsCString(), aRloc16);
+
+exit:
+    return;
+}
+#endif // OPENTHREAD_CONFIG_ENABLE_ADDRESS_CACHE_SNOOPING
+
+otError AddressResolver::Resolve(const Ip6::Address &aEid, uint16_t &aRloc16)
+{
+    otError error = OT_ERROR_NONE;
+    Cache * entry = FindCacheEntry(aEid);
+
     if (entry == NULL)
     {
         entry = NewCacheEntry();
@@ -278,7 +453,7 @@ otError AddressResolver::Resolve(const Ip6::Address &aEid, uint16_t &aRloc16)
     switch (entry->mState)
     {
     case Cache::kStateInvalid:
-        SuccessOrExit(error = SendAddressQuery(aEid));
+        SuccessOrExit(error = RequestAddressQuery(*entry, aEid));
         entry->mTarget       = aEid;
         entry->mRloc16       = Mac::kShortAddrInvalid;
         entry->mTimeout      = kAddressQueryTimeout;
@@ -286,6 +461,7 @@ otError AddressResolver::Resolve(const Ip6::Address &aEid, uint16_t &aRloc16)
         entry->mRetryTimeout = kAddressQueryInitialRetryDelay;
         entry->mState        = Cache::kStateQuery;
         error                = OT_ERROR_ADDRESS_QUERY;
+        AddToHash(*entry);
         break;
 
     case Cache::kStateQuery:
@@ -295,7 +471,7 @@ otError AddressResolver::Resolve(const Ip6::Address &aEid, uint16_t &aRloc16)
         }
         else if (entry->mTimeout == 0 && entry->mRetryTimeout == 0)
         {
-            SuccessOrExit(error = SendAddressQuery(aEid));
+            SuccessOrExit(error = RequestAddressQuery(*entry, aEid));
             entry->mTimeout = kAddressQueryTimeout;
             error           = OT_ERROR_ADDRESS_QUERY;
         }
@@ -306,6 +482,16 @@ otError AddressResolver::Resolve(const Ip6::Address &aEid, uint16_t &aRloc16)
 
         break;
 
+    case Cache::kStateSnooped:
+        // The entry is now in use, keep it like a resolved entry.
+        entry->mTimeout = 0;
+        entry->mState   = Cache::kStateCached;
+#if OPENTHREAD_CONFIG_ENABLE_ADDRESS_CACHE_PERSISTENCE
+        ScheduleSave();
+#endif
+
+        // fall through
+
     case Cache::kStateCached:
         aRloc16 = entry->mRloc16;
         MarkCacheEntryAsUsed(*entry);
@@ -313,27 +499,172 @@ otError AddressResolver::Resolve(const Ip6::Address &aEid, uint16_t &aRloc16)
     }
 
 exit:
+
+    if (error == OT_ERROR_NONE)
+    {
+        mCounters.mHits++;
+    }
+    else
+    {
+        mCounters.mMisses++;
+    }
+
     return error;
 }
 
-otError AddressResolver::SendAddressQuery(const Ip6::Address &aEid)
+#if OPENTHREAD_CONFIG_ENABLE_ADDRESS_CACHE_PERSISTENCE
+static uint32_t GetSavedEntryHash(const Settings::AddressCacheEntry &aEntry)
 {
-    ThreadNetif &    netif = GetNetif();
-    otError          error;
-    Message *        message;
-    Coap::Header     header;
-    ThreadTargetTlv  targetTlv;
-    Ip6::MessageInfo messageInfo;
+    const uint8_t *bytes = reinterpret_cast<const uint8_t *>(&aEntry);
+    uint32_t       hash  = 0;
+
+    for (uint8_t i = 0; i < sizeof(aEntry); i++)
+    {
+        hash = hash * 31 + bytes[i];
+    }
+
+    return hash;
+}
+
+void AddressResolver::Restore(void)
+{
+    Settings::AddressCacheEntry entries[kMaxSavedEntries];
+    uint8_t                     numEntries;
+
+    SuccessOrExit(GetInstance().GetSettings().ReadAddressCache(entries, kMaxSavedEntries, numEntries));
+
+    mSavedHash = 0;
+
+    for (uint8_t i = 0; i < numEntries; i++)
+    {
+        mSavedHash += GetSavedEntryHash(entries[i]);
+    }
+
+    // Entries are saved from the most recently used one, so restore them in reverse order.
+    while (numEntries > 0)
+    {
+        const Settings::AddressCacheEntry &saved = entries[--numEntries];
+        Ip6::Address                       eid;
+        Cache *                            entry;
+
+        memcpy(eid.mFields.m8, saved.mTarget, sizeof(eid.mFields.m8));
+
+        if (FindCacheEntry(eid) != NULL)
+        {
+            continue;
+        }
+
+        entry = &mCache[mLruTail];
+        VerifyOrExit(entry->mState == Cache::kStateInvalid);
+
+        entry->mTarget              = eid;
+        entry->mRloc16              = saved.mRloc16;
+        entry->mLastTransactionTime = static_cast<uint32_t>(kLastTransactionTimeInvalid);
+        entry->mRetryTimeout        = 0;
+        entry->mFailures            = 0;
+        entry->mState               = Cache::kStateSnooped;
+#if OPENTHREAD_CONFIG_ENABLE_ADDRESS_CACHE_SNOOPING
+        // Restored entries that are not used are dropped like snooped ones.
+        entry->mTimeout = kSnoopTimeout;
+#else
+        entry->mTimeout = 0;
+#endif
+        AddToHash(*entry);
+        MarkCacheEntryAsUsed(*entry);
+
+        otLogInfoArp("Cache entry restored: %s, 0x%04x", eid.ToString().AsCString(), saved.mRloc16);
+    }
+
+exit:
+#if OPENTHREAD_CONFIG_ENABLE_ADDRESS_CACHE_SNOOPING
+    if (mTimer.IsRunning() == false)
+    {
+        mTimer.Start(kStateUpdatePeriod);
+    }
+#endif
+    return;
+}
+
+void AddressResolver::ScheduleSave(void)
+{
+    // Saving at most once per interval bounds the number of writes to non-volatile memory.
+    if (mSaveTimer.IsRunning() == false)
+    {
+        mSaveTimer.Start(kSaveInterval);
+    }
+}
+
+void AddressResolver::HandleSaveTimer(Timer &aTimer)
+{
+    aTimer.GetOwner<AddressResolver>().Save();
+}
+
+void AddressResolver::Save(void)
+{
+    Settings::AddressCacheEntry entries[kMaxSavedEntries];
+    uint8_t                     numEntries = 0;
+    uint32_t                    hash       = 0;
+
+    for (uint16_t index = mLruHead; index != kInvalidIndex && numEntries < kMaxSavedEntries;
+         index          = mCache[index].mLruNext)
+    {
+        if (mCache[index].mState != Cache::kStateCached)
+        {
+            continue;
+        }
+
+        memcpy(entries[numEntries].mTarget, mCache[index].mTarget.mFields.m8, sizeof(entries[numEntries].mTarget));
+        entries[numEntries].mRloc16 = mCache[index].mRloc16;
+        hash += GetSavedEntryHash(entries[numEntries]);
+        numEntries++;
+    }
+
+    // Skip the write if the same set of entries was saved last time.
+    VerifyOrExit(numEntries > 0 && hash != mSavedHash);
+
+    SuccessOrExit(GetInstance().GetSettings().SaveAddressCache(entries, numEntries));
+    mSavedHash = hash;
+
+exit:
+    return;
+}
+#endif // OPENTHREAD_CONFIG_ENABLE_ADDRESS_CACHE_PERSISTENCE
+
+otError AddressResolver::RequestAddressQuery(Cache &aEntry, const Ip6::Address &aEid)
+{
+#if OPENTHREAD_CONFIG_ENABLE_ADDRESS_QUERY_BATCHING
+    OT_UNUSED_VARIABLE(aEid);
+
+    aEntry.mQueryPending = true;
+
+    if (mBatchTimer.IsRunning() == false)
+    {
+        mBatchTimer.Start(kAddressQueryBatchWindow);
+    }
+
+    return OT_ERROR_NONE;
+#else
+    OT_UNUSED_VARIABLE(aEntry);
+
+    return SendAddressQuery(aEid);
+#endif
+}
+
+Message *AddressResolver::NewAddressQuery(void)
+{
+    Coap::Header header;
 
     header.Init(OT_COAP_TYPE_NON_CONFIRMABLE, OT_COAP_CODE_POST);
     header.AppendUriPathOptions(OT_URI_PATH_ADDRESS_QUERY);
     header.SetPayloadMarker();
 
-    VerifyOrExit((message = netif.GetCoap().NewMessage(header)) != NULL, error = OT_ERROR_NO_BUFS);
+    return GetNetif().GetCoap().NewMessage(header);
+}
 
-    targetTlv.Init();
-    targetTlv.SetTarget(aEid);
-    SuccessOrExit(error = message->Append(&targetTlv, sizeof(targetTlv)));
+otError AddressResolver::SendAddressQuery(Message &aMessage)
+{
+    ThreadNetif &    netif = GetNetif();
+    Ip6::MessageInfo messageInfo;
 
     messageInfo.GetPeerAddr().mFields.m16[0] = HostSwap16(0xff03);
     messageInfo.GetPeerAddr().mFields.m16[7] = HostSwap16(0x0002);
@@ -341,16 +672,96 @@ otError AddressResolver::SendAddressQuery(const Ip6::Address &aEid)
     messageInfo.SetPeerPort(kCoapUdpPort);
     messageInfo.SetInterfaceId(netif.GetInterfaceId());
 
-    SuccessOrExit(error = netif.GetCoap().SendMessage(*message, messageInfo));
+    if (mTimer.IsRunning() == false)
+    {
+        mTimer.Start(kStateUpdatePeriod);
+    }
 
-    otLogInfoArp("Sending address query for %s", aEid.ToString().AsCString());
+    return netif.GetCoap().SendMessage(aMessage, messageInfo);
+}
+
+#if OPENTHREAD_CONFIG_ENABLE_ADDRESS_QUERY_BATCHING
+void AddressResolver::HandleBatchTimer(Timer &aTimer)
+{
+    aTimer.GetOwner<AddressResolver>().SendBatchedAddressQuery();
+}
+
+void AddressResolver::SendBatchedAddressQuery(void)
+{
+    otError         error      = OT_ERROR_NONE;
+    Message *       message    = NULL;
+    uint8_t         numTargets = 0;
+    ThreadTargetTlv targetTlv;
+
+    for (int i = 0; i < kCacheEntries; i++)
+    {
+        if (!mCache[i].mQueryPending)
+        {
+            continue;
+        }
+
+        if (mCache[i].mState != Cache::kStateQuery)
+        {
+            mCache[i].mQueryPending = false;
+            continue;
+        }
+
+        if (numTargets == kMaxBatchTargets)
+        {
+            // Send the remaining targets in the next batch.
+            mBatchTimer.Start(kAddressQueryBatchWindow);
+            break;
+        }
+
+        if (message == NULL)
+        {
+            VerifyOrExit((message = NewAddressQuery()) != NULL, error = OT_ERROR_NO_BUFS);
+        }
+
+        targetTlv.Init();
+        targetTlv.SetTarget(mCache[i].mTarget);
+        SuccessOrExit(error = message->Append(&targetTlv, sizeof(targetTlv)));
+
+        mCache[i].mQueryPending = false;
+        numTargets++;
+
+        otLogInfoArp("Sending address query for %s", mCache[i].mTarget.ToString().AsCString());
+    }
+
+    VerifyOrExit(message != NULL);
+    SuccessOrExit(error = SendAddressQuery(*message));
 
 exit:
 
-    if (mTimer.IsRunning() == false)
+    if (error != OT_ERROR_NONE)
     {
-        mTimer.Start(kStateUpdatePeriod);
+        // The pending entries time out and are retried as if the query was lost.
+        otLogInfoArp("Failed to send batched address query, error:%s", otThreadErrorToString(error));
+
+        if (message != NULL)
+        {
+            message->Free();
+        }
     }
+}
+#else  // OPENTHREAD_CONFIG_ENABLE_ADDRESS_QUERY_BATCHING
+otError AddressResolver::SendAddressQuery(const Ip6::Address &aEid)
+{
+    otError         error;
+    Message *       message;
+    ThreadTargetTlv targetTlv;
+
+    VerifyOrExit((message = NewAddressQuery()) != NULL, error = OT_ERROR_NO_BUFS);
+
+    targetTlv.Init();
+    targetTlv.SetTarget(aEid);
+    SuccessOrExit(error = message->Append(&targetTlv, sizeof(targetTlv)));
+
+    SuccessOrExit(error = SendAddressQuery(*message));
+
+    otLogInfoArp("Sending address query for %s", aEid.ToString().AsCString());
+
+exit:
 
     if (error != OT_ERROR_NONE && message != NULL)
     {
@@ -359,6 +770,7 @@ exit:
 
     return error;
 }
+#endif // OPENTHREAD_CONFIG_ENABLE_ADDRESS_QUERY_BATCHING
 
 void AddressResolver::HandleAddressNotification(void *               aContext,
                                                 otCoapHeader *       aHeader,
@@ -380,6 +792,7 @@ void AddressResolver::HandleAddressNotification(Coap::Header &          aHeader,
     ThreadRloc16Tlv              rloc16Tlv;
     ThreadLastTransactionTimeTlv lastTransactionTimeTlv;
     uint32_t                     lastTransactionTime;
+    Cache *                      entry;
 
     VerifyOrExit(aHeader.GetType() == OT_COAP_TYPE_CONFIRMABLE && aHeader.GetCode() == OT_COAP_CODE_POST);
 
@@ -405,58 +818,45 @@ void AddressResolver::HandleAddressNotification(Coap::Header &          aHeader,
                  HostSwap16(aMessageInfo.GetPeerAddr().mFields.m16[7]), targetTlv.GetTarget().ToString().AsCString(),
                  rloc16Tlv.GetRloc16());
 
-    for (int i = 0; i < kCacheEntries; i++)
+    entry = FindCacheEntry(targetTlv.GetTarget());
+    VerifyOrExit(entry != NULL);
+
+    if (entry->mState == Cache::kStateCached && entry->mLastTransactionTime != kLastTransactionTimeInvalid)
     {
-        if (mCache[i].mTarget != targetTlv.GetTarget())
+        if (memcmp(entry->mMeshLocalIid, mlIidTlv.GetIid(), sizeof(entry->mMeshLocalIid)) != 0)
         {
-            continue;
+            SendAddressError(targetTlv, mlIidTlv, NULL);
+            ExitNow();
         }
 
-        switch (mCache[i].mState)
+        if (lastTransactionTime >= entry->mLastTransactionTime)
         {
-        case Cache::kStateInvalid:
-            break;
-
-        case Cache::kStateCached:
-            if (mCache[i].mLastTransactionTime != kLastTransactionTimeInvalid)
-            {
-                if (memcmp(mCache[i].mMeshLocalIid, mlIidTlv.GetIid(), sizeof(mCache[i].mMeshLocalIid)) != 0)
-                {
-                    SendAddressError(targetTlv, mlIidTlv, NULL);
-                    ExitNow();
-                }
-
-                if (lastTransactionTime >= mCache[i].mLastTransactionTime)
-                {
-                    ExitNow();
-                }
-            }
-
-            // fall through
-
-        case Cache::kStateQuery:
-            memcpy(mCache[i].mMeshLocalIid, mlIidTlv.GetIid(), sizeof(mCache[i].mMeshLocalIid));
-            mCache[i].mRloc16              = rloc16Tlv.GetRloc16();
-            mCache[i].mRetryTimeout        = 0;
-            mCache[i].mLastTransactionTime = lastTransactionTime;
-            mCache[i].mTimeout             = 0;
-            mCache[i].mFailures            = 0;
-            mCache[i].mState               = Cache::kStateCached;
-            MarkCacheEntryAsUsed(mCache[i]);
-
-            otLogNoteArp("Cache entry updated (notification): %s, 0x%04x, lastTrans:%d",
-                         targetTlv.GetTarget().ToString().AsCString(), rloc16Tlv.GetRloc16(), lastTransactionTime);
-
-            if (netif.GetCoap().SendEmptyAck(aHeader, aMessageInfo) == OT_ERROR_NONE)
-            {
-                otLogInfoArp("Sending address notification acknowledgment");
-            }
-
-            netif.GetMeshForwarder().HandleResolved(targetTlv.GetTarget(), OT_ERROR_NONE);
-            break;
+            ExitNow();
         }
     }
 
+    memcpy(entry->mMeshLocalIid, mlIidTlv.GetIid(), sizeof(entry->mMeshLocalIid));
+    entry->mRloc16              = rloc16Tlv.GetRloc16();
+    entry->mRetryTimeout        = 0;
+    entry->mLastTransactionTime = lastTransactionTime;
+    entry->mTimeout             = 0;
+    entry->mFailures            = 0;
+    entry->mState               = Cache::kStateCached;
+    MarkCacheEntryAsUsed(*entry);
+#if OPENTHREAD_CONFIG_ENABLE_ADDRESS_CACHE_PERSISTENCE
+    ScheduleSave();
+#endif
+
+    otLogNoteArp("Cache entry updated (notification): %s, 0x%04x, lastTrans:%d",
+                 targetTlv.GetTarget().ToString().AsCString(), rloc16Tlv.GetRloc16(), lastTransactionTime);
+
+    if (netif.GetCoap().SendEmptyAck(aHeader, aMessageInfo) == OT_ERROR_NONE)
+    {
+        otLogInfoArp("Sending address notification acknowledgment");
+    }
+
+    netif.GetMeshForwarder().HandleResolved(targetTlv.GetTarget(), OT_ERROR_NONE);
+
 exit:
     return;
 }
@@ -608,46 +1008,60 @@ void AddressResolver::HandleAddressQuery(void *               aContext,
 
 void AddressResolver::HandleAddressQuery(Coap::Header &aHeader, Message &aMessage, const Ip6::MessageInfo &aMessageInfo)
 {
-    ThreadNetif &                netif = GetNetif();
-    ThreadTargetTlv              targetTlv;
-    ThreadMeshLocalEidTlv        mlIidTlv;
-    ThreadLastTransactionTimeTlv lastTransactionTimeTlv;
+    ThreadTlv       tlv;
+    ThreadTargetTlv targetTlv;
+    uint16_t        offset = aMessage.GetOffset();
 
     VerifyOrExit(aHeader.GetType() == OT_COAP_TYPE_NON_CONFIRMABLE && aHeader.GetCode() == OT_COAP_CODE_POST);
 
-    SuccessOrExit(ThreadTlv::GetTlv(aMessage, ThreadTlv::kTarget, sizeof(targetTlv), targetTlv));
-    VerifyOrExit(targetTlv.IsValid());
+    // An Address Query may carry several Target TLVs, each of which is answered separately.
+    while (offset + sizeof(ThreadTlv) <= aMessage.GetLength())
+    {
+        aMessage.Read(offset, sizeof(tlv), &tlv);
+
+        if (tlv.GetType() == ThreadTlv::kTarget)
+        {
+            VerifyOrExit(aMessage.Read(offset, sizeof(targetTlv), &targetTlv) == sizeof(targetTlv));
+            VerifyOrExit(targetTlv.IsValid());
+
+            HandleAddressQueryTarget(targetTlv, aMessageInfo.GetPeerAddr());
+        }
+
+        offset += tlv.GetSize();
+    }
+
+exit:
+    return;
+}
+
+void AddressResolver::HandleAddressQueryTarget(const ThreadTargetTlv &aTargetTlv, const Ip6::Address &aRequester)
+{
+    ThreadNetif &                netif = GetNetif();
+    ThreadMeshLocalEidTlv        mlIidTlv;
+    ThreadLastTransactionTimeTlv lastTransactionTimeTlv;
+    Child *                      child;
 
     mlIidTlv.Init();
 
     lastTransactionTimeTlv.Init();
 
-    otLogInfoArp("Received address query from 0x%04x for target %s",
-                 HostSwap16(aMessageInfo.GetPeerAddr().mFields.m16[7]), targetTlv.GetTarget().ToString().AsCString());
+    otLogInfoArp("Received address query from 0x%04x for target %s", HostSwap16(aRequester.mFields.m16[7]),
+                 aTargetTlv.GetTarget().ToString().AsCString());
 
-    if (netif.IsUnicastAddress(targetTlv.GetTarget()))
+    if (netif.IsUnicastAddress(aTargetTlv.GetTarget()))
     {
         mlIidTlv.SetIid(netif.GetMle().GetMeshLocal64().GetIid());
-        SendAddressQueryResponse(targetTlv, mlIidTlv, NULL, aMessageInfo.GetPeerAddr());
+        SendAddressQueryResponse(aTargetTlv, mlIidTlv, NULL, aRequester);
         ExitNow();
     }
 
-    for (ChildTable::Iterator iter(GetInstance(), ChildTable::kInStateValid); !iter.IsDone(); iter++)
-    {
-        Child &child = *iter.GetChild();
-
-        if (child.IsFullThreadDevice() || child.GetLinkFailures() >= Mle::kFailedChildTransmissions)
-        {
-            continue;
-        }
+    child = GetInstance().Get<ChildTable>().FindChild(aTargetTlv.GetTarget(), ChildTable::kInStateValid);
 
-        if (child.HasIp6Address(GetInstance(), targetTlv.GetTarget()))
-        {
-            mlIidTlv.SetIid(child.GetExtAddress());
-            lastTransactionTimeTlv.SetTime(TimerMilli::GetNow() - child.GetLastHeard());
-            SendAddressQueryResponse(targetTlv, mlIidTlv, &lastTransactionTimeTlv, aMessageInfo.GetPeerAddr());
-            ExitNow();
-        }
+    if (child != NULL && !child->IsFullThreadDevice() && child->GetLinkFailures() < Mle::kFailedChildTransmissions)
+    {
+        mlIidTlv.SetIid(child->GetExtAddress());
+        lastTransactionTimeTlv.SetTime(TimerMilli::GetNow() - child->GetLastHeard());
+        SendAddressQueryResponse(aTargetTlv, mlIidTlv, &lastTransactionTimeTlv, aRequester);
     }
 
 exit:
@@ -711,6 +1125,22 @@ void AddressResolver::HandleTimer(void)
 
     for (int i = 0; i < kCacheEntries; i++)
     {
+#if OPENTHREAD_CONFIG_ENABLE_ADDRESS_CACHE_SNOOPING
+        if (mCache[i].mState == Cache::kStateSnooped)
+        {
+            if (--mCache[i].mTimeout == 0)
+            {
+                InvalidateCacheEntry(mCache[i], kReasonSnoopTimeout);
+            }
+            else
+            {
+                continueTimer = true;
+            }
+
+            continue;
+        }
+#endif
+
         if (mCache[i].mState != Cache::kStateQuery)
         {
             continue;
@@ -771,19 +1201,16 @@ void AddressResolver::HandleIcmpReceive(Message &               aMessage,
                                         const Ip6::IcmpHeader & aIcmpHeader)
 {
     Ip6::Header ip6Header;
+    Cache *     entry;
 
     VerifyOrExit(aIcmpHeader.GetType() == Ip6::IcmpHeader::kTypeDstUnreach);
     VerifyOrExit(aIcmpHeader.GetCode() == Ip6::IcmpHeader::kCodeDstUnreachNoRoute);
     VerifyOrExit(aMessage.Read(aMessage.GetOffset(), sizeof(ip6Header), &ip6Header) == sizeof(ip6Header));
 
-    for (int i = 0; i < kCacheEntries; i++)
-    {
-        if (mCache[i].mState != Cache::kStateInvalid && mCache[i].mTarget == ip6Header.GetDestination())
-        {
-            InvalidateCacheEntry(mCache[i], kReasonReceivedIcmpDstUnreachNoRoute);
-            break;
-        }
-    }
+    entry = FindCacheEntry(ip6Header.GetDestination());
+    VerifyOrExit(entry != NULL);
+
+    InvalidateCacheEntry(*entry, kReasonReceivedIcmpDstUnreachNoRoute);
 
 exit:
     OT_UNUSED_VARIABLE(aMessageInfo);
@@ -36,6 +36,10 @@
 
 #include "openthread-core-config.h"
 
+#include "utils/wrap_string.h"
+
+#include <openthread/thread_ftd.h>
+
 #include "coap/coap.hpp"
 #include "common/locator.hpp"
 #include "common/timer.hpp"
@@ -58,6 +62,9 @@ namespace ot {
 /**
  * This class implements the EID-to-RLOC mapping and caching.
  *
+ * Valid cache entries are indexed by a hash of their EID, and all entries are kept in a list ordered from the most to
+ * the least recently used one, so lookups and updates do not scale with the number of cache entries.
+ *
  */
 class AddressResolver : public InstanceLocator
 {
@@ -86,6 +93,20 @@ public:
      */
     otError GetEntry(uint8_t aIndex, otEidCacheEntry &aEntry) const;
 
+    /**
+     * This method returns the EID-to-RLOC cache counters.
+     *
+     * @returns A reference to the EID-to-RLOC cache counters.
+     *
+     */
+    const otEidCacheCounters &GetCounters(void) const { return mCounters; }
+
+    /**
+     * This method resets the EID-to-RLOC cache counters.
+     *
+     */
+    void ResetCounters(void) { memset(&mCounters, 0, sizeof(mCounters)); }
+
     /**
      * This method removes the EID-to-RLOC cache entries corresponding to an RLOC16.
      *
@@ -105,6 +126,9 @@ public:
     /**
      * This method updates an existing cache entry for the EID, if one exists.
      *
+     * When `OPENTHREAD_CONFIG_ENABLE_ADDRESS_CACHE_SNOOPING` is enabled and there is no entry for the EID, this method
+     * adds a provisional (snooped) entry if a free cache entry is available.
+     *
      * @param[in]  aEid     A reference to the EID.
      * @param[in]  aRloc16  The RLOC16 corresponding to @p aEid.
      *
@@ -125,11 +149,35 @@ public:
      */
     otError Resolve(const Ip6::Address &aEid, Mac::ShortAddress &aRloc16);
 
+#if OPENTHREAD_CONFIG_ENABLE_ADDRESS_CACHE_PERSISTENCE
+    /**
+     * This method restores the EID-to-RLOC cache entries saved in non-volatile settings.
+     *
+     * Restored entries are provisional: they are used to forward traffic right away and are removed by the usual
+     * Address Error and ICMP Destination Unreachable handling if they turn out to be stale.
+     *
+     */
+    void Restore(void);
+#endif
+
 private:
     enum
     {
         kCacheEntries      = OPENTHREAD_CONFIG_ADDRESS_CACHE_ENTRIES,
-        kStateUpdatePeriod = 1000u, ///< State update period in milliseconds.
+        kHashBuckets       = OPENTHREAD_CONFIG_ADDRESS_CACHE_HASH_BUCKETS,
+        kInvalidIndex      = 0xffff, ///< Marks the end of the LRU list or of a hash bucket chain.
+        kStateUpdatePeriod = 1000u,  ///< State update period in milliseconds.
+#if OPENTHREAD_CONFIG_ENABLE_ADDRESS_CACHE_SNOOPING
+        kSnoopTimeout      = OPENTHREAD_CONFIG_ADDRESS_CACHE_SNOOP_TIMEOUT, ///< Snooped entry timeout in seconds.
+#endif
+#if OPENTHREAD_CONFIG_ENABLE_ADDRESS_QUERY_BATCHING
+        kAddressQueryBatchWindow = OPENTHREAD_CONFIG_ADDRESS_QUERY_BATCH_WINDOW,      ///< Batch window in milliseconds.
+        kMaxBatchTargets         = OPENTHREAD_CONFIG_ADDRESS_QUERY_MAX_BATCH_TARGETS, ///< Targets per Address Query.
+#endif
+#if OPENTHREAD_CONFIG_ENABLE_ADDRESS_CACHE_PERSISTENCE
+        kSaveInterval    = OPENTHREAD_CONFIG_ADDRESS_CACHE_SAVE_INTERVAL * 1000u, ///< Save interval in milliseconds.
+        kMaxSavedEntries = OPENTHREAD_CONFIG_ADDRESS_CACHE_MAX_SAVED_ENTRIES,     ///< Number of entries saved.
+#endif
     };
 
     /**
@@ -155,6 +203,7 @@ private:
             kStateInvalid,
             kStateQuery,
             kStateCached,
+            kStateSnooped, ///< Provisional entry learned from received traffic.
         };
 
         Ip6::Address      mTarget;
@@ -164,8 +213,13 @@ private:
         uint16_t          mRetryTimeout;
         uint8_t           mTimeout;
         uint8_t           mFailures;
-        uint8_t           mAge;
+        uint16_t          mLruPrev;  ///< Index of the more recently used entry.
+        uint16_t          mLruNext;  ///< Index of the less recently used entry.
+        uint16_t          mHashNext; ///< Index of the next entry in the same hash bucket.
         State             mState;
+#if OPENTHREAD_CONFIG_ENABLE_ADDRESS_QUERY_BATCHING
+        bool mQueryPending; ///< Indicates the Address Query is waiting for the next batch.
+#endif
     };
 
     enum InvalidationReason
@@ -174,15 +228,35 @@ private:
         kReasonRemovingRloc16,
         kReasonReceivedIcmpDstUnreachNoRoute,
         kReasonEvictingForNewEntry,
+        kReasonSnoopTimeout,
     };
 
     static const char *ConvertInvalidationReasonToString(InvalidationReason aReason);
 
+    static uint16_t GetHashBucket(const Ip6::Address &aEid);
+    uint16_t        GetCacheIndex(const Cache &aEntry) const { return static_cast<uint16_t>(&aEntry - mCache); }
+
+    Cache *FindCacheEntry(const Ip6::Address &aEid);
     Cache *NewCacheEntry(void);
     void   MarkCacheEntryAsUsed(Cache &aEntry);
     void   InvalidateCacheEntry(Cache &aEntry, InvalidationReason aReason);
-
+    void   AddToHash(Cache &aEntry);
+    void   RemoveFromHash(Cache &aEntry);
+    void   RemoveFromLru(Cache &aEntry);
+    void   AddToLruHead(Cache &aEntry);
+    void   AddToLruTail(Cache &aEntry);
+#if OPENTHREAD_CONFIG_ENABLE_ADDRESS_CACHE_SNOOPING
+    void AddSnoopedCacheEntry(const Ip6::Address &aEid, Mac::ShortAddress aRloc16);
+#endif
+
+    otError  RequestAddressQuery(Cache &aEntry, const Ip6::Address &aEid);
+    Message *NewAddressQuery(void);
+    otError  SendAddressQuery(Message &aMessage);
+#if OPENTHREAD_CONFIG_ENABLE_ADDRESS_QUERY_BATCHING
+    void SendBatchedAddressQuery(void);
+#else
     otError SendAddressQuery(const Ip6::Address &aEid);
+#endif
     otError SendAddressError(const ThreadTargetTlv &      aTarget,
                              const ThreadMeshLocalEidTlv &aEid,
                              const Ip6::Address *         aDestination);
@@ -211,6 +285,8 @@ private:
                                           const otMessageInfo *aMessageInfo);
     void HandleAddressNotification(Coap::Header &aHeader, Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
 
+    void HandleAddressQueryTarget(const ThreadTargetTlv &aTargetTlv, const Ip6::Address &aRequester);
+
     static void HandleIcmpReceive(void *               aContext,
                                   otMessage *          aMessage,
                                   const otMessageInfo *aMessageInfo,
@@ -219,13 +295,33 @@ private:
 
     static void HandleTimer(Timer &aTimer);
     void        HandleTimer(void);
+#if OPENTHREAD_CONFIG_ENABLE_ADDRESS_QUERY_BATCHING
+    static void HandleBatchTimer(Timer &aTimer);
+#endif
+
+#if OPENTHREAD_CONFIG_ENABLE_ADDRESS_CACHE_PERSISTENCE
+    void        ScheduleSave(void);
+    static void HandleSaveTimer(Timer &aTimer);
+    void        Save(void);
+#endif
 
     Coap::Resource   mAddressError;
     Coap::Resource   mAddressQuery;
     Coap::Resource   mAddressNotification;
-    Cache            mCache[kCacheEntries];
-    Ip6::IcmpHandler mIcmpHandler;
-    TimerMilli       mTimer;
+    Cache              mCache[kCacheEntries];
+    uint16_t           mLruHead;
+    uint16_t           mLruTail;
+    uint16_t           mHashHeads[kHashBuckets];
+    otEidCacheCounters mCounters;
+    Ip6::IcmpHandler   mIcmpHandler;
+    TimerMilli         mTimer;
+#if OPENTHREAD_CONFIG_ENABLE_ADDRESS_QUERY_BATCHING
+    TimerMilli mBatchTimer;
+#endif
+#if OPENTHREAD_CONFIG_ENABLE_ADDRESS_CACHE_PERSISTENCE
+    TimerMilli mSaveTimer;
+    uint32_t   mSavedHash;
+#endif
 };
 
 /**
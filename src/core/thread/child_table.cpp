@@ -104,6 +104,19 @@ ChildTable::ChildTable(Instance &aInstance)
     , mMaxChildrenAllowed(kMaxChildren)
 {
     memset(mChildren, 0, sizeof(mChildren));
+    memset(mRloc16Index, 0, sizeof(mRloc16Index));
+    memset(mExtAddressIndex, 0, sizeof(mExtAddressIndex));
+#if OPENTHREAD_CONFIG_CHILD_ADDRESS_POOL_SIZE
+    memset(mAddressPool, 0, sizeof(mAddressPool));
+#endif
+}
+
+void ChildTable::Clear(void)
+{
+    memset(mChildren, 0, sizeof(mChildren));
+#if OPENTHREAD_CONFIG_CHILD_ADDRESS_POOL_SIZE
+    memset(mAddressPool, 0, sizeof(mAddressPool));
+#endif
 }
 
 Child *ChildTable::GetChildAtIndex(uint8_t aChildIndex)
@@ -125,6 +138,9 @@ Child *ChildTable::GetNewChild(void)
     {
         if (child->GetState() == Child::kStateInvalid)
         {
+#if OPENTHREAD_CONFIG_CHILD_ADDRESS_POOL_SIZE
+            ClearChildAddresses(GetChildIndex(*child));
+#endif
             memset(child, 0, sizeof(Child));
             ExitNow();
         }
@@ -138,12 +154,21 @@ exit:
 
 Child *ChildTable::FindChild(uint16_t aRloc16, StateFilter aFilter)
 {
-    Child *child = mChildren;
+    uint8_t &hint  = mRloc16Index[GetRloc16IndexSlot(aRloc16)];
+    Child *  child = &mChildren[hint];
+
+    if ((hint < mMaxChildrenAllowed) && MatchesFilter(*child, aFilter) && (child->GetRloc16() == aRloc16))
+    {
+        ExitNow();
+    }
+
+    child = mChildren;
 
     for (uint16_t num = mMaxChildrenAllowed; num != 0; num--, child++)
     {
         if (MatchesFilter(*child, aFilter) && (child->GetRloc16() == aRloc16))
         {
+            hint = GetChildIndex(*child);
             ExitNow();
         }
     }
@@ -156,12 +181,21 @@ exit:
 
 Child *ChildTable::FindChild(const Mac::ExtAddress &aAddress, StateFilter aFilter)
 {
-    Child *child = mChildren;
+    uint8_t &hint  = mExtAddressIndex[GetExtAddressIndexSlot(aAddress)];
+    Child *  child = &mChildren[hint];
+
+    if ((hint < mMaxChildrenAllowed) && MatchesFilter(*child, aFilter) && (child->GetExtAddress() == aAddress))
+    {
+        ExitNow();
+    }
+
+    child = mChildren;
 
     for (uint16_t num = mMaxChildrenAllowed; num != 0; num--, child++)
     {
         if (MatchesFilter(*child, aFilter) && (child->GetExtAddress() == aAddress))
         {
+            hint = GetChildIndex(*child);
             ExitNow();
         }
     }
@@ -193,6 +227,49 @@ Child *ChildTable::FindChild(const Mac::Address &aAddress, StateFilter aFilter)
     return child;
 }
 
+Child *ChildTable::FindChild(const Ip6::Address &aAddress, StateFilter aFilter)
+{
+    Child *child = mChildren;
+
+#if OPENTHREAD_CONFIG_CHILD_ADDRESS_POOL_SIZE
+    // Mesh-local addresses are kept in the child entries, all other addresses are looked up in the pool.
+    if (!GetInstance().GetThreadNetif().GetMle().IsMeshLocalAddress(aAddress))
+    {
+        uint16_t slot = GetAddressSlot(aAddress);
+
+        for (uint16_t num = kAddressPoolSize; num != 0; num--, slot = GetNextAddressSlot(slot))
+        {
+            const AddressEntry &entry = mAddressPool[slot];
+
+            VerifyOrExit(!entry.mAddress.IsUnspecified(), child = NULL);
+
+            child = &mChildren[entry.mChildIndex];
+
+            if ((entry.mChildIndex < mMaxChildrenAllowed) && (entry.mAddress == aAddress) &&
+                MatchesFilter(*child, aFilter))
+            {
+                ExitNow();
+            }
+        }
+
+        ExitNow(child = NULL);
+    }
+#endif
+
+    for (uint16_t num = mMaxChildrenAllowed; num != 0; num--, child++)
+    {
+        if (MatchesFilter(*child, aFilter) && child->HasIp6Address(GetInstance(), aAddress))
+        {
+            ExitNow();
+        }
+    }
+
+    child = NULL;
+
+exit:
+    return child;
+}
+
 bool ChildTable::HasChildren(StateFilter aFilter) const
 {
     bool         rval  = false;
@@ -239,6 +316,177 @@ exit:
     return error;
 }
 
+uint8_t ChildTable::GetExtAddressIndexSlot(const Mac::ExtAddress &aAddress)
+{
+    uint8_t hash = 0;
+
+    for (uint8_t i = 0; i < sizeof(aAddress.m8); i++)
+    {
+        hash ^= aAddress.m8[i];
+    }
+
+    return hash % kMaxChildren;
+}
+
+#if OPENTHREAD_CONFIG_CHILD_ADDRESS_POOL_SIZE
+
+otError ChildTable::AddChildAddress(uint8_t aChildIndex, const Ip6::Address &aAddress)
+{
+    otError  error = OT_ERROR_NO_BUFS;
+    uint16_t slot  = GetAddressSlot(aAddress);
+
+    for (uint16_t num = kAddressPoolSize; num != 0; num--, slot = GetNextAddressSlot(slot))
+    {
+        AddressEntry &entry = mAddressPool[slot];
+
+        if (entry.mAddress.IsUnspecified())
+        {
+            entry.mAddress    = aAddress;
+            entry.mChildIndex = aChildIndex;
+            ExitNow(error = OT_ERROR_NONE);
+        }
+
+        VerifyOrExit(entry.mChildIndex != aChildIndex || entry.mAddress != aAddress, error = OT_ERROR_ALREADY);
+    }
+
+exit:
+    return error;
+}
+
+otError ChildTable::RemoveChildAddress(uint8_t aChildIndex, const Ip6::Address &aAddress)
+{
+    otError  error     = OT_ERROR_NONE;
+    uint16_t poolIndex = FindChildAddress(aChildIndex, aAddress);
+
+    VerifyOrExit(poolIndex < kAddressPoolSize, error = OT_ERROR_NOT_FOUND);
+    RemoveAddressEntry(poolIndex);
+
+exit:
+    return error;
+}
+
+bool ChildTable::HasChildAddress(uint8_t aChildIndex, const Ip6::Address &aAddress) const
+{
+    return FindChildAddress(aChildIndex, aAddress) < kAddressPoolSize;
+}
+
+void ChildTable::ClearChildAddresses(uint8_t aChildIndex)
+{
+    uint16_t poolIndex = 0;
+
+    while (poolIndex < kAddressPoolSize)
+    {
+        const AddressEntry &entry = mAddressPool[poolIndex];
+
+        if (!entry.mAddress.IsUnspecified() && entry.mChildIndex == aChildIndex)
+        {
+            // Removing may move a later entry into this slot, so it is checked again.
+            RemoveAddressEntry(poolIndex);
+            continue;
+        }
+
+        poolIndex++;
+    }
+}
+
+otError ChildTable::GetNextChildAddress(uint8_t aChildIndex, uint16_t &aPoolIndex, Ip6::Address &aAddress) const
+{
+    otError error = OT_ERROR_NOT_FOUND;
+
+    for (; aPoolIndex < kAddressPoolSize; aPoolIndex++)
+    {
+        const AddressEntry &entry = mAddressPool[aPoolIndex];
+
+        if (!entry.mAddress.IsUnspecified() && entry.mChildIndex == aChildIndex)
+        {
+            aAddress = entry.mAddress;
+            aPoolIndex++;
+            ExitNow(error = OT_ERROR_NONE);
+        }
+    }
+
+exit:
+    return error;
+}
+
+uint16_t ChildTable::FindChildAddress(uint8_t aChildIndex, const Ip6::Address &aAddress) const
+{
+    uint16_t slot = GetAddressSlot(aAddress);
+
+    for (uint16_t num = kAddressPoolSize; num != 0; num--, slot = GetNextAddressSlot(slot))
+    {
+        const AddressEntry &entry = mAddressPool[slot];
+
+        VerifyOrExit(!entry.mAddress.IsUnspecified(), slot = kAddressPoolSize);
+
+        if (entry.mChildIndex == aChildIndex && entry.mAddress == aAddress)
+        {
+            ExitNow();
+        }
+    }
+
+    slot = kAddressPoolSize;
+
+exit:
+    return slot;
+}
+
+void ChildTable::RemoveAddressEntry(uint16_t aPoolIndex)
+{
+    uint16_t hole = aPoolIndex;
+    uint16_t next = aPoolIndex;
+
+    // Shift back the entries following the removed one (up to the next free entry) which would otherwise no longer be
+    // reachable from their home slot, so that lookups can stop at the first free entry.
+    while (true)
+    {
+        uint16_t home;
+        bool     move;
+
+        next = GetNextAddressSlot(next);
+
+        if (next == hole || mAddressPool[next].mAddress.IsUnspecified())
+        {
+            break;
+        }
+
+        home = GetAddressSlot(mAddressPool[next].mAddress);
+
+        // The entry may move into the hole unless its home slot lies cyclically within (hole, next].
+        if (hole <= next)
+        {
+            move = (home <= hole) || (home > next);
+        }
+        else
+        {
+            move = (home <= hole) && (home > next);
+        }
+
+        if (move)
+        {
+            mAddressPool[hole] = mAddressPool[next];
+            hole               = next;
+        }
+    }
+
+    mAddressPool[hole].mAddress.Clear();
+}
+
+uint16_t ChildTable::GetAddressSlot(const Ip6::Address &aAddress)
+{
+    const uint8_t *iid  = aAddress.GetIid();
+    uint16_t       hash = 0;
+
+    for (uint8_t i = 0; i < Ip6::Address::kInterfaceIdentifierSize; i++)
+    {
+        hash = static_cast<uint16_t>((hash << 5) - hash + iid[i]);
+    }
+
+    return hash % kAddressPoolSize;
+}
+
+#endif // OPENTHREAD_CONFIG_CHILD_ADDRESS_POOL_SIZE
+
 bool ChildTable::MatchesFilter(const Child &aChild, StateFilter aFilter)
 {
     bool rval = false;
@@ -268,6 +516,10 @@ bool ChildTable::MatchesFilter(const Child &aChild, StateFilter aFilter)
     case kInStateAnyExceptValidOrRestoring:
         rval = !aChild.IsStateValidOrRestoring();
         break;
+
+    case kInStateAttaching:
+        rval = (aChild.GetState() == Child::kStateParentRequest || aChild.GetState() == Child::kStateChildIdRequest);
+        break;
     }
 
     return rval;
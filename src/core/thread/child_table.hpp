@@ -49,6 +49,8 @@ namespace ot {
  */
 class ChildTable : public InstanceLocator
 {
+    friend class Child;
+
 public:
     /**
      * This enumeration defines child state filters used for finding a child or iterating through the child table.
@@ -64,6 +66,7 @@ public:
         kInStateValidOrAttaching,          ///< Accept child with `Child::IsStateValidOrAttaching()` being `true`.
         kInStateAnyExceptInvalid,          ///< Accept child in any state except `Child:kStateInvalid`.
         kInStateAnyExceptValidOrRestoring, ///< Accept child in any state except `Child::IsStateValidOrRestoring()`.
+        kInStateAttaching,                 ///< Accept child in `Child::kStateParentRequest` or `kStateChildIdRequest`.
     };
 
     /**
@@ -170,7 +173,7 @@ public:
      * This method clears the child table.
      *
      */
-    void Clear(void) { memset(mChildren, 0, sizeof(mChildren)); }
+    void Clear(void);
 
     /**
      * This method returns the child table index for a given `Child` instance.
@@ -237,6 +240,18 @@ public:
      */
     Child *FindChild(const Mac::Address &aAddress, StateFilter aFilter);
 
+    /**
+     * This method searches the child table for a `Child` which has registered a given IPv6 address and also matches a
+     * given state filter.
+     *
+     * @param[in]  aAddress A reference to an IPv6 address.
+     * @param[in]  aFilter  A child state filter.
+     *
+     * @returns  A pointer to the `Child` entry if one is found, or `NULL` otherwise.
+     *
+     */
+    Child *FindChild(const Ip6::Address &aAddress, StateFilter aFilter);
+
     /**
      * This method indicates whether the child table contains any child matching a given state filter.
      *
@@ -297,10 +312,52 @@ private:
         kMaxChildren = OPENTHREAD_CONFIG_MAX_CHILDREN,
     };
 
-    static bool MatchesFilter(const Child &aChild, StateFilter aFilter);
+    static bool    MatchesFilter(const Child &aChild, StateFilter aFilter);
+    static uint8_t GetRloc16IndexSlot(uint16_t aRloc16) { return (aRloc16 & Mle::kMaxChildId) % kMaxChildren; }
+    static uint8_t GetExtAddressIndexSlot(const Mac::ExtAddress &aAddress);
+
+#if OPENTHREAD_CONFIG_CHILD_ADDRESS_POOL_SIZE
+    enum
+    {
+        kAddressPoolSize = OPENTHREAD_CONFIG_CHILD_ADDRESS_POOL_SIZE,
+    };
+
+    /**
+     * This structure represents a child IPv6 address registration in the shared pool.
+     *
+     * The pool is an open-addressing hash table keyed by the address IID (linear probing), where an entry with the
+     * unspecified address is free.
+     *
+     */
+    struct AddressEntry
+    {
+        Ip6::Address mAddress;    ///< The registered IPv6 address.
+        uint8_t      mChildIndex; ///< The index of the child which registered the address.
+    };
+
+    otError  AddChildAddress(uint8_t aChildIndex, const Ip6::Address &aAddress);
+    otError  RemoveChildAddress(uint8_t aChildIndex, const Ip6::Address &aAddress);
+    bool     HasChildAddress(uint8_t aChildIndex, const Ip6::Address &aAddress) const;
+    void     ClearChildAddresses(uint8_t aChildIndex);
+    otError  GetNextChildAddress(uint8_t aChildIndex, uint16_t &aPoolIndex, Ip6::Address &aAddress) const;
+    uint16_t FindChildAddress(uint8_t aChildIndex, const Ip6::Address &aAddress) const;
+    void     RemoveAddressEntry(uint16_t aPoolIndex);
+
+    static uint16_t GetAddressSlot(const Ip6::Address &aAddress);
+    static uint16_t GetNextAddressSlot(uint16_t aSlot) { return (aSlot + 1 < kAddressPoolSize) ? aSlot + 1 : 0; }
+#endif
 
     uint8_t mMaxChildrenAllowed;
     Child   mChildren[kMaxChildren];
+
+    // Child index hints for `FindChild()`. A hint is only a starting guess and is always verified against the
+    // child entry, so it never needs to be updated when a child changes state, RLOC16 or extended address.
+    uint8_t mRloc16Index[kMaxChildren];
+    uint8_t mExtAddressIndex[kMaxChildren];
+
+#if OPENTHREAD_CONFIG_CHILD_ADDRESS_POOL_SIZE
+    AddressEntry mAddressPool[kAddressPoolSize];
+#endif
 };
 
 #endif // OPENTHREAD_FTD
@@ -346,6 +403,7 @@ public:
     Child *FindChild(uint16_t, StateFilter) { return NULL; }
     Child *FindChild(const Mac::ExtAddress &, StateFilter) { return NULL; }
     Child *FindChild(const Mac::Address &, StateFilter) { return NULL; }
+    Child *FindChild(const Ip6::Address &, StateFilter) { return NULL; }
 
     bool    HasChildren(StateFilter) const { return false; }
     uint8_t GetNumChildren(StateFilter) const { return 0; }
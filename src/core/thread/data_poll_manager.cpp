@@ -63,6 +63,10 @@ DataPollManager::DataPollManager(Instance &aInstance)
     , mPollTimeoutCounter(0)
     , mPollTxFailureCounter(0)
     , mRemainingFastPolls(0)
+#if OPENTHREAD_CONFIG_ENABLE_ADAPTIVE_DATA_POLL
+    , mAdaptiveBurst(false)
+    , mAdaptiveFastPolls(kDefaultFastPolls)
+#endif
 {
 }
 
@@ -90,6 +94,14 @@ void DataPollManager::StopPolling(void)
     mPollTxFailureCounter = 0;
     mRemainingFastPolls   = 0;
     mEnabled              = false;
+#if OPENTHREAD_CONFIG_ENABLE_ADAPTIVE_DATA_POLL
+    mAdaptiveBurst = false;
+#endif
+
+#if OPENTHREAD_CONFIG_ENABLE_CSL
+    // CSL receive windows are synchronized to data polls.
+    GetNetif().GetMac().StopCslSampling();
+#endif
 }
 
 otError DataPollManager::SendDataPoll(void)
@@ -200,6 +212,14 @@ void DataPollManager::HandlePollSent(otError aError)
     {
     case OT_ERROR_NONE:
 
+#if OPENTHREAD_CONFIG_ENABLE_ADAPTIVE_DATA_POLL
+        if (mAdaptiveBurst && mRemainingFastPolls == 0)
+        {
+            // A regular poll follows a burst during which nothing was received.
+            FinishAdaptiveBurst(false);
+        }
+#endif
+
         if (mRemainingFastPolls != 0)
         {
             mRemainingFastPolls--;
@@ -287,6 +307,13 @@ void DataPollManager::CheckFramePending(Mac::Frame &aFrame)
 
     mPollTimeoutCounter = 0;
 
+#if OPENTHREAD_CONFIG_ENABLE_ADAPTIVE_DATA_POLL
+    if (mAdaptiveBurst)
+    {
+        FinishAdaptiveBurst(true);
+    }
+#endif
+
     if (aFrame.GetFramePending() == true)
     {
         SendDataPoll();
@@ -321,6 +348,11 @@ void DataPollManager::SendFastPolls(uint8_t aNumFastPolls)
 {
     bool shouldRecalculatePollPeriod = (mRemainingFastPolls == 0);
 
+#if OPENTHREAD_CONFIG_ENABLE_ADAPTIVE_DATA_POLL
+    // Explicitly requested fast polls take over from an adaptive burst.
+    mAdaptiveBurst = false;
+#endif
+
     if (aNumFastPolls == 0)
     {
         aNumFastPolls = kDefaultFastPolls;
@@ -342,6 +374,58 @@ void DataPollManager::SendFastPolls(uint8_t aNumFastPolls)
     }
 }
 
+#if OPENTHREAD_CONFIG_ENABLE_ADAPTIVE_DATA_POLL
+void DataPollManager::HandleDataFrameSent(void)
+{
+    VerifyOrExit(mEnabled);
+
+    if (mAdaptiveBurst && mRemainingFastPolls == 0)
+    {
+        FinishAdaptiveBurst(false);
+    }
+
+    // Do not shorten or take over fast polls requested through `SendFastPolls()`.
+    VerifyOrExit(mAdaptiveBurst || mRemainingFastPolls == 0);
+
+    SendFastPolls(mAdaptiveFastPolls);
+    mAdaptiveBurst = true;
+
+exit:
+    return;
+}
+
+void DataPollManager::FinishAdaptiveBurst(bool aReceivedFrame)
+{
+    if (aReceivedFrame)
+    {
+        // Aim for one poll more than this burst needed, averaged with the previous length.
+        uint8_t needed = 1;
+
+        if (mRemainingFastPolls < mAdaptiveFastPolls)
+        {
+            needed += mAdaptiveFastPolls - mRemainingFastPolls;
+        }
+
+        needed             = static_cast<uint8_t>((mAdaptiveFastPolls + needed + 1) / 2);
+        mAdaptiveFastPolls = (needed < kMaxFastPolls) ? needed : static_cast<uint8_t>(kMaxFastPolls);
+
+        if (mRemainingFastPolls != 0)
+        {
+            mRemainingFastPolls = 0;
+            ScheduleNextPoll(kRecalculatePollPeriod);
+        }
+    }
+    else if (mAdaptiveFastPolls > kMinAdaptiveFastPolls)
+    {
+        mAdaptiveFastPolls /= 2;
+    }
+
+    mAdaptiveBurst = false;
+
+    otLogDebgMac("Adaptive data poll burst %s, next burst:%d", aReceivedFrame ? "hit" : "missed", mAdaptiveFastPolls);
+}
+#endif // OPENTHREAD_CONFIG_ENABLE_ADAPTIVE_DATA_POLL
+
 void DataPollManager::ScheduleNextPoll(PollPeriodSelector aPollPeriodSelector)
 {
     if (aPollPeriodSelector == kRecalculatePollPeriod)
@@ -349,15 +433,12 @@ void DataPollManager::ScheduleNextPoll(PollPeriodSelector aPollPeriodSelector)
         mPollPeriod = CalculatePollPeriod();
     }
 
-    if (mTimer.IsRunning())
-    {
-        mTimer.StartAt(mTimerStartTime, mPollPeriod);
-    }
-    else
+    if (!mTimer.IsRunning())
     {
         mTimerStartTime = TimerMilli::GetNow();
-        mTimer.StartAt(mTimerStartTime, mPollPeriod);
     }
+
+    mTimer.StartAtWithSlack(mTimerStartTime, mPollPeriod, kPollTimerSlack);
 }
 
 uint32_t DataPollManager::CalculatePollPeriod(void) const
@@ -184,6 +184,17 @@ public:
      */
     void SendFastPolls(uint8_t aNumFastPolls);
 
+#if OPENTHREAD_CONFIG_ENABLE_ADAPTIVE_DATA_POLL
+    /**
+     * This method informs the data poll manager that a data frame was sent to the parent.
+     *
+     * It starts a burst of fast polls, unless fast polls requested through `SendFastPolls()` are already in progress.
+     * The burst ends when a frame is received, and its length follows how many polls earlier bursts needed.
+     *
+     */
+    void HandleDataFrameSent(void);
+#endif
+
     /**
      * This method gets the maximum data polling period in use.
      *
@@ -200,6 +211,7 @@ private:
         kNoBufferRetxPollPeriod = 200,                                       ///< Poll retx due to no buffer space.
         kFastPollPeriod         = 188,                                       ///< Period used for fast polls.
         kMinPollPeriod          = OPENTHREAD_CONFIG_MINIMUM_POLL_PERIOD,     ///< Minimum allowed poll period.
+        kPollTimerSlack         = 16,                                        ///< Slack for poll timer.
     };
 
     enum
@@ -207,6 +219,7 @@ private:
         kQuickPollsAfterTimeout = 5, ///< Maximum number of quick data poll tx in case of back-to-back poll timeouts.
         kMaxPollRetxAttempts = OPENTHREAD_CONFIG_FAILED_CHILD_TRANSMISSIONS, ///< Maximum number of retransmit attempts
                                                                              ///< of data poll (mac data request).
+        kMinAdaptiveFastPolls = 1, ///< Minimum number of fast polls in an adaptive burst.
     };
 
     enum PollPeriodSelector
@@ -219,6 +232,9 @@ private:
     uint32_t    CalculatePollPeriod(void) const;
     static void HandlePollTimer(Timer &aTimer);
     uint32_t    GetDefaultPollPeriod(void) const;
+#if OPENTHREAD_CONFIG_ENABLE_ADAPTIVE_DATA_POLL
+    void FinishAdaptiveBurst(bool aReceivedFrame);
+#endif
 
     uint32_t mTimerStartTime;
     uint32_t mExternalPollPeriod;
@@ -233,6 +249,10 @@ private:
     uint8_t mPollTimeoutCounter : 4;   //< Poll timeouts counter (0 to `kQuickPollsAfterTimout`).
     uint8_t mPollTxFailureCounter : 4; //< Poll tx failure counter (0 to `kMaxPollRetxAttempts`).
     uint8_t mRemainingFastPolls : 4;   //< Number of remaining fast polls when in transient fast polling mode.
+#if OPENTHREAD_CONFIG_ENABLE_ADAPTIVE_DATA_POLL
+    bool    mAdaptiveBurst : 1;     //< Indicates whether the fast polls in progress follow a data frame tx.
+    uint8_t mAdaptiveFastPolls : 4; //< Number of fast polls to send after a data frame tx (adaptive polling).
+#endif
 };
 
 /**
@@ -34,6 +34,7 @@
 #include "key_manager.hpp"
 
 #include "common/code_utils.hpp"
+#include "common/debug.hpp"
 #include "common/instance.hpp"
 #include "common/owner-locator.hpp"
 #include "common/timer.hpp"
@@ -70,6 +71,8 @@ KeyManager::KeyManager(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mMasterKey(kDefaultMasterKey)
     , mKeySequence(0)
+    , mPreviousKeyValid(false)
+    , mNextKeyValid(false)
     , mMacFrameCounter(0)
     , mMleFrameCounter(0)
     , mStoredMacFrameCounter(0)
@@ -83,6 +86,10 @@ KeyManager::KeyManager(Instance &aInstance)
     , mSecurityPolicyFlags(0xff)
 {
     ComputeKey(mKeySequence, mKey);
+
+#if OPENTHREAD_CONFIG_ENABLE_KEY_SCHEDULE_CACHE
+    InvalidateKeySchedules();
+#endif
 }
 
 void KeyManager::Start(void)
@@ -127,10 +134,16 @@ otError KeyManager::SetMasterKey(const otMasterKey &aKey)
     VerifyOrExit(memcmp(&mMasterKey, &aKey, sizeof(mMasterKey)) != 0,
                  GetNotifier().SignalIfFirst(OT_CHANGED_MASTER_KEY));
 
-    mMasterKey   = aKey;
-    mKeySequence = 0;
+    mMasterKey        = aKey;
+    mKeySequence      = 0;
+    mPreviousKeyValid = false;
+    mNextKeyValid     = false;
     ComputeKey(mKeySequence, mKey);
 
+#if OPENTHREAD_CONFIG_ENABLE_KEY_SCHEDULE_CACHE
+    InvalidateKeySchedules();
+#endif
+
     // reset parent frame counters
     routers = mle.GetParent();
     routers->SetKeySequence(0);
@@ -189,8 +202,47 @@ void KeyManager::SetCurrentKeySequence(uint32_t aKeySequence)
         VerifyOrExit(mHoursSinceKeyRotation >= mKeySwitchGuardTime);
     }
 
+    // Shift the cached adjacent keys rather than recomputing them when moving to a neighboring key sequence.
+    if (aKeySequence == mKeySequence + 1)
+    {
+        memcpy(mPreviousKey, mKey, sizeof(mPreviousKey));
+        mPreviousKeyValid = true;
+
+        if (mNextKeyValid)
+        {
+            memcpy(mKey, mNextKey, sizeof(mKey));
+        }
+        else
+        {
+            ComputeKey(aKeySequence, mKey);
+        }
+
+        mNextKeyValid = false;
+    }
+    else if (aKeySequence == mKeySequence - 1)
+    {
+        memcpy(mNextKey, mKey, sizeof(mNextKey));
+        mNextKeyValid = true;
+
+        if (mPreviousKeyValid)
+        {
+            memcpy(mKey, mPreviousKey, sizeof(mKey));
+        }
+        else
+        {
+            ComputeKey(aKeySequence, mKey);
+        }
+
+        mPreviousKeyValid = false;
+    }
+    else
+    {
+        ComputeKey(aKeySequence, mKey);
+        mPreviousKeyValid = false;
+        mNextKeyValid     = false;
+    }
+
     mKeySequence = aKeySequence;
-    ComputeKey(mKeySequence, mKey);
 
     mMacFrameCounter = 0;
     mMleFrameCounter = 0;
@@ -207,25 +259,129 @@ exit:
     return;
 }
 
+const uint8_t *KeyManager::GetKey(uint32_t aKeySequence)
+{
+    const uint8_t *key;
+
+    if (aKeySequence == mKeySequence)
+    {
+        key = mKey;
+    }
+    else if (aKeySequence == mKeySequence - 1)
+    {
+        if (!mPreviousKeyValid)
+        {
+            ComputeKey(aKeySequence, mPreviousKey);
+            mPreviousKeyValid = true;
+        }
+
+        key = mPreviousKey;
+    }
+    else if (aKeySequence == mKeySequence + 1)
+    {
+        if (!mNextKeyValid)
+        {
+            ComputeKey(aKeySequence, mNextKey);
+            mNextKeyValid = true;
+        }
+
+        key = mNextKey;
+    }
+    else
+    {
+        ComputeKey(aKeySequence, mTemporaryKey);
+        key = mTemporaryKey;
+    }
+
+    return key;
+}
+
 const uint8_t *KeyManager::GetTemporaryMacKey(uint32_t aKeySequence)
 {
-    ComputeKey(aKeySequence, mTemporaryKey);
-    return mTemporaryKey + kMacKeyOffset;
+    return GetKey(aKeySequence) + kMacKeyOffset;
 }
 
 const uint8_t *KeyManager::GetTemporaryMleKey(uint32_t aKeySequence)
 {
-    ComputeKey(aKeySequence, mTemporaryKey);
-    return mTemporaryKey;
+    return GetKey(aKeySequence);
 }
 
+#if OPENTHREAD_CONFIG_ENABLE_KEY_SCHEDULE_CACHE
+
+void KeyManager::InvalidateKeySchedules(void)
+{
+    for (uint8_t i = 0; i < kNumKeySchedules; i++)
+    {
+        mKeySchedules[i].mValid = false;
+    }
+}
+
+KeyManager::KeySchedule &KeyManager::GetKeySchedule(uint32_t aKeySequence)
+{
+    KeySchedule *  schedule    = NULL;
+    uint32_t       maxDistance = 0;
+    const uint8_t *key;
+
+    for (uint8_t i = 0; i < kNumKeySchedules; i++)
+    {
+        KeySchedule &entry = mKeySchedules[i];
+        uint32_t     distance;
+
+        if (!entry.mValid)
+        {
+            schedule    = &entry;
+            maxDistance = 0xffffffff;
+            continue;
+        }
+
+        if (entry.mKeySequence == aKeySequence)
+        {
+            ExitNow(schedule = &entry);
+        }
+
+        // Replace the entry with the key sequence furthest away from the
+        // current one (the current key sequence itself is never replaced).
+
+        distance = entry.mKeySequence - mKeySequence;
+
+        if (distance > mKeySequence - entry.mKeySequence)
+        {
+            distance = mKeySequence - entry.mKeySequence;
+        }
+
+        if (distance > maxDistance)
+        {
+            schedule    = &entry;
+            maxDistance = distance;
+        }
+    }
+
+    assert(schedule != NULL);
+
+    key = GetKey(aKeySequence);
+
+    schedule->mMleKey.SetKey(key, 8 * kMaxKeyLength);
+    schedule->mMacKey.SetKey(key + kMacKeyOffset, 8 * kMaxKeyLength);
+    schedule->mKeySequence = aKeySequence;
+    schedule->mValid       = true;
+
+exit:
+    return *schedule;
+}
+
+#endif // OPENTHREAD_CONFIG_ENABLE_KEY_SCHEDULE_CACHE
+
 void KeyManager::IncrementMacFrameCounter(void)
 {
     mMacFrameCounter++;
 
     if (mMacFrameCounter >= mStoredMacFrameCounter)
     {
+#if OPENTHREAD_CONFIG_STORE_FRAME_COUNTERS_SEPARATELY
+        GetNetif().GetMle().StoreFrameCounters();
+#else
         GetNetif().GetMle().Store();
+#endif
     }
 }
 
@@ -235,7 +391,11 @@ void KeyManager::IncrementMleFrameCounter(void)
 
     if (mMleFrameCounter >= mStoredMleFrameCounter)
     {
+#if OPENTHREAD_CONFIG_STORE_FRAME_COUNTERS_SEPARATELY
+        GetNetif().GetMle().StoreFrameCounters();
+#else
         GetNetif().GetMle().Store();
+#endif
     }
 }
 
@@ -271,7 +431,7 @@ void KeyManager::SetSecurityPolicyFlags(uint8_t aSecurityPolicyFlags)
 void KeyManager::StartKeyRotationTimer(void)
 {
     mHoursSinceKeyRotation = 0;
-    mKeyRotationTimer.Start(kOneHourIntervalInMsec);
+    mKeyRotationTimer.StartWithSlack(kOneHourIntervalInMsec, kKeyRotationTimerSlack);
 }
 
 void KeyManager::HandleKeyRotationTimer(Timer &aTimer)
@@ -290,7 +450,7 @@ void KeyManager::HandleKeyRotationTimer(void)
     // rotation timer (and the `mHoursSinceKeyRotation`) if it updates the key
     // sequence.
 
-    mKeyRotationTimer.StartAt(mKeyRotationTimer.GetFireTime(), kOneHourIntervalInMsec);
+    mKeyRotationTimer.StartAtWithSlack(mKeyRotationTimer.GetFireTime(), kOneHourIntervalInMsec, kKeyRotationTimerSlack);
 
     if (mHoursSinceKeyRotation >= mKeyRotationTime)
     {
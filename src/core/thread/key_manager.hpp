@@ -42,6 +42,7 @@
 
 #include "common/locator.hpp"
 #include "common/timer.hpp"
+#include "crypto/aes_ecb.hpp"
 #include "crypto/hmac_sha256.hpp"
 
 namespace ot {
@@ -153,6 +154,9 @@ public:
     /**
      * This method returns a pointer to a temporary MAC key computed from the given key sequence.
      *
+     * The keys of the key sequences adjacent to the current one are cached, so they are only computed once per key
+     * sequence change.
+     *
      * @param[in]  aKeySequence  The key sequence value.
      *
      * @returns A pointer to the temporary MAC key.
@@ -163,6 +167,9 @@ public:
     /**
      * This method returns a pointer to a temporary MLE key computed from the given key sequence.
      *
+     * The keys of the key sequences adjacent to the current one are cached, so they are only computed once per key
+     * sequence change.
+     *
      * @param[in]  aKeySequence  The key sequence value.
      *
      * @returns A pointer to the temporary MLE key.
@@ -170,6 +177,31 @@ public:
      */
     const uint8_t *GetTemporaryMleKey(uint32_t aKeySequence);
 
+#if OPENTHREAD_CONFIG_ENABLE_KEY_SCHEDULE_CACHE
+    /**
+     * This method returns the expanded AES key schedule of the MAC key for the given key sequence.
+     *
+     * The key schedules of the most recently used key sequences (always including the current one) are kept, so the
+     * key derivation and AES key expansion only run when a key sequence is used for the first time.
+     *
+     * @param[in]  aKeySequence  The key sequence value.
+     *
+     * @returns A reference to the AES key schedule of the MAC key.
+     *
+     */
+    const Crypto::AesEcb &GetMacKeySchedule(uint32_t aKeySequence) { return GetKeySchedule(aKeySequence).mMacKey; }
+
+    /**
+     * This method returns the expanded AES key schedule of the MLE key for the given key sequence.
+     *
+     * @param[in]  aKeySequence  The key sequence value.
+     *
+     * @returns A reference to the AES key schedule of the MLE key.
+     *
+     */
+    const Crypto::AesEcb &GetMleKeySchedule(uint32_t aKeySequence) { return GetKeySchedule(aKeySequence).mMleKey; }
+#endif
+
     /**
      * This method returns the current MAC Frame Counter value.
      *
@@ -333,9 +365,29 @@ private:
         kDefaultKeySwitchGuardTime = 624,
         kMacKeyOffset              = 16,
         kOneHourIntervalInMsec     = 3600u * 1000u,
+        kKeyRotationTimerSlack     = 1000, // Allowed delay of key rotation timer to coalesce with other timers (in ms).
     };
 
-    otError ComputeKey(uint32_t aKeySequence, uint8_t *aKey);
+    otError        ComputeKey(uint32_t aKeySequence, uint8_t *aKey);
+    const uint8_t *GetKey(uint32_t aKeySequence);
+
+#if OPENTHREAD_CONFIG_ENABLE_KEY_SCHEDULE_CACHE
+    enum
+    {
+        kNumKeySchedules = 3, ///< Current, previous and next key sequence.
+    };
+
+    struct KeySchedule
+    {
+        uint32_t       mKeySequence;
+        bool           mValid;
+        Crypto::AesEcb mMleKey;
+        Crypto::AesEcb mMacKey;
+    };
+
+    KeySchedule &GetKeySchedule(uint32_t aKeySequence);
+    void         InvalidateKeySchedules(void);
+#endif
 
     void        StartKeyRotationTimer(void);
     static void HandleKeyRotationTimer(Timer &aTimer);
@@ -346,8 +398,18 @@ private:
     uint32_t mKeySequence;
     uint8_t  mKey[Crypto::HmacSha256::kHashSize];
 
+    // Keys of `mKeySequence - 1` and `mKeySequence + 1`, computed on first use.
+    uint8_t mPreviousKey[Crypto::HmacSha256::kHashSize];
+    uint8_t mNextKey[Crypto::HmacSha256::kHashSize];
+    bool    mPreviousKeyValid;
+    bool    mNextKeyValid;
+
     uint8_t mTemporaryKey[Crypto::HmacSha256::kHashSize];
 
+#if OPENTHREAD_CONFIG_ENABLE_KEY_SCHEDULE_CACHE
+    KeySchedule mKeySchedules[kNumKeySchedules];
+#endif
+
     uint32_t mMacFrameCounter;
     uint32_t mMleFrameCounter;
     uint32_t mStoredMacFrameCounter;
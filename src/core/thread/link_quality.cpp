@@ -152,6 +152,25 @@ void LinkQualityInfo::Clear(void)
 #endif
 }
 
+#if OPENTHREAD_CONFIG_ENABLE_TX_ERROR_RATE_TRACKING
+uint8_t LinkQualityInfo::GetAdaptiveFrameRetries(void) const
+{
+    uint16_t errorRate = GetFrameErrorRate();
+    uint8_t  retries   = OPENTHREAD_CONFIG_MAC_MAX_FRAME_RETRIES_DIRECT;
+
+    if (errorRate >= kAdaptiveRetriesHighErrorRate)
+    {
+        retries = OPENTHREAD_CONFIG_ADAPTIVE_FRAME_RETRIES_MIN;
+    }
+    else if (errorRate >= kAdaptiveRetriesLowErrorRate)
+    {
+        retries = OPENTHREAD_CONFIG_ADAPTIVE_FRAME_RETRIES_MAX;
+    }
+
+    return retries;
+}
+#endif
+
 void LinkQualityInfo::AddRss(int8_t aNoiseFloor, int8_t aRss)
 {
     uint8_t oldLinkQuality = kNoLinkQuality;
@@ -358,6 +358,18 @@ public:
      */
     uint16_t GetMessageErrorRate(void) const { return mMessageErrorRate.GetFailureRate(); }
 
+    /**
+     * This method returns the maximum number of MAC retries to use for a direct frame on the link.
+     *
+     * The number is derived from the frame tx error rate: the default `OPENTHREAD_CONFIG_MAC_MAX_FRAME_RETRIES_DIRECT`
+     * on a good link, `OPENTHREAD_CONFIG_ADAPTIVE_FRAME_RETRIES_MAX` on a link with moderate loss (where retries help)
+     * and `OPENTHREAD_CONFIG_ADAPTIVE_FRAME_RETRIES_MIN` on a link where most frames fail.
+     *
+     * @returns The maximum number of MAC retries.
+     *
+     */
+    uint8_t GetAdaptiveFrameRetries(void) const;
+
 #endif // OPENTHREAD_CONFIG_ENABLE_TX_ERROR_RATE_TRACKING
 
     /**
@@ -424,6 +436,14 @@ private:
         kNoLinkQuality = 0xff, // Used to indicate that there is no previous/last link quality.
     };
 
+#if OPENTHREAD_CONFIG_ENABLE_TX_ERROR_RATE_TRACKING
+    enum
+    {
+        kAdaptiveRetriesLowErrorRate  = SuccessRateTracker::kMaxRateValue / 10,     ///< 10% frame tx error rate.
+        kAdaptiveRetriesHighErrorRate = SuccessRateTracker::kMaxRateValue * 3 / 4, ///< 75% frame tx error rate.
+    };
+#endif
+
     void SetLinkQuality(uint8_t aLinkQuality) { mLinkQuality = aLinkQuality; }
 
     /* Static private method to calculate the link quality from a given link margin while taking into account the last
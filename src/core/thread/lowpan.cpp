@@ -50,7 +50,58 @@ namespace Lowpan {
 
 Lowpan::Lowpan(Instance &aInstance)
     : InstanceLocator(aInstance)
+    , mContextCacheGeneration(0)
+    , mContextCacheVersion(0)
+    , mContextCacheLength(0)
+    , mContextCacheNext(0)
 {
+    memset(&mContextCacheMeshLocalPrefix, 0, sizeof(mContextCacheMeshLocalPrefix));
+}
+
+otError Lowpan::GetContext(const Ip6::Address &aAddress, Context &aContext)
+{
+    NetworkData::Leader &    networkData     = GetNetif().GetNetworkDataLeader();
+    const otMeshLocalPrefix &meshLocalPrefix = GetNetif().GetMle().GetMeshLocalPrefix();
+    otError                  error;
+
+    // Any change to the Network Data (or Mesh Local Prefix) may change the contexts, and cached contexts may point
+    // into the Network Data, so flush the cache first. Context flags may be updated in place, with only the
+    // Network Data version changing.
+    if (mContextCacheVersion != networkData.GetVersion() ||
+        mContextCacheGeneration != networkData.GetContextGeneration() ||
+        memcmp(&mContextCacheMeshLocalPrefix, &meshLocalPrefix, sizeof(meshLocalPrefix)) != 0)
+    {
+        mContextCacheVersion         = networkData.GetVersion();
+        mContextCacheGeneration      = networkData.GetContextGeneration();
+        mContextCacheMeshLocalPrefix = meshLocalPrefix;
+        mContextCacheLength          = 0;
+        mContextCacheNext            = 0;
+    }
+
+    for (uint8_t i = 0; i < mContextCacheLength; i++)
+    {
+        if (mContextCache[i].mAddress == aAddress)
+        {
+            aContext = mContextCache[i].mContext;
+            ExitNow(error = mContextCache[i].mFound ? OT_ERROR_NONE : OT_ERROR_NOT_FOUND);
+        }
+    }
+
+    error = networkData.GetContext(aAddress, aContext);
+
+    mContextCache[mContextCacheNext].mAddress = aAddress;
+    mContextCache[mContextCacheNext].mContext = aContext;
+    mContextCache[mContextCacheNext].mFound   = (error == OT_ERROR_NONE);
+
+    if (mContextCacheLength < kContextCacheSize)
+    {
+        mContextCacheLength++;
+    }
+
+    mContextCacheNext = (mContextCacheNext + 1) % kContextCacheSize;
+
+exit:
+    return error;
 }
 
 otError Lowpan::CopyContext(const Context &aContext, Ip6::Address &aAddress)
@@ -244,24 +295,26 @@ int Lowpan::Compress(Message &aMessage, const Mac::Address &aMacSource, const Ma
     NetworkData::Leader &networkData = GetNetif().GetNetworkDataLeader();
     uint8_t *            cur         = aBuf;
     uint16_t             hcCtl       = 0;
-    Ip6::Header          ip6Header;
-    uint8_t *            ip6HeaderBytes = reinterpret_cast<uint8_t *>(&ip6Header);
+    Ip6::Header          ip6HeaderCopy;
+    const Ip6::Header *  ip6Header;
+    const uint8_t *      ip6HeaderBytes;
     Context              srcContext, dstContext;
     bool                 srcContextValid = true, dstContextValid = true;
     uint8_t              nextHeader;
     uint8_t              ecn  = 0;
     uint8_t              dscp = 0;
 
-    aMessage.Read(aMessage.GetOffset(), sizeof(ip6Header), &ip6Header);
+    ip6Header      = static_cast<const Ip6::Header *>(GetHeader(aMessage, sizeof(ip6HeaderCopy), &ip6HeaderCopy));
+    ip6HeaderBytes = reinterpret_cast<const uint8_t *>(ip6Header);
 
-    if (networkData.GetContext(ip6Header.GetSource(), srcContext) != OT_ERROR_NONE || srcContext.mCompressFlag == false)
+    if (GetContext(ip6Header->GetSource(), srcContext) != OT_ERROR_NONE ||
+        srcContext.mCompressFlag == false)
     {
         networkData.GetContext(0, srcContext);
         srcContextValid = false;
     }
 
-    if (networkData.GetContext(ip6Header.GetDestination(), dstContext) != OT_ERROR_NONE ||
-        dstContext.mCompressFlag == false)
+    if (GetContext(ip6Header->GetDestination(), dstContext) != OT_ERROR_NONE || dstContext.mCompressFlag == false)
     {
         networkData.GetContext(0, dstContext);
         dstContextValid = false;
@@ -319,7 +372,7 @@ int Lowpan::Compress(Message &aMessage, const Mac::Address &aMacSource, const Ma
     }
 
     // Next Header
-    switch (ip6Header.GetNextHeader())
+    switch (ip6Header->GetNextHeader())
     {
     case Ip6::kProtoHopOpts:
     case Ip6::kProtoUdp:
@@ -328,13 +381,13 @@ int Lowpan::Compress(Message &aMessage, const Mac::Address &aMacSource, const Ma
         break;
 
     default:
-        cur[0] = static_cast<uint8_t>(ip6Header.GetNextHeader());
+        cur[0] = static_cast<uint8_t>(ip6Header->GetNextHeader());
         cur++;
         break;
     }
 
     // Hop Limit
-    switch (ip6Header.GetHopLimit())
+    switch (ip6Header->GetHopLimit())
     {
     case 1:
         hcCtl |= kHcHopLimit1;
@@ -349,56 +402,56 @@ int Lowpan::Compress(Message &aMessage, const Mac::Address &aMacSource, const Ma
         break;
 
     default:
-        cur[0] = ip6Header.GetHopLimit();
+        cur[0] = ip6Header->GetHopLimit();
         cur++;
         break;
     }
 
     // Source Address
-    if (ip6Header.GetSource().IsUnspecified())
+    if (ip6Header->GetSource().IsUnspecified())
     {
         hcCtl |= kHcSrcAddrContext;
     }
-    else if (ip6Header.GetSource().IsLinkLocal())
+    else if (ip6Header->GetSource().IsLinkLocal())
     {
-        cur += CompressSourceIid(aMacSource, ip6Header.GetSource(), srcContext, hcCtl, cur);
+        cur += CompressSourceIid(aMacSource, ip6Header->GetSource(), srcContext, hcCtl, cur);
     }
     else if (srcContextValid)
     {
         hcCtl |= kHcSrcAddrContext;
-        cur += CompressSourceIid(aMacSource, ip6Header.GetSource(), srcContext, hcCtl, cur);
+        cur += CompressSourceIid(aMacSource, ip6Header->GetSource(), srcContext, hcCtl, cur);
     }
     else
     {
-        memcpy(cur, ip6Header.GetSource().mFields.m8, sizeof(ip6Header.GetSource()));
+        memcpy(cur, ip6Header->GetSource().mFields.m8, sizeof(ip6Header->GetSource()));
         cur += sizeof(Ip6::Address);
     }
 
     // Destination Address
-    if (ip6Header.GetDestination().IsMulticast())
+    if (ip6Header->GetDestination().IsMulticast())
     {
-        cur += CompressMulticast(ip6Header.GetDestination(), hcCtl, cur);
+        cur += CompressMulticast(ip6Header->GetDestination(), hcCtl, cur);
     }
-    else if (ip6Header.GetDestination().IsLinkLocal())
+    else if (ip6Header->GetDestination().IsLinkLocal())
     {
-        cur += CompressDestinationIid(aMacDest, ip6Header.GetDestination(), dstContext, hcCtl, cur);
+        cur += CompressDestinationIid(aMacDest, ip6Header->GetDestination(), dstContext, hcCtl, cur);
     }
     else if (dstContextValid)
     {
         hcCtl |= kHcDstAddrContext;
-        cur += CompressDestinationIid(aMacDest, ip6Header.GetDestination(), dstContext, hcCtl, cur);
+        cur += CompressDestinationIid(aMacDest, ip6Header->GetDestination(), dstContext, hcCtl, cur);
     }
     else
     {
-        memcpy(cur, &ip6Header.GetDestination(), sizeof(ip6Header.GetDestination()));
+        memcpy(cur, &ip6Header->GetDestination(), sizeof(ip6Header->GetDestination()));
         cur += sizeof(Ip6::Address);
     }
 
     aBuf[0] = hcCtl >> 8;
     aBuf[1] = hcCtl & 0xff;
-    aMessage.MoveOffset(sizeof(ip6Header));
+    aMessage.MoveOffset(sizeof(ip6HeaderCopy));
 
-    nextHeader = static_cast<uint8_t>(ip6Header.GetNextHeader());
+    nextHeader = static_cast<uint8_t>(ip6Header->GetNextHeader());
 
     while (1)
     {
@@ -432,19 +485,20 @@ exit:
 
 int Lowpan::CompressExtensionHeader(Message &aMessage, uint8_t *aBuf, uint8_t &aNextHeader)
 {
-    Ip6::ExtensionHeader extHeader;
-    Ip6::OptionHeader    optionHeader;
-    uint8_t *            cur = aBuf;
-    uint8_t              len;
-    uint8_t              padLength = 0;
-    uint16_t             offset;
+    Ip6::ExtensionHeader        extHeaderCopy;
+    const Ip6::ExtensionHeader *extHeader;
+    Ip6::OptionHeader           optionHeader;
+    uint8_t *                   cur = aBuf;
+    uint8_t                     len;
+    uint8_t                     padLength = 0;
+    uint16_t                    offset;
 
-    aMessage.Read(aMessage.GetOffset(), sizeof(extHeader), &extHeader);
-    aMessage.MoveOffset(sizeof(extHeader));
+    extHeader = static_cast<const Ip6::ExtensionHeader *>(GetHeader(aMessage, sizeof(extHeaderCopy), &extHeaderCopy));
+    aMessage.MoveOffset(sizeof(extHeaderCopy));
 
     cur[0] = kExtHdrDispatch | kExtHdrEidHbh;
 
-    switch (extHeader.GetNextHeader())
+    switch (extHeader->GetNextHeader())
     {
     case Ip6::kProtoUdp:
     case Ip6::kProtoIp6:
@@ -453,13 +507,13 @@ int Lowpan::CompressExtensionHeader(Message &aMessage, uint8_t *aBuf, uint8_t &a
 
     default:
         cur++;
-        cur[0] = static_cast<uint8_t>(extHeader.GetNextHeader());
+        cur[0] = static_cast<uint8_t>(extHeader->GetNextHeader());
         break;
     }
 
     cur++;
 
-    len = (extHeader.GetLength() + 1) * 8 - sizeof(extHeader);
+    len = (extHeader->GetLength() + 1) * 8 - sizeof(extHeaderCopy);
 
     // RFC 6282 says: "IPv6 Hop-by-Hop and Destination Options Headers may use a trailing
     // Pad1 or PadN to achieve 8-octet alignment. When there is a single trailing Pad1 or PadN
@@ -496,7 +550,7 @@ int Lowpan::CompressExtensionHeader(Message &aMessage, uint8_t *aBuf, uint8_t &a
         len -= padLength;
     }
 
-    aNextHeader = static_cast<uint8_t>(extHeader.GetNextHeader());
+    aNextHeader = static_cast<uint8_t>(extHeader->GetNextHeader());
 
     cur[0] = len;
     cur++;
@@ -510,15 +564,16 @@ int Lowpan::CompressExtensionHeader(Message &aMessage, uint8_t *aBuf, uint8_t &a
 
 int Lowpan::CompressUdp(Message &aMessage, uint8_t *aBuf)
 {
-    Ip6::UdpHeader udpHeader;
-    uint8_t *      cur    = aBuf;
-    uint8_t *      udpCtl = cur;
-    uint16_t       source;
-    uint16_t       destination;
+    Ip6::UdpHeader        udpHeaderCopy;
+    const Ip6::UdpHeader *udpHeader;
+    uint8_t *             cur    = aBuf;
+    uint8_t *             udpCtl = cur;
+    uint16_t              source;
+    uint16_t              destination;
 
-    aMessage.Read(aMessage.GetOffset(), sizeof(udpHeader), &udpHeader);
-    source      = udpHeader.GetSourcePort();
-    destination = udpHeader.GetDestinationPort();
+    udpHeader   = static_cast<const Ip6::UdpHeader *>(GetHeader(aMessage, sizeof(udpHeaderCopy), &udpHeaderCopy));
+    source      = udpHeader->GetSourcePort();
+    destination = udpHeader->GetDestinationPort();
 
     cur[0] = kUdpDispatch;
     cur++;
@@ -544,18 +599,39 @@ int Lowpan::CompressUdp(Message &aMessage, uint8_t *aBuf)
     }
     else
     {
-        memcpy(cur, &udpHeader, Ip6::UdpHeader::GetLengthOffset());
+        memcpy(cur, udpHeader, Ip6::UdpHeader::GetLengthOffset());
         cur += Ip6::UdpHeader::GetLengthOffset();
     }
 
-    memcpy(cur, reinterpret_cast<uint8_t *>(&udpHeader) + Ip6::UdpHeader::GetChecksumOffset(), 2);
+    memcpy(cur, reinterpret_cast<const uint8_t *>(udpHeader) + Ip6::UdpHeader::GetChecksumOffset(), 2);
     cur += 2;
 
-    aMessage.MoveOffset(sizeof(udpHeader));
+    aMessage.MoveOffset(sizeof(udpHeaderCopy));
 
     return static_cast<int>(cur - aBuf);
 }
 
+const void *Lowpan::GetHeader(const Message &aMessage, uint16_t aLength, void *aBuffer)
+{
+    const void *   header = aBuffer;
+    uint16_t       length = aLength;
+    Message::Chunk chunk;
+
+    // Reference the header in place when it lies within a single message buffer.
+    aMessage.GetFirstChunk(aMessage.GetOffset(), length, chunk);
+
+    if (chunk.mLength == aLength)
+    {
+        header = chunk.mData;
+    }
+    else
+    {
+        aMessage.Read(aMessage.GetOffset(), aLength, aBuffer);
+    }
+
+    return header;
+}
+
 otError Lowpan::DispatchToNextHeader(uint8_t aDispatch, Ip6::IpProto &aNextHeader)
 {
     otError error = OT_ERROR_NONE;
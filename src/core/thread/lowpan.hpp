@@ -216,6 +216,24 @@ private:
         kUdpPortMask     = 3 << 0,
     };
 
+    enum
+    {
+        kContextCacheSize = 4, ///< Number of recently compressed addresses whose contexts are cached.
+    };
+
+    /**
+     * This structure caches the 6LoWPAN Context found for an IPv6 address.
+     *
+     */
+    struct ContextCacheEntry
+    {
+        Ip6::Address mAddress; ///< The IPv6 address.
+        Context      mContext; ///< The Context for `mAddress`.
+        bool         mFound;   ///< Whether a Context was found for `mAddress`.
+    };
+
+    otError GetContext(const Ip6::Address &aAddress, Context &aContext);
+
     int CompressExtensionHeader(Message &aMessage, uint8_t *aBuf, uint8_t &aNextHeader);
     int CompressSourceIid(const Mac::Address &aMacAddr,
                           const Ip6::Address &aIpAddr,
@@ -234,8 +252,16 @@ private:
     int     DecompressUdpHeader(Message &aMessage, const uint8_t *aBuf, uint16_t aBufLength, uint16_t aDatagramLength);
     otError DispatchToNextHeader(uint8_t aDispatch, Ip6::IpProto &aNextHeader);
 
-    static otError CopyContext(const Context &aContext, Ip6::Address &aAddress);
-    static otError ComputeIid(const Mac::Address &aMacAddr, const Context &aContext, Ip6::Address &aIpAddress);
+    static const void *GetHeader(const Message &aMessage, uint16_t aLength, void *aBuffer);
+    static otError     CopyContext(const Context &aContext, Ip6::Address &aAddress);
+    static otError     ComputeIid(const Mac::Address &aMacAddr, const Context &aContext, Ip6::Address &aIpAddress);
+
+    ContextCacheEntry mContextCache[kContextCacheSize];
+    uint32_t          mContextCacheGeneration;
+    otMeshLocalPrefix mContextCacheMeshLocalPrefix;
+    uint8_t           mContextCacheVersion;
+    uint8_t           mContextCacheLength;
+    uint8_t           mContextCacheNext;
 };
 
 /**
@@ -69,8 +69,11 @@ MeshForwarder::MeshForwarder(Instance &aInstance)
     , mMeshDest()
     , mAddMeshHeader(false)
     , mSendBusy(false)
-    , mScheduleTransmissionTask(aInstance, ScheduleTransmissionTask, this)
+    , mScheduleTransmissionTask(aInstance, ScheduleTransmissionTask, this, Tasklet::kPriorityHigh)
     , mEnabled(false)
+#if OPENTHREAD_CONFIG_PREPARE_NEXT_FRAGMENT_DURING_TX
+    , mPrepareFrameTask(aInstance, HandlePrepareFrameTask, this)
+#endif
     , mScanChannels(0)
     , mScanChannel(0)
     , mMacRadioAcquisitionId(0)
@@ -82,6 +85,9 @@ MeshForwarder::MeshForwarder(Instance &aInstance)
     , mSendMessageKeyId(0)
     , mSendMessageDataSequenceNumber(0)
     , mIndirectStartingChild(NULL)
+#if OPENTHREAD_CONFIG_ENABLE_CSL
+    , mCslTimer(aInstance, &MeshForwarder::HandleCslTimer, this)
+#endif
 #endif
     , mDataPollManager(aInstance)
 {
@@ -91,6 +97,59 @@ MeshForwarder::MeshForwarder(Instance &aInstance)
     mIpCounters.mRxSuccess = 0;
     mIpCounters.mTxFailure = 0;
     mIpCounters.mRxFailure = 0;
+
+    mIpCounters.mRxReassemblyTimeout  = 0;
+    mIpCounters.mRxDuplicateFragments = 0;
+
+    mIpCounters.mTxExpired = 0;
+
+    ResetDropCounters();
+
+    for (uint8_t i = 0; i < Message::kNumPriorities; i++)
+    {
+        mIpCounters.mTxQueueDelayDrops[i] = 0;
+
+#if OPENTHREAD_CONFIG_ENABLE_SEND_QUEUE_AQM
+        mQueueDelayStates[i].mDropCount   = 0;
+        mQueueDelayStates[i].mAboveTarget = false;
+        mQueueDelayStates[i].mDropping    = false;
+#endif
+    }
+
+    for (uint8_t i = 0; i < kReassemblyMaxDatagrams; i++)
+    {
+        mReassemblyEntries[i].mMessage = NULL;
+        mReassemblyEntries[i].mNext    = kReassemblyInvalidIndex;
+        mReassemblyBuckets[i]          = kReassemblyInvalidIndex;
+    }
+
+#if OPENTHREAD_CONFIG_ENABLE_FAIR_QUEUEING
+    for (uint8_t i = 0; i < kFairQueueMaxFlows; i++)
+    {
+        mFairQueueFlows[i].mInUse = false;
+    }
+
+    mFairQueueVirtualTime = 0;
+#endif
+
+#if OPENTHREAD_CONFIG_ENABLE_MESSAGE_TRACE
+    ResetTraceHistograms();
+    mTraceTxStartPending = false;
+#endif
+
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_ENABLE_FRAGMENT_FORWARDING
+    for (uint8_t i = 0; i < kForwardMaxDatagrams; i++)
+    {
+        mForwardEntries[i].mDatagramSize = 0;
+    }
+#endif
+
+#if OPENTHREAD_CONFIG_PREPARE_NEXT_FRAGMENT_DURING_TX
+    mPreparedFrame.mMessage       = NULL;
+    mPreparedFrame.mFrame.mPsdu   = mPreparedFrame.mPsdu;
+    mPreparedFrame.mFrame.mLength = 0;
+    mPreparedFrame.mFrame.mIeInfo = NULL;
+#endif
 }
 
 otError MeshForwarder::Start(void)
@@ -128,11 +187,28 @@ otError MeshForwarder::Stop(void)
         message->Free();
     }
 
-    while ((message = mReassemblyList.GetHead()) != NULL)
+#if OPENTHREAD_FTD
+    for (ChildTable::Iterator iter(GetInstance(), ChildTable::kInStateAnyExceptInvalid); !iter.IsDone(); iter++)
     {
-        mReassemblyList.Dequeue(*message);
-        message->Free();
+        iter.GetChild()->SetFirstIndirectMessage(NULL);
+    }
+#endif
+
+    for (uint8_t i = 0; i < kReassemblyMaxDatagrams; i++)
+    {
+        if ((message = mReassemblyEntries[i].mMessage) != NULL)
+        {
+            RemoveReassemblyEntry(mReassemblyEntries[i]);
+            message->Free();
+        }
+    }
+
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_ENABLE_FRAGMENT_FORWARDING
+    for (uint8_t i = 0; i < kForwardMaxDatagrams; i++)
+    {
+        mForwardEntries[i].mDatagramSize = 0;
     }
+#endif
 
     mEnabled     = false;
     mSendMessage = NULL;
@@ -157,6 +233,7 @@ void MeshForwarder::RemoveMessage(Message &aMessage)
     }
 
     mSendQueue.Dequeue(aMessage);
+    mDropCounters.mTx[OT_IP6_DROP_REASON_EVICTED]++;
     LogMessage(kMessageEvict, aMessage, NULL, OT_ERROR_NO_BUFS);
     aMessage.Free();
 }
@@ -171,6 +248,9 @@ void MeshForwarder::ScheduleTransmissionTask(void)
     VerifyOrExit(mSendBusy == false);
 
     mSendMessageIsARetransmission = false;
+#if OPENTHREAD_CONFIG_ENABLE_MESSAGE_TRACE
+    mTraceTxStartPending = false;
+#endif
 
 #if OPENTHREAD_FTD
     if (GetIndirectTransmission() == OT_ERROR_NONE)
@@ -184,6 +264,11 @@ void MeshForwarder::ScheduleTransmissionTask(void)
         if (mSendMessage->GetOffset() == 0)
         {
             mSendMessage->SetTxSuccess(true);
+
+#if OPENTHREAD_CONFIG_ENABLE_MESSAGE_TRACE
+            mSendMessage->SetDequeueTime(TimerMilli::GetNow());
+            mTraceTxStartPending = true;
+#endif
         }
 
         mSendMessageMaxCsmaBackoffs = Mac::kMaxCsmaBackoffsDirect;
@@ -229,8 +314,183 @@ exit:
 
 Message *MeshForwarder::GetDirectTransmission(void)
 {
+    Message *message = SelectDirectTransmission();
+
+#if OPENTHREAD_CONFIG_ENABLE_SEND_QUEUE_AQM
+
+    while (message != NULL && ShouldDropForQueueDelay(*message))
+    {
+        mIpCounters.mTxQueueDelayDrops[message->GetPriority()]++;
+        mDropCounters.mTx[OT_IP6_DROP_REASON_QUEUE_DELAY]++;
+        LogMessage(kMessageDrop, *message, NULL, OT_ERROR_DROP);
+
+        // A message also pending for sleepy children continues to be sent to them.
+        message->ClearDirectTransmission();
+
+        if (!message->IsChildPending())
+        {
+            mSendQueue.Dequeue(*message);
+            message->Free();
+        }
+
+        message = SelectDirectTransmission();
+    }
+
+#endif
+
+    return message;
+}
+
+#if OPENTHREAD_CONFIG_ENABLE_SEND_QUEUE_AQM
+
+bool MeshForwarder::ShouldDropForQueueDelay(const Message &aMessage)
+{
+    QueueDelayState &state    = mQueueDelayStates[aMessage.GetPriority()];
+    uint32_t         now      = TimerMilli::GetNow();
+    bool             okToDrop = false;
+    bool             drop     = false;
+
+    // Only whole datagrams that have not been started yet may be dropped, and never network control messages.
+    VerifyOrExit(aMessage.GetOffset() == 0 && aMessage.GetPriority() != Message::kPriorityNet);
+    VerifyOrExit((aMessage.GetType() == Message::kTypeIp6 &&
+                  aMessage.GetSubType() != Message::kSubTypeMleDiscoverRequest) ||
+                 aMessage.GetType() == Message::kType6lowpan);
+
+    // The queue delay is not considered above target when no other message is waiting.
+    if (static_cast<int32_t>(now - aMessage.GetEnqueueTime()) < kQueueDelayTarget || aMessage.GetNext() == NULL)
+    {
+        state.mAboveTarget = false;
+    }
+    else if (!state.mAboveTarget)
+    {
+        state.mAboveTarget    = true;
+        state.mFirstAboveTime = now + kQueueDelayInterval;
+    }
+    else if (static_cast<int32_t>(now - state.mFirstAboveTime) >= 0)
+    {
+        okToDrop = true;
+    }
+
+    if (state.mDropping)
+    {
+        if (!okToDrop)
+        {
+            state.mDropping = false;
+        }
+        else if (static_cast<int32_t>(now - state.mDropNext) >= 0)
+        {
+            if (state.mDropCount < 0xffff)
+            {
+                state.mDropCount++;
+            }
+
+            state.mDropNext = GetQueueDelayDropNext(state.mDropNext, state.mDropCount);
+            drop            = true;
+        }
+    }
+    else if (okToDrop)
+    {
+        // Resume close to the previous drop rate when dropping stopped only recently.
+        if (state.mDropCount > 2 && static_cast<int32_t>(now - state.mDropNext) < 16 * kQueueDelayInterval)
+        {
+            state.mDropCount -= 2;
+        }
+        else
+        {
+            state.mDropCount = 1;
+        }
+
+        state.mDropNext = GetQueueDelayDropNext(now, state.mDropCount);
+        state.mDropping = true;
+        drop            = true;
+    }
+
+exit:
+    return drop;
+}
+
+uint32_t MeshForwarder::GetQueueDelayDropNext(uint32_t aTime, uint16_t aDropCount)
+{
+    uint32_t root = 1;
+
+    // The CoDel control law: the drop interval shrinks with the square root of the number of drops.
+    while ((root + 1) * (root + 1) <= aDropCount)
+    {
+        root++;
+    }
+
+    return aTime + kQueueDelayInterval / root;
+}
+
+#endif // OPENTHREAD_CONFIG_ENABLE_SEND_QUEUE_AQM
+
+#if OPENTHREAD_CONFIG_ENABLE_MESSAGE_TRACE
+
+void MeshForwarder::ResetTraceHistograms(void)
+{
+    memset(&mTraceHistograms, 0, sizeof(mTraceHistograms));
+}
+
+void MeshForwarder::RecordPathLatency(uint32_t aLatency)
+{
+    mTraceHistograms.mPathLatency[GetTraceBucket(aLatency)]++;
+}
+
+void MeshForwarder::RecordMessageTrace(const Message &aMessage)
+{
+    uint8_t priority = aMessage.GetPriority();
+
+    mTraceHistograms.mQueueing[priority][GetTraceBucket(aMessage.GetDequeueTime() - aMessage.GetEnqueueTime())]++;
+    mTraceHistograms.mAirtime[priority][GetTraceBucket(aMessage.GetTxDoneTime() - aMessage.GetTxStartTime())]++;
+}
+
+uint8_t MeshForwarder::GetTraceBucket(uint32_t aDelay)
+{
+    // Bucket `i` (except the last one) holds delays in [2^(i-1), 2^i) ms.
+    uint8_t bucket = 0;
+
+    for (; aDelay != 0 && bucket < OT_MESSAGE_TRACE_NUM_BUCKETS - 1; aDelay >>= 1)
+    {
+        bucket++;
+    }
+
+    return bucket;
+}
+
+#endif // OPENTHREAD_CONFIG_ENABLE_MESSAGE_TRACE
+
+void MeshForwarder::RemoveExpiredMessage(Message &aMessage)
+{
+    if (!aMessage.IsChildPending() && !aMessage.GetDirectTransmission())
+    {
+        if (mSendMessage == &aMessage)
+        {
+            mSendMessage = NULL;
+        }
+
+        mSendQueue.Dequeue(aMessage);
+        LogMessage(kMessageDrop, aMessage, NULL, OT_ERROR_DROP);
+        aMessage.Free();
+        mIpCounters.mTxExpired++;
+        mDropCounters.mTx[OT_IP6_DROP_REASON_EXPIRED]++;
+    }
+}
+
+Message *MeshForwarder::SelectDirectTransmission(void)
+{
+    uint32_t now = TimerMilli::GetNow();
     Message *curMessage, *nextMessage;
     otError  error = OT_ERROR_NONE;
+#if OPENTHREAD_CONFIG_ENABLE_FAIR_QUEUEING
+    Message *    selected              = NULL;
+    uint32_t     selectedStartTime     = 0;
+    uint16_t     selectedFlowKey       = 0;
+    uint16_t     selectedMeshSource    = 0;
+    uint16_t     selectedMeshDest      = 0;
+    bool         selectedAddMeshHeader = false;
+    Mac::Address selectedMacSource;
+    Mac::Address selectedMacDest;
+#endif
 
     for (curMessage = mSendQueue.GetHead(); curMessage; curMessage = nextMessage)
     {
@@ -241,6 +501,25 @@ Message *MeshForwarder::GetDirectTransmission(void)
             continue;
         }
 
+        // A datagram whose lifetime expired is discarded, unless its transmission has already started.
+        if (curMessage->GetOffset() == 0 && curMessage->IsExpired(now))
+        {
+            curMessage->ClearDirectTransmission();
+            RemoveExpiredMessage(*curMessage);
+            continue;
+        }
+
+#if OPENTHREAD_CONFIG_ENABLE_FAIR_QUEUEING
+
+        // Only the messages of the highest priority level with a routable message compete with each other. Messages
+        // that may not be reordered (and have side effects when prepared) end the competition.
+        if (selected != NULL && (curMessage->GetPriority() != selected->GetPriority() || !IsFairQueued(*curMessage)))
+        {
+            break;
+        }
+
+#endif
+
         switch (curMessage->GetType())
         {
         case Message::kTypeIp6:
@@ -273,6 +552,34 @@ Message *MeshForwarder::GetDirectTransmission(void)
         switch (error)
         {
         case OT_ERROR_NONE:
+#if OPENTHREAD_CONFIG_ENABLE_FAIR_QUEUEING
+            if (IsFairQueued(*curMessage))
+            {
+                uint16_t flowKey   = GetFairQueueFlowKey(*curMessage);
+                uint32_t startTime = GetFairQueueStartTime(flowKey);
+
+                if (selected == NULL || static_cast<int32_t>(startTime - selectedStartTime) < 0)
+                {
+                    selected              = curMessage;
+                    selectedStartTime     = startTime;
+                    selectedFlowKey       = flowKey;
+                    selectedMacSource     = mMacSource;
+                    selectedMacDest       = mMacDest;
+                    selectedMeshSource    = mMeshSource;
+                    selectedMeshDest      = mMeshDest;
+                    selectedAddMeshHeader = mAddMeshHeader;
+                }
+
+                // No flow can start earlier than the current virtual time.
+                if (selectedStartTime != mFairQueueVirtualTime)
+                {
+                    continue;
+                }
+
+                curMessage = NULL;
+                break;
+            }
+#endif
             ExitNow();
 
 #if OPENTHREAD_FTD
@@ -287,6 +594,7 @@ Message *MeshForwarder::GetDirectTransmission(void)
         case OT_ERROR_DROP:
         case OT_ERROR_NO_BUFS:
             mSendQueue.Dequeue(*curMessage);
+            mDropCounters.mTx[Ip6::Ip6::GetDropReason(error)]++;
             LogMessage(kMessageDrop, *curMessage, NULL, error);
             curMessage->Free();
             continue;
@@ -295,12 +603,176 @@ Message *MeshForwarder::GetDirectTransmission(void)
             assert(false);
             break;
         }
+
+#if OPENTHREAD_CONFIG_ENABLE_FAIR_QUEUEING
+        if (curMessage == NULL)
+        {
+            break;
+        }
+#endif
+    }
+
+#if OPENTHREAD_CONFIG_ENABLE_FAIR_QUEUEING
+
+    if (selected != NULL)
+    {
+        // Restore the route of the selected message, other candidates may have been evaluated after it.
+        mMacSource     = selectedMacSource;
+        mMacDest       = selectedMacDest;
+        mMeshSource    = selectedMeshSource;
+        mMeshDest      = selectedMeshDest;
+        mAddMeshHeader = selectedAddMeshHeader;
+
+        ChargeFairQueueFlow(selectedFlowKey, selected->GetLength());
+        curMessage = selected;
     }
 
+#endif
+
 exit:
     return curMessage;
 }
 
+#if OPENTHREAD_CONFIG_ENABLE_FAIR_QUEUEING
+
+bool MeshForwarder::IsFairQueued(const Message &aMessage)
+{
+    bool rval = false;
+
+    // A message being fragmented must be completed before another one is started.
+    VerifyOrExit(aMessage.GetOffset() == 0);
+
+    switch (aMessage.GetType())
+    {
+    case Message::kTypeIp6:
+        rval = (aMessage.GetSubType() != Message::kSubTypeMleDiscoverRequest);
+        break;
+
+    case Message::kType6lowpan:
+        rval = true;
+        break;
+
+    default:
+        break;
+    }
+
+exit:
+    return rval;
+}
+
+uint16_t MeshForwarder::UpdateFairQueueFlowKey(uint16_t aFlowKey, const void *aData, uint16_t aLength)
+{
+    const uint8_t *data = static_cast<const uint8_t *>(aData);
+
+    for (uint16_t i = 0; i < aLength; i++)
+    {
+        aFlowKey = static_cast<uint16_t>(aFlowKey * 31 + data[i]);
+    }
+
+    return aFlowKey;
+}
+
+uint16_t MeshForwarder::GetFairQueueFlowKey(const Message &aMessage)
+{
+    uint16_t          key = 0;
+    const PacketInfo *packetInfo;
+    Ip6::Header       ip6Header;
+    uint16_t          checksum;
+    uint16_t          sourcePort;
+    uint16_t          destPort;
+
+    // The flow key depends on the next hop selected by the last route update.
+    if (mMacDest.IsShort())
+    {
+        uint16_t shortAddress = mMacDest.GetShort();
+        key                   = UpdateFairQueueFlowKey(key, &shortAddress, sizeof(shortAddress));
+    }
+    else if (mMacDest.IsExtended())
+    {
+        key = UpdateFairQueueFlowKey(key, &mMacDest.GetExtended(), sizeof(Mac::ExtAddress));
+    }
+
+    VerifyOrExit(aMessage.GetType() == Message::kTypeIp6);
+
+    if ((packetInfo = aMessage.GetPacketInfo()) != NULL)
+    {
+        // The ports were already recorded by `Ip6`, so only the addresses need to be read.
+        VerifyOrExit(aMessage.Read(0, sizeof(ip6Header), &ip6Header) == sizeof(ip6Header));
+        sourcePort = packetInfo->mSourcePort;
+        destPort   = packetInfo->mDestinationPort;
+    }
+    else
+    {
+        SuccessOrExit(ParseIp6UdpTcpHeader(aMessage, ip6Header, checksum, sourcePort, destPort));
+    }
+
+    key = UpdateFairQueueFlowKey(key, &ip6Header.GetSource(), sizeof(Ip6::Address));
+    key = UpdateFairQueueFlowKey(key, &ip6Header.GetDestination(), sizeof(Ip6::Address));
+    key = UpdateFairQueueFlowKey(key, &sourcePort, sizeof(sourcePort));
+    key = UpdateFairQueueFlowKey(key, &destPort, sizeof(destPort));
+
+exit:
+    return key;
+}
+
+uint32_t MeshForwarder::GetFairQueueStartTime(uint16_t aFlowKey) const
+{
+    uint32_t startTime = mFairQueueVirtualTime;
+
+    for (uint8_t i = 0; i < kFairQueueMaxFlows; i++)
+    {
+        const FairQueueFlow &flow = mFairQueueFlows[i];
+
+        if (flow.mInUse && flow.mKey == aFlowKey)
+        {
+            // A flow that has been idle restarts at the current virtual time.
+            if (static_cast<int32_t>(flow.mServed - mFairQueueVirtualTime) > 0)
+            {
+                startTime = flow.mServed;
+            }
+
+            break;
+        }
+    }
+
+    return startTime;
+}
+
+void MeshForwarder::ChargeFairQueueFlow(uint16_t aFlowKey, uint16_t aLength)
+{
+    FairQueueFlow *flow = NULL;
+
+    for (uint8_t i = 0; i < kFairQueueMaxFlows; i++)
+    {
+        FairQueueFlow &entry = mFairQueueFlows[i];
+
+        if (entry.mInUse && entry.mKey == aFlowKey)
+        {
+            flow = &entry;
+            break;
+        }
+
+        // Otherwise replace a free entry, or the one that has been idle the longest.
+        if (flow == NULL ||
+            (flow->mInUse && (!entry.mInUse || static_cast<int32_t>(entry.mServed - flow->mServed) < 0)))
+        {
+            flow = &entry;
+        }
+    }
+
+    if (!flow->mInUse || flow->mKey != aFlowKey)
+    {
+        flow->mInUse  = true;
+        flow->mKey    = aFlowKey;
+        flow->mServed = mFairQueueVirtualTime;
+    }
+
+    mFairQueueVirtualTime = GetFairQueueStartTime(aFlowKey);
+    flow->mServed         = mFairQueueVirtualTime + aLength;
+}
+
+#endif // OPENTHREAD_CONFIG_ENABLE_FAIR_QUEUEING
+
 otError MeshForwarder::PrepareDataPoll(void)
 {
     otError      error  = OT_ERROR_NONE;
@@ -525,6 +997,14 @@ otError MeshForwarder::HandleFrameRequest(Mac::Frame &aFrame)
         ExitNow();
     }
 
+#if OPENTHREAD_CONFIG_ENABLE_MESSAGE_TRACE
+    if (mTraceTxStartPending)
+    {
+        mSendMessage->SetTxStartTime(TimerMilli::GetNow());
+        mTraceTxStartPending = false;
+    }
+#endif
+
     switch (mSendMessage->GetType())
     {
     case Message::kTypeIp6:
@@ -551,18 +1031,35 @@ otError MeshForwarder::HandleFrameRequest(Mac::Frame &aFrame)
             }
         }
 
-        error = SendFragment(*mSendMessage, aFrame);
-
-        // `SendFragment()` fails with `NotCapable` error if the message is MLE (with
-        // no link layer security) and also requires fragmentation.
-        if (error == OT_ERROR_NOT_CAPABLE)
+#if OPENTHREAD_CONFIG_PREPARE_NEXT_FRAGMENT_DURING_TX
+        if (UsePreparedFrame(*mSendMessage, aFrame))
+        {
+            error = OT_ERROR_NONE;
+        }
+        else
+#endif
         {
-            // Enable security and try again.
-            mSendMessage->SetLinkSecurityEnabled(true);
             error = SendFragment(*mSendMessage, aFrame);
+
+            // `SendFragment()` fails with `NotCapable` error if the message is MLE (with
+            // no link layer security) and also requires fragmentation.
+            if (error == OT_ERROR_NOT_CAPABLE)
+            {
+                // Enable security and try again.
+                mSendMessage->SetLinkSecurityEnabled(true);
+                error = SendFragment(*mSendMessage, aFrame);
+            }
         }
 
         assert(aFrame.GetLength() != 7);
+
+#if OPENTHREAD_CONFIG_PREPARE_NEXT_FRAGMENT_DURING_TX
+        if (mSendMessage->GetDirectTransmission() && (mMessageNextOffset < mSendMessage->GetLength()))
+        {
+            // Build the next fragment while this one is on the air.
+            mPrepareFrameTask.Post();
+        }
+#endif
         break;
 
     case Message::kTypeMacDataPoll:
@@ -589,6 +1086,21 @@ otError MeshForwarder::HandleFrameRequest(Mac::Frame &aFrame)
     aFrame.SetMaxCsmaBackoffs(mSendMessageMaxCsmaBackoffs);
     aFrame.SetMaxFrameRetries(mSendMessageMaxFrameRetries);
 
+#if OPENTHREAD_CONFIG_ENABLE_ADAPTIVE_FRAME_RETRIES
+    if ((mSendMessageMaxFrameRetries == Mac::kMaxFrameRetriesDirect) && aFrame.GetAckRequest())
+    {
+        Mac::Address macDest;
+        Neighbor *   neighbor;
+
+        aFrame.GetDstAddr(macDest);
+
+        if ((neighbor = netif.GetMle().GetNeighbor(macDest)) != NULL)
+        {
+            aFrame.SetMaxFrameRetries(neighbor->GetLinkInfo().GetAdaptiveFrameRetries());
+        }
+    }
+#endif
+
 #if OPENTHREAD_FTD
 
     {
@@ -631,6 +1143,83 @@ exit:
     return error;
 }
 
+#if OPENTHREAD_CONFIG_PREPARE_NEXT_FRAGMENT_DURING_TX
+
+void MeshForwarder::HandlePrepareFrameTask(Tasklet &aTasklet)
+{
+    aTasklet.GetOwner<MeshForwarder>().HandlePrepareFrameTask();
+}
+
+void MeshForwarder::HandlePrepareFrameTask(void)
+{
+    uint16_t offset     = mMessageNextOffset;
+    uint16_t nextOffset = mMessageNextOffset;
+    uint16_t messageOffset;
+
+    mPreparedFrame.mMessage = NULL;
+
+    VerifyOrExit(mEnabled && mSendBusy && (mSendMessage != NULL));
+    VerifyOrExit(mSendMessage->GetType() == Message::kTypeIp6 && mSendMessage->GetDirectTransmission());
+    VerifyOrExit(offset != 0 && offset < mSendMessage->GetLength());
+
+    // `SendFragment()` reads the fragment at the current message offset and
+    // updates `mMessageNextOffset`, so both are restored once the frame is
+    // built. The frame in flight is left untouched.
+
+    messageOffset = mSendMessage->GetOffset();
+    mSendMessage->SetOffset(offset);
+
+    SendFragment(*mSendMessage, mPreparedFrame.mFrame);
+
+    nextOffset = mMessageNextOffset;
+    mSendMessage->SetOffset(messageOffset);
+    mMessageNextOffset = offset;
+
+    mPreparedFrame.mMessage       = mSendMessage;
+    mPreparedFrame.mOffset        = offset;
+    mPreparedFrame.mNextOffset    = nextOffset;
+    mPreparedFrame.mDatagramTag   = mSendMessage->GetDatagramTag();
+    mPreparedFrame.mPanId         = GetNetif().GetMac().GetPanId();
+    mPreparedFrame.mMacSource     = mMacSource;
+    mPreparedFrame.mMacDest       = mMacDest;
+    mPreparedFrame.mMeshSource    = mMeshSource;
+    mPreparedFrame.mMeshDest      = mMeshDest;
+    mPreparedFrame.mAddMeshHeader = mAddMeshHeader;
+
+exit:
+    return;
+}
+
+bool MeshForwarder::UsePreparedFrame(const Message &aMessage, Mac::Frame &aFrame)
+{
+    bool rval = false;
+
+    // The prepared frame is only used if it was built from the same
+    // fragment of the same message towards the same link and mesh
+    // addresses, which makes it identical to what `SendFragment()`
+    // would produce now.
+
+    VerifyOrExit(mPreparedFrame.mMessage == &aMessage);
+    VerifyOrExit(mPreparedFrame.mOffset == aMessage.GetOffset() &&
+                 mPreparedFrame.mDatagramTag == aMessage.GetDatagramTag());
+    VerifyOrExit(mPreparedFrame.mPanId == GetNetif().GetMac().GetPanId());
+    VerifyOrExit(mPreparedFrame.mMacSource == mMacSource && mPreparedFrame.mMacDest == mMacDest);
+    VerifyOrExit(mPreparedFrame.mAddMeshHeader == mAddMeshHeader);
+    VerifyOrExit(!mAddMeshHeader ||
+                 (mPreparedFrame.mMeshSource == mMeshSource && mPreparedFrame.mMeshDest == mMeshDest));
+
+    memcpy(aFrame.GetPsdu(), mPreparedFrame.mFrame.GetPsdu(), mPreparedFrame.mFrame.GetPsduLength());
+    aFrame.SetPsduLength(mPreparedFrame.mFrame.GetPsduLength());
+    mMessageNextOffset = mPreparedFrame.mNextOffset;
+    rval               = true;
+
+exit:
+    mPreparedFrame.mMessage = NULL;
+    return rval;
+}
+
+#endif // OPENTHREAD_CONFIG_PREPARE_NEXT_FRAGMENT_DURING_TX
+
 otError MeshForwarder::SendPoll(Message &aMessage, Mac::Frame &aFrame)
 {
     ThreadNetif &netif = GetNetif();
@@ -811,39 +1400,9 @@ otError MeshForwarder::SendFragment(Message &aMessage, Mac::Frame &aFrame)
     if (mAddMeshHeader)
     {
         Lowpan::MeshHeader meshHeader;
-        uint8_t            hopsLeft;
-
-        if (netif.GetMle().GetRole() == OT_DEVICE_ROLE_CHILD)
-        {
-            // REED sets hopsLeft to max (16) + 1. It does not know the route cost.
-            hopsLeft = Mle::kMaxRouteCost + 1;
-        }
-        else
-        {
-            // Calculate the number of predicted hops.
-            hopsLeft = netif.GetMle().GetRouteCost(mMeshDest);
-
-            if (hopsLeft != Mle::kMaxRouteCost)
-            {
-                hopsLeft +=
-                    netif.GetMle().GetLinkCost(netif.GetMle().GetRouterId(netif.GetMle().GetNextHop(mMeshDest)));
-            }
-            else
-            {
-                // In case there is no route to the destination router (only link).
-                hopsLeft = netif.GetMle().GetLinkCost(netif.GetMle().GetRouterId(mMeshDest));
-            }
-        }
-
-        // The hopsLft field MUST be incremented by one if the destination RLOC16
-        // is not that of an active Router.
-        if (!netif.GetMle().IsActiveRouter(mMeshDest))
-        {
-            hopsLeft += 1;
-        }
 
         meshHeader.Init();
-        meshHeader.SetHopsLeft(hopsLeft + Lowpan::MeshHeader::kAdditionalHopsLeft);
+        meshHeader.SetHopsLeft(GetMeshHopsLeft(mMeshDest));
         meshHeader.SetSource(mMeshSource);
         meshHeader.SetDestination(mMeshDest);
         meshHeader.AppendTo(payload);
@@ -1094,11 +1653,20 @@ void MeshForwarder::HandleSentFrame(Mac::Frame &aFrame, otError aError)
 
             LogMessage(kMessageTransmit, *mSendMessage, &macDest, txError);
 
+#if OPENTHREAD_CONFIG_ENABLE_MESSAGE_TRACE
+            mSendMessage->SetTxDoneTime(TimerMilli::GetNow());
+            RecordMessageTrace(*mSendMessage);
+#endif
+
             if (mSendMessage->GetType() == Message::kTypeIp6)
             {
                 if (mSendMessage->GetTxSuccess())
                 {
                     mIpCounters.mTxSuccess++;
+
+#if OPENTHREAD_CONFIG_ENABLE_ADAPTIVE_DATA_POLL
+                    mDataPollManager.HandleDataFrameSent();
+#endif
                 }
                 else
                 {
@@ -1307,6 +1875,7 @@ void MeshForwarder::HandleFragment(uint8_t *               aFrame,
     ThreadNetif &          netif = GetNetif();
     otError                error = OT_ERROR_NONE;
     Lowpan::FragmentHeader fragmentHeader;
+    ReassemblyEntry *      entry;
     Message *              message = NULL;
     int                    headerLength;
 
@@ -1315,6 +1884,29 @@ void MeshForwarder::HandleFragment(uint8_t *               aFrame,
     aFrame += fragmentHeader.GetHeaderLength();
     aFrameLength -= fragmentHeader.GetHeaderLength();
 
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_ENABLE_FRAGMENT_FORWARDING
+    error = ForwardFragment(aFrame, aFrameLength, aMacSource, aMacDest, fragmentHeader, aLinkInfo);
+
+    // `OT_ERROR_NOT_FOUND` indicates the fragment is not forwarded and is handled by local reassembly.
+    if (error != OT_ERROR_NOT_FOUND)
+    {
+        ExitNow();
+    }
+
+    error = OT_ERROR_NONE;
+#endif
+
+    entry = FindReassemblyEntry(aMacSource, fragmentHeader.GetDatagramTag(), fragmentHeader.GetDatagramSize(),
+                                aLinkInfo.mLinkSecurity);
+
+    // Drop retransmissions of fragments that were already received (e.g. after a lost ack) without
+    // disturbing the datagram under reassembly.
+    if (entry != NULL && fragmentHeader.GetDatagramOffset() < entry->mMessage->GetOffset())
+    {
+        mIpCounters.mRxDuplicateFragments++;
+        ExitNow(error = OT_ERROR_DUPLICATED);
+    }
+
     if (fragmentHeader.GetDatagramOffset() == 0)
     {
         uint8_t priority;
@@ -1338,17 +1930,17 @@ void MeshForwarder::HandleFragment(uint8_t *               aFrame,
 
         VerifyOrExit(fragmentHeader.GetDatagramSize() >= message->GetOffset() + aFrameLength, error = OT_ERROR_PARSE);
 
+        SuccessOrExit(error = message->SetBufferClass(Message::kBufferClassReassembly));
         SuccessOrExit(error = message->SetLength(fragmentHeader.GetDatagramSize()));
 
         message->SetDatagramTag(fragmentHeader.GetDatagramTag());
-        message->SetTimeout(kReassemblyTimeout);
 
         // copy Fragment
         message->Write(message->GetOffset(), aFrameLength, aFrame);
         message->MoveOffset(aFrameLength);
 
         // Security Check
-        VerifyOrExit(netif.GetIp6Filter().Accept(*message), error = OT_ERROR_DROP);
+        VerifyOrExit(netif.GetIp6Filter().Accept(*message), error = OT_ERROR_SECURITY);
 
         // Allow re-assembly of only one message at a time on a SED by clearing
         // any remaining fragments in reassembly list upon receiving of a new
@@ -1359,26 +1951,15 @@ void MeshForwarder::HandleFragment(uint8_t *               aFrame,
             ClearReassemblyList();
         }
 
-        mReassemblyList.Enqueue(*message);
-
-        if (!mReassemblyTimer.IsRunning())
-        {
-            mReassemblyTimer.Start(kStateUpdatePeriod);
-        }
+        VerifyOrExit((entry = AddReassemblyEntry(*message, aMacSource)) != NULL, error = OT_ERROR_NO_BUFS);
     }
     else
     {
-        for (message = mReassemblyList.GetHead(); message; message = message->GetNext())
+        // Security Check: only consider reassembly buffers that had the same Security Enabled setting.
+        if (entry != NULL && entry->mMessage->GetOffset() == fragmentHeader.GetDatagramOffset() &&
+            entry->mMessage->GetOffset() + aFrameLength <= fragmentHeader.GetDatagramSize())
         {
-            // Security Check: only consider reassembly buffers that had the same Security Enabled setting.
-            if (message->GetLength() == fragmentHeader.GetDatagramSize() &&
-                message->GetDatagramTag() == fragmentHeader.GetDatagramTag() &&
-                message->GetOffset() == fragmentHeader.GetDatagramOffset() &&
-                message->GetOffset() + aFrameLength <= fragmentHeader.GetDatagramSize() &&
-                message->IsLinkSecurityEnabled() == aLinkInfo.mLinkSecurity)
-            {
-                break;
-            }
+            message = entry->mMessage;
         }
 
         // For a sleepy-end-device, if we receive a new (secure) next fragment
@@ -1407,14 +1988,16 @@ exit:
 
     if (error == OT_ERROR_NONE)
     {
-        if (message->GetOffset() >= message->GetLength())
+        if (message != NULL && message->GetOffset() >= message->GetLength())
         {
-            mReassemblyList.Dequeue(*message);
+            RemoveReassemblyEntry(*entry);
+            message->SetBufferClass(Message::kBufferClassDefault);
             HandleDatagram(*message, aLinkInfo, aMacSource);
         }
     }
     else
     {
+        mDropCounters.mRx[Ip6::Ip6::GetDropReason(error)]++;
         LogFragmentFrameDrop(error, aFrameLength, aMacSource, aMacDest, fragmentHeader, aLinkInfo.mLinkSecurity);
 
         if (message != NULL)
@@ -1424,16 +2007,126 @@ exit:
     }
 }
 
+uint8_t MeshForwarder::GetReassemblyBucket(const Mac::Address &aSource, uint16_t aDatagramTag)
+{
+    uint32_t hash = aDatagramTag;
+
+    if (aSource.IsShort())
+    {
+        hash = hash * 31 + aSource.GetShort();
+    }
+    else if (aSource.IsExtended())
+    {
+        for (uint8_t i = 0; i < sizeof(aSource.GetExtended().m8); i++)
+        {
+            hash = hash * 31 + aSource.GetExtended().m8[i];
+        }
+    }
+
+    return static_cast<uint8_t>(hash % kReassemblyMaxDatagrams);
+}
+
+MeshForwarder::ReassemblyEntry *MeshForwarder::FindReassemblyEntry(const Mac::Address &aSource,
+                                                                   uint16_t            aDatagramTag,
+                                                                   uint16_t            aDatagramSize,
+                                                                   bool                aLinkSecurity)
+{
+    ReassemblyEntry *entry = NULL;
+    uint8_t          index = mReassemblyBuckets[GetReassemblyBucket(aSource, aDatagramTag)];
+
+    for (; index != kReassemblyInvalidIndex; index = mReassemblyEntries[index].mNext)
+    {
+        ReassemblyEntry &cur = mReassemblyEntries[index];
+
+        if (cur.mDatagramTag != aDatagramTag || cur.mSource.GetType() != aSource.GetType() ||
+            cur.mMessage->GetLength() != aDatagramSize || cur.mMessage->IsLinkSecurityEnabled() != aLinkSecurity)
+        {
+            continue;
+        }
+
+        if ((aSource.IsShort() && cur.mSource.GetShort() == aSource.GetShort()) ||
+            (aSource.IsExtended() && cur.mSource.GetExtended() == aSource.GetExtended()) || aSource.IsNone())
+        {
+            ExitNow(entry = &cur);
+        }
+    }
+
+exit:
+    return entry;
+}
+
+MeshForwarder::ReassemblyEntry *MeshForwarder::AddReassemblyEntry(Message &aMessage, const Mac::Address &aSource)
+{
+    ReassemblyEntry *entry = NULL;
+    uint8_t          bucket;
+
+    for (uint8_t i = 0; i < kReassemblyMaxDatagrams; i++)
+    {
+        if (mReassemblyEntries[i].mMessage != NULL)
+        {
+            continue;
+        }
+
+        bucket = GetReassemblyBucket(aSource, aMessage.GetDatagramTag());
+        entry  = &mReassemblyEntries[i];
+
+        entry->mMessage            = &aMessage;
+        entry->mSource             = aSource;
+        entry->mStartTime          = TimerMilli::GetNow();
+        entry->mDatagramTag        = aMessage.GetDatagramTag();
+        entry->mNext               = mReassemblyBuckets[bucket];
+        mReassemblyBuckets[bucket] = i;
+
+        mReassemblyList.Enqueue(aMessage);
+
+        if (!mReassemblyTimer.IsRunning())
+        {
+            mReassemblyTimer.Start(TimerMilli::SecToMsec(kReassemblyTimeout));
+        }
+
+        ExitNow();
+    }
+
+exit:
+    return entry;
+}
+
+void MeshForwarder::RemoveReassemblyEntry(ReassemblyEntry &aEntry)
+{
+    uint8_t  index = static_cast<uint8_t>(&aEntry - mReassemblyEntries);
+    uint8_t *link  = &mReassemblyBuckets[GetReassemblyBucket(aEntry.mSource, aEntry.mDatagramTag)];
+
+    while (*link != kReassemblyInvalidIndex)
+    {
+        if (*link == index)
+        {
+            *link = aEntry.mNext;
+            break;
+        }
+
+        link = &mReassemblyEntries[*link].mNext;
+    }
+
+    mReassemblyList.Dequeue(*aEntry.mMessage);
+
+    aEntry.mMessage = NULL;
+    aEntry.mNext    = kReassemblyInvalidIndex;
+}
+
 void MeshForwarder::ClearReassemblyList(void)
 {
     Message *message;
-    Message *next;
 
-    for (message = mReassemblyList.GetHead(); message; message = next)
+    for (uint8_t i = 0; i < kReassemblyMaxDatagrams; i++)
     {
-        next = message->GetNext();
-        mReassemblyList.Dequeue(*message);
+        if ((message = mReassemblyEntries[i].mMessage) == NULL)
+        {
+            continue;
+        }
+
+        RemoveReassemblyEntry(mReassemblyEntries[i]);
 
+        mDropCounters.mRx[OT_IP6_DROP_REASON_REASSEMBLY]++;
         LogMessage(kMessageReassemblyDrop, *message, NULL, OT_ERROR_NO_FRAME_RECEIVED);
 
         if (message->GetType() == Message::kTypeIp6)
@@ -1452,36 +2145,57 @@ void MeshForwarder::HandleReassemblyTimer(Timer &aTimer)
 
 void MeshForwarder::HandleReassemblyTimer(void)
 {
-    Message *next = NULL;
-    uint8_t  timeout;
+    uint32_t now       = TimerMilli::GetNow();
+    uint32_t timeout   = TimerMilli::SecToMsec(kReassemblyTimeout);
+    uint32_t nextDelay = timeout + 1;
+    uint32_t elapsed;
+    Message *message;
 
-    for (Message *message = mReassemblyList.GetHead(); message; message = next)
+    for (uint8_t i = 0; i < kReassemblyMaxDatagrams; i++)
     {
-        next    = message->GetNext();
-        timeout = message->GetTimeout();
-
-        if (timeout > 0)
+        if ((message = mReassemblyEntries[i].mMessage) == NULL)
         {
-            message->SetTimeout(timeout - 1);
+            continue;
         }
-        else
-        {
-            mReassemblyList.Dequeue(*message);
 
-            LogMessage(kMessageReassemblyDrop, *message, NULL, OT_ERROR_REASSEMBLY_TIMEOUT);
+        elapsed = now - mReassemblyEntries[i].mStartTime;
 
-            if (message->GetType() == Message::kTypeIp6)
+        if (elapsed < timeout)
+        {
+            if (timeout - elapsed < nextDelay)
             {
-                mIpCounters.mRxFailure++;
+                nextDelay = timeout - elapsed;
             }
 
-            message->Free();
+            continue;
         }
+
+        RemoveReassemblyEntry(mReassemblyEntries[i]);
+
+        mDropCounters.mRx[OT_IP6_DROP_REASON_REASSEMBLY]++;
+        LogMessage(kMessageReassemblyDrop, *message, NULL, OT_ERROR_REASSEMBLY_TIMEOUT);
+
+        if (message->GetType() == Message::kTypeIp6)
+        {
+            mIpCounters.mRxFailure++;
+        }
+
+        mIpCounters.mRxReassemblyTimeout++;
+        message->Free();
     }
 
-    if (mReassemblyList.GetHead() != NULL)
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_ENABLE_FRAGMENT_FORWARDING
+    elapsed = AgeForwardEntries(now, timeout);
+
+    if (elapsed < nextDelay)
     {
-        mReassemblyTimer.Start(kStateUpdatePeriod);
+        nextDelay = elapsed;
+    }
+#endif
+
+    if (nextDelay <= timeout)
+    {
+        mReassemblyTimer.Start(nextDelay);
     }
 }
 
@@ -1522,7 +2236,7 @@ void MeshForwarder::HandleLowpanHC(uint8_t *               aFrame,
     message->Write(message->GetOffset(), aFrameLength, aFrame);
 
     // Security Check
-    VerifyOrExit(netif.GetIp6Filter().Accept(*message), error = OT_ERROR_DROP);
+    VerifyOrExit(netif.GetIp6Filter().Accept(*message), error = OT_ERROR_SECURITY);
 
 exit:
 
@@ -1532,6 +2246,7 @@ exit:
     }
     else
     {
+        mDropCounters.mRx[Ip6::Ip6::GetDropReason(error)]++;
         LogLowpanHcFrameDrop(error, aFrameLength, aMacSource, aMacDest, aLinkInfo.mLinkSecurity);
 
         if (message != NULL)
@@ -1596,7 +2311,8 @@ exit:
     return error;
 }
 
-#if (OPENTHREAD_CONFIG_LOG_LEVEL >= OT_LOG_LEVEL_NOTE) && (OPENTHREAD_CONFIG_LOG_MAC == 1)
+#if ((OPENTHREAD_CONFIG_LOG_LEVEL >= OT_LOG_LEVEL_NOTE) && (OPENTHREAD_CONFIG_LOG_MAC == 1)) || \
+    OPENTHREAD_CONFIG_ENABLE_FAIR_QUEUEING
 
 otError MeshForwarder::ParseIp6UdpTcpHeader(const Message &aMessage,
                                             Ip6::Header &  aIp6Header,
@@ -1604,7 +2320,10 @@ otError MeshForwarder::ParseIp6UdpTcpHeader(const Message &aMessage,
                                             uint16_t &     aSourcePort,
                                             uint16_t &     aDestPort)
 {
-    otError error = OT_ERROR_PARSE;
+    otError           error      = OT_ERROR_PARSE;
+    const PacketInfo *packetInfo = aMessage.GetPacketInfo();
+    uint16_t          offset     = sizeof(Ip6::Header);
+    uint8_t           ipProto;
     union
     {
         Ip6::UdpHeader udp;
@@ -1618,17 +2337,26 @@ otError MeshForwarder::ParseIp6UdpTcpHeader(const Message &aMessage,
     VerifyOrExit(sizeof(Ip6::Header) == aMessage.Read(0, sizeof(Ip6::Header), &aIp6Header));
     VerifyOrExit(aIp6Header.IsVersion6());
 
-    switch (aIp6Header.GetNextHeader())
+    ipProto = aIp6Header.GetNextHeader();
+
+    // Use the transport information recorded by `Ip6` which accounts for any extension headers.
+    if (packetInfo != NULL)
+    {
+        offset  = packetInfo->mTransportOffset;
+        ipProto = packetInfo->mIpProto;
+    }
+
+    switch (ipProto)
     {
     case Ip6::kProtoUdp:
-        VerifyOrExit(sizeof(Ip6::UdpHeader) == aMessage.Read(sizeof(Ip6::Header), sizeof(Ip6::UdpHeader), &header.udp));
+        VerifyOrExit(sizeof(Ip6::UdpHeader) == aMessage.Read(offset, sizeof(Ip6::UdpHeader), &header.udp));
         aChecksum   = header.udp.GetChecksum();
         aSourcePort = header.udp.GetSourcePort();
         aDestPort   = header.udp.GetDestinationPort();
         break;
 
     case Ip6::kProtoTcp:
-        VerifyOrExit(sizeof(Ip6::TcpHeader) == aMessage.Read(sizeof(Ip6::Header), sizeof(Ip6::TcpHeader), &header.tcp));
+        VerifyOrExit(sizeof(Ip6::TcpHeader) == aMessage.Read(offset, sizeof(Ip6::TcpHeader), &header.tcp));
         aChecksum   = header.tcp.GetChecksum();
         aSourcePort = header.tcp.GetSourcePort();
         aDestPort   = header.tcp.GetDestinationPort();
@@ -1644,6 +2372,10 @@ exit:
     return error;
 }
 
+#endif // ((OPENTHREAD_CONFIG_LOG_LEVEL >= OT_LOG_LEVEL_NOTE) && (OPENTHREAD_CONFIG_LOG_MAC == 1)) || FAIR_QUEUEING
+
+#if (OPENTHREAD_CONFIG_LOG_LEVEL >= OT_LOG_LEVEL_NOTE) && (OPENTHREAD_CONFIG_LOG_MAC == 1)
+
 const char *MeshForwarder::MessageActionToString(MessageAction aAction, otError aError)
 {
     const char *actionText = "";
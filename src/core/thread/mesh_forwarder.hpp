@@ -36,6 +36,8 @@
 
 #include "openthread-core-config.h"
 
+#include <string.h>
+
 #include "common/locator.hpp"
 #include "common/tasklet.hpp"
 #include "mac/mac.hpp"
@@ -215,6 +217,44 @@ public:
      */
     const otIpCounters &GetCounters(void) const { return mIpCounters; }
 
+    /**
+     * This method returns the mesh layer drop counters.
+     *
+     * @returns A reference to the mesh layer drop counters.
+     *
+     */
+    const otIp6DropCounters &GetDropCounters(void) const { return mDropCounters; }
+
+    /**
+     * This method resets the mesh layer drop counters.
+     *
+     */
+    void ResetDropCounters(void) { memset(&mDropCounters, 0, sizeof(mDropCounters)); }
+
+#if OPENTHREAD_CONFIG_ENABLE_MESSAGE_TRACE
+    /**
+     * This method returns the message latency histograms.
+     *
+     * @returns A reference to the message latency histograms.
+     *
+     */
+    const otMessageTraceHistograms &GetTraceHistograms(void) const { return mTraceHistograms; }
+
+    /**
+     * This method resets the message latency histograms.
+     *
+     */
+    void ResetTraceHistograms(void);
+
+    /**
+     * This method records the end-to-end latency of a received datagram.
+     *
+     * @param[in]  aLatency  The latency (milliseconds).
+     *
+     */
+    void RecordPathLatency(uint32_t aLatency);
+#endif
+
 #if OPENTHREAD_FTD
     /**
      * This method returns a reference to the resolving queue.
@@ -231,12 +271,29 @@ public:
      *
      */
     SourceMatchController &GetSourceMatchController(void) { return mSourceMatchController; }
+
+    /**
+     * This method schedules a supervision message (an empty payload data frame) to a sleepy child.
+     *
+     * A single supervision message is shared by all children: if one is already queued, @p aChild is added to its
+     * destinations instead of allocating a new message.
+     *
+     * @param[in]  aChild  A reference to the child.
+     *
+     * @retval OT_ERROR_NONE     Successfully scheduled the supervision message.
+     * @retval OT_ERROR_NO_BUFS  Insufficient buffers to create the supervision message.
+     *
+     */
+    otError SendSupervisionMessage(Child &aChild);
 #endif
 
 private:
     enum
     {
         kStateUpdatePeriod = 1000, ///< State update period in milliseconds.
+#if OPENTHREAD_CONFIG_ENABLE_CSL
+        kCslTxOffset = Mac::kCslReceiveWindow / 2, ///< Offset of a CSL transmission into the receive window (msec).
+#endif
     };
 
     enum
@@ -256,6 +313,98 @@ private:
         kSupervisionMsgAckRequest = (OPENTHREAD_CONFIG_SUPERVISION_MSG_NO_ACK_REQUEST == 0) ? true : false,
     };
 
+    enum
+    {
+        kReassemblyMaxDatagrams = OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_MAX_DATAGRAMS,
+        kReassemblyInvalidIndex = 0xff,
+    };
+
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_ENABLE_FRAGMENT_FORWARDING
+    enum
+    {
+        kForwardMaxDatagrams = OPENTHREAD_CONFIG_FRAGMENT_FORWARDING_MAX_DATAGRAMS,
+
+        /**
+         * The maximum payload of a frame sent by `SendMesh()` (short addresses, key id mode 1, MIC-32).
+         *
+         */
+        kMeshFrameMaxPayload = Mac::Frame::kMTU - Mac::Frame::kFcfSize - Mac::Frame::kDsnSize - sizeof(Mac::PanId) -
+                               2 * sizeof(Mac::ShortAddress) - Mac::Frame::kSecurityControlSize -
+                               Mac::Frame::kFrameCounterSize - Mac::Frame::kKeyIndexSize - Mac::Frame::kMic32Size -
+                               Mac::Frame::kFcsSize,
+    };
+
+    /**
+     * This structure tracks a datagram whose fragments are forwarded as they arrive (virtual reassembly).
+     *
+     */
+    struct ForwardEntry
+    {
+        Mac::Address mSource;       ///< The link source of the incoming fragments.
+        uint32_t     mStartTime;    ///< The time the first fragment was received (milliseconds).
+        uint16_t     mDatagramSize; ///< The datagram size, or zero if the entry is free.
+        uint16_t     mDatagramTag;  ///< The datagram tag of the incoming fragments.
+        uint16_t     mForwardTag;   ///< The datagram tag of the outgoing fragments.
+        uint16_t     mNextOffset;   ///< The datagram offset expected in the next incoming fragment.
+        uint16_t     mMeshDest;     ///< The mesh destination of the outgoing fragments.
+        uint8_t      mHopsLeft;     ///< The hops left value of the outgoing mesh header.
+    };
+#endif
+
+#if OPENTHREAD_CONFIG_ENABLE_FAIR_QUEUEING
+    enum
+    {
+        kFairQueueMaxFlows = OPENTHREAD_CONFIG_FAIR_QUEUEING_MAX_FLOWS,
+    };
+
+    /**
+     * This structure tracks the number of bytes sent by a flow (start-time fair queueing).
+     *
+     */
+    struct FairQueueFlow
+    {
+        uint32_t mServed; ///< The virtual time at which the last message of the flow finished.
+        uint16_t mKey;    ///< The flow key (see `GetFairQueueFlowKey()`).
+        bool     mInUse;  ///< Indicates whether the entry is in use.
+    };
+#endif
+
+#if OPENTHREAD_CONFIG_ENABLE_SEND_QUEUE_AQM
+    enum
+    {
+        kQueueDelayTarget   = OPENTHREAD_CONFIG_SEND_QUEUE_AQM_TARGET,
+        kQueueDelayInterval = OPENTHREAD_CONFIG_SEND_QUEUE_AQM_INTERVAL,
+    };
+
+    /**
+     * This structure holds the CoDel state of a priority level of the send queue.
+     *
+     */
+    struct QueueDelayState
+    {
+        uint32_t mFirstAboveTime; ///< The time at which the queue delay is considered persistently above target.
+        uint32_t mDropNext;       ///< The time of the next drop while dropping.
+        uint16_t mDropCount;      ///< The number of drops since dropping started.
+        bool     mAboveTarget;    ///< Indicates whether the queue delay is above target (`mFirstAboveTime` is valid).
+        bool     mDropping;       ///< Indicates whether messages are being dropped.
+    };
+#endif
+
+    /**
+     * This structure tracks a datagram under 6LoWPAN reassembly.
+     *
+     * Entries are chained into `mReassemblyBuckets` by their source address and datagram tag.
+     *
+     */
+    struct ReassemblyEntry
+    {
+        Message *    mMessage;     ///< The datagram under reassembly, or NULL if the entry is free.
+        Mac::Address mSource;      ///< The source of the datagram.
+        uint32_t     mStartTime;   ///< The time the first fragment was received (milliseconds).
+        uint16_t     mDatagramTag; ///< The datagram tag.
+        uint8_t      mNext;        ///< The index of the next entry in the same bucket.
+    };
+
     enum MessageAction ///< Defines the action parameter in `LogMessageInfo()` method.
     {
         kMessageReceive,         ///< Indicates that the message was received.
@@ -291,6 +440,7 @@ private:
     otError  GetMacDestinationAddress(const Ip6::Address &aIp6Addr, Mac::Address &aMacAddr);
     otError  GetMacSourceAddress(const Ip6::Address &aIp6Addr, Mac::Address &aMacAddr);
     Message *GetDirectTransmission(void);
+    Message *SelectDirectTransmission(void);
     otError  GetIndirectTransmission(void);
     Message *GetIndirectTransmission(Child &aChild);
     otError  PrepareDiscoverRequest(void);
@@ -320,10 +470,47 @@ private:
     otError  UpdateMeshRoute(Message &aMessage);
     otError  HandleDatagram(Message &aMessage, const otThreadLinkInfo &aLinkInfo, const Mac::Address &aMacSource);
     void     ClearReassemblyList(void);
+    otError  AddMessageForSleepyChild(Message &aMessage, Child &aChild);
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_ENABLE_CSL
+    uint32_t GetCslTxDelay(const Child &aChild, uint32_t aNow) const;
+    void     ScheduleCslTransmission(void);
+#endif
     otError  RemoveMessageFromSleepyChild(Message &aMessage, Child &aChild);
+    Message *FindIndirectMessage(Child &aChild, Message *aStartMessage);
     void     RemoveMessage(Message &aMessage);
+    void     RemoveExpiredMessage(Message &aMessage);
     void     HandleDiscoverComplete(void);
 
+    static uint8_t   GetReassemblyBucket(const Mac::Address &aSource, uint16_t aDatagramTag);
+    ReassemblyEntry *FindReassemblyEntry(const Mac::Address &aSource,
+                                         uint16_t            aDatagramTag,
+                                         uint16_t            aDatagramSize,
+                                         bool                aLinkSecurity);
+    ReassemblyEntry *AddReassemblyEntry(Message &aMessage, const Mac::Address &aSource);
+    void             RemoveReassemblyEntry(ReassemblyEntry &aEntry);
+
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_ENABLE_CHILD_INDIRECT_LIMITS
+    static bool IsIndirectLimited(const Message &aMessage);
+#endif
+
+#if OPENTHREAD_CONFIG_ENABLE_FAIR_QUEUEING
+    static bool     IsFairQueued(const Message &aMessage);
+    uint16_t        GetFairQueueFlowKey(const Message &aMessage);
+    uint32_t        GetFairQueueStartTime(uint16_t aFlowKey) const;
+    void            ChargeFairQueueFlow(uint16_t aFlowKey, uint16_t aLength);
+    static uint16_t UpdateFairQueueFlowKey(uint16_t aFlowKey, const void *aData, uint16_t aLength);
+#endif
+
+#if OPENTHREAD_CONFIG_ENABLE_SEND_QUEUE_AQM
+    bool            ShouldDropForQueueDelay(const Message &aMessage);
+    static uint32_t GetQueueDelayDropNext(uint32_t aTime, uint16_t aDropCount);
+#endif
+
+#if OPENTHREAD_CONFIG_ENABLE_MESSAGE_TRACE
+    void           RecordMessageTrace(const Message &aMessage);
+    static uint8_t GetTraceBucket(uint32_t aDelay);
+#endif
+
     void    HandleReceivedFrame(Mac::Frame &aFrame);
     otError HandleFrameRequest(Mac::Frame &aFrame);
     void    HandleSentFrame(Mac::Frame &aFrame, otError aError);
@@ -335,6 +522,15 @@ private:
     void        HandleReassemblyTimer(void);
     static void ScheduleTransmissionTask(Tasklet &aTasklet);
     void        ScheduleTransmissionTask(void);
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_ENABLE_CSL
+    static void HandleCslTimer(Timer &aTimer);
+    void        HandleCslTimer(void);
+#endif
+#if OPENTHREAD_CONFIG_PREPARE_NEXT_FRAGMENT_DURING_TX
+    static void HandlePrepareFrameTask(Tasklet &aTasklet);
+    void        HandlePrepareFrameTask(void);
+    bool        UsePreparedFrame(const Message &aMessage, Mac::Frame &aFrame);
+#endif
 
     otError GetFramePriority(uint8_t *           aFrame,
                              uint8_t             aFrameLength,
@@ -343,6 +539,34 @@ private:
                              uint8_t &           aPriority);
 
     otError GetDestinationRlocByServiceAloc(uint16_t aServiceAloc, uint16_t &aMeshDest);
+#if OPENTHREAD_FTD
+    otError GetMeshDestination(Ip6::Header &aIp6Header, uint16_t &aMeshDest);
+    uint8_t GetMeshHopsLeft(uint16_t aMeshDest);
+#endif
+
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_ENABLE_FRAGMENT_FORWARDING
+    otError       ForwardFragment(const uint8_t *               aFrame,
+                                  uint8_t                       aFrameLength,
+                                  const Mac::Address &          aMacSource,
+                                  const Mac::Address &          aMacDest,
+                                  const Lowpan::FragmentHeader &aFragmentHeader,
+                                  const otThreadLinkInfo &      aLinkInfo);
+    otError       StartForward(const uint8_t *               aFrame,
+                               uint8_t                       aFrameLength,
+                               const Mac::Address &          aMacSource,
+                               const Mac::Address &          aMacDest,
+                               const Lowpan::FragmentHeader &aFragmentHeader);
+    otError       ForwardPayload(ForwardEntry &aEntry, const uint8_t *aPayload, uint16_t aLength);
+    otError       SendForwardFragment(const ForwardEntry &aEntry,
+                                      uint16_t            aOffset,
+                                      const uint8_t *     aHeader,
+                                      uint8_t             aHeaderLength,
+                                      const uint8_t *     aPayload,
+                                      uint16_t            aPayloadLength);
+    uint8_t       GetForwardMeshHeaderLength(const ForwardEntry &aEntry) const;
+    ForwardEntry *FindForwardEntry(const Mac::Address &aSource, uint16_t aDatagramTag, uint16_t aDatagramSize);
+    uint32_t      AgeForwardEntries(uint32_t aNow, uint32_t aTimeout);
+#endif
 
     void LogMessage(MessageAction aAction, const Message &aMessage, const Mac::Address *aAddress, otError aError);
     void LogFrame(const char *aActionText, const Mac::Frame &aFrame, otError aError);
@@ -358,15 +582,19 @@ private:
                               const Mac::Address &aMacDest,
                               bool                aIsSecure);
 
-#if (OPENTHREAD_CONFIG_LOG_LEVEL >= OT_LOG_LEVEL_NOTE) && (OPENTHREAD_CONFIG_LOG_MAC == 1)
-    const char *MessageActionToString(MessageAction aAction, otError aError);
-    const char *MessagePriorityToString(const Message &aMessage);
-
+#if ((OPENTHREAD_CONFIG_LOG_LEVEL >= OT_LOG_LEVEL_NOTE) && (OPENTHREAD_CONFIG_LOG_MAC == 1)) || \
+    OPENTHREAD_CONFIG_ENABLE_FAIR_QUEUEING
     otError ParseIp6UdpTcpHeader(const Message &aMessage,
                                  Ip6::Header &  aIp6Header,
                                  uint16_t &     aChecksum,
                                  uint16_t &     aSourcePort,
                                  uint16_t &     aDestPort);
+#endif
+
+#if (OPENTHREAD_CONFIG_LOG_LEVEL >= OT_LOG_LEVEL_NOTE) && (OPENTHREAD_CONFIG_LOG_MAC == 1)
+    const char *MessageActionToString(MessageAction aAction, otError aError);
+    const char *MessagePriorityToString(const Message &aMessage);
+
 #if OPENTHREAD_FTD
     otError DecompressIp6UdpTcpHeader(const Message &     aMessage,
                                       uint16_t            aOffset,
@@ -414,6 +642,9 @@ private:
     uint16_t      mFragTag;
     uint16_t      mMessageNextOffset;
 
+    ReassemblyEntry mReassemblyEntries[kReassemblyMaxDatagrams];
+    uint8_t         mReassemblyBuckets[kReassemblyMaxDatagrams];
+
     Message *mSendMessage;
     bool     mSendMessageIsARetransmission;
     uint8_t  mSendMessageMaxCsmaBackoffs;
@@ -430,13 +661,49 @@ private:
     Tasklet mScheduleTransmissionTask;
     bool    mEnabled;
 
+#if OPENTHREAD_CONFIG_PREPARE_NEXT_FRAGMENT_DURING_TX
+    struct PreparedFrame
+    {
+        const Message *mMessage; ///< The message the frame was prepared from, or NULL if none.
+        uint16_t       mOffset;
+        uint16_t       mNextOffset;
+        uint16_t       mDatagramTag;
+        uint16_t       mPanId;
+        Mac::Address   mMacSource;
+        Mac::Address   mMacDest;
+        uint16_t       mMeshSource;
+        uint16_t       mMeshDest;
+        bool           mAddMeshHeader;
+        Mac::Frame     mFrame;
+        uint8_t        mPsdu[OT_RADIO_FRAME_MAX_SIZE];
+    };
+
+    PreparedFrame mPreparedFrame;
+    Tasklet       mPrepareFrameTask;
+#endif
+
     uint32_t mScanChannels;
     uint8_t  mScanChannel;
     uint16_t mMacRadioAcquisitionId;
     uint16_t mRestorePanId;
     bool     mScanning;
 
-    otIpCounters mIpCounters;
+    otIpCounters      mIpCounters;
+    otIp6DropCounters mDropCounters;
+
+#if OPENTHREAD_CONFIG_ENABLE_FAIR_QUEUEING
+    FairQueueFlow mFairQueueFlows[kFairQueueMaxFlows];
+    uint32_t      mFairQueueVirtualTime;
+#endif
+
+#if OPENTHREAD_CONFIG_ENABLE_SEND_QUEUE_AQM
+    QueueDelayState mQueueDelayStates[Message::kNumPriorities];
+#endif
+
+#if OPENTHREAD_CONFIG_ENABLE_MESSAGE_TRACE
+    otMessageTraceHistograms mTraceHistograms;
+    bool                     mTraceTxStartPending;
+#endif
 
 #if OPENTHREAD_FTD
     MessageQueue          mResolvingQueue;
@@ -445,6 +712,12 @@ private:
     uint8_t               mSendMessageKeyId;
     uint8_t               mSendMessageDataSequenceNumber;
     Child *               mIndirectStartingChild;
+#if OPENTHREAD_CONFIG_ENABLE_CSL
+    TimerMilli mCslTimer;
+#endif
+#if OPENTHREAD_CONFIG_ENABLE_FRAGMENT_FORWARDING
+    ForwardEntry mForwardEntries[kForwardMaxDatagrams];
+#endif
 #endif
 
     DataPollManager mDataPollManager;
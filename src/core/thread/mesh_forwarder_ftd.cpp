@@ -48,9 +48,8 @@ namespace ot {
 
 otError MeshForwarder::SendMessage(Message &aMessage)
 {
-    ThreadNetif &netif      = GetNetif();
-    ChildTable & childTable = netif.GetMle().GetChildTable();
-    otError      error      = OT_ERROR_NONE;
+    ThreadNetif &netif = GetNetif();
+    otError      error = OT_ERROR_NONE;
     Neighbor *   neighbor;
 
     switch (aMessage.GetType())
@@ -86,8 +85,7 @@ otError MeshForwarder::SendMessage(Message &aMessage)
 
                         if (!child.IsRxOnWhenIdle())
                         {
-                            aMessage.SetChildMask(childTable.GetChildIndex(child));
-                            mSourceMatchController.IncrementMessageCount(child);
+                            IgnoreReturnValue(AddMessageForSleepyChild(aMessage, child));
                         }
                     }
                 }
@@ -101,11 +99,13 @@ otError MeshForwarder::SendMessage(Message &aMessage)
 
                         if (netif.GetMle().IsSleepyChildSubscribed(ip6Header.GetDestination(), child))
                         {
-                            aMessage.SetChildMask(childTable.GetChildIndex(child));
-                            mSourceMatchController.IncrementMessageCount(child);
+                            IgnoreReturnValue(AddMessageForSleepyChild(aMessage, child));
                         }
                     }
                 }
+
+                // The message may have been refused by every child it was destined for.
+                VerifyOrExit(aMessage.GetDirectTransmission() || aMessage.IsChildPending(), error = OT_ERROR_NO_BUFS);
             }
         }
         else if ((neighbor = netif.GetMle().GetNeighbor(ip6Header.GetDestination())) != NULL &&
@@ -113,8 +113,8 @@ otError MeshForwarder::SendMessage(Message &aMessage)
         {
             // destined for a sleepy child
             Child &child = *static_cast<Child *>(neighbor);
-            aMessage.SetChildMask(childTable.GetChildIndex(child));
-            mSourceMatchController.IncrementMessageCount(child);
+            SuccessOrExit(error = aMessage.SetBufferClass(Message::kBufferClassIndirect));
+            SuccessOrExit(error = AddMessageForSleepyChild(aMessage, child));
         }
         else
         {
@@ -126,15 +126,8 @@ otError MeshForwarder::SendMessage(Message &aMessage)
     }
 
     case Message::kTypeSupervision:
-    {
-        Child *child = netif.GetChildSupervisor().GetDestination(aMessage);
-        VerifyOrExit(child != NULL, error = OT_ERROR_DROP);
-        VerifyOrExit(!child->IsRxOnWhenIdle(), error = OT_ERROR_DROP);
-
-        aMessage.SetChildMask(childTable.GetChildIndex(*child));
-        mSourceMatchController.IncrementMessageCount(*child);
+        // The destination children are added by `SendSupervisionMessage()`.
         break;
-    }
 
     default:
         aMessage.SetDirectTransmission();
@@ -143,6 +136,9 @@ otError MeshForwarder::SendMessage(Message &aMessage)
 
     aMessage.SetOffset(0);
     aMessage.SetDatagramTag(0);
+#if OPENTHREAD_CONFIG_ENABLE_SEND_QUEUE_AQM || OPENTHREAD_CONFIG_ENABLE_MESSAGE_TRACE
+    aMessage.SetEnqueueTime(TimerMilli::GetNow());
+#endif
     SuccessOrExit(error = mSendQueue.Enqueue(aMessage));
     mScheduleTransmissionTask.Post();
 
@@ -173,11 +169,15 @@ void MeshForwarder::HandleResolved(const Ip6::Address &aEid, otError aError)
 
             if (aError == OT_ERROR_NONE)
             {
+#if OPENTHREAD_CONFIG_ENABLE_SEND_QUEUE_AQM || OPENTHREAD_CONFIG_ENABLE_MESSAGE_TRACE
+                cur->SetEnqueueTime(TimerMilli::GetNow());
+#endif
                 mSendQueue.Enqueue(*cur);
                 enqueuedMessage = true;
             }
             else
             {
+                mDropCounters.mTx[OT_IP6_DROP_REASON_ADDRESS_QUERY]++;
                 LogMessage(kMessageDrop, *cur, NULL, aError);
                 cur->Free();
             }
@@ -190,6 +190,42 @@ void MeshForwarder::HandleResolved(const Ip6::Address &aEid, otError aError)
     }
 }
 
+otError MeshForwarder::SendSupervisionMessage(Child &aChild)
+{
+    otError  error = OT_ERROR_NONE;
+    Message *message;
+
+    VerifyOrExit(!aChild.IsRxOnWhenIdle());
+
+    for (message = mSendQueue.GetHead(); message != NULL; message = message->GetNext())
+    {
+        if (message->GetType() == Message::kTypeSupervision)
+        {
+            break;
+        }
+    }
+
+    if (message == NULL)
+    {
+        message = GetInstance().GetMessagePool().New(Message::kTypeSupervision, 0);
+        VerifyOrExit(message != NULL, error = OT_ERROR_NO_BUFS);
+
+        error = SendMessage(*message);
+
+        if (error != OT_ERROR_NONE)
+        {
+            message->Free();
+            ExitNow();
+        }
+    }
+
+    IgnoreReturnValue(AddMessageForSleepyChild(*message, aChild));
+    mScheduleTransmissionTask.Post();
+
+exit:
+    return error;
+}
+
 void MeshForwarder::ClearChildIndirectMessages(Child &aChild)
 {
     Message *nextMessage;
@@ -215,7 +251,11 @@ void MeshForwarder::ClearChildIndirectMessages(Child &aChild)
     }
 
     aChild.SetIndirectMessage(NULL);
+    aChild.SetFirstIndirectMessage(NULL);
     mSourceMatchController.ResetMessageCount(aChild);
+#if OPENTHREAD_CONFIG_ENABLE_CHILD_INDIRECT_LIMITS
+    aChild.ResetIndirectLimitedMessages();
+#endif
 
 exit:
     return;
@@ -269,6 +309,137 @@ exit:
     return error;
 }
 
+otError MeshForwarder::AddMessageForSleepyChild(Message &aMessage, Child &aChild)
+{
+    otError  error = OT_ERROR_NONE;
+    Message *first = aChild.GetFirstIndirectMessage();
+
+#if OPENTHREAD_CONFIG_ENABLE_CHILD_INDIRECT_LIMITS
+    if (IsIndirectLimited(aMessage))
+    {
+        if (aChild.GetIndirectLimitedMessageCount() >= OPENTHREAD_CONFIG_CHILD_INDIRECT_MAX_MESSAGES ||
+            aChild.GetIndirectLimitedByteCount() + aMessage.GetLength() > OPENTHREAD_CONFIG_CHILD_INDIRECT_MAX_BYTES)
+        {
+            otLogInfoMac("Indirect queue limit reached for child 0x%04x", aChild.GetRloc16());
+            ExitNow(error = OT_ERROR_NO_BUFS);
+        }
+
+        aChild.AddIndirectLimitedMessage(aMessage.GetLength());
+    }
+#endif
+
+    // `aMessage` is about to be added to the send queue, after any message of the same or higher priority.
+
+    if ((aChild.GetIndirectMessageCount() == 0) || ((first != NULL) && (aMessage.GetPriority() > first->GetPriority())))
+    {
+        aChild.SetFirstIndirectMessage(&aMessage);
+    }
+
+    aMessage.SetChildMask(GetNetif().GetMle().GetChildTable().GetChildIndex(aChild));
+    mSourceMatchController.IncrementMessageCount(aChild);
+
+#if OPENTHREAD_CONFIG_ENABLE_CSL
+    ScheduleCslTransmission();
+#endif
+
+#if OPENTHREAD_CONFIG_ENABLE_CHILD_INDIRECT_LIMITS
+exit:
+#endif
+    return error;
+}
+
+#if OPENTHREAD_CONFIG_ENABLE_CHILD_INDIRECT_LIMITS
+bool MeshForwarder::IsIndirectLimited(const Message &aMessage)
+{
+    // Supervision and network control messages are small and needed to keep the child attached.
+    return (aMessage.GetType() != Message::kTypeSupervision) && (aMessage.GetPriority() != Message::kPriorityNet);
+}
+#endif
+
+#if OPENTHREAD_CONFIG_ENABLE_CSL
+uint32_t MeshForwarder::GetCslTxDelay(const Child &aChild, uint32_t aNow) const
+{
+    // CSL transmission slots are at `kCslTxOffset` into each receive window,
+    // i.e. at `lastSync + n * period + kCslTxOffset` with `n >= 1`. Returns
+    // the time until the next slot, in the range `(0, period + kCslTxOffset]`.
+
+    uint32_t period  = aChild.GetCslPeriod();
+    uint32_t elapsed = aNow - aChild.GetCslLastSync();
+    uint32_t slot    = (elapsed >= kCslTxOffset) ? ((elapsed - kCslTxOffset) / period + 1) : 1;
+
+    return slot * period + kCslTxOffset - elapsed;
+}
+
+void MeshForwarder::ScheduleCslTransmission(void)
+{
+    uint32_t now      = TimerMilli::GetNow();
+    uint32_t minDelay = 0;
+    bool     found    = false;
+
+    for (ChildTable::Iterator iter(GetInstance(), ChildTable::kInStateValid); !iter.IsDone(); iter++)
+    {
+        Child &  child = *iter.GetChild();
+        uint32_t delay;
+
+        if (child.GetCslPeriod() == 0 || child.IsRxOnWhenIdle() || child.GetIndirectMessageCount() == 0 ||
+            child.IsDataRequestPending())
+        {
+            continue;
+        }
+
+        delay = GetCslTxDelay(child, now);
+
+        if (!found || delay < minDelay)
+        {
+            minDelay = delay;
+            found    = true;
+        }
+    }
+
+    if (found)
+    {
+        mCslTimer.Start(minDelay);
+    }
+    else
+    {
+        mCslTimer.Stop();
+    }
+}
+
+void MeshForwarder::HandleCslTimer(Timer &aTimer)
+{
+    aTimer.GetOwner<MeshForwarder>().HandleCslTimer();
+}
+
+void MeshForwarder::HandleCslTimer(void)
+{
+    uint32_t now = TimerMilli::GetNow();
+
+    for (ChildTable::Iterator iter(GetInstance(), ChildTable::kInStateValid); !iter.IsDone(); iter++)
+    {
+        Child &child = *iter.GetChild();
+
+        if (child.GetCslPeriod() == 0 || child.IsRxOnWhenIdle() || child.GetIndirectMessageCount() == 0 ||
+            child.IsDataRequestPending())
+        {
+            continue;
+        }
+
+        // The child is in its receive window if the current slot started
+        // less than half a window ago. The indirect transmission is then
+        // triggered as if a data poll had been received from the child.
+
+        if (GetCslTxDelay(child, now) + kCslTxOffset > child.GetCslPeriod())
+        {
+            child.SetDataRequestPending(true);
+            mScheduleTransmissionTask.Post();
+        }
+    }
+
+    ScheduleCslTransmission();
+}
+#endif // OPENTHREAD_CONFIG_ENABLE_CSL
+
 otError MeshForwarder::RemoveMessageFromSleepyChild(Message &aMessage, Child &aChild)
 {
     otError error      = OT_ERROR_NONE;
@@ -279,6 +450,19 @@ otError MeshForwarder::RemoveMessageFromSleepyChild(Message &aMessage, Child &aC
     aMessage.ClearChildMask(childIndex);
     mSourceMatchController.DecrementMessageCount(aChild);
 
+#if OPENTHREAD_CONFIG_ENABLE_CHILD_INDIRECT_LIMITS
+    if (IsIndirectLimited(aMessage))
+    {
+        aChild.RemoveIndirectLimitedMessage(aMessage.GetLength());
+    }
+#endif
+
+    if (aChild.GetFirstIndirectMessage() == &aMessage)
+    {
+        // Messages ahead of `aMessage` in the send queue are not pending for the child.
+        aChild.SetFirstIndirectMessage(FindIndirectMessage(aChild, aMessage.GetNext()));
+    }
+
     if (aChild.GetIndirectMessage() == &aMessage)
     {
         aChild.SetIndirectMessage(NULL);
@@ -288,6 +472,22 @@ exit:
     return error;
 }
 
+Message *MeshForwarder::FindIndirectMessage(Child &aChild, Message *aStartMessage)
+{
+    uint8_t  childIndex = GetNetif().GetMle().GetChildTable().GetChildIndex(aChild);
+    Message *message;
+
+    for (message = aStartMessage; message; message = message->GetNext())
+    {
+        if (message->GetChildMask(childIndex))
+        {
+            break;
+        }
+    }
+
+    return message;
+}
+
 void MeshForwarder::RemoveMessages(Child &aChild, uint8_t aSubType)
 {
     ThreadNetif &netif = GetNetif();
@@ -363,14 +563,9 @@ void MeshForwarder::RemoveDataResponseMessages(void)
             continue;
         }
 
-        message->Read(0, sizeof(ip6Header), &ip6Header);
-
-        if (!(ip6Header.GetDestination().IsMulticast()))
+        for (ChildTable::Iterator iter(GetInstance(), ChildTable::kInStateAnyExceptInvalid); !iter.IsDone(); iter++)
         {
-            for (ChildTable::Iterator iter(GetInstance(), ChildTable::kInStateAnyExceptInvalid); !iter.IsDone(); iter++)
-            {
-                IgnoreReturnValue(RemoveMessageFromSleepyChild(*message, *iter.GetChild()));
-            }
+            IgnoreReturnValue(RemoveMessageFromSleepyChild(*message, *iter.GetChild()));
         }
 
         if (mSendMessage == message)
@@ -444,29 +639,39 @@ exit:
 
 Message *MeshForwarder::GetIndirectTransmission(Child &aChild)
 {
-    Message *message = NULL;
-    Message *next;
-    uint8_t  childIndex = GetNetif().GetMle().GetChildTable().GetChildIndex(aChild);
+    Message *message = aChild.GetFirstIndirectMessage();
+    uint32_t now     = TimerMilli::GetNow();
 
-    for (message = mSendQueue.GetHead(); message; message = next)
+    if ((message == NULL) && (aChild.GetIndirectMessageCount() > 0))
     {
-        next = message->GetNext();
+        message = FindIndirectMessage(aChild, mSendQueue.GetHead());
+        aChild.SetFirstIndirectMessage(message);
+    }
 
-        if (message->GetChildMask(childIndex))
-        {
-            // Skip and remove the supervision message if there are other messages queued for the child.
+    // Skip and remove the messages whose lifetime expired before their delivery to the child started.
 
-            if ((message->GetType() == Message::kTypeSupervision) && (aChild.GetIndirectMessageCount() > 1))
-            {
-                message->ClearChildMask(childIndex);
-                mSourceMatchController.DecrementMessageCount(aChild);
-                mSendQueue.Dequeue(*message);
-                message->Free();
-                continue;
-            }
+    while ((message != NULL) && message->IsExpired(now))
+    {
+        IgnoreReturnValue(RemoveMessageFromSleepyChild(*message, aChild));
+        RemoveExpiredMessage(*message);
+        message = aChild.GetFirstIndirectMessage();
+    }
 
-            break;
+    // Skip the supervision message if there are other messages queued for the child. The supervision
+    // message is shared by all children, it is removed once no other child is pending.
+
+    while ((message != NULL) && (message->GetType() == Message::kTypeSupervision) &&
+           (aChild.GetIndirectMessageCount() > 1))
+    {
+        IgnoreReturnValue(RemoveMessageFromSleepyChild(*message, aChild));
+
+        if (!message->IsChildPending())
+        {
+            mSendQueue.Dequeue(*message);
+            message->Free();
         }
+
+        message = aChild.GetFirstIndirectMessage();
     }
 
     aChild.SetIndirectMessage(message);
@@ -570,6 +775,9 @@ void MeshForwarder::HandleDataRequest(const Mac::Address &aMacSource, const otTh
 
     child->SetLastHeard(TimerMilli::GetNow());
     child->ResetLinkFailures();
+#if OPENTHREAD_CONFIG_ENABLE_CSL
+    child->SetCslLastSync(child->GetLastHeard());
+#endif
     indirectMsgCount = child->GetIndirectMessageCount();
 
     if (!mSourceMatchController.IsEnabled() || (indirectMsgCount > 0))
@@ -679,7 +887,6 @@ void MeshForwarder::HandleSentFrameToChild(const Mac::Frame &aFrame, otError aEr
     else
     {
         otError txError = aError;
-        uint8_t childIndex;
 
         if (mSendMessage == child->GetIndirectMessage())
         {
@@ -715,13 +922,7 @@ void MeshForwarder::HandleSentFrameToChild(const Mac::Frame &aFrame, otError aEr
 #endif
         }
 
-        childIndex = netif.GetMle().GetChildTable().GetChildIndex(*child);
-
-        if (mSendMessage->GetChildMask(childIndex))
-        {
-            mSendMessage->ClearChildMask(childIndex);
-            mSourceMatchController.DecrementMessageCount(*child);
-        }
+        IgnoreReturnValue(RemoveMessageFromSleepyChild(*mSendMessage, *child));
 
         LogMessage(kMessageTransmit, *mSendMessage, &aMacDest, txError);
 
@@ -744,6 +945,9 @@ void MeshForwarder::HandleSentFrameToChild(const Mac::Frame &aFrame, otError aEr
     }
 
 exit:
+#if OPENTHREAD_CONFIG_ENABLE_CSL
+    ScheduleCslTransmission();
+#endif
     return;
 }
 
@@ -784,29 +988,29 @@ exit:
     return error;
 }
 
-otError MeshForwarder::UpdateIp6RouteFtd(Ip6::Header &ip6Header)
+otError MeshForwarder::GetMeshDestination(Ip6::Header &aIp6Header, uint16_t &aMeshDest)
 {
     otError      error = OT_ERROR_NONE;
     ThreadNetif &netif = GetNetif();
     Neighbor *   neighbor;
 
-    if (netif.GetMle().IsRoutingLocator(ip6Header.GetDestination()))
+    if (netif.GetMle().IsRoutingLocator(aIp6Header.GetDestination()))
     {
-        uint16_t rloc16 = HostSwap16(ip6Header.GetDestination().mFields.m16[7]);
+        uint16_t rloc16 = HostSwap16(aIp6Header.GetDestination().mFields.m16[7]);
         VerifyOrExit(netif.GetMle().IsRouterIdValid(netif.GetMle().GetRouterId(rloc16)), error = OT_ERROR_DROP);
-        mMeshDest = rloc16;
+        aMeshDest = rloc16;
     }
-    else if (netif.GetMle().IsAnycastLocator(ip6Header.GetDestination()))
+    else if (netif.GetMle().IsAnycastLocator(aIp6Header.GetDestination()))
     {
-        uint16_t aloc16 = HostSwap16(ip6Header.GetDestination().mFields.m16[7]);
+        uint16_t aloc16 = HostSwap16(aIp6Header.GetDestination().mFields.m16[7]);
 
         if (aloc16 == Mle::kAloc16Leader)
         {
-            mMeshDest = netif.GetMle().GetRloc16(netif.GetMle().GetLeaderId());
+            aMeshDest = netif.GetMle().GetRloc16(netif.GetMle().GetLeaderId());
         }
         else if ((aloc16 >= Mle::kAloc16CommissionerStart) && (aloc16 <= Mle::kAloc16CommissionerEnd))
         {
-            SuccessOrExit(error = MeshCoP::GetBorderAgentRloc(netif, mMeshDest));
+            SuccessOrExit(error = MeshCoP::GetBorderAgentRloc(netif, aMeshDest));
         }
 
 #if OPENTHREAD_ENABLE_DHCP6_SERVER || OPENTHREAD_ENABLE_DHCP6_CLIENT
@@ -824,12 +1028,12 @@ otError MeshForwarder::UpdateIp6RouteFtd(Ip6::Header &ip6Header)
             if ((netif.GetMle().IsActiveRouter(agentRloc16)) ||
                 (netif.GetMle().GetRloc16(routerId) == netif.GetMle().GetRloc16()))
             {
-                mMeshDest = agentRloc16;
+                aMeshDest = agentRloc16;
             }
             else
             {
                 // use the parent of the ED Agent as Dest
-                mMeshDest = netif.GetMle().GetRloc16(routerId);
+                aMeshDest = netif.GetMle().GetRloc16(routerId);
             }
         }
 
@@ -837,7 +1041,7 @@ otError MeshForwarder::UpdateIp6RouteFtd(Ip6::Header &ip6Header)
 #if OPENTHREAD_ENABLE_SERVICE
         else if ((aloc16 >= Mle::kAloc16ServiceStart) && (aloc16 <= Mle::kAloc16ServiceEnd))
         {
-            SuccessOrExit(error = GetDestinationRlocByServiceAloc(aloc16, mMeshDest));
+            SuccessOrExit(error = GetDestinationRlocByServiceAloc(aloc16, aMeshDest));
         }
 
 #endif
@@ -847,20 +1051,32 @@ otError MeshForwarder::UpdateIp6RouteFtd(Ip6::Header &ip6Header)
             ExitNow(error = OT_ERROR_DROP);
         }
     }
-    else if ((neighbor = netif.GetMle().GetNeighbor(ip6Header.GetDestination())) != NULL)
+    else if ((neighbor = netif.GetMle().GetNeighbor(aIp6Header.GetDestination())) != NULL)
     {
-        mMeshDest = neighbor->GetRloc16();
+        aMeshDest = neighbor->GetRloc16();
     }
-    else if (netif.GetNetworkDataLeader().IsOnMesh(ip6Header.GetDestination()))
+    else if (netif.GetNetworkDataLeader().IsOnMesh(aIp6Header.GetDestination()))
     {
-        SuccessOrExit(error = netif.GetAddressResolver().Resolve(ip6Header.GetDestination(), mMeshDest));
+        SuccessOrExit(error = netif.GetAddressResolver().Resolve(aIp6Header.GetDestination(), aMeshDest));
     }
     else
     {
-        netif.GetNetworkDataLeader().RouteLookup(ip6Header.GetSource(), ip6Header.GetDestination(), NULL, &mMeshDest);
+        netif.GetNetworkDataLeader().RouteLookup(aIp6Header.GetSource(), aIp6Header.GetDestination(), NULL,
+                                                 &aMeshDest);
     }
 
-    VerifyOrExit(mMeshDest != Mac::kShortAddrInvalid, error = OT_ERROR_DROP);
+    VerifyOrExit(aMeshDest != Mac::kShortAddrInvalid, error = OT_ERROR_DROP);
+
+exit:
+    return error;
+}
+
+otError MeshForwarder::UpdateIp6RouteFtd(Ip6::Header &ip6Header)
+{
+    otError      error = OT_ERROR_NONE;
+    ThreadNetif &netif = GetNetif();
+
+    SuccessOrExit(error = GetMeshDestination(ip6Header, mMeshDest));
 
     mMeshSource = netif.GetMac().GetShortAddress();
 
@@ -878,6 +1094,42 @@ exit:
     return error;
 }
 
+uint8_t MeshForwarder::GetMeshHopsLeft(uint16_t aMeshDest)
+{
+    ThreadNetif &netif = GetNetif();
+    uint8_t      hopsLeft;
+
+    if (netif.GetMle().GetRole() == OT_DEVICE_ROLE_CHILD)
+    {
+        // REED sets hopsLeft to max (16) + 1. It does not know the route cost.
+        hopsLeft = Mle::kMaxRouteCost + 1;
+    }
+    else
+    {
+        // Calculate the number of predicted hops.
+        hopsLeft = netif.GetMle().GetRouteCost(aMeshDest);
+
+        if (hopsLeft != Mle::kMaxRouteCost)
+        {
+            hopsLeft += netif.GetMle().GetLinkCost(netif.GetMle().GetRouterId(netif.GetMle().GetNextHop(aMeshDest)));
+        }
+        else
+        {
+            // In case there is no route to the destination router (only link).
+            hopsLeft = netif.GetMle().GetLinkCost(netif.GetMle().GetRouterId(aMeshDest));
+        }
+    }
+
+    // The hopsLft field MUST be incremented by one if the destination RLOC16
+    // is not that of an active Router.
+    if (!netif.GetMle().IsActiveRouter(aMeshDest))
+    {
+        hopsLeft += 1;
+    }
+
+    return static_cast<uint8_t>(hopsLeft + Lowpan::MeshHeader::kAdditionalHopsLeft);
+}
+
 otError MeshForwarder::GetIp6Header(const uint8_t *     aFrame,
                                     uint8_t             aFrameLength,
                                     const Mac::Address &aMacSource,
@@ -984,6 +1236,7 @@ exit:
 
     if (error != OT_ERROR_NONE)
     {
+        mDropCounters.mRx[Ip6::Ip6::GetDropReason(error)]++;
         otLogInfoMac("Dropping rx mesh frame, error:%s, len:%d, src:%s, sec:%s", otThreadErrorToString(error),
                      aFrameLength, aMacSource.ToString().AsCString(), aLinkInfo.mLinkSecurity ? "yes" : "no");
 
@@ -994,6 +1247,325 @@ exit:
     }
 }
 
+#if OPENTHREAD_CONFIG_ENABLE_FRAGMENT_FORWARDING
+
+otError MeshForwarder::ForwardFragment(const uint8_t *               aFrame,
+                                       uint8_t                       aFrameLength,
+                                       const Mac::Address &          aMacSource,
+                                       const Mac::Address &          aMacDest,
+                                       const Lowpan::FragmentHeader &aFragmentHeader,
+                                       const otThreadLinkInfo &      aLinkInfo)
+{
+    otError       error = OT_ERROR_NONE;
+    ForwardEntry *entry;
+
+    entry = FindForwardEntry(aMacSource, aFragmentHeader.GetDatagramTag(), aFragmentHeader.GetDatagramSize());
+
+    if (entry == NULL)
+    {
+        VerifyOrExit(aFragmentHeader.GetDatagramOffset() == 0 && aLinkInfo.mLinkSecurity, error = OT_ERROR_NOT_FOUND);
+        ExitNow(error = StartForward(aFrame, aFrameLength, aMacSource, aMacDest, aFragmentHeader));
+    }
+
+    if (aFragmentHeader.GetDatagramOffset() < entry->mNextOffset)
+    {
+        mIpCounters.mRxDuplicateFragments++;
+        ExitNow(error = OT_ERROR_DUPLICATED);
+    }
+
+    // A missing fragment cannot be recovered once the preceding fragments have been forwarded.
+    VerifyOrExit(aFragmentHeader.GetDatagramOffset() == entry->mNextOffset && aLinkInfo.mLinkSecurity,
+                 entry->mDatagramSize = 0, error = OT_ERROR_DROP);
+    VerifyOrExit(entry->mNextOffset + aFrameLength <= entry->mDatagramSize, entry->mDatagramSize = 0,
+                 error = OT_ERROR_PARSE);
+
+    error = ForwardPayload(*entry, aFrame, aFrameLength);
+
+    if (error != OT_ERROR_NONE || entry->mNextOffset >= entry->mDatagramSize)
+    {
+        entry->mDatagramSize = 0;
+    }
+
+exit:
+    return error;
+}
+
+otError MeshForwarder::StartForward(const uint8_t *               aFrame,
+                                    uint8_t                       aFrameLength,
+                                    const Mac::Address &          aMacSource,
+                                    const Mac::Address &          aMacDest,
+                                    const Lowpan::FragmentHeader &aFragmentHeader)
+{
+    ThreadNetif & netif   = GetNetif();
+    otError       error   = OT_ERROR_NOT_FOUND;
+    ForwardEntry *entry   = NULL;
+    Message *     message = NULL;
+    Ip6::Header   ip6Header;
+    Mac::Address  meshSource;
+    Mac::Address  meshDest;
+    uint16_t      meshDest16 = Mac::kShortAddrInvalid;
+    uint16_t      nextHop;
+    uint8_t       hc[Mac::Frame::kMTU];
+    int           headerLength;
+    int           hcLength;
+    uint16_t      ip6HeaderLength;
+    uint16_t      payloadLength;
+    int           firstLength;
+
+    VerifyOrExit(netif.GetMle().GetRole() == OT_DEVICE_ROLE_ROUTER ||
+                 netif.GetMle().GetRole() == OT_DEVICE_ROLE_LEADER);
+
+    for (uint8_t i = 0; i < kForwardMaxDatagrams; i++)
+    {
+        if (mForwardEntries[i].mDatagramSize == 0)
+        {
+            entry = &mForwardEntries[i];
+            break;
+        }
+    }
+
+    VerifyOrExit(entry != NULL);
+    VerifyOrExit((message = GetInstance().GetMessagePool().New(Message::kTypeIp6, 0)) != NULL);
+
+    headerLength = netif.GetLowpan().Decompress(*message, aMacSource, aMacDest, aFrame, aFrameLength,
+                                                aFragmentHeader.GetDatagramSize());
+    VerifyOrExit(headerLength > 0);
+
+    ip6HeaderLength = message->GetOffset();
+    payloadLength   = aFrameLength - static_cast<uint8_t>(headerLength);
+    VerifyOrExit(ip6HeaderLength + payloadLength <= aFragmentHeader.GetDatagramSize());
+
+    // Only unicast datagrams routed towards another router are forwarded without reassembly; anything destined to
+    // this device or to one of its children takes the regular path.
+    message->Read(0, sizeof(ip6Header), &ip6Header);
+    VerifyOrExit(!ip6Header.GetDestination().IsMulticast() && !ip6Header.GetDestination().IsLinkLocal() &&
+                 !netif.IsUnicastAddress(ip6Header.GetDestination()) && ip6Header.GetHopLimit() > 1);
+
+    VerifyOrExit(GetMeshDestination(ip6Header, meshDest16) == OT_ERROR_NONE);
+    VerifyOrExit(netif.GetMle().GetRouterId(meshDest16) != netif.GetMle().GetRouterId(netif.GetMle().GetRloc16()));
+
+    nextHop = netif.GetMle().GetNextHop(meshDest16);
+    VerifyOrExit(nextHop != Mac::kShortAddrInvalid && netif.GetMle().IsActiveRouter(nextHop));
+    VerifyOrExit(netif.GetMle().CheckReachability(netif.GetMac().GetShortAddress(), meshDest16, ip6Header) ==
+                 OT_ERROR_NONE);
+
+    // Recompress the IPv6 header against the mesh addresses of the outgoing fragments.
+    ip6Header.SetHopLimit(ip6Header.GetHopLimit() - 1);
+    message->Write(0, sizeof(ip6Header), &ip6Header);
+    message->SetOffset(0);
+
+    meshSource.SetShort(netif.GetMac().GetShortAddress());
+    meshDest.SetShort(meshDest16);
+
+    hcLength = netif.GetLowpan().Compress(*message, meshSource, meshDest, hc);
+    VerifyOrExit(hcLength > 0 && message->GetOffset() == ip6HeaderLength);
+
+    if (mFragTag == 0)
+    {
+        mFragTag++;
+    }
+
+    entry->mSource       = aMacSource;
+    entry->mStartTime    = TimerMilli::GetNow();
+    entry->mDatagramSize = aFragmentHeader.GetDatagramSize();
+    entry->mDatagramTag  = aFragmentHeader.GetDatagramTag();
+    entry->mForwardTag   = mFragTag++;
+    entry->mNextOffset   = 0;
+    entry->mMeshDest     = meshDest16;
+    entry->mHopsLeft     = GetMeshHopsLeft(meshDest16);
+
+    // The first outgoing fragment carries as much of the incoming payload as fits, ending on an 8-octet boundary
+    // unless it completes the datagram. The rest follows in subsequent fragments.
+    firstLength = kMeshFrameMaxPayload - GetForwardMeshHeaderLength(*entry) - (sizeof(Lowpan::FragmentHeader) - 1) -
+                  hcLength;
+
+    if (firstLength < payloadLength)
+    {
+        firstLength = ((ip6HeaderLength + firstLength) & ~0x7) - ip6HeaderLength;
+        VerifyOrExit(firstLength > 0, entry->mDatagramSize = 0);
+    }
+    else
+    {
+        firstLength = payloadLength;
+    }
+
+    error = SendForwardFragment(*entry, 0, hc, static_cast<uint8_t>(hcLength), aFrame + headerLength,
+                                static_cast<uint16_t>(firstLength));
+
+    if (error == OT_ERROR_NONE)
+    {
+        entry->mNextOffset = ip6HeaderLength + static_cast<uint16_t>(firstLength);
+        error = ForwardPayload(*entry, aFrame + headerLength + firstLength, payloadLength - firstLength);
+    }
+
+    if (error != OT_ERROR_NONE || entry->mNextOffset >= entry->mDatagramSize)
+    {
+        entry->mDatagramSize = 0;
+    }
+
+    if (!mReassemblyTimer.IsRunning())
+    {
+        mReassemblyTimer.Start(TimerMilli::SecToMsec(kReassemblyTimeout));
+    }
+
+exit:
+
+    if (message != NULL)
+    {
+        message->Free();
+    }
+
+    return error;
+}
+
+otError MeshForwarder::ForwardPayload(ForwardEntry &aEntry, const uint8_t *aPayload, uint16_t aLength)
+{
+    otError  error = OT_ERROR_NONE;
+    uint16_t maxLength;
+    uint16_t length;
+
+    maxLength = (kMeshFrameMaxPayload - GetForwardMeshHeaderLength(aEntry) - sizeof(Lowpan::FragmentHeader)) & ~0x7;
+
+    while (aLength > 0)
+    {
+        length = (aLength > maxLength) ? maxLength : aLength;
+
+        SuccessOrExit(error = SendForwardFragment(aEntry, aEntry.mNextOffset, NULL, 0, aPayload, length));
+
+        aEntry.mNextOffset += length;
+        aPayload += length;
+        aLength -= length;
+    }
+
+exit:
+    return error;
+}
+
+otError MeshForwarder::SendForwardFragment(const ForwardEntry &aEntry,
+                                           uint16_t            aOffset,
+                                           const uint8_t *     aHeader,
+                                           uint8_t             aHeaderLength,
+                                           const uint8_t *     aPayload,
+                                           uint16_t            aPayloadLength)
+{
+    otError                error = OT_ERROR_NONE;
+    Message *              message;
+    Lowpan::MeshHeader     meshHeader;
+    Lowpan::FragmentHeader fragmentHeader;
+    uint8_t                buf[sizeof(meshHeader) + sizeof(fragmentHeader)];
+    uint8_t                bufLength;
+
+    meshHeader.Init();
+    meshHeader.SetHopsLeft(aEntry.mHopsLeft);
+    meshHeader.SetSource(GetNetif().GetMac().GetShortAddress());
+    meshHeader.SetDestination(aEntry.mMeshDest);
+    meshHeader.AppendTo(buf);
+    bufLength = meshHeader.GetHeaderLength();
+
+    fragmentHeader.Init();
+    fragmentHeader.SetDatagramSize(aEntry.mDatagramSize);
+    fragmentHeader.SetDatagramTag(aEntry.mForwardTag);
+    fragmentHeader.SetDatagramOffset(aOffset);
+    memcpy(buf + bufLength, &fragmentHeader, fragmentHeader.GetHeaderLength());
+    bufLength += fragmentHeader.GetHeaderLength();
+
+    VerifyOrExit((message = GetInstance().GetMessagePool().New(Message::kType6lowpan, 0)) != NULL,
+                 error = OT_ERROR_NO_BUFS);
+    SuccessOrExit(error = message->SetLength(bufLength + aHeaderLength + aPayloadLength));
+    message->Write(0, bufLength, buf);
+
+    if (aHeader != NULL)
+    {
+        message->Write(bufLength, aHeaderLength, aHeader);
+    }
+
+    message->Write(bufLength + aHeaderLength, aPayloadLength, aPayload);
+    message->SetLinkSecurityEnabled(true);
+    message->SetPanId(GetNetif().GetMac().GetPanId());
+
+    SuccessOrExit(error = SendMessage(*message));
+    message = NULL;
+
+exit:
+
+    if (message != NULL)
+    {
+        message->Free();
+    }
+
+    return error;
+}
+
+uint8_t MeshForwarder::GetForwardMeshHeaderLength(const ForwardEntry &aEntry) const
+{
+    Lowpan::MeshHeader meshHeader;
+
+    meshHeader.Init();
+    meshHeader.SetHopsLeft(aEntry.mHopsLeft);
+
+    return meshHeader.GetHeaderLength();
+}
+
+MeshForwarder::ForwardEntry *MeshForwarder::FindForwardEntry(const Mac::Address &aSource,
+                                                             uint16_t            aDatagramTag,
+                                                             uint16_t            aDatagramSize)
+{
+    ForwardEntry *entry = NULL;
+
+    for (uint8_t i = 0; i < kForwardMaxDatagrams; i++)
+    {
+        ForwardEntry &cur = mForwardEntries[i];
+
+        if (cur.mDatagramSize == 0 || cur.mDatagramSize != aDatagramSize || cur.mDatagramTag != aDatagramTag ||
+            cur.mSource.GetType() != aSource.GetType())
+        {
+            continue;
+        }
+
+        if ((aSource.IsShort() && cur.mSource.GetShort() == aSource.GetShort()) ||
+            (aSource.IsExtended() && cur.mSource.GetExtended() == aSource.GetExtended()))
+        {
+            ExitNow(entry = &cur);
+        }
+    }
+
+exit:
+    return entry;
+}
+
+uint32_t MeshForwarder::AgeForwardEntries(uint32_t aNow, uint32_t aTimeout)
+{
+    uint32_t nextDelay = aTimeout + 1;
+    uint32_t elapsed;
+
+    for (uint8_t i = 0; i < kForwardMaxDatagrams; i++)
+    {
+        ForwardEntry &entry = mForwardEntries[i];
+
+        if (entry.mDatagramSize == 0)
+        {
+            continue;
+        }
+
+        elapsed = aNow - entry.mStartTime;
+
+        if (elapsed >= aTimeout)
+        {
+            otLogInfoMac("Forwarding of datagram tag %d from %s timed out", entry.mDatagramTag,
+                         entry.mSource.ToString().AsCString());
+            entry.mDatagramSize = 0;
+        }
+        else if (aTimeout - elapsed < nextDelay)
+        {
+            nextDelay = aTimeout - elapsed;
+        }
+    }
+
+    return nextDelay;
+}
+
+#endif // OPENTHREAD_CONFIG_ENABLE_FRAGMENT_FORWARDING
+
 void MeshForwarder::UpdateRoutes(uint8_t *           aFrame,
                                  uint8_t             aFrameLength,
                                  const Mac::Address &aMeshSource,
@@ -46,6 +46,9 @@ otError MeshForwarder::SendMessage(Message &aMessage)
     aMessage.SetDirectTransmission();
     aMessage.SetOffset(0);
     aMessage.SetDatagramTag(0);
+#if OPENTHREAD_CONFIG_ENABLE_SEND_QUEUE_AQM || OPENTHREAD_CONFIG_ENABLE_MESSAGE_TRACE
+    aMessage.SetEnqueueTime(TimerMilli::GetNow());
+#endif
 
     SuccessOrExit(error = mSendQueue.Enqueue(aMessage));
     mScheduleTransmissionTask.Post();
@@ -76,8 +76,12 @@ Mle::Mle(Instance &aInstance)
     , mDelayedResponseTimer(aInstance, &Mle::HandleDelayedResponseTimer, this)
     , mMessageTransmissionTimer(aInstance, &Mle::HandleMessageTransmissionTimer, this)
     , mParentLeaderCost(0)
+    , mDelayedDataResponse(NULL)
     , mParentRequestMode(kAttachAny)
     , mParentPriority(0)
+#if OPENTHREAD_CONFIG_ENABLE_PARENT_LOAD_BALANCING
+    , mParentLoad(0)
+#endif
     , mParentLinkQuality3(0)
     , mParentLinkQuality2(0)
     , mParentLinkQuality1(0)
@@ -271,8 +275,10 @@ otError Mle::Start(bool aEnableReattach, bool aAnnounceAttach)
     }
     else
     {
+        // Try to resume the link with the saved parent before falling back to a full attach.
         SetAttachState(kAttachStateSynchronize);
         mChildUpdateAttempts = 0;
+        mCounters.mParentSyncAttempts++;
         SendChildUpdateRequest();
     }
 
@@ -333,6 +339,13 @@ void Mle::SetRole(otDeviceRole aRole)
         break;
     }
 
+#if OPENTHREAD_CONFIG_ENABLE_BOOT_TIMESTAMPS
+    if (IsAttached())
+    {
+        GetInstance().RecordBootAttached();
+    }
+#endif
+
 #if OPENTHREAD_ENABLE_BORDER_AGENT
     // Start border agent
     if (aRole == OT_DEVICE_ROLE_ROUTER || aRole == OT_DEVICE_ROLE_LEADER || aRole == OT_DEVICE_ROLE_CHILD)
@@ -366,12 +379,32 @@ otError Mle::Restore(void)
     otError               error    = OT_ERROR_NONE;
     Settings::NetworkInfo networkInfo;
     Settings::ParentInfo  parentInfo;
+#if OPENTHREAD_CONFIG_STORE_FRAME_COUNTERS_SEPARATELY
+    Settings::FrameCounters frameCounters;
+#endif
 
     netif.GetActiveDataset().Restore();
     netif.GetPendingDataset().Restore();
 
     SuccessOrExit(error = settings.ReadNetworkInfo(networkInfo));
 
+#if OPENTHREAD_CONFIG_STORE_FRAME_COUNTERS_SEPARATELY
+    // The separately stored frame counters are only valid for the key sequence they were stored with.
+    if ((settings.ReadFrameCounters(frameCounters) == OT_ERROR_NONE) &&
+        (frameCounters.mKeySequence == networkInfo.mKeySequence))
+    {
+        if (frameCounters.mMleFrameCounter > networkInfo.mMleFrameCounter)
+        {
+            networkInfo.mMleFrameCounter = frameCounters.mMleFrameCounter;
+        }
+
+        if (frameCounters.mMacFrameCounter > networkInfo.mMacFrameCounter)
+        {
+            networkInfo.mMacFrameCounter = frameCounters.mMacFrameCounter;
+        }
+    }
+#endif
+
     netif.GetKeyManager().SetCurrentKeySequence(networkInfo.mKeySequence);
     netif.GetKeyManager().SetMleFrameCounter(networkInfo.mMleFrameCounter);
     netif.GetKeyManager().SetMacFrameCounter(networkInfo.mMacFrameCounter);
@@ -432,6 +465,9 @@ otError Mle::Restore(void)
         netif.GetMle().SetRouterId(GetRouterId(GetRloc16()));
         netif.GetMle().SetPreviousPartitionId(networkInfo.mPreviousPartitionId);
         netif.GetMle().RestoreChildren();
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_ENABLE_ADDRESS_CACHE_PERSISTENCE
+        netif.GetAddressResolver().Restore();
+#endif
     }
 
 exit:
@@ -492,6 +528,27 @@ exit:
     return error;
 }
 
+#if OPENTHREAD_CONFIG_STORE_FRAME_COUNTERS_SEPARATELY
+otError Mle::StoreFrameCounters(void)
+{
+    KeyManager &            keyManager = GetNetif().GetKeyManager();
+    otError                 error      = OT_ERROR_NONE;
+    Settings::FrameCounters frameCounters;
+
+    frameCounters.mKeySequence     = keyManager.GetCurrentKeySequence();
+    frameCounters.mMleFrameCounter = keyManager.GetMleFrameCounter() + OPENTHREAD_CONFIG_STORE_FRAME_COUNTER_AHEAD;
+    frameCounters.mMacFrameCounter = keyManager.GetMacFrameCounter() + OPENTHREAD_CONFIG_STORE_FRAME_COUNTER_AHEAD;
+
+    SuccessOrExit(error = GetInstance().GetSettings().SaveFrameCounters(frameCounters));
+
+    keyManager.SetStoredMleFrameCounter(frameCounters.mMleFrameCounter);
+    keyManager.SetStoredMacFrameCounter(frameCounters.mMacFrameCounter);
+
+exit:
+    return error;
+}
+#endif
+
 otError Mle::Discover(uint32_t        aScanChannels,
                       uint16_t        aPanId,
                       bool            aJoiner,
@@ -809,6 +866,29 @@ exit:
     return OT_ERROR_NONE;
 }
 
+#if OPENTHREAD_CONFIG_ENABLE_CSL
+uint16_t Mle::GetCslPeriod(void) const
+{
+    return GetNetif().GetMac().GetCslPeriod();
+}
+
+otError Mle::SetCslPeriod(uint16_t aPeriod)
+{
+    otError error = OT_ERROR_NONE;
+
+    VerifyOrExit(GetCslPeriod() != aPeriod);
+    SuccessOrExit(error = GetNetif().GetMac().SetCslPeriod(aPeriod));
+
+    if (mRole == OT_DEVICE_ROLE_CHILD)
+    {
+        SendChildUpdateRequest();
+    }
+
+exit:
+    return error;
+}
+#endif // OPENTHREAD_CONFIG_ENABLE_CSL
+
 otError Mle::SetDeviceMode(uint8_t aDeviceMode)
 {
     otError error   = OT_ERROR_NONE;
@@ -1098,7 +1178,7 @@ void Mle::GenerateNonce(const Mac::ExtAddress &aMacAddr,
 Message *Mle::NewMleMessage(void)
 {
     Message *         message;
-    otMessageSettings settings = {false, static_cast<otMessagePriority>(kMleMessagePriority)};
+    otMessageSettings settings = {false, static_cast<otMessagePriority>(kMleMessagePriority), 0};
 
     message = mSocket.NewMessage(0, &settings);
     VerifyOrExit(message != NULL);
@@ -1415,6 +1495,32 @@ otError Mle::AppendXtalAccuracy(Message &aMessage)
 }
 #endif // OPENTHREAD_CONFIG_ENABLE_TIME_SYNC
 
+#if OPENTHREAD_CONFIG_ENABLE_CSL
+otError Mle::AppendCslPeriod(Message &aMessage)
+{
+    CslPeriodTlv tlv;
+
+    tlv.Init();
+    tlv.SetCslPeriod(GetCslPeriod());
+
+    return aMessage.Append(&tlv, sizeof(tlv));
+}
+#endif // OPENTHREAD_CONFIG_ENABLE_CSL
+
+#if OPENTHREAD_CONFIG_MLE_NETWORK_DATA_DELTA
+otError Mle::AppendNetworkDataDeltaRequest(Message &aMessage)
+{
+    NetworkData::Leader &leader = GetNetif().GetNetworkDataLeader();
+    NetworkDataDeltaTlv  tlv;
+
+    tlv.Init();
+    tlv.SetStable(!IsFullNetworkData());
+    tlv.SetBaseVersion(IsFullNetworkData() ? leader.GetVersion() : leader.GetStableVersion());
+
+    return aMessage.Append(&tlv, sizeof(Tlv) + tlv.GetLength());
+}
+#endif // OPENTHREAD_CONFIG_MLE_NETWORK_DATA_DELTA
+
 otError Mle::AppendActiveTimestamp(Message &aMessage)
 {
     ThreadNetif &             netif = GetNetif();
@@ -1493,6 +1599,9 @@ void Mle::HandleStateChanged(otChangedFlags aFlags)
     {
         if (IsFullThreadDevice())
         {
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MLE_NETWORK_DATA_DELTA
+            netif.GetNetworkDataLeader().UpdateDeltaBase();
+#endif
             netif.GetMle().HandleNetworkDataUpdateRouter();
         }
         else if ((aFlags & OT_CHANGED_THREAD_ROLE) == 0)
@@ -1826,72 +1935,59 @@ void Mle::HandleDelayedResponseTimer(Timer &aTimer)
 void Mle::HandleDelayedResponseTimer(void)
 {
     DelayedResponseHeader delayedResponse;
-    uint32_t              now         = TimerMilli::GetNow();
-    uint32_t              nextDelay   = 0xffffffff;
-    Message *             message     = mDelayedResponses.GetHead();
-    Message *             nextMessage = NULL;
+    uint32_t              now = TimerMilli::GetNow();
+    Message *             message;
 
-    while (message != NULL)
+    // The queue is sorted by send time, so only the messages at the head that are due need to be visited.
+    while ((message = mDelayedResponses.GetHead()) != NULL)
     {
-        nextMessage = message->GetNext();
         delayedResponse.ReadFrom(*message);
 
         if (delayedResponse.IsLater(now))
         {
-            // Calculate the next delay and choose the lowest.
-            if (delayedResponse.GetSendTime() - now < nextDelay)
-            {
-                nextDelay = delayedResponse.GetSendTime() - now;
-            }
+            mDelayedResponseTimer.Start(delayedResponse.GetSendTime() - now);
+            break;
         }
-        else
-        {
-            mDelayedResponses.Dequeue(*message);
 
-            // Remove the DelayedResponseHeader from the message.
-            DelayedResponseHeader::RemoveFrom(*message);
+        mDelayedResponses.Dequeue(*message);
 
-            // Send the message.
-            if (SendMessage(*message, delayedResponse.GetDestination()) == OT_ERROR_NONE)
-            {
-                LogMleMessage("Send delayed message", delayedResponse.GetDestination());
-            }
-            else
-            {
-                message->Free();
-            }
+        if (message == mDelayedDataResponse)
+        {
+            mDelayedDataResponse = NULL;
         }
 
-        message = nextMessage;
-    }
+        // Remove the DelayedResponseHeader from the message.
+        DelayedResponseHeader::RemoveFrom(*message);
 
-    if (nextDelay != 0xffffffff)
-    {
-        mDelayedResponseTimer.Start(nextDelay);
+        // Send the message.
+        if (SendMessage(*message, delayedResponse.GetDestination()) == OT_ERROR_NONE)
+        {
+            LogMleMessage("Send delayed message", delayedResponse.GetDestination());
+        }
+        else
+        {
+            message->Free();
+        }
     }
 }
 
 void Mle::RemoveDelayedDataResponseMessage(void)
 {
-    Message *             message = mDelayedResponses.GetHead();
     DelayedResponseHeader delayedResponse;
 
-    while (message != NULL)
-    {
-        delayedResponse.ReadFrom(*message);
+    // No more than one multicast MLE Data Response in Delayed Message Queue.
+    VerifyOrExit(mDelayedDataResponse != NULL);
 
-        if (message->GetSubType() == Message::kSubTypeMleDataResponse)
-        {
-            mDelayedResponses.Dequeue(*message);
-            message->Free();
-            LogMleMessage("Remove Delayed Data Response", delayedResponse.GetDestination());
+    delayedResponse.ReadFrom(*mDelayedDataResponse);
 
-            // no more than one multicast MLE Data Response in Delayed Message Queue.
-            break;
-        }
+    mDelayedResponses.Dequeue(*mDelayedDataResponse);
+    mDelayedDataResponse->Free();
+    mDelayedDataResponse = NULL;
 
-        message = message->GetNext();
-    }
+    LogMleMessage("Remove Delayed Data Response", delayedResponse.GetDestination());
+
+exit:
+    return;
 }
 
 otError Mle::SendParentRequest(ParentRequestType aType)
@@ -1984,6 +2080,9 @@ otError Mle::SendChildIdRequest(void)
     SuccessOrExit(error = AppendMode(*message, mDeviceMode));
     SuccessOrExit(error = AppendTimeout(*message, mTimeout));
     SuccessOrExit(error = AppendVersion(*message));
+#if OPENTHREAD_CONFIG_ENABLE_CSL
+    SuccessOrExit(error = AppendCslPeriod(*message));
+#endif
 
     if (!IsFullThreadDevice())
     {
@@ -2036,6 +2135,14 @@ otError Mle::SendDataRequest(const Ip6::Address &aDestination,
     SuccessOrExit(error = AppendActiveTimestamp(*message));
     SuccessOrExit(error = AppendPendingTimestamp(*message));
 
+#if OPENTHREAD_CONFIG_MLE_NETWORK_DATA_DELTA
+    // Let the responder send only the changes if the local Network Data is still a valid base.
+    if (!mRetrieveNewNetworkData && memchr(aTlvs, Tlv::kNetworkData, aTlvsLength) != NULL)
+    {
+        SuccessOrExit(error = AppendNetworkDataDeltaRequest(*message));
+    }
+#endif
+
     if (aDelay)
     {
         SuccessOrExit(error = AddDelayedResponse(*message, aDestination, aDelay));
@@ -2220,6 +2327,12 @@ otError Mle::SendChildUpdateRequest(void)
         SuccessOrExit(error = AppendSourceAddress(*message));
         SuccessOrExit(error = AppendLeaderData(*message));
         SuccessOrExit(error = AppendTimeout(*message, mTimeout));
+#if OPENTHREAD_CONFIG_ENABLE_CSL
+        SuccessOrExit(error = AppendCslPeriod(*message));
+#endif
+#if OPENTHREAD_CONFIG_MLE_NETWORK_DATA_DELTA
+        SuccessOrExit(error = AppendNetworkDataDeltaRequest(*message));
+#endif
         break;
 
     case OT_DEVICE_ROLE_DISABLED:
@@ -2416,10 +2529,10 @@ otError Mle::SendMessage(Message &aMessage, const Ip6::Address &aDestination)
     uint8_t          nonce[13];
     uint8_t          tag[4];
     uint8_t          tagLength;
-    Crypto::AesCcm   aesCcm;
-    uint8_t          buf[64];
-    uint16_t         length;
-    Ip6::MessageInfo messageInfo;
+    Crypto::AesCcm         aesCcm;
+    Message::WritableChunk chunk;
+    uint16_t               length;
+    Ip6::MessageInfo       messageInfo;
 
     aMessage.Read(0, sizeof(header), &header);
 
@@ -2435,7 +2548,11 @@ otError Mle::SendMessage(Message &aMessage, const Ip6::Address &aDestination)
         GenerateNonce(netif.GetMac().GetExtAddress(), netif.GetKeyManager().GetMleFrameCounter(),
                       Mac::Frame::kSecEncMic32, nonce);
 
+#if OPENTHREAD_CONFIG_ENABLE_KEY_SCHEDULE_CACHE
+        aesCcm.SetKey(netif.GetKeyManager().GetMleKeySchedule(keySequence));
+#else
         aesCcm.SetKey(netif.GetKeyManager().GetCurrentMleKey(), 16);
+#endif
         error = aesCcm.Init(16 + 16 + header.GetHeaderLength(), aMessage.GetLength() - (header.GetLength() - 1),
                             sizeof(tag), nonce, sizeof(nonce));
         assert(error == OT_ERROR_NONE);
@@ -2444,16 +2561,18 @@ otError Mle::SendMessage(Message &aMessage, const Ip6::Address &aDestination)
         aesCcm.Header(&aDestination, sizeof(aDestination));
         aesCcm.Header(header.GetBytes() + 1, header.GetHeaderLength());
 
-        aMessage.SetOffset(header.GetLength() - 1);
+        // Encrypt the payload in place, one message buffer chunk at a time.
+        length = aMessage.GetLength() - (header.GetLength() - 1);
+        aMessage.GetFirstChunk(header.GetLength() - 1, length, chunk);
 
-        while (aMessage.GetOffset() < aMessage.GetLength())
+        while (chunk.mLength > 0)
         {
-            length = aMessage.Read(aMessage.GetOffset(), sizeof(buf), buf);
-            aesCcm.Payload(buf, buf, length, true);
-            aMessage.Write(aMessage.GetOffset(), length, buf);
-            aMessage.MoveOffset(length);
+            aesCcm.Payload(chunk.GetData(), chunk.GetData(), chunk.mLength, true);
+            aMessage.GetNextChunk(length, chunk);
         }
 
+        aMessage.SetOffset(aMessage.GetLength());
+
         tagLength = sizeof(tag);
         aesCcm.Finalize(tag, &tagLength);
         SuccessOrExit(error = aMessage.Append(tag, tagLength));
@@ -2475,28 +2594,43 @@ exit:
 
 otError Mle::AddDelayedResponse(Message &aMessage, const Ip6::Address &aDestination, uint16_t aDelay)
 {
-    otError  error = OT_ERROR_NONE;
-    uint32_t alarmFireTime;
-    uint32_t sendTime = TimerMilli::GetNow() + aDelay;
+    otError               error    = OT_ERROR_NONE;
+    uint32_t              sendTime = TimerMilli::GetNow() + aDelay;
+    DelayedResponseHeader queued;
+    Message *             next;
 
     // Append the message with DelayedRespnoseHeader and add to the list.
     DelayedResponseHeader delayedResponse(sendTime, aDestination);
     SuccessOrExit(error = delayedResponse.AppendTo(aMessage));
-    mDelayedResponses.Enqueue(aMessage);
 
-    if (mDelayedResponseTimer.IsRunning())
+    // Keep the list sorted by send time (messages with equal send time stay in the order they were added).
+    for (next = mDelayedResponses.GetHead(); next != NULL; next = next->GetNext())
     {
-        // If timer is already running, check if it should be restarted with earlier fire time.
-        alarmFireTime = mDelayedResponseTimer.GetFireTime();
+        queued.ReadFrom(*next);
 
-        if (delayedResponse.IsEarlier(alarmFireTime))
+        if (queued.IsLater(sendTime))
         {
-            mDelayedResponseTimer.Start(aDelay);
+            break;
         }
     }
+
+    if (next != NULL)
+    {
+        mDelayedResponses.EnqueueBefore(aMessage, *next);
+    }
     else
     {
-        // Otherwise just set the timer.
+        mDelayedResponses.Enqueue(aMessage);
+    }
+
+    if (aMessage.GetSubType() == Message::kSubTypeMleDataResponse)
+    {
+        mDelayedDataResponse = &aMessage;
+    }
+
+    // The timer always tracks the head of the list, so it only needs restarting when the new message became the head.
+    if (mDelayedResponses.GetHead() == &aMessage)
+    {
         mDelayedResponseTimer.Start(aDelay);
     }
 
@@ -2512,23 +2646,29 @@ void Mle::HandleUdpReceive(void *aContext, otMessage *aMessage, const otMessageI
 
 void Mle::HandleUdpReceive(Message &aMessage, const Ip6::MessageInfo &aMessageInfo)
 {
-    ThreadNetif &   netif = GetNetif();
-    MleRouter &     mle   = netif.GetMle();
-    Header          header;
-    uint32_t        keySequence;
-    const uint8_t * mleKey;
-    uint32_t        frameCounter;
-    uint8_t         messageTag[4];
-    uint8_t         nonce[13];
-    Mac::ExtAddress macAddr;
-    Crypto::AesCcm  aesCcm;
-    uint16_t        mleOffset;
-    uint8_t         buf[64];
-    uint16_t        length;
-    uint8_t         tag[4];
-    uint8_t         tagLength;
-    uint8_t         command;
-    Neighbor *      neighbor;
+    ThreadNetif &          netif = GetNetif();
+    MleRouter &            mle   = netif.GetMle();
+    Header                 header;
+    uint32_t               keySequence;
+#if !OPENTHREAD_CONFIG_ENABLE_KEY_SCHEDULE_CACHE
+    const uint8_t *        mleKey;
+#endif
+    uint32_t               frameCounter;
+    uint8_t                messageTag[4];
+    uint8_t                nonce[13];
+    Mac::ExtAddress        macAddr;
+    Crypto::AesCcm         aesCcm;
+    uint16_t               mleOffset;
+#ifndef FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION
+    Message::WritableChunk chunk;
+#else
+    uint8_t                buf[64];
+#endif
+    uint16_t               length;
+    uint8_t                tag[4];
+    uint8_t                tagLength;
+    uint8_t                command;
+    Neighbor *             neighbor;
 
     VerifyOrExit(aMessageInfo.GetLinkInfo() != NULL);
     VerifyOrExit(aMessageInfo.GetHopLimit() == kMleHopLimit);
@@ -2561,6 +2701,7 @@ void Mle::HandleUdpReceive(Message &aMessage, const Ip6::MessageInfo &aMessageIn
 
     keySequence = header.GetKeyId();
 
+#if !OPENTHREAD_CONFIG_ENABLE_KEY_SCHEDULE_CACHE
     if (keySequence == netif.GetKeyManager().GetCurrentKeySequence())
     {
         mleKey = netif.GetKeyManager().GetCurrentMleKey();
@@ -2569,6 +2710,7 @@ void Mle::HandleUdpReceive(Message &aMessage, const Ip6::MessageInfo &aMessageIn
     {
         mleKey = netif.GetKeyManager().GetTemporaryMleKey(keySequence);
     }
+#endif
 
     VerifyOrExit(aMessage.GetOffset() + header.GetLength() + sizeof(messageTag) <= aMessage.GetLength());
     aMessage.MoveOffset(header.GetLength() - 1);
@@ -2580,7 +2722,11 @@ void Mle::HandleUdpReceive(Message &aMessage, const Ip6::MessageInfo &aMessageIn
     frameCounter = header.GetFrameCounter();
     GenerateNonce(macAddr, frameCounter, Mac::Frame::kSecEncMic32, nonce);
 
+#if OPENTHREAD_CONFIG_ENABLE_KEY_SCHEDULE_CACHE
+    aesCcm.SetKey(netif.GetKeyManager().GetMleKeySchedule(keySequence));
+#else
     aesCcm.SetKey(mleKey, 16);
+#endif
     SuccessOrExit(
         aesCcm.Init(sizeof(aMessageInfo.GetPeerAddr()) + sizeof(aMessageInfo.GetSockAddr()) + header.GetHeaderLength(),
                     aMessage.GetLength() - aMessage.GetOffset(), sizeof(messageTag), nonce, sizeof(nonce)));
@@ -2591,15 +2737,24 @@ void Mle::HandleUdpReceive(Message &aMessage, const Ip6::MessageInfo &aMessageIn
 
     mleOffset = aMessage.GetOffset();
 
+#ifndef FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION
+    // Decrypt the payload in place, one message buffer chunk at a time.
+    length = aMessage.GetLength() - mleOffset;
+    aMessage.GetFirstChunk(mleOffset, length, chunk);
+
+    while (chunk.mLength > 0)
+    {
+        aesCcm.Payload(chunk.GetData(), chunk.GetData(), chunk.mLength, false);
+        aMessage.GetNextChunk(length, chunk);
+    }
+#else
     while (aMessage.GetOffset() < aMessage.GetLength())
     {
         length = aMessage.Read(aMessage.GetOffset(), sizeof(buf), buf);
         aesCcm.Payload(buf, buf, length, false);
-#ifndef FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION
-        aMessage.Write(aMessage.GetOffset(), length, buf);
-#endif
         aMessage.MoveOffset(length);
     }
+#endif
 
     tagLength = sizeof(tag);
     aesCcm.Finalize(tag, &tagLength);
@@ -2772,15 +2927,16 @@ otError Mle::HandleAdvertisement(const Message &aMessage, const Ip6::MessageInfo
     RouteTlv         route;
     uint8_t          tlvs[] = {Tlv::kNetworkData};
     uint16_t         delay;
+    TlvIndex         tlvIndex(aMessage);
 
     // Source Address
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kSourceAddress, sizeof(sourceAddress), sourceAddress));
+    SuccessOrExit(error = tlvIndex.Get(Tlv::kSourceAddress, sizeof(sourceAddress), sourceAddress));
     VerifyOrExit(sourceAddress.IsValid(), error = OT_ERROR_PARSE);
 
     LogMleMessage("Receive Advertisement", aMessageInfo.GetPeerAddr(), sourceAddress.GetRloc16());
 
     // Leader Data
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kLeaderData, sizeof(leaderData), leaderData));
+    SuccessOrExit(error = tlvIndex.Get(Tlv::kLeaderData, sizeof(leaderData), leaderData));
     VerifyOrExit(leaderData.IsValid(), error = OT_ERROR_PARSE);
 
     aMessageInfo.GetPeerAddr().ToExtAddress(macAddr);
@@ -2822,7 +2978,7 @@ otError Mle::HandleAdvertisement(const Message &aMessage, const Ip6::MessageInfo
         {
             SetLeaderData(leaderData.GetPartitionId(), leaderData.GetWeighting(), leaderData.GetLeaderRouterId());
 
-            if (IsFullThreadDevice() && (Tlv::GetTlv(aMessage, Tlv::kRoute, sizeof(route), route) == OT_ERROR_NONE) &&
+            if (IsFullThreadDevice() && (tlvIndex.Get(Tlv::kRoute, sizeof(route), route) == OT_ERROR_NONE) &&
                 route.IsValid())
             {
                 // Overwrite Route Data
@@ -2888,9 +3044,10 @@ otError Mle::HandleLeaderData(const Message &aMessage, const Ip6::MessageInfo &a
     uint16_t            pendingDatasetOffset = 0;
     bool                dataRequest          = false;
     Tlv                 tlv;
+    TlvIndex            tlvIndex(aMessage);
 
     // Leader Data
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kLeaderData, sizeof(leaderData), leaderData));
+    SuccessOrExit(error = tlvIndex.Get(Tlv::kLeaderData, sizeof(leaderData), leaderData));
     VerifyOrExit(leaderData.IsValid(), error = OT_ERROR_PARSE);
 
     if ((leaderData.GetPartitionId() != mLeaderData.GetPartitionId()) ||
@@ -2924,7 +3081,7 @@ otError Mle::HandleLeaderData(const Message &aMessage, const Ip6::MessageInfo &a
     }
 
     // Active Timestamp
-    if (Tlv::GetTlv(aMessage, Tlv::kActiveTimestamp, sizeof(activeTimestamp), activeTimestamp) == OT_ERROR_NONE)
+    if (tlvIndex.Get(Tlv::kActiveTimestamp, sizeof(activeTimestamp), activeTimestamp) == OT_ERROR_NONE)
     {
         const MeshCoP::Timestamp *timestamp;
 
@@ -2934,7 +3091,7 @@ otError Mle::HandleLeaderData(const Message &aMessage, const Ip6::MessageInfo &a
         // if received timestamp does not match the local value and message does not contain the dataset,
         // send MLE Data Request
         if ((timestamp == NULL || timestamp->Compare(activeTimestamp) != 0) &&
-            (Tlv::GetOffset(aMessage, Tlv::kActiveDataset, activeDatasetOffset) != OT_ERROR_NONE))
+            (tlvIndex.GetOffset(Tlv::kActiveDataset, activeDatasetOffset) != OT_ERROR_NONE))
         {
             ExitNow(dataRequest = true);
         }
@@ -2945,7 +3102,7 @@ otError Mle::HandleLeaderData(const Message &aMessage, const Ip6::MessageInfo &a
     }
 
     // Pending Timestamp
-    if (Tlv::GetTlv(aMessage, Tlv::kPendingTimestamp, sizeof(pendingTimestamp), pendingTimestamp) == OT_ERROR_NONE)
+    if (tlvIndex.Get(Tlv::kPendingTimestamp, sizeof(pendingTimestamp), pendingTimestamp) == OT_ERROR_NONE)
     {
         const MeshCoP::Timestamp *timestamp;
 
@@ -2955,7 +3112,7 @@ otError Mle::HandleLeaderData(const Message &aMessage, const Ip6::MessageInfo &a
         // if received timestamp does not match the local value and message does not contain the dataset,
         // send MLE Data Request
         if ((timestamp == NULL || timestamp->Compare(pendingTimestamp) != 0) &&
-            (Tlv::GetOffset(aMessage, Tlv::kPendingDataset, pendingDatasetOffset) != OT_ERROR_NONE))
+            (tlvIndex.GetOffset(Tlv::kPendingDataset, pendingDatasetOffset) != OT_ERROR_NONE))
         {
             ExitNow(dataRequest = true);
         }
@@ -2965,13 +3122,26 @@ otError Mle::HandleLeaderData(const Message &aMessage, const Ip6::MessageInfo &a
         pendingTimestamp.SetLength(0);
     }
 
-    if (Tlv::GetOffset(aMessage, Tlv::kNetworkData, networkDataOffset) == OT_ERROR_NONE)
+    if (tlvIndex.GetOffset(Tlv::kNetworkData, networkDataOffset) == OT_ERROR_NONE)
     {
         error =
             netif.GetNetworkDataLeader().SetNetworkData(leaderData.GetDataVersion(), leaderData.GetStableDataVersion(),
                                                         !IsFullNetworkData(), aMessage, networkDataOffset);
         SuccessOrExit(error);
     }
+#if OPENTHREAD_CONFIG_MLE_NETWORK_DATA_DELTA
+    else if (!mRetrieveNewNetworkData && tlvIndex.GetOffset(Tlv::kNetworkDataDelta, networkDataOffset) == OT_ERROR_NONE)
+    {
+        // A delta that does not apply to the local Network Data is not an error, the full data is requested instead.
+        if (netif.GetNetworkDataLeader().ApplyNetworkDataDelta(leaderData.GetDataVersion(),
+                                                               leaderData.GetStableDataVersion(), !IsFullNetworkData(),
+                                                               aMessage, networkDataOffset) != OT_ERROR_NONE)
+        {
+            mRetrieveNewNetworkData = true;
+            ExitNow(dataRequest = true);
+        }
+    }
+#endif
     else
     {
         ExitNow(dataRequest = true);
@@ -3056,11 +3226,32 @@ bool Mle::IsBetterParent(uint16_t aRloc16, uint8_t aLinkQuality, uint8_t aLinkMa
         ExitNow(rval = IsActiveRouter(aRloc16));
     }
 
+#if OPENTHREAD_CONFIG_ENABLE_ETX_LINK_COST
+    // The leader cost reflects the frame delivery on the candidate's path to the leader.
+    if (aConnectivityTlv.GetLeaderCost() != mParentLeaderCost)
+    {
+        ExitNow(rval = (aConnectivityTlv.GetLeaderCost() < mParentLeaderCost));
+    }
+#endif
+
     if (aConnectivityTlv.GetParentPriority() != mParentPriority)
     {
         ExitNow(rval = (aConnectivityTlv.GetParentPriority() > mParentPriority));
     }
 
+#if OPENTHREAD_CONFIG_ENABLE_PARENT_LOAD_BALANCING
+    // Spread children over parents, ignoring small load differences to avoid flapping between similar parents.
+    if (aConnectivityTlv.GetParentLoad() + kParentLoadHysteresis <= mParentLoad)
+    {
+        ExitNow(rval = true);
+    }
+
+    if (mParentLoad + kParentLoadHysteresis <= aConnectivityTlv.GetParentLoad())
+    {
+        ExitNow(rval = false);
+    }
+#endif
+
     if (aConnectivityTlv.GetLinkQuality3() != mParentLinkQuality3)
     {
         ExitNow(rval = (aConnectivityTlv.GetLinkQuality3() > mParentLinkQuality3));
@@ -3104,18 +3295,19 @@ otError Mle::HandleParentResponse(const Message &aMessage, const Ip6::MessageInf
     MleFrameCounterTlv      mleFrameCounter;
     ChallengeTlv            challenge;
     Mac::ExtAddress         extAddress;
+    TlvIndex                tlvIndex(aMessage);
 #if OPENTHREAD_CONFIG_ENABLE_TIME_SYNC
     TimeParameterTlv timeParameter;
 #endif
 
     // Source Address
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kSourceAddress, sizeof(sourceAddress), sourceAddress));
+    SuccessOrExit(error = tlvIndex.Get(Tlv::kSourceAddress, sizeof(sourceAddress), sourceAddress));
     VerifyOrExit(sourceAddress.IsValid(), error = OT_ERROR_PARSE);
 
     LogMleMessage("Receive Parent Response", aMessageInfo.GetPeerAddr(), sourceAddress.GetRloc16());
 
     // Response
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kResponse, sizeof(response), response));
+    SuccessOrExit(error = tlvIndex.Get(Tlv::kResponse, sizeof(response), response));
     VerifyOrExit(response.IsValid() &&
                      memcmp(response.GetResponse(), mParentRequest.mChallenge, response.GetLength()) == 0,
                  error = OT_ERROR_PARSE);
@@ -3128,11 +3320,11 @@ otError Mle::HandleParentResponse(const Message &aMessage, const Ip6::MessageInf
     }
 
     // Leader Data
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kLeaderData, sizeof(leaderData), leaderData));
+    SuccessOrExit(error = tlvIndex.Get(Tlv::kLeaderData, sizeof(leaderData), leaderData));
     VerifyOrExit(leaderData.IsValid(), error = OT_ERROR_PARSE);
 
     // Link Quality
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kLinkMargin, sizeof(linkMarginTlv), linkMarginTlv));
+    SuccessOrExit(error = tlvIndex.Get(Tlv::kLinkMargin, sizeof(linkMarginTlv), linkMarginTlv));
     VerifyOrExit(linkMarginTlv.IsValid(), error = OT_ERROR_PARSE);
 
     linkMargin = LinkQualityInfo::ConvertRssToLinkMargin(netif.GetMac().GetNoiseFloor(), linkInfo->mRss);
@@ -3147,7 +3339,7 @@ otError Mle::HandleParentResponse(const Message &aMessage, const Ip6::MessageInf
     VerifyOrExit(mAttachState != kAttachStateParentRequestRouter || linkQuality == 3);
 
     // Connectivity
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kConnectivity, sizeof(connectivity), connectivity));
+    SuccessOrExit(error = tlvIndex.Get(Tlv::kConnectivity, sizeof(connectivity), connectivity));
     VerifyOrExit(connectivity.IsValid(), error = OT_ERROR_PARSE);
 
     // Share data with application, if requested.
@@ -3218,11 +3410,11 @@ otError Mle::HandleParentResponse(const Message &aMessage, const Ip6::MessageInf
     }
 
     // Link Frame Counter
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kLinkFrameCounter, sizeof(linkFrameCounter), linkFrameCounter));
+    SuccessOrExit(error = tlvIndex.Get(Tlv::kLinkFrameCounter, sizeof(linkFrameCounter), linkFrameCounter));
     VerifyOrExit(linkFrameCounter.IsValid(), error = OT_ERROR_PARSE);
 
     // Mle Frame Counter
-    if (Tlv::GetTlv(aMessage, Tlv::kMleFrameCounter, sizeof(mleFrameCounter), mleFrameCounter) == OT_ERROR_NONE)
+    if (tlvIndex.Get(Tlv::kMleFrameCounter, sizeof(mleFrameCounter), mleFrameCounter) == OT_ERROR_NONE)
     {
         VerifyOrExit(mleFrameCounter.IsValid());
     }
@@ -3234,7 +3426,7 @@ otError Mle::HandleParentResponse(const Message &aMessage, const Ip6::MessageInf
 #if OPENTHREAD_CONFIG_ENABLE_TIME_SYNC
 
     // Time Parameter
-    if (Tlv::GetTlv(aMessage, Tlv::kTimeParameter, sizeof(timeParameter), timeParameter) == OT_ERROR_NONE)
+    if (tlvIndex.Get(Tlv::kTimeParameter, sizeof(timeParameter), timeParameter) == OT_ERROR_NONE)
     {
         VerifyOrExit(timeParameter.IsValid());
 
@@ -3253,7 +3445,7 @@ otError Mle::HandleParentResponse(const Message &aMessage, const Ip6::MessageInf
 #endif // OPENTHREAD_CONFIG_ENABLE_TIME_SYNC
 
     // Challenge
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kChallenge, sizeof(challenge), challenge));
+    SuccessOrExit(error = tlvIndex.Get(Tlv::kChallenge, sizeof(challenge), challenge));
     VerifyOrExit(challenge.IsValid(), error = OT_ERROR_PARSE);
     memcpy(mChildIdRequest.mChallenge, challenge.GetChallenge(), challenge.GetLength());
     mChildIdRequest.mChallengeLength = challenge.GetLength();
@@ -3272,6 +3464,9 @@ otError Mle::HandleParentResponse(const Message &aMessage, const Ip6::MessageInf
     mParentCandidate.SetKeySequence(aKeySequence);
 
     mParentPriority     = connectivity.GetParentPriority();
+#if OPENTHREAD_CONFIG_ENABLE_PARENT_LOAD_BALANCING
+    mParentLoad         = connectivity.GetParentLoad();
+#endif
     mParentLinkQuality3 = connectivity.GetLinkQuality3();
     mParentLinkQuality2 = connectivity.GetLinkQuality2();
     mParentLinkQuality1 = connectivity.GetLinkQuality1();
@@ -3303,9 +3498,10 @@ otError Mle::HandleChildIdResponse(const Message &aMessage, const Ip6::MessageIn
     Tlv                 tlv;
     uint16_t            networkDataOffset;
     uint16_t            offset;
+    TlvIndex            tlvIndex(aMessage);
 
     // Source Address
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kSourceAddress, sizeof(sourceAddress), sourceAddress));
+    SuccessOrExit(error = tlvIndex.Get(Tlv::kSourceAddress, sizeof(sourceAddress), sourceAddress));
     VerifyOrExit(sourceAddress.IsValid(), error = OT_ERROR_PARSE);
 
     LogMleMessage("Receive Child ID Response", aMessageInfo.GetPeerAddr(), sourceAddress.GetRloc16());
@@ -3313,24 +3509,24 @@ otError Mle::HandleChildIdResponse(const Message &aMessage, const Ip6::MessageIn
     VerifyOrExit(mAttachState == kAttachStateChildIdRequest);
 
     // Leader Data
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kLeaderData, sizeof(leaderData), leaderData));
+    SuccessOrExit(error = tlvIndex.Get(Tlv::kLeaderData, sizeof(leaderData), leaderData));
     VerifyOrExit(leaderData.IsValid(), error = OT_ERROR_PARSE);
 
     // ShortAddress
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kAddress16, sizeof(shortAddress), shortAddress));
+    SuccessOrExit(error = tlvIndex.Get(Tlv::kAddress16, sizeof(shortAddress), shortAddress));
     VerifyOrExit(shortAddress.IsValid(), error = OT_ERROR_PARSE);
 
     // Network Data
-    error = Tlv::GetOffset(aMessage, Tlv::kNetworkData, networkDataOffset);
+    error = tlvIndex.GetOffset(Tlv::kNetworkData, networkDataOffset);
     SuccessOrExit(error);
 
     // Active Timestamp
-    if (Tlv::GetTlv(aMessage, Tlv::kActiveTimestamp, sizeof(activeTimestamp), activeTimestamp) == OT_ERROR_NONE)
+    if (tlvIndex.Get(Tlv::kActiveTimestamp, sizeof(activeTimestamp), activeTimestamp) == OT_ERROR_NONE)
     {
         VerifyOrExit(activeTimestamp.IsValid(), error = OT_ERROR_PARSE);
 
         // Active Dataset
-        if (Tlv::GetOffset(aMessage, Tlv::kActiveDataset, offset) == OT_ERROR_NONE)
+        if (tlvIndex.GetOffset(Tlv::kActiveDataset, offset) == OT_ERROR_NONE)
         {
             aMessage.Read(offset, sizeof(tlv), &tlv);
             netif.GetActiveDataset().Set(activeTimestamp, aMessage, offset + sizeof(tlv), tlv.GetLength());
@@ -3344,12 +3540,12 @@ otError Mle::HandleChildIdResponse(const Message &aMessage, const Ip6::MessageIn
     }
 
     // Pending Timestamp
-    if (Tlv::GetTlv(aMessage, Tlv::kPendingTimestamp, sizeof(pendingTimestamp), pendingTimestamp) == OT_ERROR_NONE)
+    if (tlvIndex.Get(Tlv::kPendingTimestamp, sizeof(pendingTimestamp), pendingTimestamp) == OT_ERROR_NONE)
     {
         VerifyOrExit(pendingTimestamp.IsValid(), error = OT_ERROR_PARSE);
 
         // Pending Dataset
-        if (Tlv::GetOffset(aMessage, Tlv::kPendingDataset, offset) == OT_ERROR_NONE)
+        if (tlvIndex.GetOffset(Tlv::kPendingDataset, offset) == OT_ERROR_NONE)
         {
             aMessage.Read(offset, sizeof(tlv), &tlv);
             netif.GetPendingDataset().Set(pendingTimestamp, aMessage, offset + sizeof(tlv), tlv.GetLength());
@@ -3385,7 +3581,7 @@ otError Mle::HandleChildIdResponse(const Message &aMessage, const Ip6::MessageIn
     }
 
     // Route
-    if ((Tlv::GetTlv(aMessage, Tlv::kRoute, sizeof(route), route) == OT_ERROR_NONE) && IsFullThreadDevice())
+    if ((tlvIndex.Get(Tlv::kRoute, sizeof(route), route) == OT_ERROR_NONE) && IsFullThreadDevice())
     {
         SuccessOrExit(error = netif.GetMle().ProcessRouteTlv(route));
     }
@@ -3425,9 +3621,10 @@ otError Mle::HandleChildUpdateRequest(const Message &aMessage, const Ip6::Messag
     TlvRequestTlv    tlvRequest;
     uint8_t          tlvs[kMaxResponseTlvs] = {};
     uint8_t          numTlvs                = 0;
+    TlvIndex         tlvIndex(aMessage);
 
     // Source Address
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kSourceAddress, sizeof(sourceAddress), sourceAddress));
+    SuccessOrExit(error = tlvIndex.Get(Tlv::kSourceAddress, sizeof(sourceAddress), sourceAddress));
     VerifyOrExit(sourceAddress.IsValid(), error = OT_ERROR_PARSE);
 
     LogMleMessage("Receive Child Update Request from parent", aMessageInfo.GetPeerAddr(), sourceAddress.GetRloc16());
@@ -3438,7 +3635,7 @@ otError Mle::HandleChildUpdateRequest(const Message &aMessage, const Ip6::Messag
     SuccessOrExit(error = HandleLeaderData(aMessage, aMessageInfo));
 
     // Status
-    if (Tlv::GetTlv(aMessage, Tlv::kStatus, sizeof(status), status) == OT_ERROR_NONE)
+    if (tlvIndex.Get(Tlv::kStatus, sizeof(status), status) == OT_ERROR_NONE)
     {
         VerifyOrExit(status.IsValid(), error = OT_ERROR_PARSE);
 
@@ -3453,7 +3650,7 @@ otError Mle::HandleChildUpdateRequest(const Message &aMessage, const Ip6::Messag
     }
 
     // TLV Request
-    if (Tlv::GetTlv(aMessage, Tlv::kTlvRequest, sizeof(tlvRequest), tlvRequest) == OT_ERROR_NONE)
+    if (tlvIndex.Get(Tlv::kTlvRequest, sizeof(tlvRequest), tlvRequest) == OT_ERROR_NONE)
     {
         VerifyOrExit(tlvRequest.IsValid() && tlvRequest.GetLength() <= sizeof(tlvs), error = OT_ERROR_PARSE);
         memcpy(tlvs, tlvRequest.GetTlvs(), tlvRequest.GetLength());
@@ -3461,7 +3658,7 @@ otError Mle::HandleChildUpdateRequest(const Message &aMessage, const Ip6::Messag
     }
 
     // Challenge
-    if (Tlv::GetTlv(aMessage, Tlv::kChallenge, sizeof(challenge), challenge) == OT_ERROR_NONE)
+    if (tlvIndex.Get(Tlv::kChallenge, sizeof(challenge), challenge) == OT_ERROR_NONE)
     {
         VerifyOrExit(challenge.IsValid(), error = OT_ERROR_PARSE);
         VerifyOrExit(static_cast<size_t>(numTlvs + 3) <= sizeof(tlvs), error = OT_ERROR_NO_BUFS);
@@ -3487,18 +3684,19 @@ otError Mle::HandleChildUpdateResponse(const Message &aMessage, const Ip6::Messa
     MleFrameCounterTlv  mleFrameCounter;
     SourceAddressTlv    sourceAddress;
     TimeoutTlv          timeout;
+    TlvIndex            tlvIndex(aMessage);
 
     LogMleMessage("Receive Child Update Response from parent", aMessageInfo.GetPeerAddr());
 
     // Status
-    if (Tlv::GetTlv(aMessage, Tlv::kStatus, sizeof(status), status) == OT_ERROR_NONE)
+    if (tlvIndex.Get(Tlv::kStatus, sizeof(status), status) == OT_ERROR_NONE)
     {
         BecomeDetached();
         ExitNow();
     }
 
     // Mode
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kMode, sizeof(mode), mode));
+    SuccessOrExit(error = tlvIndex.Get(Tlv::kMode, sizeof(mode), mode));
     VerifyOrExit(mode.IsValid(), error = OT_ERROR_PARSE);
     VerifyOrExit(mode.GetMode() == mDeviceMode, error = OT_ERROR_DROP);
 
@@ -3513,16 +3711,15 @@ otError Mle::HandleChildUpdateResponse(const Message &aMessage, const Ip6::Messa
     {
     case OT_DEVICE_ROLE_DETACHED:
         // Response
-        SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kResponse, sizeof(response), response));
+        SuccessOrExit(error = tlvIndex.Get(Tlv::kResponse, sizeof(response), response));
         VerifyOrExit(response.IsValid(), error = OT_ERROR_PARSE);
         VerifyOrExit(memcmp(response.GetResponse(), mParentRequest.mChallenge, sizeof(mParentRequest.mChallenge)) == 0,
                      error = OT_ERROR_DROP);
 
-        SuccessOrExit(error =
-                          Tlv::GetTlv(aMessage, Tlv::kLinkFrameCounter, sizeof(linkFrameCounter), linkFrameCounter));
+        SuccessOrExit(error = tlvIndex.Get(Tlv::kLinkFrameCounter, sizeof(linkFrameCounter), linkFrameCounter));
         VerifyOrExit(linkFrameCounter.IsValid(), error = OT_ERROR_PARSE);
 
-        if (Tlv::GetTlv(aMessage, Tlv::kMleFrameCounter, sizeof(mleFrameCounter), mleFrameCounter) == OT_ERROR_NONE)
+        if (tlvIndex.Get(Tlv::kMleFrameCounter, sizeof(mleFrameCounter), mleFrameCounter) == OT_ERROR_NONE)
         {
             VerifyOrExit(mleFrameCounter.IsValid(), error = OT_ERROR_PARSE);
         }
@@ -3534,6 +3731,11 @@ otError Mle::HandleChildUpdateResponse(const Message &aMessage, const Ip6::Messa
         mParent.SetLinkFrameCounter(linkFrameCounter.GetFrameCounter());
         mParent.SetMleFrameCounter(mleFrameCounter.GetFrameCounter());
 
+        if (mAttachState == kAttachStateSynchronize)
+        {
+            mCounters.mParentSyncSuccesses++;
+        }
+
         mParent.SetState(Neighbor::kStateValid);
         SetStateChild(GetRloc16());
 
@@ -3543,7 +3745,7 @@ otError Mle::HandleChildUpdateResponse(const Message &aMessage, const Ip6::Messa
 
     case OT_DEVICE_ROLE_CHILD:
         // Source Address
-        SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kSourceAddress, sizeof(sourceAddress), sourceAddress));
+        SuccessOrExit(error = tlvIndex.Get(Tlv::kSourceAddress, sizeof(sourceAddress), sourceAddress));
         VerifyOrExit(sourceAddress.IsValid(), error = OT_ERROR_PARSE);
 
         if (GetRouterId(sourceAddress.GetRloc16()) != GetRouterId(GetRloc16()))
@@ -3556,7 +3758,7 @@ otError Mle::HandleChildUpdateResponse(const Message &aMessage, const Ip6::Messa
         SuccessOrExit(error = HandleLeaderData(aMessage, aMessageInfo));
 
         // Timeout optional
-        if (Tlv::GetTlv(aMessage, Tlv::kTimeout, sizeof(timeout), timeout) == OT_ERROR_NONE)
+        if (tlvIndex.Get(Tlv::kTimeout, sizeof(timeout), timeout) == OT_ERROR_NONE)
         {
             VerifyOrExit(timeout.IsValid(), error = OT_ERROR_PARSE);
             mTimeout = timeout.GetTimeout();
@@ -3598,17 +3800,18 @@ otError Mle::HandleAnnounce(const Message &aMessage, const Ip6::MessageInfo &aMe
     PanIdTlv                  panIdTlv;
     uint8_t                   channel;
     uint16_t                  panId;
+    TlvIndex                  tlvIndex(aMessage);
 
     LogMleMessage("Receive Announce", aMessageInfo.GetPeerAddr());
 
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kChannel, sizeof(channelTlv), channelTlv));
+    SuccessOrExit(error = tlvIndex.Get(Tlv::kChannel, sizeof(channelTlv), channelTlv));
     VerifyOrExit(channelTlv.IsValid() && channelTlv.GetChannelPage() == OT_RADIO_CHANNEL_PAGE, error = OT_ERROR_PARSE);
     channel = static_cast<uint8_t>(channelTlv.GetChannel());
 
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kActiveTimestamp, sizeof(timestamp), timestamp));
+    SuccessOrExit(error = tlvIndex.Get(Tlv::kActiveTimestamp, sizeof(timestamp), timestamp));
     VerifyOrExit(timestamp.IsValid(), error = OT_ERROR_PARSE);
 
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kPanId, sizeof(panIdTlv), panIdTlv));
+    SuccessOrExit(error = tlvIndex.Get(Tlv::kPanId, sizeof(panIdTlv), panIdTlv));
     VerifyOrExit(panIdTlv.IsValid(), error = OT_ERROR_PARSE);
     panId = panIdTlv.GetPanId();
 
@@ -3759,11 +3962,8 @@ otError Mle::HandleDiscoveryResponse(const Message &aMessage, const Ip6::Message
                 MeshCoP::ComputeJoinerId(extaddr, extaddr);
 
                 // Compute bloom filter
-                for (size_t i = 0; i < sizeof(extaddr.m8); i++)
-                {
-                    ccitt.Update(extaddr.m8[i]);
-                    ansi.Update(extaddr.m8[i]);
-                }
+                ccitt.Update(extaddr.m8, sizeof(extaddr.m8));
+                ansi.Update(extaddr.m8, sizeof(extaddr.m8));
 
                 // Drop responses that don't match the bloom filter
                 if (!steeringData.GetBit(ccitt.Get() % steeringData.GetNumBits()) ||
@@ -533,6 +533,18 @@ public:
      */
     otError Store(void);
 
+#if OPENTHREAD_CONFIG_STORE_FRAME_COUNTERS_SEPARATELY
+    /**
+     * This method stores the MAC and MLE frame counters into non-volatile memory without rewriting the rest of the
+     * network information.
+     *
+     * @retval OT_ERROR_NONE       Successfully stored the frame counters.
+     * @retval OT_ERROR_NO_BUFS    Could not store the frame counters due to insufficient memory space.
+     *
+     */
+    otError StoreFrameCounters(void);
+#endif
+
     /**
      * This function pointer is called on receiving an MLE Discovery Response message.
      *
@@ -817,6 +829,27 @@ public:
      */
     otError SetTimeout(uint32_t aTimeout);
 
+#if OPENTHREAD_CONFIG_ENABLE_CSL
+    /**
+     * This method returns the CSL period.
+     *
+     * @returns The CSL period in milliseconds, or zero if CSL receive mode is disabled.
+     *
+     */
+    uint16_t GetCslPeriod(void) const;
+
+    /**
+     * This method sets the CSL period and informs the parent when attached as a child.
+     *
+     * @param[in]  aPeriod  The CSL period in milliseconds, or zero to disable CSL receive mode.
+     *
+     * @retval OT_ERROR_NONE          Successfully set the CSL period.
+     * @retval OT_ERROR_INVALID_ARGS  @p aPeriod is non-zero and smaller than `Mac::kMinCslPeriod`.
+     *
+     */
+    otError SetCslPeriod(uint16_t aPeriod);
+#endif
+
     /**
      * This method returns the RLOC16 assigned to the Thread interface.
      *
@@ -1369,6 +1402,32 @@ protected:
     otError AppendXtalAccuracy(Message &aMessage);
 #endif // OPENTHREAD_CONFIG_ENABLE_TIME_SYNC
 
+#if OPENTHREAD_CONFIG_ENABLE_CSL
+    /**
+     * This method appends a CSL Period TLV to a message.
+     *
+     * @param[in]  aMessage  A reference to the message.
+     *
+     * @retval OT_ERROR_NONE     Successfully appended the CSL Period TLV.
+     * @retval OT_ERROR_NO_BUFS  Insufficient buffers available to append the CSL Period TLV.
+     *
+     */
+    otError AppendCslPeriod(Message &aMessage);
+#endif
+
+#if OPENTHREAD_CONFIG_MLE_NETWORK_DATA_DELTA
+    /**
+     * This method appends a Network Data Delta TLV request, holding the local Network Data version, to a message.
+     *
+     * @param[in]  aMessage  A reference to the message.
+     *
+     * @retval OT_ERROR_NONE     Successfully appended the Network Data Delta TLV.
+     * @retval OT_ERROR_NO_BUFS  Insufficient buffers available to append the Network Data Delta TLV.
+     *
+     */
+    otError AppendNetworkDataDeltaRequest(Message &aMessage);
+#endif
+
     /**
      * This method appends a Active Timestamp TLV to a message.
      *
@@ -1661,6 +1720,9 @@ private:
         kAttachBackoffMinInterval = OPENTHREAD_CONFIG_ATTACH_BACKOFF_MINIMUM_INTERVAL,
         kAttachBackoffMaxInterval = OPENTHREAD_CONFIG_ATTACH_BACKOFF_MAXIMUM_INTERVAL,
         kAttachBackoffJitter      = OPENTHREAD_CONFIG_ATTACH_BACKOFF_JITTER_INTERVAL,
+
+        // Minimum Parent Load difference (CONFIG_ENABLE_PARENT_LOAD_BALANCING) to prefer a less loaded parent.
+        kParentLoadHysteresis = 2,
     };
 
     enum ParentRequestType
@@ -1742,6 +1804,7 @@ private:
 #endif
 
     MessageQueue mDelayedResponses;
+    Message *    mDelayedDataResponse; ///< The (at most one) MLE Data Response in `mDelayedResponses`, or NULL.
 
     struct
     {
@@ -1756,6 +1819,9 @@ private:
 
     AttachMode mParentRequestMode;
     int8_t     mParentPriority;
+#if OPENTHREAD_CONFIG_ENABLE_PARENT_LOAD_BALANCING
+    uint8_t    mParentLoad;
+#endif
     uint8_t    mParentLinkQuality3;
     uint8_t    mParentLinkQuality2;
     uint8_t    mParentLinkQuality1;
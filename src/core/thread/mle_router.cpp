@@ -37,6 +37,7 @@
 #include "mle_router.hpp"
 
 #include "common/code_utils.hpp"
+#include "common/crc16.hpp"
 #include "common/debug.hpp"
 #include "common/encoding.hpp"
 #include "common/instance.hpp"
@@ -59,8 +60,21 @@ namespace Mle {
 
 MleRouter::MleRouter(Instance &aInstance)
     : Mle(aInstance)
-    , mAdvertiseTimer(aInstance, &MleRouter::HandleAdvertiseTimer, NULL, this)
+    , mAdvertiseTimer(aInstance,
+                      &MleRouter::HandleAdvertiseTimer,
+#if OPENTHREAD_CONFIG_MLE_ADVERTISE_SUPPRESSION
+                      &MleRouter::HandleAdvertiseIntervalExpired,
+#else
+                      NULL,
+#endif
+                      this)
     , mStateUpdateTimer(aInstance, &MleRouter::HandleStateUpdateTimer, this)
+#if OPENTHREAD_CONFIG_MLE_CHILD_STORE_DELAY
+    , mChildStoreTimer(aInstance, &MleRouter::HandleChildStoreTimer, this)
+#endif
+#if OPENTHREAD_CONFIG_MLE_ADDRESS_SOLICIT_BATCH_WINDOW
+    , mAddressSolicitBatchTimer(aInstance, &MleRouter::HandleAddressSolicitBatchTimer, this)
+#endif
     , mAddressSolicit(OT_URI_PATH_ADDRESS_SOLICIT, &MleRouter::HandleAddressSolicit, this)
     , mAddressRelease(OT_URI_PATH_ADDRESS_RELEASE, &MleRouter::HandleAddressRelease, this)
     , mChildTable(aInstance)
@@ -81,7 +95,21 @@ MleRouter::MleRouter(Instance &aInstance)
     , mPreviousPartitionIdTimeout(0)
     , mRouterSelectionJitter(kRouterSelectionJitter)
     , mRouterSelectionJitterTimeout(0)
+#if OPENTHREAD_CONFIG_MLE_ROUTER_SELECTION_RANKED
+    , mRouterSelectionRank(0)
+#endif
     , mParentPriority(kParentPriorityUnspecified)
+#if OPENTHREAD_CONFIG_ENABLE_NEIGHBOR_ROUTER_PERSISTENCE
+    , mNeighborRoutersHash(0)
+#endif
+#if OPENTHREAD_CONFIG_MLE_ADVERTISE_SUPPRESSION
+    , mAdvertiseConsistentCount(0)
+    , mAdvertiseStableIntervals(0)
+    , mAdvertiseSuppressed(false)
+#endif
+#if OPENTHREAD_CONFIG_MLE_ADDRESS_SOLICIT_BATCH_WINDOW
+    , mAddressSolicitBatchLength(0)
+#endif
 {
     mDeviceMode |= ModeTlv::kModeFullThreadDevice | ModeTlv::kModeFullNetworkData;
 
@@ -149,6 +177,9 @@ otError MleRouter::BecomeRouter(ThreadStatusTlv::Status aStatus)
     {
     case OT_DEVICE_ROLE_DETACHED:
         SuccessOrExit(error = SendLinkRequest(NULL));
+#if OPENTHREAD_CONFIG_ENABLE_NEIGHBOR_ROUTER_PERSISTENCE
+        SendLinkRequestsToSavedNeighbors();
+#endif
         mStateUpdateTimer.Start(kStateUpdatePeriod);
         break;
 
@@ -206,6 +237,12 @@ void MleRouter::StopLeader(void)
 
     netif.GetCoap().RemoveResource(mAddressSolicit);
     netif.GetCoap().RemoveResource(mAddressRelease);
+#if OPENTHREAD_CONFIG_MLE_ADDRESS_SOLICIT_BATCH_WINDOW
+    // Drop the held back responses, the requesters retry with whichever leader they find next.
+    mAddressSolicitBatchTimer.Stop();
+    mAddressSolicitBatchLength = 0;
+    mRouterTable.CommitRouterIdSequence();
+#endif
     netif.GetActiveDataset().StopLeader();
     netif.GetPendingDataset().StopLeader();
     mAdvertiseTimer.Stop();
@@ -219,6 +256,15 @@ otError MleRouter::HandleDetachStart(void)
     StopLeader();
     mStateUpdateTimer.Stop();
 
+#if OPENTHREAD_CONFIG_MLE_CHILD_STORE_DELAY
+    if (mChildStoreTimer.IsRunning())
+    {
+        // Flush pending child table changes so they are not lost if the device stops or resets while detached.
+        mChildStoreTimer.Stop();
+        IgnoreReturnValue(SyncStoredChildren());
+    }
+#endif
+
     return OT_ERROR_NONE;
 }
 
@@ -227,7 +273,7 @@ otError MleRouter::HandleChildStart(AttachMode aMode)
     ThreadNetif &netif = GetNetif();
     otError      error = OT_ERROR_NONE;
 
-    mRouterSelectionJitterTimeout = 1 + Random::GetUint8InRange(0, mRouterSelectionJitter);
+    StartRouterSelectionJitter(/* aUpgrade */ true);
 
     StopLeader();
     mStateUpdateTimer.Start(kStateUpdatePeriod);
@@ -286,6 +332,16 @@ otError MleRouter::HandleChildStart(AttachMode aMode)
         {
             BecomeRouter(ThreadStatusTlv::kParentPartitionChange);
         }
+#if OPENTHREAD_CONFIG_MLE_FAST_PARTITION_MERGE
+        else if (aMode == kAttachBetter && mPreviousPartitionIdRouter != mLeaderData.GetPartitionId())
+        {
+            // Request the previous Router ID (included in the Address Solicit) without waiting for the router
+            // selection jitter, so that the neighboring routers of the losing partition hear the new partition from
+            // this device right away.
+            otLogInfoMle("Partition merge, requesting previous router id %d", mPreviousRouterId);
+            BecomeRouter(ThreadStatusTlv::kParentPartitionChange);
+        }
+#endif
 
         break;
     }
@@ -393,12 +449,56 @@ bool MleRouter::HandleAdvertiseTimer(void)
         ExitNow(continueTrickle = false);
     }
 
+#if OPENTHREAD_CONFIG_MLE_ADVERTISE_SUPPRESSION
+    mAdvertiseSuppressed = ShouldSuppressAdvertisement();
+
+    if (mAdvertiseSuppressed)
+    {
+        otLogDebgMle("Suppress advertisement, heard %d unchanged", mAdvertiseConsistentCount);
+        ExitNow();
+    }
+#endif
+
     SendAdvertisement();
 
 exit:
     return continueTrickle;
 }
 
+#if OPENTHREAD_CONFIG_MLE_ADVERTISE_SUPPRESSION
+bool MleRouter::HandleAdvertiseIntervalExpired(TrickleTimer &aTimer)
+{
+    MleRouter &mle = aTimer.GetOwner<MleRouter>();
+
+    mle.mAdvertiseConsistentCount = 0;
+
+    if (mle.mAdvertiseStableIntervals < kAdvertiseSuppressStableIntervals)
+    {
+        mle.mAdvertiseStableIntervals++;
+    }
+
+    return true;
+}
+
+bool MleRouter::ShouldSuppressAdvertisement(void) const
+{
+    bool    suppress = false;
+    uint8_t neighbors;
+
+    VerifyOrExit(mRole == OT_DEVICE_ROLE_ROUTER);
+    VerifyOrExit(!mAdvertiseSuppressed && mAdvertiseStableIntervals >= kAdvertiseSuppressStableIntervals);
+
+    neighbors = mRouterTable.GetNeighborCount();
+    VerifyOrExit(neighbors >= kAdvertiseSuppressMinNeighbors);
+
+    // The redundancy constant `k` grows with the number of neighbor routers.
+    suppress = (mAdvertiseConsistentCount >= neighbors / 2);
+
+exit:
+    return suppress;
+}
+#endif // OPENTHREAD_CONFIG_MLE_ADVERTISE_SUPPRESSION
+
 void MleRouter::StopAdvertiseTimer(void)
 {
     mAdvertiseTimer.Stop();
@@ -406,6 +506,11 @@ void MleRouter::StopAdvertiseTimer(void)
 
 void MleRouter::ResetAdvertiseInterval(void)
 {
+#if OPENTHREAD_CONFIG_MLE_ADVERTISE_SUPPRESSION
+    mAdvertiseConsistentCount = 0;
+    mAdvertiseStableIntervals = 0;
+#endif
+
     VerifyOrExit(mRole == OT_DEVICE_ROLE_ROUTER || mRole == OT_DEVICE_ROLE_LEADER);
 
     if (!mAdvertiseTimer.IsRunning())
@@ -478,6 +583,11 @@ exit:
 }
 
 otError MleRouter::SendLinkRequest(Neighbor *aNeighbor)
+{
+    return SendLinkRequest(aNeighbor, NULL);
+}
+
+otError MleRouter::SendLinkRequest(Neighbor *aNeighbor, const Mac::ExtAddress *aExtAddress)
 {
     static const uint8_t detachedTlvs[]      = {Tlv::kAddress16, Tlv::kRoute};
     static const uint8_t routerTlvs[]        = {Tlv::kLinkMargin};
@@ -529,14 +639,27 @@ otError MleRouter::SendLinkRequest(Neighbor *aNeighbor)
 
     if (aNeighbor == NULL)
     {
-        Random::FillBuffer(mChallenge, sizeof(mChallenge));
+        // A unicast request without a neighbor entry reuses the challenge of the preceding multicast request.
+        if (aExtAddress == NULL)
+        {
+            Random::FillBuffer(mChallenge, sizeof(mChallenge));
+        }
 
         mChallengeTimeout = (((2 * kMaxResponseDelay) + kStateUpdatePeriod - 1) / kStateUpdatePeriod);
 
         SuccessOrExit(error = AppendChallenge(*message, mChallenge, sizeof(mChallenge)));
-        destination.mFields.m8[0]  = 0xff;
-        destination.mFields.m8[1]  = 0x02;
-        destination.mFields.m8[15] = 2;
+
+        if (aExtAddress == NULL)
+        {
+            destination.mFields.m8[0]  = 0xff;
+            destination.mFields.m8[1]  = 0x02;
+            destination.mFields.m8[15] = 2;
+        }
+        else
+        {
+            destination.mFields.m16[0] = HostSwap16(0xfe80);
+            destination.SetIid(*aExtAddress);
+        }
     }
     else
     {
@@ -571,6 +694,59 @@ exit:
     return error;
 }
 
+#if OPENTHREAD_CONFIG_ENABLE_NEIGHBOR_ROUTER_PERSISTENCE
+void MleRouter::SendLinkRequestsToSavedNeighbors(void)
+{
+    Settings::NeighborRouterInfo entries[kMaxRouters];
+    uint8_t                      numEntries;
+
+    SuccessOrExit(GetInstance().GetSettings().ReadNeighborRouters(entries, kMaxRouters, numEntries));
+
+    for (uint8_t i = 0; i < numEntries; i++)
+    {
+        SendLinkRequest(NULL, &entries[i].mExtAddress);
+    }
+
+exit:
+    return;
+}
+
+void MleRouter::StoreNeighborRouters(void)
+{
+    Settings::NeighborRouterInfo entries[kMaxRouters];
+    uint8_t                      numEntries = 0;
+    uint32_t                     hash       = 0;
+
+    for (RouterTable::Iterator iter(GetInstance()); !iter.IsDone(); iter++)
+    {
+        Router &router = *iter.GetRouter();
+
+        if (router.GetState() != Neighbor::kStateValid)
+        {
+            continue;
+        }
+
+        entries[numEntries].mExtAddress = router.GetExtAddress();
+
+        for (uint8_t i = 0; i < sizeof(Mac::ExtAddress); i++)
+        {
+            hash = hash * 31 + router.GetExtAddress().m8[i];
+        }
+
+        numEntries++;
+    }
+
+    // The router table is iterated in Router ID order, so an unchanged set of neighbors gives the same hash.
+    VerifyOrExit(hash != mNeighborRoutersHash);
+
+    SuccessOrExit(GetInstance().GetSettings().SaveNeighborRouters(entries, numEntries));
+    mNeighborRoutersHash = hash;
+
+exit:
+    return;
+}
+#endif // OPENTHREAD_CONFIG_ENABLE_NEIGHBOR_ROUTER_PERSISTENCE
+
 otError MleRouter::HandleLinkRequest(const Message &aMessage, const Ip6::MessageInfo &aMessageInfo)
 {
     otError          error    = OT_ERROR_NONE;
@@ -582,6 +758,7 @@ otError MleRouter::HandleLinkRequest(const Message &aMessage, const Ip6::Message
     SourceAddressTlv sourceAddress;
     TlvRequestTlv    tlvRequest;
     uint16_t         rloc16;
+    TlvIndex         tlvIndex(aMessage);
 #if OPENTHREAD_CONFIG_ENABLE_TIME_SYNC
     TimeRequestTlv timeRequest;
 #endif
@@ -595,22 +772,22 @@ otError MleRouter::HandleLinkRequest(const Message &aMessage, const Ip6::Message
     aMessageInfo.GetPeerAddr().ToExtAddress(macAddr);
 
     // Challenge
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kChallenge, sizeof(challenge), challenge));
+    SuccessOrExit(error = tlvIndex.Get(Tlv::kChallenge, sizeof(challenge), challenge));
     VerifyOrExit(challenge.IsValid(), error = OT_ERROR_PARSE);
 
     // Version
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kVersion, sizeof(version), version));
+    SuccessOrExit(error = tlvIndex.Get(Tlv::kVersion, sizeof(version), version));
     VerifyOrExit(version.IsValid() && version.GetVersion() >= kThreadVersion, error = OT_ERROR_PARSE);
 
     // Leader Data
-    if (Tlv::GetTlv(aMessage, Tlv::kLeaderData, sizeof(leaderData), leaderData) == OT_ERROR_NONE)
+    if (tlvIndex.Get(Tlv::kLeaderData, sizeof(leaderData), leaderData) == OT_ERROR_NONE)
     {
         VerifyOrExit(leaderData.IsValid(), error = OT_ERROR_PARSE);
         VerifyOrExit(leaderData.GetPartitionId() == mLeaderData.GetPartitionId(), error = OT_ERROR_INVALID_STATE);
     }
 
     // Source Address
-    if (Tlv::GetTlv(aMessage, Tlv::kSourceAddress, sizeof(sourceAddress), sourceAddress) == OT_ERROR_NONE)
+    if (tlvIndex.Get(Tlv::kSourceAddress, sizeof(sourceAddress), sourceAddress) == OT_ERROR_NONE)
     {
         VerifyOrExit(sourceAddress.IsValid(), error = OT_ERROR_PARSE);
 
@@ -640,6 +817,7 @@ otError MleRouter::HandleLinkRequest(const Message &aMessage, const Ip6::Message
                 neighbor->ResetLinkFailures();
                 neighbor->SetLastHeard(TimerMilli::GetNow());
                 neighbor->SetState(Neighbor::kStateLinkRequest);
+                mRouterTable.InvalidateNextHops();
             }
             else
             {
@@ -661,7 +839,7 @@ otError MleRouter::HandleLinkRequest(const Message &aMessage, const Ip6::Message
     }
 
     // TLV Request
-    if (Tlv::GetTlv(aMessage, Tlv::kTlvRequest, sizeof(tlvRequest), tlvRequest) == OT_ERROR_NONE)
+    if (tlvIndex.Get(Tlv::kTlvRequest, sizeof(tlvRequest), tlvRequest) == OT_ERROR_NONE)
     {
         VerifyOrExit(tlvRequest.IsValid(), error = OT_ERROR_PARSE);
     }
@@ -671,7 +849,7 @@ otError MleRouter::HandleLinkRequest(const Message &aMessage, const Ip6::Message
     }
 
 #if OPENTHREAD_CONFIG_ENABLE_TIME_SYNC
-    if (Tlv::GetTlv(aMessage, Tlv::kTimeRequest, sizeof(timeRequest), timeRequest) == OT_ERROR_NONE)
+    if (tlvIndex.Get(Tlv::kTimeRequest, sizeof(timeRequest), timeRequest) == OT_ERROR_NONE)
     {
         neighbor->SetTimeSyncEnabled(true);
     }
@@ -750,6 +928,7 @@ otError MleRouter::SendLinkAccept(const Ip6::MessageInfo &aMessageInfo,
         SuccessOrExit(error = AppendTlvRequest(*message, routerTlvs, sizeof(routerTlvs)));
         aNeighbor->SetLastHeard(TimerMilli::GetNow());
         aNeighbor->SetState(Neighbor::kStateLinkRequest);
+        mRouterTable.InvalidateNextHops();
     }
 
 #if OPENTHREAD_CONFIG_ENABLE_TIME_SYNC
@@ -822,11 +1001,12 @@ otError MleRouter::HandleLinkAccept(const Message &         aMessage,
     LinkMarginTlv           linkMargin;
     ChallengeTlv            challenge;
     TlvRequestTlv           tlvRequest;
+    TlvIndex                tlvIndex(aMessage);
 
     aMessageInfo.GetPeerAddr().ToExtAddress(macAddr);
 
     // Source Address
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kSourceAddress, sizeof(sourceAddress), sourceAddress));
+    SuccessOrExit(error = tlvIndex.Get(Tlv::kSourceAddress, sizeof(sourceAddress), sourceAddress));
     VerifyOrExit(sourceAddress.IsValid(), error = OT_ERROR_PARSE);
 
     if (aRequest)
@@ -839,11 +1019,11 @@ otError MleRouter::HandleLinkAccept(const Message &         aMessage,
     }
 
     // Version
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kVersion, sizeof(version), version));
+    SuccessOrExit(error = tlvIndex.Get(Tlv::kVersion, sizeof(version), version));
     VerifyOrExit(version.IsValid(), error = OT_ERROR_PARSE);
 
     // Response
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kResponse, sizeof(response), response));
+    SuccessOrExit(error = tlvIndex.Get(Tlv::kResponse, sizeof(response), response));
     VerifyOrExit(response.IsValid(), error = OT_ERROR_PARSE);
 
     // Remove stale neighbors
@@ -853,11 +1033,11 @@ otError MleRouter::HandleLinkAccept(const Message &         aMessage,
     }
 
     // Link-Layer Frame Counter
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kLinkFrameCounter, sizeof(linkFrameCounter), linkFrameCounter));
+    SuccessOrExit(error = tlvIndex.Get(Tlv::kLinkFrameCounter, sizeof(linkFrameCounter), linkFrameCounter));
     VerifyOrExit(linkFrameCounter.IsValid(), error = OT_ERROR_PARSE);
 
     // MLE Frame Counter
-    if (Tlv::GetTlv(aMessage, Tlv::kMleFrameCounter, sizeof(mleFrameCounter), mleFrameCounter) == OT_ERROR_NONE)
+    if (tlvIndex.Get(Tlv::kMleFrameCounter, sizeof(mleFrameCounter), mleFrameCounter) == OT_ERROR_NONE)
     {
         VerifyOrExit(mleFrameCounter.IsValid(), error = OT_ERROR_PARSE);
     }
@@ -867,7 +1047,7 @@ otError MleRouter::HandleLinkAccept(const Message &         aMessage,
     }
 
     // Link Margin
-    if (Tlv::GetTlv(aMessage, Tlv::kLinkMargin, sizeof(linkMargin), linkMargin) == OT_ERROR_NONE)
+    if (tlvIndex.Get(Tlv::kLinkMargin, sizeof(linkMargin), linkMargin) == OT_ERROR_NONE)
     {
         VerifyOrExit(linkMargin.IsValid(), error = OT_ERROR_PARSE);
     }
@@ -914,17 +1094,17 @@ otError MleRouter::HandleLinkAccept(const Message &         aMessage,
 
     case OT_DEVICE_ROLE_DETACHED:
         // Address16
-        SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kAddress16, sizeof(address16), address16));
+        SuccessOrExit(error = tlvIndex.Get(Tlv::kAddress16, sizeof(address16), address16));
         VerifyOrExit(address16.IsValid(), error = OT_ERROR_PARSE);
         VerifyOrExit(GetRloc16() == address16.GetRloc16(), error = OT_ERROR_DROP);
 
         // Leader Data
-        SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kLeaderData, sizeof(leaderData), leaderData));
+        SuccessOrExit(error = tlvIndex.Get(Tlv::kLeaderData, sizeof(leaderData), leaderData));
         VerifyOrExit(leaderData.IsValid(), error = OT_ERROR_PARSE);
         SetLeaderData(leaderData.GetPartitionId(), leaderData.GetWeighting(), leaderData.GetLeaderRouterId());
 
         // Route
-        SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kRoute, sizeof(route), route));
+        SuccessOrExit(error = tlvIndex.Get(Tlv::kRoute, sizeof(route), route));
         VerifyOrExit(route.IsValid(), error = OT_ERROR_PARSE);
         SuccessOrExit(error = ProcessRouteTlv(route));
 
@@ -956,7 +1136,7 @@ otError MleRouter::HandleLinkAccept(const Message &         aMessage,
         VerifyOrExit(router != NULL);
 
         // Leader Data
-        SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kLeaderData, sizeof(leaderData), leaderData));
+        SuccessOrExit(error = tlvIndex.Get(Tlv::kLeaderData, sizeof(leaderData), leaderData));
         VerifyOrExit(leaderData.IsValid(), error = OT_ERROR_PARSE);
         VerifyOrExit(leaderData.GetPartitionId() == mLeaderData.GetPartitionId());
 
@@ -967,7 +1147,7 @@ otError MleRouter::HandleLinkAccept(const Message &         aMessage,
         }
 
         // Route (optional)
-        if (Tlv::GetTlv(aMessage, Tlv::kRoute, sizeof(route), route) == OT_ERROR_NONE)
+        if (tlvIndex.Get(Tlv::kRoute, sizeof(route), route) == OT_ERROR_NONE)
         {
             VerifyOrExit(route.IsValid(), error = OT_ERROR_PARSE);
             SuccessOrExit(error = ProcessRouteTlv(route));
@@ -996,15 +1176,16 @@ otError MleRouter::HandleLinkAccept(const Message &         aMessage,
     router->ResetLinkFailures();
     router->SetState(Neighbor::kStateValid);
     router->SetKeySequence(aKeySequence);
+    mRouterTable.InvalidateNextHops();
 
     if (aRequest)
     {
         // Challenge
-        SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kChallenge, sizeof(challenge), challenge));
+        SuccessOrExit(error = tlvIndex.Get(Tlv::kChallenge, sizeof(challenge), challenge));
         VerifyOrExit(challenge.IsValid(), error = OT_ERROR_PARSE);
 
         // TLV Request
-        if (Tlv::GetTlv(aMessage, Tlv::kTlvRequest, sizeof(tlvRequest), tlvRequest) == OT_ERROR_NONE)
+        if (tlvIndex.Get(Tlv::kTlvRequest, sizeof(tlvRequest), tlvRequest) == OT_ERROR_NONE)
         {
             VerifyOrExit(tlvRequest.IsValid(), error = OT_ERROR_PARSE);
         }
@@ -1046,6 +1227,35 @@ uint8_t MleRouter::LinkQualityToCost(uint8_t aLinkQuality)
     return rval;
 }
 
+uint8_t MleRouter::LinkQualityToCost(uint8_t aLinkQuality, const LinkQualityInfo &aLinkInfo)
+{
+    uint8_t rval = LinkQualityToCost(aLinkQuality);
+
+#if OPENTHREAD_CONFIG_ENABLE_ETX_LINK_COST
+    uint32_t successRate = SuccessRateTracker::kMaxRateValue - aLinkInfo.GetFrameErrorRate();
+    uint32_t cost;
+
+    VerifyOrExit(rval < kMaxRouteCost);
+
+    // Scale the cost by ETX (`1 / success rate`), rounded to the nearest value. A lossy link is made expensive but
+    // is not removed from routing, which is left to the MLE link failure detection.
+    cost = static_cast<uint32_t>(kMaxRouteCost);
+
+    if (successRate > 0)
+    {
+        cost = (static_cast<uint32_t>(rval) * SuccessRateTracker::kMaxRateValue + successRate / 2) / successRate;
+    }
+
+    rval = (cost < kMaxRouteCost) ? static_cast<uint8_t>(cost) : static_cast<uint8_t>(kMaxRouteCost - 1);
+
+exit:
+#else
+    OT_UNUSED_VARIABLE(aLinkInfo);
+#endif
+
+    return rval;
+}
+
 uint8_t MleRouter::GetLinkCost(uint8_t aRouterId)
 {
     uint8_t rval = kMaxRouteCost;
@@ -1132,6 +1342,36 @@ exit:
     return rval;
 }
 
+uint32_t MleRouter::ComputeRouteDigest(const RouteTlv &aRoute)
+{
+    // The digest covers every input of `UpdateRoutes()`: the Route TLV (except the ID sequence, which only
+    // `ProcessRouteTlv()` uses) and the next hop, cost and link cost of every allocated router. Two CRCs with
+    // different polynomials are combined to make collisions unlikely.
+    Crc16   ccitt(Crc16::kCcitt);
+    Crc16   ansi(Crc16::kAnsi);
+    uint8_t buf[6];
+
+    ccitt.Update(aRoute.GetValue() + sizeof(uint8_t), aRoute.GetLength() - sizeof(uint8_t));
+    ansi.Update(aRoute.GetValue() + sizeof(uint8_t), aRoute.GetLength() - sizeof(uint8_t));
+
+    for (RouterTable::Iterator iter(GetInstance()); !iter.IsDone(); iter++)
+    {
+        Router &router = *iter.GetRouter();
+
+        buf[0] = router.GetRouterId();
+        buf[1] = router.GetNextHop();
+        buf[2] = router.GetCost();
+        buf[3] = mRouterTable.GetLinkCost(router);
+        buf[4] = router.GetLinkQualityOut();
+        buf[5] = (router.GetRloc16() == GetRloc16());
+
+        ccitt.Update(buf, sizeof(buf));
+        ansi.Update(buf, sizeof(buf));
+    }
+
+    return (static_cast<uint32_t>(ccitt.Get()) << 16) | ansi.Get();
+}
+
 bool MleRouter::IsSingleton(const RouteTlv &aRouteTlv)
 {
     bool    rval  = true;
@@ -1171,11 +1411,12 @@ otError MleRouter::HandleAdvertisement(const Message &aMessage, const Ip6::Messa
     Neighbor *       neighbor;
     uint8_t          routerId;
     uint8_t          routerCount;
+    TlvIndex         tlvIndex(aMessage);
 
     aMessageInfo.GetPeerAddr().ToExtAddress(macAddr);
 
     // Source Address
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kSourceAddress, sizeof(sourceAddress), sourceAddress));
+    SuccessOrExit(error = tlvIndex.Get(Tlv::kSourceAddress, sizeof(sourceAddress), sourceAddress));
     VerifyOrExit(sourceAddress.IsValid(), error = OT_ERROR_PARSE);
 
     // Remove stale neighbors
@@ -1185,11 +1426,11 @@ otError MleRouter::HandleAdvertisement(const Message &aMessage, const Ip6::Messa
     }
 
     // Leader Data
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kLeaderData, sizeof(leaderData), leaderData));
+    SuccessOrExit(error = tlvIndex.Get(Tlv::kLeaderData, sizeof(leaderData), leaderData));
     VerifyOrExit(leaderData.IsValid(), error = OT_ERROR_PARSE);
 
     // Route Data (optional)
-    if (Tlv::GetTlv(aMessage, Tlv::kRoute, sizeof(route), route) == OT_ERROR_NONE)
+    if (tlvIndex.Get(Tlv::kRoute, sizeof(route), route) == OT_ERROR_NONE)
     {
         VerifyOrExit(route.IsValid(), error = OT_ERROR_PARSE);
     }
@@ -1305,7 +1546,7 @@ otError MleRouter::HandleAdvertisement(const Message &aMessage, const Ip6::Messa
         if ((router->GetState() == Neighbor::kStateValid) && IsFullThreadDevice() &&
             (mRouterSelectionJitterTimeout == 0) && (mRouterTable.GetActiveRouterCount() < mRouterUpgradeThreshold))
         {
-            mRouterSelectionJitterTimeout = 1 + Random::GetUint8InRange(0, mRouterSelectionJitter);
+            StartRouterSelectionJitter(/* aUpgrade */ true);
             ExitNow();
         }
 
@@ -1347,6 +1588,7 @@ otError MleRouter::HandleAdvertisement(const Message &aMessage, const Ip6::Messa
                             leader->SetCost(0);
                         }
 
+                        mRouterTable.InvalidateNextHops();
                         break;
                     }
                 }
@@ -1361,6 +1603,7 @@ otError MleRouter::HandleAdvertisement(const Message &aMessage, const Ip6::Messa
             router->ResetLinkFailures();
             router->SetLastHeard(TimerMilli::GetNow());
             router->SetState(Neighbor::kStateLinkRequest);
+            mRouterTable.InvalidateNextHops();
             SendLinkRequest(router);
             ExitNow(error = OT_ERROR_NO_ROUTE);
         }
@@ -1388,7 +1631,7 @@ otError MleRouter::HandleAdvertisement(const Message &aMessage, const Ip6::Messa
             HasMinDowngradeNeighborRouters() && HasSmallNumberOfChildren() &&
             HasOneNeighborWithComparableConnectivity(route, routerId))
         {
-            mRouterSelectionJitterTimeout = 1 + Random::GetUint8InRange(0, mRouterSelectionJitter);
+            StartRouterSelectionJitter(/* aUpgrade */ false);
         }
 
         // fall through
@@ -1408,6 +1651,7 @@ otError MleRouter::HandleAdvertisement(const Message &aMessage, const Ip6::Messa
             router->SetLastHeard(TimerMilli::GetNow());
             router->SetState(Neighbor::kStateLinkRequest);
             router->SetDataRequestPending(false);
+            mRouterTable.InvalidateNextHops();
             SendLinkRequest(router);
             ExitNow(error = OT_ERROR_NO_ROUTE);
         }
@@ -1416,7 +1660,22 @@ otError MleRouter::HandleAdvertisement(const Message &aMessage, const Ip6::Messa
         break;
     }
 
+#if OPENTHREAD_CONFIG_MLE_ADVERTISE_SUPPRESSION
+    {
+        // `UpdateRoutes()` only updates the route digest of the neighbor when its routes changed.
+        uint32_t digest = router->GetRouteDigest();
+
+        UpdateRoutes(route, routerId);
+
+        if (router->GetState() == Neighbor::kStateValid && router->GetRouteDigest() == digest &&
+            mAdvertiseConsistentCount < 0xff)
+        {
+            mAdvertiseConsistentCount++;
+        }
+    }
+#else
     UpdateRoutes(route, routerId);
+#endif
 
 #if OPENTHREAD_ENABLE_BORDER_ROUTER || OPENTHREAD_ENABLE_SERVICE
     netif.GetNetworkDataLocal().SendServerDataNotification();
@@ -1441,6 +1700,9 @@ void MleRouter::UpdateRoutes(const RouteTlv &aRoute, uint8_t aRouterId)
     neighbor = mRouterTable.GetRouter(aRouterId);
     VerifyOrExit(neighbor != NULL);
 
+    // Routes are already up to date if neither the Route TLV nor the router table changed since the last update.
+    VerifyOrExit(ComputeRouteDigest(aRoute) != neighbor->GetRouteDigest());
+
     // update routes
     do
     {
@@ -1547,6 +1809,9 @@ void MleRouter::UpdateRoutes(const RouteTlv &aRoute, uint8_t aRouterId)
 
     } while (update);
 
+    mRouterTable.InvalidateNextHops();
+    neighbor->SetRouteDigest(ComputeRouteDigest(aRoute));
+
 #if (OPENTHREAD_CONFIG_LOG_MLE && (OPENTHREAD_CONFIG_LOG_LEVEL >= OT_LOG_LEVEL_INFO))
 
     VerifyOrExit(changed);
@@ -1577,6 +1842,7 @@ otError MleRouter::HandleParentRequest(const Message &aMessage, const Ip6::Messa
     ChallengeTlv            challenge;
     Router *                leader;
     Child *                 child;
+    TlvIndex                tlvIndex(aMessage);
 #if OPENTHREAD_CONFIG_ENABLE_TIME_SYNC
     TimeRequestTlv timeRequest;
 #endif
@@ -1608,11 +1874,11 @@ otError MleRouter::HandleParentRequest(const Message &aMessage, const Ip6::Messa
     aMessageInfo.GetPeerAddr().ToExtAddress(macAddr);
 
     // Version
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kVersion, sizeof(version), version));
+    SuccessOrExit(error = tlvIndex.Get(Tlv::kVersion, sizeof(version), version));
     VerifyOrExit(version.IsValid() && version.GetVersion() >= kThreadVersion, error = OT_ERROR_PARSE);
 
     // Scan Mask
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kScanMask, sizeof(scanMask), scanMask));
+    SuccessOrExit(error = tlvIndex.Get(Tlv::kScanMask, sizeof(scanMask), scanMask));
     VerifyOrExit(scanMask.IsValid(), error = OT_ERROR_PARSE);
 
     switch (mRole)
@@ -1632,13 +1898,24 @@ otError MleRouter::HandleParentRequest(const Message &aMessage, const Ip6::Messa
     }
 
     // Challenge
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kChallenge, sizeof(challenge), challenge));
+    SuccessOrExit(error = tlvIndex.Get(Tlv::kChallenge, sizeof(challenge), challenge));
     VerifyOrExit(challenge.IsValid(), error = OT_ERROR_PARSE);
 
     child = GetChildTable().FindChild(macAddr, ChildTable::kInStateAnyExceptInvalid);
 
     if (child == NULL)
     {
+        // Admit a bounded number of new children at a time so that, after an outage, the attaches in progress and
+        // the children returning to this router are not starved of buffers by everyone else powering up.
+#if OPENTHREAD_CONFIG_MLE_MAX_CONCURRENT_CHILD_ATTACHES
+        VerifyOrExit(GetChildTable().GetNumChildren(ChildTable::kInStateAttaching) <
+                         OPENTHREAD_CONFIG_MLE_MAX_CONCURRENT_CHILD_ATTACHES,
+                     error = OT_ERROR_BUSY);
+#endif
+        VerifyOrExit(GetInstance().GetMessagePool().GetFreeBufferCount() >=
+                         OPENTHREAD_CONFIG_MLE_CHILD_ATTACH_MIN_FREE_BUFFERS,
+                     error = OT_ERROR_NO_BUFS);
+
         VerifyOrExit((child = GetChildTable().GetNewChild()) != NULL);
 
         memset(child, 0, sizeof(*child));
@@ -1651,7 +1928,7 @@ otError MleRouter::HandleParentRequest(const Message &aMessage, const Ip6::Messa
         child->SetState(Neighbor::kStateParentRequest);
         child->SetDataRequestPending(false);
 #if OPENTHREAD_CONFIG_ENABLE_TIME_SYNC
-        if (Tlv::GetTlv(aMessage, Tlv::kTimeRequest, sizeof(timeRequest), timeRequest) == OT_ERROR_NONE)
+        if (tlvIndex.Get(Tlv::kTimeRequest, sizeof(timeRequest), timeRequest) == OT_ERROR_NONE)
         {
             child->SetTimeSyncEnabled(true);
         }
@@ -1727,6 +2004,10 @@ void MleRouter::HandleStateUpdateTimer(void)
     case OT_DEVICE_ROLE_CHILD:
         if (routerStateUpdate)
         {
+#if OPENTHREAD_CONFIG_MLE_ROUTER_SELECTION_RANKED
+            VerifyOrExit(!ShouldDeferRouterUpgrade());
+#endif
+
             if (mRouterTable.GetActiveRouterCount() < mRouterUpgradeThreshold)
             {
                 // upgrade to Router
@@ -1769,9 +2050,15 @@ void MleRouter::HandleStateUpdateTimer(void)
             BecomeChild(kAttachSameDowngrade);
         }
 
+#if OPENTHREAD_CONFIG_ENABLE_NEIGHBOR_ROUTER_PERSISTENCE
+        StoreNeighborRouters();
+#endif
         break;
 
     case OT_DEVICE_ROLE_LEADER:
+#if OPENTHREAD_CONFIG_ENABLE_NEIGHBOR_ROUTER_PERSISTENCE
+        StoreNeighborRouters();
+#endif
         break;
     }
 
@@ -1968,7 +2255,7 @@ otError MleRouter::UpdateChildAddresses(const Message &aMessage, uint16_t aOffse
 
     offset = aOffset + sizeof(tlv);
     end    = offset + tlv.GetLength();
-    aChild.ClearIp6Addresses();
+    aChild.ClearIp6Addresses(GetInstance());
 
     while (offset < end)
     {
@@ -2076,6 +2363,10 @@ otError MleRouter::HandleChildIdRequest(const Message &         aMessage,
     TlvRequestTlv           tlvRequest;
     ActiveTimestampTlv      activeTimestamp;
     PendingTimestampTlv     pendingTimestamp;
+    TlvIndex                tlvIndex(aMessage);
+#if OPENTHREAD_CONFIG_ENABLE_CSL
+    CslPeriodTlv            cslPeriod;
+#endif
     Child *                 child;
     Router *                router;
     uint8_t                 numTlvs;
@@ -2095,7 +2386,7 @@ otError MleRouter::HandleChildIdRequest(const Message &         aMessage,
     VerifyOrExit(child != NULL, error = OT_ERROR_ALREADY);
 
     // Response
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kResponse, sizeof(response), response));
+    SuccessOrExit(error = tlvIndex.Get(Tlv::kResponse, sizeof(response), response));
     VerifyOrExit(response.IsValid() &&
                      memcmp(response.GetResponse(), child->GetChallenge(), child->GetChallengeSize()) == 0,
                  error = OT_ERROR_SECURITY);
@@ -2106,11 +2397,11 @@ otError MleRouter::HandleChildIdRequest(const Message &         aMessage,
     netif.GetMeshForwarder().RemoveMessages(*child, Message::kSubTypeMleDataResponse);
 
     // Link-Layer Frame Counter
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kLinkFrameCounter, sizeof(linkFrameCounter), linkFrameCounter));
+    SuccessOrExit(error = tlvIndex.Get(Tlv::kLinkFrameCounter, sizeof(linkFrameCounter), linkFrameCounter));
     VerifyOrExit(linkFrameCounter.IsValid(), error = OT_ERROR_PARSE);
 
     // MLE Frame Counter
-    if (Tlv::GetTlv(aMessage, Tlv::kMleFrameCounter, sizeof(mleFrameCounter), mleFrameCounter) == OT_ERROR_NONE)
+    if (tlvIndex.Get(Tlv::kMleFrameCounter, sizeof(mleFrameCounter), mleFrameCounter) == OT_ERROR_NONE)
     {
         VerifyOrExit(mleFrameCounter.IsValid(), error = OT_ERROR_PARSE);
     }
@@ -2120,21 +2411,21 @@ otError MleRouter::HandleChildIdRequest(const Message &         aMessage,
     }
 
     // Mode
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kMode, sizeof(mode), mode));
+    SuccessOrExit(error = tlvIndex.Get(Tlv::kMode, sizeof(mode), mode));
     VerifyOrExit(mode.IsValid(), error = OT_ERROR_PARSE);
 
     // Timeout
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kTimeout, sizeof(timeout), timeout));
+    SuccessOrExit(error = tlvIndex.Get(Tlv::kTimeout, sizeof(timeout), timeout));
     VerifyOrExit(timeout.IsValid(), error = OT_ERROR_PARSE);
 
     // TLV Request
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kTlvRequest, sizeof(tlvRequest), tlvRequest));
+    SuccessOrExit(error = tlvIndex.Get(Tlv::kTlvRequest, sizeof(tlvRequest), tlvRequest));
     VerifyOrExit(tlvRequest.IsValid() && tlvRequest.GetLength() <= Child::kMaxRequestTlvs, error = OT_ERROR_PARSE);
 
     // Active Timestamp
     activeTimestamp.SetLength(0);
 
-    if (Tlv::GetTlv(aMessage, Tlv::kActiveTimestamp, sizeof(activeTimestamp), activeTimestamp) == OT_ERROR_NONE)
+    if (tlvIndex.Get(Tlv::kActiveTimestamp, sizeof(activeTimestamp), activeTimestamp) == OT_ERROR_NONE)
     {
         VerifyOrExit(activeTimestamp.IsValid(), error = OT_ERROR_PARSE);
     }
@@ -2142,14 +2433,14 @@ otError MleRouter::HandleChildIdRequest(const Message &         aMessage,
     // Pending Timestamp
     pendingTimestamp.SetLength(0);
 
-    if (Tlv::GetTlv(aMessage, Tlv::kPendingTimestamp, sizeof(pendingTimestamp), pendingTimestamp) == OT_ERROR_NONE)
+    if (tlvIndex.Get(Tlv::kPendingTimestamp, sizeof(pendingTimestamp), pendingTimestamp) == OT_ERROR_NONE)
     {
         VerifyOrExit(pendingTimestamp.IsValid(), error = OT_ERROR_PARSE);
     }
 
     if ((mode.GetMode() & ModeTlv::kModeFullThreadDevice) == 0)
     {
-        SuccessOrExit(error = Tlv::GetOffset(aMessage, Tlv::kAddressRegistration, addressRegistrationOffset));
+        SuccessOrExit(error = tlvIndex.GetOffset(Tlv::kAddressRegistration, addressRegistrationOffset));
         SuccessOrExit(error = UpdateChildAddresses(aMessage, addressRegistrationOffset, *child));
     }
 
@@ -2177,6 +2468,15 @@ otError MleRouter::HandleChildIdRequest(const Message &         aMessage,
     child->GetLinkInfo().AddRss(netif.GetMac().GetNoiseFloor(), linkInfo->mRss);
     child->SetTimeout(timeout.GetTimeout());
 
+#if OPENTHREAD_CONFIG_ENABLE_CSL
+    child->SetCslPeriod(0);
+
+    if (tlvIndex.Get(Tlv::kCslPeriod, sizeof(cslPeriod), cslPeriod) == OT_ERROR_NONE && cslPeriod.IsValid())
+    {
+        child->SetCslPeriod(cslPeriod.GetCslPeriod());
+    }
+#endif
+
     if (mode.GetMode() & ModeTlv::kModeFullNetworkData)
     {
         child->SetNetworkDataVersion(mLeaderData.GetDataVersion());
@@ -2237,17 +2537,21 @@ otError MleRouter::HandleChildUpdateRequest(const Message &         aMessage,
     ChallengeTlv    challenge;
     LeaderDataTlv   leaderData;
     TimeoutTlv      timeout;
+#if OPENTHREAD_CONFIG_ENABLE_CSL
+    CslPeriodTlv    cslPeriod;
+#endif
     Child *         child;
     TlvRequestTlv   tlvRequest;
     uint8_t         tlvs[kMaxResponseTlvs];
     uint8_t         tlvslength                = 0;
     uint16_t        addressRegistrationOffset = 0;
     bool            childDidChange            = false;
+    TlvIndex        tlvIndex(aMessage);
 
     LogMleMessage("Receive Child Update Request from child", aMessageInfo.GetPeerAddr());
 
     // Mode
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kMode, sizeof(mode), mode));
+    SuccessOrExit(error = tlvIndex.Get(Tlv::kMode, sizeof(mode), mode));
     VerifyOrExit(mode.IsValid(), error = OT_ERROR_PARSE);
 
     // Find Child
@@ -2294,7 +2598,7 @@ otError MleRouter::HandleChildUpdateRequest(const Message &         aMessage,
     tlvs[tlvslength++] = Tlv::kLeaderData;
 
     // Challenge
-    if (Tlv::GetTlv(aMessage, Tlv::kChallenge, sizeof(challenge), challenge) == OT_ERROR_NONE)
+    if (tlvIndex.Get(Tlv::kChallenge, sizeof(challenge), challenge) == OT_ERROR_NONE)
     {
         VerifyOrExit(challenge.IsValid(), error = OT_ERROR_PARSE);
         tlvs[tlvslength++] = Tlv::kResponse;
@@ -2303,20 +2607,20 @@ otError MleRouter::HandleChildUpdateRequest(const Message &         aMessage,
     }
 
     // Ip6 Address TLV
-    if (Tlv::GetOffset(aMessage, Tlv::kAddressRegistration, addressRegistrationOffset) == OT_ERROR_NONE)
+    if (tlvIndex.GetOffset(Tlv::kAddressRegistration, addressRegistrationOffset) == OT_ERROR_NONE)
     {
         SuccessOrExit(error = UpdateChildAddresses(aMessage, addressRegistrationOffset, *child));
         tlvs[tlvslength++] = Tlv::kAddressRegistration;
     }
 
     // Leader Data
-    if (Tlv::GetTlv(aMessage, Tlv::kLeaderData, sizeof(leaderData), leaderData) == OT_ERROR_NONE)
+    if (tlvIndex.Get(Tlv::kLeaderData, sizeof(leaderData), leaderData) == OT_ERROR_NONE)
     {
         VerifyOrExit(leaderData.IsValid(), error = OT_ERROR_PARSE);
     }
 
     // Timeout
-    if (Tlv::GetTlv(aMessage, Tlv::kTimeout, sizeof(timeout), timeout) == OT_ERROR_NONE)
+    if (tlvIndex.Get(Tlv::kTimeout, sizeof(timeout), timeout) == OT_ERROR_NONE)
     {
         VerifyOrExit(timeout.IsValid(), error = OT_ERROR_PARSE);
 
@@ -2329,8 +2633,34 @@ otError MleRouter::HandleChildUpdateRequest(const Message &         aMessage,
         tlvs[tlvslength++] = Tlv::kTimeout;
     }
 
+#if OPENTHREAD_CONFIG_ENABLE_CSL
+    // CSL Period
+    if (tlvIndex.Get(Tlv::kCslPeriod, sizeof(cslPeriod), cslPeriod) == OT_ERROR_NONE)
+    {
+        VerifyOrExit(cslPeriod.IsValid(), error = OT_ERROR_PARSE);
+        child->SetCslPeriod(cslPeriod.GetCslPeriod());
+    }
+#endif
+
+#if OPENTHREAD_CONFIG_MLE_NETWORK_DATA_DELTA
+    // Network Data Delta
+    {
+        NetworkDataDeltaTlv networkDataDelta;
+
+        if (tlvIndex.Get(Tlv::kNetworkDataDelta, sizeof(networkDataDelta), networkDataDelta) == OT_ERROR_NONE)
+        {
+            VerifyOrExit(networkDataDelta.IsValid(), error = OT_ERROR_PARSE);
+            child->SetNetworkDataDeltaCapable(true);
+        }
+        else
+        {
+            child->SetNetworkDataDeltaCapable(false);
+        }
+    }
+#endif
+
     // TLV Request
-    if (Tlv::GetTlv(aMessage, Tlv::kTlvRequest, sizeof(tlvRequest), tlvRequest) == OT_ERROR_NONE)
+    if (tlvIndex.Get(Tlv::kTlvRequest, sizeof(tlvRequest), tlvRequest) == OT_ERROR_NONE)
     {
         uint8_t            tlv;
         TlvRequestIterator iterator = TLVREQUESTTLV_ITERATOR_INIT;
@@ -2385,6 +2715,7 @@ otError MleRouter::HandleChildUpdateResponse(const Message &         aMessage,
     LeaderDataTlv           leaderData;
     Child *                 child;
     uint16_t                addressRegistrationOffset = 0;
+    TlvIndex                tlvIndex(aMessage);
 
     // Find Child
     aMessageInfo.GetPeerAddr().ToExtAddress(macAddr);
@@ -2398,7 +2729,7 @@ otError MleRouter::HandleChildUpdateResponse(const Message &         aMessage,
     }
 
     // Source Address
-    if (Tlv::GetTlv(aMessage, Tlv::kSourceAddress, sizeof(sourceAddress), sourceAddress) == OT_ERROR_NONE)
+    if (tlvIndex.Get(Tlv::kSourceAddress, sizeof(sourceAddress), sourceAddress) == OT_ERROR_NONE)
     {
         VerifyOrExit(sourceAddress.IsValid(), error = OT_ERROR_PARSE);
 
@@ -2413,7 +2744,7 @@ otError MleRouter::HandleChildUpdateResponse(const Message &         aMessage,
     LogMleMessage("Receive Child Update Response from child", aMessageInfo.GetPeerAddr(), child->GetRloc16());
 
     // Response
-    if (Tlv::GetTlv(aMessage, Tlv::kResponse, sizeof(response), response) == OT_ERROR_NONE)
+    if (tlvIndex.Get(Tlv::kResponse, sizeof(response), response) == OT_ERROR_NONE)
     {
         VerifyOrExit(response.IsValid() &&
                          memcmp(response.GetResponse(), child->GetChallenge(), child->GetChallengeSize()) == 0,
@@ -2421,7 +2752,7 @@ otError MleRouter::HandleChildUpdateResponse(const Message &         aMessage,
     }
 
     // Status
-    if (Tlv::GetTlv(aMessage, Tlv::kStatus, sizeof(status), status) == OT_ERROR_NONE)
+    if (tlvIndex.Get(Tlv::kStatus, sizeof(status), status) == OT_ERROR_NONE)
     {
         VerifyOrExit(status.IsValid(), error = OT_ERROR_PARSE);
 
@@ -2433,34 +2764,34 @@ otError MleRouter::HandleChildUpdateResponse(const Message &         aMessage,
     }
 
     // Link-Layer Frame Counter
-    if (Tlv::GetTlv(aMessage, Tlv::kLinkFrameCounter, sizeof(linkFrameCounter), linkFrameCounter) == OT_ERROR_NONE)
+    if (tlvIndex.Get(Tlv::kLinkFrameCounter, sizeof(linkFrameCounter), linkFrameCounter) == OT_ERROR_NONE)
     {
         VerifyOrExit(linkFrameCounter.IsValid(), error = OT_ERROR_PARSE);
         child->SetLinkFrameCounter(linkFrameCounter.GetFrameCounter());
     }
 
     // MLE Frame Counter
-    if (Tlv::GetTlv(aMessage, Tlv::kMleFrameCounter, sizeof(mleFrameCounter), mleFrameCounter) == OT_ERROR_NONE)
+    if (tlvIndex.Get(Tlv::kMleFrameCounter, sizeof(mleFrameCounter), mleFrameCounter) == OT_ERROR_NONE)
     {
         VerifyOrExit(mleFrameCounter.IsValid(), error = OT_ERROR_PARSE);
         child->SetMleFrameCounter(mleFrameCounter.GetFrameCounter());
     }
 
     // Timeout
-    if (Tlv::GetTlv(aMessage, Tlv::kTimeout, sizeof(timeout), timeout) == OT_ERROR_NONE)
+    if (tlvIndex.Get(Tlv::kTimeout, sizeof(timeout), timeout) == OT_ERROR_NONE)
     {
         VerifyOrExit(timeout.IsValid(), error = OT_ERROR_PARSE);
         child->SetTimeout(timeout.GetTimeout());
     }
 
     // Ip6 Address
-    if (Tlv::GetOffset(aMessage, Tlv::kAddressRegistration, addressRegistrationOffset) == OT_ERROR_NONE)
+    if (tlvIndex.GetOffset(Tlv::kAddressRegistration, addressRegistrationOffset) == OT_ERROR_NONE)
     {
         SuccessOrExit(error = UpdateChildAddresses(aMessage, addressRegistrationOffset, *child));
     }
 
     // Leader Data
-    if (Tlv::GetTlv(aMessage, Tlv::kLeaderData, sizeof(leaderData), leaderData) == OT_ERROR_NONE)
+    if (tlvIndex.Get(Tlv::kLeaderData, sizeof(leaderData), leaderData) == OT_ERROR_NONE)
     {
         VerifyOrExit(leaderData.IsValid(), error = OT_ERROR_PARSE);
 
@@ -2492,17 +2823,18 @@ otError MleRouter::HandleDataRequest(const Message &aMessage, const Ip6::Message
     PendingTimestampTlv pendingTimestamp;
     uint8_t             tlvs[4];
     uint8_t             numTlvs;
+    TlvIndex            tlvIndex(aMessage);
 
     LogMleMessage("Receive Data Request", aMessageInfo.GetPeerAddr());
 
     // TLV Request
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kTlvRequest, sizeof(tlvRequest), tlvRequest));
+    SuccessOrExit(error = tlvIndex.Get(Tlv::kTlvRequest, sizeof(tlvRequest), tlvRequest));
     VerifyOrExit(tlvRequest.IsValid() && tlvRequest.GetLength() <= sizeof(tlvs), error = OT_ERROR_PARSE);
 
     // Active Timestamp
     activeTimestamp.SetLength(0);
 
-    if (Tlv::GetTlv(aMessage, Tlv::kActiveTimestamp, sizeof(activeTimestamp), activeTimestamp) == OT_ERROR_NONE)
+    if (tlvIndex.Get(Tlv::kActiveTimestamp, sizeof(activeTimestamp), activeTimestamp) == OT_ERROR_NONE)
     {
         VerifyOrExit(activeTimestamp.IsValid(), error = OT_ERROR_PARSE);
     }
@@ -2510,7 +2842,7 @@ otError MleRouter::HandleDataRequest(const Message &aMessage, const Ip6::Message
     // Pending Timestamp
     pendingTimestamp.SetLength(0);
 
-    if (Tlv::GetTlv(aMessage, Tlv::kPendingTimestamp, sizeof(pendingTimestamp), pendingTimestamp) == OT_ERROR_NONE)
+    if (tlvIndex.Get(Tlv::kPendingTimestamp, sizeof(pendingTimestamp), pendingTimestamp) == OT_ERROR_NONE)
     {
         VerifyOrExit(pendingTimestamp.IsValid(), error = OT_ERROR_PARSE);
     }
@@ -2529,7 +2861,7 @@ otError MleRouter::HandleDataRequest(const Message &aMessage, const Ip6::Message
         tlvs[numTlvs++] = Tlv::kPendingDataset;
     }
 
-    SendDataResponse(aMessageInfo.GetPeerAddr(), tlvs, numTlvs, 0);
+    SendDataResponse(aMessageInfo.GetPeerAddr(), tlvs, numTlvs, 0, &aMessage);
 
 exit:
     return error;
@@ -2548,7 +2880,7 @@ otError MleRouter::HandleNetworkDataUpdateRouter(void)
     destination.mFields.m16[7] = HostSwap16(0x0001);
 
     delay = (mRole == OT_DEVICE_ROLE_LEADER) ? 0 : Random::GetUint16InRange(0, kUnsolicitedDataResponseJitter);
-    SendDataResponse(destination, tlvs, sizeof(tlvs), delay);
+    SendDataResponse(destination, tlvs, sizeof(tlvs), delay, NULL);
 
     SynchronizeChildNetworkData();
 
@@ -2934,7 +3266,16 @@ otError MleRouter::SendChildUpdateRequest(Child &aChild)
     SuccessOrExit(error = AppendHeader(*message, Header::kCommandChildUpdateRequest));
     SuccessOrExit(error = AppendSourceAddress(*message));
     SuccessOrExit(error = AppendLeaderData(*message));
-    SuccessOrExit(error = AppendNetworkData(*message, !aChild.IsFullNetworkData()));
+
+#if OPENTHREAD_CONFIG_MLE_NETWORK_DATA_DELTA
+    if (!aChild.IsNetworkDataDeltaCapable() ||
+        GetNetif().GetNetworkDataLeader().AppendNetworkDataDelta(*message, !aChild.IsFullNetworkData(),
+                                                                 aChild.GetNetworkDataVersion()) != OT_ERROR_NONE)
+#endif
+    {
+        SuccessOrExit(error = AppendNetworkData(*message, !aChild.IsFullNetworkData()));
+    }
+
     SuccessOrExit(error = AppendActiveTimestamp(*message));
     SuccessOrExit(error = AppendPendingTimestamp(*message));
 
@@ -3052,13 +3393,16 @@ exit:
 otError MleRouter::SendDataResponse(const Ip6::Address &aDestination,
                                     const uint8_t *     aTlvs,
                                     uint8_t             aTlvsLength,
-                                    uint16_t            aDelay)
+                                    uint16_t            aDelay,
+                                    const Message *     aRequest)
 {
     otError   error   = OT_ERROR_NONE;
     Message * message = NULL;
     Neighbor *neighbor;
     bool      stableOnly;
 
+    OT_UNUSED_VARIABLE(aRequest);
+
     if (mRetrieveNewNetworkData)
     {
         otLogInfoMle("Suppressing Data Response - waiting for new network data");
@@ -3080,6 +3424,12 @@ otError MleRouter::SendDataResponse(const Ip6::Address &aDestination,
         case Tlv::kNetworkData:
             neighbor   = GetNeighbor(aDestination);
             stableOnly = neighbor != NULL ? !neighbor->IsFullNetworkData() : false;
+#if OPENTHREAD_CONFIG_MLE_NETWORK_DATA_DELTA
+            if (AppendNetworkDataDelta(*message, stableOnly, aRequest) == OT_ERROR_NONE)
+            {
+                break;
+            }
+#endif
             SuccessOrExit(error = AppendNetworkData(*message, stableOnly));
             break;
 
@@ -3120,6 +3470,33 @@ exit:
     return error;
 }
 
+#if OPENTHREAD_CONFIG_MLE_NETWORK_DATA_DELTA
+otError MleRouter::AppendNetworkDataDelta(Message &aMessage, bool aStableOnly, const Message *aRequest)
+{
+    NetworkData::Leader &leader = GetNetif().GetNetworkDataLeader();
+    otError              error;
+    NetworkDataDeltaTlv  tlv;
+    uint8_t              version;
+
+    if (aRequest == NULL)
+    {
+        // Multicast update, assume the receivers hold the previous version.
+        SuccessOrExit(error = leader.GetDeltaBaseVersion(aStableOnly, version));
+    }
+    else
+    {
+        SuccessOrExit(error = Tlv::Get(*aRequest, Tlv::kNetworkDataDelta, sizeof(tlv), tlv));
+        VerifyOrExit(tlv.IsValid() && tlv.IsStable() == aStableOnly, error = OT_ERROR_NOT_FOUND);
+        version = tlv.GetBaseVersion();
+    }
+
+    error = leader.AppendNetworkDataDelta(aMessage, aStableOnly, version);
+
+exit:
+    return error;
+}
+#endif // OPENTHREAD_CONFIG_MLE_NETWORK_DATA_DELTA
+
 bool MleRouter::IsMinimalChild(uint16_t aRloc16)
 {
     ThreadNetif &netif = GetNetif();
@@ -3177,6 +3554,7 @@ otError MleRouter::RemoveNeighbor(Neighbor &aNeighbor)
             }
 
             aNeighbor.SetState(Neighbor::kStateInvalid);
+            static_cast<Child &>(aNeighbor).ClearIp6Addresses(GetInstance());
 
             netif.GetMeshForwarder().ClearChildIndirectMessages(static_cast<Child &>(aNeighbor));
             netif.GetNetworkDataLeader().SendServerDataNotification(aNeighbor.GetRloc16());
@@ -3199,6 +3577,7 @@ otError MleRouter::RemoveNeighbor(Neighbor &aNeighbor)
 
     aNeighbor.GetLinkInfo().Clear();
     aNeighbor.SetState(Neighbor::kStateInvalid);
+    mRouterTable.InvalidateNextHops();
 
     return OT_ERROR_NONE;
 }
@@ -3321,21 +3700,22 @@ Neighbor *MleRouter::GetNeighbor(const Ip6::Address &aAddress)
         context.mContextId = 0xff;
     }
 
-    for (ChildTable::Iterator iter(GetInstance(), ChildTable::kInStateValidOrRestoring); !iter.IsDone(); iter++)
+    if (context.mContextId == 0 && aAddress.mFields.m16[4] == HostSwap16(0x0000) &&
+        aAddress.mFields.m16[5] == HostSwap16(0x00ff) && aAddress.mFields.m16[6] == HostSwap16(0xfe00))
     {
-        child = iter.GetChild();
+        child = GetChildTable().FindChild(HostSwap16(aAddress.mFields.m16[7]), ChildTable::kInStateValidOrRestoring);
 
-        if (context.mContextId == 0 && aAddress.mFields.m16[4] == HostSwap16(0x0000) &&
-            aAddress.mFields.m16[5] == HostSwap16(0x00ff) && aAddress.mFields.m16[6] == HostSwap16(0xfe00) &&
-            aAddress.mFields.m16[7] == HostSwap16(child->GetRloc16()))
+        if (child != NULL)
         {
             ExitNow(rval = child);
         }
+    }
 
-        if (child->HasIp6Address(GetInstance(), aAddress))
-        {
-            ExitNow(rval = child);
-        }
+    child = GetChildTable().FindChild(aAddress, ChildTable::kInStateValidOrRestoring);
+
+    if (child != NULL)
+    {
+        ExitNow(rval = child);
     }
 
     VerifyOrExit(context.mContextId == 0, rval = NULL);
@@ -3376,12 +3756,8 @@ exit:
 
 uint16_t MleRouter::GetNextHop(uint16_t aDestination)
 {
-    uint8_t       destinationId = GetRouterId(aDestination);
-    uint8_t       routeCost;
-    uint8_t       linkCost;
-    uint16_t      rval = Mac::kShortAddrInvalid;
-    const Router *router;
-    const Router *nextHop;
+    uint8_t  destinationId = GetRouterId(aDestination);
+    uint16_t rval          = Mac::kShortAddrInvalid;
 
     if (mRole == OT_DEVICE_ROLE_CHILD)
     {
@@ -3394,23 +3770,7 @@ uint16_t MleRouter::GetNextHop(uint16_t aDestination)
         ExitNow(rval = aDestination);
     }
 
-    router = mRouterTable.GetRouter(destinationId);
-    VerifyOrExit(router != NULL);
-
-    linkCost  = GetLinkCost(destinationId);
-    routeCost = GetRouteCost(aDestination);
-
-    if ((routeCost + GetLinkCost(router->GetNextHop())) < linkCost)
-    {
-        nextHop = mRouterTable.GetRouter(router->GetNextHop());
-        VerifyOrExit(nextHop != NULL && nextHop->GetState() != Neighbor::kStateInvalid);
-
-        rval = GetRloc16(router->GetNextHop());
-    }
-    else if (linkCost < kMaxRouteCost)
-    {
-        rval = GetRloc16(destinationId);
-    }
+    rval = mRouterTable.GetNextHop(destinationId);
 
 exit:
     return rval;
@@ -3467,6 +3827,7 @@ void MleRouter::SetRouterId(uint8_t aRouterId)
 {
     mRouterId         = aRouterId;
     mPreviousRouterId = mRouterId;
+    mRouterTable.InvalidateNextHops();
 }
 
 otError MleRouter::GetChildInfoById(uint16_t aChildId, otChildInfo &aChildInfo)
@@ -3571,6 +3932,114 @@ exit:
     }
 }
 
+#if OPENTHREAD_CONFIG_MLE_CHILD_STORE_DELAY
+
+otError MleRouter::RemoveStoredChild(uint16_t aChildRloc16)
+{
+    OT_UNUSED_VARIABLE(aChildRloc16);
+
+    ScheduleStoredChildrenSync();
+
+    return OT_ERROR_NONE;
+}
+
+otError MleRouter::StoreChild(const Child &aChild)
+{
+    OT_UNUSED_VARIABLE(aChild);
+
+    ScheduleStoredChildrenSync();
+
+    return OT_ERROR_NONE;
+}
+
+otError MleRouter::RefreshStoredChildren(void)
+{
+    ScheduleStoredChildrenSync();
+
+    return OT_ERROR_NONE;
+}
+
+void MleRouter::ScheduleStoredChildrenSync(void)
+{
+    // The timer is not restarted so that a steady stream of changes cannot postpone the write indefinitely.
+    if (!mChildStoreTimer.IsRunning())
+    {
+        mChildStoreTimer.Start(OPENTHREAD_CONFIG_MLE_CHILD_STORE_DELAY);
+    }
+}
+
+void MleRouter::HandleChildStoreTimer(Timer &aTimer)
+{
+    aTimer.GetOwner<MleRouter>().HandleChildStoreTimer();
+}
+
+void MleRouter::HandleChildStoreTimer(void)
+{
+    IgnoreReturnValue(SyncStoredChildren());
+}
+
+otError MleRouter::SyncStoredChildren(void)
+{
+    otError error = OT_ERROR_NONE;
+    uint8_t stored[(OPENTHREAD_CONFIG_MAX_CHILDREN + 7) / 8];
+
+    memset(stored, 0, sizeof(stored));
+
+    // Keep the stored entries that still match a child and delete the stale or duplicate ones. Deleting an entry
+    // shifts the index of the entries after it, so the iteration starts over after every deletion.
+    for (Settings::ChildInfoIterator iter(GetInstance()); !iter.IsDone();)
+    {
+        const Settings::ChildInfo &childInfo = iter.GetChildInfo();
+        Child *                    child;
+        uint8_t                    index;
+
+        child = mChildTable.FindChild(childInfo.mRloc16, ChildTable::kInStateValidOrRestoring);
+
+        if (child != NULL)
+        {
+            index = mChildTable.GetChildIndex(*child);
+
+            if (!(stored[index / 8] & (1 << (index % 8))) &&
+                (child->GetExtAddress() == *static_cast<const Mac::ExtAddress *>(&childInfo.mExtAddress)) &&
+                (child->GetTimeout() == childInfo.mTimeout) && (child->GetDeviceMode() == childInfo.mMode))
+            {
+                stored[index / 8] |= (1 << (index % 8));
+                iter++;
+                continue;
+            }
+        }
+
+        SuccessOrExit(error = iter.Delete());
+        memset(stored, 0, sizeof(stored));
+        iter.Reset();
+    }
+
+    for (ChildTable::Iterator iter(GetInstance(), ChildTable::kInStateValidOrRestoring); !iter.IsDone(); iter++)
+    {
+        const Child &       child = *iter.GetChild();
+        uint8_t             index = mChildTable.GetChildIndex(child);
+        Settings::ChildInfo childInfo;
+
+        if (stored[index / 8] & (1 << (index % 8)))
+        {
+            continue;
+        }
+
+        memset(&childInfo, 0, sizeof(childInfo));
+        childInfo.mExtAddress = child.GetExtAddress();
+        childInfo.mTimeout    = child.GetTimeout();
+        childInfo.mRloc16     = child.GetRloc16();
+        childInfo.mMode       = child.GetDeviceMode();
+
+        SuccessOrExit(error = GetInstance().GetSettings().AddChildInfo(childInfo));
+    }
+
+exit:
+    return error;
+}
+
+#else // OPENTHREAD_CONFIG_MLE_CHILD_STORE_DELAY
+
 otError MleRouter::RemoveStoredChild(uint16_t aChildRloc16)
 {
     otError error = OT_ERROR_NOT_FOUND;
@@ -3618,6 +4087,8 @@ exit:
     return error;
 }
 
+#endif // OPENTHREAD_CONFIG_MLE_CHILD_STORE_DELAY
+
 otError MleRouter::GetChildInfo(Child &aChild, otChildInfo &aChildInfo)
 {
     otError error = OT_ERROR_NONE;
@@ -3743,6 +4214,7 @@ void MleRouter::ResolveRoutingLoops(uint16_t aSourceMac, uint16_t aDestRloc16)
 
     // invalidate next hop
     router->SetNextHop(kInvalidRouterId);
+    mRouterTable.InvalidateNextHops();
     ResetAdvertiseInterval();
 
 exit:
@@ -4001,6 +4473,8 @@ void MleRouter::HandleAddressSolicitResponse(Coap::Header *          aHeader,
         leader->SetNextHop(GetRouterId(mParent.GetRloc16()));
     }
 
+    mRouterTable.InvalidateNextHops();
+
     // send link request
     SendLinkRequest(NULL);
 
@@ -4083,6 +4557,11 @@ void MleRouter::HandleAddressSolicit(Coap::Header &aHeader, Message &aMessage, c
         break;
     }
 
+#if OPENTHREAD_CONFIG_MLE_ADDRESS_SOLICIT_BATCH_WINDOW
+    // Hold back the Router ID Sequence update until the batch is sent.
+    mRouterTable.DeferRouterIdSequence();
+#endif
+
     if (ThreadTlv::GetTlv(aMessage, ThreadTlv::kRloc16, sizeof(rlocTlv), rlocTlv) == OT_ERROR_NONE)
     {
         VerifyOrExit(rlocTlv.IsValid(), error = OT_ERROR_PARSE);
@@ -4112,10 +4591,102 @@ exit:
 
     if (error == OT_ERROR_NONE)
     {
-        SendAddressSolicitResponse(aHeader, router, aMessageInfo);
+#if OPENTHREAD_CONFIG_MLE_ADDRESS_SOLICIT_BATCH_WINDOW
+        if (router != NULL)
+        {
+            AddToAddressSolicitBatch(aHeader, *router, aMessageInfo);
+        }
+        else
+#endif
+        {
+            SendAddressSolicitResponse(aHeader, router, aMessageInfo);
+        }
     }
+
+#if OPENTHREAD_CONFIG_MLE_ADDRESS_SOLICIT_BATCH_WINDOW
+    if (mAddressSolicitBatchLength == 0)
+    {
+        mRouterTable.CommitRouterIdSequence();
+    }
+#endif
 }
 
+#if OPENTHREAD_CONFIG_MLE_ADDRESS_SOLICIT_BATCH_WINDOW
+void MleRouter::AddToAddressSolicitBatch(const Coap::Header &    aRequest,
+                                         const Router &          aRouter,
+                                         const Ip6::MessageInfo &aMessageInfo)
+{
+    PendingAddressSolicit *entry = NULL;
+
+    // A retransmitted request replaces the one already in the batch.
+    for (uint8_t i = 0; i < mAddressSolicitBatchLength; i++)
+    {
+        if (mAddressSolicitBatch[i].mRouterId == aRouter.GetRouterId())
+        {
+            entry = &mAddressSolicitBatch[i];
+            break;
+        }
+    }
+
+    if (entry == NULL)
+    {
+        if (mAddressSolicitBatchLength == OPENTHREAD_CONFIG_MLE_ADDRESS_SOLICIT_BATCH_SIZE)
+        {
+            SendAddressSolicitBatch();
+        }
+
+        if (mAddressSolicitBatchLength == 0)
+        {
+            mRouterTable.DeferRouterIdSequence();
+            mAddressSolicitBatchTimer.Start(OPENTHREAD_CONFIG_MLE_ADDRESS_SOLICIT_BATCH_WINDOW);
+        }
+
+        entry = &mAddressSolicitBatch[mAddressSolicitBatchLength++];
+    }
+
+    entry->mMessageInfo = aMessageInfo;
+    entry->mMessageInfo.SetLinkInfo(NULL);
+    entry->mMessageId   = aRequest.GetMessageId();
+    entry->mTokenLength = aRequest.GetTokenLength();
+    entry->mRouterId    = aRouter.GetRouterId();
+    memcpy(entry->mToken, aRequest.GetToken(), entry->mTokenLength);
+}
+
+void MleRouter::SendAddressSolicitBatch(void)
+{
+    Coap::Header requestHeader;
+
+    mAddressSolicitBatchTimer.Stop();
+
+    // All responses of the batch carry the same Router ID Sequence and Router Mask.
+    mRouterTable.CommitRouterIdSequence();
+
+    for (uint8_t i = 0; i < mAddressSolicitBatchLength; i++)
+    {
+        const PendingAddressSolicit &entry = mAddressSolicitBatch[i];
+
+        requestHeader.Init(OT_COAP_TYPE_CONFIRMABLE, OT_COAP_CODE_POST);
+        requestHeader.SetMessageId(entry.mMessageId);
+        requestHeader.SetToken(entry.mToken, entry.mTokenLength);
+
+        // The router id may have been released in the meantime, which is answered as no address available.
+        SendAddressSolicitResponse(requestHeader, mRouterTable.GetRouter(entry.mRouterId), entry.mMessageInfo);
+    }
+
+    mAddressSolicitBatchLength = 0;
+}
+
+void MleRouter::HandleAddressSolicitBatchTimer(Timer &aTimer)
+{
+    aTimer.GetOwner<MleRouter>().HandleAddressSolicitBatchTimer();
+}
+
+void MleRouter::HandleAddressSolicitBatchTimer(void)
+{
+    SendAddressSolicitBatch();
+}
+#endif // OPENTHREAD_CONFIG_MLE_ADDRESS_SOLICIT_BATCH_WINDOW
+
 void MleRouter::SendAddressSolicitResponse(const Coap::Header &    aRequestHeader,
                                            const Router *          aRouter,
                                            const Ip6::MessageInfo &aMessageInfo)
@@ -4212,6 +4783,30 @@ exit:
     return;
 }
 
+#if OPENTHREAD_CONFIG_ENABLE_PARENT_LOAD_BALANCING
+uint8_t MleRouter::GetParentLoad(void)
+{
+    uint8_t  numChildren = GetChildTable().GetNumChildren(ChildTable::kInStateValid);
+    uint8_t  maxAllowed  = GetChildTable().GetMaxChildrenAllowed();
+    uint16_t usedBuffers = OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS - GetInstance().GetMessagePool().GetFreeBufferCount();
+    uint8_t  childLoad   = ConnectivityTlv::kMaxParentLoad;
+    uint8_t  bufferLoad;
+
+    // Queued indirect messages for sleepy children hold message buffers, so the buffer usage accounts for the
+    // per-parent queueing load in addition to the number of attached children.
+
+    if (maxAllowed > 0)
+    {
+        childLoad = static_cast<uint8_t>((numChildren * ConnectivityTlv::kMaxParentLoad) / maxAllowed);
+    }
+
+    bufferLoad = static_cast<uint8_t>((usedBuffers * ConnectivityTlv::kMaxParentLoad) /
+                                      OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS);
+
+    return (childLoad > bufferLoad) ? childLoad : bufferLoad;
+}
+#endif // OPENTHREAD_CONFIG_ENABLE_PARENT_LOAD_BALANCING
+
 void MleRouter::FillConnectivityTlv(ConnectivityTlv &aTlv)
 {
     Router *leader;
@@ -4238,6 +4833,9 @@ void MleRouter::FillConnectivityTlv(ConnectivityTlv &aTlv)
     }
 
     aTlv.SetParentPriority(parentPriority);
+#if OPENTHREAD_CONFIG_ENABLE_PARENT_LOAD_BALANCING
+    aTlv.SetParentLoad(GetParentLoad());
+#endif
 
     // compute leader cost and link qualities
     aTlv.SetLinkQuality1(0);
@@ -4270,7 +4868,7 @@ void MleRouter::FillConnectivityTlv(ConnectivityTlv &aTlv)
             break;
         }
 
-        cost += LinkQualityToCost(mParent.GetLinkInfo().GetLinkQuality());
+        cost += LinkQualityToCost(mParent.GetLinkInfo().GetLinkQuality(), mParent.GetLinkInfo());
         break;
 
     case OT_DEVICE_ROLE_ROUTER:
@@ -4502,6 +5100,92 @@ bool MleRouter::HasMinDowngradeNeighborRouters(void)
     return routerCount >= kMinDowngradeNeighbors;
 }
 
+void MleRouter::StartRouterSelectionJitter(bool aUpgrade)
+{
+#if OPENTHREAD_CONFIG_MLE_ROUTER_SELECTION_RANKED
+    uint8_t slot = mRouterSelectionJitter / (kRouterSelectionMaxRank + 1);
+    uint8_t rank = GetRouterSelectionRank();
+
+    mRouterSelectionRank = rank;
+
+    if (slot > 0)
+    {
+        // Sparse REEDs upgrade first, redundant routers downgrade first.
+        if (!aUpgrade)
+        {
+            rank = kRouterSelectionMaxRank - rank;
+        }
+
+        mRouterSelectionJitterTimeout = 1 + rank * slot + Random::GetUint8InRange(0, slot);
+        ExitNow();
+    }
+#else
+    OT_UNUSED_VARIABLE(aUpgrade);
+#endif
+
+    mRouterSelectionJitterTimeout = 1 + Random::GetUint8InRange(0, mRouterSelectionJitter);
+
+#if OPENTHREAD_CONFIG_MLE_ROUTER_SELECTION_RANKED
+exit:
+#endif
+    return;
+}
+
+#if OPENTHREAD_CONFIG_MLE_ROUTER_SELECTION_RANKED
+uint8_t MleRouter::GetRouterSelectionRank(void)
+{
+    uint8_t rank = 0;
+    uint8_t linkQuality;
+
+    for (RouterTable::Iterator iter(GetInstance()); !iter.IsDone(); iter++)
+    {
+        Router &router = *iter.GetRouter();
+
+        if (router.GetState() != Neighbor::kStateValid)
+        {
+            continue;
+        }
+
+        linkQuality = router.GetLinkInfo().GetLinkQuality();
+
+        if (linkQuality > router.GetLinkQualityOut())
+        {
+            linkQuality = router.GetLinkQualityOut();
+        }
+
+        rank += linkQuality;
+
+        if (rank >= kRouterSelectionMaxRank)
+        {
+            ExitNow(rank = kRouterSelectionMaxRank);
+        }
+    }
+
+exit:
+    return rank;
+}
+
+bool MleRouter::ShouldDeferRouterUpgrade(void)
+{
+    uint8_t slot = mRouterSelectionJitter / (kRouterSelectionMaxRank + 1);
+    uint8_t rank = GetRouterSelectionRank();
+    bool    rval = false;
+
+    // The router links gained since the jitter was started (typically a nearby REED that upgraded first) make this
+    // upgrade likely redundant, so wait for the slots of the higher rank (and re-check then).
+    VerifyOrExit(slot > 0 && rank > mRouterSelectionRank);
+
+    mRouterSelectionJitterTimeout = (rank - mRouterSelectionRank) * slot;
+    mRouterSelectionRank          = rank;
+    rval                          = true;
+
+    otLogInfoMle("Defer router upgrade, rank %d", rank);
+
+exit:
+    return rval;
+}
+#endif // OPENTHREAD_CONFIG_MLE_ROUTER_SELECTION_RANKED
+
 bool MleRouter::HasOneNeighborWithComparableConnectivity(const RouteTlv &aRoute, uint8_t aRouterId)
 {
     bool rval = true;
@@ -353,6 +353,9 @@ public:
     /**
      * This method remove a stored child information from non-volatile memory.
      *
+     * When `OPENTHREAD_CONFIG_MLE_CHILD_STORE_DELAY` is non-zero, the removal is deferred and batched with other
+     * child table changes, and this method always returns `OT_ERROR_NONE`.
+     *
      * @param[in]  aChildRloc16   The child RLOC16 to remove.
      *
      * @retval  OT_ERROR_NONE        Successfully remove child.
@@ -364,6 +367,9 @@ public:
     /**
      * This method store a child information into non-volatile memory.
      *
+     * When `OPENTHREAD_CONFIG_MLE_CHILD_STORE_DELAY` is non-zero, the write is deferred and batched with other
+     * child table changes, and this method always returns `OT_ERROR_NONE`.
+     *
      * @param[in]  aChild          A reference to the child to store.
      *
      * @retval  OT_ERROR_NONE      Successfully store child.
@@ -559,6 +565,18 @@ public:
 
     otError SendLinkRequest(Neighbor *aNeighbor);
 
+    /**
+     * This method sends a Link Request.
+     *
+     * When @p aNeighbor is NULL and @p aExtAddress is not NULL, the request is sent by unicast to @p aExtAddress using
+     * the challenge of the preceding multicast Link Request.
+     *
+     * @param[in]  aNeighbor    A pointer to the neighbor, or NULL.
+     * @param[in]  aExtAddress  A pointer to the Extended Address of the destination without neighbor entry, or NULL.
+     *
+     */
+    otError SendLinkRequest(Neighbor *aNeighbor, const Mac::ExtAddress *aExtAddress);
+
 #if OPENTHREAD_CONFIG_ENABLE_STEERING_DATA_SET_OOB
     /**
      * This method sets steering data out of band
@@ -669,6 +687,20 @@ public:
      */
     static uint8_t LinkQualityToCost(uint8_t aLinkQuality);
 
+    /**
+     * This static method converts link quality to route cost, taking into account the frame delivery on the link.
+     *
+     * When `OPENTHREAD_CONFIG_ENABLE_ETX_LINK_COST` is enabled, the cost is scaled by the expected transmission count
+     * estimated from the frame tx error rate of @p aLinkInfo. Otherwise, this is the same as `LinkQualityToCost()`.
+     *
+     * @param[in]  aLinkQuality  The link quality.
+     * @param[in]  aLinkInfo     The link quality info of the neighbor.
+     *
+     * @returns The link cost.
+     *
+     */
+    static uint8_t LinkQualityToCost(uint8_t aLinkQuality, const LinkQualityInfo &aLinkInfo);
+
 #if OPENTHREAD_CONFIG_ENABLE_TIME_SYNC
     /**
      * This method generates an MLE Time Synchronization message.
@@ -686,6 +718,13 @@ private:
         kDiscoveryMaxJitter = 250u,  ///< Maximum jitter time used to delay Discovery Responses in milliseconds.
         kStateUpdatePeriod  = 1000u, ///< State update period in milliseconds.
         kUnsolicitedDataResponseJitter = 500u, ///< Maximum delay before unsolicited Data Response in milliseconds.
+#if OPENTHREAD_CONFIG_MLE_ADVERTISE_SUPPRESSION
+        kAdvertiseSuppressStableIntervals = 5, ///< Trickle intervals without inconsistency before suppressing.
+        kAdvertiseSuppressMinNeighbors    = OPENTHREAD_CONFIG_MLE_ADVERTISE_SUPPRESSION_MIN_NEIGHBORS,
+#endif
+#if OPENTHREAD_CONFIG_MLE_ROUTER_SELECTION_RANKED
+        kRouterSelectionMaxRank = 15, ///< Maximum rank (sum of neighbor router link qualities) for the jitter slots.
+#endif
     };
 
     otError AppendConnectivity(Message &aMessage);
@@ -745,8 +784,12 @@ private:
     otError SendDataResponse(const Ip6::Address &aDestination,
                              const uint8_t *     aTlvs,
                              uint8_t             aTlvsLength,
-                             uint16_t            aDelay);
+                             uint16_t            aDelay,
+                             const Message *     aRequest);
     otError SendDiscoveryResponse(const Ip6::Address &aDestination, uint16_t aPanId);
+#if OPENTHREAD_CONFIG_MLE_NETWORK_DATA_DELTA
+    otError AppendNetworkDataDelta(Message &aMessage, bool aStableOnly, const Message *aRequest);
+#endif
 
     otError SetStateRouter(uint16_t aRloc16);
     otError SetStateLeader(uint16_t aRloc16);
@@ -774,8 +817,17 @@ private:
                                      otMessage *          aMessage,
                                      const otMessageInfo *aMessageInfo);
     void        HandleAddressSolicit(Coap::Header &aHeader, Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
+#if OPENTHREAD_CONFIG_MLE_ADDRESS_SOLICIT_BATCH_WINDOW
+    void        AddToAddressSolicitBatch(const Coap::Header &    aRequest,
+                                         const Router &          aRouter,
+                                         const Ip6::MessageInfo &aMessageInfo);
+    void        SendAddressSolicitBatch(void);
+    static void HandleAddressSolicitBatchTimer(Timer &aTimer);
+    void        HandleAddressSolicitBatchTimer(void);
+#endif
 
     static bool IsSingleton(const RouteTlv &aRouteTlv);
+    uint32_t    ComputeRouteDigest(const RouteTlv &aRoute);
 
     void HandlePartitionChange(void);
 
@@ -785,16 +837,46 @@ private:
     bool HasMinDowngradeNeighborRouters(void);
     bool HasOneNeighborWithComparableConnectivity(const RouteTlv &aRoute, uint8_t aRouterId);
     bool HasSmallNumberOfChildren(void);
+#if OPENTHREAD_CONFIG_ENABLE_PARENT_LOAD_BALANCING
+    uint8_t GetParentLoad(void);
+#endif
+
+    void StartRouterSelectionJitter(bool aUpgrade);
+#if OPENTHREAD_CONFIG_MLE_ROUTER_SELECTION_RANKED
+    uint8_t GetRouterSelectionRank(void);
+    bool    ShouldDeferRouterUpgrade(void);
+#endif
 
     static bool HandleAdvertiseTimer(TrickleTimer &aTimer);
     bool        HandleAdvertiseTimer(void);
+#if OPENTHREAD_CONFIG_MLE_ADVERTISE_SUPPRESSION
+    static bool HandleAdvertiseIntervalExpired(TrickleTimer &aTimer);
+    bool        ShouldSuppressAdvertisement(void) const;
+#endif
     static void HandleStateUpdateTimer(Timer &aTimer);
     void        HandleStateUpdateTimer(void);
+#if OPENTHREAD_CONFIG_MLE_CHILD_STORE_DELAY
+    static void HandleChildStoreTimer(Timer &aTimer);
+    void        HandleChildStoreTimer(void);
+    void        ScheduleStoredChildrenSync(void);
+    otError     SyncStoredChildren(void);
+#endif
 
     void SignalChildUpdated(otThreadChildTableEvent aEvent, Child &aChild);
 
+#if OPENTHREAD_CONFIG_ENABLE_NEIGHBOR_ROUTER_PERSISTENCE
+    void SendLinkRequestsToSavedNeighbors(void);
+    void StoreNeighborRouters(void);
+#endif
+
     TrickleTimer mAdvertiseTimer;
     TimerMilli   mStateUpdateTimer;
+#if OPENTHREAD_CONFIG_MLE_CHILD_STORE_DELAY
+    TimerMilli mChildStoreTimer;
+#endif
+#if OPENTHREAD_CONFIG_MLE_ADDRESS_SOLICIT_BATCH_WINDOW
+    TimerMilli mAddressSolicitBatchTimer;
+#endif
 
     Coap::Resource mAddressSolicit;
     Coap::Resource mAddressRelease;
@@ -825,12 +907,43 @@ private:
 
     uint8_t mRouterSelectionJitter;        ///< The variable to save the assigned jitter value.
     uint8_t mRouterSelectionJitterTimeout; ///< The Timeout prior to request/release Router ID.
+#if OPENTHREAD_CONFIG_MLE_ROUTER_SELECTION_RANKED
+    uint8_t mRouterSelectionRank; ///< The rank the current router selection jitter was derived from.
+#endif
 
     int8_t mParentPriority; ///< The assigned parent priority value, -2 means not assigned.
 
+#if OPENTHREAD_CONFIG_ENABLE_NEIGHBOR_ROUTER_PERSISTENCE
+    uint32_t mNeighborRoutersHash; ///< Hash of the neighbor routers last saved in settings.
+#endif
+
+#if OPENTHREAD_CONFIG_MLE_ADVERTISE_SUPPRESSION
+    uint8_t mAdvertiseConsistentCount; ///< Unchanged advertisements heard in the current trickle interval.
+    uint8_t mAdvertiseStableIntervals; ///< Trickle intervals since the last inconsistency.
+    bool    mAdvertiseSuppressed;      ///< Whether the last advertisement was skipped.
+#endif
+
 #if OPENTHREAD_CONFIG_ENABLE_STEERING_DATA_SET_OOB
     MeshCoP::SteeringDataTlv mSteeringData;
 #endif // OPENTHREAD_CONFIG_ENABLE_STEERING_DATA_SET_OOB
+
+#if OPENTHREAD_CONFIG_MLE_ADDRESS_SOLICIT_BATCH_WINDOW
+    /**
+     * This structure holds an Address Solicit request whose response is held back until the batch is sent.
+     *
+     */
+    struct PendingAddressSolicit
+    {
+        Ip6::MessageInfo mMessageInfo;
+        uint16_t         mMessageId;
+        uint8_t          mToken[OT_COAP_MAX_TOKEN_LENGTH];
+        uint8_t          mTokenLength;
+        uint8_t          mRouterId; ///< The router id allocated to the requester.
+    };
+
+    PendingAddressSolicit mAddressSolicitBatch[OPENTHREAD_CONFIG_MLE_ADDRESS_SOLICIT_BATCH_SIZE];
+    uint8_t               mAddressSolicitBatchLength;
+#endif
 };
 
 } // namespace Mle
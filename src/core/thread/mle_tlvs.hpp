@@ -108,6 +108,19 @@ public:
         kPendingDataset      = 25, ///< Pending Operational Dataset TLV
         kDiscovery           = 26, ///< Thread Discovery TLV
 
+        /**
+         * Applicable/Required only when Network Data delta distribution
+         * (`OPENTHREAD_CONFIG_MLE_NETWORK_DATA_DELTA`) is enabled.
+         *
+         */
+        kNetworkDataDelta = 250, ///< Network Data Delta TLV
+
+        /**
+         * Applicable/Required only when CSL receive mode (`OPENTHREAD_CONFIG_ENABLE_CSL`) is enabled.
+         *
+         */
+        kCslPeriod = 251, ///< CSL Period TLV
+
         /**
          * Applicable/Required only when time synchronization service
          * (`OPENTHREAD_CONFIG_ENABLE_TIME_SYNC`) is enabled.
@@ -1275,6 +1288,11 @@ OT_TOOL_PACKED_BEGIN
 class ConnectivityTlv : public Tlv
 {
 public:
+    enum
+    {
+        kMaxParentLoad = 15, ///< Maximum Parent Load value (@sa GetParentLoad()).
+    };
+
     /**
      * This method initializes the TLV.
      *
@@ -1329,6 +1347,30 @@ public:
         mParentPriority = (aParentPriority << kParentPriorityOffset) & kParentPriorityMask;
     }
 
+    /**
+     * This method returns the Parent Load value.
+     *
+     * The Parent Load is a vendor extension carried in the reserved bits next to the Parent Priority. It ranges from
+     * zero (idle, or not advertised) to `kMaxParentLoad` (fully loaded).
+     *
+     * @returns The Parent Load value.
+     *
+     */
+    uint8_t GetParentLoad(void) const { return mParentPriority & kParentLoadMask; }
+
+    /**
+     * This method sets the Parent Load value.
+     *
+     * @note `SetParentPriority()` clears the Parent Load, so it must be called first.
+     *
+     * @param[in] aParentLoad  The Parent Load value.
+     *
+     */
+    void SetParentLoad(uint8_t aParentLoad)
+    {
+        mParentPriority = static_cast<uint8_t>((mParentPriority & ~kParentLoadMask) | (aParentLoad & kParentLoadMask));
+    }
+
     /**
      * This method returns the Link Quality 3 value.
      *
@@ -1480,6 +1522,7 @@ private:
     {
         kParentPriorityOffset = 6,
         kParentPriorityMask   = 3 << kParentPriorityOffset,
+        kParentLoadMask       = 0x0f,
     };
 
     uint8_t  mParentPriority;
@@ -1989,6 +2032,198 @@ private:
 } OT_TOOL_PACKED_END;
 #endif // OPENTHREAD_CONFIG_ENABLE_TIME_SYNC
 
+#if OPENTHREAD_CONFIG_MLE_NETWORK_DATA_DELTA
+/**
+ * This class implements Network Data Delta TLV generation and parsing.
+ *
+ * In a request (e.g. an MLE Data Request), the TLV only holds the Network Data version of the sender. In a response,
+ * it also describes how to build the new Network Data from the one of the base version: the first `HeadLength` and
+ * last `TailLength` bytes are kept and the bytes in between are replaced with the TLV's remaining value.
+ *
+ */
+OT_TOOL_PACKED_BEGIN
+class NetworkDataDeltaTlv : public Tlv
+{
+public:
+    enum
+    {
+        kStableFlag = 1 << 0, ///< The versions and data refer to the stable Network Data.
+    };
+
+    /**
+     * This method initializes the TLV as a request.
+     *
+     */
+    void Init(void)
+    {
+        SetType(kNetworkDataDelta);
+        SetLength(kRequestLength);
+        mFlags = 0;
+    }
+
+    /**
+     * This method indicates whether or not the TLV appears to be well-formed.
+     *
+     * @retval TRUE   If the TLV appears to be well-formed.
+     * @retval FALSE  If the TLV does not appear to be well-formed.
+     *
+     */
+    bool IsValid(void) const { return GetLength() >= kRequestLength; }
+
+    /**
+     * This method indicates whether or not the TLV holds a delta (as opposed to a request).
+     *
+     * @retval TRUE   If the TLV holds a delta.
+     * @retval FALSE  If the TLV is a request.
+     *
+     */
+    bool IsDelta(void) const { return GetLength() >= sizeof(*this) - sizeof(Tlv); }
+
+    /**
+     * This method indicates whether or not the TLV refers to the stable Network Data.
+     *
+     * @retval TRUE   If the TLV refers to the stable Network Data.
+     * @retval FALSE  If the TLV refers to the full Network Data.
+     *
+     */
+    bool IsStable(void) const { return (mFlags & kStableFlag) != 0; }
+
+    /**
+     * This method sets whether or not the TLV refers to the stable Network Data.
+     *
+     * @param[in]  aStable  TRUE if the TLV refers to the stable Network Data, FALSE otherwise.
+     *
+     */
+    void SetStable(bool aStable) { mFlags = aStable ? kStableFlag : 0; }
+
+    /**
+     * This method returns the base Network Data version.
+     *
+     * @returns The version of the Network Data held by the requester, or the one a delta applies to.
+     *
+     */
+    uint8_t GetBaseVersion(void) const { return mBaseVersion; }
+
+    /**
+     * This method sets the base Network Data version.
+     *
+     * @param[in]  aVersion  The version of the Network Data held by the requester, or the one a delta applies to.
+     *
+     */
+    void SetBaseVersion(uint8_t aVersion) { mBaseVersion = aVersion; }
+
+    /**
+     * This method sets the delta, turning the TLV into a response.
+     *
+     * @param[in]  aHeadLength         The number of leading bytes kept from the base Network Data.
+     * @param[in]  aTailLength         The number of trailing bytes kept from the base Network Data.
+     * @param[in]  aReplacementLength  The number of bytes replacing the rest, which follow the TLV header.
+     * @param[in]  aChecksum           The checksum of the resulting Network Data.
+     *
+     */
+    void SetDelta(uint8_t aHeadLength, uint8_t aTailLength, uint8_t aReplacementLength, uint16_t aChecksum)
+    {
+        SetLength(sizeof(*this) - sizeof(Tlv) + aReplacementLength);
+        mHeadLength = aHeadLength;
+        mTailLength = aTailLength;
+        mChecksum   = HostSwap16(aChecksum);
+    }
+
+    /**
+     * This method returns the number of leading bytes kept from the base Network Data.
+     *
+     * @returns The number of leading bytes kept from the base Network Data.
+     *
+     */
+    uint8_t GetHeadLength(void) const { return mHeadLength; }
+
+    /**
+     * This method returns the number of trailing bytes kept from the base Network Data.
+     *
+     * @returns The number of trailing bytes kept from the base Network Data.
+     *
+     */
+    uint8_t GetTailLength(void) const { return mTailLength; }
+
+    /**
+     * This method returns the number of bytes replacing the changed part of the base Network Data.
+     *
+     * @returns The number of replacement bytes following the TLV header.
+     *
+     */
+    uint8_t GetReplacementLength(void) const { return GetLength() - (sizeof(*this) - sizeof(Tlv)); }
+
+    /**
+     * This method returns the checksum (CRC16-CCITT) of the resulting Network Data.
+     *
+     * @returns The checksum of the resulting Network Data.
+     *
+     */
+    uint16_t GetChecksum(void) const { return HostSwap16(mChecksum); }
+
+private:
+    enum
+    {
+        kRequestLength = sizeof(uint8_t) + sizeof(uint8_t), // Base version and flags.
+    };
+
+    uint8_t  mBaseVersion;
+    uint8_t  mFlags;
+    uint8_t  mHeadLength;
+    uint8_t  mTailLength;
+    uint16_t mChecksum;
+} OT_TOOL_PACKED_END;
+#endif // OPENTHREAD_CONFIG_MLE_NETWORK_DATA_DELTA
+
+#if OPENTHREAD_CONFIG_ENABLE_CSL
+/**
+ * This class implements CSL Period TLV generation and parsing.
+ *
+ */
+OT_TOOL_PACKED_BEGIN
+class CslPeriodTlv : public Tlv
+{
+public:
+    /**
+     * This method initializes the TLV.
+     *
+     */
+    void Init(void)
+    {
+        SetType(kCslPeriod);
+        SetLength(sizeof(*this) - sizeof(Tlv));
+    }
+
+    /**
+     * This method indicates whether or not the TLV appears to be well-formed.
+     *
+     * @retval TRUE   If the TLV appears to be well-formed.
+     * @retval FALSE  If the TLV does not appear to be well-formed.
+     *
+     */
+    bool IsValid(void) const { return GetLength() == sizeof(*this) - sizeof(Tlv); }
+
+    /**
+     * This method returns the CSL period.
+     *
+     * @returns The CSL period in milliseconds (zero indicates CSL receive mode is disabled).
+     *
+     */
+    uint16_t GetCslPeriod(void) const { return HostSwap16(mCslPeriod); }
+
+    /**
+     * This method sets the CSL period.
+     *
+     * @param[in]  aCslPeriod  The CSL period in milliseconds.
+     *
+     */
+    void SetCslPeriod(uint16_t aCslPeriod) { mCslPeriod = HostSwap16(aCslPeriod); }
+
+private:
+    uint16_t mCslPeriod;
+} OT_TOOL_PACKED_END;
+#endif // OPENTHREAD_CONFIG_ENABLE_CSL
+
 /**
  * This class implements Active Timestamp TLV generation and parsing.
  *
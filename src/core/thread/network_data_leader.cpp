@@ -39,6 +39,7 @@
 
 #include "coap/coap_header.hpp"
 #include "common/code_utils.hpp"
+#include "common/crc16.hpp"
 #include "common/debug.hpp"
 #include "common/encoding.hpp"
 #include "common/instance.hpp"
@@ -59,6 +60,7 @@ namespace NetworkData {
 
 LeaderBase::LeaderBase(Instance &aInstance)
     : NetworkData(aInstance, false)
+    , mContextGeneration(0)
 {
     Reset();
 }
@@ -68,23 +70,37 @@ void LeaderBase::Reset(void)
     mVersion       = static_cast<uint8_t>(otPlatRandomGet());
     mStableVersion = static_cast<uint8_t>(otPlatRandomGet());
     mLength        = 0;
+
+    mContextEntriesValid = false;
+    mContextGeneration++;
     GetNotifier().Signal(OT_CHANGED_THREAD_NETDATA);
 }
 
-otError LeaderBase::GetContext(const Ip6::Address &aAddress, Lowpan::Context &aContext)
+otError LeaderBase::Insert(uint8_t *aStart, uint8_t aLength)
 {
-    ThreadNetif &netif = GetNetif();
-    PrefixTlv *  prefix;
-    ContextTlv * contextTlv;
+    mContextEntriesValid = false;
+    mContextGeneration++;
+    return NetworkData::Insert(aStart, aLength);
+}
 
-    aContext.mPrefixLength = 0;
+otError LeaderBase::Remove(uint8_t *aStart, uint8_t aLength)
+{
+    mContextEntriesValid = false;
+    mContextGeneration++;
+    return NetworkData::Remove(aStart, aLength);
+}
 
-    if (PrefixMatch(netif.GetMle().GetMeshLocalPrefix().m8, aAddress.mFields.m8, 64) >= 0)
+void LeaderBase::UpdateContextEntries(void)
+{
+    PrefixTlv * prefix;
+    ContextTlv *contextTlv;
+    uint8_t     index;
+
+    mNumContextEntries = 0;
+
+    for (uint8_t i = 0; i < kNumContextIds; i++)
     {
-        aContext.mPrefix       = netif.GetMle().GetMeshLocalPrefix().m8;
-        aContext.mPrefixLength = 64;
-        aContext.mContextId    = 0;
-        aContext.mCompressFlag = true;
+        mContextIds[i].mPrefixOffset = kInvalidOffset;
     }
 
     for (NetworkDataTlv *cur                                            = reinterpret_cast<NetworkDataTlv *>(mTlvs);
@@ -95,75 +111,116 @@ otError LeaderBase::GetContext(const Ip6::Address &aAddress, Lowpan::Context &aC
             continue;
         }
 
-        prefix = static_cast<PrefixTlv *>(cur);
+        prefix     = static_cast<PrefixTlv *>(cur);
+        contextTlv = FindContext(*prefix);
 
-        if (PrefixMatch(prefix->GetPrefix(), aAddress.mFields.m8, prefix->GetPrefixLength()) < 0)
+        if (contextTlv == NULL || mNumContextEntries == kMaxContextEntries)
         {
             continue;
         }
 
-        contextTlv = FindContext(*prefix);
-
-        if (contextTlv == NULL)
+        // Insert after all entries with the same or a longer prefix, so that ties keep the Network Data order.
+        for (index = mNumContextEntries;
+             index > 0 && GetEntryPrefix(mContextEntries[index - 1]).GetPrefixLength() < prefix->GetPrefixLength();
+             index--)
         {
-            continue;
+            mContextEntries[index] = mContextEntries[index - 1];
         }
 
-        if (prefix->GetPrefixLength() > aContext.mPrefixLength)
+        mContextEntries[index].mPrefixOffset  = static_cast<uint8_t>(reinterpret_cast<uint8_t *>(prefix) - mTlvs);
+        mContextEntries[index].mContextOffset = static_cast<uint8_t>(reinterpret_cast<uint8_t *>(contextTlv) - mTlvs);
+        mNumContextEntries++;
+
+        if (contextTlv->GetContextId() < kNumContextIds &&
+            mContextIds[contextTlv->GetContextId()].mPrefixOffset == kInvalidOffset)
         {
-            aContext.mPrefix       = prefix->GetPrefix();
-            aContext.mPrefixLength = prefix->GetPrefixLength();
-            aContext.mContextId    = contextTlv->GetContextId();
-            aContext.mCompressFlag = contextTlv->IsCompress();
+            mContextIds[contextTlv->GetContextId()] = mContextEntries[index];
         }
     }
 
-    return (aContext.mPrefixLength > 0) ? OT_ERROR_NONE : OT_ERROR_NOT_FOUND;
+    mContextEntriesValid = true;
 }
 
-otError LeaderBase::GetContext(uint8_t aContextId, Lowpan::Context &aContext)
+PrefixTlv &LeaderBase::GetEntryPrefix(const ContextEntry &aEntry)
 {
-    otError     error = OT_ERROR_NOT_FOUND;
-    PrefixTlv * prefix;
-    ContextTlv *contextTlv;
+    return *reinterpret_cast<PrefixTlv *>(mTlvs + aEntry.mPrefixOffset);
+}
 
-    if (aContextId == 0)
+void LeaderBase::GetEntryContext(const ContextEntry &aEntry, Lowpan::Context &aContext)
+{
+    PrefixTlv & prefix     = GetEntryPrefix(aEntry);
+    ContextTlv &contextTlv = *reinterpret_cast<ContextTlv *>(mTlvs + aEntry.mContextOffset);
+
+    aContext.mPrefix       = prefix.GetPrefix();
+    aContext.mPrefixLength = prefix.GetPrefixLength();
+    aContext.mContextId    = contextTlv.GetContextId();
+    aContext.mCompressFlag = contextTlv.IsCompress();
+}
+
+otError LeaderBase::GetContext(const Ip6::Address &aAddress, Lowpan::Context &aContext)
+{
+    ThreadNetif &netif = GetNetif();
+
+    aContext.mPrefixLength = 0;
+
+    if (PrefixMatch(netif.GetMle().GetMeshLocalPrefix().m8, aAddress.mFields.m8, 64) >= 0)
     {
-        aContext.mPrefix       = GetNetif().GetMle().GetMeshLocalPrefix().m8;
+        aContext.mPrefix       = netif.GetMle().GetMeshLocalPrefix().m8;
         aContext.mPrefixLength = 64;
         aContext.mContextId    = 0;
         aContext.mCompressFlag = true;
-        ExitNow(error = OT_ERROR_NONE);
     }
 
-    for (NetworkDataTlv *cur                                            = reinterpret_cast<NetworkDataTlv *>(mTlvs);
-         cur < reinterpret_cast<NetworkDataTlv *>(mTlvs + mLength); cur = cur->GetNext())
+    if (!mContextEntriesValid)
     {
-        if (cur->GetType() != NetworkDataTlv::kTypePrefix)
-        {
-            continue;
-        }
+        UpdateContextEntries();
+    }
 
-        prefix     = static_cast<PrefixTlv *>(cur);
-        contextTlv = FindContext(*prefix);
+    // Entries are sorted by prefix length, so the first match is the longest one.
+    for (uint8_t i = 0; i < mNumContextEntries; i++)
+    {
+        PrefixTlv &prefix = GetEntryPrefix(mContextEntries[i]);
 
-        if (contextTlv == NULL)
+        if (prefix.GetPrefixLength() <= aContext.mPrefixLength)
         {
-            continue;
+            break;
         }
 
-        if (contextTlv->GetContextId() != aContextId)
+        if (PrefixMatch(prefix.GetPrefix(), aAddress.mFields.m8, prefix.GetPrefixLength()) >= 0)
         {
-            continue;
+            GetEntryContext(mContextEntries[i], aContext);
+            break;
         }
+    }
+
+    return (aContext.mPrefixLength > 0) ? OT_ERROR_NONE : OT_ERROR_NOT_FOUND;
+}
 
-        aContext.mPrefix       = prefix->GetPrefix();
-        aContext.mPrefixLength = prefix->GetPrefixLength();
-        aContext.mContextId    = contextTlv->GetContextId();
-        aContext.mCompressFlag = contextTlv->IsCompress();
+otError LeaderBase::GetContext(uint8_t aContextId, Lowpan::Context &aContext)
+{
+    otError error = OT_ERROR_NOT_FOUND;
+
+    if (aContextId == 0)
+    {
+        aContext.mPrefix       = GetNetif().GetMle().GetMeshLocalPrefix().m8;
+        aContext.mPrefixLength = 64;
+        aContext.mContextId    = 0;
+        aContext.mCompressFlag = true;
         ExitNow(error = OT_ERROR_NONE);
     }
 
+    VerifyOrExit(aContextId < kNumContextIds);
+
+    if (!mContextEntriesValid)
+    {
+        UpdateContextEntries();
+    }
+
+    VerifyOrExit(mContextIds[aContextId].mPrefixOffset != kInvalidOffset);
+
+    GetEntryContext(mContextIds[aContextId], aContext);
+    error = OT_ERROR_NONE;
+
 exit:
     return error;
 }
@@ -417,6 +474,9 @@ otError LeaderBase::SetNetworkData(uint8_t        aVersion,
     length = aMessage.Read(aMessageOffset, sizeof(tlv), &tlv);
     VerifyOrExit(length == sizeof(tlv), error = OT_ERROR_PARSE);
 
+    mContextEntriesValid = false;
+    mContextGeneration++;
+
     length = aMessage.Read(aMessageOffset + sizeof(tlv), tlv.GetLength(), mTlvs);
     VerifyOrExit(length == tlv.GetLength(), error = OT_ERROR_PARSE);
 
@@ -437,6 +497,61 @@ exit:
     return error;
 }
 
+#if OPENTHREAD_CONFIG_MLE_NETWORK_DATA_DELTA
+otError LeaderBase::ApplyNetworkDataDelta(uint8_t        aVersion,
+                                          uint8_t        aStableVersion,
+                                          bool           aStableOnly,
+                                          const Message &aMessage,
+                                          uint16_t       aMessageOffset)
+{
+    otError                  error = OT_ERROR_NONE;
+    Mle::NetworkDataDeltaTlv tlv;
+    Crc16                    checksum(Crc16::kCcitt);
+    uint8_t                  tlvs[kMaxSize];
+    uint16_t                 length;
+    uint8_t                  headLength;
+    uint8_t                  tailLength;
+    uint8_t                  replacementLength;
+
+    length = aMessage.Read(aMessageOffset, sizeof(tlv), &tlv);
+    VerifyOrExit(length == sizeof(tlv) && tlv.IsDelta(), error = OT_ERROR_PARSE);
+
+    VerifyOrExit(tlv.IsStable() == aStableOnly, error = OT_ERROR_NOT_FOUND);
+    VerifyOrExit(tlv.GetBaseVersion() == (aStableOnly ? mStableVersion : mVersion), error = OT_ERROR_NOT_FOUND);
+
+    headLength        = tlv.GetHeadLength();
+    tailLength        = tlv.GetTailLength();
+    replacementLength = tlv.GetReplacementLength();
+    VerifyOrExit(headLength + tailLength <= mLength, error = OT_ERROR_PARSE);
+    VerifyOrExit(headLength + replacementLength + tailLength <= kMaxSize, error = OT_ERROR_PARSE);
+
+    // Build the new Network Data aside, so that the current one is kept if the result does not check out.
+    memcpy(tlvs, mTlvs, headLength);
+    length = aMessage.Read(aMessageOffset + sizeof(tlv), replacementLength, tlvs + headLength);
+    VerifyOrExit(length == replacementLength, error = OT_ERROR_PARSE);
+    memcpy(tlvs + headLength + replacementLength, mTlvs + mLength - tailLength, tailLength);
+
+    length = headLength + replacementLength + tailLength;
+    checksum.Update(tlvs, length);
+    VerifyOrExit(checksum.Get() == tlv.GetChecksum(), error = OT_ERROR_NOT_FOUND);
+
+    mContextEntriesValid = false;
+    mContextGeneration++;
+
+    memcpy(mTlvs, tlvs, length);
+    mLength        = static_cast<uint8_t>(length);
+    mVersion       = aVersion;
+    mStableVersion = aStableVersion;
+
+    otDumpDebgNetData("apply network data delta", mTlvs, mLength);
+
+    GetNotifier().Signal(OT_CHANGED_THREAD_NETDATA);
+
+exit:
+    return error;
+}
+#endif // OPENTHREAD_CONFIG_MLE_NETWORK_DATA_DELTA
+
 otError LeaderBase::SetCommissioningData(const uint8_t *aValue, uint8_t aValueLength)
 {
     otError               error     = OT_ERROR_NONE;
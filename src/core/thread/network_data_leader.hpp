@@ -95,6 +95,17 @@ public:
      */
     uint8_t GetStableVersion(void) const { return mStableVersion; }
 
+    /**
+     * This method returns a counter that changes whenever the Network Data, and so possibly its 6LoWPAN Contexts,
+     * changes.
+     *
+     * This allows callers to cache results of `GetContext()`.
+     *
+     * @returns The context generation counter.
+     *
+     */
+    uint32_t GetContextGeneration(void) const { return mContextGeneration; }
+
     /**
      * This method retrieves the 6LoWPAN Context information based on a given IPv6 address.
      *
@@ -166,6 +177,31 @@ public:
                            const Message &aMessage,
                            uint16_t       aMessageOffset);
 
+#if OPENTHREAD_CONFIG_MLE_NETWORK_DATA_DELTA
+    /**
+     * This method is used by non-Leader devices to update their Network Data from a received Network Data Delta TLV.
+     *
+     * The Network Data is left unchanged unless the delta applies to the local version and the result matches the
+     * checksum carried in the TLV.
+     *
+     * @param[in]  aVersion        The Version value.
+     * @param[in]  aStableVersion  The Stable Version value.
+     * @param[in]  aStableOnly     TRUE if storing only the stable data, FALSE otherwise.
+     * @param[in]  aMessage        A reference to the MLE message.
+     * @param[in]  aMessageOffset  The offset in @p aMessage for the Network Data Delta TLV.
+     *
+     * @retval OT_ERROR_NONE       Successfully updated the network data.
+     * @retval OT_ERROR_NOT_FOUND  The delta does not apply to the local Network Data.
+     * @retval OT_ERROR_PARSE      Network Data Delta TLV in @p aMessage is not valid.
+     *
+     */
+    otError ApplyNetworkDataDelta(uint8_t        aVersion,
+                                  uint8_t        aStableVersion,
+                                  bool           aStableOnly,
+                                  const Message &aMessage,
+                                  uint16_t       aMessageOffset);
+#endif
+
     /**
      * This method sends a Server Data Notification message to the Leader indicating an invalid RLOC16.
      *
@@ -232,10 +268,54 @@ public:
 #endif // OPENTHREAD_ENABLE_DHCP6_SERVER || OPENTHREAD_ENABLE_DHCP6_CLIENT
 
 protected:
+    /**
+     * This method inserts bytes into the Network Data and invalidates the context lookup entries.
+     *
+     * @param[in]  aStart   A pointer to the beginning of the insertion.
+     * @param[in]  aLength  The number of bytes to insert.
+     *
+     * @retval OT_ERROR_NONE          Successfully inserted bytes.
+     * @retval OT_ERROR_NO_BUFS       Insufficient buffer space to insert bytes.
+     *
+     */
+    otError Insert(uint8_t *aStart, uint8_t aLength);
+
+    /**
+     * This method removes bytes from the Network Data and invalidates the context lookup entries.
+     *
+     * @param[in]  aStart   A pointer to the beginning of the removal.
+     * @param[in]  aLength  The number of bytes to remove.
+     *
+     * @retval OT_ERROR_NONE    Successfully removed bytes.
+     *
+     */
+    otError Remove(uint8_t *aStart, uint8_t aLength);
+
     uint8_t mStableVersion;
     uint8_t mVersion;
 
 private:
+    enum
+    {
+        kNumContextIds     = 16,
+        kMaxContextEntries = kMaxSize / (sizeof(PrefixTlv) + sizeof(ContextTlv)),
+        kInvalidOffset     = 0xff,
+    };
+
+    /**
+     * This structure locates a Prefix TLV with a Context sub-TLV within `mTlvs`.
+     *
+     */
+    struct ContextEntry
+    {
+        uint8_t mPrefixOffset;  ///< The offset of the Prefix TLV.
+        uint8_t mContextOffset; ///< The offset of the Context TLV.
+    };
+
+    void       UpdateContextEntries(void);
+    PrefixTlv &GetEntryPrefix(const ContextEntry &aEntry);
+    void       GetEntryContext(const ContextEntry &aEntry, Lowpan::Context &aContext);
+
     otError RemoveCommissioningData(void);
 
     otError ExternalRouteLookup(uint8_t             aDomainId,
@@ -243,6 +323,13 @@ private:
                                 uint8_t *           aPrefixMatch,
                                 uint16_t *          aRloc16);
     otError DefaultRouteLookup(PrefixTlv &aPrefix, uint16_t *aRloc16);
+
+    // Context lookup entries, rebuilt from `mTlvs` on the first lookup after any change.
+    ContextEntry mContextEntries[kMaxContextEntries]; ///< Sorted by prefix length, longest first.
+    ContextEntry mContextIds[kNumContextIds];         ///< Indexed by Context ID.
+    uint8_t      mNumContextEntries;
+    bool         mContextEntriesValid;
+    uint32_t     mContextGeneration;
 };
 
 /**
@@ -41,6 +41,7 @@
 
 #include "coap/coap_header.hpp"
 #include "common/code_utils.hpp"
+#include "common/crc16.hpp"
 #include "common/debug.hpp"
 #include "common/encoding.hpp"
 #include "common/instance.hpp"
@@ -78,6 +79,11 @@ void Leader::Reset(void)
     memset(mContextLastUsed, 0, sizeof(mContextLastUsed));
     mContextUsed         = 0;
     mContextIdReuseDelay = kContextIdReuseDelay;
+
+#if OPENTHREAD_CONFIG_MLE_NETWORK_DATA_DELTA
+    mDeltaBase.mValid   = false;
+    mDeltaLatest.mValid = false;
+#endif
 }
 
 void Leader::Start(void)
@@ -98,6 +104,91 @@ void Leader::Stop(void)
     coap.RemoveResource(mCommissioningDataSet);
 }
 
+#if OPENTHREAD_CONFIG_MLE_NETWORK_DATA_DELTA
+void Leader::UpdateDeltaBase(void)
+{
+    VerifyOrExit(!mDeltaLatest.mValid || mDeltaLatest.mVersion != mVersion);
+
+    mDeltaBase = mDeltaLatest;
+
+    memcpy(mDeltaLatest.mTlvs, mTlvs, mLength);
+    mDeltaLatest.mLength        = mLength;
+    mDeltaLatest.mVersion       = mVersion;
+    mDeltaLatest.mStableVersion = mStableVersion;
+    mDeltaLatest.mValid         = true;
+
+exit:
+    return;
+}
+
+otError Leader::GetDeltaBaseVersion(bool aStableOnly, uint8_t &aVersion) const
+{
+    otError error = OT_ERROR_NONE;
+
+    VerifyOrExit(mDeltaBase.mValid, error = OT_ERROR_NOT_FOUND);
+    aVersion = aStableOnly ? mDeltaBase.mStableVersion : mDeltaBase.mVersion;
+
+exit:
+    return error;
+}
+
+otError Leader::AppendNetworkDataDelta(Message &aMessage, bool aStableOnly, uint8_t aBaseVersion)
+{
+    otError                  error = OT_ERROR_NONE;
+    Mle::NetworkDataDeltaTlv tlv;
+    Crc16                    checksum(Crc16::kCcitt);
+    uint8_t                  base[kMaxSize];
+    uint8_t                  baseLength;
+    uint8_t                  current[kMaxSize];
+    uint8_t                  currentLength = sizeof(current);
+    uint8_t                  headLength    = 0;
+    uint8_t                  tailLength    = 0;
+    uint8_t                  replacementLength;
+
+    VerifyOrExit(mDeltaBase.mValid, error = OT_ERROR_NOT_FOUND);
+    VerifyOrExit(aBaseVersion == (aStableOnly ? mDeltaBase.mStableVersion : mDeltaBase.mVersion),
+                 error = OT_ERROR_NOT_FOUND);
+
+    memcpy(base, mDeltaBase.mTlvs, mDeltaBase.mLength);
+    baseLength = mDeltaBase.mLength;
+
+    if (aStableOnly)
+    {
+        RemoveTemporaryData(base, baseLength);
+    }
+
+    SuccessOrExit(error = GetNetworkData(aStableOnly, current, currentLength));
+
+    // Keep the longest common head and tail, replacing only the bytes in between.
+    while (headLength < baseLength && headLength < currentLength && base[headLength] == current[headLength])
+    {
+        headLength++;
+    }
+
+    while (tailLength < baseLength - headLength && tailLength < currentLength - headLength &&
+           base[baseLength - 1 - tailLength] == current[currentLength - 1 - tailLength])
+    {
+        tailLength++;
+    }
+
+    replacementLength = currentLength - headLength - tailLength;
+    VerifyOrExit(sizeof(tlv) + replacementLength < sizeof(Mle::Tlv) + currentLength, error = OT_ERROR_NOT_FOUND);
+
+    checksum.Update(current, currentLength);
+
+    tlv.Init();
+    tlv.SetStable(aStableOnly);
+    tlv.SetBaseVersion(aBaseVersion);
+    tlv.SetDelta(headLength, tailLength, replacementLength, checksum.Get());
+
+    SuccessOrExit(error = aMessage.Append(&tlv, sizeof(tlv)));
+    SuccessOrExit(error = aMessage.Append(current + headLength, replacementLength));
+
+exit:
+    return error;
+}
+#endif // OPENTHREAD_CONFIG_MLE_NETWORK_DATA_DELTA
+
 void Leader::IncrementVersion(void)
 {
     if (GetNetif().GetMle().GetRole() == OT_DEVICE_ROLE_LEADER)
@@ -788,9 +879,13 @@ otError Leader::RegisterNetworkData(uint16_t aRloc16, uint8_t *aTlvs, uint8_t aT
         // Store old Service IDs for given rloc16, so updates to server will reuse the same Service ID
         SuccessOrExit(error = GetNetworkData(false, oldTlvs, oldTlvsLength));
 
-        SuccessOrExit(error = RemoveRloc(aRloc16, kMatchModeRloc16));
+        // Only remove the entries that are no longer registered, the others are then updated in place.
+        SuccessOrExit(error = RemoveRloc(aRloc16, kMatchModeRloc16, aTlvs, aTlvsLength));
         SuccessOrExit(error = AddNetworkData(aTlvs, aTlvsLength, oldTlvs, oldTlvsLength));
 
+        // A re-registration of unchanged data must not trigger a new distribution of the Network Data.
+        VerifyOrExit(mLength != oldTlvsLength || memcmp(mTlvs, oldTlvs, mLength) != 0);
+
         mVersion++;
 
         if (stableUpdated)
@@ -930,10 +1025,11 @@ exit:
 
 otError Leader::AddHasRoute(PrefixTlv &aPrefix, HasRouteTlv &aHasRoute)
 {
-    otError      error        = OT_ERROR_NONE;
-    PrefixTlv *  dstPrefix    = NULL;
-    HasRouteTlv *dstHasRoute  = NULL;
-    uint16_t     appendLength = 0;
+    otError        error        = OT_ERROR_NONE;
+    PrefixTlv *    dstPrefix    = NULL;
+    HasRouteTlv *  dstHasRoute  = NULL;
+    HasRouteEntry *dstEntry     = NULL;
+    uint16_t       appendLength = 0;
 
     VerifyOrExit(aHasRoute.GetNumEntries() > 0, error = OT_ERROR_PARSE);
 
@@ -942,6 +1038,13 @@ otError Leader::AddHasRoute(PrefixTlv &aPrefix, HasRouteTlv &aHasRoute)
         dstHasRoute = FindHasRoute(*dstPrefix, aHasRoute.IsStable());
     }
 
+    if (dstHasRoute != NULL && (dstEntry = FindEntry(*dstHasRoute, aHasRoute.GetEntry(0)->GetRloc())) != NULL)
+    {
+        // The router already has an entry for this route, so just update it in place.
+        memcpy(dstEntry, aHasRoute.GetEntry(0), sizeof(HasRouteEntry));
+        ExitNow();
+    }
+
     if (dstPrefix == NULL)
     {
         appendLength += sizeof(PrefixTlv) + BitVectorBytes(aPrefix.GetPrefixLength());
@@ -1108,12 +1211,13 @@ exit:
 
 otError Leader::AddBorderRouter(PrefixTlv &aPrefix, BorderRouterTlv &aBorderRouter)
 {
-    otError          error           = OT_ERROR_NONE;
-    PrefixTlv *      dstPrefix       = NULL;
-    ContextTlv *     dstContext      = NULL;
-    BorderRouterTlv *dstBorderRouter = NULL;
-    int              contextId       = -1;
-    uint16_t         appendLength    = 0;
+    otError            error           = OT_ERROR_NONE;
+    PrefixTlv *        dstPrefix       = NULL;
+    ContextTlv *       dstContext      = NULL;
+    BorderRouterTlv *  dstBorderRouter = NULL;
+    BorderRouterEntry *dstEntry        = NULL;
+    int                contextId       = -1;
+    uint16_t           appendLength    = 0;
 
     VerifyOrExit(aBorderRouter.GetNumEntries() > 0, error = OT_ERROR_PARSE);
 
@@ -1123,6 +1227,16 @@ otError Leader::AddBorderRouter(PrefixTlv &aPrefix, BorderRouterTlv &aBorderRout
         dstBorderRouter = FindBorderRouter(*dstPrefix, aBorderRouter.IsStable());
     }
 
+    if (dstContext != NULL && dstBorderRouter != NULL &&
+        (dstEntry = FindEntry(*dstBorderRouter, aBorderRouter.GetEntry(0)->GetRloc())) != NULL)
+    {
+        // The router already has an entry for this prefix, so just update it in place.
+        memcpy(dstEntry, aBorderRouter.GetEntry(0), sizeof(BorderRouterEntry));
+        dstContext->SetCompress();
+        mContextLastUsed[dstContext->GetContextId() - kMinContextId] = 0;
+        ExitNow();
+    }
+
     if (dstPrefix == NULL)
     {
         appendLength += sizeof(PrefixTlv) + BitVectorBytes(aPrefix.GetPrefixLength());
@@ -1194,6 +1308,42 @@ exit:
     return error;
 }
 
+HasRouteEntry *Leader::FindEntry(HasRouteTlv &aHasRoute, uint16_t aRloc16)
+{
+    HasRouteEntry *entry;
+
+    for (entry = aHasRoute.GetFirstEntry(); entry <= aHasRoute.GetLastEntry(); entry = entry->GetNext())
+    {
+        if (entry->GetRloc() == aRloc16)
+        {
+            ExitNow();
+        }
+    }
+
+    entry = NULL;
+
+exit:
+    return entry;
+}
+
+BorderRouterEntry *Leader::FindEntry(BorderRouterTlv &aBorderRouter, uint16_t aRloc16)
+{
+    BorderRouterEntry *entry;
+
+    for (entry = aBorderRouter.GetFirstEntry(); entry <= aBorderRouter.GetLastEntry(); entry = entry->GetNext())
+    {
+        if (entry->GetRloc() == aRloc16)
+        {
+            ExitNow();
+        }
+    }
+
+    entry = NULL;
+
+exit:
+    return entry;
+}
+
 int Leader::AllocateContext(void)
 {
     int rval = -1;
@@ -1241,10 +1391,16 @@ exit:
 }
 
 otError Leader::RemoveRloc(uint16_t aRloc16, MatchMode aMatchMode)
+{
+    return RemoveRloc(aRloc16, aMatchMode, NULL, 0);
+}
+
+otError Leader::RemoveRloc(uint16_t aRloc16, MatchMode aMatchMode, uint8_t *aExcludeTlvs, uint8_t aExcludeTlvsLength)
 {
     NetworkDataTlv *cur = reinterpret_cast<NetworkDataTlv *>(mTlvs);
     NetworkDataTlv *end;
     PrefixTlv *     prefix;
+    PrefixTlv *     excludePrefix;
 #if OPENTHREAD_ENABLE_SERVICE
     ServiceTlv *service;
 #endif
@@ -1262,8 +1418,16 @@ otError Leader::RemoveRloc(uint16_t aRloc16, MatchMode aMatchMode)
         {
         case NetworkDataTlv::kTypePrefix:
         {
-            prefix = static_cast<PrefixTlv *>(cur);
-            RemoveRloc(*prefix, aRloc16, aMatchMode);
+            prefix        = static_cast<PrefixTlv *>(cur);
+            excludePrefix = NULL;
+
+            if (aExcludeTlvs != NULL)
+            {
+                excludePrefix =
+                    FindPrefix(prefix->GetPrefix(), prefix->GetPrefixLength(), aExcludeTlvs, aExcludeTlvsLength);
+            }
+
+            RemoveRloc(*prefix, aRloc16, aMatchMode, excludePrefix);
 
             if (prefix->GetSubTlvsLength() == 0)
             {
@@ -1307,7 +1471,7 @@ otError Leader::RemoveRloc(uint16_t aRloc16, MatchMode aMatchMode)
     return OT_ERROR_NONE;
 }
 
-otError Leader::RemoveRloc(PrefixTlv &prefix, uint16_t aRloc16, MatchMode aMatchMode)
+otError Leader::RemoveRloc(PrefixTlv &prefix, uint16_t aRloc16, MatchMode aMatchMode, PrefixTlv *aExcludePrefix)
 {
     NetworkDataTlv *cur = prefix.GetSubTlvs();
     NetworkDataTlv *end;
@@ -1325,6 +1489,12 @@ otError Leader::RemoveRloc(PrefixTlv &prefix, uint16_t aRloc16, MatchMode aMatch
         switch (cur->GetType())
         {
         case NetworkDataTlv::kTypeHasRoute:
+            if (aExcludePrefix != NULL && FindHasRoute(*aExcludePrefix, cur->IsStable()) != NULL)
+            {
+                // The entry is still registered and gets updated in place.
+                break;
+            }
+
             RemoveRloc(prefix, *static_cast<HasRouteTlv *>(cur), aRloc16, aMatchMode);
 
             // remove has route tlv if empty
@@ -1338,6 +1508,12 @@ otError Leader::RemoveRloc(PrefixTlv &prefix, uint16_t aRloc16, MatchMode aMatch
             break;
 
         case NetworkDataTlv::kTypeBorderRouter:
+            if (aExcludePrefix != NULL && FindBorderRouter(*aExcludePrefix, cur->IsStable()) != NULL)
+            {
+                // The entry is still registered and gets updated in place.
+                break;
+            }
+
             RemoveRloc(prefix, *static_cast<BorderRouterTlv *>(cur), aRloc16, aMatchMode);
 
             // remove border router tlv if empty
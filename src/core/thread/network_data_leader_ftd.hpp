@@ -151,6 +151,44 @@ public:
      */
     otError SendServerDataNotification(uint16_t aRloc16);
 
+#if OPENTHREAD_CONFIG_MLE_NETWORK_DATA_DELTA
+    /**
+     * This method records the current Network Data as the latest version known to neighbors.
+     *
+     * It should be called whenever the Network Data changes. The version recorded by the previous call then becomes
+     * the base of the deltas appended by `AppendNetworkDataDelta()`.
+     *
+     */
+    void UpdateDeltaBase(void);
+
+    /**
+     * This method gets the Network Data version that deltas are computed from.
+     *
+     * @param[in]   aStableOnly  TRUE to get the stable version, FALSE to get the full version.
+     * @param[out]  aVersion     A reference to where the version is placed.
+     *
+     * @retval OT_ERROR_NONE       Successfully retrieved the version.
+     * @retval OT_ERROR_NOT_FOUND  No base is recorded yet.
+     *
+     */
+    otError GetDeltaBaseVersion(bool aStableOnly, uint8_t &aVersion) const;
+
+    /**
+     * This method appends a Network Data Delta TLV that turns the Network Data of a given version into the current
+     * Network Data.
+     *
+     * @param[in]  aMessage      A reference to the message.
+     * @param[in]  aStableOnly   TRUE to update the stable Network Data, FALSE to update the full Network Data.
+     * @param[in]  aBaseVersion  The (stable) Network Data version held by the receiver.
+     *
+     * @retval OT_ERROR_NONE       Successfully appended the Network Data Delta TLV.
+     * @retval OT_ERROR_NOT_FOUND  No delta from @p aBaseVersion is available or it is not smaller than the full data.
+     * @retval OT_ERROR_NO_BUFS    Insufficient buffers to append the TLV.
+     *
+     */
+    otError AppendNetworkDataDelta(Message &aMessage, bool aStableOnly, uint8_t aBaseVersion);
+#endif
+
 #if OPENTHREAD_ENABLE_SERVICE
     /**
      * This method scans network data for given service ID and returns pointer to the respective TLV, if present.
@@ -183,6 +221,9 @@ private:
     otError AddService(ServiceTlv &aTlv, uint8_t *aOldTlvs, uint8_t aOldTlvsLength);
 #endif
 
+    static HasRouteEntry *    FindEntry(HasRouteTlv &aHasRoute, uint16_t aRloc16);
+    static BorderRouterEntry *FindEntry(BorderRouterTlv &aBorderRouter, uint16_t aRloc16);
+
     int     AllocateContext(void);
     otError FreeContext(uint8_t aContextId);
 
@@ -192,7 +233,8 @@ private:
     otError RemoveCommissioningData(void);
 
     otError RemoveRloc(uint16_t aRloc16, MatchMode aMatchMode);
-    otError RemoveRloc(PrefixTlv &aPrefix, uint16_t aRloc16, MatchMode aMatchMode);
+    otError RemoveRloc(uint16_t aRloc16, MatchMode aMatchMode, uint8_t *aExcludeTlvs, uint8_t aExcludeTlvsLength);
+    otError RemoveRloc(PrefixTlv &aPrefix, uint16_t aRloc16, MatchMode aMatchMode, PrefixTlv *aExcludePrefix);
 #if OPENTHREAD_ENABLE_SERVICE
     otError RemoveRloc(ServiceTlv &service, uint16_t aRloc16, MatchMode aMatchMode);
 #endif
@@ -247,6 +289,20 @@ private:
     uint32_t   mContextIdReuseDelay;
     TimerMilli mTimer;
 
+#if OPENTHREAD_CONFIG_MLE_NETWORK_DATA_DELTA
+    struct Snapshot
+    {
+        uint8_t mTlvs[kMaxSize];
+        uint8_t mLength;
+        uint8_t mVersion;
+        uint8_t mStableVersion;
+        bool    mValid;
+    };
+
+    Snapshot mDeltaBase;   ///< Network Data of the previous version, which deltas are computed from.
+    Snapshot mDeltaLatest; ///< Network Data as of the last `UpdateDeltaBase()` call.
+#endif
+
     Coap::Resource mServerData;
 
     Coap::Resource mCommissioningDataGet;
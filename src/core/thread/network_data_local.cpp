@@ -48,6 +48,9 @@ namespace NetworkData {
 Local::Local(Instance &aInstance)
     : NetworkData(aInstance, true)
     , mOldRloc(Mac::kShortAddrInvalid)
+#if OPENTHREAD_CONFIG_NETWORK_DATA_REGISTER_DELAY
+    , mRegisterTimer(aInstance, &Local::HandleRegisterTimer, this)
+#endif
 {
 }
 
@@ -336,6 +339,29 @@ bool Local::IsServiceConsistent(void)
 #endif
 
 otError Local::SendServerDataNotification(void)
+{
+#if OPENTHREAD_CONFIG_NETWORK_DATA_REGISTER_DELAY
+    // The window starts at the first request, so a steady stream of
+    // changes cannot hold the registration back indefinitely.
+    if (!mRegisterTimer.IsRunning())
+    {
+        mRegisterTimer.Start(OPENTHREAD_CONFIG_NETWORK_DATA_REGISTER_DELAY);
+    }
+
+    return OT_ERROR_NONE;
+#else
+    return Register();
+#endif
+}
+
+#if OPENTHREAD_CONFIG_NETWORK_DATA_REGISTER_DELAY
+void Local::HandleRegisterTimer(Timer &aTimer)
+{
+    aTimer.GetOwner<Local>().Register();
+}
+#endif
+
+otError Local::Register(void)
 {
     ThreadNetif &   netif = GetNetif();
     Mle::MleRouter &mle   = netif.GetMle();
@@ -36,6 +36,7 @@
 
 #include "openthread-core-config.h"
 
+#include "common/timer.hpp"
 #include "thread/network_data.hpp"
 
 namespace ot {
@@ -159,13 +160,21 @@ public:
     /**
      * This method sends a Server Data Notification message to the Leader.
      *
-     * @retval OT_ERROR_NONE     Successfully enqueued the notification message.
+     * When `OPENTHREAD_CONFIG_NETWORK_DATA_REGISTER_DELAY` is non-zero, the message is sent once the delay has elapsed,
+     * and all calls within the delay result in a single message.
+     *
+     * @retval OT_ERROR_NONE     Successfully enqueued (or scheduled) the notification message.
      * @retval OT_ERROR_NO_BUFS  Insufficient message buffers to generate the notification message.
      *
      */
     otError SendServerDataNotification(void);
 
 private:
+#if OPENTHREAD_CONFIG_NETWORK_DATA_REGISTER_DELAY
+    static void HandleRegisterTimer(Timer &aTimer);
+#endif
+    otError Register(void);
+
     otError UpdateRloc(void);
     otError UpdateRloc(PrefixTlv &aPrefix);
     otError UpdateRloc(HasRouteTlv &aHasRoute);
@@ -182,6 +191,9 @@ private:
 #endif
 
     uint16_t mOldRloc;
+#if OPENTHREAD_CONFIG_NETWORK_DATA_REGISTER_DELAY
+    TimerMilli mRegisterTimer;
+#endif
 };
 
 } // namespace NetworkData
@@ -43,6 +43,7 @@
 #include "common/encoding.hpp"
 #include "common/instance.hpp"
 #include "common/logging.hpp"
+#include "common/random.hpp"
 #include "mac/mac.hpp"
 #include "mac/mac_frame.hpp"
 #include "net/netif.hpp"
@@ -68,6 +69,11 @@ NetworkDiagnostic::NetworkDiagnostic(Instance &aInstance)
     , mDiagnosticReset(OT_URI_PATH_DIAGNOSTIC_RESET, &NetworkDiagnostic::HandleDiagnosticReset, this)
     , mReceiveDiagnosticGetCallback(NULL)
     , mReceiveDiagnosticGetCallbackContext(NULL)
+    , mAnswerTimer(aInstance, &NetworkDiagnostic::HandleAnswerTimer, this)
+    , mAnswerTypesLength(0)
+    , mAnswerTypeIndex(0)
+    , mAnswerEntryIndex(0)
+    , mAnswerPending(false)
 {
     GetNetif().GetCoap().AddResource(mDiagnosticGetRequest);
     GetNetif().GetCoap().AddResource(mDiagnosticGetQuery);
@@ -203,53 +209,88 @@ exit:
     return;
 }
 
-otError NetworkDiagnostic::AppendIp6AddressList(Message &aMessage)
+otError NetworkDiagnostic::AppendIp6AddressList(Message &aMessage, uint16_t aMaxLength, uint8_t &aIndex)
 {
     ThreadNetif &     netif = GetNetif();
     otError           error = OT_ERROR_NONE;
     Ip6AddressListTlv tlv;
-    uint8_t           count = 0;
+    uint8_t           total = 0;
+    uint8_t           count;
+    uint8_t           index = 0;
 
     tlv.Init();
 
     for (const Ip6::NetifUnicastAddress *addr = netif.GetUnicastAddresses(); addr; addr = addr->GetNext())
     {
-        count++;
+        total++;
+    }
+
+    count = (aIndex < total) ? total - aIndex : 0;
+
+    if (sizeof(tlv) + count * sizeof(Ip6::Address) > aMaxLength)
+    {
+        count = (aMaxLength > sizeof(tlv)) ? static_cast<uint8_t>((aMaxLength - sizeof(tlv)) / sizeof(Ip6::Address))
+                                           : 0;
+        VerifyOrExit(count > 0, error = OT_ERROR_NO_BUFS);
     }
 
     tlv.SetLength(count * sizeof(Ip6::Address));
     SuccessOrExit(error = aMessage.Append(&tlv, sizeof(tlv)));
 
-    for (const Ip6::NetifUnicastAddress *addr = netif.GetUnicastAddresses(); addr; addr = addr->GetNext())
+    for (const Ip6::NetifUnicastAddress *addr = netif.GetUnicastAddresses(); addr && count > 0; addr = addr->GetNext())
     {
+        if (index++ < aIndex)
+        {
+            continue;
+        }
+
         SuccessOrExit(error = aMessage.Append(&addr->GetAddress(), sizeof(Ip6::Address)));
+        count--;
     }
 
+    aIndex = (index < total) ? index : 0;
+
 exit:
 
     return error;
 }
 
-otError NetworkDiagnostic::AppendChildTable(Message &aMessage)
+otError NetworkDiagnostic::AppendChildTable(Message &aMessage, uint16_t aMaxLength, uint8_t &aIndex)
 {
     ThreadNetif &   netif   = GetNetif();
     otError         error   = OT_ERROR_NONE;
+    uint8_t         total   = 0;
     uint8_t         count   = 0;
+    uint8_t         index   = 0;
     uint8_t         timeout = 0;
     ChildTableTlv   tlv;
     ChildTableEntry entry;
 
     tlv.Init();
 
-    count = netif.GetMle().GetChildTable().GetNumChildren(ChildTable::kInStateValid);
+    total = netif.GetMle().GetChildTable().GetNumChildren(ChildTable::kInStateValid);
+    count = (aIndex < total) ? total - aIndex : 0;
+
+    if (sizeof(tlv) + count * sizeof(ChildTableEntry) > aMaxLength)
+    {
+        count = (aMaxLength > sizeof(tlv)) ? static_cast<uint8_t>((aMaxLength - sizeof(tlv)) / sizeof(ChildTableEntry))
+                                           : 0;
+        VerifyOrExit(count > 0, error = OT_ERROR_NO_BUFS);
+    }
+
     tlv.SetLength(count * sizeof(ChildTableEntry));
 
     SuccessOrExit(error = aMessage.Append(&tlv, sizeof(ChildTableTlv)));
 
-    for (ChildTable::Iterator iter(GetInstance(), ChildTable::kInStateValid); !iter.IsDone(); iter++)
+    for (ChildTable::Iterator iter(GetInstance(), ChildTable::kInStateValid); !iter.IsDone() && count > 0; iter++)
     {
         Child &child = *iter.GetChild();
 
+        if (index++ < aIndex)
+        {
+            continue;
+        }
+
         timeout = 0;
 
         while (static_cast<uint32_t>(1 << timeout) < child.GetTimeout())
@@ -263,8 +304,11 @@ otError NetworkDiagnostic::AppendChildTable(Message &aMessage)
         entry.SetMode(child.GetDeviceMode());
 
         SuccessOrExit(error = aMessage.Append(&entry, sizeof(ChildTableEntry)));
+        count--;
     }
 
+    aIndex = (index < total) ? index : 0;
+
 exit:
 
     return error;
@@ -288,175 +332,184 @@ void NetworkDiagnostic::FillMacCountersTlv(MacCountersTlv &aMacCountersTlv)
     aMacCountersTlv.SetIfOutDiscards(macCounters.mTxErrBusyChannel);
 }
 
-otError NetworkDiagnostic::FillRequestedTlvs(Message &             aRequest,
-                                             Message &             aResponse,
-                                             NetworkDiagnosticTlv &aNetworkDiagnosticTlv)
+otError NetworkDiagnostic::AppendRequestedTlv(Message &aMessage, uint8_t aType, uint16_t aMaxLength, uint8_t &aIndex)
 {
-    ThreadNetif &netif  = GetNetif();
-    otError      error  = OT_ERROR_NONE;
-    uint16_t     offset = 0;
-    uint8_t      type;
+    ThreadNetif &netif = GetNetif();
+    otError      error = OT_ERROR_NONE;
 
-    offset = aRequest.GetOffset() + sizeof(NetworkDiagnosticTlv);
+    otLogInfoNetDiag("Type %d", aType);
 
-    for (uint32_t i = 0; i < aNetworkDiagnosticTlv.GetLength(); i++)
+    switch (aType)
     {
-        VerifyOrExit(aRequest.Read(offset, sizeof(type), &type) == sizeof(type), error = OT_ERROR_DROP);
-
-        otLogInfoNetDiag("Type %d", type);
+    case NetworkDiagnosticTlv::kExtMacAddress:
+    {
+        ExtMacAddressTlv tlv;
+        tlv.Init();
+        tlv.SetMacAddr(netif.GetMac().GetExtAddress());
+        SuccessOrExit(error = aMessage.Append(&tlv, sizeof(tlv)));
+        break;
+    }
 
-        switch (type)
-        {
-        case NetworkDiagnosticTlv::kExtMacAddress:
-        {
-            ExtMacAddressTlv tlv;
-            tlv.Init();
-            tlv.SetMacAddr(netif.GetMac().GetExtAddress());
-            SuccessOrExit(error = aResponse.Append(&tlv, sizeof(tlv)));
-            break;
-        }
+    case NetworkDiagnosticTlv::kAddress16:
+    {
+        Address16Tlv tlv;
+        tlv.Init();
+        tlv.SetRloc16(netif.GetMle().GetRloc16());
+        SuccessOrExit(error = aMessage.Append(&tlv, sizeof(tlv)));
+        break;
+    }
 
-        case NetworkDiagnosticTlv::kAddress16:
-        {
-            Address16Tlv tlv;
-            tlv.Init();
-            tlv.SetRloc16(netif.GetMle().GetRloc16());
-            SuccessOrExit(error = aResponse.Append(&tlv, sizeof(tlv)));
-            break;
-        }
+    case NetworkDiagnosticTlv::kMode:
+    {
+        ModeTlv tlv;
+        tlv.Init();
+        tlv.SetMode(netif.GetMle().GetDeviceMode());
+        SuccessOrExit(error = aMessage.Append(&tlv, sizeof(tlv)));
+        break;
+    }
 
-        case NetworkDiagnosticTlv::kMode:
+    case NetworkDiagnosticTlv::kTimeout:
+    {
+        if (!netif.GetMle().IsRxOnWhenIdle())
         {
-            ModeTlv tlv;
+            TimeoutTlv tlv;
             tlv.Init();
-            tlv.SetMode(netif.GetMle().GetDeviceMode());
-            SuccessOrExit(error = aResponse.Append(&tlv, sizeof(tlv)));
-            break;
+            tlv.SetTimeout(
+                TimerMilli::MsecToSec(netif.GetMeshForwarder().GetDataPollManager().GetKeepAlivePollPeriod()));
+            SuccessOrExit(error = aMessage.Append(&tlv, sizeof(tlv)));
         }
 
-        case NetworkDiagnosticTlv::kTimeout:
-        {
-            if (!netif.GetMle().IsRxOnWhenIdle())
-            {
-                TimeoutTlv tlv;
-                tlv.Init();
-                tlv.SetTimeout(
-                    TimerMilli::MsecToSec(netif.GetMeshForwarder().GetDataPollManager().GetKeepAlivePollPeriod()));
-                SuccessOrExit(error = aResponse.Append(&tlv, sizeof(tlv)));
-            }
-
-            break;
-        }
+        break;
+    }
 
-        case NetworkDiagnosticTlv::kConnectivity:
-        {
-            ConnectivityTlv tlv;
-            tlv.Init();
-            netif.GetMle().FillConnectivityTlv(*reinterpret_cast<Mle::ConnectivityTlv *>(&tlv));
-            SuccessOrExit(error = aResponse.Append(&tlv, sizeof(tlv)));
-            break;
-        }
+    case NetworkDiagnosticTlv::kConnectivity:
+    {
+        ConnectivityTlv tlv;
+        tlv.Init();
+        netif.GetMle().FillConnectivityTlv(*reinterpret_cast<Mle::ConnectivityTlv *>(&tlv));
+        SuccessOrExit(error = aMessage.Append(&tlv, sizeof(tlv)));
+        break;
+    }
 
 #if OPENTHREAD_FTD
-        case NetworkDiagnosticTlv::kRoute:
-        {
-            RouteTlv tlv;
-            tlv.Init();
-            netif.GetMle().FillRouteTlv(*reinterpret_cast<Mle::RouteTlv *>(&tlv));
-            SuccessOrExit(error = aResponse.Append(&tlv, tlv.GetSize()));
-            break;
-        }
+    case NetworkDiagnosticTlv::kRoute:
+    {
+        RouteTlv tlv;
+        tlv.Init();
+        netif.GetMle().FillRouteTlv(*reinterpret_cast<Mle::RouteTlv *>(&tlv));
+        SuccessOrExit(error = aMessage.Append(&tlv, tlv.GetSize()));
+        break;
+    }
 #endif
 
-        case NetworkDiagnosticTlv::kLeaderData:
-        {
-            LeaderDataTlv tlv(reinterpret_cast<const LeaderDataTlv &>(netif.GetMle().GetLeaderDataTlv()));
-            tlv.Init();
-            SuccessOrExit(error = aResponse.Append(&tlv, tlv.GetSize()));
-            break;
-        }
+    case NetworkDiagnosticTlv::kLeaderData:
+    {
+        LeaderDataTlv tlv(reinterpret_cast<const LeaderDataTlv &>(netif.GetMle().GetLeaderDataTlv()));
+        tlv.Init();
+        SuccessOrExit(error = aMessage.Append(&tlv, tlv.GetSize()));
+        break;
+    }
 
-        case NetworkDiagnosticTlv::kNetworkData:
-        {
-            NetworkDataTlv tlv;
-            tlv.Init();
-            netif.GetMle().FillNetworkDataTlv((*reinterpret_cast<Mle::NetworkDataTlv *>(&tlv)), false);
-            SuccessOrExit(error = aResponse.Append(&tlv, tlv.GetSize()));
-            break;
-        }
+    case NetworkDiagnosticTlv::kNetworkData:
+    {
+        NetworkDataTlv tlv;
+        tlv.Init();
+        netif.GetMle().FillNetworkDataTlv((*reinterpret_cast<Mle::NetworkDataTlv *>(&tlv)), false);
+        SuccessOrExit(error = aMessage.Append(&tlv, tlv.GetSize()));
+        break;
+    }
 
-        case NetworkDiagnosticTlv::kIp6AddressList:
-        {
-            SuccessOrExit(error = AppendIp6AddressList(aResponse));
-            break;
-        }
+    case NetworkDiagnosticTlv::kIp6AddressList:
+    {
+        SuccessOrExit(error = AppendIp6AddressList(aMessage, aMaxLength, aIndex));
+        break;
+    }
 
-        case NetworkDiagnosticTlv::kMacCounters:
-        {
-            MacCountersTlv tlv;
-            memset(&tlv, 0, sizeof(tlv));
-            tlv.Init();
-            FillMacCountersTlv(tlv);
-            SuccessOrExit(error = aResponse.Append(&tlv, tlv.GetSize()));
-            break;
-        }
+    case NetworkDiagnosticTlv::kMacCounters:
+    {
+        MacCountersTlv tlv;
+        memset(&tlv, 0, sizeof(tlv));
+        tlv.Init();
+        FillMacCountersTlv(tlv);
+        SuccessOrExit(error = aMessage.Append(&tlv, tlv.GetSize()));
+        break;
+    }
 
-        case NetworkDiagnosticTlv::kBatteryLevel:
-        {
-            // Thread 1.1.1 Specification Section 10.11.4.2:
-            // Omitted if the battery level is not measured, is unknown or the device does not
-            // operate on battery power.
-            break;
-        }
+    case NetworkDiagnosticTlv::kBatteryLevel:
+    {
+        // Thread 1.1.1 Specification Section 10.11.4.2:
+        // Omitted if the battery level is not measured, is unknown or the device does not
+        // operate on battery power.
+        break;
+    }
 
-        case NetworkDiagnosticTlv::kSupplyVoltage:
-        {
-            // Thread 1.1.1 Specification Section 10.11.4.3:
-            // Omitted if the supply voltage is not measured, is unknown.
-            break;
-        }
+    case NetworkDiagnosticTlv::kSupplyVoltage:
+    {
+        // Thread 1.1.1 Specification Section 10.11.4.3:
+        // Omitted if the supply voltage is not measured, is unknown.
+        break;
+    }
 
-        case NetworkDiagnosticTlv::kChildTable:
+    case NetworkDiagnosticTlv::kChildTable:
+    {
+        // Thread 1.1.1 Specification Section 10.11.2.2:
+        // If a Thread device is unable to supply a specific Diagnostic TLV, that TLV is omitted.
+        // Here only Leader or Router may have children.
+        if (netif.GetMle().GetRole() == OT_DEVICE_ROLE_LEADER || netif.GetMle().GetRole() == OT_DEVICE_ROLE_ROUTER)
         {
-            // Thread 1.1.1 Specification Section 10.11.2.2:
-            // If a Thread device is unable to supply a specific Diagnostic TLV, that TLV is omitted.
-            // Here only Leader or Router may have children.
-            if (netif.GetMle().GetRole() == OT_DEVICE_ROLE_LEADER || netif.GetMle().GetRole() == OT_DEVICE_ROLE_ROUTER)
-            {
-                SuccessOrExit(error = AppendChildTable(aResponse));
-            }
-            break;
+            SuccessOrExit(error = AppendChildTable(aMessage, aMaxLength, aIndex));
         }
+        break;
+    }
+
+    case NetworkDiagnosticTlv::kChannelPages:
+    {
+        ChannelPagesTlv tlv;
+        tlv.Init();
+        tlv.GetChannelPages()[0] = OT_RADIO_CHANNEL_PAGE;
+        tlv.SetLength(1);
+        SuccessOrExit(error = aMessage.Append(&tlv, tlv.GetSize()));
+        break;
+    }
+
+    case NetworkDiagnosticTlv::kMaxChildTimeout:
+    {
+        uint32_t maxTimeout = 0;
 
-        case NetworkDiagnosticTlv::kChannelPages:
+        if (netif.GetMle().GetMaxChildTimeout(maxTimeout) == OT_ERROR_NONE)
         {
-            ChannelPagesTlv tlv;
+            MaxChildTimeoutTlv tlv;
             tlv.Init();
-            tlv.GetChannelPages()[0] = OT_RADIO_CHANNEL_PAGE;
-            tlv.SetLength(1);
-            SuccessOrExit(error = aResponse.Append(&tlv, tlv.GetSize()));
-            break;
+            tlv.SetTimeout(maxTimeout);
+            SuccessOrExit(error = aMessage.Append(&tlv, sizeof(tlv)));
         }
 
-        case NetworkDiagnosticTlv::kMaxChildTimeout:
-        {
-            uint32_t maxTimeout = 0;
+        break;
+    }
 
-            if (netif.GetMle().GetMaxChildTimeout(maxTimeout) == OT_ERROR_NONE)
-            {
-                MaxChildTimeoutTlv tlv;
-                tlv.Init();
-                tlv.SetTimeout(maxTimeout);
-                SuccessOrExit(error = aResponse.Append(&tlv, sizeof(tlv)));
-            }
+    default:
+        ExitNow(error = OT_ERROR_DROP);
+    }
 
-            break;
-        }
+exit:
+    return error;
+}
 
-        default:
-            ExitNow(error = OT_ERROR_DROP);
-        }
+otError NetworkDiagnostic::FillRequestedTlvs(Message &             aRequest,
+                                             Message &             aResponse,
+                                             NetworkDiagnosticTlv &aNetworkDiagnosticTlv)
+{
+    otError  error  = OT_ERROR_NONE;
+    uint16_t offset = 0;
+    uint8_t  index  = 0;
+    uint8_t  type;
 
+    offset = aRequest.GetOffset() + sizeof(NetworkDiagnosticTlv);
+
+    for (uint32_t i = 0; i < aNetworkDiagnosticTlv.GetLength(); i++)
+    {
+        VerifyOrExit(aRequest.Read(offset, sizeof(type), &type) == sizeof(type), error = OT_ERROR_DROP);
+        SuccessOrExit(error = AppendRequestedTlv(aResponse, type, kUnlimitedLength, index));
         offset += sizeof(type);
     }
 
@@ -478,12 +531,10 @@ void NetworkDiagnostic::HandleDiagnosticGetQuery(Coap::Header &          aHeader
                                                  Message &               aMessage,
                                                  const Ip6::MessageInfo &aMessageInfo)
 {
-    ThreadNetif &        netif   = GetNetif();
-    otError              error   = OT_ERROR_NONE;
-    Message *            message = NULL;
+    ThreadNetif &        netif = GetNetif();
+    otError              error = OT_ERROR_NONE;
     NetworkDiagnosticTlv networkDiagnosticTlv;
-    Coap::Header         header;
-    Ip6::MessageInfo     messageInfo;
+    uint32_t             delay = 0;
 
     VerifyOrExit(aHeader.GetCode() == OT_COAP_CODE_POST, error = OT_ERROR_DROP);
 
@@ -506,38 +557,128 @@ void NetworkDiagnostic::HandleDiagnosticGetQuery(Coap::Header &          aHeader
         }
     }
 
+    // Only one answer is built at a time, a query received while a previous answer is still pending is dropped.
+    VerifyOrExit(!mAnswerPending, error = OT_ERROR_BUSY);
+
+    mAnswerTypesLength = static_cast<uint8_t>(
+        aMessage.Read(aMessage.GetOffset() + sizeof(NetworkDiagnosticTlv), networkDiagnosticTlv.GetLength(),
+                      mAnswerTypes));
+    VerifyOrExit(mAnswerTypesLength == networkDiagnosticTlv.GetLength(), error = OT_ERROR_DROP);
+
+    mAnswerDestination = aMessageInfo.GetPeerAddr();
+    mAnswerTypeIndex   = 0;
+    mAnswerEntryIndex  = 0;
+    mAnswerPending     = true;
+
+#if OPENTHREAD_CONFIG_NETWORK_DIAGNOSTIC_ANSWER_MAX_DELAY
+    if (aMessageInfo.GetSockAddr().IsMulticast())
+    {
+        delay = Random::GetUint32InRange(0, OPENTHREAD_CONFIG_NETWORK_DIAGNOSTIC_ANSWER_MAX_DELAY + 1);
+    }
+#endif
+
+    if (delay > 0)
+    {
+        mAnswerTimer.Start(delay);
+    }
+    else
+    {
+        SendDiagnosticGetAnswer();
+    }
+
+exit:
+
+    if (error != OT_ERROR_NONE)
+    {
+        otLogInfoNetDiag("Failed to handle diagnostic get query: %s", otThreadErrorToString(error));
+    }
+}
+
+void NetworkDiagnostic::HandleAnswerTimer(Timer &aTimer)
+{
+    aTimer.GetOwner<NetworkDiagnostic>().SendDiagnosticGetAnswer();
+}
+
+void NetworkDiagnostic::SendDiagnosticGetAnswer(void)
+{
+    ThreadNetif &    netif   = GetNetif();
+    otError          error   = OT_ERROR_NONE;
+    Message *        message = NULL;
+    Coap::Header     header;
+    Ip6::MessageInfo messageInfo;
+
     header.Init(OT_COAP_TYPE_CONFIRMABLE, OT_COAP_CODE_POST);
     header.SetToken(Coap::Header::kDefaultTokenLength);
     header.AppendUriPathOptions(OT_URI_PATH_DIAGNOSTIC_GET_ANSWER);
 
-    if (networkDiagnosticTlv.GetLength() > 0)
+    if (mAnswerTypesLength > 0)
     {
         header.SetPayloadMarker();
     }
 
     VerifyOrExit((message = netif.GetCoap().NewMessage(header)) != NULL, error = OT_ERROR_NO_BUFS);
 
-    messageInfo.SetPeerAddr(aMessageInfo.GetPeerAddr());
-    messageInfo.SetPeerPort(kCoapUdpPort);
-    messageInfo.SetInterfaceId(netif.GetInterfaceId());
+    while (mAnswerTypeIndex < mAnswerTypesLength)
+    {
+#if OPENTHREAD_CONFIG_NETWORK_DIAGNOSTIC_ANSWER_MAX_LENGTH
+        uint16_t length    = message->GetLength();
+        uint16_t maxLength = (length < kAnswerMaxLength) ? kAnswerMaxLength - length : 0;
 
-    SuccessOrExit(error = FillRequestedTlvs(aMessage, *message, networkDiagnosticTlv));
+        error = AppendRequestedTlv(*message, mAnswerTypes[mAnswerTypeIndex], maxLength, mAnswerEntryIndex);
 
-    if (message->GetLength() == header.GetLength())
+        // A TLV that does not fit is moved to the next answer, unless it is too long for an answer on its own.
+        if ((error == OT_ERROR_NO_BUFS || message->GetLength() > kAnswerMaxLength) && length > header.GetLength())
+        {
+            message->SetLength(length);
+            error = OT_ERROR_NONE;
+            break;
+        }
+#else
+        error = AppendRequestedTlv(*message, mAnswerTypes[mAnswerTypeIndex], kUnlimitedLength, mAnswerEntryIndex);
+#endif
+
+        SuccessOrExit(error);
+
+        if (mAnswerEntryIndex == 0)
+        {
+            mAnswerTypeIndex++;
+        }
+    }
+
+    if (mAnswerTypesLength > 0 && message->GetLength() == header.GetLength())
     {
         // Remove Payload Marker if payload is actually empty.
         message->SetLength(header.GetLength() - 1);
     }
 
+    messageInfo.SetPeerAddr(mAnswerDestination);
+    messageInfo.SetPeerPort(kCoapUdpPort);
+    messageInfo.SetInterfaceId(netif.GetInterfaceId());
+
     SuccessOrExit(error = netif.GetCoap().SendMessage(*message, messageInfo, NULL, this));
 
     otLogInfoNetDiag("Sent diagnostic get answer");
 
+    if (mAnswerTypeIndex < mAnswerTypesLength)
+    {
+        // Give the previous answer time to be acknowledged, and its buffers freed, before building the next one.
+        mAnswerTimer.Start(kAnswerPageInterval);
+    }
+    else
+    {
+        mAnswerPending = false;
+    }
+
 exit:
 
-    if (error != OT_ERROR_NONE && message != NULL)
+    if (error != OT_ERROR_NONE)
     {
-        message->Free();
+        mAnswerPending = false;
+
+        if (message != NULL)
+        {
+            message->Free();
+        }
     }
 }
 
@@ -38,6 +38,7 @@
 
 #include "coap/coap.hpp"
 #include "common/locator.hpp"
+#include "common/timer.hpp"
 #include "net/udp6.hpp"
 #include "thread/network_diagnostic_tlvs.hpp"
 
@@ -99,10 +100,21 @@ public:
     otError SendDiagnosticReset(const Ip6::Address &aDestination, const uint8_t aTlvTypes[], uint8_t aCount);
 
 private:
-    otError AppendIp6AddressList(Message &aMessage);
-    otError AppendChildTable(Message &aMessage);
+    enum
+    {
+        kUnlimitedLength    = 0xffff, ///< Maximum TLV length value meaning no limit.
+        kAnswerPageInterval = 100,    ///< Interval between the messages of a split answer (milliseconds).
+        kAnswerMaxLength    = OPENTHREAD_CONFIG_NETWORK_DIAGNOSTIC_ANSWER_MAX_LENGTH,
+    };
+
+    otError AppendIp6AddressList(Message &aMessage, uint16_t aMaxLength, uint8_t &aIndex);
+    otError AppendChildTable(Message &aMessage, uint16_t aMaxLength, uint8_t &aIndex);
+    otError AppendRequestedTlv(Message &aMessage, uint8_t aType, uint16_t aMaxLength, uint8_t &aIndex);
     void    FillMacCountersTlv(MacCountersTlv &aMacCountersTlv);
     otError FillRequestedTlvs(Message &aRequest, Message &aResponse, NetworkDiagnosticTlv &aNetworkDiagnosticTlv);
+    void    SendDiagnosticGetAnswer(void);
+
+    static void HandleAnswerTimer(Timer &aTimer);
 
     static void HandleDiagnosticGetRequest(void *               aContext,
                                            otCoapHeader *       aHeader,
@@ -145,6 +157,14 @@ private:
 
     otReceiveDiagnosticGetCallback mReceiveDiagnosticGetCallback;
     void *                         mReceiveDiagnosticGetCallbackContext;
+
+    TimerMilli   mAnswerTimer;
+    Ip6::Address mAnswerDestination;
+    uint8_t      mAnswerTypes[OT_NETWORK_DIAGNOSTIC_TYPELIST_MAX_ENTRIES];
+    uint8_t      mAnswerTypesLength;
+    uint8_t      mAnswerTypeIndex;  ///< Index of the next requested TLV to append to an answer.
+    uint8_t      mAnswerEntryIndex; ///< Index of the next entry of a list TLV that did not fit in the last answer.
+    bool         mAnswerPending;
 };
 
 /**
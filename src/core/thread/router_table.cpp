@@ -82,6 +82,12 @@ RouterTable::RouterTable(Instance &aInstance)
     , mRouterIdSequenceLastUpdated(0)
     , mRouterIdSequence(Random::GetUint8())
     , mActiveRouterCount(0)
+    , mReuseDelayCount(0)
+    , mNextHopsValid(false)
+#if OPENTHREAD_CONFIG_MLE_ADDRESS_SOLICIT_BATCH_WINDOW
+    , mRouterIdSequenceDeferred(false)
+    , mRouterIdSequenceChanged(false)
+#endif
 {
     Clear();
 }
@@ -90,15 +96,18 @@ void RouterTable::Clear(void)
 {
     memset(mAllocatedRouterIds, 0, sizeof(mAllocatedRouterIds));
     memset(mRouterIdReuseDelay, 0, sizeof(mRouterIdReuseDelay));
+    mReuseDelayCount = 0;
     UpdateAllocation();
 }
 
 void RouterTable::ClearNeighbors(void)
 {
-    for (uint8_t i = 0; i < Mle::kMaxRouters; i++)
+    for (uint8_t i = 0; i < mActiveRouterCount; i++)
     {
         mRouters[i].SetState(Neighbor::kStateInvalid);
     }
+
+    InvalidateNextHops();
 }
 
 bool RouterTable::IsAllocated(uint8_t aRouterId) const
@@ -108,9 +117,10 @@ bool RouterTable::IsAllocated(uint8_t aRouterId) const
 
 void RouterTable::UpdateAllocation(void)
 {
-    uint8_t indexMap[Mle::kMaxRouterId + 1];
+    uint8_t *indexMap = mRouterIndex;
 
     mActiveRouterCount = 0;
+    InvalidateNextHops();
 
     // build index map
     for (uint8_t i = 0; i <= Mle::kMaxRouterId; i++)
@@ -245,15 +255,51 @@ Router *RouterTable::Allocate(uint8_t aRouterId)
     rval = GetRouter(aRouterId);
     rval->SetLastHeard(TimerMilli::GetNow());
 
+    UpdateRouterIdSequence();
+
+    otLogNoteMle("Allocate router id %d", aRouterId);
+
+exit:
+    return rval;
+}
+
+void RouterTable::UpdateRouterIdSequence(void)
+{
+#if OPENTHREAD_CONFIG_MLE_ADDRESS_SOLICIT_BATCH_WINDOW
+    if (mRouterIdSequenceDeferred)
+    {
+        mRouterIdSequenceChanged = true;
+        ExitNow();
+    }
+#endif
+
     mRouterIdSequence++;
     mRouterIdSequenceLastUpdated = TimerMilli::GetNow();
     GetNetif().GetMle().ResetAdvertiseInterval();
 
-    otLogNoteMle("Allocate router id %d", aRouterId);
+#if OPENTHREAD_CONFIG_MLE_ADDRESS_SOLICIT_BATCH_WINDOW
+exit:
+#endif
+    return;
+}
+
+#if OPENTHREAD_CONFIG_MLE_ADDRESS_SOLICIT_BATCH_WINDOW
+void RouterTable::CommitRouterIdSequence(void)
+{
+    VerifyOrExit(mRouterIdSequenceDeferred);
+
+    mRouterIdSequenceDeferred = false;
+
+    if (mRouterIdSequenceChanged)
+    {
+        mRouterIdSequenceChanged = false;
+        UpdateRouterIdSequence();
+    }
 
 exit:
-    return rval;
+    return;
 }
+#endif
 
 otError RouterTable::Release(uint8_t aRouterId)
 {
@@ -267,17 +313,17 @@ otError RouterTable::Release(uint8_t aRouterId)
     mAllocatedRouterIds[aRouterId / 8] &= ~(1 << (aRouterId % 8));
     UpdateAllocation();
 
+    if (mRouterIdReuseDelay[aRouterId] == 0)
+    {
+        mReuseDelayCount++;
+    }
+
     mRouterIdReuseDelay[aRouterId] = Mle::kRouterIdReuseDelay;
 
-    for (int i = 0; i < Mle::kMaxRouters; i++)
+    for (uint8_t i = 0; i < mActiveRouterCount; i++)
     {
         Router &router = mRouters[i];
 
-        if (router.GetRloc16() == 0xffff)
-        {
-            break;
-        }
-
         if (router.GetNextHop() == rloc16)
         {
             router.SetNextHop(Mle::kInvalidRouterId);
@@ -304,16 +350,12 @@ void RouterTable::RemoveNeighbor(Router &aRouter)
 
     aRouter.SetLinkQualityOut(0);
     aRouter.SetLastHeard(TimerMilli::GetNow());
+    InvalidateNextHops();
 
-    for (uint8_t i = 0; i < Mle::kMaxRouters; i++)
+    for (uint8_t i = 0; i < mActiveRouterCount; i++)
     {
         Router &cur = mRouters[i];
 
-        if (cur.GetRloc16() == 0xffff)
-        {
-            break;
-        }
-
         if (cur.GetNextHop() == aRouter.GetRouterId())
         {
             cur.SetNextHop(Mle::kInvalidRouterId);
@@ -341,7 +383,7 @@ Router *RouterTable::GetNeighbor(uint16_t aRloc16)
 
     VerifyOrExit(aRloc16 != GetNetif().GetMle().GetRloc16());
 
-    for (int i = 0; i < Mle::kMaxRouters; i++)
+    for (uint8_t i = 0; i < mActiveRouterCount; i++)
     {
         if (mRouters[i].GetState() == Neighbor::kStateValid && mRouters[i].GetRloc16() == aRloc16)
         {
@@ -360,7 +402,7 @@ Router *RouterTable::GetNeighbor(const Mac::ExtAddress &aExtAddress)
 
     VerifyOrExit(aExtAddress != GetNetif().GetMac().GetExtAddress());
 
-    for (int i = 0; i < Mle::kMaxRouters; i++)
+    for (uint8_t i = 0; i < mActiveRouterCount; i++)
     {
         if (mRouters[i].GetState() == Neighbor::kStateValid && mRouters[i].GetExtAddress() == aExtAddress)
         {
@@ -375,17 +417,10 @@ exit:
 
 Router *RouterTable::GetRouter(uint8_t aRouterId)
 {
-    Router * rval   = NULL;
-    uint16_t rloc16 = Mle::Mle::GetRloc16(aRouterId);
+    Router *rval = NULL;
 
-    for (uint8_t i = 0; i < Mle::kMaxRouters; i++)
-    {
-        if (mRouters[i].GetRloc16() == rloc16)
-        {
-            rval = &mRouters[i];
-            ExitNow();
-        }
-    }
+    VerifyOrExit(aRouterId <= Mle::kMaxRouterId && mRouterIndex[aRouterId] != Mle::kInvalidRouterId);
+    rval = &mRouters[mRouterIndex[aRouterId]];
 
 exit:
     return rval;
@@ -393,17 +428,10 @@ exit:
 
 const Router *RouterTable::GetRouter(uint8_t aRouterId) const
 {
-    const Router *rval   = NULL;
-    uint16_t      rloc16 = Mle::Mle::GetRloc16(aRouterId);
+    const Router *rval = NULL;
 
-    for (uint8_t i = 0; i < Mle::kMaxRouters; i++)
-    {
-        if (mRouters[i].GetRloc16() == rloc16)
-        {
-            rval = &mRouters[i];
-            ExitNow();
-        }
-    }
+    VerifyOrExit(aRouterId <= Mle::kMaxRouterId && mRouterIndex[aRouterId] != Mle::kInvalidRouterId);
+    rval = &mRouters[mRouterIndex[aRouterId]];
 
 exit:
     return rval;
@@ -413,13 +441,8 @@ Router *RouterTable::GetRouter(const Mac::ExtAddress &aExtAddress)
 {
     Router *router = NULL;
 
-    for (int i = 0; i < Mle::kMaxRouters; i++)
+    for (uint8_t i = 0; i < mActiveRouterCount; i++)
     {
-        if (mRouters[i].GetRloc16() == 0xffff)
-        {
-            break;
-        }
-
         if (mRouters[i].GetExtAddress() == aExtAddress)
         {
             router = &mRouters[i];
@@ -482,7 +505,7 @@ uint8_t RouterTable::GetNeighborCount(void) const
 {
     uint8_t count = 0;
 
-    for (int i = 0; i < Mle::kMaxRouters; i++)
+    for (uint8_t i = 0; i < mActiveRouterCount; i++)
     {
         if (mRouters[i].GetState() == Neighbor::kStateValid)
         {
@@ -506,7 +529,7 @@ uint8_t RouterTable::GetLinkCost(Router &aRouter)
         rval = aRouter.GetLinkQualityOut();
     }
 
-    rval = Mle::MleRouter::LinkQualityToCost(rval);
+    rval = Mle::MleRouter::LinkQualityToCost(rval, aRouter.GetLinkInfo());
 
 exit:
     return rval;
@@ -588,6 +611,9 @@ void RouterTable::ProcessTimerTick(void)
 {
     Mle::MleRouter &mle = GetNetif().GetMle();
 
+    // Link quality in is averaged over received frames, refresh next hops periodically to track it.
+    InvalidateNextHops();
+
     if (mle.GetRole() == OT_DEVICE_ROLE_LEADER)
     {
         // update router id sequence
@@ -597,16 +623,78 @@ void RouterTable::ProcessTimerTick(void)
             mRouterIdSequenceLastUpdated = TimerMilli::GetNow();
         }
 
-        for (uint8_t i = 0; i <= Mle::kMaxRouterId; i++)
+        for (uint8_t i = 0; i <= Mle::kMaxRouterId && mReuseDelayCount > 0; i++)
         {
-            if (mRouterIdReuseDelay[i] > 0)
+            if (mRouterIdReuseDelay[i] > 0 && --mRouterIdReuseDelay[i] == 0)
             {
-                mRouterIdReuseDelay[i]--;
+                mReuseDelayCount--;
             }
         }
     }
 }
 
+uint16_t RouterTable::GetNextHop(uint8_t aRouterId)
+{
+    uint16_t rval = Mac::kShortAddrInvalid;
+
+    VerifyOrExit(aRouterId <= Mle::kMaxRouterId);
+
+    if (!mNextHopsValid)
+    {
+        UpdateNextHops();
+    }
+
+    rval = mNextHops[aRouterId];
+
+exit:
+    return rval;
+}
+
+void RouterTable::UpdateNextHops(void)
+{
+    // Only allocated Router IDs can have a next hop.
+    for (uint8_t i = 0; i <= Mle::kMaxRouterId; i++)
+    {
+        mNextHops[i] = Mac::kShortAddrInvalid;
+    }
+
+    for (uint8_t i = 0; i < mActiveRouterCount; i++)
+    {
+        uint8_t routerId = mRouters[i].GetRouterId();
+
+        mNextHops[routerId] = ComputeNextHop(routerId);
+    }
+
+    mNextHopsValid = true;
+}
+
+uint16_t RouterTable::ComputeNextHop(uint8_t aRouterId)
+{
+    uint16_t rval = Mac::kShortAddrInvalid;
+    Router * router;
+    Router * nextHop;
+    uint8_t  linkCost;
+
+    router = GetRouter(aRouterId);
+    VerifyOrExit(router != NULL);
+
+    linkCost = GetLinkCost(*router);
+    nextHop  = GetRouter(router->GetNextHop());
+
+    if (nextHop != NULL && (router->GetCost() + GetLinkCost(*nextHop)) < linkCost)
+    {
+        VerifyOrExit(nextHop->GetState() != Neighbor::kStateInvalid);
+        rval = Mle::Mle::GetRloc16(router->GetNextHop());
+    }
+    else if (linkCost < Mle::kMaxRouteCost)
+    {
+        rval = Mle::Mle::GetRloc16(aRouterId);
+    }
+
+exit:
+    return rval;
+}
+
 } // namespace ot
 
 #endif // OPENTHREAD_FTD
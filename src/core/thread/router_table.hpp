@@ -320,15 +320,62 @@ public:
      */
     void ProcessTimerTick(void);
 
+    /**
+     * This method returns the next hop towards a given router.
+     *
+     * The next hop table is recomputed on the first lookup after it has been invalidated.
+     *
+     * @param[in]  aRouterId  The router ID of the destination.
+     *
+     * @returns The RLOC16 of the next hop, or Mac::kShortAddrInvalid if there is no route.
+     *
+     */
+    uint16_t GetNextHop(uint8_t aRouterId);
+
+    /**
+     * This method invalidates the next hop table.
+     *
+     * This method must be called whenever a route, a link cost or a neighbor state changes.
+     *
+     */
+    void InvalidateNextHops(void) { mNextHopsValid = false; }
+
+#if OPENTHREAD_CONFIG_MLE_ADDRESS_SOLICIT_BATCH_WINDOW
+    /**
+     * This method defers the Router ID Sequence update of subsequent allocations until
+     * `CommitRouterIdSequence()` is called, so that a batch of allocations results in a single update.
+     *
+     */
+    void DeferRouterIdSequence(void) { mRouterIdSequenceDeferred = true; }
+
+    /**
+     * This method ends deferring the Router ID Sequence update, and updates it (once) if any router id was allocated
+     * since `DeferRouterIdSequence()` was called.
+     *
+     */
+    void CommitRouterIdSequence(void);
+#endif
+
 private:
-    void UpdateAllocation(void);
+    void     UpdateRouterIdSequence(void);
+    void     UpdateAllocation(void);
+    void     UpdateNextHops(void);
+    uint16_t ComputeNextHop(uint8_t aRouterId);
 
-    Router   mRouters[Mle::kMaxRouters];
+    Router   mRouters[Mle::kMaxRouters]; ///< Allocated routers first, in Router ID order.
     uint8_t  mAllocatedRouterIds[BitVectorBytes(Mle::kMaxRouterId)];
+    uint8_t  mRouterIndex[Mle::kMaxRouterId + 1]; ///< Index in `mRouters` of each Router ID, or `kInvalidRouterId`.
     uint8_t  mRouterIdReuseDelay[Mle::kMaxRouterId + 1];
+    uint16_t mNextHops[Mle::kMaxRouterId + 1];
     uint32_t mRouterIdSequenceLastUpdated;
     uint8_t  mRouterIdSequence;
     uint8_t  mActiveRouterCount;
+    uint8_t  mReuseDelayCount; ///< Number of Router IDs with a non-zero reuse delay.
+    bool     mNextHopsValid;
+#if OPENTHREAD_CONFIG_MLE_ADDRESS_SOLICIT_BATCH_WINDOW
+    bool mRouterIdSequenceDeferred : 1;
+    bool mRouterIdSequenceChanged : 1; ///< Whether an allocation happened while the update was deferred.
+#endif
 };
 
 #endif // OPENTHREAD_FTD
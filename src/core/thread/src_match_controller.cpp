@@ -46,6 +46,9 @@ namespace ot {
 
 SourceMatchController::SourceMatchController(Instance &aInstance)
     : InstanceLocator(aInstance)
+    , mNumClearShort(0)
+    , mNumClearExt(0)
+    , mUpdateTask(aInstance, &SourceMatchController::HandleUpdateTask, this)
     , mEnabled(false)
 {
     ClearTable();
@@ -109,6 +112,8 @@ void SourceMatchController::ClearTable(void)
 {
     otPlatRadioClearSrcMatchShortEntries(&GetInstance());
     otPlatRadioClearSrcMatchExtEntries(&GetInstance());
+    mNumClearShort = 0;
+    mNumClearExt   = 0;
     otLogDebgMac("SrcAddrMatch - Cleared all entries");
 }
 
@@ -122,113 +127,210 @@ void SourceMatchController::Enable(bool aEnable)
 void SourceMatchController::AddEntry(Child &aChild)
 {
     aChild.SetIndirectSourceMatchPending(true);
+    mUpdateTask.Post();
+}
 
-    if (!IsEnabled())
+void SourceMatchController::ClearEntry(Child &aChild)
+{
+    if (aChild.IsIndirectSourceMatchPending())
     {
-        SuccessOrExit(AddPendingEntries());
-        Enable(true);
+        otLogDebgMac("SrcAddrMatch - Clearing pending flag for 0x%04x", aChild.GetRloc16());
+        aChild.SetIndirectSourceMatchPending(false);
+    }
+    else if (aChild.IsIndirectSourceMatchShort())
+    {
+        if (mNumClearShort == kMaxEntries)
+        {
+            HandleUpdateTask();
+        }
+
+        mClearShortList[mNumClearShort++] = aChild.GetRloc16();
     }
     else
     {
-        VerifyOrExit(AddAddress(aChild) == OT_ERROR_NONE, Enable(false));
-        aChild.SetIndirectSourceMatchPending(false);
+        if (mNumClearExt == kMaxEntries)
+        {
+            HandleUpdateTask();
+        }
+
+        GetExtAddress(aChild, mClearExtList[mNumClearExt++]);
     }
 
-exit:
-    return;
+    mUpdateTask.Post();
+}
+
+void SourceMatchController::HandleUpdateTask(Tasklet &aTasklet)
+{
+    aTasklet.GetOwner<SourceMatchController>().HandleUpdateTask();
 }
 
-otError SourceMatchController::AddAddress(const Child &aChild)
+void SourceMatchController::HandleUpdateTask(void)
 {
-    otError error = OT_ERROR_NONE;
+    bool hasPendingEntries = false;
+
+    UpdateShortEntries();
+    UpdateExtEntries();
 
-    if (aChild.IsIndirectSourceMatchShort())
+    for (ChildTable::Iterator iter(GetInstance(), ChildTable::kInStateValidOrRestoring); !iter.IsDone(); iter++)
     {
-        error = otPlatRadioAddSrcMatchShortEntry(&GetInstance(), aChild.GetRloc16());
+        if (iter.GetChild()->IsIndirectSourceMatchPending())
+        {
+            hasPendingEntries = true;
+            break;
+        }
+    }
 
-        otLogDebgMac("SrcAddrMatch - Adding short addr: 0x%04x -- %s (%d)", aChild.GetRloc16(),
-                     otThreadErrorToString(error), error);
+    if (hasPendingEntries == IsEnabled())
+    {
+        Enable(!hasPendingEntries);
     }
-    else
+}
+
+void SourceMatchController::UpdateShortEntries(void)
+{
+    otShortAddress addList[kMaxEntries];
+    uint8_t        numAdd = 0;
+    otError        error;
+
+    for (ChildTable::Iterator iter(GetInstance(), ChildTable::kInStateValidOrRestoring); !iter.IsDone(); iter++)
     {
-        otExtAddress addr;
+        Child &child = *iter.GetChild();
 
-        for (uint8_t i = 0; i < sizeof(addr); i++)
+        if (child.IsIndirectSourceMatchPending() && child.IsIndirectSourceMatchShort())
         {
-            addr.m8[i] = aChild.GetExtAddress().m8[sizeof(addr) - 1 - i];
+            addList[numAdd++] = child.GetRloc16();
         }
+    }
 
-        error = otPlatRadioAddSrcMatchExtEntry(&GetInstance(), &addr);
+    VerifyOrExit(numAdd > 0 || mNumClearShort > 0);
 
-        otLogDebgMac("SrcAddrMatch - Adding addr: %02x:%02x:%02x:%02x:%02x:%02x:%02x:%02x -- %s (%d)", addr.m8[7],
-                     addr.m8[6], addr.m8[5], addr.m8[4], addr.m8[3], addr.m8[2], addr.m8[1], addr.m8[0],
-                     otThreadErrorToString(error), error);
-    }
+    error = otPlatRadioUpdateSrcMatchShortEntries(&GetInstance(), addList, numAdd, mClearShortList, mNumClearShort);
 
-    return error;
-}
+    otLogDebgMac("SrcAddrMatch - Updating short addrs, added:%d, cleared:%d -- %s (%d)", numAdd, mNumClearShort,
+                 otThreadErrorToString(error), error);
 
-void SourceMatchController::ClearEntry(Child &aChild)
-{
-    otError error = OT_ERROR_NONE;
+    mNumClearShort = 0;
+    SuccessOrExit(error);
 
-    if (aChild.IsIndirectSourceMatchPending())
+    for (ChildTable::Iterator iter(GetInstance(), ChildTable::kInStateValidOrRestoring); !iter.IsDone(); iter++)
     {
-        otLogDebgMac("SrcAddrMatch - Clearing pending flag for 0x%04x", aChild.GetRloc16());
-        aChild.SetIndirectSourceMatchPending(false);
-        ExitNow();
+        if (iter.GetChild()->IsIndirectSourceMatchShort())
+        {
+            iter.GetChild()->SetIndirectSourceMatchPending(false);
+        }
     }
 
-    if (aChild.IsIndirectSourceMatchShort())
-    {
-        error = otPlatRadioClearSrcMatchShortEntry(&GetInstance(), aChild.GetRloc16());
+exit:
+    return;
+}
 
-        otLogDebgMac("SrcAddrMatch - Clearing short address: 0x%04x -- %s (%d)", aChild.GetRloc16(),
-                     otThreadErrorToString(error), error);
-    }
-    else
+void SourceMatchController::UpdateExtEntries(void)
+{
+    otExtAddress addList[kMaxEntries];
+    uint8_t      numAdd = 0;
+    otError      error;
+
+    for (ChildTable::Iterator iter(GetInstance(), ChildTable::kInStateValidOrRestoring); !iter.IsDone(); iter++)
     {
-        otExtAddress addr;
+        Child &child = *iter.GetChild();
 
-        for (uint8_t i = 0; i < sizeof(addr); i++)
+        if (child.IsIndirectSourceMatchPending() && !child.IsIndirectSourceMatchShort())
         {
-            addr.m8[i] = aChild.GetExtAddress().m8[sizeof(aChild.GetExtAddress()) - 1 - i];
+            GetExtAddress(child, addList[numAdd++]);
         }
+    }
 
-        error = otPlatRadioClearSrcMatchExtEntry(&GetInstance(), &addr);
+    VerifyOrExit(numAdd > 0 || mNumClearExt > 0);
 
-        otLogDebgMac("SrcAddrMatch - Clearing addr: %02x:%02x:%02x:%02x:%02x:%02x:%02x:%02x -- %s (%d)", addr.m8[7],
-                     addr.m8[6], addr.m8[5], addr.m8[4], addr.m8[3], addr.m8[2], addr.m8[1], addr.m8[0],
-                     otThreadErrorToString(error), error);
-    }
+    error = otPlatRadioUpdateSrcMatchExtEntries(&GetInstance(), addList, numAdd, mClearExtList, mNumClearExt);
+
+    otLogDebgMac("SrcAddrMatch - Updating ext addrs, added:%d, cleared:%d -- %s (%d)", numAdd, mNumClearExt,
+                 otThreadErrorToString(error), error);
 
+    mNumClearExt = 0;
     SuccessOrExit(error);
 
-    if (!IsEnabled())
+    for (ChildTable::Iterator iter(GetInstance(), ChildTable::kInStateValidOrRestoring); !iter.IsDone(); iter++)
     {
-        SuccessOrExit(AddPendingEntries());
-        Enable(true);
+        if (!iter.GetChild()->IsIndirectSourceMatchShort())
+        {
+            iter.GetChild()->SetIndirectSourceMatchPending(false);
+        }
     }
 
 exit:
     return;
 }
 
-otError SourceMatchController::AddPendingEntries(void)
+void SourceMatchController::GetExtAddress(const Child &aChild, otExtAddress &aAddress)
 {
-    otError error = OT_ERROR_NONE;
+    // The radio source match table stores extended addresses in little-endian byte order.
+    for (uint8_t i = 0; i < sizeof(aAddress); i++)
+    {
+        aAddress.m8[i] = aChild.GetExtAddress().m8[sizeof(aAddress) - 1 - i];
+    }
+}
 
-    for (ChildTable::Iterator iter(GetInstance(), ChildTable::kInStateValidOrRestoring); !iter.IsDone(); iter++)
+} // namespace ot
+
+OT_TOOL_WEAK otError otPlatRadioUpdateSrcMatchShortEntries(otInstance *          aInstance,
+                                                           const otShortAddress *aAddList,
+                                                           uint8_t               aNumAdd,
+                                                           const otShortAddress *aClearList,
+                                                           uint8_t               aNumClear)
+{
+    otError error    = OT_ERROR_NONE;
+    uint8_t numAdded = 0;
+
+    for (uint8_t i = 0; i < aNumClear; i++)
     {
-        if (iter.GetChild()->IsIndirectSourceMatchPending())
+        otPlatRadioClearSrcMatchShortEntry(aInstance, aClearList[i]);
+    }
+
+    for (; numAdded < aNumAdd; numAdded++)
+    {
+        SuccessOrExit(error = otPlatRadioAddSrcMatchShortEntry(aInstance, aAddList[numAdded]));
+    }
+
+exit:
+    if (error != OT_ERROR_NONE)
+    {
+        while (numAdded > 0)
         {
-            SuccessOrExit(error = AddAddress(*iter.GetChild()));
-            iter.GetChild()->SetIndirectSourceMatchPending(false);
+            otPlatRadioClearSrcMatchShortEntry(aInstance, aAddList[--numAdded]);
         }
     }
 
-exit:
     return error;
 }
 
-} // namespace ot
+OT_TOOL_WEAK otError otPlatRadioUpdateSrcMatchExtEntries(otInstance *        aInstance,
+                                                         const otExtAddress *aAddList,
+                                                         uint8_t             aNumAdd,
+                                                         const otExtAddress *aClearList,
+                                                         uint8_t             aNumClear)
+{
+    otError error    = OT_ERROR_NONE;
+    uint8_t numAdded = 0;
+
+    for (uint8_t i = 0; i < aNumClear; i++)
+    {
+        otPlatRadioClearSrcMatchExtEntry(aInstance, &aClearList[i]);
+    }
+
+    for (; numAdded < aNumAdd; numAdded++)
+    {
+        SuccessOrExit(error = otPlatRadioAddSrcMatchExtEntry(aInstance, &aAddList[numAdded]));
+    }
+
+exit:
+    if (error != OT_ERROR_NONE)
+    {
+        while (numAdded > 0)
+        {
+            otPlatRadioClearSrcMatchExtEntry(aInstance, &aAddList[--numAdded]);
+        }
+    }
+
+    return error;
+}
@@ -37,6 +37,7 @@
 #include "openthread-core-config.h"
 
 #include "common/locator.hpp"
+#include "common/tasklet.hpp"
 #include "thread/topology.hpp"
 
 namespace ot {
@@ -136,12 +137,10 @@ private:
     void Enable(bool aEnable);
 
     /**
-     * This method adds an entry to source match table for a given child and updates the state of source matching
-     * feature accordingly.
+     * This method marks a given child to be added to the source match table.
      *
-     * If the entry is added successfully, source matching feature is enabled (if not already enabled) after ensuring
-     * that there are no remaining pending entries. If the entry cannot be added (no space in source match table),
-     * the child is marked to remember the pending entry and source matching is disabled.
+     * The radio is updated from a tasklet, so that all the changes made while processing one event reach the radio
+     * in a single batch (@sa HandleUpdateTask).
      *
      * @param[in] aChild    A reference to the child.
      *
@@ -149,11 +148,11 @@ private:
     void AddEntry(Child &aChild);
 
     /**
-     * This method clears an entry in source match table for a given child and updates the state of source matching
-     * feature accordingly.
+     * This method marks the entry of a given child to be removed from the source match table.
      *
-     * If the entry is removed successfully and frees up space in the source match table, any remaining pending
-     * entries are added. If all pending entries are successfully added, source matching is enabled.
+     * If the child's entry was not yet added to the table, the pending addition is dropped. Otherwise, the child's
+     * current address is remembered, so that the right entry is removed even if the child changes before the batch
+     * is sent to the radio.
      *
      * @param[in] aChild    A reference to the child.
      *
@@ -161,27 +160,33 @@ private:
     void ClearEntry(Child &aChild);
 
     /**
-     * This method adds a given child's address (short or extended address depending on child's setting) to the source
-     * source match table (@sa SetSrcMatchAsShort.
+     * This method sends all the pending source match table changes to the radio and updates the state of source
+     * matching feature accordingly.
      *
-     * @param[in] aChild            A reference to the child
-     *
-     * @retval OT_ERROR_NONE     Child's address was added successfully to the source match table.
-     * @retval OT_ERROR_NO_BUFS  No available space in the source match table.
+     * Entries are removed before pending entries are added. Source matching is enabled only once all pending entries
+     * are in the table. If pending entries cannot be added (no space in source match table), the children are kept
+     * marked as pending and source matching is disabled until a later update succeeds.
      *
      */
-    otError AddAddress(const Child &aChild);
+    static void HandleUpdateTask(Tasklet &aTasklet);
+    void        HandleUpdateTask(void);
 
-    /**
-     * This method adds all pending entries to the source match table.
-     *
-     * @retval OT_ERROR_NONE     All pending entries were successfully added.
-     * @retval OT_ERROR_NO_BUFS  No available space in the source match table.
-     *
-     */
-    otError AddPendingEntries(void);
+    void UpdateShortEntries(void);
+    void UpdateExtEntries(void);
+
+    static void GetExtAddress(const Child &aChild, otExtAddress &aAddress);
+
+    enum
+    {
+        kMaxEntries = OPENTHREAD_CONFIG_MAX_CHILDREN,
+    };
 
-    bool mEnabled;
+    otShortAddress mClearShortList[kMaxEntries];
+    otExtAddress   mClearExtList[kMaxEntries];
+    uint8_t        mNumClearShort;
+    uint8_t        mNumClearExt;
+    Tasklet        mUpdateTask;
+    bool           mEnabled;
 };
 
 /**
@@ -117,7 +117,7 @@ otError ThreadNetif::Up(void)
 
     // Enable the MAC just in case it was disabled while the Interface was down.
     mMac.SetEnabled(true);
-#if OPENTHREAD_ENABLE_CHANNEL_MONITOR
+#if OPENTHREAD_ENABLE_CHANNEL_MONITOR && !OPENTHREAD_CONFIG_CHANNEL_MONITOR_START_ON_ATTACH
     GetInstance().GetChannelMonitor().Start();
 #endif
     mMeshForwarder.Start();
@@ -39,6 +39,7 @@
 
 #include <openthread/platform/alarm-micro.h>
 #include <openthread/platform/alarm-milli.h>
+#include <openthread/platform/radio.h>
 #include <openthread/platform/time.h>
 
 #include "common/instance.hpp"
@@ -62,9 +63,14 @@ TimeSync::TimeSync(Instance &aInstance)
     , mNetworkTimeOffset(0)
     , mTimeSyncCallback(NULL)
     , mTimeSyncCallbackContext(NULL)
-    , mNotifierCallback(&TimeSync::HandleStateChanged, this)
+    , mNotifierCallback(&TimeSync::HandleStateChanged, this, OT_CHANGED_THREAD_ROLE)
     , mTimer(aInstance, HandleTimeout, this)
     , mCurrentStatus(OT_NETWORK_TIME_UNSYNCHRONIZED)
+#if OPENTHREAD_CONFIG_TIME_SYNC_DRIFT_COMPENSATION
+    , mLastSyncLocalTime(0)
+    , mDrift(0)
+    , mDriftSampled(false)
+#endif
 {
     aInstance.GetNotifier().RegisterCallback(mNotifierCallback);
 
@@ -73,11 +79,62 @@ TimeSync::TimeSync(Instance &aInstance)
 
 otNetworkTimeStatus TimeSync::GetTime(uint64_t &aNetworkTime) const
 {
-    aNetworkTime = static_cast<uint64_t>(static_cast<int64_t>(otPlatTimeGet()) + mNetworkTimeOffset);
+    aNetworkTime = static_cast<uint64_t>(static_cast<int64_t>(otPlatTimeGet()) + GetNetworkTimeOffset());
 
     return mCurrentStatus;
 }
 
+#if OPENTHREAD_CONFIG_TIME_SYNC_DRIFT_COMPENSATION
+int64_t TimeSync::GetNetworkTimeOffset(void) const
+{
+    int64_t elapsed = static_cast<int64_t>(otPlatTimeGet() - mLastSyncLocalTime);
+
+    return mNetworkTimeOffset + (elapsed / 1000) * mDrift / 1000000;
+}
+
+void TimeSync::UpdateDrift(uint64_t aLocalTime, int64_t aNetworkTimeOffset)
+{
+    const int64_t maxDrift = (static_cast<int64_t>(otPlatTimeGetXtalAccuracy()) + mXtalThreshold) * 1000;
+    int64_t       elapsed  = static_cast<int64_t>(aLocalTime - mLastSyncLocalTime);
+    int64_t       delta    = aNetworkTimeOffset - mNetworkTimeOffset;
+    int64_t       drift;
+
+    // software timestamps carry interrupt latency jitter which would dominate the estimate
+    VerifyOrExit(otPlatRadioGetCaps(&GetInstance()) & OT_RADIO_CAPS_SFD_TIMESTAMP, ResetDrift());
+    VerifyOrExit(mDriftSampled && elapsed >= kMinDriftInterval);
+
+    // an offset change no crystal could explain is a jump of the network time (e.g. a new leader), not drift
+    VerifyOrExit(ABS(delta) <= elapsed / 8, ResetDrift());
+
+    drift = delta * 1000000 / (elapsed / 1000);
+    VerifyOrExit(ABS(drift) <= maxDrift, ResetDrift());
+
+    if (mDrift == 0)
+    {
+        mDrift = static_cast<int32_t>(drift);
+    }
+    else
+    {
+        mDrift += static_cast<int32_t>((drift - mDrift) / (1 << kDriftWeightShift));
+    }
+
+    otLogInfoCore("Time sync drift %d ppb", mDrift);
+
+exit:
+    mLastSyncLocalTime = aLocalTime;
+    mDriftSampled      = true;
+}
+
+void TimeSync::ResetDrift(void)
+{
+    // fold the compensation applied so far into the offset so that the network time does not jump
+    mNetworkTimeOffset = GetNetworkTimeOffset();
+    mLastSyncLocalTime = otPlatTimeGet();
+    mDrift             = 0;
+    mDriftSampled      = false;
+}
+#endif // OPENTHREAD_CONFIG_TIME_SYNC_DRIFT_COMPENSATION
+
 void TimeSync::HandleTimeSyncMessage(const Message &aMessage)
 {
     const int64_t origNetworkTimeOffset = mNetworkTimeOffset;
@@ -99,6 +156,9 @@ void TimeSync::HandleTimeSyncMessage(const Message &aMessage)
             GetInstance().GetThreadNetif().GetMle().GetRole() == OT_DEVICE_ROLE_DETACHED)
         {
             // update network time and forward it.
+#if OPENTHREAD_CONFIG_TIME_SYNC_DRIFT_COMPENSATION
+            UpdateDrift(otPlatTimeGet(), aMessage.GetNetworkTimeOffset());
+#endif
             mLastTimeSyncReceived = TimerMilli::GetNow();
             mTimeSyncSeq          = aMessage.GetTimeSyncSeq();
             mNetworkTimeOffset    = aMessage.GetNetworkTimeOffset();
@@ -158,6 +218,16 @@ void TimeSync::HandleStateChanged(otChangedFlags aFlags)
 {
     if ((aFlags & OT_CHANGED_THREAD_ROLE) != 0)
     {
+#if OPENTHREAD_CONFIG_TIME_SYNC_DRIFT_COMPENSATION
+        otDeviceRole role = GetInstance().GetThreadNetif().GetMle().GetRole();
+
+        // only children and routers follow the network time of their parent
+        if (role != OT_DEVICE_ROLE_CHILD && role != OT_DEVICE_ROLE_ROUTER)
+        {
+            ResetDrift();
+        }
+#endif
+
         CheckAndHandleChanges(false);
     }
 }
@@ -101,10 +101,27 @@ public:
     /**
      * This method gets the time offset to the Thread network time.
      *
+     * When `OPENTHREAD_CONFIG_TIME_SYNC_DRIFT_COMPENSATION` is enabled, the offset includes the estimated drift of the
+     * local clock since the last time synchronization.
+     *
      * @returns The time offset to the Thread network time, in microseconds.
      *
      */
+#if OPENTHREAD_CONFIG_TIME_SYNC_DRIFT_COMPENSATION
+    int64_t GetNetworkTimeOffset(void) const;
+#else
     int64_t GetNetworkTimeOffset(void) const { return mNetworkTimeOffset; };
+#endif
+
+#if OPENTHREAD_CONFIG_TIME_SYNC_DRIFT_COMPENSATION
+    /**
+     * This method gets the estimated drift of the Thread network time against the local clock.
+     *
+     * @returns The estimated drift in parts per billion, or zero if no estimate is available.
+     *
+     */
+    int32_t GetDrift(void) const { return mDrift; }
+#endif
 
     /**
      * Set the time synchronization period.
@@ -166,6 +183,14 @@ public:
     void HandleTimeout(void);
 
 private:
+#if OPENTHREAD_CONFIG_TIME_SYNC_DRIFT_COMPENSATION
+    enum
+    {
+        kMinDriftInterval = 1000000, ///< Minimum interval between drift samples, in microseconds.
+        kDriftWeightShift = 2,       ///< Weight of a new drift sample in the moving average (1/4).
+    };
+#endif
+
     /**
      * Callback to be called when thread state changes.
      *
@@ -204,6 +229,23 @@ private:
      */
     void NotifyTimeSyncCallback(void);
 
+#if OPENTHREAD_CONFIG_TIME_SYNC_DRIFT_COMPENSATION
+    /**
+     * Update the drift estimate from a new network time offset, before it replaces the current one.
+     *
+     * @param[in] aLocalTime          The local time at which the new offset was received, in microseconds.
+     * @param[in] aNetworkTimeOffset  The new offset to the Thread network time, in microseconds.
+     *
+     */
+    void UpdateDrift(uint64_t aLocalTime, int64_t aNetworkTimeOffset);
+
+    /**
+     * Discard the drift estimate, keeping the compensation applied so far.
+     *
+     */
+    void ResetDrift(void);
+#endif
+
     bool     mTimeSyncRequired; ///< Indicate whether or not a time synchronization message is required.
     uint8_t  mTimeSyncSeq;      ///< The time synchronization sequence.
     uint16_t mTimeSyncPeriod;   ///< The time synchronization period.
@@ -219,6 +261,11 @@ private:
     Notifier::Callback  mNotifierCallback;        ///< Callback for thread state changes.
     TimerMilli          mTimer;                   ///< Timer for checking if a resync is required.
     otNetworkTimeStatus mCurrentStatus;           ///< Current network time status.
+#if OPENTHREAD_CONFIG_TIME_SYNC_DRIFT_COMPENSATION
+    uint64_t mLastSyncLocalTime; ///< The local time (in microseconds) when the network time offset was last updated.
+    int32_t  mDrift;             ///< The estimated drift of network time against local time, in ppb (0 if unknown).
+    bool     mDriftSampled;      ///< Indicates whether `mLastSyncLocalTime` holds a drift sample.
+#endif
 };
 
 /**
@@ -70,10 +70,17 @@ bool Child::IsStateValidOrAttaching(void) const
     return rval;
 }
 
-void Child::ClearIp6Addresses(void)
+void Child::ClearIp6Addresses(Instance &aInstance)
 {
     memset(mMeshLocalIid, 0, sizeof(mMeshLocalIid));
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_CHILD_ADDRESS_POOL_SIZE
+    ChildTable &childTable = aInstance.Get<ChildTable>();
+
+    childTable.ClearChildAddresses(childTable.GetChildIndex(*this));
+#else
+    OT_UNUSED_VARIABLE(aInstance);
     memset(mIp6Address, 0, sizeof(mIp6Address));
+#endif
 }
 
 /**
@@ -128,11 +135,21 @@ otError Child::GetNextIp6Address(Instance &aInstance, Ip6AddressIterator &aItera
 
     index = aIterator.Get() - 1;
 
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_CHILD_ADDRESS_POOL_SIZE
+    {
+        ChildTable &childTable = aInstance.Get<ChildTable>();
+
+        // The iterator tracks the position in the shared address pool.
+        SuccessOrExit(error = childTable.GetNextChildAddress(childTable.GetChildIndex(*this), index, aAddress));
+        aIterator.Set(index + 1);
+    }
+#else
     VerifyOrExit(index < kNumIp6Addresses, error = OT_ERROR_NOT_FOUND);
 
     VerifyOrExit(!mIp6Address[index].IsUnspecified(), error = OT_ERROR_NOT_FOUND);
     aAddress = mIp6Address[index];
     aIterator.Increment();
+#endif
 
 exit:
     return error;
@@ -151,6 +168,13 @@ otError Child::AddIp6Address(Instance &aInstance, const Ip6::Address &aAddress)
         ExitNow();
     }
 
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_CHILD_ADDRESS_POOL_SIZE
+    {
+        ChildTable &childTable = aInstance.Get<ChildTable>();
+
+        error = childTable.AddChildAddress(childTable.GetChildIndex(*this), aAddress);
+    }
+#else
     for (uint16_t index = 0; index < kNumIp6Addresses; index++)
     {
         if (mIp6Address[index].IsUnspecified())
@@ -163,6 +187,7 @@ otError Child::AddIp6Address(Instance &aInstance, const Ip6::Address &aAddress)
     }
 
     error = OT_ERROR_NO_BUFS;
+#endif
 
 exit:
     return error;
@@ -170,8 +195,7 @@ exit:
 
 otError Child::RemoveIp6Address(Instance &aInstance, const Ip6::Address &aAddress)
 {
-    otError  error = OT_ERROR_NOT_FOUND;
-    uint16_t index;
+    otError error = OT_ERROR_NOT_FOUND;
 
     VerifyOrExit(!aAddress.IsUnspecified(), error = OT_ERROR_INVALID_ARGS);
 
@@ -186,6 +210,15 @@ otError Child::RemoveIp6Address(Instance &aInstance, const Ip6::Address &aAddres
         ExitNow();
     }
 
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_CHILD_ADDRESS_POOL_SIZE
+    {
+        ChildTable &childTable = aInstance.Get<ChildTable>();
+
+        error = childTable.RemoveChildAddress(childTable.GetChildIndex(*this), aAddress);
+    }
+#else
+    uint16_t index;
+
     for (index = 0; index < kNumIp6Addresses; index++)
     {
         VerifyOrExit(!mIp6Address[index].IsUnspecified());
@@ -205,6 +238,7 @@ otError Child::RemoveIp6Address(Instance &aInstance, const Ip6::Address &aAddres
     }
 
     mIp6Address[kNumIp6Addresses - 1].Clear();
+#endif
 
 exit:
     return error;
@@ -222,6 +256,13 @@ bool Child::HasIp6Address(Instance &aInstance, const Ip6::Address &aAddress) con
         ExitNow();
     }
 
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_CHILD_ADDRESS_POOL_SIZE
+    {
+        const ChildTable &childTable = aInstance.Get<ChildTable>();
+
+        retval = childTable.HasChildAddress(childTable.GetChildIndex(*this), aAddress);
+    }
+#else
     for (uint16_t index = 0; index < kNumIp6Addresses; index++)
     {
         VerifyOrExit(!mIp6Address[index].IsUnspecified());
@@ -231,6 +272,7 @@ bool Child::HasIp6Address(Instance &aInstance, const Ip6::Address &aAddress) con
             ExitNow(retval = true);
         }
     }
+#endif
 
 exit:
     return retval;
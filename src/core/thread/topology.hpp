@@ -462,8 +462,10 @@ public:
     /**
      * This method clears the IPv6 address list for the child.
      *
+     * @param[in]  aInstance  A reference to the OpenThread instance.
+     *
      */
-    void ClearIp6Addresses(void);
+    void ClearIp6Addresses(Instance &aInstance);
 
     /**
      * This method gets the mesh-local IPv6 address.
@@ -615,6 +617,22 @@ public:
      */
     void SetIndirectMessage(Message *aMessage) { mIndirectMessage = aMessage; }
 
+    /**
+     * This method gets the first message in the send queue that is pending indirect transmission to the child.
+     *
+     * @returns A pointer to the first pending message, or NULL if there is none or it needs to be searched for.
+     *
+     */
+    Message *GetFirstIndirectMessage(void) { return mFirstIndirectMessage; }
+
+    /**
+     * This method sets the first message in the send queue that is pending indirect transmission to the child.
+     *
+     * @param[in]  aMessage  A pointer to the first pending message, or NULL.
+     *
+     */
+    void SetFirstIndirectMessage(Message *aMessage) { mFirstIndirectMessage = aMessage; }
+
     /**
      * This method gets the 6LoWPAN Fragment Offset to use for indirect transmissions.
      *
@@ -731,6 +749,24 @@ public:
      */
     void SetIndirectSourceMatchPending(bool aPending) { mSourceMatchPending = aPending; }
 
+#if OPENTHREAD_CONFIG_MLE_NETWORK_DATA_DELTA
+    /**
+     * This method indicates whether or not the child accepts Network Data Delta TLVs.
+     *
+     * @returns TRUE if the child accepts Network Data Delta TLVs, FALSE otherwise.
+     *
+     */
+    bool IsNetworkDataDeltaCapable(void) const { return mNetworkDataDelta; }
+
+    /**
+     * This method sets whether or not the child accepts Network Data Delta TLVs.
+     *
+     * @param[in]  aCapable  TRUE if the child accepts Network Data Delta TLVs, FALSE otherwise.
+     *
+     */
+    void SetNetworkDataDeltaCapable(bool aCapable) { mNetworkDataDelta = aCapable; }
+#endif
+
     /**
      * This method returns the number of queued message(s) for the child
      *
@@ -757,6 +793,58 @@ public:
      */
     void ResetIndirectMessageCount(void) { mQueuedMessageCount = 0; }
 
+#if OPENTHREAD_CONFIG_ENABLE_CHILD_INDIRECT_LIMITS
+    /**
+     * This method returns the number of queued indirect messages counted against the child's limits.
+     *
+     * @returns The number of limited indirect messages.
+     *
+     */
+    uint16_t GetIndirectLimitedMessageCount(void) const { return mIndirectLimitedMessageCount; }
+
+    /**
+     * This method returns the total length of the queued indirect messages counted against the child's limits.
+     *
+     * @returns The number of bytes of limited indirect messages.
+     *
+     */
+    uint16_t GetIndirectLimitedByteCount(void) const { return mIndirectLimitedByteCount; }
+
+    /**
+     * This method counts a queued indirect message against the child's limits.
+     *
+     * @param[in]  aLength  The message length in bytes.
+     *
+     */
+    void AddIndirectLimitedMessage(uint16_t aLength)
+    {
+        mIndirectLimitedMessageCount++;
+        mIndirectLimitedByteCount += aLength;
+    }
+
+    /**
+     * This method removes an indirect message from the child's limit accounting.
+     *
+     * @param[in]  aLength  The message length in bytes.
+     *
+     */
+    void RemoveIndirectLimitedMessage(uint16_t aLength)
+    {
+        mIndirectLimitedMessageCount--;
+        mIndirectLimitedByteCount -= aLength;
+    }
+
+    /**
+     * This method resets the child's indirect limit accounting.
+     *
+     */
+    void ResetIndirectLimitedMessages(void)
+    {
+        mIndirectLimitedMessageCount = 0;
+        mIndirectLimitedByteCount    = 0;
+    }
+#endif
+
     /**
      * This method clears the requested TLV list.
      *
@@ -817,6 +905,42 @@ public:
 
 #endif // #if OPENTHREAD_ENABLE_CHILD_SUPERVISION
 
+#if OPENTHREAD_CONFIG_ENABLE_CSL
+
+    /**
+     * This method returns the CSL period of the child.
+     *
+     * @returns The CSL period in milliseconds, or zero if the child does not use CSL receive mode.
+     *
+     */
+    uint16_t GetCslPeriod(void) const { return mCslPeriod; }
+
+    /**
+     * This method sets the CSL period of the child.
+     *
+     * @param[in]  aPeriod  The CSL period in milliseconds.
+     *
+     */
+    void SetCslPeriod(uint16_t aPeriod) { mCslPeriod = aPeriod; }
+
+    /**
+     * This method returns the time of the last data poll received from the child, used as CSL synchronization point.
+     *
+     * @returns The time (in milliseconds) of the last CSL synchronization.
+     *
+     */
+    uint32_t GetCslLastSync(void) const { return mCslLastSync; }
+
+    /**
+     * This method sets the time of the last CSL synchronization (data poll) with the child.
+     *
+     * @param[in]  aTime  The time (in milliseconds) of the synchronization.
+     *
+     */
+    void SetCslLastSync(uint32_t aTime) { mCslLastSync = aTime; }
+
+#endif // OPENTHREAD_CONFIG_ENABLE_CSL
+
 private:
 #if OPENTHREAD_CONFIG_IP_ADDRS_PER_CHILD < 2
 #error OPENTHREAD_CONFIG_IP_ADDRS_PER_CHILD should be at least set to 2.
@@ -827,8 +951,10 @@ private:
         kNumIp6Addresses = OPENTHREAD_CONFIG_IP_ADDRS_PER_CHILD - 1,
     };
 
-    uint8_t      mMeshLocalIid[Ip6::Address::kInterfaceIdentifierSize]; ///< IPv6 address IID for mesh-local address
-    Ip6::Address mIp6Address[kNumIp6Addresses];                         ///< Registered IPv6 addresses
+    uint8_t mMeshLocalIid[Ip6::Address::kInterfaceIdentifierSize]; ///< IPv6 address IID for mesh-local address
+#if !(OPENTHREAD_FTD && OPENTHREAD_CONFIG_CHILD_ADDRESS_POOL_SIZE)
+    Ip6::Address mIp6Address[kNumIp6Addresses]; ///< Registered IPv6 addresses (otherwise kept in the `ChildTable`)
+#endif
 
     uint32_t mTimeout; ///< Child timeout
 
@@ -840,6 +966,7 @@ private:
 
     uint32_t mIndirectFrameCounter;        ///< Frame counter for current indirect message (used fore retx).
     Message *mIndirectMessage;             ///< Current indirect message.
+    Message *mFirstIndirectMessage;        ///< First queued indirect message for the child (in send queue order).
     uint16_t mIndirectFragmentOffset : 15; ///< 6LoWPAN fragment offset for the indirect message.
     bool     mIndirectTxSuccess : 1;       ///< Indicates tx success/failure of current indirect message.
     uint8_t  mIndirectKeyId;               ///< Key Id for current indirect message (used for retx).
@@ -849,10 +976,23 @@ private:
     uint16_t mQueuedMessageCount : 13;     ///< Number of queued indirect messages for the child.
     bool     mUseShortAddress : 1;         ///< Indicates whether to use short or extended address.
     bool     mSourceMatchPending : 1;      ///< Indicates whether or not pending to add to src match table.
+#if OPENTHREAD_CONFIG_MLE_NETWORK_DATA_DELTA
+    bool     mNetworkDataDelta : 1;        ///< Indicates whether or not the child accepts Network Data Delta TLVs.
+#endif
 
 #if OPENTHREAD_ENABLE_CHILD_SUPERVISION
     uint16_t mSecondsSinceSupervision; ///< Number of seconds since last supervision of the child.
 #endif                                 // OPENTHREAD_ENABLE_CHILD_SUPERVISION
+
+#if OPENTHREAD_CONFIG_ENABLE_CSL
+    uint32_t mCslLastSync; ///< Time of the last CSL synchronization (data poll) with the child.
+    uint16_t mCslPeriod;   ///< CSL period of the child (milliseconds), zero if not used.
+#endif
+
+#if OPENTHREAD_CONFIG_ENABLE_CHILD_INDIRECT_LIMITS
+    uint16_t mIndirectLimitedMessageCount; ///< Number of queued indirect messages counted against the limits.
+    uint16_t mIndirectLimitedByteCount;    ///< Total length of queued indirect messages counted against the limits.
+#endif
 };
 
 /**
@@ -910,9 +1050,26 @@ public:
      */
     void SetCost(uint8_t aCost) { mCost = aCost; }
 
+    /**
+     * This method gets the digest of the Route TLV and router table state after the last route update from this router.
+     *
+     * @returns The route digest.
+     *
+     */
+    uint32_t GetRouteDigest(void) const { return mRouteDigest; }
+
+    /**
+     * This method sets the digest of the Route TLV and router table state after the last route update from this router.
+     *
+     * @param[in]  aDigest  The route digest.
+     *
+     */
+    void SetRouteDigest(uint32_t aDigest) { mRouteDigest = aDigest; }
+
 private:
-    uint8_t mNextHop;            ///< The next hop towards this router
-    uint8_t mLinkQualityOut : 2; ///< The link quality out for this router
+    uint32_t mRouteDigest;        ///< The digest of the last route update from this router
+    uint8_t  mNextHop;            ///< The next hop towards this router
+    uint8_t  mLinkQualityOut : 2; ///< The link quality out for this router
 
 #if OPENTHREAD_CONFIG_ENABLE_LONG_ROUTES
     uint8_t mCost; ///< The cost to this router via neighbor router
@@ -44,6 +44,10 @@
 
 #if OPENTHREAD_ENABLE_CHANNEL_MANAGER && OPENTHREAD_FTD
 
+#if OPENTHREAD_CONFIG_CHANNEL_MANAGER_HISTORY_SLOTS > 32
+#error "OPENTHREAD_CONFIG_CHANNEL_MANAGER_HISTORY_SLOTS must not be larger than 32"
+#endif
+
 namespace ot {
 namespace Utils {
 
@@ -52,14 +56,25 @@ ChannelManager::ChannelManager(Instance &aInstance)
     , mSupportedChannelMask(0)
     , mFavoredChannelMask(0)
     , mActiveTimestamp(0)
-    , mNotifierCallback(&ChannelManager::HandleStateChanged, this)
+    , mNotifierCallback(&ChannelManager::HandleStateChanged, this, OT_CHANGED_THREAD_CHANNEL)
     , mDelay(kMinimumDelay)
     , mChannel(0)
     , mState(kStateIdle)
     , mTimer(aInstance, &ChannelManager::HandleTimer, this)
     , mAutoSelectInterval(kDefaultAutoSelectInterval)
     , mAutoSelectEnabled(false)
+    , mCandidateChannel(0)
+    , mCandidateCount(0)
+#if OPENTHREAD_ENABLE_CHANNEL_MONITOR && OPENTHREAD_CONFIG_CHANNEL_MANAGER_HISTORY_SLOTS
+    , mHistoryValidSlots(0)
+    , mHistorySlot(0)
+    , mHistoryTimer(aInstance, &ChannelManager::HandleHistoryTimer, this)
+#endif
 {
+#if OPENTHREAD_ENABLE_CHANNEL_MONITOR && OPENTHREAD_CONFIG_CHANNEL_MANAGER_HISTORY_SLOTS
+    memset(mHistory, 0, sizeof(mHistory));
+#endif
+
     aInstance.GetNotifier().RegisterCallback(mNotifierCallback);
 }
 
@@ -315,6 +330,7 @@ otError ChannelManager::FindBetterChannel(uint8_t &aNewChannel, uint16_t &aOccup
 {
     otError          error   = OT_ERROR_NONE;
     ChannelMonitor & monitor = GetInstance().GetChannelMonitor();
+    Mac::ChannelMask supported;
     Mac::ChannelMask favoredAndSupported;
     Mac::ChannelMask favoredBest;
     Mac::ChannelMask supportedBest;
@@ -328,11 +344,18 @@ otError ChannelManager::FindBetterChannel(uint8_t &aNewChannel, uint16_t &aOccup
         ExitNow(error = OT_ERROR_INVALID_STATE);
     }
 
+    supported = mSupportedChannelMask;
+
+#if OPENTHREAD_ENABLE_JAM_DETECTION
+    // Channels the jam detector considers jammed are never selected.
+    supported.SetMask(supported.GetMask() & ~GetInstance().Get<JamDetector>().GetJammedChannelMask());
+#endif
+
     favoredAndSupported = mFavoredChannelMask;
-    favoredAndSupported.Intersect(mSupportedChannelMask);
+    favoredAndSupported.Intersect(supported);
 
-    favoredBest   = monitor.FindBestChannels(favoredAndSupported, favoredOccupancy);
-    supportedBest = monitor.FindBestChannels(mSupportedChannelMask, supportedOccupancy);
+    favoredBest   = FindBestChannels(favoredAndSupported, favoredOccupancy);
+    supportedBest = FindBestChannels(supported, supportedOccupancy);
 
     otLogInfoUtil("ChannelManager: Best favored %s, occupancy 0x%04x", favoredBest.ToString().AsCString(),
                   favoredOccupancy);
@@ -375,6 +398,101 @@ bool ChannelManager::ShouldAttamptChannelChange(void)
     return shouldAttempt;
 }
 
+Mac::ChannelMask ChannelManager::FindBestChannels(const Mac::ChannelMask &aMask, uint16_t &aOccupancy) const
+{
+    uint8_t          channel      = Mac::ChannelMask::kChannelIteratorFirst;
+    uint16_t         minOccupancy = 0xffff;
+    Mac::ChannelMask bestMask;
+
+    bestMask.Clear();
+
+    while (aMask.GetNextChannel(channel) == OT_ERROR_NONE)
+    {
+        uint16_t occupancy = GetChannelScore(channel);
+
+        if (bestMask.IsEmpty() || (occupancy <= minOccupancy))
+        {
+            if (occupancy < minOccupancy)
+            {
+                bestMask.Clear();
+            }
+
+            bestMask.AddChannel(channel);
+            minOccupancy = occupancy;
+        }
+    }
+
+    aOccupancy = minOccupancy;
+
+    return bestMask;
+}
+
+uint16_t ChannelManager::GetChannelScore(uint8_t aChannel) const
+{
+    ChannelMonitor &monitor = GetInstance().GetChannelMonitor();
+    uint16_t        score   = monitor.GetPeakChannelOccupancy(aChannel);
+
+#if OPENTHREAD_CONFIG_CHANNEL_MANAGER_HISTORY_SLOTS
+    // Project the occupancy over the current time slot from the
+    // current occupancy and the one seen in this slot on previous days.
+    if ((mHistoryValidSlots & (1UL << mHistorySlot)) && (OT_RADIO_CHANNEL_MIN <= aChannel) &&
+        (aChannel <= OT_RADIO_CHANNEL_MAX))
+    {
+        uint16_t history = static_cast<uint16_t>(mHistory[mHistorySlot][aChannel - OT_RADIO_CHANNEL_MIN]) * 0x101;
+
+        score = static_cast<uint16_t>((static_cast<uint32_t>(score) + history) / 2);
+    }
+#endif
+
+    return score;
+}
+
+bool ChannelManager::IsChannelSelectionConfirmed(uint8_t aChannel)
+{
+    if (aChannel != mCandidateChannel)
+    {
+        mCandidateChannel = aChannel;
+        mCandidateCount   = 0;
+    }
+
+    if (mCandidateCount < kConfirmationCount)
+    {
+        mCandidateCount++;
+    }
+
+    return (mCandidateCount >= kConfirmationCount);
+}
+
+#if OPENTHREAD_CONFIG_CHANNEL_MANAGER_HISTORY_SLOTS
+void ChannelManager::HandleHistoryTimer(Timer &aTimer)
+{
+    aTimer.GetOwner<ChannelManager>().HandleHistoryTimer();
+}
+
+void ChannelManager::HandleHistoryTimer(void)
+{
+    ChannelMonitor &monitor = GetInstance().GetChannelMonitor();
+    bool            isValid = (mHistoryValidSlots & (1UL << mHistorySlot)) != 0;
+
+    VerifyOrExit(monitor.GetSampleCount() > 0);
+
+    for (uint8_t i = 0; i < kNumChannels; i++)
+    {
+        uint8_t occupancy = static_cast<uint8_t>(monitor.GetPeakChannelOccupancy(OT_RADIO_CHANNEL_MIN + i) >> 8);
+
+        // Average with the previous days, giving a weight of 1/4 to today.
+        mHistory[mHistorySlot][i] =
+            isValid ? static_cast<uint8_t>((3 * mHistory[mHistorySlot][i] + occupancy) / 4) : occupancy;
+    }
+
+    mHistoryValidSlots |= (1UL << mHistorySlot);
+
+exit:
+    mHistorySlot = (mHistorySlot + 1) % kHistorySlots;
+    mHistoryTimer.StartAt(mHistoryTimer.GetFireTime(), kHistoryInterval);
+}
+#endif // OPENTHREAD_CONFIG_CHANNEL_MANAGER_HISTORY_SLOTS
+
 otError ChannelManager::RequestChannelSelect(bool aSkipQualityCheck)
 {
     otError  error = OT_ERROR_NONE;
@@ -391,11 +509,12 @@ otError ChannelManager::RequestChannelSelect(bool aSkipQualityCheck)
     SuccessOrExit(error = FindBetterChannel(newChannel, newOccupancy));
 
     curChannel   = GetInstance().Get<Mac::Mac>().GetPanChannel();
-    curOccupancy = GetInstance().GetChannelMonitor().GetChannelOccupancy(curChannel);
+    curOccupancy = GetChannelScore(curChannel);
 
     if (newChannel == curChannel)
     {
         otLogInfoUtil("ChannelManager: Already on best possible channel %d", curChannel);
+        mCandidateCount = 0;
         ExitNow();
     }
 
@@ -409,9 +528,23 @@ otError ChannelManager::RequestChannelSelect(bool aSkipQualityCheck)
         (static_cast<uint16_t>(curOccupancy - newOccupancy) < kThresholdToChangeChannel))
     {
         otLogInfoUtil("ChannelManager: Occupancy rate diff too small to change channel");
+        mCandidateCount = 0;
+        ExitNow();
+    }
+
+    // Unless forced, the same channel must be selected `kConfirmationCount`
+    // consecutive times, so that a transient occupancy difference does not
+    // trigger a network-wide channel change.
+
+    if (!aSkipQualityCheck && !IsChannelSelectionConfirmed(newChannel))
+    {
+        otLogInfoUtil("ChannelManager: Channel %d selected %d of %d times, waiting to confirm", newChannel,
+                      mCandidateCount, kConfirmationCount);
         ExitNow();
     }
 
+    mCandidateCount = 0;
+
     RequestChannelChange(newChannel);
 
 exit:
@@ -459,6 +592,17 @@ void ChannelManager::SetAutoChannelSelectionEnabled(bool aEnabled)
         mAutoSelectEnabled = aEnabled;
         IgnoreReturnValue(RequestChannelSelect(false));
         StartAutoSelectTimer();
+
+#if OPENTHREAD_ENABLE_CHANNEL_MONITOR && OPENTHREAD_CONFIG_CHANNEL_MANAGER_HISTORY_SLOTS
+        if (aEnabled)
+        {
+            mHistoryTimer.Start(kHistoryInterval);
+        }
+        else
+        {
+            mHistoryTimer.Stop();
+        }
+#endif
     }
 }
 
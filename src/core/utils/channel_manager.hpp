@@ -147,7 +147,8 @@ public:
      *    (@sa SetSupportedChannels, @sa SetFavoredChannels).
      *
      * 3) If the newly selected channel is different from the current channel, `ChannelManager` requests/starts the
-     *    channel change process (internally invoking a `RequestChannelChange()`).
+     *    channel change process (internally invoking a `RequestChannelChange()`). Unless the quality check is skipped,
+     *    the same channel must be selected by `kConfirmationCount` consecutive calls before the change is started.
      *
      *
      * @param[in] aSkipQualityCheck        Indicates whether the quality check (step 1) should be skipped.
@@ -261,7 +262,19 @@ private:
 
         // Minimum CCA failure rate on current channel to start the channel selection process.
         kCcaFailureRateThreshold = OPENTHREAD_CONFIG_CHANNEL_MANAGER_CCA_FAILURE_THRESHOLD,
+
+        // Number of consecutive channel selections that must agree before changing channel.
+        kConfirmationCount = OPENTHREAD_CONFIG_CHANNEL_MANAGER_CONFIRMATION_COUNT,
+    };
+
+#if OPENTHREAD_ENABLE_CHANNEL_MONITOR && OPENTHREAD_CONFIG_CHANNEL_MANAGER_HISTORY_SLOTS
+    enum
+    {
+        kNumChannels     = (OT_RADIO_CHANNEL_MAX - OT_RADIO_CHANNEL_MIN + 1),
+        kHistorySlots    = OPENTHREAD_CONFIG_CHANNEL_MANAGER_HISTORY_SLOTS,
+        kHistoryInterval = (24 * 60 * 60 * 1000UL) / kHistorySlots, // Duration of a history slot (in ms).
     };
+#endif
 
     enum State
     {
@@ -278,8 +291,16 @@ private:
     void        StartAutoSelectTimer(void);
 
 #if OPENTHREAD_ENABLE_CHANNEL_MONITOR
-    otError FindBetterChannel(uint8_t &aNewChannel, uint16_t &aOccupancy);
-    bool    ShouldAttamptChannelChange(void);
+    otError          FindBetterChannel(uint8_t &aNewChannel, uint16_t &aOccupancy);
+    Mac::ChannelMask FindBestChannels(const Mac::ChannelMask &aMask, uint16_t &aOccupancy) const;
+    uint16_t         GetChannelScore(uint8_t aChannel) const;
+    bool             ShouldAttamptChannelChange(void);
+    bool             IsChannelSelectionConfirmed(uint8_t aChannel);
+
+#if OPENTHREAD_CONFIG_CHANNEL_MANAGER_HISTORY_SLOTS
+    static void HandleHistoryTimer(Timer &aTimer);
+    void        HandleHistoryTimer(void);
+#endif
 #endif
 
     Mac::ChannelMask   mSupportedChannelMask;
@@ -292,6 +313,16 @@ private:
     TimerMilli         mTimer;
     uint32_t           mAutoSelectInterval;
     bool               mAutoSelectEnabled;
+
+    uint8_t mCandidateChannel;
+    uint8_t mCandidateCount;
+
+#if OPENTHREAD_ENABLE_CHANNEL_MONITOR && OPENTHREAD_CONFIG_CHANNEL_MANAGER_HISTORY_SLOTS
+    uint8_t    mHistory[kHistorySlots][kNumChannels]; // Occupancy history, upper byte of the occupancy.
+    uint32_t   mHistoryValidSlots;
+    uint8_t    mHistorySlot;
+    TimerMilli mHistoryTimer;
+#endif
 };
 
 #else // OPENTHREAD_FTD
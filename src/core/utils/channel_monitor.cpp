@@ -55,8 +55,15 @@ ChannelMonitor::ChannelMonitor(Instance &aInstance)
     , mChannelMaskIndex(0)
     , mSampleCount(0)
     , mTimer(aInstance, &ChannelMonitor::HandleTimer, this)
+#if OPENTHREAD_CONFIG_CHANNEL_MONITOR_START_ON_ATTACH
+    , mNotifierCallback(&ChannelMonitor::HandleStateChanged, this, OT_CHANGED_THREAD_ROLE)
+#endif
 {
-    memset(mChannelOccupancy, 0, sizeof(mChannelOccupancy));
+    ClearStats();
+
+#if OPENTHREAD_CONFIG_CHANNEL_MONITOR_START_ON_ATTACH
+    aInstance.GetNotifier().RegisterCallback(mNotifierCallback);
+#endif
 }
 
 otError ChannelMonitor::Start(void)
@@ -84,13 +91,50 @@ exit:
     return error;
 }
 
+#if OPENTHREAD_CONFIG_CHANNEL_MONITOR_START_ON_ATTACH
+void ChannelMonitor::HandleStateChanged(Notifier::Callback &aCallback, otChangedFlags aFlags)
+{
+    aCallback.GetOwner<ChannelMonitor>().HandleStateChanged(aFlags);
+}
+
+void ChannelMonitor::HandleStateChanged(otChangedFlags aFlags)
+{
+    VerifyOrExit((aFlags & OT_CHANGED_THREAD_ROLE) != 0);
+    VerifyOrExit(GetInstance().GetThreadNetif().GetMle().IsAttached());
+
+    // `Start()` returns `OT_ERROR_ALREADY` on later role changes, which keeps the collected data.
+    IgnoreReturnValue(Start());
+
+exit:
+    return;
+}
+#endif
+
 void ChannelMonitor::Clear(void)
+{
+    ClearStats();
+
+    otLogDebgUtil("ChannelMonitor: Clearing data");
+}
+
+void ChannelMonitor::ClearStats(void)
 {
     mChannelMaskIndex = 0;
     mSampleCount      = 0;
-    memset(mChannelOccupancy, 0, sizeof(mChannelOccupancy));
+    memset(mChannelStats, 0, sizeof(mChannelStats));
 
-    otLogDebgUtil("ChannelMonitor: Clearing data");
+#if OPENTHREAD_CONFIG_CHANNEL_MONITOR_RSSI_HISTOGRAM
+    for (uint8_t i = 0; i < kNumChannels; i++)
+    {
+        mChannelStats[i].mMinRssi = INT8_MAX;
+        mChannelStats[i].mMaxRssi = INT8_MIN;
+    }
+#endif
+
+#if OPENTHREAD_CONFIG_CHANNEL_MONITOR_FULL_SCAN_PERIOD
+    mCandidateChannelMask = 0;
+    mScanRound            = 0;
+#endif
 }
 
 uint16_t ChannelMonitor::GetChannelOccupancy(uint8_t aChannel) const
@@ -98,12 +142,64 @@ uint16_t ChannelMonitor::GetChannelOccupancy(uint8_t aChannel) const
     uint16_t occupancy = 0;
 
     VerifyOrExit((OT_RADIO_CHANNEL_MIN <= aChannel) && (aChannel <= OT_RADIO_CHANNEL_MAX));
-    occupancy = mChannelOccupancy[aChannel - OT_RADIO_CHANNEL_MIN];
+    occupancy = mChannelStats[aChannel - OT_RADIO_CHANNEL_MIN].mOccupancy;
+
+exit:
+    return occupancy;
+}
+
+uint16_t ChannelMonitor::GetShortTermChannelOccupancy(uint8_t aChannel) const
+{
+    uint16_t occupancy = 0;
+
+#if OPENTHREAD_CONFIG_CHANNEL_MONITOR_SHORT_SAMPLE_WINDOW
+    VerifyOrExit((OT_RADIO_CHANNEL_MIN <= aChannel) && (aChannel <= OT_RADIO_CHANNEL_MAX));
+    occupancy = mChannelStats[aChannel - OT_RADIO_CHANNEL_MIN].mShortTermOccupancy;
 
 exit:
+#else
+    OT_UNUSED_VARIABLE(aChannel);
+#endif
     return occupancy;
 }
 
+uint16_t ChannelMonitor::GetPeakChannelOccupancy(uint8_t aChannel) const
+{
+    uint16_t occupancy          = GetChannelOccupancy(aChannel);
+    uint16_t shortTermOccupancy = GetShortTermChannelOccupancy(aChannel);
+
+    return (shortTermOccupancy > occupancy) ? shortTermOccupancy : occupancy;
+}
+
+otError ChannelMonitor::GetChannelRssiSummary(uint8_t aChannel, otChannelMonitorRssiSummary &aSummary) const
+{
+#if OPENTHREAD_CONFIG_CHANNEL_MONITOR_RSSI_HISTOGRAM
+    otError error = OT_ERROR_NONE;
+
+    VerifyOrExit((OT_RADIO_CHANNEL_MIN <= aChannel) && (aChannel <= OT_RADIO_CHANNEL_MAX),
+                 error = OT_ERROR_INVALID_ARGS);
+
+    {
+        const ChannelStats &stats = mChannelStats[aChannel - OT_RADIO_CHANNEL_MIN];
+
+        VerifyOrExit(stats.mMinRssi <= stats.mMaxRssi, error = OT_ERROR_NOT_FOUND);
+
+        aSummary.mMinRssi          = stats.mMinRssi;
+        aSummary.mMaxRssi          = stats.mMaxRssi;
+        aSummary.mMedianRssi       = GetRssiPercentile(stats, 50);
+        aSummary.mPercentile90Rssi = GetRssiPercentile(stats, 90);
+    }
+
+exit:
+    return error;
+#else
+    OT_UNUSED_VARIABLE(aChannel);
+    OT_UNUSED_VARIABLE(aSummary);
+
+    return OT_ERROR_DISABLED_FEATURE;
+#endif
+}
+
 void ChannelMonitor::HandleTimer(Timer &aTimer)
 {
     aTimer.GetOwner<ChannelMonitor>().HandleTimer();
@@ -111,8 +207,24 @@ void ChannelMonitor::HandleTimer(Timer &aTimer)
 
 void ChannelMonitor::HandleTimer(void)
 {
-    GetInstance().Get<Mac::Mac>().EnergyScan(mScanChannelMasks[mChannelMaskIndex], 0,
-                                             &ChannelMonitor::HandleEnergyScanResult, this);
+    uint32_t scanMask = mScanChannelMasks[mChannelMaskIndex];
+
+#if OPENTHREAD_CONFIG_CHANNEL_MONITOR_FULL_SCAN_PERIOD
+    // Outside of full scan rounds only the candidate channels are sampled.
+    if (mScanRound != 0)
+    {
+        scanMask &= mCandidateChannelMask;
+    }
+#endif
+
+    if (scanMask != 0)
+    {
+        GetInstance().Get<Mac::Mac>().EnergyScan(scanMask, 0, &ChannelMonitor::HandleEnergyScanResult, this);
+    }
+    else
+    {
+        HandleEnergyScanResult(NULL);
+    }
 
     mTimer.StartAt(mTimer.GetFireTime(), Random::AddJitter(kTimerInterval, kMaxJitterInterval));
 }
@@ -130,6 +242,12 @@ void ChannelMonitor::HandleEnergyScanResult(otEnergyScanResult *aResult)
         {
             mChannelMaskIndex = 0;
             mSampleCount++;
+
+#if OPENTHREAD_CONFIG_CHANNEL_MONITOR_FULL_SCAN_PERIOD
+            mScanRound = (mScanRound + 1) % kFullScanPeriod;
+            UpdateCandidateChannels();
+#endif
+
             LogResults();
         }
         else
@@ -140,12 +258,12 @@ void ChannelMonitor::HandleEnergyScanResult(otEnergyScanResult *aResult)
     else
     {
         uint8_t  channelIndex = (aResult->mChannel - OT_RADIO_CHANNEL_MIN);
-        uint32_t newAverage   = mChannelOccupancy[channelIndex];
-        uint32_t newValue     = 0;
-        uint32_t weight;
+        uint16_t newValue     = 0;
 
         assert(channelIndex < kNumChannels);
 
+        ChannelStats &stats = mChannelStats[channelIndex];
+
         otLogDebgUtil("ChannelMonitor: channel: %d, rssi:%d", aResult->mChannel, aResult->mMaxRssi);
 
         if (aResult->mMaxRssi != OT_RADIO_RSSI_INVALID)
@@ -162,32 +280,162 @@ void ChannelMonitor::HandleEnergyScanResult(otEnergyScanResult *aResult)
         // average logic with weight coefficient `1/kSampleWindow` for new
         // values. Practically, this means the average is representative
         // of up to `3 * kSampleWindow` samples with highest weight given
-        // to the latest `kSampleWindow` samples.
+        // to the latest `kSampleWindow` samples. The short-term occupancy
+        // is maintained the same way over `kShortSampleWindow` samples.
+
+        stats.mOccupancy = UpdateOccupancy(stats.mOccupancy, newValue, stats.mSampleCount, kSampleWindow);
+
+#if OPENTHREAD_CONFIG_CHANNEL_MONITOR_SHORT_SAMPLE_WINDOW
+        stats.mShortTermOccupancy =
+            UpdateOccupancy(stats.mShortTermOccupancy, newValue, stats.mSampleCount, kShortSampleWindow);
+#endif
 
-        if (mSampleCount >= kSampleWindow)
+#if OPENTHREAD_CONFIG_CHANNEL_MONITOR_RSSI_HISTOGRAM
+        if (aResult->mMaxRssi != OT_RADIO_RSSI_INVALID)
         {
-            weight = kSampleWindow - 1;
+            UpdateRssiHistogram(stats, aResult->mMaxRssi);
         }
-        else
+#endif
+
+#if OPENTHREAD_ENABLE_JAM_DETECTION && OPENTHREAD_CONFIG_JAM_DETECTOR_CHANNEL_MONITOR
+        GetInstance().Get<JamDetector>().HandleChannelMonitorSample(aResult->mChannel, aResult->mMaxRssi);
+#endif
+
+        if (stats.mSampleCount < kMaxSampleCount)
+        {
+            stats.mSampleCount++;
+        }
+    }
+}
+
+uint16_t ChannelMonitor::UpdateOccupancy(uint16_t aAverage, uint16_t aNewValue, uint16_t aSampleCount, uint16_t aWindow)
+{
+    uint32_t weight = (aSampleCount >= aWindow) ? (aWindow - 1) : aSampleCount;
+
+    return static_cast<uint16_t>((static_cast<uint32_t>(aAverage) * weight + aNewValue) / (weight + 1));
+}
+
+#if OPENTHREAD_CONFIG_CHANNEL_MONITOR_RSSI_HISTOGRAM
+
+void ChannelMonitor::UpdateRssiHistogram(ChannelStats &aStats, int8_t aRssi)
+{
+    uint8_t bin = 0;
+
+    if (aRssi >= kRssiBinBase)
+    {
+        bin = static_cast<uint8_t>((aRssi - kRssiBinBase) / kRssiBinWidth + 1);
+
+        if (bin >= kNumRssiBins)
+        {
+            bin = kNumRssiBins - 1;
+        }
+    }
+
+    // Halving all bins when one saturates keeps the distribution while favoring the recent samples.
+    if (aStats.mRssiHistogram[bin] == kMaxBinCount)
+    {
+        for (uint8_t i = 0; i < kNumRssiBins; i++)
         {
-            weight = mSampleCount;
+            aStats.mRssiHistogram[i] >>= 1;
         }
+    }
+
+    aStats.mRssiHistogram[bin]++;
 
-        newAverage = (newAverage * weight + newValue) / (weight + 1);
+    if (aRssi < aStats.mMinRssi)
+    {
+        aStats.mMinRssi = aRssi;
+    }
 
-        mChannelOccupancy[channelIndex] = static_cast<uint16_t>(newAverage);
+    if (aRssi > aStats.mMaxRssi)
+    {
+        aStats.mMaxRssi = aRssi;
     }
 }
 
+int8_t ChannelMonitor::GetRssiPercentile(const ChannelStats &aStats, uint8_t aPercentile)
+{
+    uint16_t total = 0;
+    uint16_t count = 0;
+    uint16_t target;
+    uint8_t  bin;
+    int16_t  rssi;
+
+    for (bin = 0; bin < kNumRssiBins; bin++)
+    {
+        total += aStats.mRssiHistogram[bin];
+    }
+
+    target = static_cast<uint16_t>((static_cast<uint32_t>(total) * aPercentile + 99) / 100);
+
+    for (bin = 0; bin < kNumRssiBins - 1; bin++)
+    {
+        count += aStats.mRssiHistogram[bin];
+
+        if (count >= target && count > 0)
+        {
+            break;
+        }
+    }
+
+    // Report the upper edge of the bin, bounded by the lowest and highest samples.
+    rssi = kRssiBinBase + bin * kRssiBinWidth - 1;
+
+    if (bin == kNumRssiBins - 1 || rssi > aStats.mMaxRssi)
+    {
+        rssi = aStats.mMaxRssi;
+    }
+
+    if (rssi < aStats.mMinRssi)
+    {
+        rssi = aStats.mMinRssi;
+    }
+
+    return static_cast<int8_t>(rssi);
+}
+
+#endif // OPENTHREAD_CONFIG_CHANNEL_MONITOR_RSSI_HISTOGRAM
+
+#if OPENTHREAD_CONFIG_CHANNEL_MONITOR_FULL_SCAN_PERIOD
+
+void ChannelMonitor::UpdateCandidateChannels(void)
+{
+    uint8_t panChannel = GetInstance().Get<Mac::Mac>().GetPanChannel();
+
+    mCandidateChannelMask = (1UL << panChannel);
+
+    for (uint8_t n = 0; n < kNumCandidateChannels; n++)
+    {
+        uint8_t  bestChannel   = 0;
+        uint16_t bestOccupancy = kMaxOccupancy;
+
+        for (uint8_t channel = OT_RADIO_CHANNEL_MIN; channel <= OT_RADIO_CHANNEL_MAX; channel++)
+        {
+            uint16_t occupancy = GetPeakChannelOccupancy(channel);
+
+            if (!(mCandidateChannelMask & (1UL << channel)) && (bestChannel == 0 || occupancy < bestOccupancy))
+            {
+                bestChannel   = channel;
+                bestOccupancy = occupancy;
+            }
+        }
+
+        mCandidateChannelMask |= (1UL << bestChannel);
+    }
+}
+
+#endif // OPENTHREAD_CONFIG_CHANNEL_MONITOR_FULL_SCAN_PERIOD
+
 void ChannelMonitor::LogResults(void)
 {
     otLogInfoUtil(
         "ChannelMonitor: %u [%02x %02x %02x %02x %02x %02x %02x %02x %02x %02x %02x %02x %02x %02x %02x %02x]",
-        mSampleCount, mChannelOccupancy[0] >> 8, mChannelOccupancy[1] >> 8, mChannelOccupancy[2] >> 8,
-        mChannelOccupancy[3] >> 8, mChannelOccupancy[4] >> 8, mChannelOccupancy[5] >> 8, mChannelOccupancy[6] >> 8,
-        mChannelOccupancy[7] >> 8, mChannelOccupancy[8] >> 8, mChannelOccupancy[9] >> 8, mChannelOccupancy[10] >> 8,
-        mChannelOccupancy[11] >> 8, mChannelOccupancy[12] >> 8, mChannelOccupancy[13] >> 8, mChannelOccupancy[14] >> 8,
-        mChannelOccupancy[15] >> 8);
+        mSampleCount, mChannelStats[0].mOccupancy >> 8, mChannelStats[1].mOccupancy >> 8,
+        mChannelStats[2].mOccupancy >> 8, mChannelStats[3].mOccupancy >> 8, mChannelStats[4].mOccupancy >> 8,
+        mChannelStats[5].mOccupancy >> 8, mChannelStats[6].mOccupancy >> 8, mChannelStats[7].mOccupancy >> 8,
+        mChannelStats[8].mOccupancy >> 8, mChannelStats[9].mOccupancy >> 8, mChannelStats[10].mOccupancy >> 8,
+        mChannelStats[11].mOccupancy >> 8, mChannelStats[12].mOccupancy >> 8, mChannelStats[13].mOccupancy >> 8,
+        mChannelStats[14].mOccupancy >> 8, mChannelStats[15].mOccupancy >> 8);
 }
 
 Mac::ChannelMask ChannelMonitor::FindBestChannels(const Mac::ChannelMask &aMask, uint16_t &aOccupancy)
@@ -202,7 +450,7 @@ Mac::ChannelMask ChannelMonitor::FindBestChannels(const Mac::ChannelMask &aMask,
 
     while (aMask.GetNextChannel(channel) == OT_ERROR_NONE)
     {
-        uint16_t occupancy = GetChannelOccupancy(channel);
+        uint16_t occupancy = GetPeakChannelOccupancy(channel);
 
         if (bestMask.IsEmpty() || (occupancy <= minOccupancy))
         {
@@ -36,9 +36,11 @@
 
 #include "openthread-core-config.h"
 
+#include <openthread/channel_monitor.h>
 #include <openthread/platform/radio.h>
 
 #include "common/locator.hpp"
+#include "common/notifier.hpp"
 #include "common/timer.hpp"
 #include "mac/mac.hpp"
 
@@ -68,6 +70,15 @@ namespace Utils {
  * average rate/percentage of RSSI samples that are above the threshold within (approximately) a specified sample
  * window (referred to as "channel occupancy").
  *
+ * Optionally, a short-term channel occupancy (over `kShortSampleWindow` samples) and a compact RSSI histogram are also
+ * maintained per channel, both updated incrementally with each sample. When `kFullScanPeriod` is non-zero, all channels
+ * are sampled only once every `kFullScanPeriod` sample intervals, and the other intervals sample only the current
+ * channel and the channels with the lowest occupancy.
+ *
+ * When `OPENTHREAD_CONFIG_CHANNEL_MONITOR_START_ON_ATTACH` is enabled, the Thread interface does not start Channel
+ * Monitoring when it is brought up. Monitoring is instead started once the device first attaches, so that its energy
+ * scans do not compete with the attach process for the radio.
+ *
  */
 class ChannelMonitor : public InstanceLocator
 {
@@ -93,6 +104,19 @@ public:
          *
          */
         kSampleWindow = OPENTHREAD_CONFIG_CHANNEL_MONITOR_SAMPLE_WINDOW,
+
+        /**
+         * The short-term averaging sample window length (in units of sample interval), zero if disabled.
+         *
+         */
+        kShortSampleWindow = OPENTHREAD_CONFIG_CHANNEL_MONITOR_SHORT_SAMPLE_WINDOW,
+
+        /**
+         * The period (in units of sample interval) at which all channels are sampled, zero to sample all channels in
+         * every sample interval.
+         *
+         */
+        kFullScanPeriod = OPENTHREAD_CONFIG_CHANNEL_MONITOR_FULL_SCAN_PERIOD,
     };
 
     /**
@@ -168,11 +192,47 @@ public:
      */
     uint16_t GetChannelOccupancy(uint8_t aChannel) const;
 
+    /**
+     * This method returns the short-term channel occupancy for a given channel.
+     *
+     * The short-term occupancy is maintained like `GetChannelOccupancy()` but over `kShortSampleWindow` samples.
+     *
+     * @param[in]  aChannel     The channel for which to get the short-term occupancy.
+     *
+     * @returns the short-term channel occupancy for the given channel, or zero if `kShortSampleWindow` is zero.
+     *
+     */
+    uint16_t GetShortTermChannelOccupancy(uint8_t aChannel) const;
+
+    /**
+     * This method returns the higher of the channel occupancy and the short-term channel occupancy for a given channel.
+     *
+     * @param[in]  aChannel     The channel for which to get the occupancy.
+     *
+     * @returns the peak channel occupancy for the given channel.
+     *
+     */
+    uint16_t GetPeakChannelOccupancy(uint8_t aChannel) const;
+
+    /**
+     * This method gets the summary of the RSSI samples of a given channel.
+     *
+     * @param[in]   aChannel    The channel for which to get the RSSI summary.
+     * @param[out]  aSummary    A reference to where the RSSI summary is placed.
+     *
+     * @retval OT_ERROR_NONE              Successfully retrieved the RSSI summary.
+     * @retval OT_ERROR_NOT_FOUND         No valid RSSI sample has been taken on the channel.
+     * @retval OT_ERROR_INVALID_ARGS      @p aChannel is not a supported channel.
+     * @retval OT_ERROR_DISABLED_FEATURE  `OPENTHREAD_CONFIG_CHANNEL_MONITOR_RSSI_HISTOGRAM` is disabled.
+     *
+     */
+    otError GetChannelRssiSummary(uint8_t aChannel, otChannelMonitorRssiSummary &aSummary) const;
+
     /**
      * This method finds the best channel(s) (with least occupancy rate) in a given channel mask.
      *
-     * The channels are compared based on their occupancy rate from `GetChannelOccupancy()` and lower occupancy rate
-     * is considered better.
+     * The channels are compared based on their occupancy rate from `GetPeakChannelOccupancy()` and lower occupancy
+     * rate is considered better.
      *
      * @param[in]  aMask         A channel mask (the search is limited to channels in @p aMask).
      * @param[out] aOccupancy    A reference to `uint16` to return the occupancy rate associated with best channel(s).
@@ -191,6 +251,38 @@ private:
         kTimerInterval     = (kSampleInterval / kNumChannelMasks),
         kMaxJitterInterval = 4096,
         kMaxOccupancy      = 0xffff,
+        kMaxSampleCount    = 0xffff,
+    };
+
+#if OPENTHREAD_CONFIG_CHANNEL_MONITOR_RSSI_HISTOGRAM
+    enum
+    {
+        kNumRssiBins  = 8,   // Bin 0 holds samples below `kRssiBinBase`, the last bin those above the other bins.
+        kRssiBinBase  = -96, // Lower edge of bin 1 (dBm).
+        kRssiBinWidth = 8,   // Width of the bins (dB).
+        kMaxBinCount  = 0xff,
+    };
+#endif
+
+#if OPENTHREAD_CONFIG_CHANNEL_MONITOR_FULL_SCAN_PERIOD
+    enum
+    {
+        kNumCandidateChannels = 3, // Number of lowest occupancy channels sampled next to the current channel.
+    };
+#endif
+
+    struct ChannelStats
+    {
+        uint16_t mOccupancy;
+#if OPENTHREAD_CONFIG_CHANNEL_MONITOR_SHORT_SAMPLE_WINDOW
+        uint16_t mShortTermOccupancy;
+#endif
+        uint16_t mSampleCount;
+#if OPENTHREAD_CONFIG_CHANNEL_MONITOR_RSSI_HISTOGRAM
+        int8_t  mMinRssi;
+        int8_t  mMaxRssi;
+        uint8_t mRssiHistogram[kNumRssiBins];
+#endif
     };
 
     static void HandleTimer(Timer &aTimer);
@@ -198,13 +290,39 @@ private:
     static void HandleEnergyScanResult(void *aContext, otEnergyScanResult *aResult);
     void        HandleEnergyScanResult(otEnergyScanResult *aResult);
     void        LogResults(void);
+    void        ClearStats(void);
+
+#if OPENTHREAD_CONFIG_CHANNEL_MONITOR_START_ON_ATTACH
+    static void HandleStateChanged(Notifier::Callback &aCallback, otChangedFlags aFlags);
+    void        HandleStateChanged(otChangedFlags aFlags);
+#endif
+
+    static uint16_t UpdateOccupancy(uint16_t aAverage, uint16_t aNewValue, uint16_t aSampleCount, uint16_t aWindow);
+
+#if OPENTHREAD_CONFIG_CHANNEL_MONITOR_RSSI_HISTOGRAM
+    static void   UpdateRssiHistogram(ChannelStats &aStats, int8_t aRssi);
+    static int8_t GetRssiPercentile(const ChannelStats &aStats, uint8_t aPercentile);
+#endif
+
+#if OPENTHREAD_CONFIG_CHANNEL_MONITOR_FULL_SCAN_PERIOD
+    void UpdateCandidateChannels(void);
+#endif
 
     static const uint32_t mScanChannelMasks[kNumChannelMasks];
 
     uint8_t    mChannelMaskIndex : 2;
     uint32_t   mSampleCount : 30;
-    uint16_t   mChannelOccupancy[kNumChannels];
-    TimerMilli mTimer;
+    ChannelStats mChannelStats[kNumChannels];
+    TimerMilli   mTimer;
+
+#if OPENTHREAD_CONFIG_CHANNEL_MONITOR_FULL_SCAN_PERIOD
+    uint32_t mCandidateChannelMask;
+    uint16_t mScanRound;
+#endif
+
+#if OPENTHREAD_CONFIG_CHANNEL_MONITOR_START_ON_ATTACH
+    Notifier::Callback mNotifierCallback;
+#endif
 };
 
 #endif // OPENTHREAD_ENABLE_CHANNEL_MONITOR
@@ -51,7 +51,9 @@ ChildSupervisor::ChildSupervisor(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mSupervisionInterval(kDefaultSupervisionInterval)
     , mTimer(aInstance, &ChildSupervisor::HandleTimer, this)
-    , mNotifierCallback(&ChildSupervisor::HandleStateChanged, this)
+    , mNotifierCallback(&ChildSupervisor::HandleStateChanged,
+                        this,
+                        OT_CHANGED_THREAD_ROLE | OT_CHANGED_THREAD_CHILD_ADDED | OT_CHANGED_THREAD_CHILD_REMOVED)
 {
     aInstance.GetNotifier().RegisterCallback(mNotifierCallback);
 }
@@ -62,50 +64,20 @@ void ChildSupervisor::SetSupervisionInterval(uint16_t aInterval)
     CheckState();
 }
 
-Child *ChildSupervisor::GetDestination(const Message &aMessage) const
-{
-    Child * child = NULL;
-    uint8_t childIndex;
-
-    VerifyOrExit(aMessage.GetType() == Message::kTypeSupervision);
-
-    aMessage.Read(0, sizeof(childIndex), &childIndex);
-    child = GetNetif().GetMle().GetChildTable().GetChildAtIndex(childIndex);
-
-exit:
-    return child;
-}
-
 void ChildSupervisor::SendMessage(Child &aChild)
 {
-    ThreadNetif &netif   = GetNetif();
-    Message *    message = NULL;
-    uint8_t      childIndex;
-
     VerifyOrExit(aChild.GetIndirectMessageCount() == 0);
 
-    message = netif.GetInstance().GetMessagePool().New(Message::kTypeSupervision, sizeof(uint8_t));
-    VerifyOrExit(message != NULL);
-
-    // Supervision message is an empty payload 15.4 data frame.
-    // The child index is stored here in the message content to allow
-    // the destination of the message to be later retrieved using
-    // `ChildSupervisor::GetDestination(message)`.
+    // Supervision message is an empty payload 15.4 data frame. A single
+    // message is shared by all children that need one, so children with
+    // aligned supervision intervals do not each take a message buffer.
 
-    childIndex = netif.GetMle().GetChildTable().GetChildIndex(aChild);
-    SuccessOrExit(message->Append(&childIndex, sizeof(childIndex)));
-
-    SuccessOrExit(netif.SendMessage(*message));
-    message = NULL;
+    SuccessOrExit(GetNetif().GetMeshForwarder().SendSupervisionMessage(aChild));
 
     otLogInfoUtil("Sending supervision message to child 0x%04x", aChild.GetRloc16());
 
 exit:
-
-    if (message != NULL)
-    {
-        message->Free();
-    }
+    return;
 }
 
 void ChildSupervisor::UpdateOnSend(Child &aChild)
@@ -134,7 +106,7 @@ void ChildSupervisor::HandleTimer(void)
         }
     }
 
-    mTimer.Start(kOneSecond);
+    mTimer.StartWithSlack(kOneSecond, kTimerSlack);
 
 exit:
     return;
@@ -154,7 +126,7 @@ void ChildSupervisor::CheckState(void)
 
     if (shouldRun && !mTimer.IsRunning())
     {
-        mTimer.Start(kOneSecond);
+        mTimer.StartWithSlack(kOneSecond, kTimerSlack);
         otLogInfoUtil("Starting Child Supervision");
     }
 
@@ -129,16 +129,6 @@ public:
      */
     uint16_t GetSupervisionInterval(void) const { return mSupervisionInterval; }
 
-    /**
-     * This method returns the destination for a supervision message.
-     *
-     * @param[in] aMessage The message for which to get the destination.
-     *
-     * @returns  A pointer to the destination child of the message, or NULL if @p aMessage is not of supervision type.
-     *
-     */
-    Child *GetDestination(const Message &aMessage) const;
-
     /**
      * This method updates the supervision state for a child. It informs the child supervisor that a message was
      * successfully sent to the child.
@@ -153,6 +143,7 @@ private:
     {
         kDefaultSupervisionInterval = OPENTHREAD_CONFIG_CHILD_SUPERVISION_INTERVAL, // (seconds)
         kOneSecond                  = 1000,                                         // One second interval (in ms).
+        kTimerSlack                 = 50,                                           // Timer slack (in ms).
     };
 
     void        SendMessage(Child &aChild);
@@ -177,7 +168,6 @@ public:
     void     Stop(void) {}
     void     SetSupervisionInterval(uint16_t) {}
     uint16_t GetSupervisionInterval(void) const { return 0; }
-    Child *  GetDestination(const Message &) const { return NULL; }
     void     UpdateOnSend(Child &) {}
 };
 
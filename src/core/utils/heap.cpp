@@ -44,6 +44,20 @@ namespace Utils {
 
 Heap::Heap(void)
 {
+#if OPENTHREAD_CONFIG_HEAP_SEGREGATED_FIT
+    Block &first = BlockAt(kFirstBlockOffset);
+    first.SetSize(kFirstBlockSize);
+
+    Block &guard = BlockRight(first);
+    guard.SetSize(Block::kGuardBlockSize);
+
+    for (uint8_t i = 0; i < kNumFreeLists; i++)
+    {
+        mFreeLists[i] = kGuardBlockOffset;
+    }
+
+    FreeListAdd(first);
+#else
     Block &super = BlockAt(kSuperBlockOffset);
     super.SetSize(kSuperBlockSize);
 
@@ -55,6 +69,7 @@ Heap::Heap(void)
 
     super.SetNext(BlockOffset(first));
     first.SetNext(BlockOffset(guard));
+#endif
 
     mMemory.mFreeSize = kFirstBlockSize;
 }
@@ -62,9 +77,11 @@ Heap::Heap(void)
 void *Heap::CAlloc(size_t aCount, size_t aSize)
 {
     void *   ret  = NULL;
-    Block *  prev = NULL;
     Block *  curr = NULL;
     uint16_t size = static_cast<uint16_t>(aCount * aSize);
+#if !OPENTHREAD_CONFIG_HEAP_SEGREGATED_FIT
+    Block *prev = NULL;
+#endif
 
     VerifyOrExit(size);
 
@@ -72,6 +89,42 @@ void *Heap::CAlloc(size_t aCount, size_t aSize)
     size &= ~(kAlignSize - 1);
     size += kBlockRemainderSize;
 
+#if OPENTHREAD_CONFIG_HEAP_SEGREGATED_FIT
+    // Any block in an exact-size list at or above the requested size fits, so small requests never walk a list.
+    for (uint8_t i = FreeListIndex(size); i < kLargeList && curr == NULL; i++)
+    {
+        if (mFreeLists[i] != kGuardBlockOffset)
+        {
+            curr = &BlockAt(mFreeLists[i]);
+        }
+    }
+
+    if (curr == NULL)
+    {
+        curr = &BlockAt(mFreeLists[kLargeList]);
+
+        while (curr->GetSize() < size)
+        {
+            curr = &BlockNext(*curr);
+        }
+
+        VerifyOrExit(curr->IsFree());
+    }
+
+    FreeListRemove(*curr);
+
+    if (curr->GetSize() > size + sizeof(Block))
+    {
+        const uint16_t newBlockSize = curr->GetSize() - size - sizeof(Block);
+        curr->SetSize(size);
+
+        Block &newBlock = BlockRight(*curr);
+        newBlock.SetSize(newBlockSize);
+        FreeListAdd(newBlock);
+
+        mMemory.mFreeSize -= sizeof(Block);
+    }
+#else
     prev = &BlockSuper();
     curr = &BlockNext(*prev);
 
@@ -105,6 +158,7 @@ void *Heap::CAlloc(size_t aCount, size_t aSize)
 
         mMemory.mFreeSize -= sizeof(Block);
     }
+#endif // OPENTHREAD_CONFIG_HEAP_SEGREGATED_FIT
 
     mMemory.mFreeSize -= curr->GetSize();
 
@@ -142,6 +196,98 @@ Block &Heap::BlockPrev(const Block &aBlock)
     return *prev;
 }
 
+#if OPENTHREAD_CONFIG_HEAP_SEGREGATED_FIT
+void Heap::FreeListAdd(Block &aBlock)
+{
+    const uint16_t offset = BlockOffset(aBlock);
+    const uint8_t  index  = FreeListIndex(aBlock.GetSize());
+    uint16_t       prev   = 0;
+    uint16_t       next   = mFreeLists[index];
+
+    if (index == kLargeList)
+    {
+        while (BlockAt(next).GetSize() < aBlock.GetSize())
+        {
+            prev = next;
+            next = BlockAt(next).GetNext();
+        }
+    }
+
+    aBlock.SetPrev(prev);
+    aBlock.SetNext(next);
+    aBlock.SetFooter(offset);
+
+    if (prev == 0)
+    {
+        mFreeLists[index] = offset;
+    }
+    else
+    {
+        BlockAt(prev).SetNext(offset);
+    }
+
+    if (next != kGuardBlockOffset)
+    {
+        BlockAt(next).SetPrev(offset);
+    }
+}
+
+void Heap::FreeListRemove(Block &aBlock)
+{
+    const uint16_t prev = aBlock.GetPrev();
+    const uint16_t next = aBlock.GetNext();
+
+    if (prev == 0)
+    {
+        mFreeLists[FreeListIndex(aBlock.GetSize())] = next;
+    }
+    else
+    {
+        BlockAt(prev).SetNext(next);
+    }
+
+    if (next != kGuardBlockOffset)
+    {
+        BlockAt(next).SetPrev(prev);
+    }
+
+    aBlock.SetNext(0);
+}
+
+void Heap::Free(void *aPointer)
+{
+    if (aPointer == NULL)
+    {
+        return;
+    }
+
+    Block *block = &BlockOf(aPointer);
+    Block *right = &BlockRight(*block);
+
+    mMemory.mFreeSize += block->GetSize();
+
+    if (IsLeftFree(*block))
+    {
+        Block &left = BlockAt(block->GetLeftOffset());
+
+        FreeListRemove(left);
+        left.SetSize(left.GetSize() + block->GetSize() + sizeof(Block));
+        block = &left;
+
+        mMemory.mFreeSize += sizeof(Block);
+    }
+
+    if (right->IsFree())
+    {
+        FreeListRemove(*right);
+        block->SetSize(block->GetSize() + right->GetSize() + sizeof(Block));
+
+        mMemory.mFreeSize += sizeof(Block);
+    }
+
+    FreeListAdd(*block);
+}
+#else  // OPENTHREAD_CONFIG_HEAP_SEGREGATED_FIT
 void Heap::Free(void *aPointer)
 {
     if (aPointer == NULL)
@@ -214,6 +360,41 @@ void Heap::Free(void *aPointer)
         }
     }
 }
+#endif // OPENTHREAD_CONFIG_HEAP_SEGREGATED_FIT
+
+size_t Heap::GetLargestFreeBlockSize(void) const
+{
+    Heap & self    = *const_cast<Heap *>(this);
+    size_t largest = 0;
+
+    for (const Block *block = &self.BlockAt(kFirstBlockOffset); block->GetSize() != Block::kGuardBlockSize;
+         block              = &self.BlockRight(*block))
+    {
+        if (block->IsFree() && block->GetSize() > largest)
+        {
+            largest = block->GetSize();
+        }
+    }
+
+    return largest;
+}
+
+size_t Heap::GetFreeBlockCount(void) const
+{
+    Heap & self  = *const_cast<Heap *>(this);
+    size_t count = 0;
+
+    for (const Block *block = &self.BlockAt(kFirstBlockOffset); block->GetSize() != Block::kGuardBlockSize;
+         block              = &self.BlockRight(*block))
+    {
+        if (block->IsFree())
+        {
+            count++;
+        }
+    }
+
+    return count;
+}
 
 } // namespace Utils
 } // namespace ot
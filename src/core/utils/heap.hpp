@@ -58,6 +58,10 @@ namespace Utils {
  * Since block metadata is of 4-byte size, mSize and mNext are separated at the beginning
  * and end of the block to make sure the mMemory is aligned with long.
  *
+ * When `OPENTHREAD_CONFIG_HEAP_SEGREGATED_FIT` is enabled, a free block also uses the first two bytes of mMemory to
+ * hold the offset of the previous free block in its list, and the last two bytes of mMemory to hold its own offset so
+ * that the right neighbor block can locate it.
+ *
  */
 class Block
 {
@@ -142,6 +146,45 @@ public:
      */
     bool IsFree(void) const { return mSize != kGuardBlockSize && GetNext() != 0; }
 
+#if OPENTHREAD_CONFIG_HEAP_SEGREGATED_FIT
+    /**
+     * This method returns the offset of the free block before this block in its free block list.
+     *
+     * @returns Offset of the previous free block in bytes.
+     *
+     * @retval  0   This block is the head of its free block list.
+     *
+     */
+    uint16_t GetPrev(void) const { return *reinterpret_cast<const uint16_t *>(mMemory); }
+
+    /**
+     * This method updates the offset of the free block before this block in its free block list.
+     *
+     * @param[in]   aPrev   Offset of the previous free block in bytes, or 0 if this block is the list head.
+     *
+     */
+    void SetPrev(uint16_t aPrev) { *reinterpret_cast<uint16_t *>(mMemory) = aPrev; }
+
+    /**
+     * This method records the offset of this block at the end of its memory.
+     *
+     * @param[in]   aOffset   Offset of this block in bytes.
+     *
+     */
+    void SetFooter(uint16_t aOffset)
+    {
+        *reinterpret_cast<uint16_t *>(reinterpret_cast<uint8_t *>(this) + mSize) = aOffset;
+    }
+
+    /**
+     * This method returns the offset of the left neighbor block, which is only valid when that block is free.
+     *
+     * @returns Offset in bytes.
+     *
+     */
+    uint16_t GetLeftOffset(void) const { return *(&mSize - 2); }
+#endif // OPENTHREAD_CONFIG_HEAP_SEGREGATED_FIT
+
 private:
     enum
     {
@@ -163,6 +206,10 @@ private:
  *
  * This implementation is currently for mbedTLS.
  *
+ * By default, free blocks are kept in a single list sorted by size. When `OPENTHREAD_CONFIG_HEAP_SEGREGATED_FIT` is
+ * enabled, small free blocks are instead kept in exact-size lists so that they are allocated and freed in constant
+ * time, and only larger blocks share a size-sorted list. Adjacent free blocks are coalesced in both modes.
+ *
  * The memory is divided into blocks. The whole picture is as follows:
  *
  *     +--------------------------------------------------------------------------+
@@ -209,9 +256,8 @@ public:
     bool IsClean(void) const
     {
         Heap &       self  = *const_cast<Heap *>(this);
-        const Block &super = self.BlockSuper();
-        const Block &first = self.BlockRight(super);
-        return super.GetNext() == self.BlockOffset(first) && first.GetSize() == kFirstBlockSize;
+        const Block &first = self.BlockAt(kFirstBlockOffset);
+        return first.GetSize() == kFirstBlockSize && first.IsFree();
     }
 
     /**
@@ -225,6 +271,24 @@ public:
      */
     size_t GetFreeSize(void) const { return mMemory.mFreeSize; }
 
+    /**
+     * This method returns the size of the largest free block, i.e. the largest allocation that can currently succeed.
+     *
+     * @returns Size of the largest free block in bytes, or 0 if there is no free block.
+     *
+     */
+    size_t GetLargestFreeBlockSize(void) const;
+
+    /**
+     * This method returns the number of free blocks.
+     *
+     * Together with GetFreeSize() and GetLargestFreeBlockSize(), this indicates how fragmented the heap is.
+     *
+     * @returns Number of free blocks.
+     *
+     */
+    size_t GetFreeBlockCount(void) const;
+
 private:
     enum
     {
@@ -242,6 +306,16 @@ private:
         kGuardBlockOffset   = kMemorySize - sizeof(uint16_t),                     ///< Offset of the guard block.
     };
 
+#if OPENTHREAD_CONFIG_HEAP_SEGREGATED_FIT
+    enum
+    {
+        kNumSmallLists     = OPENTHREAD_CONFIG_HEAP_NUM_SMALL_SIZE_CLASSES,            ///< Number of exact-size lists.
+        kLargeList         = kNumSmallLists,                                          ///< Index of the sorted list.
+        kNumFreeLists      = kNumSmallLists + 1,                                      ///< Number of free lists.
+        kMaxSmallBlockSize = kBlockRemainderSize + kAlignSize * (kNumSmallLists - 1), ///< Largest small block size.
+    };
+#endif
+
     /**
      * This method returns the block at offset @p aOffset.
      *
@@ -335,6 +409,40 @@ private:
      */
     void BlockInsert(Block &aPrev, Block &aBlock);
 
+#if OPENTHREAD_CONFIG_HEAP_SEGREGATED_FIT
+    /**
+     * This method returns the index of the free block list holding blocks of size @p aSize.
+     *
+     * @param[in]   aSize   Block size in bytes.
+     *
+     * @returns Index of the free block list.
+     *
+     */
+    static uint8_t FreeListIndex(uint16_t aSize)
+    {
+        return (aSize <= kMaxSmallBlockSize) ? static_cast<uint8_t>((aSize - kBlockRemainderSize) / kAlignSize)
+                                             : static_cast<uint8_t>(kLargeList);
+    }
+
+    /**
+     * This method adds @p aBlock to the free block list matching its size.
+     *
+     * Small blocks are pushed at the head of their list, large blocks are kept sorted by size.
+     *
+     * @param[in]   aBlock  A reference to the block.
+     *
+     */
+    void FreeListAdd(Block &aBlock);
+
+    /**
+     * This method removes @p aBlock from its free block list and marks it as not free.
+     *
+     * @param[in]   aBlock  A reference to the block.
+     *
+     */
+    void FreeListRemove(Block &aBlock);
+#endif // OPENTHREAD_CONFIG_HEAP_SEGREGATED_FIT
+
     union
     {
         uint16_t mFreeSize;
@@ -343,6 +451,10 @@ private:
         uint8_t  m8[kMemorySize];
         uint16_t m16[kMemorySize / sizeof(uint16_t)];
     } mMemory;
+
+#if OPENTHREAD_CONFIG_HEAP_SEGREGATED_FIT
+    uint16_t mFreeLists[kNumFreeLists]; ///< Offsets of the first block in each free list.
+#endif
 };
 
 } // namespace Utils
@@ -49,7 +49,7 @@ JamDetector::JamDetector(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mHandler(NULL)
     , mContext(NULL)
-    , mNotifierCallback(HandleStateChanged, this)
+    , mNotifierCallback(HandleStateChanged, this, OT_CHANGED_THREAD_ROLE)
     , mTimer(aInstance, &JamDetector::HandleTimer, this)
     , mHistoryBitmap(0)
     , mCurSecondStartTime(0)
@@ -60,7 +60,15 @@ JamDetector::JamDetector(Instance &aInstance)
     , mAlwaysAboveThreshold(false)
     , mJamState(false)
     , mRssiThreshold(kDefaultRssiThreshold)
+#if OPENTHREAD_ENABLE_CHANNEL_MONITOR && OPENTHREAD_CONFIG_JAM_DETECTOR_CHANNEL_MONITOR
+    , mJammedChannelMask(0)
+#endif
 {
+#if OPENTHREAD_ENABLE_CHANNEL_MONITOR && OPENTHREAD_CONFIG_JAM_DETECTOR_CHANNEL_MONITOR
+    memset(mChannelHistory, 0, sizeof(mChannelHistory));
+    memset(mChannelSampleCount, 0, sizeof(mChannelSampleCount));
+#endif
+
     aInstance.GetNotifier().RegisterCallback(mNotifierCallback);
 }
 
@@ -75,6 +83,12 @@ otError JamDetector::Start(Handler aHandler, void *aContext)
     mContext = aContext;
     mEnabled = true;
 
+#if OPENTHREAD_ENABLE_CHANNEL_MONITOR && OPENTHREAD_CONFIG_JAM_DETECTOR_CHANNEL_MONITOR
+    memset(mChannelHistory, 0, sizeof(mChannelHistory));
+    memset(mChannelSampleCount, 0, sizeof(mChannelSampleCount));
+    mJammedChannelMask = 0;
+#endif
+
     otLogInfoUtil("JamDetector - Started");
 
     CheckState();
@@ -276,6 +290,51 @@ void JamDetector::SetJamState(bool aNewState)
     }
 }
 
+#if OPENTHREAD_ENABLE_CHANNEL_MONITOR && OPENTHREAD_CONFIG_JAM_DETECTOR_CHANNEL_MONITOR
+void JamDetector::HandleChannelMonitorSample(uint8_t aChannel, int8_t aRssi)
+{
+    uint8_t  index = aChannel - OT_RADIO_CHANNEL_MIN;
+    uint16_t bitmap;
+    uint8_t  numBusySamples = 0;
+    bool     isJammed;
+
+    VerifyOrExit(mEnabled && (aRssi != OT_RADIO_RSSI_INVALID));
+    VerifyOrExit((OT_RADIO_CHANNEL_MIN <= aChannel) && (aChannel <= OT_RADIO_CHANNEL_MAX));
+
+    mChannelHistory[index] = static_cast<uint16_t>((mChannelHistory[index] << 1) | (aRssi >= mRssiThreshold ? 1 : 0));
+
+    if (mChannelSampleCount[index] < kChannelHistoryLength)
+    {
+        mChannelSampleCount[index]++;
+    }
+
+    for (bitmap = mChannelHistory[index]; bitmap != 0; bitmap &= (bitmap - 1))
+    {
+        numBusySamples++;
+    }
+
+    // Same busy ratio as the current channel detection: `mBusyPeriod` out of `mWindow`.
+    isJammed = (mChannelSampleCount[index] >= kMinChannelSamples) &&
+               (numBusySamples * mWindow >= mBusyPeriod * mChannelSampleCount[index]);
+
+    VerifyOrExit(isJammed != ((mJammedChannelMask & (1UL << aChannel)) != 0));
+
+    if (isJammed)
+    {
+        mJammedChannelMask |= (1UL << aChannel);
+    }
+    else
+    {
+        mJammedChannelMask &= ~(1UL << aChannel);
+    }
+
+    otLogInfoUtil("JamDetector - channel %d jamming %s", aChannel, isJammed ? "detected" : "cleared");
+
+exit:
+    return;
+}
+#endif // OPENTHREAD_ENABLE_CHANNEL_MONITOR && OPENTHREAD_CONFIG_JAM_DETECTOR_CHANNEL_MONITOR
+
 void JamDetector::HandleStateChanged(Notifier::Callback &aCallback, otChangedFlags aFlags)
 {
     aCallback.GetOwner<JamDetector>().HandleStateChanged(aFlags);
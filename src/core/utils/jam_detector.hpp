@@ -36,6 +36,8 @@
 
 #include "openthread-core-config.h"
 
+#include <openthread/platform/radio.h>
+
 #include "common/locator.hpp"
 #include "common/notifier.hpp"
 #include "common/timer.hpp"
@@ -173,6 +175,32 @@ public:
      */
     uint64_t GetHistoryBitmap(void) const { return mHistoryBitmap; }
 
+    /**
+     * This method returns the mask of channels currently considered jammed based on the Channel Monitor samples.
+     *
+     * @returns The jammed channel mask, always zero if `OPENTHREAD_CONFIG_JAM_DETECTOR_CHANNEL_MONITOR` is disabled.
+     *
+     */
+    uint32_t GetJammedChannelMask(void) const
+    {
+#if OPENTHREAD_ENABLE_CHANNEL_MONITOR && OPENTHREAD_CONFIG_JAM_DETECTOR_CHANNEL_MONITOR
+        return mJammedChannelMask;
+#else
+        return 0;
+#endif
+    }
+
+#if OPENTHREAD_ENABLE_CHANNEL_MONITOR && OPENTHREAD_CONFIG_JAM_DETECTOR_CHANNEL_MONITOR
+    /**
+     * This method processes an RSSI sample collected by the Channel Monitor.
+     *
+     * @param[in]  aChannel  The channel of the sample.
+     * @param[in]  aRssi     The RSSI sample (dBm).
+     *
+     */
+    void HandleChannelMonitorSample(uint8_t aChannel, int8_t aRssi);
+#endif
+
 private:
     enum
     {
@@ -185,6 +213,15 @@ private:
         kOneSecondInterval = 1000 // in ms
     };
 
+#if OPENTHREAD_ENABLE_CHANNEL_MONITOR && OPENTHREAD_CONFIG_JAM_DETECTOR_CHANNEL_MONITOR
+    enum
+    {
+        kNumChannels          = (OT_RADIO_CHANNEL_MAX - OT_RADIO_CHANNEL_MIN + 1),
+        kChannelHistoryLength = 16, // Number of Channel Monitor samples tracked per channel
+        kMinChannelSamples    = 4,  // Minimum number of samples before a channel can be considered jammed
+    };
+#endif
+
     void        CheckState(void);
     void        SetJamState(bool aNewState);
     static void HandleTimer(Timer &aTimer);
@@ -207,6 +244,12 @@ private:
     bool               mAlwaysAboveThreshold : 1; // State for current 1 sec interval
     bool               mJamState : 1;             // Current jam state
     int8_t             mRssiThreshold;            // RSSI threshold for jam detection
+
+#if OPENTHREAD_ENABLE_CHANNEL_MONITOR && OPENTHREAD_CONFIG_JAM_DETECTOR_CHANNEL_MONITOR
+    uint16_t mChannelHistory[kNumChannels];     // Per channel samples, bit 0 for the latest (1 if above threshold)
+    uint8_t  mChannelSampleCount[kNumChannels]; // Per channel number of samples in `mChannelHistory`
+    uint32_t mJammedChannelMask;                // Channels currently considered jammed
+#endif
 };
 
 /**
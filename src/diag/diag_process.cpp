@@ -33,6 +33,7 @@
 
 #include "diag_process.hpp"
 
+#include <stdarg.h>
 #include <stdio.h>
 #include <stdlib.h>
 
@@ -46,10 +47,14 @@ namespace Diagnostics {
 
 const struct Diag::Command Diag::sCommands[] = {
     {"start", &ProcessStart}, {"stop", &ProcessStop},     {"channel", &ProcessChannel}, {"power", &ProcessPower},
-    {"send", &ProcessSend},   {"repeat", &ProcessRepeat}, {"stats", &ProcessStats},     {NULL, NULL},
+    {"send", &ProcessSend},   {"repeat", &ProcessRepeat}, {"stats", &ProcessStats},     {"per", &ProcessPer},
+    {NULL, NULL},
 };
 
+const uint8_t Diag::sPerMagic[] = {'P', 'E', 'R'};
+
 struct Diag::DiagStats Diag::sStats;
+struct Diag::PerStats  Diag::sPerStats;
 
 int8_t        Diag::sTxPower;
 uint8_t       Diag::sChannel;
@@ -58,6 +63,11 @@ uint32_t      Diag::sTxPeriod;
 uint32_t      Diag::sTxPackets;
 otRadioFrame *Diag::sTxPacket;
 bool          Diag::sRepeatActive;
+uint32_t      Diag::sPerTxRemaining;
+uint32_t      Diag::sPerTxSequence;
+uint32_t      Diag::sPerTxInterval;
+uint32_t      Diag::sPerSentPackets;
+bool          Diag::sPerTxActive;
 otInstance *  Diag::sInstance;
 
 void Diag::Init(otInstance *aInstance)
@@ -71,6 +81,11 @@ void Diag::Init(otInstance *aInstance)
     sRepeatActive = false;
     memset(&sStats, 0, sizeof(struct DiagStats));
 
+    sPerTxRemaining = 0;
+    sPerSentPackets = 0;
+    sPerTxActive    = false;
+    ResetPerStats();
+
     sTxPacket = otPlatRadioGetTransmitBuffer(sInstance);
     otPlatDiagChannelSet(sChannel);
     otPlatDiagTxPowerSet(sTxPower);
@@ -126,6 +141,8 @@ void Diag::ProcessStart(int aArgCount, char *aArgVector[], char *aOutput, size_t
     SuccessOrExit(error = otPlatRadioReceive(sInstance, sChannel));
     otPlatDiagModeSet(true);
     memset(&sStats, 0, sizeof(struct DiagStats));
+    ResetPerStats();
+    sPerSentPackets = 0;
     snprintf(aOutput, aOutputMaxLen, "start diagnostics mode\r\nstatus 0x%02x\r\n", error);
 
 exit:
@@ -143,6 +160,7 @@ void Diag::ProcessStop(int aArgCount, char *aArgVector[], char *aOutput, size_t
 
     otPlatAlarmMilliStop(sInstance);
     otPlatDiagModeSet(false);
+    sPerTxRemaining = 0;
     otPlatRadioSetPromiscuous(sInstance, false);
 
     snprintf(aOutput, aOutputMaxLen,
@@ -307,10 +325,245 @@ exit:
     AppendErrorResult(error, aOutput, aOutputMaxLen);
 }
 
+void Diag::ProcessPer(int aArgCount, char *aArgVector[], char *aOutput, size_t aOutputMaxLen)
+{
+    otError error = OT_ERROR_NONE;
+
+    VerifyOrExit(otPlatDiagModeGet(), error = OT_ERROR_INVALID_STATE);
+
+    if (aArgCount == 0)
+    {
+        OutputPerStats(aOutput, aOutputMaxLen);
+    }
+    else if (strcmp(aArgVector[0], "send") == 0)
+    {
+        long count;
+        long length;
+        long interval = 0;
+
+        VerifyOrExit(aArgCount == 3 || aArgCount == 4, error = OT_ERROR_INVALID_ARGS);
+        VerifyOrExit(sPerTxRemaining == 0 && !sRepeatActive, error = OT_ERROR_BUSY);
+
+        SuccessOrExit(error = ParseLong(aArgVector[1], count));
+        VerifyOrExit(count > 0, error = OT_ERROR_INVALID_ARGS);
+
+        SuccessOrExit(error = ParseLong(aArgVector[2], length));
+        VerifyOrExit(length >= kPerMinFrameLength && length <= OT_RADIO_FRAME_MAX_SIZE, error = OT_ERROR_INVALID_ARGS);
+
+        if (aArgCount == 4)
+        {
+            SuccessOrExit(error = ParseLong(aArgVector[3], interval));
+            VerifyOrExit(interval >= 0, error = OT_ERROR_INVALID_ARGS);
+        }
+
+        sTxLen          = static_cast<uint8_t>(length);
+        sPerTxInterval  = static_cast<uint32_t>(interval);
+        sPerTxRemaining = static_cast<uint32_t>(count);
+        sPerTxSequence  = 0;
+        sPerSentPackets = 0;
+
+        snprintf(aOutput, aOutputMaxLen, "sending %lu PER packet(s), length %d, interval %lu ms\r\nstatus 0x%02x\r\n",
+                 static_cast<unsigned long>(sPerTxRemaining), static_cast<int>(sTxLen),
+                 static_cast<unsigned long>(sPerTxInterval), error);
+
+        if (!sPerTxActive)
+        {
+            TxPerPacket();
+        }
+    }
+    else if (strcmp(aArgVector[0], "stop") == 0)
+    {
+        otPlatAlarmMilliStop(sInstance);
+        sPerTxRemaining = 0;
+        snprintf(aOutput, aOutputMaxLen, "PER transmission is stopped\r\nstatus 0x%02x\r\n", error);
+    }
+    else if (strcmp(aArgVector[0], "clear") == 0)
+    {
+        ResetPerStats();
+        sPerSentPackets = 0;
+        snprintf(aOutput, aOutputMaxLen, "PER statistics are cleared\r\nstatus 0x%02x\r\n", error);
+    }
+    else
+    {
+        error = OT_ERROR_INVALID_ARGS;
+    }
+
+exit:
+    AppendErrorResult(error, aOutput, aOutputMaxLen);
+}
+
+void Diag::TxPerPacket(void)
+{
+    sTxPacket->mLength  = sTxLen;
+    sTxPacket->mChannel = sChannel;
+
+    // A PER frame starts with the magic and the little-endian sequence number, followed by the same filler bytes
+    // as the frames of `diag send`.
+
+    memcpy(sTxPacket->mPsdu, sPerMagic, sizeof(sPerMagic));
+
+    for (uint8_t i = 0; i < sizeof(sPerTxSequence); i++)
+    {
+        sTxPacket->mPsdu[sizeof(sPerMagic) + i] = static_cast<uint8_t>(sPerTxSequence >> (8 * i));
+    }
+
+    for (uint8_t i = kPerHeaderLength; i < sTxLen; i++)
+    {
+        sTxPacket->mPsdu[i] = i;
+    }
+
+    sPerTxActive = true;
+    otPlatRadioTransmit(sInstance, sTxPacket);
+}
+
+void Diag::HandlePerTransmitDone(otError aError)
+{
+    VerifyOrExit(sPerTxRemaining > 0);
+
+    // A failed transmission is retried with the same sequence number.
+    if (aError == OT_ERROR_NONE)
+    {
+        sPerSentPackets++;
+        sPerTxSequence++;
+        sPerTxRemaining--;
+    }
+
+    VerifyOrExit(sPerTxRemaining > 0);
+
+    if (sPerTxInterval == 0)
+    {
+        TxPerPacket();
+    }
+    else
+    {
+        otPlatAlarmMilliStartAt(sInstance, otPlatAlarmMilliGetNow(), sPerTxInterval);
+    }
+
+exit:
+    return;
+}
+
+void Diag::HandlePerReceiveDone(const otRadioFrame &aFrame)
+{
+    int8_t   rssi     = aFrame.mInfo.mRxInfo.mRssi;
+    uint8_t  lqi      = aFrame.mInfo.mRxInfo.mLqi;
+    uint32_t sequence = 0;
+    uint8_t  bucket;
+
+    VerifyOrExit(aFrame.mLength >= kPerMinFrameLength);
+    VerifyOrExit(memcmp(aFrame.mPsdu, sPerMagic, sizeof(sPerMagic)) == 0);
+
+    for (uint8_t i = kPerHeaderLength; i > sizeof(sPerMagic); i--)
+    {
+        sequence = (sequence << 8) | aFrame.mPsdu[i - 1];
+    }
+
+    if (sequence >= sPerStats.mExpectedPackets)
+    {
+        sPerStats.mExpectedPackets = sequence + 1;
+    }
+
+    if (sPerStats.mReceivedPackets == 0 || rssi < sPerStats.mRssiMin)
+    {
+        sPerStats.mRssiMin = rssi;
+    }
+
+    if (sPerStats.mReceivedPackets == 0 || rssi > sPerStats.mRssiMax)
+    {
+        sPerStats.mRssiMax = rssi;
+    }
+
+    if (sPerStats.mReceivedPackets == 0 || lqi < sPerStats.mLqiMin)
+    {
+        sPerStats.mLqiMin = lqi;
+    }
+
+    if (sPerStats.mReceivedPackets == 0 || lqi > sPerStats.mLqiMax)
+    {
+        sPerStats.mLqiMax = lqi;
+    }
+
+    sPerStats.mReceivedPackets++;
+    sPerStats.mRssiSum += rssi;
+    sPerStats.mLqiSum += lqi;
+
+    bucket = (rssi < -100) ? 0 : static_cast<uint8_t>((rssi + 100) / 10);
+    sPerStats.mRssiHistogram[(bucket < kPerRssiBuckets) ? bucket : kPerRssiBuckets - 1]++;
+    sPerStats.mLqiHistogram[lqi / (256 / kPerLqiBuckets)]++;
+
+exit:
+    return;
+}
+
+void Diag::ResetPerStats(void)
+{
+    memset(&sPerStats, 0, sizeof(struct PerStats));
+}
+
+void Diag::OutputPerStats(char *aOutput, size_t aOutputMaxLen)
+{
+    uint32_t received = sPerStats.mReceivedPackets;
+    uint32_t expected = sPerStats.mExpectedPackets;
+    uint32_t lost     = (expected > received) ? (expected - received) : 0;
+    uint32_t rate     = 0; // In units of 0.01%.
+
+    if (expected > 0)
+    {
+        rate = static_cast<uint32_t>((static_cast<uint64_t>(lost) * 10000) / expected);
+    }
+
+    snprintf(aOutput, aOutputMaxLen, "sent packets: %lu\r\nreceived packets: %lu, lost: %lu, per: %lu.%02lu%%\r\n",
+             static_cast<unsigned long>(sPerSentPackets), static_cast<unsigned long>(received),
+             static_cast<unsigned long>(lost), static_cast<unsigned long>(rate / 100),
+             static_cast<unsigned long>(rate % 100));
+
+    VerifyOrExit(received > 0);
+
+    AppendOutput(aOutput, aOutputMaxLen, "rssi: min=%d, avg=%d, max=%d, histogram=", sPerStats.mRssiMin,
+                 static_cast<int>(sPerStats.mRssiSum / static_cast<int32_t>(received)), sPerStats.mRssiMax);
+
+    for (uint8_t i = 0; i < kPerRssiBuckets; i++)
+    {
+        AppendOutput(aOutput, aOutputMaxLen, (i == 0) ? "%lu" : "/%lu",
+                     static_cast<unsigned long>(sPerStats.mRssiHistogram[i]));
+    }
+
+    AppendOutput(aOutput, aOutputMaxLen, "\r\nlqi: min=%d, avg=%d, max=%d, histogram=", sPerStats.mLqiMin,
+                 static_cast<int>(sPerStats.mLqiSum / received), sPerStats.mLqiMax);
+
+    for (uint8_t i = 0; i < kPerLqiBuckets; i++)
+    {
+        AppendOutput(aOutput, aOutputMaxLen, (i == 0) ? "%lu" : "/%lu",
+                     static_cast<unsigned long>(sPerStats.mLqiHistogram[i]));
+    }
+
+    AppendOutput(aOutput, aOutputMaxLen, "\r\n");
+
+exit:
+    return;
+}
+
+void Diag::AppendOutput(char *aOutput, size_t aOutputMaxLen, const char *aFormat, ...)
+{
+    size_t  length = strlen(aOutput);
+    va_list args;
+
+    va_start(args, aFormat);
+    vsnprintf(aOutput + length, aOutputMaxLen - length, aFormat, args);
+    va_end(args);
+}
+
 void Diag::DiagTransmitDone(otInstance *aInstance, otError aError)
 {
     VerifyOrExit(aInstance == sInstance);
 
+    if (sPerTxActive)
+    {
+        sPerTxActive = false;
+        HandlePerTransmitDone(aError);
+        ExitNow();
+    }
+
     if (aError == OT_ERROR_NONE)
     {
         sStats.mSentPackets++;
@@ -344,6 +597,8 @@ void Diag::DiagReceiveDone(otInstance *aInstance, otRadioFrame *aFrame, otError
         }
 
         sStats.mReceivedPackets++;
+
+        HandlePerReceiveDone(*aFrame);
     }
     otPlatDiagRadioReceived(aInstance, aFrame, aError);
 
@@ -362,6 +617,10 @@ void Diag::AlarmFired(otInstance *aInstance)
         TxPacket();
         otPlatAlarmMilliStartAt(aInstance, now, sTxPeriod);
     }
+    else if (sPerTxRemaining > 0)
+    {
+        TxPerPacket();
+    }
     else
     {
         otPlatDiagAlarmCallback(aInstance);
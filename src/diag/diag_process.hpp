@@ -66,6 +66,28 @@ private:
         uint8_t  mFirstLqi;
     };
 
+    enum
+    {
+        kPerHeaderLength   = 7, ///< PER frame magic (3 bytes) and sequence number (4 bytes).
+        kPerRssiBuckets    = 8, ///< 10 dB wide, the first one is below -90 dBm and the last one -30 dBm and above.
+        kPerLqiBuckets     = 4, ///< 64 wide.
+        kPerMinFrameLength = kPerHeaderLength + 2,
+    };
+
+    struct PerStats
+    {
+        uint32_t mReceivedPackets;
+        uint32_t mExpectedPackets; ///< Highest received sequence number plus one.
+        int32_t  mRssiSum;
+        uint32_t mLqiSum;
+        int8_t   mRssiMin;
+        int8_t   mRssiMax;
+        uint8_t  mLqiMin;
+        uint8_t  mLqiMax;
+        uint32_t mRssiHistogram[kPerRssiBuckets];
+        uint32_t mLqiHistogram[kPerLqiBuckets];
+    };
+
     struct Command
     {
         const char *mName;
@@ -80,12 +102,21 @@ private:
     static void ProcessStats(int aArgCount, char *aArgVector[], char *aOutput, size_t aOutputMaxLen);
     static void ProcessChannel(int aArgCount, char *aArgVector[], char *aOutput, size_t aOutputMaxLen);
     static void ProcessPower(int aArgCount, char *aArgVector[], char *aOutput, size_t aOutputMaxLen);
+    static void ProcessPer(int aArgCount, char *aArgVector[], char *aOutput, size_t aOutputMaxLen);
     static void TxPacket(void);
+    static void TxPerPacket(void);
+    static void HandlePerTransmitDone(otError aError);
+    static void HandlePerReceiveDone(const otRadioFrame &aFrame);
+    static void ResetPerStats(void);
+    static void OutputPerStats(char *aOutput, size_t aOutputMaxLen);
+    static void AppendOutput(char *aOutput, size_t aOutputMaxLen, const char *aFormat, ...);
 
     static otError ParseLong(char *aString, long &aLong);
 
     static const struct Command sCommands[];
     static struct DiagStats     sStats;
+    static struct PerStats      sPerStats;
+    static const uint8_t        sPerMagic[];
 
     static int8_t        sTxPower;
     static uint8_t       sChannel;
@@ -95,6 +126,11 @@ private:
     static otRadioFrame *sTxPacket;
     static otInstance *  sInstance;
     static bool          sRepeatActive;
+    static uint32_t      sPerTxRemaining;
+    static uint32_t      sPerTxSequence;
+    static uint32_t      sPerTxInterval;
+    static uint32_t      sPerSentPackets;
+    static bool          sPerTxActive;
 };
 
 } // namespace Diagnostics
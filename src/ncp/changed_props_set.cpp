@@ -44,53 +44,60 @@ namespace Ncp {
 // Since a `uint64_t` is used as bit-mask to track which entries are in the changed set, we should ensure that the
 // number of entries in the list is always less than or equal to 64.
 //
+// Rate-limited entries are properties which may change in rapid bursts (e.g., tables which are updated one entry at a
+// time). When `OPENTHREAD_CONFIG_NCP_CHANGED_PROPS_MIN_INTERVAL` is non-zero, their updates are coalesced.
+//
 const ChangedPropsSet::Entry ChangedPropsSet::mSupportedProps[] = {
-    // Spinel property , Status (if prop is `LAST_STATUS`),  IsFilterable?
-
-    {SPINEL_PROP_LAST_STATUS, SPINEL_STATUS_RESET_UNKNOWN, false},    // 0
-    {SPINEL_PROP_STREAM_DEBUG, SPINEL_STATUS_OK, true},               // 1
-    {SPINEL_PROP_IPV6_ADDRESS_TABLE, SPINEL_STATUS_OK, true},         // 2
-    {SPINEL_PROP_NET_ROLE, SPINEL_STATUS_OK, true},                   // 3
-    {SPINEL_PROP_IPV6_LL_ADDR, SPINEL_STATUS_OK, true},               // 4
-    {SPINEL_PROP_IPV6_ML_ADDR, SPINEL_STATUS_OK, true},               // 5
-    {SPINEL_PROP_NET_PARTITION_ID, SPINEL_STATUS_OK, true},           // 6
-    {SPINEL_PROP_NET_KEY_SEQUENCE_COUNTER, SPINEL_STATUS_OK, true},   // 7
-    {SPINEL_PROP_THREAD_LEADER_NETWORK_DATA, SPINEL_STATUS_OK, true}, // 8
-    {SPINEL_PROP_THREAD_CHILD_TABLE, SPINEL_STATUS_OK, true},         // 9
-    {SPINEL_PROP_THREAD_ON_MESH_NETS, SPINEL_STATUS_OK, true},        // 10
-    {SPINEL_PROP_THREAD_OFF_MESH_ROUTES, SPINEL_STATUS_OK, true},     // 11
-    {SPINEL_PROP_NET_STACK_UP, SPINEL_STATUS_OK, true},               // 12
-    {SPINEL_PROP_NET_REQUIRE_JOIN_EXISTING, SPINEL_STATUS_OK, true},  // 13
-    {SPINEL_PROP_LAST_STATUS, SPINEL_STATUS_NOMEM, true},             // 14
-    {SPINEL_PROP_LAST_STATUS, SPINEL_STATUS_DROPPED, true},           // 15
+    // Spinel property , Status (if prop is `LAST_STATUS`),  IsFilterable?, IsRateLimited?
+
+    {SPINEL_PROP_LAST_STATUS, SPINEL_STATUS_RESET_UNKNOWN, false, false},   // 0
+    {SPINEL_PROP_STREAM_DEBUG, SPINEL_STATUS_OK, true, false},              // 1
+    {SPINEL_PROP_IPV6_ADDRESS_TABLE, SPINEL_STATUS_OK, true, true},         // 2
+    {SPINEL_PROP_NET_ROLE, SPINEL_STATUS_OK, true, false},                  // 3
+    {SPINEL_PROP_IPV6_LL_ADDR, SPINEL_STATUS_OK, true, false},              // 4
+    {SPINEL_PROP_IPV6_ML_ADDR, SPINEL_STATUS_OK, true, false},              // 5
+    {SPINEL_PROP_NET_PARTITION_ID, SPINEL_STATUS_OK, true, false},          // 6
+    {SPINEL_PROP_NET_KEY_SEQUENCE_COUNTER, SPINEL_STATUS_OK, true, false},  // 7
+    {SPINEL_PROP_THREAD_LEADER_NETWORK_DATA, SPINEL_STATUS_OK, true, true}, // 8
+    {SPINEL_PROP_THREAD_CHILD_TABLE, SPINEL_STATUS_OK, true, true},         // 9
+    {SPINEL_PROP_THREAD_ON_MESH_NETS, SPINEL_STATUS_OK, true, true},        // 10
+    {SPINEL_PROP_THREAD_OFF_MESH_ROUTES, SPINEL_STATUS_OK, true, true},     // 11
+    {SPINEL_PROP_NET_STACK_UP, SPINEL_STATUS_OK, true, false},              // 12
+    {SPINEL_PROP_NET_REQUIRE_JOIN_EXISTING, SPINEL_STATUS_OK, true, false}, // 13
+    {SPINEL_PROP_LAST_STATUS, SPINEL_STATUS_NOMEM, true, false},            // 14
+    {SPINEL_PROP_LAST_STATUS, SPINEL_STATUS_DROPPED, true, false},          // 15
 #if OPENTHREAD_ENABLE_JAM_DETECTION
-    {SPINEL_PROP_JAM_DETECTED, SPINEL_STATUS_OK, true}, // 16
+    {SPINEL_PROP_JAM_DETECTED, SPINEL_STATUS_OK, true, false}, // 16
 #endif
 #if OPENTHREAD_ENABLE_LEGACY
-    {SPINEL_PROP_NEST_LEGACY_ULA_PREFIX, SPINEL_STATUS_OK, true},       // 17
-    {SPINEL_PROP_NEST_LEGACY_LAST_NODE_JOINED, SPINEL_STATUS_OK, true}, // 18
+    {SPINEL_PROP_NEST_LEGACY_ULA_PREFIX, SPINEL_STATUS_OK, true, false},       // 17
+    {SPINEL_PROP_NEST_LEGACY_LAST_NODE_JOINED, SPINEL_STATUS_OK, true, false}, // 18
 #endif
-    {SPINEL_PROP_LAST_STATUS, SPINEL_STATUS_JOIN_FAILURE, false},       // 19
-    {SPINEL_PROP_MAC_SCAN_STATE, SPINEL_STATUS_OK, false},              // 20
-    {SPINEL_PROP_IPV6_MULTICAST_ADDRESS_TABLE, SPINEL_STATUS_OK, true}, // 21
-    {SPINEL_PROP_PHY_CHAN, SPINEL_STATUS_OK, true},                     // 22
-    {SPINEL_PROP_MAC_15_4_PANID, SPINEL_STATUS_OK, true},               // 23
-    {SPINEL_PROP_NET_NETWORK_NAME, SPINEL_STATUS_OK, true},             // 24
-    {SPINEL_PROP_NET_XPANID, SPINEL_STATUS_OK, true},                   // 25
-    {SPINEL_PROP_NET_MASTER_KEY, SPINEL_STATUS_OK, true},               // 26
-    {SPINEL_PROP_NET_PSKC, SPINEL_STATUS_OK, true},                     // 27
-    {SPINEL_PROP_PHY_CHAN_SUPPORTED, SPINEL_STATUS_OK, true},           // 28
+    {SPINEL_PROP_LAST_STATUS, SPINEL_STATUS_JOIN_FAILURE, false, false},      // 19
+    {SPINEL_PROP_MAC_SCAN_STATE, SPINEL_STATUS_OK, false, false},             // 20
+    {SPINEL_PROP_IPV6_MULTICAST_ADDRESS_TABLE, SPINEL_STATUS_OK, true, true}, // 21
+    {SPINEL_PROP_PHY_CHAN, SPINEL_STATUS_OK, true, false},                    // 22
+    {SPINEL_PROP_MAC_15_4_PANID, SPINEL_STATUS_OK, true, false},              // 23
+    {SPINEL_PROP_NET_NETWORK_NAME, SPINEL_STATUS_OK, true, false},            // 24
+    {SPINEL_PROP_NET_XPANID, SPINEL_STATUS_OK, true, false},                  // 25
+    {SPINEL_PROP_NET_MASTER_KEY, SPINEL_STATUS_OK, true, false},              // 26
+    {SPINEL_PROP_NET_PSKC, SPINEL_STATUS_OK, true, false},                    // 27
+    {SPINEL_PROP_PHY_CHAN_SUPPORTED, SPINEL_STATUS_OK, true, false},          // 28
 #if OPENTHREAD_ENABLE_CHANNEL_MANAGER
-    {SPINEL_PROP_CHANNEL_MANAGER_NEW_CHANNEL, SPINEL_STATUS_OK, true}, // 29
+    {SPINEL_PROP_CHANNEL_MANAGER_NEW_CHANNEL, SPINEL_STATUS_OK, true, false}, // 29
 #endif
 #if OPENTHREAD_ENABLE_JOINER
-    {SPINEL_PROP_LAST_STATUS, SPINEL_STATUS_JOIN_NO_PEERS, false},    // 30
-    {SPINEL_PROP_LAST_STATUS, SPINEL_STATUS_JOIN_SECURITY, false},    // 31
-    {SPINEL_PROP_LAST_STATUS, SPINEL_STATUS_JOIN_RSP_TIMEOUT, false}, // 32
-    {SPINEL_PROP_LAST_STATUS, SPINEL_STATUS_JOIN_SUCCESS, false},     // 33
+    {SPINEL_PROP_LAST_STATUS, SPINEL_STATUS_JOIN_NO_PEERS, false, false},    // 30
+    {SPINEL_PROP_LAST_STATUS, SPINEL_STATUS_JOIN_SECURITY, false, false},    // 31
+    {SPINEL_PROP_LAST_STATUS, SPINEL_STATUS_JOIN_RSP_TIMEOUT, false, false}, // 32
+    {SPINEL_PROP_LAST_STATUS, SPINEL_STATUS_JOIN_SUCCESS, false, false},     // 33
 #endif
 #if OPENTHREAD_CONFIG_ENABLE_TIME_SYNC
-    {SPINEL_PROP_THREAD_NETWORK_TIME, SPINEL_STATUS_OK, false}, // 34
+    {SPINEL_PROP_THREAD_NETWORK_TIME, SPINEL_STATUS_OK, false, false}, // 34
+#endif
+    {SPINEL_PROP_STREAM_NET_TX_CREDITS, SPINEL_STATUS_OK, true, true}, // 35
+#if OPENTHREAD_CONFIG_NCP_BUFFER_COUNTERS_STREAM_INTERVAL
+    {SPINEL_PROP_MSG_BUFFER_COUNTERS, SPINEL_STATUS_OK, true, false}, // 36
 #endif
 };
 
@@ -183,5 +190,27 @@ bool ChangedPropsSet::IsPropertyFiltered(spinel_prop_key_t aPropKey) const
     return isFiltered;
 }
 
+bool ChangedPropsSet::HoldOffEntry(uint8_t aIndex)
+{
+    bool         didHoldOff = false;
+    const Entry *entry      = GetEntry(aIndex);
+
+    VerifyOrExit((entry != NULL) && entry->mRateLimited);
+
+    SetBit(mRecentSet, aIndex);
+    didHoldOff = true;
+
+exit:
+    return didHoldOff;
+}
+
+bool ChangedPropsSet::AdvanceHoldOff(void)
+{
+    mAgingSet  = mRecentSet;
+    mRecentSet = 0;
+
+    return (mAgingSet != 0);
+}
+
 } // namespace Ncp
 } // namespace ot
@@ -59,9 +59,10 @@ public:
      */
     struct Entry
     {
-        spinel_prop_key_t mPropKey;    ///< The spinel property key.
-        spinel_status_t   mStatus;     ///< The spinel status (used only if prop key is `LAST_STATUS`).
-        bool              mFilterable; ///< Indicates whether the entry can be filtered
+        spinel_prop_key_t mPropKey;     ///< The spinel property key.
+        spinel_status_t   mStatus;      ///< The spinel status (used only if prop key is `LAST_STATUS`).
+        bool              mFilterable;  ///< Indicates whether the entry can be filtered
+        bool              mRateLimited; ///< Indicates whether unsolicited updates of the entry are rate-limited
     };
 
     /**
@@ -71,6 +72,8 @@ public:
     ChangedPropsSet(void)
         : mChangedSet(0)
         , mFilterSet(0)
+        , mRecentSet(0)
+        , mAgingSet(0)
     {
     }
 
@@ -192,6 +195,38 @@ public:
      */
     void ClearFilter(void) { mFilterSet = 0; }
 
+    /**
+     * This method marks an entry associated with an index as just updated, starting its hold-off period if the entry
+     * is rate-limited. A held-off entry stays in the set (if changed again) until its hold-off period ends.
+     *
+     * @param[in] aIndex               Index of entry which was updated.
+     *
+     * @returns TRUE if the entry is rate-limited and was put in hold-off, FALSE otherwise.
+     *
+     */
+    bool HoldOffEntry(uint8_t aIndex);
+
+    /**
+     * This method determines whether an entry associated with an index is in its hold-off period.
+     *
+     * @param[in] aIndex               Index of entry to be checked.
+     *
+     * @returns TRUE if the entry is held off, FALSE otherwise.
+     *
+     */
+    bool IsEntryHeldOff(uint8_t aIndex) const { return IsBitSet(mRecentSet | mAgingSet, aIndex); }
+
+    /**
+     * This method advances the hold-off periods by one interval.
+     *
+     * Entries held off for two consecutive calls are released, so every entry is held off for at least one full
+     * interval between two calls.
+     *
+     * @returns TRUE if there are still entries in hold-off, FALSE otherwise.
+     *
+     */
+    bool AdvanceHoldOff(void);
+
 private:
     uint8_t GetNumEntries(void) const;
     void    Add(spinel_prop_key_t aPropKey, spinel_status_t aStatus);
@@ -204,6 +239,8 @@ private:
 
     uint64_t mChangedSet;
     uint64_t mFilterSet;
+    uint64_t mRecentSet; // Rate-limited entries updated during the current hold-off interval.
+    uint64_t mAgingSet;  // Rate-limited entries updated during the previous hold-off interval.
 };
 
 } // namespace Ncp
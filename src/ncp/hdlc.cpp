@@ -178,23 +178,42 @@ exit:
 
 otError Encoder::Encode(const uint8_t *aInBuf, uint16_t aInLength, BufferWriteIterator &aIterator)
 {
-    otError             error = OT_ERROR_NONE;
-    BufferWriteIterator oldIterator(aIterator);
-    uint16_t            oldFcs = mFcs;
-
-    for (int i = 0; i < aInLength; i++)
+    otError        error     = OT_ERROR_NONE;
+    uint8_t *      writePtr  = aIterator.mWritePointer;
+    uint16_t       remaining = aIterator.mRemainingLength;
+    uint16_t       fcs       = mFcs;
+    const uint8_t *end       = aInBuf + aInLength;
+
+    // Escape the bytes and update the FCS in a single pass over the input. The iterator and the FCS are updated only
+    // once the entire input is encoded, so they remain unchanged on failure.
+    for (; aInBuf < end; aInBuf++)
     {
-        SuccessOrExit(error = Encode(aInBuf[i], aIterator));
-    }
+        uint8_t byte = *aInBuf;
 
-exit:
+        if (HdlcByteNeedsEscape(byte))
+        {
+            VerifyOrExit(remaining >= 2, error = OT_ERROR_NO_BUFS);
 
-    if (error != OT_ERROR_NONE)
-    {
-        aIterator = oldIterator;
-        mFcs      = oldFcs;
+            *writePtr++ = kEscapeSequence;
+            *writePtr++ = byte ^ 0x20;
+            remaining -= 2;
+        }
+        else
+        {
+            VerifyOrExit(remaining >= 1, error = OT_ERROR_NO_BUFS);
+
+            *writePtr++ = byte;
+            remaining--;
+        }
+
+        fcs = UpdateFcs(fcs, byte);
     }
 
+    aIterator.mWritePointer    = writePtr;
+    aIterator.mRemainingLength = remaining;
+    mFcs                       = fcs;
+
+exit:
     return error;
 }
 
@@ -86,6 +86,8 @@ public:
         bool CanWrite(uint16_t aWriteLength) const;
 
     protected:
+        friend class Encoder;
+
         BufferWriteIterator(void); ///< Protected constructor to ensure no direct instantiation.
 
         uint8_t *mWritePointer;    ///< A pointer to current write position in the buffer.
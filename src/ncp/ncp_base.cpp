@@ -34,6 +34,7 @@
 
 #include <stdarg.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include <openthread/diag.h>
 #include <openthread/icmp6.h>
@@ -211,6 +212,9 @@ NcpBase::NcpBase(Instance *aInstance)
     , mUpdateChangedPropsTask(*aInstance, &NcpBase::UpdateChangedProps, this)
     , mThreadChangedFlags(0)
     , mChangedPropsSet()
+#if OPENTHREAD_CONFIG_NCP_CHANGED_PROPS_MIN_INTERVAL
+    , mChangedPropsHoldOffTimer(*aInstance, &NcpBase::HandleChangedPropsHoldOffTimer, this)
+#endif
     , mHostPowerState(SPINEL_HOST_POWER_STATE_ONLINE)
     , mHostPowerReplyFrameTag(NcpFrameBuffer::kInvalidTag)
     , mHostPowerStateHeader(0)
@@ -227,15 +231,36 @@ NcpBase::NcpBase(Instance *aInstance)
     , mPcapEnabled(false)
     , mDisableStreamWrite(false)
     , mShouldEmitChildTableUpdate(false)
+#if OPENTHREAD_CONFIG_NCP_RAW_STREAM_BATCH_SIZE
+    , mRawStreamBatchEnabled(false)
+    , mRawStreamBatchLength(0)
+    , mRawStreamBatchFirstMsec(0)
+    , mRawStreamBatchFirstUsec(0)
+    , mRawStreamBatchLastTime(0)
+    , mRawStreamBatchDropCounter(0)
+    , mRawStreamBatchTask(*aInstance, &NcpBase::HandleRawStreamBatchTask, this)
+#endif
 #if OPENTHREAD_FTD
     , mPreferredRouteId(0)
 #endif
 #if OPENTHREAD_RADIO || OPENTHREAD_ENABLE_RAW_LINK_API
     , mCurTransmitTID(0)
+#if OPENTHREAD_CONFIG_LINK_RAW_TRANSMIT_BATCH_SIZE
+    , mCurTransmitBatchTID(0)
+#endif
     , mCurScanChannel(kInvalidScanChannel)
     , mSrcMatchEnabled(false)
 #endif // OPENTHREAD_RADIO || OPENTHREAD_ENABLE_RAW_LINK_API
 #if OPENTHREAD_MTD || OPENTHREAD_FTD
+    , mStreamNetTxCredits(0)
+    , mStreamNetTxCreditsTimer(*aInstance, &NcpBase::HandleStreamNetTxCreditsTimer, this)
+#if OPENTHREAD_CONFIG_NCP_BUFFER_COUNTERS_STREAM_INTERVAL
+    , mBufferCountersTimer(*aInstance, &NcpBase::HandleBufferCountersTimer, this)
+    , mBufferCountersLow(false)
+#endif
+#if OPENTHREAD_CONFIG_NCP_ENABLE_STREAM_NET_LOWPAN
+    , mStreamNetLowpanEnabled(false)
+#endif
     , mInboundSecureIpFrameCounter(0)
     , mInboundInsecureIpFrameCounter(0)
     , mOutboundSecureIpFrameCounter(0)
@@ -247,6 +272,7 @@ NcpBase::NcpBase(Instance *aInstance)
     , mRxSpinelFrameCounter(0)
     , mRxSpinelOutOfOrderTidCounter(0)
     , mTxSpinelFrameCounter(0)
+    , mTxHostWriteCounter(0)
     , mDidInitialUpdates(false)
 {
     assert(mInstance != NULL);
@@ -254,6 +280,9 @@ NcpBase::NcpBase(Instance *aInstance)
     sNcpInstance = this;
 
     mTxFrameBuffer.SetFrameRemovedCallback(&NcpBase::HandleFrameRemovedFromNcpBuffer, this);
+#if OPENTHREAD_CONFIG_NCP_TX_BUFFER_MESSAGE_SPILL
+    mTxFrameBuffer.SetMessagePoolInstance(mInstance);
+#endif
 
     memset(&mResponseQueue, 0, sizeof(mResponseQueue));
 
@@ -263,6 +292,10 @@ NcpBase::NcpBase(Instance *aInstance)
 
 #if OPENTHREAD_MTD || OPENTHREAD_FTD
     otMessageQueueInit(&mMessageQueue);
+    mStreamNetTxCredits = GetStreamNetTxCredits();
+#if OPENTHREAD_CONFIG_NCP_BUFFER_COUNTERS_STREAM_INTERVAL
+    mBufferCountersTimer.Start(OPENTHREAD_CONFIG_NCP_BUFFER_COUNTERS_STREAM_INTERVAL);
+#endif
     otSetStateChangedCallback(mInstance, &NcpBase::HandleStateChanged, this);
     otIp6SetReceiveCallback(mInstance, &NcpBase::HandleDatagramFromStack, this);
     otIp6SetReceiveFilterEnabled(mInstance, true);
@@ -429,6 +462,13 @@ void NcpBase::HandleFrameRemovedFromNcpBuffer(NcpFrameBuffer::FrameTag aFrameTag
     SuccessOrExit(SendQueuedDatagramMessages());
 #endif
 
+#if OPENTHREAD_CONFIG_NCP_RAW_STREAM_BATCH_SIZE
+
+    // Send any captured frames waiting in the raw stream batch.
+
+    SuccessOrExit(SendRawStreamBatch());
+#endif
+
     // Send any unsolicited event-triggered property updates.
 
     UpdateChangedProps();
@@ -452,6 +492,12 @@ void NcpBase::IncrementFrameErrorCounter(void)
     mFramingErrorCounter++;
 }
 
+void NcpBase::IncrementHostWriteCounter(uint16_t aNumFrames)
+{
+    mTxHostWriteCounter++;
+    mTxSpinelFrameCounter += aNumFrames;
+}
+
 otError NcpBase::StreamWrite(int aStreamId, const uint8_t *aDataPtr, int aDataLen)
 {
     otError           error  = OT_ERROR_NONE;
@@ -525,6 +571,46 @@ uint8_t NcpBase::ConvertLogLevel(otLogLevel aLogLevel)
     return spinelLogLevel;
 }
 
+otError NcpBase::ConvertSpinelLogLevel(uint8_t aSpinelLogLevel, otLogLevel &aLogLevel)
+{
+    otError error = OT_ERROR_NONE;
+
+    switch (aSpinelLogLevel)
+    {
+    case SPINEL_NCP_LOG_LEVEL_EMERG:
+    case SPINEL_NCP_LOG_LEVEL_ALERT:
+        aLogLevel = OT_LOG_LEVEL_NONE;
+        break;
+
+    case SPINEL_NCP_LOG_LEVEL_CRIT:
+        aLogLevel = OT_LOG_LEVEL_CRIT;
+        break;
+
+    case SPINEL_NCP_LOG_LEVEL_ERR:
+    case SPINEL_NCP_LOG_LEVEL_WARN:
+        aLogLevel = OT_LOG_LEVEL_WARN;
+        break;
+
+    case SPINEL_NCP_LOG_LEVEL_NOTICE:
+        aLogLevel = OT_LOG_LEVEL_NOTE;
+        break;
+
+    case SPINEL_NCP_LOG_LEVEL_INFO:
+        aLogLevel = OT_LOG_LEVEL_INFO;
+        break;
+
+    case SPINEL_NCP_LOG_LEVEL_DEBUG:
+        aLogLevel = OT_LOG_LEVEL_DEBG;
+        break;
+
+    default:
+        error = OT_ERROR_INVALID_ARGS;
+        break;
+    }
+
+    return error;
+}
+
 unsigned int NcpBase::ConvertLogRegion(otLogRegion aLogRegion)
 {
     unsigned int spinelLogRegion = SPINEL_NCP_LOG_REGION_NONE;
@@ -628,6 +714,269 @@ exit:
     }
 }
 
+#if OPENTHREAD_CONFIG_NCP_ENABLE_TOKENIZED_LOG
+
+void NcpBase::LogTokenized(otLogLevel aLogLevel, otLogRegion aLogRegion, const char *aFormat, va_list aArgs)
+{
+    otError error  = OT_ERROR_NONE;
+    uint8_t header = SPINEL_HEADER_FLAG | SPINEL_HEADER_IID_0;
+
+    VerifyOrExit(!mDisableStreamWrite);
+    VerifyOrExit(!mChangedPropsSet.IsPropertyFiltered(SPINEL_PROP_STREAM_LOG));
+    VerifyOrExit(IsResponseQueueEmpty(), error = OT_ERROR_NO_BUFS);
+
+    SuccessOrExit(error = mEncoder.BeginFrame(header, SPINEL_CMD_PROP_VALUE_IS, SPINEL_PROP_STREAM_LOG_TOKENIZED));
+    SuccessOrExit(error = mEncoder.WriteUint32(GetLogToken(aFormat)));
+    SuccessOrExit(error = mEncoder.WriteUint8(ConvertLogLevel(aLogLevel)));
+    SuccessOrExit(error = mEncoder.WriteUintPacked(ConvertLogRegion(aLogRegion)));
+    SuccessOrExit(error = EncodeLogArguments(aFormat, aArgs));
+    SuccessOrExit(error = mEncoder.EndFrame());
+
+exit:
+
+    if (error == OT_ERROR_NO_BUFS)
+    {
+        mChangedPropsSet.AddLastStatus(SPINEL_STATUS_NOMEM);
+        mUpdateChangedPropsTask.Post();
+    }
+}
+
+uint32_t NcpBase::GetLogToken(const char *aFormat)
+{
+    // 32-bit FNV-1a hash of the format string.
+
+    uint32_t token = 2166136261UL;
+
+    for (; *aFormat != '\0'; aFormat++)
+    {
+        token ^= static_cast<uint8_t>(*aFormat);
+        token *= 16777619UL;
+    }
+
+    return token;
+}
+
+otError NcpBase::EncodeLogArguments(const char *aFormat, va_list aArgs)
+{
+    // Walks the conversions in the format string, consuming each argument
+    // and writing its raw value as described for `STREAM_LOG_TOKENIZED`.
+
+    enum
+    {
+        kLengthDefault,
+        kLengthLong,
+        kLengthLongLong,
+        kLengthIntMax,
+        kLengthSize,
+        kLengthPtrDiff,
+        kLengthLongDouble,
+    };
+
+    otError error = OT_ERROR_NONE;
+
+    for (const char *ch = aFormat; *ch != '\0'; ch++)
+    {
+        uint8_t length    = kLengthDefault;
+        int     precision = -1;
+
+        if (*ch != '%')
+        {
+            continue;
+        }
+
+        ch++;
+
+        while ((*ch != '\0') && (strchr("-+ #0", *ch) != NULL))
+        {
+            ch++;
+        }
+
+        // Width and precision, each given either inline or as an `int` argument.
+
+        for (bool isPrecision = false;; isPrecision = true)
+        {
+            if (*ch == '*')
+            {
+                int value = va_arg(aArgs, int);
+
+                SuccessOrExit(error = mEncoder.WriteUintPacked(static_cast<unsigned int>(value)));
+                precision = isPrecision ? value : precision;
+                ch++;
+            }
+            else
+            {
+                int value = 0;
+
+                for (; (*ch >= '0') && (*ch <= '9'); ch++)
+                {
+                    value = value * 10 + (*ch - '0');
+                }
+
+                precision = isPrecision ? value : precision;
+            }
+
+            if (isPrecision || (*ch != '.'))
+            {
+                break;
+            }
+
+            ch++;
+        }
+
+        switch (*ch)
+        {
+        case 'h':
+            ch += (ch[1] == 'h') ? 2 : 1;
+            break;
+
+        case 'l':
+            length = (ch[1] == 'l') ? kLengthLongLong : kLengthLong;
+            ch += (ch[1] == 'l') ? 2 : 1;
+            break;
+
+        case 'j':
+            length = kLengthIntMax;
+            ch++;
+            break;
+
+        case 'z':
+            length = kLengthSize;
+            ch++;
+            break;
+
+        case 't':
+            length = kLengthPtrDiff;
+            ch++;
+            break;
+
+        case 'L':
+            length = kLengthLongDouble;
+            ch++;
+            break;
+
+        default:
+            break;
+        }
+
+        switch (*ch)
+        {
+        case '%':
+            break;
+
+        case 'd':
+        case 'i':
+        case 'u':
+        case 'o':
+        case 'x':
+        case 'X':
+        case 'c':
+        {
+            uint64_t value;
+
+            switch (length)
+            {
+            case kLengthLongLong:
+                value = va_arg(aArgs, uint64_t);
+                break;
+
+            case kLengthIntMax:
+                value = va_arg(aArgs, uintmax_t);
+                break;
+
+            case kLengthLong:
+                value = va_arg(aArgs, unsigned long);
+                break;
+
+            case kLengthSize:
+                value = va_arg(aArgs, size_t);
+                break;
+
+            case kLengthPtrDiff:
+                value = static_cast<uint64_t>(va_arg(aArgs, ptrdiff_t));
+                break;
+
+            default:
+                value = va_arg(aArgs, unsigned int);
+                break;
+            }
+
+            if ((length == kLengthLongLong) || (length == kLengthIntMax))
+            {
+                SuccessOrExit(error = mEncoder.WriteUint64(value));
+            }
+            else
+            {
+                SuccessOrExit(error = mEncoder.WriteUintPacked(static_cast<unsigned int>(value)));
+            }
+
+            break;
+        }
+
+        case 'p':
+        {
+            uintptr_t pointer = reinterpret_cast<uintptr_t>(va_arg(aArgs, void *));
+
+            SuccessOrExit(error = mEncoder.WriteUintPacked(static_cast<unsigned int>(pointer)));
+            break;
+        }
+
+        case 's':
+        {
+            const char *string = va_arg(aArgs, const char *);
+            uint16_t    len    = 0;
+
+            if (string == NULL)
+            {
+                string = "(null)";
+            }
+
+            // With a precision the string need not be null-terminated,
+            // so only the part that is printed is sent.
+
+            while ((string[len] != '\0') && ((precision < 0) || (len < precision)))
+            {
+                len++;
+            }
+
+            SuccessOrExit(error = mEncoder.WriteData(reinterpret_cast<const uint8_t *>(string), len));
+            SuccessOrExit(error = mEncoder.WriteUint8(0));
+            break;
+        }
+
+        case 'e':
+        case 'E':
+        case 'f':
+        case 'F':
+        case 'g':
+        case 'G':
+        case 'a':
+        case 'A':
+        {
+            double   value = (length == kLengthLongDouble) ? static_cast<double>(va_arg(aArgs, long double))
+                                                           : va_arg(aArgs, double);
+            uint64_t bits;
+
+            memcpy(&bits, &value, sizeof(bits));
+            SuccessOrExit(error = mEncoder.WriteUint64(bits));
+            break;
+        }
+
+        case 'n':
+            IgnoreReturnValue(va_arg(aArgs, void *));
+            break;
+
+        default:
+            // Unknown conversion or end of the format string.
+            ExitNow();
+        }
+    }
+
+exit:
+    return error;
+}
+
+#endif // OPENTHREAD_CONFIG_NCP_ENABLE_TOKENIZED_LOG
+
 #if OPENTHREAD_CONFIG_NCP_ENABLE_PEEK_POKE
 
 void NcpBase::RegisterPeekPokeDelagates(otNcpDelegateAllowPeekPoke aAllowPeekDelegate,
@@ -803,6 +1152,16 @@ void NcpBase::UpdateChangedProps(void)
             continue;
         }
 
+#if OPENTHREAD_CONFIG_NCP_CHANGED_PROPS_MIN_INTERVAL
+        // A rate-limited property updated recently stays in the set until its hold-off
+        // period ends, so that further changes are coalesced into a single update.
+
+        if (mChangedPropsSet.IsEntryHeldOff(index))
+        {
+            continue;
+        }
+#endif
+
         propKey = entry->mPropKey;
 
         if (propKey == SPINEL_PROP_LAST_STATUS)
@@ -819,6 +1178,13 @@ void NcpBase::UpdateChangedProps(void)
         else if (mDidInitialUpdates)
         {
             SuccessOrExit(WritePropertyValueIsFrame(SPINEL_HEADER_FLAG | SPINEL_HEADER_IID_0, propKey));
+
+#if OPENTHREAD_CONFIG_NCP_CHANGED_PROPS_MIN_INTERVAL
+            if (mChangedPropsSet.HoldOffEntry(index) && !mChangedPropsHoldOffTimer.IsRunning())
+            {
+                mChangedPropsHoldOffTimer.Start(OPENTHREAD_CONFIG_NCP_CHANGED_PROPS_MIN_INTERVAL);
+            }
+#endif
         }
 
         mChangedPropsSet.RemoveEntry(index);
@@ -830,6 +1196,29 @@ exit:
     return;
 }
 
+#if OPENTHREAD_CONFIG_NCP_CHANGED_PROPS_MIN_INTERVAL
+
+void NcpBase::HandleChangedPropsHoldOffTimer(Timer &aTimer)
+{
+    OT_UNUSED_VARIABLE(aTimer);
+    GetNcpInstance()->HandleChangedPropsHoldOffTimer();
+}
+
+void NcpBase::HandleChangedPropsHoldOffTimer(void)
+{
+    // Entries are released after two timer periods, so the timer keeps
+    // running as long as any entry remains in hold-off.
+
+    if (mChangedPropsSet.AdvanceHoldOff())
+    {
+        mChangedPropsHoldOffTimer.Start(OPENTHREAD_CONFIG_NCP_CHANGED_PROPS_MIN_INTERVAL);
+    }
+
+    mUpdateChangedPropsTask.Post();
+}
+
+#endif // OPENTHREAD_CONFIG_NCP_CHANGED_PROPS_MIN_INTERVAL
+
 // ----------------------------------------------------------------------------
 // MARK: Inbound Command Handler
 // ----------------------------------------------------------------------------
@@ -858,6 +1247,14 @@ otError NcpBase::HandleCommand(uint8_t aHeader)
         error = CommandHandler_PROP_VALUE_update(aHeader, command);
         break;
 
+    case SPINEL_CMD_PROP_VALUE_MULTI_GET:
+        error = CommandHandler_PROP_VALUE_MULTI_GET(aHeader);
+        break;
+
+    case SPINEL_CMD_PROP_VALUE_MULTI_SET:
+        error = CommandHandler_PROP_VALUE_MULTI_SET(aHeader);
+        break;
+
 #if OPENTHREAD_CONFIG_NCP_ENABLE_PEEK_POKE
     case SPINEL_CMD_PEEK:
         error = CommandHandler_PEEK(aHeader);
@@ -931,6 +1328,10 @@ bool NcpBase::HandlePropertySetForSpecialProperties(uint8_t aHeader, spinel_prop
 #if OPENTHREAD_RADIO || OPENTHREAD_ENABLE_RAW_LINK_API
     case SPINEL_PROP_STREAM_RAW:
         ExitNow(aError = HandlePropertySet_SPINEL_PROP_STREAM_RAW(aHeader));
+#if OPENTHREAD_CONFIG_LINK_RAW_TRANSMIT_BATCH_SIZE
+    case SPINEL_PROP_STREAM_RAW_TX_BATCH:
+        ExitNow(aError = HandlePropertySet_SPINEL_PROP_STREAM_RAW_TX_BATCH(aHeader));
+#endif
 #endif
 
     default:
@@ -1121,6 +1522,51 @@ exit:
     return error;
 }
 
+// Writes a struct with the property key and its current value into the frame being written. If the property value
+// cannot be fetched, the struct contains `LAST_STATUS` and the error status instead.
+otError NcpBase::WritePropertyValueStruct(spinel_prop_key_t aPropKey, bool aIsGetResponse)
+{
+    otError         error   = OT_ERROR_NONE;
+    spinel_status_t status  = aIsGetResponse ? SPINEL_STATUS_PROP_NOT_FOUND : SPINEL_STATUS_OK;
+    PropertyHandler handler = FindGetPropertyHandler(aPropKey);
+
+    if (handler != NULL)
+    {
+        SuccessOrExit(error = mEncoder.SavePosition());
+        SuccessOrExit(error = mEncoder.OpenStruct());
+        SuccessOrExit(error = mEncoder.WriteUintPacked(aPropKey));
+
+        error = (this->*handler)();
+
+        if (error == OT_ERROR_NONE)
+        {
+            ExitNow(error = mEncoder.CloseStruct());
+        }
+
+        // Discard the partially written struct.
+        status = ThreadErrorToSpinelStatus(error);
+        SuccessOrExit(error = mEncoder.ResetToSaved());
+    }
+
+    error = WriteLastStatusStruct(status);
+
+exit:
+    return error;
+}
+
+otError NcpBase::WriteLastStatusStruct(spinel_status_t aLastStatus)
+{
+    otError error = OT_ERROR_NONE;
+
+    SuccessOrExit(error = mEncoder.OpenStruct());
+    SuccessOrExit(error = mEncoder.WriteUintPacked(SPINEL_PROP_LAST_STATUS));
+    SuccessOrExit(error = mEncoder.WriteUintPacked(aLastStatus));
+    SuccessOrExit(error = mEncoder.CloseStruct());
+
+exit:
+    return error;
+}
+
 otError NcpBase::WritePropertyValueInsertedRemovedFrame(uint8_t           aHeader,
                                                         unsigned int      aResponseCommand,
                                                         spinel_prop_key_t aPropKey,
@@ -1208,6 +1654,79 @@ exit:
     return error;
 }
 
+otError NcpBase::CommandHandler_PROP_VALUE_MULTI_GET(uint8_t aHeader)
+{
+    otError      error = OT_ERROR_NONE;
+    unsigned int propKey;
+
+    SuccessOrExit(error = mEncoder.BeginFrame(aHeader, SPINEL_CMD_PROP_VALUES_ARE));
+
+    while (!mDecoder.IsAllRead())
+    {
+        SuccessOrExit(error = mDecoder.ReadUintPacked(propKey));
+        SuccessOrExit(error = WritePropertyValueStruct(static_cast<spinel_prop_key_t>(propKey), true));
+    }
+
+    SuccessOrExit(error = mEncoder.EndFrame());
+
+exit:
+    if (error != OT_ERROR_NONE)
+    {
+        // The unfinished `VALUES_ARE` frame (if any) is discarded
+        // when the next frame is begun.
+        error = PrepareLastStatusResponse(aHeader, ThreadErrorToSpinelStatus(error));
+    }
+
+    return error;
+}
+
+otError NcpBase::CommandHandler_PROP_VALUE_MULTI_SET(uint8_t aHeader)
+{
+    otError         error = OT_ERROR_NONE;
+    otError         setError;
+    unsigned int    propKey;
+    PropertyHandler handler;
+
+    SuccessOrExit(error = mEncoder.BeginFrame(aHeader, SPINEL_CMD_PROP_VALUES_ARE));
+
+    while (!mDecoder.IsAllRead())
+    {
+        SuccessOrExit(error = mDecoder.OpenStruct());
+        SuccessOrExit(error = mDecoder.ReadUintPacked(propKey));
+
+        // Properties without a regular "set" handler (e.g., the ones
+        // which form their own response) are not supported here.
+
+        handler  = FindSetPropertyHandler(static_cast<spinel_prop_key_t>(propKey));
+        setError = (handler != NULL) ? (this->*handler)() : OT_ERROR_NOT_FOUND;
+
+        SuccessOrExit(error = mDecoder.CloseStruct());
+
+        if (handler == NULL)
+        {
+            SuccessOrExit(error = WriteLastStatusStruct(SPINEL_STATUS_PROP_NOT_FOUND));
+        }
+        else if (setError != OT_ERROR_NONE)
+        {
+            SuccessOrExit(error = WriteLastStatusStruct(ThreadErrorToSpinelStatus(setError)));
+        }
+        else
+        {
+            SuccessOrExit(error = WritePropertyValueStruct(static_cast<spinel_prop_key_t>(propKey), false));
+        }
+    }
+
+    SuccessOrExit(error = mEncoder.EndFrame());
+
+exit:
+    if (error != OT_ERROR_NONE)
+    {
+        error = PrepareLastStatusResponse(aHeader, ThreadErrorToSpinelStatus(error));
+    }
+
+    return error;
+}
+
 #if OPENTHREAD_CONFIG_NCP_ENABLE_PEEK_POKE
 
 otError NcpBase::CommandHandler_PEEK(uint8_t aHeader)
@@ -1448,6 +1967,125 @@ exit:
     return error;
 }
 
+#if OPENTHREAD_CONFIG_NCP_RAW_STREAM_BATCH_SIZE
+
+template <> otError NcpBase::HandlePropertyGet<SPINEL_PROP_MAC_RAW_STREAM_BATCH_ENABLED>(void)
+{
+    return mEncoder.WriteBool(mRawStreamBatchEnabled);
+}
+
+template <> otError NcpBase::HandlePropertySet<SPINEL_PROP_MAC_RAW_STREAM_BATCH_ENABLED>(void)
+{
+    bool    enabled = false;
+    otError error   = OT_ERROR_NONE;
+
+    SuccessOrExit(error = mDecoder.ReadBool(enabled));
+    VerifyOrExit(enabled != mRawStreamBatchEnabled);
+
+    if (!enabled)
+    {
+        // Flush what was captured so far; anything which does not fit in
+        // the NCP buffer right now is discarded.
+        SendRawStreamBatch();
+    }
+
+    mRawStreamBatchEnabled     = enabled;
+    mRawStreamBatchLength      = 0;
+    mRawStreamBatchDropCounter = 0;
+
+exit:
+    return error;
+}
+
+void NcpBase::HandleRawStreamBatchTask(Tasklet &aTasklet)
+{
+    OT_UNUSED_VARIABLE(aTasklet);
+    GetNcpInstance()->SendRawStreamBatch();
+}
+
+void NcpBase::AddFrameToRawStreamBatch(const otRadioFrame &aFrame)
+{
+    enum
+    {
+        kMaxRecordOverhead = 10, // Packed time delta (up to 5 bytes), RSSI, LQI, flags and PSDU length.
+    };
+
+    uint32_t       msec = aFrame.mInfo.mRxInfo.mMsec;
+    uint16_t       usec = aFrame.mInfo.mRxInfo.mUsec;
+    int8_t         rssi = aFrame.mInfo.mRxInfo.mRssi;
+    uint8_t        lqi  = aFrame.mInfo.mRxInfo.mLqi;
+    uint32_t       time;
+    spinel_ssize_t length;
+
+    if (aFrame.mDidTx)
+    {
+        // Transmitted frames carry no receive info.
+        msec = TimerMilli::GetNow();
+        usec = 0;
+        rssi = OT_RADIO_RSSI_INVALID;
+        lqi  = 0;
+    }
+
+    time = msec * 1000 + usec;
+
+    if (mRawStreamBatchLength + kMaxRecordOverhead + aFrame.mLength > kRawStreamBatchSize)
+    {
+        SendRawStreamBatch();
+    }
+
+    if (mRawStreamBatchLength + kMaxRecordOverhead + aFrame.mLength > kRawStreamBatchSize)
+    {
+        mRawStreamBatchDropCounter++;
+        ExitNow();
+    }
+
+    if (mRawStreamBatchLength == 0)
+    {
+        mRawStreamBatchFirstMsec = msec;
+        mRawStreamBatchFirstUsec = usec;
+        mRawStreamBatchLastTime  = time;
+    }
+
+    length = spinel_datatype_pack(&mRawStreamBatch[mRawStreamBatchLength], kRawStreamBatchSize - mRawStreamBatchLength,
+                                  SPINEL_DATATYPE_UINT_PACKED_S SPINEL_DATATYPE_INT8_S SPINEL_DATATYPE_UINT8_S
+                                      SPINEL_DATATYPE_UINT8_S SPINEL_DATATYPE_DATA_WLEN_S,
+                                  time - mRawStreamBatchLastTime, rssi, lqi, aFrame.mDidTx ? SPINEL_MD_FLAG_TX : 0,
+                                  aFrame.mPsdu, static_cast<uint32_t>(aFrame.mLength));
+    assert(length > 0);
+
+    mRawStreamBatchLength += static_cast<uint16_t>(length);
+
+    mRawStreamBatchLastTime = time;
+
+    // Frames captured before the tasklet runs are sent in the same update.
+    mRawStreamBatchTask.Post();
+
+exit:
+    return;
+}
+
+otError NcpBase::SendRawStreamBatch(void)
+{
+    otError error  = OT_ERROR_NONE;
+    uint8_t header = SPINEL_HEADER_FLAG | SPINEL_HEADER_IID_0;
+
+    VerifyOrExit(mRawStreamBatchLength != 0);
+
+    SuccessOrExit(error = mEncoder.BeginFrame(header, SPINEL_CMD_PROP_VALUE_IS, SPINEL_PROP_STREAM_RAW_BATCH));
+    SuccessOrExit(error = mEncoder.WriteUint32(mRawStreamBatchDropCounter));
+    SuccessOrExit(error = mEncoder.WriteUint32(mRawStreamBatchFirstMsec));
+    SuccessOrExit(error = mEncoder.WriteUint16(mRawStreamBatchFirstUsec));
+    SuccessOrExit(error = mEncoder.WriteData(mRawStreamBatch, mRawStreamBatchLength));
+    SuccessOrExit(error = mEncoder.EndFrame());
+
+    mRawStreamBatchLength = 0;
+
+exit:
+    return error;
+}
+
+#endif // OPENTHREAD_CONFIG_NCP_RAW_STREAM_BATCH_SIZE
+
 otError NcpBase::EncodeChannelMask(uint32_t aChannelMask)
 {
     otError error = OT_ERROR_NONE;
@@ -1719,6 +2357,7 @@ template <> otError NcpBase::HandlePropertyGet<SPINEL_PROP_CAPS>(void)
 
     SuccessOrExit(error = mEncoder.WriteUintPacked(SPINEL_CAP_COUNTERS));
     SuccessOrExit(error = mEncoder.WriteUintPacked(SPINEL_CAP_UNSOL_UPDATE_FILTER));
+    SuccessOrExit(error = mEncoder.WriteUintPacked(SPINEL_CAP_CMD_MULTI));
 
 #if OPENTHREAD_CONFIG_NCP_ENABLE_MCU_POWER_STATE_CONTROL
     SuccessOrExit(error = mEncoder.WriteUintPacked(SPINEL_CAP_MCU_POWER_STATE));
@@ -1726,6 +2365,13 @@ template <> otError NcpBase::HandlePropertyGet<SPINEL_PROP_CAPS>(void)
 
 #if OPENTHREAD_RADIO || OPENTHREAD_ENABLE_RAW_LINK_API
     SuccessOrExit(error = mEncoder.WriteUintPacked(SPINEL_CAP_MAC_RAW));
+#if OPENTHREAD_CONFIG_LINK_RAW_TRANSMIT_BATCH_SIZE
+    SuccessOrExit(error = mEncoder.WriteUintPacked(SPINEL_CAP_MAC_RAW_TX_BATCH));
+#endif
+#endif
+
+#if OPENTHREAD_CONFIG_NCP_RAW_STREAM_BATCH_SIZE
+    SuccessOrExit(error = mEncoder.WriteUintPacked(SPINEL_CAP_MAC_RAW_STREAM_BATCH));
 #endif
 
 #if OPENTHREAD_ENABLE_POSIX_APP
@@ -1734,6 +2380,9 @@ template <> otError NcpBase::HandlePropertyGet<SPINEL_PROP_CAPS>(void)
 
 #if (OPENTHREAD_CONFIG_LOG_OUTPUT == OPENTHREAD_CONFIG_LOG_OUTPUT_NCP_SPINEL)
     SuccessOrExit(error = mEncoder.WriteUintPacked(SPINEL_CAP_OPENTHREAD_LOG_METADATA));
+#if OPENTHREAD_CONFIG_NCP_ENABLE_TOKENIZED_LOG
+    SuccessOrExit(error = mEncoder.WriteUintPacked(SPINEL_CAP_OPENTHREAD_LOG_TOKENIZED));
+#endif
 #endif
 
 #if OPENTHREAD_MTD || OPENTHREAD_FTD
@@ -1777,6 +2426,10 @@ template <> otError NcpBase::HandlePropertyGet<SPINEL_PROP_CAPS>(void)
     SuccessOrExit(error = mEncoder.WriteUintPacked(SPINEL_CAP_PEEK_POKE));
 #endif
 
+#if OPENTHREAD_CONFIG_NCP_ENABLE_STREAM_NET_LOWPAN
+    SuccessOrExit(error = mEncoder.WriteUintPacked(SPINEL_CAP_NET_STREAM_LOWPAN));
+#endif
+
     // TODO: Somehow get the following capability from the radio.
     SuccessOrExit(error = mEncoder.WriteUintPacked(SPINEL_CAP_802_15_4_2450MHZ_OQPSK));
 
@@ -2104,41 +2757,54 @@ template <> otError NcpBase::HandlePropertySet<SPINEL_PROP_DEBUG_NCP_LOG_LEVEL>(
     otError    error = OT_ERROR_NONE;
 
     SuccessOrExit(error = mDecoder.ReadUint8(spinelNcpLogLevel));
+    SuccessOrExit(error = ConvertSpinelLogLevel(spinelNcpLogLevel, logLevel));
+
+    error = otLoggingSetLevel(logLevel);
+
+exit:
+    return error;
+}
+
+template <> otError NcpBase::HandlePropertyGet<SPINEL_PROP_DEBUG_NCP_LOG_REGION_LEVEL>(void)
+{
+    otError error = OT_ERROR_NONE;
 
-    switch (spinelNcpLogLevel)
+    for (uint8_t region = OT_LOG_REGION_API; region <= OT_LOG_REGION_UTIL; region++)
     {
-    case SPINEL_NCP_LOG_LEVEL_EMERG:
-    case SPINEL_NCP_LOG_LEVEL_ALERT:
-        logLevel = OT_LOG_LEVEL_NONE;
-        break;
+        otLogRegion logRegion = static_cast<otLogRegion>(region);
 
-    case SPINEL_NCP_LOG_LEVEL_CRIT:
-        logLevel = OT_LOG_LEVEL_CRIT;
-        break;
+        SuccessOrExit(error = mEncoder.OpenStruct());
+        SuccessOrExit(error = mEncoder.WriteUintPacked(ConvertLogRegion(logRegion)));
+        SuccessOrExit(error = mEncoder.WriteUint8(ConvertLogLevel(otLoggingGetRegionLevel(logRegion))));
+        SuccessOrExit(error = mEncoder.CloseStruct());
+    }
 
-    case SPINEL_NCP_LOG_LEVEL_ERR:
-    case SPINEL_NCP_LOG_LEVEL_WARN:
-        logLevel = OT_LOG_LEVEL_WARN;
-        break;
+exit:
+    return error;
+}
 
-    case SPINEL_NCP_LOG_LEVEL_NOTICE:
-        logLevel = OT_LOG_LEVEL_NOTE;
-        break;
+template <> otError NcpBase::HandlePropertySet<SPINEL_PROP_DEBUG_NCP_LOG_REGION_LEVEL>(void)
+{
+    unsigned int spinelNcpLogRegion = 0;
+    uint8_t      spinelNcpLogLevel  = 0;
+    otLogLevel   logLevel;
+    otError      error = OT_ERROR_NONE;
 
-    case SPINEL_NCP_LOG_LEVEL_INFO:
-        logLevel = OT_LOG_LEVEL_INFO;
-        break;
+    SuccessOrExit(error = mDecoder.ReadUintPacked(spinelNcpLogRegion));
+    SuccessOrExit(error = mDecoder.ReadUint8(spinelNcpLogLevel));
+    SuccessOrExit(error = ConvertSpinelLogLevel(spinelNcpLogLevel, logLevel));
 
-    case SPINEL_NCP_LOG_LEVEL_DEBUG:
-        logLevel = OT_LOG_LEVEL_DEBG;
-        break;
+    error = OT_ERROR_INVALID_ARGS;
 
-    default:
-        ExitNow(error = OT_ERROR_INVALID_ARGS);
-        break;
-    }
+    for (uint8_t region = OT_LOG_REGION_API; region <= OT_LOG_REGION_UTIL; region++)
+    {
+        otLogRegion logRegion = static_cast<otLogRegion>(region);
 
-    error = otLoggingSetLevel(logLevel);
+        if (ConvertLogRegion(logRegion) == spinelNcpLogRegion)
+        {
+            ExitNow(error = otLoggingSetRegionLevel(logRegion, logLevel));
+        }
+    }
 
 exit:
     return error;
@@ -2215,11 +2881,18 @@ extern "C" void otNcpPlatLogv(otLogLevel aLogLevel, otLogRegion aLogRegion, cons
 extern "C" void otPlatLog(otLogLevel aLogLevel, otLogRegion aLogRegion, const char *aFormat, ...)
 {
     va_list           args;
-    char              logString[OPENTHREAD_CONFIG_NCP_SPINEL_LOG_MAX_SIZE];
     ot::Ncp::NcpBase *ncp = ot::Ncp::NcpBase::GetNcpInstance();
 
     va_start(args, aFormat);
 
+#if OPENTHREAD_CONFIG_NCP_ENABLE_TOKENIZED_LOG
+    if (ncp != NULL)
+    {
+        ncp->LogTokenized(aLogLevel, aLogRegion, aFormat, args);
+    }
+#else
+    char logString[OPENTHREAD_CONFIG_NCP_SPINEL_LOG_MAX_SIZE];
+
     if (vsnprintf(logString, sizeof(logString), aFormat, args) > 0)
     {
         if (ncp != NULL)
@@ -2227,6 +2900,7 @@ extern "C" void otPlatLog(otLogLevel aLogLevel, otLogRegion aLogRegion, const ch
             ncp->Log(aLogLevel, aLogRegion, logString);
         }
     }
+#endif
 
     va_end(args);
 }
@@ -35,6 +35,8 @@
 
 #include "openthread-core-config.h"
 
+#include <stdarg.h>
+
 #if OPENTHREAD_MTD || OPENTHREAD_FTD
 #include <openthread/ip6.h>
 #else
@@ -50,6 +52,7 @@
 #include "changed_props_set.hpp"
 #include "common/instance.hpp"
 #include "common/tasklet.hpp"
+#include "common/timer.hpp"
 #include "ncp/ncp_buffer.hpp"
 #include "ncp/spinel_decoder.hpp"
 #include "ncp/spinel_encoder.hpp"
@@ -106,6 +109,20 @@ public:
      */
     void Log(otLogLevel aLogLevel, otLogRegion aLogRegion, const char *aLogString);
 
+#if OPENTHREAD_CONFIG_NCP_ENABLE_TOKENIZED_LOG
+    /**
+     * This method sends an OpenThread log message to host in tokenized form via `SPINEL_PROP_STREAM_LOG_TOKENIZED`
+     * property, i.e., a token identifying the format string followed by the raw argument values.
+     *
+     * @param[in] aLogLevel   The log level
+     * @param[in] aLogRegion  The log region
+     * @param[in] aFormat     The printf-style format string
+     * @param[in] aArgs       The arguments for the format string
+     *
+     */
+    void LogTokenized(otLogLevel aLogLevel, otLogRegion aLogRegion, const char *aFormat, va_list aArgs);
+#endif
+
 #if OPENTHREAD_CONFIG_NCP_ENABLE_PEEK_POKE
     /**
      * This method registers peek/poke delegate functions with NCP module.
@@ -156,6 +173,14 @@ public:
      */
     void IncrementFrameErrorCounter(void);
 
+    /**
+     * This method is called by the framer whenever a write to the host interface is started.
+     *
+     * @param[in]  aNumFrames  The number of spinel frames completed within the write.
+     *
+     */
+    void IncrementHostWriteCounter(uint16_t aNumFrames);
+
     /**
      * Called by the subclass to indicate when a frame has been received.
      */
@@ -205,6 +230,8 @@ protected:
 
     otError WriteLastStatusFrame(uint8_t aHeader, spinel_status_t aLastStatus);
     otError WritePropertyValueIsFrame(uint8_t aHeader, spinel_prop_key_t aPropKey, bool aIsGetResponse = true);
+    otError WritePropertyValueStruct(spinel_prop_key_t aPropKey, bool aIsGetResponse);
+    otError WriteLastStatusStruct(spinel_status_t aLastStatus);
     otError WritePropertyValueInsertedRemovedFrame(uint8_t           aHeader,
                                                    unsigned int      aResponseCommand,
                                                    spinel_prop_key_t aPropKey,
@@ -231,6 +258,11 @@ protected:
     static void UpdateChangedProps(Tasklet &aTasklet);
     void        UpdateChangedProps(void);
 
+#if OPENTHREAD_CONFIG_NCP_CHANGED_PROPS_MIN_INTERVAL
+    static void HandleChangedPropsHoldOffTimer(Timer &aTimer);
+    void        HandleChangedPropsHoldOffTimer(void);
+#endif
+
     static void HandleFrameRemovedFromNcpBuffer(void *                   aContext,
                                                 NcpFrameBuffer::FrameTag aFrameTag,
                                                 NcpFrameBuffer::Priority aPriority,
@@ -240,6 +272,12 @@ protected:
     otError EncodeChannelMask(uint32_t aChannelMask);
     otError DecodeChannelMask(uint32_t &aChannelMask);
 
+#if OPENTHREAD_CONFIG_NCP_RAW_STREAM_BATCH_SIZE
+    static void HandleRawStreamBatchTask(Tasklet &aTasklet);
+    void        AddFrameToRawStreamBatch(const otRadioFrame &aFrame);
+    otError     SendRawStreamBatch(void);
+#endif
+
 #if OPENTHREAD_RADIO || OPENTHREAD_ENABLE_RAW_LINK_API
 
     static void LinkRawReceiveDone(otInstance *aInstance, otRadioFrame *aFrame, otError aError);
@@ -251,6 +289,11 @@ protected:
                                     otError       aError);
     void        LinkRawTransmitDone(otRadioFrame *aFrame, otRadioFrame *aAckFrame, otError aError);
 
+#if OPENTHREAD_CONFIG_LINK_RAW_TRANSMIT_BATCH_SIZE
+    static void LinkRawTransmitBatchDone(otInstance *aInstance, const otError *aErrors, uint8_t aCount);
+    void        LinkRawTransmitBatchDone(const otError *aErrors, uint8_t aCount);
+#endif
+
     static void LinkRawEnergyScanDone(otInstance *aInstance, int8_t aEnergyScanMaxRssi);
     void        LinkRawEnergyScanDone(int8_t aEnergyScanMaxRssi);
 
@@ -279,6 +322,19 @@ protected:
 
     otError SendQueuedDatagramMessages(void);
     otError SendDatagramMessage(otMessage *aMessage);
+#if OPENTHREAD_CONFIG_NCP_ENABLE_STREAM_NET_LOWPAN
+    otError SendCompressedDatagramMessage(otMessage *aMessage);
+#endif
+
+    uint16_t    GetStreamNetTxCredits(void) const;
+    void        UpdateStreamNetTxCredits(void);
+    static void HandleStreamNetTxCreditsTimer(Timer &aTimer);
+    void        HandleStreamNetTxCreditsTimer(void);
+
+#if OPENTHREAD_CONFIG_NCP_BUFFER_COUNTERS_STREAM_INTERVAL
+    static void HandleBufferCountersTimer(Timer &aTimer);
+    void        HandleBufferCountersTimer(void);
+#endif
 
     static void HandleActiveScanResult_Jump(otActiveScanResult *aResult, void *aContext);
     void        HandleActiveScanResult(otActiveScanResult *aResult);
@@ -333,6 +389,8 @@ protected:
     otError CommandHandler_RESET(uint8_t aHeader);
     // Combined command handler for `VALUE_GET`, `VALUE_SET`, `VALUE_INSERT` and `VALUE_REMOVE`.
     otError CommandHandler_PROP_VALUE_update(uint8_t aHeader, unsigned int aCommand);
+    otError CommandHandler_PROP_VALUE_MULTI_GET(uint8_t aHeader);
+    otError CommandHandler_PROP_VALUE_MULTI_SET(uint8_t aHeader);
 #if OPENTHREAD_CONFIG_NCP_ENABLE_PEEK_POKE
     otError CommandHandler_PEEK(uint8_t aHeader);
     otError CommandHandler_POKE(uint8_t aHeader);
@@ -400,6 +458,9 @@ protected:
 
 #if OPENTHREAD_RADIO || OPENTHREAD_ENABLE_RAW_LINK_API
     otError HandlePropertySet_SPINEL_PROP_STREAM_RAW(uint8_t aHeader);
+#if OPENTHREAD_CONFIG_LINK_RAW_TRANSMIT_BATCH_SIZE
+    otError HandlePropertySet_SPINEL_PROP_STREAM_RAW_TX_BATCH(uint8_t aHeader);
+#endif
 #endif
 
 #if OPENTHREAD_ENABLE_LEGACY
@@ -411,8 +472,14 @@ protected:
 #endif
 
     static uint8_t      ConvertLogLevel(otLogLevel aLogLevel);
+    static otError      ConvertSpinelLogLevel(uint8_t aSpinelLogLevel, otLogLevel &aLogLevel);
     static unsigned int ConvertLogRegion(otLogRegion aLogRegion);
 
+#if OPENTHREAD_CONFIG_NCP_ENABLE_TOKENIZED_LOG
+    static uint32_t GetLogToken(const char *aFormat);
+    otError         EncodeLogArguments(const char *aFormat, va_list aArgs);
+#endif
+
 #if OPENTHREAD_ENABLE_NCP_VENDOR_HOOK
     /**
      * This method defines a vendor "command handler" hook to process vendor-specific spinel commands.
@@ -497,6 +564,9 @@ protected:
         kTxBufferSize       = OPENTHREAD_CONFIG_NCP_TX_BUFFER_SIZE, // Tx Buffer size (used by mTxFrameBuffer).
         kResponseQueueSize  = OPENTHREAD_CONFIG_NCP_SPINEL_RESPONSE_QUEUE_SIZE,
         kInvalidScanChannel = -1, // Invalid scan channel.
+#if OPENTHREAD_CONFIG_NCP_RAW_STREAM_BATCH_SIZE
+        kRawStreamBatchSize = OPENTHREAD_CONFIG_NCP_RAW_STREAM_BATCH_SIZE, // Size of `mRawStreamBatch`.
+#endif
     };
 
     spinel_status_t mLastStatus;
@@ -509,6 +579,9 @@ protected:
     Tasklet         mUpdateChangedPropsTask;
     uint32_t        mThreadChangedFlags;
     ChangedPropsSet mChangedPropsSet;
+#if OPENTHREAD_CONFIG_NCP_CHANGED_PROPS_MIN_INTERVAL
+    TimerMilli mChangedPropsHoldOffTimer;
+#endif
 
     spinel_host_power_state_t mHostPowerState;
     NcpFrameBuffer::FrameTag  mHostPowerReplyFrameTag;
@@ -534,6 +607,17 @@ protected:
     bool mDisableStreamWrite;
     bool mShouldEmitChildTableUpdate;
 
+#if OPENTHREAD_CONFIG_NCP_RAW_STREAM_BATCH_SIZE
+    bool     mRawStreamBatchEnabled;
+    uint16_t mRawStreamBatchLength;      // Number of bytes of frame records in `mRawStreamBatch`.
+    uint32_t mRawStreamBatchFirstMsec;   // Timestamp of the first frame in the batch (milliseconds).
+    uint16_t mRawStreamBatchFirstUsec;   // Timestamp of the first frame in the batch (microseconds offset).
+    uint32_t mRawStreamBatchLastTime;    // Timestamp of the last frame in the batch (microseconds).
+    uint32_t mRawStreamBatchDropCounter; // Number of captured frames dropped since batching was enabled.
+    Tasklet  mRawStreamBatchTask;
+    uint8_t  mRawStreamBatch[kRawStreamBatchSize];
+#endif
+
 #if OPENTHREAD_ENABLE_DHCP6_CLIENT
     otDhcpAddress mDhcpAddresses[OPENTHREAD_CONFIG_NUM_DHCP_PREFIXES];
 #endif
@@ -547,12 +631,24 @@ protected:
 
 #if OPENTHREAD_RADIO || OPENTHREAD_ENABLE_RAW_LINK_API
     uint8_t mCurTransmitTID;
-    int8_t  mCurScanChannel;
-    bool    mSrcMatchEnabled;
+#if OPENTHREAD_CONFIG_LINK_RAW_TRANSMIT_BATCH_SIZE
+    uint8_t mCurTransmitBatchTID;
+#endif
+    int8_t mCurScanChannel;
+    bool   mSrcMatchEnabled;
 #endif // OPENTHREAD_RADIO || OPENTHREAD_ENABLE_RAW_LINK_API
 
 #if OPENTHREAD_MTD || OPENTHREAD_FTD
     otMessageQueue mMessageQueue;
+    uint16_t       mStreamNetTxCredits; // Last IPv6 TX credits reported to host.
+    TimerMilli     mStreamNetTxCreditsTimer;
+#if OPENTHREAD_CONFIG_NCP_BUFFER_COUNTERS_STREAM_INTERVAL
+    TimerMilli mBufferCountersTimer;
+    bool       mBufferCountersLow; // Whether the last sample was at or below the low buffer threshold.
+#endif
+#if OPENTHREAD_CONFIG_NCP_ENABLE_STREAM_NET_LOWPAN
+    bool mStreamNetLowpanEnabled;
+#endif
 
     uint32_t mInboundSecureIpFrameCounter;    // Number of secure inbound data/IP frames.
     uint32_t mInboundInsecureIpFrameCounter;  // Number of insecure inbound data/IP frames.
@@ -565,6 +661,7 @@ protected:
     uint32_t mRxSpinelFrameCounter;           // Number of received (inbound) spinel frames.
     uint32_t mRxSpinelOutOfOrderTidCounter;   // Number of out of order received spinel frames (tid increase > 1).
     uint32_t mTxSpinelFrameCounter;           // Number of sent (outbound) spinel frames.
+    uint32_t mTxHostWriteCounter;             // Number of writes to host interface (each may carry many frames).
 
 #if OPENTHREAD_ENABLE_LEGACY
     const otNcpLegacyHandlers *mLegacyHandlers;
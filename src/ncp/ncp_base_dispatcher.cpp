@@ -56,6 +56,9 @@ NcpBase::PropertyHandler NcpBase::FindGetPropertyHandler(spinel_prop_key_t aKey)
     case SPINEL_PROP_DEBUG_NCP_LOG_LEVEL:
         handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_DEBUG_NCP_LOG_LEVEL>;
         break;
+    case SPINEL_PROP_DEBUG_NCP_LOG_REGION_LEVEL:
+        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_DEBUG_NCP_LOG_REGION_LEVEL>;
+        break;
     case SPINEL_PROP_HWADDR:
         handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_HWADDR>;
         break;
@@ -110,6 +113,11 @@ NcpBase::PropertyHandler NcpBase::FindGetPropertyHandler(spinel_prop_key_t aKey)
     case SPINEL_PROP_MAC_RAW_STREAM_ENABLED:
         handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_MAC_RAW_STREAM_ENABLED>;
         break;
+#if OPENTHREAD_CONFIG_NCP_RAW_STREAM_BATCH_SIZE
+    case SPINEL_PROP_MAC_RAW_STREAM_BATCH_ENABLED:
+        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_MAC_RAW_STREAM_BATCH_ENABLED>;
+        break;
+#endif
     case SPINEL_PROP_MAC_PROMISCUOUS_MODE:
         handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_MAC_PROMISCUOUS_MODE>;
         break;
@@ -171,6 +179,12 @@ NcpBase::PropertyHandler NcpBase::FindGetPropertyHandler(spinel_prop_key_t aKey)
     case SPINEL_PROP_MSG_BUFFER_COUNTERS:
         handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_MSG_BUFFER_COUNTERS>;
         break;
+    case SPINEL_PROP_MSG_BUFFER_STATS:
+        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_MSG_BUFFER_STATS>;
+        break;
+    case SPINEL_PROP_STREAM_NET_TX_CREDITS:
+        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_STREAM_NET_TX_CREDITS>;
+        break;
     case SPINEL_PROP_PHY_CHAN_SUPPORTED:
         handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_PHY_CHAN_SUPPORTED>;
         break;
@@ -295,6 +309,11 @@ NcpBase::PropertyHandler NcpBase::FindGetPropertyHandler(spinel_prop_key_t aKey)
     case SPINEL_PROP_IPV6_ICMP_PING_OFFLOAD_MODE:
         handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_IPV6_ICMP_PING_OFFLOAD_MODE>;
         break;
+#if OPENTHREAD_CONFIG_NCP_ENABLE_STREAM_NET_LOWPAN
+    case SPINEL_PROP_IPV6_STREAM_NET_LOWPAN_ENABLED:
+        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_IPV6_STREAM_NET_LOWPAN_ENABLED>;
+        break;
+#endif
     case SPINEL_PROP_IPV6_LL_ADDR:
         handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_IPV6_LL_ADDR>;
         break;
@@ -452,6 +471,24 @@ NcpBase::PropertyHandler NcpBase::FindGetPropertyHandler(spinel_prop_key_t aKey)
     case SPINEL_PROP_CNTR_ALL_MAC_COUNTERS:
         handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_CNTR_ALL_MAC_COUNTERS>;
         break;
+#if OPENTHREAD_CONFIG_ENABLE_MAC_OPERATION_STATS
+    case SPINEL_PROP_CNTR_MAC_OPERATION_STATS:
+        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_CNTR_MAC_OPERATION_STATS>;
+        break;
+#endif
+    case SPINEL_PROP_CNTR_IP_DROP_COUNTERS:
+        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_CNTR_IP_DROP_COUNTERS>;
+        break;
+#if OPENTHREAD_CONFIG_ENABLE_HANDLER_PROFILER
+    case SPINEL_PROP_CNTR_HANDLER_PROFILE:
+        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_CNTR_HANDLER_PROFILE>;
+        break;
+#endif
+#if OPENTHREAD_CONFIG_ENABLE_RADIO_TIME_STATS
+    case SPINEL_PROP_CNTR_RADIO_TIME_STATS:
+        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_CNTR_RADIO_TIME_STATS>;
+        break;
+#endif
         // NCP counters
     case SPINEL_PROP_CNTR_TX_IP_SEC_TOTAL:
         handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_CNTR_TX_IP_SEC_TOTAL>;
@@ -493,6 +530,9 @@ NcpBase::PropertyHandler NcpBase::FindGetPropertyHandler(spinel_prop_key_t aKey)
     case SPINEL_PROP_CNTR_IP_RX_FAILURE:
         handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_CNTR_IP_RX_FAILURE>;
         break;
+    case SPINEL_PROP_CNTR_TX_SPINEL_WRITES:
+        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_CNTR_TX_SPINEL_WRITES>;
+        break;
 #if OPENTHREAD_CONFIG_ENABLE_TIME_SYNC
     case SPINEL_PROP_THREAD_NETWORK_TIME:
         handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_THREAD_NETWORK_TIME>;
@@ -676,6 +716,11 @@ NcpBase::PropertyHandler NcpBase::FindSetPropertyHandler(spinel_prop_key_t aKey)
     case SPINEL_PROP_MAC_RAW_STREAM_ENABLED:
         handler = &NcpBase::HandlePropertySet<SPINEL_PROP_MAC_RAW_STREAM_ENABLED>;
         break;
+#if OPENTHREAD_CONFIG_NCP_RAW_STREAM_BATCH_SIZE
+    case SPINEL_PROP_MAC_RAW_STREAM_BATCH_ENABLED:
+        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_MAC_RAW_STREAM_BATCH_ENABLED>;
+        break;
+#endif
     case SPINEL_PROP_MAC_SCAN_MASK:
         handler = &NcpBase::HandlePropertySet<SPINEL_PROP_MAC_SCAN_MASK>;
         break;
@@ -732,6 +777,11 @@ NcpBase::PropertyHandler NcpBase::FindSetPropertyHandler(spinel_prop_key_t aKey)
     case SPINEL_PROP_STREAM_NET:
         handler = &NcpBase::HandlePropertySet<SPINEL_PROP_STREAM_NET>;
         break;
+#if OPENTHREAD_CONFIG_NCP_ENABLE_STREAM_NET_LOWPAN
+    case SPINEL_PROP_STREAM_NET_LOWPAN:
+        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_STREAM_NET_LOWPAN>;
+        break;
+#endif
     case SPINEL_PROP_IPV6_ML_PREFIX:
         handler = &NcpBase::HandlePropertySet<SPINEL_PROP_IPV6_ML_PREFIX>;
         break;
@@ -741,6 +791,11 @@ NcpBase::PropertyHandler NcpBase::FindSetPropertyHandler(spinel_prop_key_t aKey)
     case SPINEL_PROP_IPV6_ICMP_PING_OFFLOAD_MODE:
         handler = &NcpBase::HandlePropertySet<SPINEL_PROP_IPV6_ICMP_PING_OFFLOAD_MODE>;
         break;
+#if OPENTHREAD_CONFIG_NCP_ENABLE_STREAM_NET_LOWPAN
+    case SPINEL_PROP_IPV6_STREAM_NET_LOWPAN_ENABLED:
+        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_IPV6_STREAM_NET_LOWPAN_ENABLED>;
+        break;
+#endif
     case SPINEL_PROP_THREAD_CHILD_TIMEOUT:
         handler = &NcpBase::HandlePropertySet<SPINEL_PROP_THREAD_CHILD_TIMEOUT>;
         break;
@@ -778,6 +833,9 @@ NcpBase::PropertyHandler NcpBase::FindSetPropertyHandler(spinel_prop_key_t aKey)
     case SPINEL_PROP_DEBUG_NCP_LOG_LEVEL:
         handler = &NcpBase::HandlePropertySet<SPINEL_PROP_DEBUG_NCP_LOG_LEVEL>;
         break;
+    case SPINEL_PROP_DEBUG_NCP_LOG_REGION_LEVEL:
+        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_DEBUG_NCP_LOG_REGION_LEVEL>;
+        break;
     case SPINEL_PROP_THREAD_DISCOVERY_SCAN_JOINER_FLAG:
         handler = &NcpBase::HandlePropertySet<SPINEL_PROP_THREAD_DISCOVERY_SCAN_JOINER_FLAG>;
         break;
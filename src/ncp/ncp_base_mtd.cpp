@@ -57,6 +57,7 @@
 #endif
 #include <openthread/platform/misc.h>
 #include <openthread/platform/radio.h>
+#include <openthread/tasklet.h>
 #if OPENTHREAD_FTD
 #include <openthread/thread_ftd.h>
 #endif
@@ -1419,10 +1420,8 @@ template <> otError NcpBase::HandlePropertySet<SPINEL_PROP_STREAM_NET>(void)
     otMessage *    message  = NULL;
     otError        error    = OT_ERROR_NONE;
 
-    // STREAM_NET requires layer 2 security.
-    message = otIp6NewMessage(mInstance, NULL);
-    VerifyOrExit(message != NULL, error = OT_ERROR_NO_BUFS);
-
+    // The whole frame is decoded before a message is allocated, and
+    // the datagram is then appended straight from the receive buffer.
     SuccessOrExit(error = mDecoder.ReadDataWithLen(framePtr, frameLen));
     SuccessOrExit(error = mDecoder.ReadData(metaPtr, metaLen));
 
@@ -1431,6 +1430,10 @@ template <> otError NcpBase::HandlePropertySet<SPINEL_PROP_STREAM_NET>(void)
     OT_UNUSED_VARIABLE(metaPtr);
     OT_UNUSED_VARIABLE(metaLen);
 
+    // STREAM_NET requires layer 2 security.
+    message = otIp6NewMessage(mInstance, NULL);
+    VerifyOrExit(message != NULL, error = OT_ERROR_NO_BUFS);
+
     SuccessOrExit(error = otMessageAppend(message, framePtr, frameLen));
 
     error = otIp6Send(mInstance, message);
@@ -1456,9 +1459,85 @@ exit:
         mDroppedInboundIpFrameCounter++;
     }
 
+    UpdateStreamNetTxCredits();
+
+    return error;
+}
+
+#if OPENTHREAD_CONFIG_NCP_ENABLE_STREAM_NET_LOWPAN
+
+template <> otError NcpBase::HandlePropertyGet<SPINEL_PROP_IPV6_STREAM_NET_LOWPAN_ENABLED>(void)
+{
+    return mEncoder.WriteBool(mStreamNetLowpanEnabled);
+}
+
+template <> otError NcpBase::HandlePropertySet<SPINEL_PROP_IPV6_STREAM_NET_LOWPAN_ENABLED>(void)
+{
+    return mDecoder.ReadBool(mStreamNetLowpanEnabled);
+}
+
+template <> otError NcpBase::HandlePropertySet<SPINEL_PROP_STREAM_NET_LOWPAN>(void)
+{
+    const uint8_t *framePtr = NULL;
+    uint16_t       frameLen = 0;
+    const uint8_t *metaPtr  = NULL;
+    uint16_t       metaLen  = 0;
+    Message *      message  = NULL;
+    Mac::Address   hostLinkAddress;
+    int            headerLength;
+    otError        error = OT_ERROR_NONE;
+
+    SuccessOrExit(error = mDecoder.ReadDataWithLen(framePtr, frameLen));
+    SuccessOrExit(error = mDecoder.ReadData(metaPtr, metaLen));
+
+    OT_UNUSED_VARIABLE(metaPtr);
+    OT_UNUSED_VARIABLE(metaLen);
+
+    VerifyOrExit(frameLen > 0 && Lowpan::Lowpan::IsLowpanHc(framePtr), error = OT_ERROR_PARSE);
+
+    // STREAM_NET_LOWPAN requires layer 2 security.
+    message = static_cast<Message *>(otIp6NewMessage(mInstance, NULL));
+    VerifyOrExit(message != NULL, error = OT_ERROR_NO_BUFS);
+
+    // Both ends of the host link use the same fixed link-layer address (see `SendCompressedDatagramMessage()`).
+    hostLinkAddress.SetShort(Mac::kShortAddrInvalid);
+    headerLength = mInstance->GetThreadNetif().GetLowpan().Decompress(*message, hostLinkAddress, hostLinkAddress,
+                                                                      framePtr, frameLen, 0);
+    VerifyOrExit(headerLength > 0, error = OT_ERROR_PARSE);
+
+    SuccessOrExit(error = message->Append(framePtr + headerLength, frameLen - static_cast<uint16_t>(headerLength)));
+    message->SetOffset(0);
+
+    error = otIp6Send(mInstance, message);
+
+    // `otIp6Send()` takes ownership of `message` (in both success or
+    // failure cases). `message` is set to NULL so it is not freed at
+    // exit.
+    message = NULL;
+
+exit:
+
+    if (message != NULL)
+    {
+        message->Free();
+    }
+
+    if (error == OT_ERROR_NONE)
+    {
+        mInboundSecureIpFrameCounter++;
+    }
+    else
+    {
+        mDroppedInboundIpFrameCounter++;
+    }
+
+    UpdateStreamNetTxCredits();
+
     return error;
 }
 
+#endif // OPENTHREAD_CONFIG_NCP_ENABLE_STREAM_NET_LOWPAN
+
 #if OPENTHREAD_ENABLE_JAM_DETECTION
 
 template <> otError NcpBase::HandlePropertyGet<SPINEL_PROP_JAM_DETECT_ENABLE>(void)
@@ -1858,6 +1937,11 @@ template <> otError NcpBase::HandlePropertyGet<SPINEL_PROP_CNTR_IP_RX_FAILURE>(v
     return mEncoder.WriteUint32(otThreadGetIp6Counters(mInstance)->mRxFailure);
 }
 
+template <> otError NcpBase::HandlePropertyGet<SPINEL_PROP_CNTR_TX_SPINEL_WRITES>(void)
+{
+    return mEncoder.WriteUint32(mTxHostWriteCounter);
+}
+
 template <> otError NcpBase::HandlePropertyGet<SPINEL_PROP_MSG_BUFFER_COUNTERS>(void)
 {
     otError      error = OT_ERROR_NONE;
@@ -1886,6 +1970,51 @@ exit:
     return error;
 }
 
+template <> otError NcpBase::HandlePropertyGet<SPINEL_PROP_STREAM_NET_TX_CREDITS>(void)
+{
+    return mEncoder.WriteUint16(GetStreamNetTxCredits());
+}
+
+template <> otError NcpBase::HandlePropertyGet<SPINEL_PROP_MSG_BUFFER_STATS>(void)
+{
+    otError      error = OT_ERROR_NONE;
+    otBufferInfo bufferInfo;
+
+    otMessageGetBufferInfo(mInstance, &bufferInfo);
+
+    SuccessOrExit(error = mEncoder.WriteUint16(bufferInfo.mMaxUsedBuffers));
+    SuccessOrExit(error = mEncoder.WriteUint16(bufferInfo.m6loSendMaxBuffers));
+    SuccessOrExit(error = mEncoder.WriteUint16(bufferInfo.m6loReassemblyMaxBuffers));
+    SuccessOrExit(error = mEncoder.WriteUint16(bufferInfo.mIp6MaxBuffers));
+    SuccessOrExit(error = mEncoder.WriteUint16(bufferInfo.mMplMaxBuffers));
+    SuccessOrExit(error = mEncoder.WriteUint16(bufferInfo.mMleMaxBuffers));
+    SuccessOrExit(error = mEncoder.WriteUint16(bufferInfo.mArpMaxBuffers));
+    SuccessOrExit(error = mEncoder.WriteUint16(bufferInfo.mCoapMaxBuffers));
+    SuccessOrExit(error = mEncoder.WriteUint16(bufferInfo.mAllocFailures));
+    SuccessOrExit(error = mEncoder.WriteUint32(bufferInfo.mLowBufferTime));
+
+    SuccessOrExit(error = mEncoder.OpenStruct());
+
+    for (uint8_t i = 0; i < OT_BUFFER_INFO_NUM_MESSAGE_TYPES; i++)
+    {
+        SuccessOrExit(error = mEncoder.WriteUint16(bufferInfo.mTypeAllocFailures[i]));
+    }
+
+    SuccessOrExit(error = mEncoder.CloseStruct());
+
+    SuccessOrExit(error = mEncoder.OpenStruct());
+
+    for (uint8_t i = 0; i < OT_BUFFER_INFO_NUM_MESSAGE_SUBTYPES; i++)
+    {
+        SuccessOrExit(error = mEncoder.WriteUint16(bufferInfo.mSubTypeAllocFailures[i]));
+    }
+
+    SuccessOrExit(error = mEncoder.CloseStruct());
+
+exit:
+    return error;
+}
+
 template <> otError NcpBase::HandlePropertyGet<SPINEL_PROP_CNTR_ALL_MAC_COUNTERS>(void)
 {
     otError              error    = OT_ERROR_NONE;
@@ -1941,6 +2070,121 @@ exit:
     return error;
 }
 
+#if OPENTHREAD_CONFIG_ENABLE_MAC_OPERATION_STATS
+template <> otError NcpBase::HandlePropertyGet<SPINEL_PROP_CNTR_MAC_OPERATION_STATS>(void)
+{
+    otError error = OT_ERROR_NONE;
+
+    for (uint8_t operation = 0; operation < OT_MAC_NUM_OPERATIONS; operation++)
+    {
+        const otMacOperationStats *stats = otLinkGetOperationStats(mInstance, static_cast<otMacOperation>(operation));
+
+        SuccessOrExit(error = mEncoder.OpenStruct());
+
+        SuccessOrExit(error = mEncoder.WriteUint8(operation));
+        SuccessOrExit(error = mEncoder.WriteUint32(stats->mCount));
+        SuccessOrExit(error = mEncoder.WriteUint32(stats->mTotalQueueTime));
+        SuccessOrExit(error = mEncoder.WriteUint32(stats->mMaxQueueTime));
+        SuccessOrExit(error = mEncoder.WriteUint32(stats->mTotalExecutionTime));
+        SuccessOrExit(error = mEncoder.WriteUint32(stats->mMaxExecutionTime));
+
+        SuccessOrExit(error = mEncoder.OpenStruct());
+
+        for (uint8_t i = 0; i < OT_MAC_OPERATION_HISTOGRAM_BINS; i++)
+        {
+            SuccessOrExit(error = mEncoder.WriteUint32(stats->mQueueTimeHistogram[i]));
+        }
+
+        SuccessOrExit(error = mEncoder.CloseStruct());
+
+        SuccessOrExit(error = mEncoder.OpenStruct());
+
+        for (uint8_t i = 0; i < OT_MAC_OPERATION_HISTOGRAM_BINS; i++)
+        {
+            SuccessOrExit(error = mEncoder.WriteUint32(stats->mExecutionTimeHistogram[i]));
+        }
+
+        SuccessOrExit(error = mEncoder.CloseStruct());
+
+        SuccessOrExit(error = mEncoder.CloseStruct());
+    }
+
+exit:
+    return error;
+}
+#endif // OPENTHREAD_CONFIG_ENABLE_MAC_OPERATION_STATS
+
+template <> otError NcpBase::HandlePropertyGet<SPINEL_PROP_CNTR_IP_DROP_COUNTERS>(void)
+{
+    otError                  error = OT_ERROR_NONE;
+    const otIp6DropCounters *mesh  = otThreadGetDropCounters(mInstance);
+    const otIp6DropCounters *ip6   = otIp6GetDropCounters(mInstance);
+
+    for (uint8_t reason = 0; reason < OT_IP6_NUM_DROP_REASONS; reason++)
+    {
+        SuccessOrExit(error = mEncoder.OpenStruct());
+
+        SuccessOrExit(error = mEncoder.WriteUint8(reason));
+        SuccessOrExit(error = mEncoder.WriteUint32(mesh->mTx[reason]));
+        SuccessOrExit(error = mEncoder.WriteUint32(mesh->mRx[reason]));
+        SuccessOrExit(error = mEncoder.WriteUint32(ip6->mTx[reason]));
+        SuccessOrExit(error = mEncoder.WriteUint32(ip6->mRx[reason]));
+
+        SuccessOrExit(error = mEncoder.CloseStruct());
+    }
+
+exit:
+    return error;
+}
+
+#if OPENTHREAD_CONFIG_ENABLE_HANDLER_PROFILER
+template <> otError NcpBase::HandlePropertyGet<SPINEL_PROP_CNTR_HANDLER_PROFILE>(void)
+{
+    otError                  error    = OT_ERROR_NONE;
+    otHandlerProfileIterator iterator = OT_HANDLER_PROFILE_ITERATOR_INIT;
+    otHandlerProfile         profile;
+
+    while (otTaskletGetNextHandlerProfile(mInstance, &iterator, &profile) == OT_ERROR_NONE)
+    {
+        SuccessOrExit(error = mEncoder.OpenStruct());
+
+        SuccessOrExit(error = mEncoder.WriteUint8(static_cast<uint8_t>(profile.mType)));
+        SuccessOrExit(error = mEncoder.WriteUint64(profile.mHandler));
+        SuccessOrExit(error = mEncoder.WriteUint32(profile.mCount));
+        SuccessOrExit(error = mEncoder.WriteUint64(profile.mTotalTime));
+        SuccessOrExit(error = mEncoder.WriteUint32(profile.mMaxTime));
+
+        SuccessOrExit(error = mEncoder.CloseStruct());
+    }
+
+exit:
+    return error;
+}
+#endif // OPENTHREAD_CONFIG_ENABLE_HANDLER_PROFILER
+
+#if OPENTHREAD_CONFIG_ENABLE_RADIO_TIME_STATS
+template <> otError NcpBase::HandlePropertyGet<SPINEL_PROP_CNTR_RADIO_TIME_STATS>(void)
+{
+    otError                 error = OT_ERROR_NONE;
+    const otRadioTimeStats *stats = otLinkGetRadioTimeStats(mInstance);
+
+    for (uint8_t i = 0; i < OT_RADIO_NUM_TIME_CAUSES; i++)
+    {
+        SuccessOrExit(error = mEncoder.OpenStruct());
+
+        SuccessOrExit(error = mEncoder.WriteUint8(i));
+        SuccessOrExit(error = mEncoder.WriteUint64(stats->mCauseTime[i][OT_RADIO_TIME_STATE_SLEEP]));
+        SuccessOrExit(error = mEncoder.WriteUint64(stats->mCauseTime[i][OT_RADIO_TIME_STATE_RECEIVE]));
+        SuccessOrExit(error = mEncoder.WriteUint64(stats->mCauseTime[i][OT_RADIO_TIME_STATE_TRANSMIT]));
+
+        SuccessOrExit(error = mEncoder.CloseStruct());
+    }
+
+exit:
+    return error;
+}
+#endif // OPENTHREAD_CONFIG_ENABLE_RADIO_TIME_STATS
+
 #if OPENTHREAD_ENABLE_MAC_FILTER
 
 template <> otError NcpBase::HandlePropertyGet<SPINEL_PROP_MAC_WHITELIST>(void)
@@ -2261,20 +2505,20 @@ template <> otError NcpBase::HandlePropertySet<SPINEL_PROP_STREAM_NET_INSECURE>(
     uint16_t          metaLen     = 0;
     otMessage *       message     = NULL;
     otError           error       = OT_ERROR_NONE;
-    otMessageSettings msgSettings = {false, OT_MESSAGE_PRIORITY_NORMAL};
-
-    // STREAM_NET_INSECURE packets are not secured at layer 2.
-    message = otIp6NewMessage(mInstance, &msgSettings);
-    VerifyOrExit(message != NULL, error = OT_ERROR_NO_BUFS);
+    otMessageSettings msgSettings = {false, OT_MESSAGE_PRIORITY_NORMAL, 0};
 
-    SuccessOrExit(mDecoder.ReadDataWithLen(framePtr, frameLen));
-    SuccessOrExit(mDecoder.ReadData(metaPtr, metaLen));
+    SuccessOrExit(error = mDecoder.ReadDataWithLen(framePtr, frameLen));
+    SuccessOrExit(error = mDecoder.ReadData(metaPtr, metaLen));
 
     // We ignore metadata for now.
     // May later include TX power, allow retransmits, etc...
     OT_UNUSED_VARIABLE(metaPtr);
     OT_UNUSED_VARIABLE(metaLen);
 
+    // STREAM_NET_INSECURE packets are not secured at layer 2.
+    message = otIp6NewMessage(mInstance, &msgSettings);
+    VerifyOrExit(message != NULL, error = OT_ERROR_NO_BUFS);
+
     SuccessOrExit(error = otMessageAppend(message, framePtr, frameLen));
 
     // Ensure the insecure message is forwarded using direct transmission.
@@ -2302,6 +2546,8 @@ exit:
         mDroppedInboundIpFrameCounter++;
     }
 
+    UpdateStreamNetTxCredits();
+
     return error;
 }
 
@@ -2792,6 +3038,14 @@ void NcpBase::HandleDatagramFromStack(otMessage *aMessage)
         IgnoreReturnValue(SendQueuedDatagramMessages());
     }
 
+    // Received datagrams hold message buffers until they are sent to
+    // the host, so re-evaluate the IPv6 TX credits once they drain.
+
+    if (!mStreamNetTxCreditsTimer.IsRunning())
+    {
+        mStreamNetTxCreditsTimer.Start(OPENTHREAD_CONFIG_NCP_TX_CREDITS_POLL_INTERVAL);
+    }
+
 exit:
     return;
 }
@@ -2803,6 +3057,15 @@ otError NcpBase::SendDatagramMessage(otMessage *aMessage)
     bool              isSecure = otMessageIsLinkSecurityEnabled(aMessage);
     spinel_prop_key_t propKey  = isSecure ? SPINEL_PROP_STREAM_NET : SPINEL_PROP_STREAM_NET_INSECURE;
 
+#if OPENTHREAD_CONFIG_NCP_ENABLE_STREAM_NET_LOWPAN
+    if (isSecure && mStreamNetLowpanEnabled)
+    {
+        SuccessOrExit(error = SendCompressedDatagramMessage(aMessage));
+        mOutboundSecureIpFrameCounter++;
+        ExitNow();
+    }
+#endif
+
     SuccessOrExit(error = mEncoder.BeginFrame(header, SPINEL_CMD_PROP_VALUE_IS, propKey));
     SuccessOrExit(error = mEncoder.WriteUint16(otMessageGetLength(aMessage)));
     SuccessOrExit(error = mEncoder.WriteMessage(aMessage));
@@ -2824,6 +3087,52 @@ exit:
     return error;
 }
 
+#if OPENTHREAD_CONFIG_NCP_ENABLE_STREAM_NET_LOWPAN
+otError NcpBase::SendCompressedDatagramMessage(otMessage *aMessage)
+{
+    otError      error   = OT_ERROR_NONE;
+    uint8_t      header  = SPINEL_HEADER_FLAG | SPINEL_HEADER_IID_0;
+    Message &    message = *static_cast<Message *>(aMessage);
+    uint8_t      buffer[OT_RADIO_FRAME_MAX_SIZE];
+    Mac::Address hostLinkAddress;
+    int          headerLength;
+    uint16_t     offset;
+    uint16_t     length;
+
+    // The host link has no link-layer addresses, so both ends use the same fixed short address. This way neither
+    // side needs any per-neighbor state to rebuild an elided interface identifier.
+    hostLinkAddress.SetShort(Mac::kShortAddrInvalid);
+
+    message.SetOffset(0);
+    headerLength = mInstance->GetThreadNetif().GetLowpan().Compress(message, hostLinkAddress, hostLinkAddress, buffer);
+    offset       = message.GetOffset();
+
+    // `Compress()` moves the offset past the compressed headers. The message is restored so that it can be sent
+    // again unchanged if the frame cannot be finished.
+    message.SetOffset(0);
+
+    SuccessOrExit(error = mEncoder.BeginFrame(header, SPINEL_CMD_PROP_VALUE_IS, SPINEL_PROP_STREAM_NET_LOWPAN));
+    SuccessOrExit(error = mEncoder.WriteUint16(static_cast<uint16_t>(headerLength) + message.GetLength() - offset));
+    SuccessOrExit(error = mEncoder.WriteData(buffer, static_cast<uint16_t>(headerLength)));
+
+    // The payload is copied into the frame (rather than using `WriteMessage()`), since the frame cannot take over
+    // only part of a message.
+    while (offset < message.GetLength())
+    {
+        length = message.Read(offset, sizeof(buffer), buffer);
+        SuccessOrExit(error = mEncoder.WriteData(buffer, length));
+        offset += length;
+    }
+
+    SuccessOrExit(error = mEncoder.EndFrame());
+
+    message.Free();
+
+exit:
+    return error;
+}
+#endif // OPENTHREAD_CONFIG_NCP_ENABLE_STREAM_NET_LOWPAN
+
 otError NcpBase::SendQueuedDatagramMessages(void)
 {
     otError    error = OT_ERROR_NONE;
@@ -2853,6 +3162,85 @@ exit:
     return error;
 }
 
+uint16_t NcpBase::GetStreamNetTxCredits(void) const
+{
+    enum
+    {
+        kBufferDataSize = OPENTHREAD_CONFIG_MESSAGE_BUFFER_SIZE - sizeof(otMessage),
+
+        // Estimated number of message buffers used by a maximum-size IPv6 datagram. The extra
+        // buffer accounts for the message metadata stored in the first buffer.
+        kBuffersPerDatagram = (OPENTHREAD_CONFIG_IPV6_DEFAULT_MAX_DATAGRAM + kBufferDataSize - 1) / kBufferDataSize + 1,
+    };
+
+    otBufferInfo bufferInfo;
+
+    otMessageGetBufferInfo(mInstance, &bufferInfo);
+
+    return bufferInfo.mFreeBuffers / kBuffersPerDatagram;
+}
+
+void NcpBase::UpdateStreamNetTxCredits(void)
+{
+    uint16_t credits = GetStreamNetTxCredits();
+
+    VerifyOrExit(credits != mStreamNetTxCredits);
+
+    mStreamNetTxCredits = credits;
+    mChangedPropsSet.AddProperty(SPINEL_PROP_STREAM_NET_TX_CREDITS);
+    mUpdateChangedPropsTask.Post();
+
+    // Message buffer releases are not signaled to NCP, so keep polling
+    // the free buffer count for as long as it is changing.
+
+    mStreamNetTxCreditsTimer.Start(OPENTHREAD_CONFIG_NCP_TX_CREDITS_POLL_INTERVAL);
+
+exit:
+    return;
+}
+
+void NcpBase::HandleStreamNetTxCreditsTimer(Timer &aTimer)
+{
+    OT_UNUSED_VARIABLE(aTimer);
+    GetNcpInstance()->HandleStreamNetTxCreditsTimer();
+}
+
+void NcpBase::HandleStreamNetTxCreditsTimer(void)
+{
+    UpdateStreamNetTxCredits();
+}
+
+#if OPENTHREAD_CONFIG_NCP_BUFFER_COUNTERS_STREAM_INTERVAL
+
+void NcpBase::HandleBufferCountersTimer(Timer &aTimer)
+{
+    OT_UNUSED_VARIABLE(aTimer);
+    GetNcpInstance()->HandleBufferCountersTimer();
+}
+
+void NcpBase::HandleBufferCountersTimer(void)
+{
+    otBufferInfo bufferInfo;
+    bool         isLow;
+
+    otMessageGetBufferInfo(mInstance, &bufferInfo);
+    isLow = (bufferInfo.mFreeBuffers <= OPENTHREAD_CONFIG_NCP_BUFFER_COUNTERS_LOW_THRESHOLD);
+
+    // The counters are encoded when the update frame is written, so a
+    // pending update which is not yet sent carries the latest values.
+
+    if ((OPENTHREAD_CONFIG_NCP_BUFFER_COUNTERS_LOW_THRESHOLD == 0) || isLow || mBufferCountersLow)
+    {
+        mChangedPropsSet.AddProperty(SPINEL_PROP_MSG_BUFFER_COUNTERS);
+        mUpdateChangedPropsTask.Post();
+    }
+
+    mBufferCountersLow = isLow;
+    mBufferCountersTimer.Start(OPENTHREAD_CONFIG_NCP_BUFFER_COUNTERS_STREAM_INTERVAL);
+}
+
+#endif // OPENTHREAD_CONFIG_NCP_BUFFER_COUNTERS_STREAM_INTERVAL
+
 #if OPENTHREAD_ENABLE_UDP_FORWARD
 template <> otError NcpBase::HandlePropertySet<SPINEL_PROP_THREAD_UDP_FORWARD_STREAM>(void)
 {
@@ -2863,7 +3251,7 @@ template <> otError NcpBase::HandlePropertySet<SPINEL_PROP_THREAD_UDP_FORWARD_ST
     uint16_t            sockPort;
     otMessage *         message;
     otError             error       = OT_ERROR_NONE;
-    otMessageSettings   msgSettings = {false, OT_MESSAGE_PRIORITY_NORMAL};
+    otMessageSettings   msgSettings = {false, OT_MESSAGE_PRIORITY_NORMAL, 0};
 
     message = otIp6NewMessage(mInstance, &msgSettings);
     VerifyOrExit(message != NULL, error = OT_ERROR_NO_BUFS);
@@ -2945,6 +3333,14 @@ void NcpBase::HandlePcapFrame(const otRadioFrame *aFrame)
 
     VerifyOrExit(mPcapEnabled);
 
+#if OPENTHREAD_CONFIG_NCP_RAW_STREAM_BATCH_SIZE
+    if (mRawStreamBatchEnabled)
+    {
+        AddFrameToRawStreamBatch(*aFrame);
+        ExitNow();
+    }
+#endif
+
     if (aFrame->mDidTx)
     {
         flags |= SPINEL_MD_FLAG_TX;
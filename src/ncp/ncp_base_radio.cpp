@@ -61,6 +61,18 @@ void NcpBase::LinkRawReceiveDone(otRadioFrame *aFrame, otError aError)
     uint16_t flags  = 0;
     uint8_t  header = SPINEL_HEADER_FLAG | SPINEL_HEADER_IID_0;
 
+#if OPENTHREAD_CONFIG_NCP_RAW_STREAM_BATCH_SIZE
+    if (mRawStreamBatchEnabled)
+    {
+        if (aError == OT_ERROR_NONE)
+        {
+            AddFrameToRawStreamBatch(*aFrame);
+        }
+
+        ExitNow();
+    }
+#endif
+
     if (aFrame->mDidTx)
     {
         flags |= SPINEL_MD_FLAG_TX;
@@ -142,6 +154,35 @@ exit:
     return;
 }
 
+#if OPENTHREAD_CONFIG_LINK_RAW_TRANSMIT_BATCH_SIZE
+void NcpBase::LinkRawTransmitBatchDone(otInstance *, const otError *aErrors, uint8_t aCount)
+{
+    sNcpInstance->LinkRawTransmitBatchDone(aErrors, aCount);
+}
+
+void NcpBase::LinkRawTransmitBatchDone(const otError *aErrors, uint8_t aCount)
+{
+    uint8_t header = SPINEL_HEADER_FLAG | SPINEL_HEADER_IID_0 | mCurTransmitBatchTID;
+
+    VerifyOrExit(mCurTransmitBatchTID != 0);
+
+    // Clear cached transmit batch TID
+    mCurTransmitBatchTID = 0;
+
+    SuccessOrExit(mEncoder.BeginFrame(header, SPINEL_CMD_PROP_VALUE_IS, SPINEL_PROP_STREAM_RAW_TX_BATCH));
+
+    for (uint8_t i = 0; i < aCount; i++)
+    {
+        SuccessOrExit(mEncoder.WriteUintPacked(ThreadErrorToSpinelStatus(aErrors[i])));
+    }
+
+    SuccessOrExit(mEncoder.EndFrame());
+
+exit:
+    return;
+}
+#endif // OPENTHREAD_CONFIG_LINK_RAW_TRANSMIT_BATCH_SIZE
+
 void NcpBase::LinkRawEnergyScanDone(otInstance *, int8_t aEnergyScanMaxRssi)
 {
     sNcpInstance->LinkRawEnergyScanDone(aEnergyScanMaxRssi);
@@ -223,19 +264,20 @@ exit:
 
 template <> otError NcpBase::HandlePropertySet<SPINEL_PROP_MAC_SRC_MATCH_EXTENDED_ADDRESSES>(void)
 {
-    otError error = OT_ERROR_NONE;
+    otError             error = OT_ERROR_NONE;
+    const otExtAddress *extAddresses;
+    uint16_t            count;
+
+    // The addresses are used in place from the frame.
+    SuccessOrExit(error = mDecoder.ReadArray(extAddresses, count));
 
     // Clear the list first
     SuccessOrExit(error = otLinkRawSrcMatchClearExtEntries(mInstance));
 
     // Loop through the addresses and add them
-    while (mDecoder.GetRemainingLengthInStruct() >= sizeof(otExtAddress))
+    for (uint16_t i = 0; i < count; i++)
     {
-        const otExtAddress *extAddress;
-
-        SuccessOrExit(error = mDecoder.ReadEui64(extAddress));
-
-        SuccessOrExit(error = otLinkRawSrcMatchAddExtEntry(mInstance, extAddress));
+        SuccessOrExit(error = otLinkRawSrcMatchAddExtEntry(mInstance, &extAddresses[i]));
     }
 
 exit:
@@ -363,9 +405,21 @@ otError NcpBase::HandlePropertySet_SPINEL_PROP_STREAM_RAW(uint8_t aHeader)
     frame->mLength = static_cast<uint8_t>(frameLen);
     memcpy(frame->mPsdu, frameBuffer, frame->mLength);
 
-    // TODO: This should be later added in the STREAM_RAW argument to allow user to directly specify it.
     frame->mInfo.mTxInfo.mMaxCsmaBackoffs = OPENTHREAD_CONFIG_MAC_MAX_CSMA_BACKOFFS_DIRECT;
     frame->mInfo.mTxInfo.mMaxFrameRetries = OPENTHREAD_CONFIG_MAC_MAX_FRAME_RETRIES_DIRECT;
+    frame->mInfo.mTxInfo.mCsmaCaEnabled   = true;
+
+    // The host may pass the transmit parameters of the frame, so that CSMA-CA and retransmissions are done here
+    // exactly as the host MAC would do them.
+    if (!mDecoder.IsAllRead())
+    {
+        bool csmaCaEnabled;
+
+        SuccessOrExit(error = mDecoder.ReadUint8(frame->mInfo.mTxInfo.mMaxCsmaBackoffs));
+        SuccessOrExit(error = mDecoder.ReadUint8(frame->mInfo.mTxInfo.mMaxFrameRetries));
+        SuccessOrExit(error = mDecoder.ReadBool(csmaCaEnabled));
+        frame->mInfo.mTxInfo.mCsmaCaEnabled = csmaCaEnabled;
+    }
 
     // Pass frame to the radio layer. Note, this fails if we
     // haven't enabled raw stream or are already transmitting.
@@ -385,6 +439,50 @@ exit:
     return error;
 }
 
+#if OPENTHREAD_CONFIG_LINK_RAW_TRANSMIT_BATCH_SIZE
+otError NcpBase::HandlePropertySet_SPINEL_PROP_STREAM_RAW_TX_BATCH(uint8_t aHeader)
+{
+    otLinkRawBatchFrame frames[OPENTHREAD_CONFIG_LINK_RAW_TRANSMIT_BATCH_SIZE];
+    uint8_t             count    = 0;
+    uint16_t            frameLen = 0;
+    otError             error    = OT_ERROR_NONE;
+
+    VerifyOrExit(otLinkRawIsEnabled(mInstance), error = OT_ERROR_INVALID_STATE);
+
+    while (!mDecoder.IsAllRead())
+    {
+        VerifyOrExit(count < OPENTHREAD_CONFIG_LINK_RAW_TRANSMIT_BATCH_SIZE, error = OT_ERROR_NO_BUFS);
+
+        SuccessOrExit(error = mDecoder.OpenStruct());
+        SuccessOrExit(error = mDecoder.ReadDataWithLen(frames[count].mPsdu, frameLen));
+        VerifyOrExit(frameLen <= OT_RADIO_FRAME_MAX_SIZE, error = OT_ERROR_PARSE);
+        frames[count].mLength = static_cast<uint8_t>(frameLen);
+        SuccessOrExit(error = mDecoder.ReadUint8(frames[count].mChannel));
+        SuccessOrExit(error = mDecoder.ReadUint8(frames[count].mMaxCsmaBackoffs));
+        SuccessOrExit(error = mDecoder.ReadUint8(frames[count].mMaxFrameRetries));
+        SuccessOrExit(error = mDecoder.ReadBool(frames[count].mCsmaCaEnabled));
+        SuccessOrExit(error = mDecoder.CloseStruct());
+
+        count++;
+    }
+
+    // The frames are copied by `otLinkRawTransmitBatch()`, so they may point into the receive buffer.
+    SuccessOrExit(error = otLinkRawTransmitBatch(mInstance, frames, count, &NcpBase::LinkRawTransmitBatchDone));
+
+    // Cache the transaction ID for async response
+    mCurTransmitBatchTID = SPINEL_HEADER_GET_TID(aHeader);
+
+exit:
+
+    if (error != OT_ERROR_NONE)
+    {
+        error = WriteLastStatusFrame(aHeader, ThreadErrorToSpinelStatus(error));
+    }
+
+    return error;
+}
+#endif // OPENTHREAD_CONFIG_LINK_RAW_TRANSMIT_BATCH_SIZE
+
 } // namespace Ncp
 } // namespace ot
 
@@ -32,8 +32,11 @@
 
 #include "ncp_buffer.hpp"
 
+#include <openthread/ip6.h>
+
 #include "common/code_utils.hpp"
 #include "common/debug.hpp"
+#include "common/message.hpp"
 #include "utils/wrap_string.h"
 
 namespace ot {
@@ -45,6 +48,10 @@ NcpFrameBuffer::NcpFrameBuffer(uint8_t *aBuffer, uint16_t aBufferLen)
     : mBuffer(aBuffer)
     , mBufferEnd(aBuffer + aBufferLen)
     , mBufferLength(aBufferLen)
+#if OPENTHREAD_CONFIG_NCP_TX_BUFFER_MESSAGE_SPILL
+    , mMessagePoolInstance(NULL)
+    , mWriteNumSpillMessages(0)
+#endif
 {
     for (uint8_t priority = 0; priority < kNumPrios; priority++)
     {
@@ -81,8 +88,9 @@ void NcpFrameBuffer::Clear(void)
     mReadPointer                   = mBuffer;
 
     mReadMessage       = NULL;
-    mReadMessageOffset = 0;
-    mReadMessageTail   = mMessageBuffer;
+    mReadMessageOffset  = 0;
+    mReadMessagePointer = NULL;
+    mReadMessageTail    = NULL;
 
     // Free all messages in the queues.
 
@@ -95,6 +103,10 @@ void NcpFrameBuffer::Clear(void)
         // be freed.
     }
 
+#if OPENTHREAD_CONFIG_NCP_TX_BUFFER_MESSAGE_SPILL
+    InFrameFreeSpillMessages();
+#endif
+
     for (uint8_t priority = 0; priority < kNumPrios; priority++)
     {
         while ((message = otMessageQueueGetHead(&mMessageQueue[priority])) != NULL)
@@ -315,6 +327,11 @@ void NcpFrameBuffer::InFrameDiscard(void)
         // therefore should not be freed.
     }
 
+#if OPENTHREAD_CONFIG_NCP_TX_BUFFER_MESSAGE_SPILL
+    // Messages allocated by the `NcpFrameBuffer` itself are freed.
+    InFrameFreeSpillMessages();
+#endif
+
     mWriteDirection = kUnknown;
 
 exit:
@@ -370,6 +387,16 @@ otError NcpFrameBuffer::InFrameFeedData(const uint8_t *aDataBuffer, uint16_t aDa
 
     VerifyOrExit(mWriteDirection != kUnknown, error = OT_ERROR_INVALID_STATE);
 
+#if OPENTHREAD_CONFIG_NCP_TX_BUFFER_MESSAGE_SPILL
+    // Move the data into a message when it does not fit in the remaining buffer space. If this fails, the data is
+    // written to the buffer which then fails with `OT_ERROR_NO_BUFS` and discards the frame, as before.
+    if ((InFrameGetFreeSpace() < aDataBufferLength + kSegmentHeaderSize) &&
+        (InFrameSpillData(aDataBuffer, aDataBufferLength) == OT_ERROR_NONE))
+    {
+        ExitNow();
+    }
+#endif
+
     // Begin a new segment (if we are not in middle of segment already).
     SuccessOrExit(error = InFrameBeginSegment());
 
@@ -513,6 +540,11 @@ otError NcpFrameBuffer::InFrameEnd(void)
         otMessageQueueEnqueue(&mMessageQueue[mWriteDirection], message);
     }
 
+#if OPENTHREAD_CONFIG_NCP_TX_BUFFER_MESSAGE_SPILL
+    // The allocated messages are now part of the frame and get freed along with it.
+    mWriteNumSpillMessages = 0;
+#endif
+
     if (mFrameAddedCallback != NULL)
     {
         mFrameAddedCallback(mFrameAddedContext, mWriteFrameTag, static_cast<Priority>(mWriteDirection), this);
@@ -524,6 +556,70 @@ exit:
     return error;
 }
 
+#if OPENTHREAD_CONFIG_NCP_TX_BUFFER_MESSAGE_SPILL
+
+// Returns the number of bytes which can still be appended to the current input frame.
+uint16_t NcpFrameBuffer::InFrameGetFreeSpace(void) const
+{
+    uint16_t distance;
+
+    distance = GetDistance(mWriteSegmentTail, mWriteFrameStart[(mWriteDirection == kForward) ? kBackward : kForward],
+                           mWriteDirection);
+
+    return (distance > 0) ? distance - 1 : 0;
+}
+
+// This method moves the given data into a new message from the message pool and appends it to the current frame.
+otError NcpFrameBuffer::InFrameSpillData(const uint8_t *aDataBuffer, uint16_t aDataBufferLength)
+{
+    otError           error    = OT_ERROR_NONE;
+    otMessage *       message  = NULL;
+    otMessageSettings settings = {false, OT_MESSAGE_PRIORITY_LOW, 0};
+    otBufferInfo      bufferInfo;
+    uint16_t          reserve;
+
+    VerifyOrExit(mMessagePoolInstance != NULL, error = OT_ERROR_NO_BUFS);
+    VerifyOrExit(mWriteNumSpillMessages < kMaxSpillMessages, error = OT_ERROR_NO_BUFS);
+
+    // A segment header may be needed to append the message.
+    VerifyOrExit(InFrameGetFreeSpace() >= kSegmentHeaderSize, error = OT_ERROR_NO_BUFS);
+
+    // Low priority frames leave more message buffers free than high priority ones.
+    reserve = (mWriteDirection == kBackward) ? OPENTHREAD_CONFIG_NCP_TX_BUFFER_SPILL_HIGH_PRIORITY_RESERVE
+                                             : OPENTHREAD_CONFIG_NCP_TX_BUFFER_SPILL_LOW_PRIORITY_RESERVE;
+
+    otMessageGetBufferInfo(mMessagePoolInstance, &bufferInfo);
+    VerifyOrExit(bufferInfo.mFreeBuffers > reserve, error = OT_ERROR_NO_BUFS);
+
+    // The low message priority ensures no queued message gets evicted to make room for the data.
+    message = otIp6NewMessage(mMessagePoolInstance, &settings);
+    VerifyOrExit(message != NULL, error = OT_ERROR_NO_BUFS);
+
+    SuccessOrExit(error = otMessageAppend(message, aDataBuffer, aDataBufferLength));
+    SuccessOrExit(error = InFrameFeedMessage(message));
+
+    mWriteSpillMessages[mWriteNumSpillMessages++] = message;
+
+exit:
+    if ((error != OT_ERROR_NONE) && (message != NULL))
+    {
+        otMessageFree(message);
+    }
+
+    return error;
+}
+
+// This method frees the messages allocated for the current input frame.
+void NcpFrameBuffer::InFrameFreeSpillMessages(void)
+{
+    while (mWriteNumSpillMessages > 0)
+    {
+        otMessageFree(mWriteSpillMessages[--mWriteNumSpillMessages]);
+    }
+}
+
+#endif // OPENTHREAD_CONFIG_NCP_TX_BUFFER_MESSAGE_SPILL
+
 NcpFrameBuffer::FrameTag NcpFrameBuffer::InFrameGetLastTag(void) const
 {
     return mWriteFrameTag;
@@ -606,8 +702,8 @@ exit:
     return error;
 }
 
-// This method prepares an associated message in current segment and fills the message buffer. It returns
-// ThreadError_NotFound if there is no message or if the message has no content.
+// This method prepares an associated message in current segment and its first chunk. It returns OT_ERROR_NOT_FOUND
+// if there is no message or if the message has no content.
 otError NcpFrameBuffer::OutFramePrepareMessage(void)
 {
     otError  error = OT_ERROR_NONE;
@@ -628,8 +724,8 @@ otError NcpFrameBuffer::OutFramePrepareMessage(void)
     // Reset the offset for reading the message.
     mReadMessageOffset = 0;
 
-    // Fill the content from current message into the message buffer.
-    SuccessOrExit(error = OutFrameFillMessageBuffer());
+    // Prepare the first chunk of the current message.
+    SuccessOrExit(error = OutFramePrepareMessageChunk());
 
     // If all successful, set the state to `InMessage`.
     mReadState = kReadStateInMessage;
@@ -638,29 +734,33 @@ exit:
     return error;
 }
 
-// This method fills content from current message into the message buffer. It returns OT_ERROR_NOT_FOUND if no more
-// content in the current message.
-otError NcpFrameBuffer::OutFrameFillMessageBuffer(void)
+// This method prepares the next contiguous chunk of the current message (pointing directly into a message buffer). It
+// returns OT_ERROR_NOT_FOUND if no more content in the current message.
+otError NcpFrameBuffer::OutFramePrepareMessageChunk(void)
 {
-    otError error = OT_ERROR_NONE;
-    int     readLength;
+    otError        error = OT_ERROR_NONE;
+    Message *      message;
+    Message::Chunk chunk;
+    uint16_t       length;
 
     VerifyOrExit(mReadMessage != NULL, error = OT_ERROR_NOT_FOUND);
 
-    VerifyOrExit(mReadMessageOffset < otMessageGetLength(mReadMessage), error = OT_ERROR_NOT_FOUND);
+    message = static_cast<Message *>(mReadMessage);
 
-    // Read portion of current message from the offset into message buffer.
-    readLength = otMessageRead(mReadMessage, mReadMessageOffset, mMessageBuffer, sizeof(mMessageBuffer));
+    VerifyOrExit(mReadMessageOffset < message->GetLength(), error = OT_ERROR_NOT_FOUND);
 
-    VerifyOrExit(readLength > 0, error = OT_ERROR_NOT_FOUND);
+    // Get the chunk of current message starting at the offset.
+    length = message->GetLength() - mReadMessageOffset;
+    static_cast<const Message *>(message)->GetFirstChunk(mReadMessageOffset, length, chunk);
 
-    // Update the message offset, set up the message tail, and set read pointer to start of message buffer.
+    VerifyOrExit(chunk.mLength > 0, error = OT_ERROR_NOT_FOUND);
 
-    mReadMessageOffset += readLength;
+    // Update the message offset, and set up the read pointer and tail to the chunk.
 
-    mReadMessageTail = mMessageBuffer + readLength;
+    mReadMessageOffset += chunk.mLength;
 
-    mReadPointer = mMessageBuffer;
+    mReadMessagePointer = chunk.mData;
+    mReadMessageTail    = chunk.mData + chunk.mLength;
 
 exit:
     return error;
@@ -693,8 +793,36 @@ bool NcpFrameBuffer::OutFrameHasEnded(void)
 
 uint8_t NcpFrameBuffer::OutFrameReadByte(void)
 {
-    otError error;
-    uint8_t retval = kReadByteAfterFrameHasEnded;
+    const uint8_t *chunk;
+    uint8_t        retval = kReadByteAfterFrameHasEnded;
+
+    if (OutFrameReadChunk(1, chunk) != 0)
+    {
+        retval = *chunk;
+    }
+
+    return retval;
+}
+
+uint16_t NcpFrameBuffer::OutFrameRead(uint16_t aReadLength, uint8_t *aDataBuffer)
+{
+    uint16_t       bytesRead = 0;
+    const uint8_t *chunk;
+    uint16_t       chunkLength;
+
+    while ((bytesRead < aReadLength) && ((chunkLength = OutFrameReadChunk(aReadLength - bytesRead, chunk)) != 0))
+    {
+        memcpy(aDataBuffer + bytesRead, chunk, chunkLength);
+        bytesRead += chunkLength;
+    }
+
+    return bytesRead;
+}
+
+uint16_t NcpFrameBuffer::OutFrameReadChunk(uint16_t aMaxLength, const uint8_t *&aChunk)
+{
+    otError  error;
+    uint16_t length = 0;
 
     switch (mReadState)
     {
@@ -704,15 +832,32 @@ uint8_t NcpFrameBuffer::OutFrameReadByte(void)
 
     case kReadStateDone:
 
-        retval = kReadByteAfterFrameHasEnded;
-
         break;
 
     case kReadStateInSegment:
 
-        // Read a byte from current read pointer and move the read pointer by 1 byte in the read direction.
-        retval       = *mReadPointer;
-        mReadPointer = GetUpdatedBufPtr(mReadPointer, 1, mReadDirection);
+        aChunk = mReadPointer;
+
+        // In forward direction, the chunk extends to the end of current segment or end of buffer (whichever comes
+        // first). In backward direction, consecutive bytes are stored at decreasing addresses so the chunk is a
+        // single byte.
+        if (mReadDirection == kForward)
+        {
+            length = static_cast<uint16_t>(((mReadSegmentTail > mReadPointer) ? mReadSegmentTail : mBufferEnd) -
+                                           mReadPointer);
+        }
+        else
+        {
+            length = 1;
+        }
+
+        if (length > aMaxLength)
+        {
+            length = aMaxLength;
+        }
+
+        // Move the read pointer by the chunk length in the read direction.
+        mReadPointer = GetUpdatedBufPtr(mReadPointer, length, mReadDirection);
 
         // Check if at end of current segment.
         if (mReadPointer == mReadSegmentTail)
@@ -731,15 +876,21 @@ uint8_t NcpFrameBuffer::OutFrameReadByte(void)
 
     case kReadStateInMessage:
 
-        // Read a byte from current read pointer and move the read pointer by 1 byte.
-        retval = *mReadPointer;
-        mReadPointer++;
+        aChunk = mReadMessagePointer;
+        length = static_cast<uint16_t>(mReadMessageTail - mReadMessagePointer);
+
+        if (length > aMaxLength)
+        {
+            length = aMaxLength;
+        }
+
+        mReadMessagePointer += length;
 
-        // Check if at the end of content in message buffer.
-        if (mReadPointer == mReadMessageTail)
+        // Check if at the end of current message chunk.
+        if (mReadMessagePointer == mReadMessageTail)
         {
-            // Fill more bytes from current message into message buffer.
-            error = OutFrameFillMessageBuffer();
+            // Prepare the next chunk from current message.
+            error = OutFramePrepareMessageChunk();
 
             // If no more bytes in the message, move to next segment (if any).
             if (error != OT_ERROR_NONE)
@@ -751,19 +902,7 @@ uint8_t NcpFrameBuffer::OutFrameReadByte(void)
         break;
     }
 
-    return retval;
-}
-
-uint16_t NcpFrameBuffer::OutFrameRead(uint16_t aReadLength, uint8_t *aDataBuffer)
-{
-    uint16_t bytesRead = 0;
-
-    for (bytesRead = 0; (bytesRead < aReadLength) && !OutFrameHasEnded(); bytesRead++)
-    {
-        *aDataBuffer++ = OutFrameReadByte();
-    }
-
-    return bytesRead;
+    return length;
 }
 
 otError NcpFrameBuffer::OutFrameRemove(void)
@@ -48,6 +48,11 @@ namespace Ncp {
  * are supported. Within same priority level first-in-first-out order is preserved. High priority frames are read
  * ahead of any low priority ones.
  *
+ * When `OPENTHREAD_CONFIG_NCP_TX_BUFFER_MESSAGE_SPILL` is enabled and a message pool instance is set, data which does
+ * not fit in the remaining buffer space is moved into a message allocated from the message pool and appended to the
+ * frame (as if added using `InFrameFeedMessage()`). A write position saved before such a move can no longer be used
+ * to overwrite or reset the frame.
+ *
  */
 class NcpFrameBuffer
 {
@@ -153,6 +158,17 @@ public:
      */
     void SetFrameRemovedCallback(BufferCallback aFrameRemovedCallback, void *aFrameRemovedContext);
 
+#if OPENTHREAD_CONFIG_NCP_TX_BUFFER_MESSAGE_SPILL
+    /**
+     * This method sets the OpenThread instance whose message pool holds the frame data which does not fit in the
+     * buffer.
+     *
+     * @param[in] aInstance             A pointer to an OpenThread instance, or NULL to not use the message pool.
+     *
+     */
+    void SetMessagePoolInstance(otInstance *aInstance) { mMessagePoolInstance = aInstance; }
+#endif
+
     /**
      * This method begins a new input frame (InFrame) to be added/written to the frame buffer.
 
@@ -397,6 +413,27 @@ public:
      */
     uint16_t OutFrameRead(uint16_t aReadLength, uint8_t *aDataBuffer);
 
+    /**
+     * This method reads a contiguous chunk of bytes from the current output frame without copying it.
+     *
+     * The NCP buffer maintains a read offset for the current output frame being read. This method provides a pointer
+     * (in @p aChunk) to the bytes at the current read offset and returns the number of bytes available there, which
+     * is at most @p aMaxLength. The read offset is moved forward by the returned length. Bytes from a message appended
+     * to the frame (using `InFrameFeedMessage()`) are provided directly from the message buffers.
+     *
+     * A chunk never spans two message buffers or a wrap-around of the NCP buffer. Bytes of a high priority frame are
+     * stored in reverse order within the NCP buffer, so data segments of such a frame are provided one byte at a time.
+     *
+     * The chunk remains valid until the current output frame is removed (using `OutFrameRemove()`).
+     *
+     * @param[in]  aMaxLength           Maximum number of bytes to read.
+     * @param[out] aChunk               A reference to a pointer to output the start of the chunk.
+     *
+     * @returns The number of bytes in the chunk, or zero if the current output frame has ended.
+     *
+     */
+    uint16_t OutFrameReadChunk(uint16_t aMaxLength, const uint8_t *&aChunk);
+
     /**
      * This method removes the current or front output frame from the buffer.
      *
@@ -569,7 +606,6 @@ private:
     enum
     {
         kReadByteAfterFrameHasEnded = 0,      // Value returned by ReadByte() when frame has ended.
-        kMessageReadBufferSize      = 16,     // Size of message buffer array `mMessageBuffer`.
         kUnknownFrameLength         = 0xffff, // Value used when frame length is unknown.
         kSegmentHeaderSize          = 2,      // Length of the segment header.
         kSegmentHeaderLengthMask    = 0x3fff, // Bit mask to get the length from the segment header
@@ -580,6 +616,10 @@ private:
         kSegmentHeaderMessageIndicatorFlag = (1 << 14), // Indicates this segment ends with a Message.
 
         kNumPrios = (kPriorityHigh + 1), // Number of priorities.
+
+#if OPENTHREAD_CONFIG_NCP_TX_BUFFER_MESSAGE_SPILL
+        kMaxSpillMessages = 2, // Max number of messages allocated from the message pool for a frame.
+#endif
     };
 
     enum ReadState
@@ -612,11 +652,17 @@ private:
     void    InFrameDiscard(void);
     bool    InFrameIsWriting(Priority aPriority) const;
 
+#if OPENTHREAD_CONFIG_NCP_TX_BUFFER_MESSAGE_SPILL
+    uint16_t InFrameGetFreeSpace(void) const;
+    otError  InFrameSpillData(const uint8_t *aDataBuffer, uint16_t aDataBufferLength);
+    void     InFrameFreeSpillMessages(void);
+#endif
+
     void    OutFrameSelectReadDirection(void);
     otError OutFramePrepareSegment(void);
     void    OutFrameMoveToNextSegment(void);
     otError OutFramePrepareMessage(void);
-    otError OutFrameFillMessageBuffer(void);
+    otError OutFramePrepareMessageChunk(void);
 
     uint8_t *const mBuffer;       // Pointer to the buffer used to store the data.
     uint8_t *const mBufferEnd;    // Points to after the end of buffer.
@@ -636,6 +682,12 @@ private:
     uint8_t *      mWriteSegmentTail;           // Pointer to end of current segment in the frame being written.
     FrameTag       mWriteFrameTag;              // Tag associated with last successfully written frame.
 
+#if OPENTHREAD_CONFIG_NCP_TX_BUFFER_MESSAGE_SPILL
+    otInstance *mMessagePoolInstance;                   // Instance whose message pool holds data not fitting in buffer.
+    otMessage * mWriteSpillMessages[kMaxSpillMessages]; // Messages allocated for the frame being written.
+    uint8_t     mWriteNumSpillMessages;                 // Number of entries in `mWriteSpillMessages`.
+#endif
+
     Direction mReadDirection;   // Direction (priority) for current frame being read.
     ReadState mReadState;       // Read state.
     uint16_t  mReadFrameLength; // Length of current frame being read.
@@ -643,13 +695,12 @@ private:
     uint8_t *mReadFrameStart[kNumPrios]; // Pointer to start of current frame being read.
     uint8_t *mReadSegmentHead;           // Pointer to start of current segment in the frame being read.
     uint8_t *mReadSegmentTail;           // Pointer to end of current segment in the frame being read.
-    uint8_t *mReadPointer;               // Pointer to next byte to read (either in segment or in msg buffer).
-
-    otMessage *mReadMessage;       // Current Message in the frame being read.
-    uint16_t   mReadMessageOffset; // Offset within current message being read.
+    uint8_t *mReadPointer;               // Pointer to next byte to read in current segment.
 
-    uint8_t  mMessageBuffer[kMessageReadBufferSize]; // Buffer to hold part of current message being read.
-    uint8_t *mReadMessageTail;                       // Pointer to end of current part in mMessageBuffer.
+    otMessage *    mReadMessage;        // Current Message in the frame being read.
+    uint16_t       mReadMessageOffset;  // Offset within current message of the end of current message chunk.
+    const uint8_t *mReadMessagePointer; // Pointer to next byte to read in current message chunk.
+    const uint8_t *mReadMessageTail;    // Pointer to end of current message chunk (within a message buffer).
 };
 
 } // namespace Ncp
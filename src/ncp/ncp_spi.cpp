@@ -74,14 +74,20 @@ NcpSpi::NcpSpi(Instance *aInstance)
     , mResetFlag(true)
     , mPrepareTxFrameTask(*aInstance, &NcpSpi::PrepareTxFrame, this)
     , mSendFrameLength(0)
+    , mStagedFrameLength(0)
+    , mSendFrameIndex(0)
 {
-    SpiFrame sendFrame(mSendFrame);
     SpiFrame emptyFullAccept(mEmptySendFrameFullAccept);
     SpiFrame emptyZeroAccept(mEmptySendFrameZeroAccept);
 
-    sendFrame.SetHeaderFlagByte(/* aResetFlag */ true);
-    sendFrame.SetHeaderAcceptLen(0);
-    sendFrame.SetHeaderDataLen(0);
+    for (uint8_t i = 0; i < kNumSendFrames; i++)
+    {
+        SpiFrame sendFrame(mSendFrame[i]);
+
+        sendFrame.SetHeaderFlagByte(/* aResetFlag */ true);
+        sendFrame.SetHeaderAcceptLen(0);
+        sendFrame.SetHeaderDataLen(0);
+    }
 
     emptyFullAccept.SetHeaderFlagByte(/* aResetFlag */ true);
     emptyFullAccept.SetHeaderAcceptLen(kSpiBufferSize - kSpiHeaderSize);
@@ -132,7 +138,6 @@ bool NcpSpi::SpiTransactionComplete(uint8_t *aOutputBuf,
     bool     shouldProcess = false;
     SpiFrame outputFrame(aOutputBuf);
     SpiFrame inputFrame(aInputBuf);
-    SpiFrame sendFrame(mSendFrame);
 
     VerifyOrExit((aTransLen >= kSpiHeaderSize) && (aInputLen >= kSpiHeaderSize) && (aOutputLen >= kSpiHeaderSize));
     VerifyOrExit(inputFrame.IsValid() && outputFrame.IsValid());
@@ -167,7 +172,22 @@ bool NcpSpi::SpiTransactionComplete(uint8_t *aOutputBuf,
 
         if ((txDataLen > 0) && (txDataLen <= transDataLen) && (txDataLen <= inputFrame.GetHeaderAcceptLen()))
         {
-            mTxState      = kTxStateHandlingSendDone;
+#if OPENTHREAD_CONFIG_NCP_SPI_ENABLE_DOUBLE_BUFFER
+            if (mStagedFrameLength != 0)
+            {
+                // Switch to the frame staged in the other tx buffer so that it is sent in the
+                // next transaction. `SpiTransactionProcess()` then stages the following frame.
+
+                mSendFrameIndex ^= 1;
+                mSendFrameLength   = mStagedFrameLength;
+                mStagedFrameLength = 0;
+            }
+            else
+#endif
+            {
+                mTxState = kTxStateHandlingSendDone;
+            }
+
             shouldProcess = true;
         }
     }
@@ -178,14 +198,19 @@ exit:
     if (mResetFlag && (aTransLen > 0) && (aOutputLen > 0))
     {
         mResetFlag = false;
-        sendFrame.SetHeaderFlagByte(/*aResetFlag */ false);
+
+        for (uint8_t i = 0; i < kNumSendFrames; i++)
+        {
+            SpiFrame(mSendFrame[i]).SetHeaderFlagByte(/*aResetFlag */ false);
+        }
+
         SpiFrame(mEmptySendFrameFullAccept).SetHeaderFlagByte(/*aResetFlag */ false);
         SpiFrame(mEmptySendFrameZeroAccept).SetHeaderFlagByte(/*aResetFlag */ false);
     }
 
     if (mTxState == kTxStateSending)
     {
-        aOutputBuf = mSendFrame;
+        aOutputBuf = GetSendFrame();
         aOutputLen = mSendFrameLength;
     }
     else
@@ -205,7 +230,7 @@ exit:
         aInputLen = kSpiBufferSize;
     }
 
-    sendFrame.SetHeaderAcceptLen(aInputLen - kSpiHeaderSize);
+    SetSendFrameAcceptLen(aInputLen - kSpiHeaderSize);
 
     otPlatSpiSlavePrepareTransaction(aOutputBuf, aOutputLen, aInputBuf, aInputLen, (mTxState == kTxStateSending));
 
@@ -223,6 +248,13 @@ void NcpSpi::SpiTransactionProcess(void)
     {
         mPrepareTxFrameTask.Post();
     }
+#if OPENTHREAD_CONFIG_NCP_SPI_ENABLE_DOUBLE_BUFFER
+    else if ((mTxState == kTxStateSending) && (mStagedFrameLength == 0))
+    {
+        // Stage the next frame (if any) while the current one is being sent.
+        mPrepareTxFrameTask.Post();
+    }
+#endif
 
     if (mHandlingRxFrame)
     {
@@ -242,41 +274,69 @@ void NcpSpi::HandleFrameAddedToTxBuffer(void *                   aContext,
     static_cast<NcpSpi *>(aContext)->mPrepareTxFrameTask.Post();
 }
 
+void NcpSpi::SetSendFrameAcceptLen(uint16_t aAcceptLen)
+{
+    // The accept length is kept up to date in all tx buffers, so that any of them can be used for the next
+    // transaction.
+    for (uint8_t i = 0; i < kNumSendFrames; i++)
+    {
+        SpiFrame(mSendFrame[i]).SetHeaderAcceptLen(aAcceptLen);
+    }
+}
+
 void NcpSpi::PrepareNextSpiSendFrame(void)
 {
-    otError  error = OT_ERROR_NONE;
+    otError  error    = OT_ERROR_NONE;
+    bool     isStaged = false;
     uint16_t frameLength;
     uint16_t readLength;
-    SpiFrame sendFrame(mSendFrame);
 
-    VerifyOrExit(!mTxFrameBuffer.IsEmpty());
+#if OPENTHREAD_CONFIG_NCP_SPI_ENABLE_DOUBLE_BUFFER
+    isStaged = (mStagedFrameLength != 0);
+#endif
+
+    VerifyOrExit(isStaged || !mTxFrameBuffer.IsEmpty());
 
     if (ShouldWakeHost())
     {
         otPlatWakeHost();
     }
 
-    SuccessOrExit(error = mTxFrameBuffer.OutFrameBegin());
+    if (isStaged)
+    {
+        // A frame was staged in the other tx buffer while the
+        // previous transaction was in progress, switch to it.
 
-    frameLength = mTxFrameBuffer.OutFrameGetLength();
-    assert(frameLength <= kSpiBufferSize - kSpiHeaderSize);
+        mSendFrameIndex ^= 1;
+        mSendFrameLength   = mStagedFrameLength;
+        mStagedFrameLength = 0;
+    }
+    else
+    {
+        SpiFrame sendFrame(GetSendFrame());
 
-    // The "accept length" in `mSendFrame` is already updated based
-    // on current state of receive. It is changed either from the
-    // `SpiTransactionComplete()` callback or from `HandleRxFrame()`.
+        SuccessOrExit(error = mTxFrameBuffer.OutFrameBegin());
 
-    readLength = mTxFrameBuffer.OutFrameRead(frameLength, sendFrame.GetData());
-    assert(readLength == frameLength);
+        frameLength = mTxFrameBuffer.OutFrameGetLength();
+        assert(frameLength <= kSpiBufferSize - kSpiHeaderSize);
 
-    sendFrame.SetHeaderDataLen(frameLength);
-    mSendFrameLength = frameLength + kSpiHeaderSize;
+        // The "accept length" in the tx buffers is already updated based
+        // on current state of receive. It is changed either from the
+        // `SpiTransactionComplete()` callback or from `HandleRxFrame()`.
+
+        readLength = mTxFrameBuffer.OutFrameRead(frameLength, sendFrame.GetData());
+        assert(readLength == frameLength);
+
+        sendFrame.SetHeaderDataLen(frameLength);
+        mSendFrameLength = frameLength + kSpiHeaderSize;
+    }
 
     mTxState = kTxStateSending;
 
-    // Prepare new transaction by using `mSendFrame` as the output
+    // Prepare new transaction by using the current tx buffer as the output
     // frame while keeping the input frame unchanged.
 
-    error = otPlatSpiSlavePrepareTransaction(mSendFrame, mSendFrameLength, NULL, 0, /* aRequestTrans */ true);
+    error = otPlatSpiSlavePrepareTransaction(GetSendFrame(), mSendFrameLength, NULL, 0, /* aRequestTrans */ true);
 
     if (error == OT_ERROR_BUSY)
     {
@@ -288,15 +348,63 @@ void NcpSpi::PrepareNextSpiSendFrame(void)
     if (error != OT_ERROR_NONE)
     {
         mTxState = kTxStateIdle;
+
+        if (isStaged)
+        {
+            // Keep the frame staged so it is used on the next attempt.
+            mSendFrameIndex ^= 1;
+            mStagedFrameLength = mSendFrameLength;
+        }
+
         mPrepareTxFrameTask.Post();
         ExitNow();
     }
 
+    if (!isStaged)
+    {
+        mTxFrameBuffer.OutFrameRemove();
+    }
+
+    IncrementHostWriteCounter(1);
+
+exit:
+    return;
+}
+
+#if OPENTHREAD_CONFIG_NCP_SPI_ENABLE_DOUBLE_BUFFER
+void NcpSpi::StageNextSpiSendFrame(void)
+{
+    SpiFrame stagedFrame(mSendFrame[mSendFrameIndex ^ 1]);
+    uint16_t frameLength;
+    uint16_t readLength;
+
+    // The other tx buffer is not touched by `SpiTransactionComplete()`
+    // (other than its accept length) until `mStagedFrameLength` is set.
+
+    VerifyOrExit(mStagedFrameLength == 0);
+    VerifyOrExit(!mTxFrameBuffer.IsEmpty());
+
+    SuccessOrExit(mTxFrameBuffer.OutFrameBegin());
+
+    frameLength = mTxFrameBuffer.OutFrameGetLength();
+    assert(frameLength <= kSpiBufferSize - kSpiHeaderSize);
+
+    readLength = mTxFrameBuffer.OutFrameRead(frameLength, stagedFrame.GetData());
+    assert(readLength == frameLength);
+
+    stagedFrame.SetHeaderDataLen(frameLength);
+
     mTxFrameBuffer.OutFrameRemove();
 
+    // Setting the staged length last makes the frame available to
+    // `SpiTransactionComplete()`. If the current transaction completes
+    // before this, the frame is used from `PrepareNextSpiSendFrame()`.
+    mStagedFrameLength = frameLength + kSpiHeaderSize;
+
 exit:
     return;
 }
+#endif // OPENTHREAD_CONFIG_NCP_SPI_ENABLE_DOUBLE_BUFFER
 
 void NcpSpi::PrepareTxFrame(Tasklet &aTasklet)
 {
@@ -319,9 +427,15 @@ void NcpSpi::PrepareTxFrame(void)
         break;
 
     case kTxStateSending:
+#if OPENTHREAD_CONFIG_NCP_SPI_ENABLE_DOUBLE_BUFFER
+        // Stage the next frame in queue (if any) in the other tx buffer
+        // while the current frame is being sent.
+        StageNextSpiSendFrame();
+#else
         // The next frame in queue (if any) will be prepared when the
         // current frame is successfully sent and this task is posted
         // again from the `SpiTransactionComplete()` callback.
+#endif
         break;
     }
 }
@@ -329,7 +443,6 @@ void NcpSpi::PrepareTxFrame(void)
 void NcpSpi::HandleRxFrame(void)
 {
     SpiFrame recvFrame(mReceiveFrame);
-    SpiFrame sendFrame(mSendFrame);
 
     // Pass the received frame to base class to process.
     HandleReceive(recvFrame.GetData(), recvFrame.GetHeaderDataLen());
@@ -344,7 +457,7 @@ void NcpSpi::HandleRxFrame(void)
     // preparing the transaction here. But before we set the
     // `mHandlingRxFrame` to `false`, the `SpiTransactionComplete()`
     // happens and prepares the next transaction and sets the accept
-    // length to zero on `mSendFrame` (since it assumes we are still
+    // length to zero on the tx buffers (since it assumes we are still
     // handling the previous received frame).
 
     mHandlingRxFrame = false;
@@ -355,7 +468,7 @@ void NcpSpi::HandleRxFrame(void)
 
     if (mTxState != kTxStateSending)
     {
-        sendFrame.SetHeaderAcceptLen(kSpiBufferSize - kSpiHeaderSize);
+        SetSendFrameAcceptLen(kSpiBufferSize - kSpiHeaderSize);
 
         otPlatSpiSlavePrepareTransaction(mEmptySendFrameFullAccept, kSpiHeaderSize, mReceiveFrame, kSpiBufferSize,
                                          /* aRequestTrans */ false);
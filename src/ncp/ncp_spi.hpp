@@ -168,6 +168,12 @@ private:
          *
          */
         kSpiHeaderSize = SpiFrame::kHeaderSize,
+
+        /**
+         * Number of SPI tx buffers.
+         *
+         */
+        kNumSendFrames = OPENTHREAD_CONFIG_NCP_SPI_ENABLE_DOUBLE_BUFFER ? 2 : 1,
     };
 
     enum TxState
@@ -204,6 +210,12 @@ private:
     void        PrepareTxFrame(void);
     void        HandleRxFrame(void);
     void        PrepareNextSpiSendFrame(void);
+#if OPENTHREAD_CONFIG_NCP_SPI_ENABLE_DOUBLE_BUFFER
+    void StageNextSpiSendFrame(void);
+#endif
+
+    uint8_t *GetSendFrame(void) { return mSendFrame[mSendFrameIndex]; }
+    void     SetSendFrameAcceptLen(uint16_t aAcceptLen);
 
     volatile TxState mTxState;
     volatile bool    mHandlingRxFrame;
@@ -211,8 +223,10 @@ private:
 
     Tasklet mPrepareTxFrameTask;
 
-    uint16_t         mSendFrameLength;
-    LargeFrameBuffer mSendFrame;
+    uint16_t          mSendFrameLength;
+    volatile uint16_t mStagedFrameLength;
+    volatile uint8_t  mSendFrameIndex;
+    LargeFrameBuffer  mSendFrame[kNumSendFrames];
     EmptyFrameBuffer mEmptySendFrameFullAccept;
     EmptyFrameBuffer mEmptySendFrameZeroAccept;
 
@@ -103,6 +103,7 @@ NcpUart::NcpUart(Instance *aInstance)
     , mUartBuffer()
     , mState(kStartingFrame)
     , mByte(0)
+    , mUartTxFrameCount(0)
     , mUartSendImmediate(false)
     , mUartSendTask(*aInstance, EncodeAndSendToUart, this)
 #if OPENTHREAD_ENABLE_NCP_SPINEL_ENCRYPTER
@@ -140,9 +141,10 @@ void NcpUart::EncodeAndSendToUart(Tasklet &aTasklet)
     static_cast<NcpUart *>(GetNcpInstance())->EncodeAndSendToUart();
 }
 
-// This method encodes a frame from the tx frame buffer (mTxFrameBuffer) into the uart buffer and sends it over uart.
-// If the uart buffer gets full, it sends the current encoded portion. This method remembers current state, so on
-// sub-sequent calls, it restarts encoding the bytes from where it left of in the frame .
+// This method encodes frames from the tx frame buffer (mTxFrameBuffer) into the uart buffer and sends it over uart.
+// As many queued frames as fit are packed into the uart buffer and sent with a single `otPlatUartSend()` call. If the
+// uart buffer gets full, it sends the current encoded portion. This method remembers current state, so on sub-sequent
+// calls, it restarts encoding the bytes from where it left of in the frame .
 void NcpUart::EncodeAndSendToUart(void)
 {
     uint16_t len;
@@ -185,6 +187,7 @@ void NcpUart::EncodeAndSendToUart(void)
             prevHostPowerState = mHostPowerStateInProgress;
 
             txFrameBuffer.OutFrameRemove();
+            mUartTxFrameCount++;
 
             if (prevHostPowerState && !mHostPowerStateInProgress)
             {
@@ -224,6 +227,9 @@ exit:
         {
             assert(false);
         }
+
+        super_t::IncrementHostWriteCounter(mUartTxFrameCount);
+        mUartTxFrameCount = 0;
     }
 }
 
@@ -147,6 +147,7 @@ private:
     UartTxBuffer  mUartBuffer;
     UartTxState   mState;
     uint8_t       mByte;
+    uint16_t      mUartTxFrameCount;
     uint8_t       mRxBuffer[kRxBufferSize];
     bool          mUartSendImmediate;
     Tasklet       mUartSendTask;
@@ -1422,6 +1422,10 @@ const char *spinel_prop_key_to_cstr(spinel_prop_key_t prop_key)
         ret = "MAC_CCA_FAILURE_RATE";
         break;
 
+    case SPINEL_PROP_MAC_RAW_STREAM_BATCH_ENABLED:
+        ret = "MAC_RAW_STREAM_BATCH_ENABLED";
+        break;
+
     case SPINEL_PROP_NET_SAVED:
         ret = "NET_SAVED";
         break;
@@ -1730,6 +1734,10 @@ const char *spinel_prop_key_to_cstr(spinel_prop_key_t prop_key)
         ret = "IPV6_ICMP_PING_OFFLOAD_MODE";
         break;
 
+    case SPINEL_PROP_IPV6_STREAM_NET_LOWPAN_ENABLED:
+        ret = "IPV6_STREAM_NET_LOWPAN_ENABLED";
+        break;
+
     case SPINEL_PROP_STREAM_DEBUG:
         ret = "STREAM_DEBUG";
         break;
@@ -1750,6 +1758,26 @@ const char *spinel_prop_key_to_cstr(spinel_prop_key_t prop_key)
         ret = "STREAM_LOG";
         break;
 
+    case SPINEL_PROP_STREAM_NET_TX_CREDITS:
+        ret = "STREAM_NET_TX_CREDITS";
+        break;
+
+    case SPINEL_PROP_STREAM_LOG_TOKENIZED:
+        ret = "STREAM_LOG_TOKENIZED";
+        break;
+
+    case SPINEL_PROP_STREAM_RAW_BATCH:
+        ret = "STREAM_RAW_BATCH";
+        break;
+
+    case SPINEL_PROP_STREAM_NET_LOWPAN:
+        ret = "STREAM_NET_LOWPAN";
+        break;
+
+    case SPINEL_PROP_STREAM_RAW_TX_BATCH:
+        ret = "STREAM_RAW_TX_BATCH";
+        break;
+
     case SPINEL_PROP_MESHCOP_COMMISSIONER_STATE:
         ret = "MESHCOP_COMMISSIONER_STATE";
         break;
@@ -2054,6 +2082,10 @@ const char *spinel_prop_key_to_cstr(spinel_prop_key_t prop_key)
         ret = "CNTR_IP_RX_FAILURE";
         break;
 
+    case SPINEL_PROP_CNTR_TX_SPINEL_WRITES:
+        ret = "CNTR_TX_SPINEL_WRITES";
+        break;
+
     case SPINEL_PROP_MSG_BUFFER_COUNTERS:
         ret = "MSG_BUFFER_COUNTERS";
         break;
@@ -2062,6 +2094,26 @@ const char *spinel_prop_key_to_cstr(spinel_prop_key_t prop_key)
         ret = "CNTR_ALL_MAC_COUNTERS";
         break;
 
+    case SPINEL_PROP_MSG_BUFFER_STATS:
+        ret = "MSG_BUFFER_STATS";
+        break;
+
+    case SPINEL_PROP_CNTR_MAC_OPERATION_STATS:
+        ret = "CNTR_MAC_OPERATION_STATS";
+        break;
+
+    case SPINEL_PROP_CNTR_IP_DROP_COUNTERS:
+        ret = "CNTR_IP_DROP_COUNTERS";
+        break;
+
+    case SPINEL_PROP_CNTR_HANDLER_PROFILE:
+        ret = "CNTR_HANDLER_PROFILE";
+        break;
+
+    case SPINEL_PROP_CNTR_RADIO_TIME_STATS:
+        ret = "CNTR_RADIO_TIME_STATS";
+        break;
+
     case SPINEL_PROP_NEST_STREAM_MFG:
         ret = "NEST_STREAM_MFG";
         break;
@@ -2086,6 +2138,10 @@ const char *spinel_prop_key_to_cstr(spinel_prop_key_t prop_key)
         ret = "DEBUG_TEST_WATCHDOG";
         break;
 
+    case SPINEL_PROP_DEBUG_NCP_LOG_REGION_LEVEL:
+        ret = "DEBUG_NCP_LOG_REGION_LEVEL";
+        break;
+
     default:
         break;
     }
@@ -2463,6 +2519,22 @@ const char *spinel_capability_to_cstr(unsigned int capability)
         ret = "POSIX_APP";
         break;
 
+    case SPINEL_CAP_OPENTHREAD_LOG_TOKENIZED:
+        ret = "OPENTHREAD_LOG_TOKENIZED";
+        break;
+
+    case SPINEL_CAP_MAC_RAW_STREAM_BATCH:
+        ret = "MAC_RAW_STREAM_BATCH";
+        break;
+
+    case SPINEL_CAP_NET_STREAM_LOWPAN:
+        ret = "NET_STREAM_LOWPAN";
+        break;
+
+    case SPINEL_CAP_MAC_RAW_TX_BATCH:
+        ret = "MAC_RAW_TX_BATCH";
+        break;
+
     case SPINEL_CAP_ERROR_RATE_TRACKING:
         ret = "ERROR_RATE_TRACKING";
         break;
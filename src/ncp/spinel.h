@@ -692,9 +692,52 @@ enum
      */
     SPINEL_CMD_POKE = 20,
 
+    /**
+     * Property value multi-get command (Host -> NCP)
+     *
+     * Encoding: `A(i)`
+     *   `A(i)` : List of property Ids
+     *
+     * Instructs the NCP to fetch the values of all of the given properties.
+     * The NCP responds with a single `CMD_PROP_VALUES_ARE` command.
+     *
+     * This command requires the capability `CAP_CMD_MULTI` to be present.
+     *
+     */
     SPINEL_CMD_PROP_VALUE_MULTI_GET = 21,
+
+    /**
+     * Property value multi-set command (Host -> NCP)
+     *
+     * Encoding: `A(t(iD))`
+     *   `A(t(iD))` : List of structs, each with a property Id and the value to set
+     *
+     * Instructs the NCP to set the values of the given properties, in the
+     * given order. The NCP responds with a single `CMD_PROP_VALUES_ARE`
+     * command. Properties which can only be set using `CMD_PROP_VALUE_SET`
+     * are reported with `STATUS_PROP_NOT_FOUND`.
+     *
+     * This command requires the capability `CAP_CMD_MULTI` to be present.
+     *
+     */
     SPINEL_CMD_PROP_VALUE_MULTI_SET = 22,
-    SPINEL_CMD_PROP_VALUES_ARE      = 23,
+
+    /**
+     * Property values notification command (NCP -> Host)
+     *
+     * Encoding: `A(t(iD))`
+     *   `A(t(iD))` : List of structs, each with a property Id and its value
+     *
+     * This command is sent by the NCP in response to `CMD_PROP_VALUE_MULTI_GET`
+     * or `CMD_PROP_VALUE_MULTI_SET`, with one struct per requested property
+     * (in the same order). If a property could not be fetched or set, its
+     * struct contains `PROP_LAST_STATUS` followed by the status instead.
+     *
+     * If the whole response does not fit in a frame, the NCP responds with a
+     * `PROP_LAST_STATUS` error instead.
+     *
+     */
+    SPINEL_CMD_PROP_VALUES_ARE = 23,
 
     SPINEL_CMD_NEST__BEGIN = 15296,
     SPINEL_CMD_NEST__END   = 15360,
@@ -750,18 +793,22 @@ enum
     SPINEL_CAP_NET_THREAD_1_1 = (SPINEL_CAP_NET__BEGIN + 1),
     SPINEL_CAP_NET__END       = 64,
 
-    SPINEL_CAP_OPENTHREAD__BEGIN       = 512,
-    SPINEL_CAP_MAC_WHITELIST           = (SPINEL_CAP_OPENTHREAD__BEGIN + 0),
-    SPINEL_CAP_MAC_RAW                 = (SPINEL_CAP_OPENTHREAD__BEGIN + 1),
-    SPINEL_CAP_OOB_STEERING_DATA       = (SPINEL_CAP_OPENTHREAD__BEGIN + 2),
-    SPINEL_CAP_CHANNEL_MONITOR         = (SPINEL_CAP_OPENTHREAD__BEGIN + 3),
-    SPINEL_CAP_ERROR_RATE_TRACKING     = (SPINEL_CAP_OPENTHREAD__BEGIN + 4),
-    SPINEL_CAP_CHANNEL_MANAGER         = (SPINEL_CAP_OPENTHREAD__BEGIN + 5),
-    SPINEL_CAP_OPENTHREAD_LOG_METADATA = (SPINEL_CAP_OPENTHREAD__BEGIN + 6),
-    SPINEL_CAP_TIME_SYNC               = (SPINEL_CAP_OPENTHREAD__BEGIN + 7),
-    SPINEL_CAP_CHILD_SUPERVISION       = (SPINEL_CAP_OPENTHREAD__BEGIN + 8),
-    SPINEL_CAP_POSIX_APP               = (SPINEL_CAP_OPENTHREAD__BEGIN + 9),
-    SPINEL_CAP_OPENTHREAD__END         = 640,
+    SPINEL_CAP_OPENTHREAD__BEGIN        = 512,
+    SPINEL_CAP_MAC_WHITELIST            = (SPINEL_CAP_OPENTHREAD__BEGIN + 0),
+    SPINEL_CAP_MAC_RAW                  = (SPINEL_CAP_OPENTHREAD__BEGIN + 1),
+    SPINEL_CAP_OOB_STEERING_DATA        = (SPINEL_CAP_OPENTHREAD__BEGIN + 2),
+    SPINEL_CAP_CHANNEL_MONITOR          = (SPINEL_CAP_OPENTHREAD__BEGIN + 3),
+    SPINEL_CAP_ERROR_RATE_TRACKING      = (SPINEL_CAP_OPENTHREAD__BEGIN + 4),
+    SPINEL_CAP_CHANNEL_MANAGER          = (SPINEL_CAP_OPENTHREAD__BEGIN + 5),
+    SPINEL_CAP_OPENTHREAD_LOG_METADATA  = (SPINEL_CAP_OPENTHREAD__BEGIN + 6),
+    SPINEL_CAP_TIME_SYNC                = (SPINEL_CAP_OPENTHREAD__BEGIN + 7),
+    SPINEL_CAP_CHILD_SUPERVISION        = (SPINEL_CAP_OPENTHREAD__BEGIN + 8),
+    SPINEL_CAP_POSIX_APP                = (SPINEL_CAP_OPENTHREAD__BEGIN + 9),
+    SPINEL_CAP_OPENTHREAD_LOG_TOKENIZED = (SPINEL_CAP_OPENTHREAD__BEGIN + 10),
+    SPINEL_CAP_MAC_RAW_STREAM_BATCH     = (SPINEL_CAP_OPENTHREAD__BEGIN + 11),
+    SPINEL_CAP_NET_STREAM_LOWPAN        = (SPINEL_CAP_OPENTHREAD__BEGIN + 12),
+    SPINEL_CAP_MAC_RAW_TX_BATCH         = (SPINEL_CAP_OPENTHREAD__BEGIN + 13),
+    SPINEL_CAP_OPENTHREAD__END          = 640,
 
     SPINEL_CAP_THREAD__BEGIN       = 1024,
     SPINEL_CAP_THREAD_COMMISSIONER = (SPINEL_CAP_THREAD__BEGIN + 0),
@@ -1230,6 +1277,18 @@ typedef enum
      */
     SPINEL_PROP_MAC_CCA_FAILURE_RATE = SPINEL_PROP_MAC_EXT__BEGIN + 9,
 
+    /// Raw Stream Batching Enabled
+    /** Format: `b`
+     *
+     * Required capability: `SPINEL_CAP_MAC_RAW_STREAM_BATCH`
+     *
+     * When set, frames captured in raw link mode (`SPINEL_PROP_MAC_RAW_STREAM_ENABLED`) or through
+     * `SPINEL_PROP_PHY_PCAP_ENABLED` are reported through `SPINEL_PROP_STREAM_RAW_BATCH` instead of one
+     * `SPINEL_PROP_STREAM_RAW` update per frame. Enabling batching clears the batch drop counter.
+     *
+     */
+    SPINEL_PROP_MAC_RAW_STREAM_BATCH_ENABLED = SPINEL_PROP_MAC_EXT__BEGIN + 10,
+
     SPINEL_PROP_MAC_EXT__END = 0x1400,
 
     SPINEL_PROP_NET__BEGIN               = 0x40,
@@ -1877,6 +1936,19 @@ typedef enum
      */
     SPINEL_PROP_IPV6_ICMP_PING_OFFLOAD_MODE = SPINEL_PROP_IPV6__BEGIN + 7, ///< [b]
 
+    /// IPv6 Compressed Network Stream Enabled
+    /** Format: `b`
+     *
+     * Required capability: `SPINEL_CAP_NET_STREAM_LOWPAN`
+     *
+     * When enabled, the NCP sends secure IPv6 datagrams to the host on
+     * `SPINEL_PROP_STREAM_NET_LOWPAN` instead of `SPINEL_PROP_STREAM_NET`.
+     * Insecure datagrams are always sent uncompressed.
+     *
+     * Default value is `false`.
+     */
+    SPINEL_PROP_IPV6_STREAM_NET_LOWPAN_ENABLED = SPINEL_PROP_IPV6__BEGIN + 8,
+
     SPINEL_PROP_IPV6__END = 0x70,
 
     SPINEL_PROP_IPV6_EXT__BEGIN = 0x1600,
@@ -1884,6 +1956,19 @@ typedef enum
 
     SPINEL_PROP_STREAM__BEGIN       = 0x70,
     SPINEL_PROP_STREAM_DEBUG        = SPINEL_PROP_STREAM__BEGIN + 0, ///< [U]
+
+    /// Raw 802.15.4 Frame Stream
+    /** Format: `dD` (stream)
+     *
+     * When set, the frame is transmitted with format `dC` or `dCCCb`:
+     *
+     *   `d`: The PSDU
+     *   `C`: Channel
+     *   `C`: Maximum number of CSMA-CA backoffs (optional)
+     *   `C`: Maximum number of frame retries (optional)
+     *   `b`: CSMA-CA enabled (optional)
+     *
+     */
     SPINEL_PROP_STREAM_RAW          = SPINEL_PROP_STREAM__BEGIN + 1, ///< [dD]
     SPINEL_PROP_STREAM_NET          = SPINEL_PROP_STREAM__BEGIN + 2, ///< [dD]
     SPINEL_PROP_STREAM_NET_INSECURE = SPINEL_PROP_STREAM__BEGIN + 3, ///< [dD]
@@ -1910,7 +1995,123 @@ typedef enum
      *         `SPINEL_NCP_LOG_REGION_<region>).
      *
      */
-    SPINEL_PROP_STREAM_LOG  = SPINEL_PROP_STREAM__BEGIN + 4,
+    SPINEL_PROP_STREAM_LOG = SPINEL_PROP_STREAM__BEGIN + 4,
+
+    /// IPv6 Network Stream Transmit Credits
+    /** Format: `S` (read-only)
+     *
+     * The number of maximum-size IPv6 datagrams that the NCP can currently
+     * accept through `SPINEL_PROP_STREAM_NET` or
+     * `SPINEL_PROP_STREAM_NET_INSECURE`, as estimated from the number of
+     * free message buffers.
+     *
+     * The NCP sends unsolicited `CMD_PROP_VALUE_IS` updates when the value
+     * changes (i.e., as datagrams are accepted from the host and as the
+     * message pool drains), so the host can pace its writes instead of
+     * relying on `LAST_STATUS` errors for dropped frames.
+     *
+     */
+    SPINEL_PROP_STREAM_NET_TX_CREDITS = SPINEL_PROP_STREAM__BEGIN + 5,
+
+    /// Tokenized Log Stream
+    /** Format: `LCiD` (stream, read only)
+     *
+     * This property is a read-only streaming property which provides
+     * OpenThread logs in tokenized form. Instead of the formatted log
+     * string, NCP sends a token identifying the printf-style format
+     * string along with the raw values of its arguments. It is used in
+     * place of `SPINEL_PROP_STREAM_LOG` when NCP has the capability
+     * `SPINEL_CAP_OPENTHREAD_LOG_TOKENIZED`.
+     *
+     *   `L`: Token, the 32-bit FNV-1a hash of the format string
+     *   `C`: Log level (as per `SPINEL_NCP_LOG_LEVEL_<level>`)
+     *   `i`: OpenThread log region (as per `SPINEL_NCP_LOG_REGION_<region>`)
+     *   `D`: Arguments, in order of the conversions in the format string:
+     *
+     *     - `%ll` and `%j` integers: `X` (64-bit value).
+     *     - All other integer conversions (including `%c` and `%p`):
+     *       `i` (low 32 bits as packed unsigned integer).
+     *     - `%s`: `U` (zero-terminated string).
+     *     - Floating point conversions: `X` (bits of the `double`).
+     *     - A `*` width or precision: `i` (the `int` value).
+     *
+     * The host maps a token to its format string using a table built
+     * from the NCP firmware image.
+     *
+     */
+    SPINEL_PROP_STREAM_LOG_TOKENIZED = SPINEL_PROP_STREAM__BEGIN + 6,
+
+    /// Batched Raw 802.15.4 Frame Stream
+    /** Format: `LLSD` (stream, read only)
+     *
+     * Required capability: `SPINEL_CAP_MAC_RAW_STREAM_BATCH`
+     *
+     * This property provides asynchronous `CMD_PROP_VALUE_IS` updates
+     * carrying one or more captured frames when
+     * `SPINEL_PROP_MAC_RAW_STREAM_BATCH_ENABLED` is set. Frames captured
+     * while the previous update is still waiting for room in the NCP
+     * transmit buffer are packed into the same update.
+     *
+     *   `L`: Number of captured frames dropped (because the batch buffer
+     *        was full) since batching was enabled
+     *   `L`: Timestamp of the first frame (milliseconds)
+     *   `S`: Timestamp of the first frame (microseconds, offset to the
+     *        milliseconds value)
+     *   `D`: Concatenation of frame records, each with format `icCCd`:
+     *
+     *     `i`: Microseconds since the previous frame in this update (zero
+     *          for the first frame)
+     *     `c`: RSSI (dBm)
+     *     `C`: LQI
+     *     `C`: Flags (`SPINEL_MD_FLAG_TX` if the frame was transmitted)
+     *     `d`: The PSDU
+     *
+     */
+    SPINEL_PROP_STREAM_RAW_BATCH = SPINEL_PROP_STREAM__BEGIN + 7,
+
+    /// Compressed Network Packet Stream
+    /** Format: `dD` (stream)
+     *
+     * Required capability: `SPINEL_CAP_NET_STREAM_LOWPAN`
+     *
+     * This stream is the same as `SPINEL_PROP_STREAM_NET` except that the
+     * IPv6 (and UDP) headers of the datagram are compressed with
+     * 6LoWPAN IPHC (RFC 6282), using the contexts in the Thread network
+     * data. The host may write to this property to send a compressed
+     * datagram; the NCP sends compressed datagrams to the host only when
+     * `SPINEL_PROP_IPV6_STREAM_NET_LOWPAN_ENABLED` is set.
+     *
+     * Addresses are compressed as if both link-layer endpoints used the
+     * short address `0xfffe`, so the host needs no per-neighbor state to
+     * rebuild the interface identifiers.
+     *
+     */
+    SPINEL_PROP_STREAM_NET_LOWPAN = SPINEL_PROP_STREAM__BEGIN + 8,
+
+    /// Batched Raw 802.15.4 Frame Transmission
+    /** Format: `A(t(dCCCb))` (write only)
+     *
+     * Required capability: `SPINEL_CAP_MAC_RAW_TX_BATCH`
+     *
+     * Writing this property transmits up to a limited number of raw
+     * frames back-to-back, without a host round trip between them. Each
+     * struct in the array describes one frame:
+     *
+     *   `d`: The PSDU
+     *   `C`: Channel
+     *   `C`: Maximum number of CSMA-CA backoffs
+     *   `C`: Maximum number of frame retries
+     *   `b`: Whether CSMA-CA is enabled
+     *
+     * Once every frame is done, the NCP replies (with the transaction ID
+     * of the write) with `CMD_PROP_VALUE_IS` for this property, whose
+     * value is an array of the status (`i`) of each frame, in order. If
+     * the batch cannot be started, the NCP replies with
+     * `SPINEL_PROP_LAST_STATUS` instead.
+     *
+     */
+    SPINEL_PROP_STREAM_RAW_TX_BATCH = SPINEL_PROP_STREAM__BEGIN + 9,
+
     SPINEL_PROP_STREAM__END = 0x80,
 
     SPINEL_PROP_STREAM_EXT__BEGIN = 0x1700,
@@ -2565,6 +2766,14 @@ typedef enum
     /** Format: `L` (Read-only) */
     SPINEL_PROP_CNTR_IP_RX_FAILURE = SPINEL_PROP_CNTR__BEGIN + 307,
 
+    /// The number of writes to the host interface used to send spinel frames
+    /** Format: `L` (Read-only)
+     *
+     * A single write may carry several spinel frames (e.g., multiple HDLC frames packed into one UART send), so
+     * `SPINEL_PROP_CNTR_TX_SPINEL_TOTAL` divided by this counter gives the average number of frames per write.
+     */
+    SPINEL_PROP_CNTR_TX_SPINEL_WRITES = SPINEL_PROP_CNTR__BEGIN + 308,
+
     /// The message buffer counter info
     /** Format: `SSSSSSSSSSSSSSSS` (Read-only)
      *      `S`, (TotalBuffers)           The number of buffers in the pool.
@@ -2583,6 +2792,9 @@ typedef enum
      *      `S`, (ArpBuffers)             The number of buffers in the ARP send queue.
      *      `S`, (CoapMessages)           The number of messages in the CoAP send queue.
      *      `S`, (CoapBuffers)            The number of buffers in the CoAP send queue.
+     *
+     * The NCP may be configured to also send this property unsolicited, periodically or while it is low on message
+     * buffers, so that the host can monitor congestion without polling.
      */
     SPINEL_PROP_MSG_BUFFER_COUNTERS = SPINEL_PROP_CNTR__BEGIN + 400,
 
@@ -2633,6 +2845,78 @@ typedef enum
      */
     SPINEL_PROP_CNTR_ALL_MAC_COUNTERS = SPINEL_PROP_CNTR__BEGIN + 401,
 
+    /// The message buffer statistics
+    /** Format: `SSSSSSSSSLt(A(S))t(A(S))` (Read-only)
+     *      `S`, (MaxUsedBuffers)           The maximum number of buffers in use at the same time.
+     *      `S`, (6loSendMaxBuffers)        The maximum number of buffers in the 6lo send queue.
+     *      `S`, (6loReassemblyMaxBuffers)  The maximum number of buffers in the 6LoWPAN reassembly queue.
+     *      `S`, (Ip6MaxBuffers)            The maximum number of buffers in the IPv6 send queue.
+     *      `S`, (MplMaxBuffers)            The maximum number of buffers in the MPL send queue.
+     *      `S`, (MleMaxBuffers)            The maximum number of buffers in the MLE send queue.
+     *      `S`, (ArpMaxBuffers)            The maximum number of buffers in the ARP send queue.
+     *      `S`, (CoapMaxBuffers)           The sum of maximum number of buffers in the CoAP queues.
+     *      `S`, (AllocFailures)            The number of message buffer allocation failures.
+     *      `L`, (LowBufferTime)            The total time (in msec) with free buffers below the low threshold.
+     *      `t(A(S))`, (TypeAllocFailures)     The allocation failures per (internal) message type.
+     *      `t(A(S))`, (SubTypeAllocFailures)  The allocation failures per (internal) message sub type.
+     */
+    SPINEL_PROP_MSG_BUFFER_STATS = SPINEL_PROP_CNTR__BEGIN + 402,
+
+    /// MAC operation latency statistics
+    /** Format: `A(t(CLLLLLt(A(L))t(A(L))))` (Read-only)
+     *
+     * One structure per MAC operation (requires `OPENTHREAD_CONFIG_ENABLE_MAC_OPERATION_STATS`):
+     *
+     *      `C`, (Operation)             The MAC operation (`otMacOperation` value).
+     *      `L`, (Count)                 The number of finished operations.
+     *      `L`, (TotalQueueTime)        The sum of queue times (in msec).
+     *      `L`, (MaxQueueTime)          The maximum queue time (in msec).
+     *      `L`, (TotalExecutionTime)    The sum of execution times (in msec).
+     *      `L`, (MaxExecutionTime)      The maximum execution time (in msec).
+     *      `t(A(L))`, (QueueTimeHistogram)      The queue time histogram (see `otMacOperationStats`).
+     *      `t(A(L))`, (ExecutionTimeHistogram)  The execution time histogram (see `otMacOperationStats`).
+     */
+    SPINEL_PROP_CNTR_MAC_OPERATION_STATS = SPINEL_PROP_CNTR__BEGIN + 403,
+
+    /// IPv6 drop counters
+    /** Format: `A(t(CLLLL))` (Read-only)
+     *
+     * One structure per drop reason:
+     *
+     *      `C`, (Reason)   The drop reason (`otIp6DropReason` value).
+     *      `L`, (MeshTx)   The number of outgoing messages dropped by the Thread mesh layer.
+     *      `L`, (MeshRx)   The number of incoming frames dropped by the Thread mesh layer.
+     *      `L`, (Ip6Tx)    The number of outgoing datagrams dropped by the IPv6 layer.
+     *      `L`, (Ip6Rx)    The number of incoming datagrams dropped by the IPv6 layer.
+     */
+    SPINEL_PROP_CNTR_IP_DROP_COUNTERS = SPINEL_PROP_CNTR__BEGIN + 404,
+
+    /// Tasklet and timer handler profile
+    /** Format: `A(t(CXLXL))` (Read-only)
+     *
+     * One structure per profiled handler (requires `OPENTHREAD_CONFIG_ENABLE_HANDLER_PROFILER`):
+     *
+     *      `C`, (Type)       The kind of handler (`otHandlerType` value).
+     *      `X`, (Handler)    The address of the handler function (zero for the overflow entry).
+     *      `L`, (Count)      The number of invocations.
+     *      `X`, (TotalTime)  The cumulative execution time (in microseconds).
+     *      `L`, (MaxTime)    The maximum execution time of a single invocation (in microseconds).
+     */
+    SPINEL_PROP_CNTR_HANDLER_PROFILE = SPINEL_PROP_CNTR__BEGIN + 405,
+
+    /// Radio time statistics
+    /** Format: `A(t(CXXX))` (Read-only)
+     *
+     * One structure per cause the radio time is attributed to (requires
+     * `OPENTHREAD_CONFIG_ENABLE_RADIO_TIME_STATS`):
+     *
+     *      `C`, (Cause)     The cause (`otRadioTimeCause` value).
+     *      `X`, (Sleep)     The time the radio spent sleeping (in microseconds).
+     *      `X`, (Receive)   The time the radio spent receiving (in microseconds).
+     *      `X`, (Transmit)  The time the radio spent transmitting, including CSMA-CA and ack waits (in microseconds).
+     */
+    SPINEL_PROP_CNTR_RADIO_TIME_STATS = SPINEL_PROP_CNTR__BEGIN + 406,
+
     SPINEL_PROP_CNTR__END = 0x800,
 
     SPINEL_PROP_NEST__BEGIN = 0x3BC0,
@@ -2678,6 +2962,16 @@ typedef enum
      */
     SPINEL_PROP_DEBUG_TEST_WATCHDOG = SPINEL_PROP_DEBUG__BEGIN + 2,
 
+    /// The NCP log level of each log region.
+    /** Format: `A(t(iC))` (get) / `iC` (set)
+     *
+     * Each entry is a log region (as per `SPINEL_NCP_LOG_REGION_<region>`) and its NCP log level (as per
+     * `SPINEL_NCP_LOG_LEVEL_<level>`). Setting the property changes the log level of a single region, setting
+     * `SPINEL_PROP_DEBUG_NCP_LOG_LEVEL` changes the log level of all regions.
+     *
+     */
+    SPINEL_PROP_DEBUG_NCP_LOG_REGION_LEVEL = SPINEL_PROP_DEBUG__BEGIN + 3,
+
     SPINEL_PROP_DEBUG__END = 0x4400,
 
     SPINEL_PROP_EXPERIMENTAL__BEGIN = 2000000,
@@ -492,6 +492,28 @@ public:
      */
     otError ReadDataWithLen(const uint8_t *&aData, uint16_t &aDataLen);
 
+    /**
+     * This method decodes and reads an array of fixed-size items, validating it once and returning a view into the
+     * frame instead of copying the items out one at a time.
+     *
+     * All whole items up to the end of the current inner-most open struct (or end of frame) are read. Any trailing
+     * bytes shorter than an item are left unread. `ItemType` must be a byte-array type without alignment requirement
+     * (e.g., `spinel_eui64_t`, `otExtAddress`), since items are used in place in the frame buffer.
+     *
+     * @param[out] aItems               Reference to item pointer variable to output the array.
+     *                                  On success, the pointer variable is updated.
+     * @param[out] aCount               Reference to variable to output the number of items in the array.
+     *
+     * @retval OT_ERROR_NONE            Successfully read the array (it may contain no items).
+     *
+     */
+    template <typename ItemType> otError ReadArray(const ItemType *&aItems, uint16_t &aCount)
+    {
+        aCount = static_cast<uint16_t>(GetRemainingLengthInStruct() / sizeof(ItemType));
+
+        return ReadItem(reinterpret_cast<const uint8_t **>(&aItems), aCount * sizeof(ItemType));
+    }
+
     /**
      * This method opens a struct in the frame.
      *
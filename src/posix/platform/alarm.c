@@ -43,17 +43,76 @@
 #define US_PER_MS 1000
 #define US_PER_S 1000000
 
-static bool     sIsMsRunning = false;
-static uint32_t sMsAlarm     = 0;
-
+/**
+ * This structure holds the alarm state of one OpenThread instance.
+ *
+ */
+typedef struct PlatformAlarm
+{
+    otInstance *mInstance;
+    bool        mIsMsRunning;
+    uint32_t    mMsAlarm;
 #if OPENTHREAD_CONFIG_ENABLE_PLATFORM_USEC_TIMER
-static bool     sIsUsRunning = false;
-static uint32_t sUsAlarm     = 0;
+    bool     mIsUsRunning;
+    uint32_t mUsAlarm;
 #endif
+} PlatformAlarm;
+
+static PlatformAlarm sAlarms[OPENTHREAD_CONFIG_POSIX_APP_MAX_INSTANCES];
 
 static uint32_t       sSpeedUpFactor = 1;
 static struct timeval sStart;
 
+#if OPENTHREAD_CONFIG_POSIX_APP_MAX_INSTANCES > 1
+static bool isAlarmIdle(const PlatformAlarm *aAlarm)
+{
+    bool idle = !aAlarm->mIsMsRunning;
+
+#if OPENTHREAD_CONFIG_ENABLE_PLATFORM_USEC_TIMER
+    idle = idle && !aAlarm->mIsUsRunning;
+#endif
+
+    return idle;
+}
+#endif
+
+static PlatformAlarm *getAlarm(otInstance *aInstance)
+{
+    PlatformAlarm *alarm = NULL;
+
+#if OPENTHREAD_CONFIG_POSIX_APP_MAX_INSTANCES == 1
+    alarm = &sAlarms[0];
+#else
+    PlatformAlarm *idle = NULL;
+
+    for (size_t i = 0; i < OPENTHREAD_CONFIG_POSIX_APP_MAX_INSTANCES; i++)
+    {
+        otEXPECT_ACTION(sAlarms[i].mInstance != aInstance, alarm = &sAlarms[i]);
+
+        // An idle entry may belong to an instance that has since been finalized, so it can be reclaimed.
+        if (idle == NULL && isAlarmIdle(&sAlarms[i]))
+        {
+            idle = &sAlarms[i];
+        }
+    }
+
+    alarm = idle;
+
+    if (alarm == NULL)
+    {
+        fprintf(stderr, "Too many OpenThread instances, max is %d\n", OPENTHREAD_CONFIG_POSIX_APP_MAX_INSTANCES);
+        exit(OT_EXIT_FAILURE);
+    }
+
+    memset(alarm, 0, sizeof(*alarm));
+
+exit:
+#endif
+    alarm->mInstance = aInstance;
+
+    return alarm;
+}
+
 void platformAlarmInit(uint32_t aSpeedUpFactor)
 {
     sSpeedUpFactor = aSpeedUpFactor;
@@ -77,15 +136,15 @@ uint32_t otPlatAlarmMilliGetNow(void)
 
 void otPlatAlarmMilliStartAt(otInstance *aInstance, uint32_t aT0, uint32_t aDt)
 {
-    (void)aInstance;
-    sMsAlarm     = aT0 + aDt;
-    sIsMsRunning = true;
+    PlatformAlarm *alarm = getAlarm(aInstance);
+
+    alarm->mMsAlarm     = aT0 + aDt;
+    alarm->mIsMsRunning = true;
 }
 
 void otPlatAlarmMilliStop(otInstance *aInstance)
 {
-    (void)aInstance;
-    sIsMsRunning = false;
+    getAlarm(aInstance)->mIsMsRunning = false;
 }
 
 #if OPENTHREAD_CONFIG_ENABLE_PLATFORM_USEC_TIMER
@@ -96,15 +155,15 @@ uint32_t otPlatAlarmMicroGetNow(void)
 
 void otPlatAlarmMicroStartAt(otInstance *aInstance, uint32_t aT0, uint32_t aDt)
 {
-    (void)aInstance;
-    sUsAlarm     = aT0 + aDt;
-    sIsUsRunning = true;
+    PlatformAlarm *alarm = getAlarm(aInstance);
+
+    alarm->mUsAlarm     = aT0 + aDt;
+    alarm->mIsUsRunning = true;
 }
 
 void otPlatAlarmMicroStop(otInstance *aInstance)
 {
-    (void)aInstance;
-    sIsUsRunning = false;
+    getAlarm(aInstance)->mIsUsRunning = false;
 }
 #endif // OPENTHREAD_CONFIG_ENABLE_PLATFORM_USEC_TIMER
 
@@ -115,25 +174,36 @@ void platformAlarmUpdateTimeout(struct timeval *aTimeout)
 
     assert(aTimeout != NULL);
 
-    if (sIsMsRunning)
+    for (size_t i = 0; i < OPENTHREAD_CONFIG_POSIX_APP_MAX_INSTANCES; i++)
     {
-        remaining = (int32_t)(sMsAlarm - (uint32_t)(now / US_PER_MS));
-        otEXPECT(remaining > 0);
-        remaining *= US_PER_MS;
-        remaining -= (now % US_PER_MS);
-    }
+        const PlatformAlarm *alarm = &sAlarms[i];
 
-#if OPENTHREAD_CONFIG_ENABLE_PLATFORM_USEC_TIMER
-    if (sIsUsRunning)
-    {
-        int32_t usRemaining = (int32_t)(sUsAlarm - (uint32_t)now);
+        if (alarm->mIsMsRunning)
+        {
+            int64_t msRemaining = (int32_t)(alarm->mMsAlarm - (uint32_t)(now / US_PER_MS));
+
+            otEXPECT_ACTION(msRemaining > 0, remaining = 0);
+            msRemaining *= US_PER_MS;
+            msRemaining -= (now % US_PER_MS);
+
+            if (msRemaining < remaining)
+            {
+                remaining = msRemaining;
+            }
+        }
 
-        if (usRemaining < remaining)
+#if OPENTHREAD_CONFIG_ENABLE_PLATFORM_USEC_TIMER
+        if (alarm->mIsUsRunning)
         {
-            remaining = usRemaining;
+            int32_t usRemaining = (int32_t)(alarm->mUsAlarm - (uint32_t)now);
+
+            if (usRemaining < remaining)
+            {
+                remaining = usRemaining;
+            }
         }
-    }
 #endif // OPENTHREAD_CONFIG_ENABLE_PLATFORM_USEC_TIMER
+    }
 
 exit:
     if (remaining <= 0)
@@ -157,15 +227,16 @@ exit:
 
 void platformAlarmProcess(otInstance *aInstance)
 {
-    int32_t remaining;
+    PlatformAlarm *alarm = getAlarm(aInstance);
+    int32_t        remaining;
 
-    if (sIsMsRunning)
+    if (alarm->mIsMsRunning)
     {
-        remaining = (int32_t)(sMsAlarm - otPlatAlarmMilliGetNow());
+        remaining = (int32_t)(alarm->mMsAlarm - otPlatAlarmMilliGetNow());
 
         if (remaining <= 0)
         {
-            sIsMsRunning = false;
+            alarm->mIsMsRunning = false;
 
 #if OPENTHREAD_ENABLE_DIAG
 
@@ -183,13 +254,13 @@ void platformAlarmProcess(otInstance *aInstance)
 
 #if OPENTHREAD_CONFIG_ENABLE_PLATFORM_USEC_TIMER
 
-    if (sIsUsRunning)
+    if (alarm->mIsUsRunning)
     {
-        remaining = (int32_t)(sUsAlarm - otPlatAlarmMicroGetNow());
+        remaining = (int32_t)(alarm->mUsAlarm - otPlatAlarmMicroGetNow());
 
         if (remaining <= 0)
         {
-            sIsUsRunning = false;
+            alarm->mIsUsRunning = false;
 
             otPlatAlarmMicroFired(aInstance);
         }
@@ -0,0 +1,514 @@
+/*
+ *  Copyright (c) 2018, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the event loop used by the POSIX platform drivers.
+ *
+ *   Drivers register their file descriptors once, together with a handler, and only update the events of interest
+ *   when they change. The loop is backed by epoll on Linux and kqueue on BSD/macOS, so the cost of waiting does not
+ *   depend on the number or value of registered file descriptors. Other systems fall back to select().
+ */
+
+#include "platform-posix.h"
+
+#include <assert.h>
+#include <errno.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#if defined(__linux__)
+#define EVENT_LOOP_USE_EPOLL 1
+#include <sys/epoll.h>
+#elif defined(__APPLE__) || defined(__FreeBSD__) || defined(__NetBSD__) || defined(__OpenBSD__)
+#define EVENT_LOOP_USE_KQUEUE 1
+#include <sys/event.h>
+#include <sys/types.h>
+#endif
+
+#include "code_utils.h"
+
+enum
+{
+    kMaxReadyEvents = 2 * OPENTHREAD_CONFIG_POSIX_APP_MAX_EVENT_SOURCES, ///< Read and write may be reported apart.
+};
+
+typedef struct EventSource
+{
+    int                  mFd;            ///< The file descriptor, -1 if the entry is free.
+    uint32_t             mEvents;        ///< The `OT_SYS_EVENT_*` events of interest.
+    platformEventHandler mHandler;       ///< The handler called when the file descriptor is ready.
+    void *               mContext;       ///< The context passed to `mHandler`.
+    bool                 mIsAlwaysReady; ///< The file descriptor cannot be polled (e.g. a regular file).
+} EventSource;
+
+static EventSource sEventSources[OPENTHREAD_CONFIG_POSIX_APP_MAX_EVENT_SOURCES];
+
+#if EVENT_LOOP_USE_EPOLL || EVENT_LOOP_USE_KQUEUE
+static int sEventFd = -1; ///< The epoll or kqueue file descriptor.
+#endif
+
+static EventSource *findEventSource(int aFd)
+{
+    EventSource *source = NULL;
+
+    for (size_t i = 0; i < OPENTHREAD_CONFIG_POSIX_APP_MAX_EVENT_SOURCES; i++)
+    {
+        if (sEventSources[i].mFd == aFd)
+        {
+            otEXIT_NOW(source = &sEventSources[i]);
+        }
+    }
+
+exit:
+    return source;
+}
+
+/**
+ * This function updates the events of interest of @p aSource with the kernel.
+ *
+ * @param[in]  aSource  A pointer to the event source.
+ * @param[in]  aEvents  The new `OT_SYS_EVENT_*` events of interest.
+ * @param[in]  aIsNew   TRUE if @p aSource is not yet known to the kernel.
+ *
+ * @returns 0 on success, -1 on failure with `errno` set.
+ *
+ */
+static int updateInterest(EventSource *aSource, uint32_t aEvents, bool aIsNew)
+{
+    int rval = 0;
+
+#if EVENT_LOOP_USE_EPOLL
+    struct epoll_event event;
+
+    memset(&event, 0, sizeof(event));
+    event.events  = ((aEvents & OT_SYS_EVENT_READ) ? EPOLLIN : 0) | ((aEvents & OT_SYS_EVENT_WRITE) ? EPOLLOUT : 0);
+    event.data.fd = aSource->mFd;
+
+    rval = epoll_ctl(sEventFd, aIsNew ? EPOLL_CTL_ADD : EPOLL_CTL_MOD, aSource->mFd, &event);
+#elif EVENT_LOOP_USE_KQUEUE
+    struct kevent changes[2];
+
+    OT_UNUSED_VARIABLE(aIsNew);
+
+    EV_SET(&changes[0], aSource->mFd, EVFILT_READ, EV_ADD | ((aEvents & OT_SYS_EVENT_READ) ? EV_ENABLE : EV_DISABLE),
+           0, 0, NULL);
+    EV_SET(&changes[1], aSource->mFd, EVFILT_WRITE,
+           EV_ADD | ((aEvents & OT_SYS_EVENT_WRITE) ? EV_ENABLE : EV_DISABLE), 0, 0, NULL);
+
+    rval = kevent(sEventFd, changes, 2, NULL, 0, NULL);
+#else
+    OT_UNUSED_VARIABLE(aSource);
+    OT_UNUSED_VARIABLE(aEvents);
+    OT_UNUSED_VARIABLE(aIsNew);
+#endif
+
+    return rval;
+}
+
+static void dispatchEvents(otInstance *aInstance, int aFd, uint32_t aEvents)
+{
+    EventSource *source = findEventSource(aFd);
+
+    // The source may have been unregistered by a handler called earlier in the same iteration.
+    otEXPECT(source != NULL);
+
+    aEvents &= (source->mEvents | OT_SYS_EVENT_ERROR);
+    otEXPECT(aEvents != 0);
+
+    source->mHandler(aInstance, source->mContext, aEvents);
+
+exit:
+    return;
+}
+
+void platformEventLoopInit(void)
+{
+    for (size_t i = 0; i < OPENTHREAD_CONFIG_POSIX_APP_MAX_EVENT_SOURCES; i++)
+    {
+        sEventSources[i].mFd = -1;
+    }
+
+#if EVENT_LOOP_USE_EPOLL
+    sEventFd = epoll_create1(EPOLL_CLOEXEC);
+#elif EVENT_LOOP_USE_KQUEUE
+    sEventFd = kqueue();
+#endif
+
+#if EVENT_LOOP_USE_EPOLL || EVENT_LOOP_USE_KQUEUE
+    if (sEventFd == -1)
+    {
+        perror("event loop");
+        exit(OT_EXIT_FAILURE);
+    }
+#endif
+}
+
+void platformEventLoopDeinit(void)
+{
+#if EVENT_LOOP_USE_EPOLL || EVENT_LOOP_USE_KQUEUE
+    if (sEventFd != -1)
+    {
+        close(sEventFd);
+        sEventFd = -1;
+    }
+#endif
+}
+
+void platformEventRegister(int aFd, uint32_t aEvents, platformEventHandler aHandler, void *aContext)
+{
+    EventSource *source;
+
+    assert(aFd >= 0 && aHandler != NULL);
+    assert(findEventSource(aFd) == NULL);
+
+    source = findEventSource(-1);
+
+    if (source == NULL)
+    {
+        fprintf(stderr, "Too many event sources, increase OPENTHREAD_CONFIG_POSIX_APP_MAX_EVENT_SOURCES\r\n");
+        exit(OT_EXIT_FAILURE);
+    }
+
+    source->mFd            = aFd;
+    source->mEvents        = aEvents;
+    source->mHandler       = aHandler;
+    source->mContext       = aContext;
+    source->mIsAlwaysReady = false;
+
+    if (updateInterest(source, aEvents, true) != 0)
+    {
+        // Regular files cannot be polled, select() reports them as always ready so do the same here.
+        if (errno == EPERM)
+        {
+            source->mIsAlwaysReady = true;
+        }
+        else
+        {
+            perror("event register");
+            exit(OT_EXIT_FAILURE);
+        }
+    }
+}
+
+void platformEventUpdate(int aFd, uint32_t aEvents)
+{
+    EventSource *source = findEventSource(aFd);
+
+    assert(source != NULL);
+    otEXPECT(source->mEvents != aEvents);
+
+    source->mEvents = aEvents;
+    otEXPECT(!source->mIsAlwaysReady);
+
+    if (updateInterest(source, aEvents, false) != 0)
+    {
+        perror("event update");
+        exit(OT_EXIT_FAILURE);
+    }
+
+exit:
+    return;
+}
+
+void platformEventUnregister(int aFd)
+{
+    EventSource *source = findEventSource(aFd);
+
+    otEXPECT(source != NULL);
+
+    if (!source->mIsAlwaysReady)
+    {
+#if EVENT_LOOP_USE_EPOLL
+        epoll_ctl(sEventFd, EPOLL_CTL_DEL, aFd, NULL);
+#elif EVENT_LOOP_USE_KQUEUE
+        struct kevent changes[2];
+
+        EV_SET(&changes[0], aFd, EVFILT_READ, EV_DELETE, 0, 0, NULL);
+        EV_SET(&changes[1], aFd, EVFILT_WRITE, EV_DELETE, 0, 0, NULL);
+        kevent(sEventFd, changes, 2, NULL, 0, NULL);
+#endif
+    }
+
+    source->mFd = -1;
+
+exit:
+    return;
+}
+
+static bool hasAlwaysReadySource(void)
+{
+    bool found = false;
+
+    for (size_t i = 0; i < OPENTHREAD_CONFIG_POSIX_APP_MAX_EVENT_SOURCES; i++)
+    {
+        if (sEventSources[i].mFd != -1 && sEventSources[i].mIsAlwaysReady && sEventSources[i].mEvents != 0)
+        {
+            otEXIT_NOW(found = true);
+        }
+    }
+
+exit:
+    return found;
+}
+
+static void dispatchAlwaysReadySources(otInstance *aInstance)
+{
+    for (size_t i = 0; i < OPENTHREAD_CONFIG_POSIX_APP_MAX_EVENT_SOURCES; i++)
+    {
+        if (sEventSources[i].mFd != -1 && sEventSources[i].mIsAlwaysReady)
+        {
+            dispatchEvents(aInstance, sEventSources[i].mFd, sEventSources[i].mEvents);
+        }
+    }
+}
+
+static void checkWaitResult(int aResult)
+{
+    if ((aResult < 0) && (errno != EINTR))
+    {
+        perror("event wait");
+        exit(OT_EXIT_FAILURE);
+    }
+}
+
+#if EVENT_LOOP_USE_EPOLL || EVENT_LOOP_USE_KQUEUE
+/**
+ * This function waits on the epoll or kqueue file descriptor and calls the handlers of the ready file descriptors.
+ *
+ * @param[in]  aInstance  The OpenThread instance structure.
+ * @param[in]  aTimeout   A pointer to the maximum time to wait.
+ *
+ * @returns The number of ready events, or -1 on failure with `errno` set.
+ *
+ */
+static int waitEvents(otInstance *aInstance, const struct timeval *aTimeout)
+{
+    int rval;
+
+#if EVENT_LOOP_USE_EPOLL
+    struct epoll_event events[kMaxReadyEvents];
+    int                timeoutMs;
+
+    if (aTimeout->tv_sec >= INT_MAX / 1000 - 1)
+    {
+        timeoutMs = INT_MAX;
+    }
+    else
+    {
+        timeoutMs = (int)(aTimeout->tv_sec * 1000 + (aTimeout->tv_usec + 999) / 1000);
+    }
+
+    rval = epoll_wait(sEventFd, events, kMaxReadyEvents, timeoutMs);
+
+    for (int i = 0; i < rval; i++)
+    {
+        uint32_t ready = 0;
+
+        // A hang-up is reported as readable so that the handler observes end of file from read().
+        ready |= (events[i].events & (EPOLLIN | EPOLLHUP)) ? OT_SYS_EVENT_READ : 0;
+        ready |= (events[i].events & EPOLLOUT) ? OT_SYS_EVENT_WRITE : 0;
+        ready |= (events[i].events & EPOLLERR) ? OT_SYS_EVENT_ERROR : 0;
+
+        dispatchEvents(aInstance, events[i].data.fd, ready);
+    }
+#else
+    struct kevent   events[kMaxReadyEvents];
+    struct timespec timespec;
+
+    timespec.tv_sec  = aTimeout->tv_sec;
+    timespec.tv_nsec = aTimeout->tv_usec * 1000;
+
+    rval = kevent(sEventFd, NULL, 0, events, kMaxReadyEvents, &timespec);
+
+    for (int i = 0; i < rval; i++)
+    {
+        uint32_t ready = 0;
+
+        if (events[i].flags & EV_ERROR)
+        {
+            ready = OT_SYS_EVENT_ERROR;
+        }
+        else if (events[i].filter == EVFILT_READ)
+        {
+            ready = OT_SYS_EVENT_READ;
+        }
+        else if (events[i].filter == EVFILT_WRITE)
+        {
+            ready = OT_SYS_EVENT_WRITE;
+        }
+
+        dispatchEvents(aInstance, (int)events[i].ident, ready);
+    }
+#endif
+
+    return rval;
+}
+#else  // EVENT_LOOP_USE_EPOLL || EVENT_LOOP_USE_KQUEUE
+static void addSourcesToFdSets(fd_set *aReadFdSet, fd_set *aWriteFdSet, fd_set *aErrorFdSet, int *aMaxFd)
+{
+    for (size_t i = 0; i < OPENTHREAD_CONFIG_POSIX_APP_MAX_EVENT_SOURCES; i++)
+    {
+        const EventSource *source = &sEventSources[i];
+
+        if (source->mFd == -1 || source->mIsAlwaysReady)
+        {
+            continue;
+        }
+
+        if (source->mEvents & OT_SYS_EVENT_READ)
+        {
+            FD_SET(source->mFd, aReadFdSet);
+        }
+
+        if (source->mEvents & OT_SYS_EVENT_WRITE)
+        {
+            FD_SET(source->mFd, aWriteFdSet);
+        }
+
+        FD_SET(source->mFd, aErrorFdSet);
+
+        if (*aMaxFd < source->mFd)
+        {
+            *aMaxFd = source->mFd;
+        }
+    }
+}
+
+static void dispatchFdSets(otInstance *  aInstance,
+                           const fd_set *aReadFdSet,
+                           const fd_set *aWriteFdSet,
+                           const fd_set *aErrorFdSet,
+                           int           aMaxFd)
+{
+    for (int fd = 0; fd <= aMaxFd; fd++)
+    {
+        uint32_t ready = 0;
+
+        ready |= FD_ISSET(fd, aReadFdSet) ? OT_SYS_EVENT_READ : 0;
+        ready |= FD_ISSET(fd, aWriteFdSet) ? OT_SYS_EVENT_WRITE : 0;
+        ready |= FD_ISSET(fd, aErrorFdSet) ? OT_SYS_EVENT_ERROR : 0;
+
+        if (ready != 0)
+        {
+            dispatchEvents(aInstance, fd, ready);
+        }
+    }
+}
+#endif // EVENT_LOOP_USE_EPOLL || EVENT_LOOP_USE_KQUEUE
+
+void platformEventLoopWait(otInstance *aInstance, const struct timeval *aTimeout)
+{
+    struct timeval timeout = *aTimeout;
+    int            rval;
+
+    if (hasAlwaysReadySource())
+    {
+        timerclear(&timeout);
+    }
+
+#if EVENT_LOOP_USE_EPOLL || EVENT_LOOP_USE_KQUEUE
+    rval = waitEvents(aInstance, &timeout);
+#else
+    fd_set readFdSet;
+    fd_set writeFdSet;
+    fd_set errorFdSet;
+    int    maxFd = -1;
+
+    FD_ZERO(&readFdSet);
+    FD_ZERO(&writeFdSet);
+    FD_ZERO(&errorFdSet);
+
+    addSourcesToFdSets(&readFdSet, &writeFdSet, &errorFdSet, &maxFd);
+
+    rval = select(maxFd + 1, &readFdSet, &writeFdSet, &errorFdSet, &timeout);
+
+    if (rval > 0)
+    {
+        dispatchFdSets(aInstance, &readFdSet, &writeFdSet, &errorFdSet, maxFd);
+    }
+#endif
+
+    checkWaitResult(rval);
+    dispatchAlwaysReadySources(aInstance);
+}
+
+void platformEventLoopUpdateFdSet(fd_set *        aReadFdSet,
+                                  fd_set *        aWriteFdSet,
+                                  fd_set *        aErrorFdSet,
+                                  int *           aMaxFd,
+                                  struct timeval *aTimeout)
+{
+    if (hasAlwaysReadySource())
+    {
+        timerclear(aTimeout);
+    }
+
+#if EVENT_LOOP_USE_EPOLL || EVENT_LOOP_USE_KQUEUE
+    // The epoll/kqueue file descriptor becomes readable when any registered file descriptor is ready, so it is the
+    // only one the external event loop needs to watch.
+    OT_UNUSED_VARIABLE(aWriteFdSet);
+    OT_UNUSED_VARIABLE(aErrorFdSet);
+
+    FD_SET(sEventFd, aReadFdSet);
+
+    if (*aMaxFd < sEventFd)
+    {
+        *aMaxFd = sEventFd;
+    }
+#else
+    addSourcesToFdSets(aReadFdSet, aWriteFdSet, aErrorFdSet, aMaxFd);
+#endif
+}
+
+void platformEventLoopProcess(otInstance *  aInstance,
+                              const fd_set *aReadFdSet,
+                              const fd_set *aWriteFdSet,
+                              const fd_set *aErrorFdSet,
+                              int           aMaxFd)
+{
+#if EVENT_LOOP_USE_EPOLL || EVENT_LOOP_USE_KQUEUE
+    OT_UNUSED_VARIABLE(aWriteFdSet);
+    OT_UNUSED_VARIABLE(aErrorFdSet);
+    OT_UNUSED_VARIABLE(aMaxFd);
+
+    if (FD_ISSET(sEventFd, aReadFdSet))
+    {
+        struct timeval noWait = {0, 0};
+
+        checkWaitResult(waitEvents(aInstance, &noWait));
+    }
+#else
+    dispatchFdSets(aInstance, aReadFdSet, aWriteFdSet, aErrorFdSet, aMaxFd);
+#endif
+
+    dispatchAlwaysReadySources(aInstance);
+}
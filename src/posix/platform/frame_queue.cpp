@@ -106,6 +106,88 @@ exit:
     return frame;
 }
 
+void SpscFrameQueue::Copy(uint32_t aPosition, const uint8_t *aData, uint16_t aLength)
+{
+    uint32_t offset = aPosition & (kQueueSize - 1);
+    uint32_t first  = kQueueSize - offset;
+
+    if (first >= aLength)
+    {
+        memcpy(mBuffer + offset, aData, aLength);
+    }
+    else
+    {
+        memcpy(mBuffer + offset, aData, first);
+        memcpy(mBuffer, aData + first, aLength - first);
+    }
+}
+
+void SpscFrameQueue::Copy(uint8_t *aData, uint32_t aPosition, uint16_t aLength) const
+{
+    uint32_t offset = aPosition & (kQueueSize - 1);
+    uint32_t first  = kQueueSize - offset;
+
+    if (first >= aLength)
+    {
+        memcpy(aData, mBuffer + offset, aLength);
+    }
+    else
+    {
+        memcpy(aData, mBuffer + offset, first);
+        memcpy(aData + first, mBuffer, aLength - first);
+    }
+}
+
+otError SpscFrameQueue::Push(const uint8_t *aFrame, uint16_t aLength)
+{
+    otError  error = OT_ERROR_NONE;
+    uint32_t head  = __atomic_load_n(&mHead, __ATOMIC_ACQUIRE);
+    uint32_t tail  = mTail;
+    uint8_t  header[kHeaderSize];
+
+    assert(aFrame != NULL);
+    VerifyOrExit(kQueueSize - (tail - head) >= static_cast<uint32_t>(aLength) + kHeaderSize,
+                 error = OT_ERROR_NO_BUFS);
+
+    header[0] = static_cast<uint8_t>(aLength >> 8);
+    header[1] = static_cast<uint8_t>(aLength & 0xff);
+
+    Copy(tail, header, sizeof(header));
+    Copy(tail + kHeaderSize, aFrame, aLength);
+
+    __atomic_store_n(&mTail, tail + kHeaderSize + aLength, __ATOMIC_RELEASE);
+
+exit:
+    return error;
+}
+
+otError SpscFrameQueue::Shift(uint8_t *aFrame, uint16_t aMaxLength, uint16_t &aLength)
+{
+    otError  error = OT_ERROR_NONE;
+    uint32_t tail  = __atomic_load_n(&mTail, __ATOMIC_ACQUIRE);
+    uint32_t head  = mHead;
+    uint8_t  header[kHeaderSize];
+
+    VerifyOrExit(head != tail, error = OT_ERROR_NOT_FOUND);
+
+    Copy(header, head, sizeof(header));
+    aLength = static_cast<uint16_t>((header[0] << 8) | header[1]);
+
+    if (aLength <= aMaxLength)
+    {
+        Copy(aFrame, head + kHeaderSize, aLength);
+    }
+    else
+    {
+        error = OT_ERROR_NO_BUFS;
+    }
+
+    __atomic_store_n(&mHead, head + kHeaderSize + aLength, __ATOMIC_RELEASE);
+
+exit:
+    return error;
+}
+
 } // namespace ot
 
 #if SELF_TEST
@@ -229,11 +311,56 @@ void TestRing()
     };
 }
 
+void TestSpsc()
+{
+    ot::SpscFrameQueue frameQueue;
+    uint8_t            frame[1000];
+    uint8_t            outFrame[1000];
+    uint16_t           length;
+    size_t             pushed  = 0;
+    size_t             shifted = 0;
+
+    for (size_t i = 0; i < sizeof(frame); ++i)
+    {
+        frame[i] = static_cast<uint8_t>(i);
+    }
+
+    assert(frameQueue.IsEmpty());
+    assert(frameQueue.Shift(outFrame, sizeof(outFrame), length) == OT_ERROR_NOT_FOUND);
+
+    // Fill the queue completely, then drain it, several times so that frames wrap around the buffer.
+    for (size_t round = 0; round < 8; ++round)
+    {
+        while (frameQueue.Push(frame, static_cast<uint16_t>((pushed * 7) % sizeof(frame))) == OT_ERROR_NONE)
+        {
+            ++pushed;
+        }
+
+        assert(!frameQueue.IsEmpty());
+
+        while (frameQueue.Shift(outFrame, sizeof(outFrame), length) == OT_ERROR_NONE)
+        {
+            assert(length == (shifted * 7) % sizeof(frame));
+            assert(memcmp(outFrame, frame, length) == 0);
+            ++shifted;
+        }
+
+        assert(frameQueue.IsEmpty());
+        assert(pushed == shifted);
+    }
+
+    // Frames larger than the consumer buffer are dropped.
+    assert(frameQueue.Push(frame, sizeof(frame)) == OT_ERROR_NONE);
+    assert(frameQueue.Shift(outFrame, 10, length) == OT_ERROR_NO_BUFS);
+    assert(frameQueue.IsEmpty());
+}
+
 void RunAllTests()
 {
     TestSingle();
     TestMultiple();
     TestRing();
+    TestSpsc();
 }
 
 int main(void)
@@ -36,6 +36,8 @@
 
 #include <stdint.h>
 
+#include <openthread/error.h>
+
 /**
  * @def OPENTHREAD_CONFIG_FRAME_QUEUE_SIZE
  *
@@ -46,6 +48,20 @@
 #define OPENTHREAD_CONFIG_FRAME_QUEUE_SIZE 4096
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_SPSC_FRAME_QUEUE_SIZE
+ *
+ * The size of a single-producer/single-consumer frame queue in bytes, must be a power of two.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_SPSC_FRAME_QUEUE_SIZE
+#define OPENTHREAD_CONFIG_SPSC_FRAME_QUEUE_SIZE 16384
+#endif
+
+#if (OPENTHREAD_CONFIG_SPSC_FRAME_QUEUE_SIZE & (OPENTHREAD_CONFIG_SPSC_FRAME_QUEUE_SIZE - 1)) != 0
+#error "OPENTHREAD_CONFIG_SPSC_FRAME_QUEUE_SIZE must be a power of two"
+#endif
+
 namespace ot {
 
 class FrameQueue
@@ -106,6 +122,79 @@ private:
     uint16_t mTail;
 };
 
+/**
+ * This class implements a lock-free frame queue for exactly one producer thread and one consumer thread.
+ *
+ * The producer only writes `mTail` and the consumer only writes `mHead`, each published with release semantics
+ * after the frame data (or the free space) it covers.
+ *
+ */
+class SpscFrameQueue
+{
+public:
+    /**
+     * This constructor initializes an empty queue.
+     *
+     */
+    SpscFrameQueue(void)
+        : mHead(0)
+        , mTail(0)
+    {
+    }
+
+    /**
+     * This method checks if the queue is empty.
+     *
+     * @retval true     No frames are queued.
+     * @retval false    At least one frame is queued.
+     *
+     */
+    bool IsEmpty(void) const
+    {
+        return __atomic_load_n(&mTail, __ATOMIC_ACQUIRE) == __atomic_load_n(&mHead, __ATOMIC_ACQUIRE);
+    }
+
+    /**
+     * This method pushes one frame into the queue, must only be called from the producer thread.
+     *
+     * @param[in]   aFrame      A pointer to the frame to be queued.
+     * @param[in]   aLength     Frame length in bytes.
+     *
+     * @retval OT_ERROR_NONE    Successfully queued this frame.
+     * @retval OT_ERROR_NO_BUFS Insufficient space for this frame.
+     *
+     */
+    otError Push(const uint8_t *aFrame, uint16_t aLength);
+
+    /**
+     * This method removes the frame at head of the queue, must only be called from the consumer thread.
+     *
+     * @param[out]  aFrame      A pointer to the buffer to receive the frame.
+     * @param[in]   aMaxLength  The size of @p aFrame in bytes.
+     * @param[out]  aLength     A reference to receive the frame length.
+     *
+     * @retval OT_ERROR_NONE        Successfully removed a frame.
+     * @retval OT_ERROR_NOT_FOUND   The queue is empty.
+     * @retval OT_ERROR_NO_BUFS     The frame is larger than @p aMaxLength, it is dropped.
+     *
+     */
+    otError Shift(uint8_t *aFrame, uint16_t aMaxLength, uint16_t &aLength);
+
+private:
+    enum
+    {
+        kQueueSize  = OPENTHREAD_CONFIG_SPSC_FRAME_QUEUE_SIZE,
+        kHeaderSize = sizeof(uint16_t),
+    };
+
+    void Copy(uint32_t aPosition, const uint8_t *aData, uint16_t aLength);
+    void Copy(uint8_t *aData, uint32_t aPosition, uint16_t aLength) const;
+
+    uint8_t  mBuffer[kQueueSize];
+    uint32_t mHead; ///< Free-running read position, written by the consumer only.
+    uint32_t mTail; ///< Free-running write position, written by the producer only.
+};
+
 } // namespace ot
 
 #endif // OT_FRAME_CACHE_HPP_
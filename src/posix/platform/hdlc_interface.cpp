@@ -46,8 +46,13 @@
 #include <pty.h>
 #endif
 #endif
+#include <poll.h>
 #include <stdarg.h>
 #include <stdlib.h>
+#include <string.h>
+#if OPENTHREAD_CONFIG_POSIX_APP_ENABLE_RCP_READER_THREAD
+#include <sys/eventfd.h>
+#endif
 #include <sys/resource.h>
 #include <sys/stat.h>
 #include <sys/time.h>
@@ -59,6 +64,15 @@
 #include <common/code_utils.hpp>
 #include <common/logging.hpp>
 
+#if OPENTHREAD_CONFIG_POSIX_APP_ENABLE_RCP_READER_THREAD
+#if OPENTHREAD_POSIX_VIRTUAL_TIME
+#error "OPENTHREAD_CONFIG_POSIX_APP_ENABLE_RCP_READER_THREAD is not supported with OPENTHREAD_POSIX_VIRTUAL_TIME"
+#endif
+#ifndef __linux__
+#error "OPENTHREAD_CONFIG_POSIX_APP_ENABLE_RCP_READER_THREAD requires eventfd (Linux)"
+#endif
+#endif
+
 #ifndef SOCKET_UTILS_DEFAULT_SHELL
 #define SOCKET_UTILS_DEFAULT_SHELL "/bin/sh"
 #endif
@@ -69,17 +83,17 @@ namespace PosixApp {
 class EncoderBuffer : public Hdlc::Encoder::BufferWriteIterator
 {
 public:
-    EncoderBuffer(void)
+    EncoderBuffer(uint8_t *aBuffer, uint16_t aSize)
+        : mBuffer(aBuffer)
     {
-        mWritePointer    = mBuffer;
-        mRemainingLength = sizeof(mBuffer);
+        mWritePointer    = aBuffer;
+        mRemainingLength = aSize;
     }
 
-    uint16_t       GetLength(void) const { return static_cast<uint16_t>(mWritePointer - mBuffer); }
-    const uint8_t *GetBuffer(void) const { return mBuffer; }
+    uint16_t GetLength(void) const { return static_cast<uint16_t>(mWritePointer - mBuffer); }
 
 private:
-    uint8_t mBuffer[HdlcInterface::kMaxFrameSize];
+    uint8_t *mBuffer;
 };
 
 HdlcInterface::HdlcInterface(Callbacks &aCallbacks)
@@ -87,7 +101,13 @@ HdlcInterface::HdlcInterface(Callbacks &aCallbacks)
     , mSockFd(-1)
     , mIsDecoding(false)
     , mHdlcDecoder(mDecoderBuffer, sizeof(mDecoderBuffer), HandleHdlcFrame, HandleHdlcError, this)
+    , mTxLength(0)
+    , mTxFrames(0)
+#if OPENTHREAD_CONFIG_POSIX_APP_ENABLE_RCP_READER_THREAD
+    , mEventFd(-1)
+#endif
 {
+    memset(&mCounters, 0, sizeof(mCounters));
 }
 
 otError HdlcInterface::Init(const char *aRadioFile, const char *aRadioConfig)
@@ -117,6 +137,10 @@ otError HdlcInterface::Init(const char *aRadioFile, const char *aRadioConfig)
         ExitNow(error = OT_ERROR_INVALID_ARGS);
     }
 
+#if OPENTHREAD_CONFIG_POSIX_APP_ENABLE_RCP_READER_THREAD
+    error = StartReader();
+#endif
+
 exit:
     return error;
 }
@@ -125,6 +149,13 @@ void HdlcInterface::Deinit(void)
 {
     assert(mSockFd != -1);
 
+#if OPENTHREAD_CONFIG_POSIX_APP_ENABLE_RCP_READER_THREAD
+    StopReader();
+#endif
+
+    otLogInfoPlat("HDLC rx %u frames in %u reads, tx %u frames in %u writes", mCounters.mRxFrames, mCounters.mRxReads,
+                  mCounters.mTxFrames, mCounters.mTxWrites);
+
     VerifyOrExit(0 == close(mSockFd), perror("close NCP"));
     VerifyOrExit(-1 != wait(NULL), perror("wait NCP"));
 
@@ -136,27 +167,154 @@ exit:
 
 void HdlcInterface::Read(void)
 {
-    uint8_t buffer[kMaxFrameSize];
-    ssize_t rval;
+#if OPENTHREAD_CONFIG_POSIX_APP_ENABLE_RCP_READER_THREAD
+    uint64_t count;
+    uint16_t length;
 
-    rval = read(mSockFd, buffer, sizeof(buffer));
-
-    if (rval < 0)
+    if (read(mEventFd, &count, sizeof(count)) < 0 && errno != EAGAIN && errno != EINTR)
     {
         perror("HdlcInterface::Read()");
+        abort();
+    }
+
+    mIsDecoding = true;
 
-        if (errno != EAGAIN)
+    while (true)
+    {
+        otError error = mRxQueue.Shift(mRxFrame, sizeof(mRxFrame), length);
+
+        if (error == OT_ERROR_NOT_FOUND)
         {
-            abort();
+            break;
+        }
+
+        if (error == OT_ERROR_NONE)
+        {
+            mCounters.mRxFrames++;
+            mCallbacks.HandleReceivedFrame(mRxFrame, length);
         }
     }
 
-    if (rval > 0)
+    mIsDecoding = false;
+#else
+    mIsDecoding = true;
+    ReadSocket();
+    mIsDecoding = false;
+#endif
+}
+
+void HdlcInterface::ReadSocket(void)
+{
+    for (uint8_t i = 0; i < kMaxReadsPerEvent; i++)
     {
-        Decode(buffer, static_cast<uint16_t>(rval));
+        ssize_t rval = read(mSockFd, mRxBuffer, sizeof(mRxBuffer));
+
+        if (rval < 0)
+        {
+            if (errno != EAGAIN && errno != EINTR)
+            {
+                perror("HdlcInterface::Read()");
+                abort();
+            }
+
+            break;
+        }
+
+        if (rval == 0)
+        {
+            break;
+        }
+
+        mCounters.mRxReads++;
+        mHdlcDecoder.Decode(mRxBuffer, static_cast<uint16_t>(rval));
+
+        if (static_cast<size_t>(rval) < sizeof(mRxBuffer))
+        {
+            // Short read, the socket is drained.
+            break;
+        }
     }
 }
 
+#if OPENTHREAD_CONFIG_POSIX_APP_ENABLE_RCP_READER_THREAD
+otError HdlcInterface::StartReader(void)
+{
+    otError error = OT_ERROR_NONE;
+
+    mEventFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    VerifyOrExit(mEventFd != -1, perror("eventfd"); error = OT_ERROR_FAILED);
+
+    VerifyOrExit(pthread_create(&mReaderThread, NULL, &HdlcInterface::ReaderThread, this) == 0,
+                 otLogCritPlat("Failed to start RCP reader thread"); error = OT_ERROR_FAILED);
+
+exit:
+    return error;
+}
+
+void HdlcInterface::StopReader(void)
+{
+    VerifyOrExit(mEventFd != -1);
+
+    pthread_cancel(mReaderThread);
+    pthread_join(mReaderThread, NULL);
+
+    close(mEventFd);
+    mEventFd = -1;
+
+exit:
+    return;
+}
+
+void *HdlcInterface::ReaderThread(void *aContext)
+{
+    static_cast<HdlcInterface *>(aContext)->RunReader();
+    return NULL;
+}
+
+void HdlcInterface::RunReader(void)
+{
+    const uint64_t one = 1;
+
+    while (true)
+    {
+        struct pollfd pollFd;
+        int           rval;
+
+        pollFd.fd      = mSockFd;
+        pollFd.events  = POLLIN;
+        pollFd.revents = 0;
+
+        rval = poll(&pollFd, 1, -1);
+
+        if (rval < 0)
+        {
+            if (errno != EINTR)
+            {
+                perror("poll");
+                exit(OT_EXIT_FAILURE);
+            }
+
+            continue;
+        }
+
+        if ((pollFd.revents & POLLIN) == 0 && (pollFd.revents & (POLLERR | POLLHUP | POLLNVAL)) != 0)
+        {
+            fprintf(stderr, "NCP error\r\n");
+            exit(OT_EXIT_FAILURE);
+        }
+
+        ReadSocket();
+
+        // The main loop drains all queued frames on each wake-up, so one signal per batch is enough.
+        if (!mRxQueue.IsEmpty() && write(mEventFd, &one, sizeof(one)) < 0 && errno != EAGAIN)
+        {
+            perror("HdlcInterface reader");
+            abort();
+        }
+    }
+}
+#endif // OPENTHREAD_CONFIG_POSIX_APP_ENABLE_RCP_READER_THREAD
+
 void HdlcInterface::Decode(const uint8_t *aBuffer, uint16_t aLength)
 {
     mIsDecoding = true;
@@ -166,15 +324,57 @@ void HdlcInterface::Decode(const uint8_t *aBuffer, uint16_t aLength)
 
 otError HdlcInterface::SendFrame(const uint8_t *aFrame, uint16_t aLength)
 {
-    otError       error = OT_ERROR_NONE;
-    Hdlc::Encoder hdlcEncoder;
-    EncoderBuffer encoderBuffer;
+    otError error = OT_ERROR_NONE;
 
-    SuccessOrExit(error = hdlcEncoder.Init(encoderBuffer));
-    SuccessOrExit(error = hdlcEncoder.Encode(aFrame, aLength, encoderBuffer));
-    SuccessOrExit(error = hdlcEncoder.Finalize(encoderBuffer));
+    for (uint8_t attempt = 0; attempt < 2; attempt++)
+    {
+        Hdlc::Encoder hdlcEncoder;
+        EncoderBuffer encoderBuffer(mTxBuffer + mTxLength, static_cast<uint16_t>(sizeof(mTxBuffer) - mTxLength));
 
-    SuccessOrExit(error = Write(encoderBuffer.GetBuffer(), encoderBuffer.GetLength()));
+        error = hdlcEncoder.Init(encoderBuffer);
+
+        if (error == OT_ERROR_NONE)
+        {
+            error = hdlcEncoder.Encode(aFrame, aLength, encoderBuffer);
+        }
+
+        if (error == OT_ERROR_NONE)
+        {
+            error = hdlcEncoder.Finalize(encoderBuffer);
+        }
+
+        if (error == OT_ERROR_NONE)
+        {
+            mTxLength += encoderBuffer.GetLength();
+            mTxFrames++;
+            break;
+        }
+
+        // The queue is full (or the frame does not fit even in an empty queue), flush and retry once.
+        VerifyOrExit(error == OT_ERROR_NO_BUFS && mTxLength > 0);
+        SuccessOrExit(error = Flush());
+    }
+
+#if OPENTHREAD_POSIX_VIRTUAL_TIME
+    // Each frame is delivered as its own simulation event.
+    SuccessOrExit(error = Flush());
+#endif
+
+exit:
+    return error;
+}
+
+otError HdlcInterface::Flush(void)
+{
+    otError error = OT_ERROR_NONE;
+
+    VerifyOrExit(mTxLength > 0);
+
+    error = Write(mTxBuffer, mTxLength);
+
+    mCounters.mTxFrames += mTxFrames;
+    mTxLength = 0;
+    mTxFrames = 0;
 
 exit:
     return error;
@@ -193,9 +393,21 @@ otError HdlcInterface::Write(const uint8_t *aFrame, uint16_t aLength)
 
         if (rval > 0)
         {
+            mCounters.mTxWrites++;
             aLength -= static_cast<uint16_t>(rval);
             aFrame += static_cast<uint16_t>(rval);
         }
+        else if (rval < 0 && errno == EAGAIN)
+        {
+            // The batch is larger than the socket buffer, wait until the RCP drains it.
+            struct pollfd pollFd = {mSockFd, POLLOUT, 0};
+
+            VerifyOrExit(poll(&pollFd, 1, kMaxWriteWaitTime) > 0, error = OT_ERROR_FAILED);
+        }
+        else if (rval < 0 && errno == EINTR)
+        {
+            continue;
+        }
         else if (rval < 0)
         {
             perror("HdlcInterface::Write");
@@ -440,7 +652,18 @@ exit:
 
 void HdlcInterface::HandleHdlcFrame(void *aContext, uint8_t *aFrame, uint16_t aFrameLength)
 {
-    static_cast<HdlcInterface *>(aContext)->mCallbacks.HandleReceivedFrame(aFrame, aFrameLength);
+    HdlcInterface &hdlcInterface = *static_cast<HdlcInterface *>(aContext);
+
+#if OPENTHREAD_CONFIG_POSIX_APP_ENABLE_RCP_READER_THREAD
+    // Called on the reader thread, the frame is passed to the main thread in `Read()`.
+    if (hdlcInterface.mRxQueue.Push(aFrame, aFrameLength) != OT_ERROR_NONE)
+    {
+        hdlcInterface.mCounters.mRxDropped++;
+    }
+#else
+    hdlcInterface.mCounters.mRxFrames++;
+    hdlcInterface.mCallbacks.HandleReceivedFrame(aFrame, aFrameLength);
+#endif
 }
 
 void HdlcInterface::HandleHdlcError(void *aContext, otError aError, uint8_t *aFrame, uint16_t aFrameLength)
@@ -36,6 +36,11 @@
 
 #include "openthread-core-config.h"
 
+#if OPENTHREAD_CONFIG_POSIX_APP_ENABLE_RCP_READER_THREAD
+#include <pthread.h>
+#endif
+
+#include "frame_queue.hpp"
 #include "hdlc.hpp"
 
 namespace ot {
@@ -53,6 +58,19 @@ public:
         kMaxFrameSize = 2048, ///< Maximum frame size (number of bytes).
     };
 
+    /**
+     * This structure represents the syscall counters of the interface.
+     *
+     */
+    struct Counters
+    {
+        uint32_t mRxReads;   ///< Number of `read()` calls which returned data.
+        uint32_t mRxFrames;  ///< Number of frames decoded.
+        uint32_t mTxWrites;  ///< Number of `write()` calls.
+        uint32_t mTxFrames;  ///< Number of frames sent.
+        uint32_t mRxDropped; ///< Number of frames dropped by the reader thread because its queue was full.
+    };
+
     /**
      * This class defines the callbacks provided by `HdlcInterfac` to its owner/user.
      *
@@ -109,6 +127,21 @@ public:
      */
     int GetSocket(void) const { return mSockFd; }
 
+    /**
+     * This method returns the file descriptor which becomes readable when received frames are available.
+     *
+     * This is the eventfd signaled by the reader thread if `OPENTHREAD_CONFIG_POSIX_APP_ENABLE_RCP_READER_THREAD` is
+     * enabled, otherwise the socket itself.
+     *
+     * @returns The file descriptor to wait on before calling `Read()`.
+     *
+     */
+#if OPENTHREAD_CONFIG_POSIX_APP_ENABLE_RCP_READER_THREAD
+    int GetReadFd(void) const { return mEventFd; }
+#else
+    int GetReadFd(void) const { return mSockFd; }
+#endif
+
     /**
      * This method indicates whether the `HdclInterface` is currently decoding a received frame or not.
      *
@@ -120,25 +153,47 @@ public:
     /**
      * This method instructs `HdlcInterface` to read and decode data from radio over the socket.
      *
-     * If a full HDLC frame is decoded while reading data, this method invokes the `HandleReceivedFrame()` (on the
-     * `aCallback` object from constructor) to pass the received frame to be processed.
+     * The socket is read until it is drained (up to `kMaxReadsPerEvent` reads), so that all frames received since
+     * the last call are decoded. If a full HDLC frame is decoded while reading data, this method invokes the
+     * `HandleReceivedFrame()` (on the `aCallback` object from constructor) to pass the received frame to be processed.
+     *
+     * With the reader thread enabled, this method instead passes all frames already decoded by the thread.
      *
      */
     void Read(void);
 
     /**
-     * This method encodes and sends a frame to Radio Co-processor (RCP) over the socket.
+     * This method encodes and queues a frame to be sent to Radio Co-processor (RCP) over the socket.
+     *
+     * Queued frames are written together by `Flush()`. A full queue is flushed before @p aFrame is added.
      *
      * @param[in] aFrame  A pointer to buffer containing the frame to send.
      * @param[in] aLength The length (number of bytes) in the frame
      *
-     * @retval OT_ERROR_NONE     Successfully encoded and sent the frame.
+     * @retval OT_ERROR_NONE     Successfully encoded and queued the frame.
      * @retval OT_ERROR_NO_BUFS  Insufficient buffer space available to encode the frame.
-     * @retval OT_ERROR_FAILED   Failed to send frame due to socket write failure.
+     * @retval OT_ERROR_FAILED   Failed to flush queued frames due to socket write failure.
      *
      */
     otError SendFrame(const uint8_t *aFrame, uint16_t aLength);
 
+    /**
+     * This method writes all queued frames to the socket.
+     *
+     * @retval OT_ERROR_NONE     Successfully wrote the queued frames (or there were none).
+     * @retval OT_ERROR_FAILED   Failed due to socket write failure.
+     *
+     */
+    otError Flush(void);
+
+    /**
+     * This method returns the syscall counters of the interface.
+     *
+     * @returns A reference to the counters.
+     *
+     */
+    const Counters &GetCounters(void) const { return mCounters; }
+
 #if OPENTHREAD_POSIX_VIRTUAL_TIME
     /**
      * This method process read data (decode the data).
@@ -154,8 +209,24 @@ public:
 #endif
 
 private:
+    enum
+    {
+        kRxBufferSize     = 4 * kMaxFrameSize, ///< Size of the buffer for a single `read()`.
+        kTxBufferSize     = 4 * kMaxFrameSize, ///< Size of the queue of encoded frames.
+        kMaxReadsPerEvent = 4,                 ///< Max number of `read()` calls per `Read()`.
+        kMaxWriteWaitTime = 2000,              ///< Max time to wait for the socket to be writable in milliseconds.
+    };
+
     otError Write(const uint8_t *aFrame, uint16_t aLength);
     void    Decode(const uint8_t *aBuffer, uint16_t aLength);
+    void    ReadSocket(void);
+
+#if OPENTHREAD_CONFIG_POSIX_APP_ENABLE_RCP_READER_THREAD
+    otError     StartReader(void);
+    void        StopReader(void);
+    static void *ReaderThread(void *aContext);
+    void        RunReader(void);
+#endif
 
     static void HandleHdlcFrame(void *aContext, uint8_t *aFrame, uint16_t aFrameLength);
     static void HandleHdlcError(void *aContext, otError aError, uint8_t *aFrame, uint16_t aFrameLength);
@@ -170,6 +241,18 @@ private:
     bool          mIsDecoding;
     Hdlc::Decoder mHdlcDecoder;
     uint8_t       mDecoderBuffer[kMaxFrameSize];
+    uint8_t       mRxBuffer[kRxBufferSize];
+    uint8_t       mTxBuffer[kTxBufferSize];
+    uint16_t      mTxLength;
+    uint16_t      mTxFrames;
+    Counters      mCounters;
+
+#if OPENTHREAD_CONFIG_POSIX_APP_ENABLE_RCP_READER_THREAD
+    pthread_t      mReaderThread;
+    int            mEventFd;               ///< Signaled by the reader thread after queuing frames.
+    SpscFrameQueue mRxQueue;               ///< Frames decoded by the reader thread.
+    uint8_t        mRxFrame[kMaxFrameSize]; ///< The frame being passed to the callback.
+#endif
 };
 
 } // namespace PosixApp
@@ -52,4 +52,51 @@
 #define OPENTHREAD_CONFIG_POSIX_APP_ENABLE_PTY_DEVICE 1
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_POSIX_APP_MAX_EVENT_SOURCES
+ *
+ * The maximum number of file descriptors registered with the POSIX app event loop at a time.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_POSIX_APP_MAX_EVENT_SOURCES
+#define OPENTHREAD_CONFIG_POSIX_APP_MAX_EVENT_SOURCES 32
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_POSIX_APP_MAX_INSTANCES
+ *
+ * The maximum number of OpenThread instances whose alarms are served by one POSIX process.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_POSIX_APP_MAX_INSTANCES
+#if OPENTHREAD_ENABLE_MULTIPLE_INSTANCES
+#define OPENTHREAD_CONFIG_POSIX_APP_MAX_INSTANCES 8
+#else
+#define OPENTHREAD_CONFIG_POSIX_APP_MAX_INSTANCES 1
+#endif
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_POSIX_APP_UDP_BATCH_SIZE
+ *
+ * The maximum number of datagrams received or sent with one system call by the platform UDP driver.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_POSIX_APP_UDP_BATCH_SIZE
+#define OPENTHREAD_CONFIG_POSIX_APP_UDP_BATCH_SIZE 8
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_POSIX_APP_ENABLE_RCP_READER_THREAD
+ *
+ * Define as 1 to read and decode HDLC frames from the RCP in a dedicated thread (Linux only).
+ *
+ * Decoded frames are passed to the main loop through a lock-free queue and an eventfd, so frames keep being drained
+ * from the RCP while the main thread is busy.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_POSIX_APP_ENABLE_RCP_READER_THREAD
+#define OPENTHREAD_CONFIG_POSIX_APP_ENABLE_RCP_READER_THREAD 0
+#endif
+
 #endif // OPENTHREAD_CORE_POSIX_CONFIG_H_
@@ -35,6 +35,9 @@
 #ifndef OPENTHREAD_SYSTEM_H_
 #define OPENTHREAD_SYSTEM_H_
 
+#include <sys/select.h>
+#include <sys/time.h>
+
 #include <openthread/instance.h>
 
 #ifdef __cplusplus
@@ -84,6 +87,51 @@ void otSysProcessDrivers(otInstance *aInstance);
  */
 extern void otSysEventSignalPending(void);
 
+/**
+ * This structure represents the file descriptors and timeout exchanged with an external event loop.
+ *
+ */
+typedef struct otSysMainloopContext
+{
+    fd_set         mReadFdSet;  ///< The read file descriptors.
+    fd_set         mWriteFdSet; ///< The write file descriptors.
+    fd_set         mErrorFdSet; ///< The error file descriptors.
+    int            mMaxFd;      ///< The max file descriptor.
+    struct timeval mTimeout;    ///< The timeout.
+} otSysMainloopContext;
+
+/**
+ * This function adds the file descriptors and the timeout OpenThread's drivers need to an external event loop.
+ *
+ * This function and `otSysMainloopProcess()` allow running OpenThread inside an existing event loop (e.g., one based
+ * on libuv or asio) instead of calling the blocking `otSysProcessDrivers()`. Before waiting, the event loop
+ * initializes @p aMainloop with its own file descriptors (or empty sets and `mMaxFd` of -1) and its own timeout, and
+ * calls this function, which only adds file descriptors, raises `mMaxFd` and lowers `mTimeout`. The timeout is zero
+ * when tasklets are pending, so `otTaskletsProcess()` should be called first.
+ *
+ * @note This function is not available with virtual time simulation.
+ *
+ * @param[in]     aInstance  The OpenThread instance structure.
+ * @param[inout]  aMainloop  A pointer to the mainloop context.
+ *
+ */
+void otSysMainloopUpdate(otInstance *aInstance, otSysMainloopContext *aMainloop);
+
+/**
+ * This function processes the OpenThread drivers once the external event loop returned, without blocking.
+ *
+ * The file descriptor sets of @p aMainloop contain the descriptors the external event loop found ready. Any
+ * descriptors not added by `otSysMainloopUpdate()` are ignored. This function also fires expired OpenThread timers,
+ * so it must be called when the timeout returned by `otSysMainloopUpdate()` expires, even if no descriptor is ready.
+ *
+ * @note This function is not available with virtual time simulation.
+ *
+ * @param[in]  aInstance  The OpenThread instance structure.
+ * @param[in]  aMainloop  A pointer to the mainloop context.
+ *
+ */
+void otSysMainloopProcess(otInstance *aInstance, const otSysMainloopContext *aMainloop);
+
 #ifdef __cplusplus
 } // end of extern "C"
 #endif
@@ -105,6 +105,116 @@ enum
  */
 extern uint64_t gNodeId;
 
+/**
+ * This enumeration defines the I/O events reported by the platform event loop.
+ *
+ */
+enum
+{
+    OT_SYS_EVENT_READ  = 1 << 0, ///< The file descriptor is readable, or has reached end of file.
+    OT_SYS_EVENT_WRITE = 1 << 1, ///< The file descriptor is writable.
+    OT_SYS_EVENT_ERROR = 1 << 2, ///< An error is pending on the file descriptor, always reported.
+};
+
+/**
+ * This function pointer is called by the platform event loop when a registered file descriptor is ready.
+ *
+ * @param[in]  aInstance  The OpenThread instance structure.
+ * @param[in]  aContext   The context passed to `platformEventRegister()`.
+ * @param[in]  aEvents    A bit-mask of the `OT_SYS_EVENT_*` events that are ready.
+ *
+ */
+typedef void (*platformEventHandler)(otInstance *aInstance, void *aContext, uint32_t aEvents);
+
+/**
+ * This function initializes the platform event loop.
+ *
+ */
+void platformEventLoopInit(void);
+
+/**
+ * This function releases the resources of the platform event loop.
+ *
+ */
+void platformEventLoopDeinit(void);
+
+/**
+ * This function registers a file descriptor with the platform event loop.
+ *
+ * The registration persists until `platformEventUnregister()` is called, so drivers do not need to add their file
+ * descriptors on every iteration of the main loop.
+ *
+ * @param[in]  aFd       The file descriptor.
+ * @param[in]  aEvents   A bit-mask of the `OT_SYS_EVENT_*` events of interest.
+ * @param[in]  aHandler  A pointer to the function called when @p aFd is ready.
+ * @param[in]  aContext  A pointer to arbitrary context information passed to @p aHandler.
+ *
+ */
+void platformEventRegister(int aFd, uint32_t aEvents, platformEventHandler aHandler, void *aContext);
+
+/**
+ * This function updates the events of interest of a registered file descriptor.
+ *
+ * The kernel is only updated if @p aEvents differs from the events currently registered.
+ *
+ * @param[in]  aFd      The file descriptor.
+ * @param[in]  aEvents  A bit-mask of the `OT_SYS_EVENT_*` events of interest.
+ *
+ */
+void platformEventUpdate(int aFd, uint32_t aEvents);
+
+/**
+ * This function unregisters a file descriptor from the platform event loop.
+ *
+ * It must be called before @p aFd is closed.
+ *
+ * @param[in]  aFd  The file descriptor.
+ *
+ */
+void platformEventUnregister(int aFd);
+
+/**
+ * This function waits until a registered file descriptor is ready or @p aTimeout expires, and calls the handlers of
+ * the ready file descriptors.
+ *
+ * @param[in]  aInstance  The OpenThread instance structure.
+ * @param[in]  aTimeout   A pointer to the maximum time to wait.
+ *
+ */
+void platformEventLoopWait(otInstance *aInstance, const struct timeval *aTimeout);
+
+/**
+ * This function adds the file descriptors an external event loop needs to watch on behalf of the platform event loop.
+ *
+ * @param[inout]  aReadFdSet   A pointer to the read file descriptors.
+ * @param[inout]  aWriteFdSet  A pointer to the write file descriptors.
+ * @param[inout]  aErrorFdSet  A pointer to the error file descriptors.
+ * @param[inout]  aMaxFd       A pointer to the max file descriptor.
+ * @param[inout]  aTimeout     A pointer to the timeout, cleared if a registered file descriptor is always ready.
+ *
+ */
+void platformEventLoopUpdateFdSet(fd_set *        aReadFdSet,
+                                  fd_set *        aWriteFdSet,
+                                  fd_set *        aErrorFdSet,
+                                  int *           aMaxFd,
+                                  struct timeval *aTimeout);
+
+/**
+ * This function calls the handlers of the registered file descriptors that are ready, without blocking.
+ *
+ * @param[in]  aInstance    The OpenThread instance structure.
+ * @param[in]  aReadFdSet   A pointer to the read file descriptors ready as reported by the external event loop.
+ * @param[in]  aWriteFdSet  A pointer to the write file descriptors ready as reported by the external event loop.
+ * @param[in]  aErrorFdSet  A pointer to the error file descriptors ready as reported by the external event loop.
+ * @param[in]  aMaxFd       The max file descriptor.
+ *
+ */
+void platformEventLoopProcess(otInstance *  aInstance,
+                              const fd_set *aReadFdSet,
+                              const fd_set *aWriteFdSet,
+                              const fd_set *aErrorFdSet,
+                              int           aMaxFd);
+
 /**
  * This function initializes the alarm service used by OpenThread.
  *
@@ -177,25 +287,20 @@ void platformRadioDeinit(void);
 void platformRadioReceive(otInstance *aInstance, uint8_t *aBuf, uint16_t aBufLength);
 
 /**
- * This function updates the file descriptor sets with file descriptors used by the radio driver.
+ * This function updates the events of interest of the radio driver with the platform event loop.
  *
- * @param[inout]  aReadFdSet   A pointer to the read file descriptors.
- * @param[inout]  aWriteFdSet  A pointer to the write file descriptors.
- * @param[inout]  aMaxFd       A pointer to the max file descriptor.
  * @param[inout]  aTimeout     A pointer to the timeout.
  *
  */
-void platformRadioUpdateFdSet(fd_set *aReadFdSet, fd_set *aWriteFdSet, int *aMaxFd, struct timeval *aTimeout);
+void platformRadioUpdate(struct timeval *aTimeout);
 
 /**
- * This function performs radio driver processing.
+ * This function performs radio driver processing that does not depend on I/O readiness.
  *
  * @param[in]   aInstance       A pointer to the OpenThread instance.
- * @param[in]   aReadFdSet      A pointer to the read file descriptors.
- * @param[in]   aWriteFdSet     A pointer to the write file descriptors.
  *
  */
-void platformRadioProcess(otInstance *aInstance, fd_set *aReadFdSet, fd_set *aWriteFdSet);
+void platformRadioProcess(otInstance *aInstance);
 
 /**
  * This function initializes the random number service used by OpenThread.
@@ -211,6 +316,12 @@ void platformRandomInit(void);
  */
 void platformLoggingInit(const char *aName);
 
+/**
+ * This function flushes pending settings writes to disk and closes the settings file.
+ *
+ */
+void platformSettingsDeinit(void);
+
 /**
  * This function updates the file descriptor sets with file descriptors used by the UART driver.
  *
@@ -231,6 +342,12 @@ void platformUartUpdateFdSet(fd_set *aReadFdSet, fd_set *aWriteFdSet, fd_set *aE
  */
 void platformUartProcess(const fd_set *aReadFdSet, const fd_set *aWriteFdSet, const fd_set *aErrorFdSet);
 
+/**
+ * This function updates the events of interest of the UART driver with the platform event loop.
+ *
+ */
+void platformUartUpdate(void);
+
 /**
  * This function restores the Uart.
  *
@@ -358,6 +475,12 @@ void platformUdpProcess(otInstance *aInstance, const fd_set *aReadSet);
  */
 void platformUdpUpdateFdSet(otInstance *aInstance, fd_set *aReadFdSet, int *aMaxFd);
 
+/**
+ * This function sends the datagrams queued by the platform UDP driver.
+ *
+ */
+void platformUdpUpdate(void);
+
 /**
  * This function ends the current process with exit code @p aExitCode if @p aCondition is false.
  *
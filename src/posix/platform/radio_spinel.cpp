@@ -39,6 +39,7 @@
 #include <errno.h>
 #include <stdarg.h>
 #include <stdlib.h>
+#include <string.h>
 #include <sys/resource.h>
 #include <sys/stat.h>
 #include <sys/time.h>
@@ -214,6 +215,8 @@ RadioSpinel::RadioSpinel(void)
     , mRxSensitivity(0)
     , mTxState(kIdle)
     , mState(OT_RADIO_STATE_DISABLED)
+    , mNumSrcMatchShortEntries(0)
+    , mNumSrcMatchExtEntries(0)
     , mIsAckRequested(false)
     , mIsPromiscuous(false)
     , mIsReady(false)
@@ -225,6 +228,7 @@ RadioSpinel::RadioSpinel(void)
 #endif
 {
     mVersion[0] = '\0';
+    memset(mAsyncRequests, 0, sizeof(mAsyncRequests));
 }
 
 void RadioSpinel::Init(const char *aRadioFile, const char *aRadioConfig)
@@ -250,6 +254,16 @@ void RadioSpinel::Init(const char *aRadioFile, const char *aRadioConfig)
     mTxRadioFrame.mPsdu  = mTxPsdu;
     mAckRadioFrame.mPsdu = mAckPsdu;
 
+#if !OPENTHREAD_POSIX_VIRTUAL_TIME
+    platformEventRegister(mHdlcInterface.GetReadFd(), OT_SYS_EVENT_READ, &RadioSpinel::HandleEvent, this);
+
+    if (mHdlcInterface.GetSocket() != mHdlcInterface.GetReadFd())
+    {
+        // Received data is signaled by the HDLC reader thread, the socket is only polled for writing.
+        platformEventRegister(mHdlcInterface.GetSocket(), 0, &RadioSpinel::HandleEvent, this);
+    }
+#endif
+
 exit:
     SuccessOrDie(error);
 }
@@ -320,6 +334,8 @@ exit:
 
 otError RadioSpinel::CheckRadioCapabilities(void)
 {
+    // CSMA-CA, retransmissions and ACK timeouts are always run on the RCP, using the parameters passed with each
+    // frame in `RadioTransmit()`. There is no host fallback, as host scheduling latency must not affect on-air timing.
     const otRadioCaps kRequiredRadioCaps =
         OT_RADIO_CAPS_ACK_TIMEOUT | OT_RADIO_CAPS_TRANSMIT_RETRIES | OT_RADIO_CAPS_CSMA_BACKOFF;
 
@@ -345,18 +361,27 @@ exit:
 
 void RadioSpinel::Deinit(void)
 {
+#if !OPENTHREAD_POSIX_VIRTUAL_TIME
+    if (mHdlcInterface.GetSocket() != mHdlcInterface.GetReadFd())
+    {
+        platformEventUnregister(mHdlcInterface.GetSocket());
+    }
+
+    platformEventUnregister(mHdlcInterface.GetReadFd());
+#endif
     mHdlcInterface.Deinit();
 }
 
 void RadioSpinel::HandleSpinelFrame(const uint8_t *aBuffer, uint16_t aLength)
 {
-    otError        error = OT_ERROR_NONE;
-    uint8_t        header;
-    spinel_ssize_t rval;
+    otError error  = OT_ERROR_NONE;
+    uint8_t header = 0;
+
+    VerifyOrExit(aLength > 0, error = OT_ERROR_PARSE);
 
-    rval = spinel_datatype_unpack(aBuffer, aLength, "C", &header);
+    header = aBuffer[0];
 
-    VerifyOrExit(rval > 0 && (header & SPINEL_HEADER_FLAG) == SPINEL_HEADER_FLAG && SPINEL_HEADER_GET_IID(header) == 0,
+    VerifyOrExit((header & SPINEL_HEADER_FLAG) == SPINEL_HEADER_FLAG && SPINEL_HEADER_GET_IID(header) == 0,
                  error = OT_ERROR_PARSE);
 
     if (SPINEL_HEADER_GET_TID(header) == 0)
@@ -372,18 +397,44 @@ exit:
     LogIfFail("Error handling hdlc frame", error);
 }
 
+otError RadioSpinel::DecodeFrame(const uint8_t *    aBuffer,
+                                 uint16_t           aLength,
+                                 uint8_t &          aHeader,
+                                 unsigned int &     aCommand,
+                                 spinel_prop_key_t &aKey,
+                                 const uint8_t *&   aData,
+                                 uint16_t &         aDataLength)
+{
+    // Equivalent to unpacking with "CiiD" format, using the typed decoder
+    // instead of parsing the format string for every received frame.
+
+    otError                 error = OT_ERROR_NONE;
+    ot::Ncp::SpinelDecoder decoder;
+    unsigned int            key;
+
+    decoder.Init(aBuffer, aLength);
+
+    SuccessOrExit(error = decoder.ReadUint8(aHeader));
+    SuccessOrExit(error = decoder.ReadUintPacked(aCommand));
+    SuccessOrExit(error = decoder.ReadUintPacked(key));
+    SuccessOrExit(error = decoder.ReadData(aData, aDataLength));
+
+    aKey = static_cast<spinel_prop_key_t>(key);
+
+exit:
+    return error;
+}
+
 void RadioSpinel::HandleNotification(const uint8_t *aBuffer, uint16_t aLength)
 {
     spinel_prop_key_t key;
-    spinel_size_t     len = 0;
-    spinel_ssize_t    unpacked;
-    uint8_t *         data = NULL;
-    uint32_t          cmd;
+    uint16_t          len  = 0;
+    const uint8_t *   data = NULL;
+    unsigned int      cmd;
     uint8_t           header;
     otError           error = OT_ERROR_NONE;
 
-    unpacked = spinel_datatype_unpack(aBuffer, aLength, "CiiD", &header, &cmd, &key, &data, &len);
-    VerifyOrExit(unpacked > 0, error = OT_ERROR_PARSE);
+    SuccessOrExit(error = DecodeFrame(aBuffer, aLength, header, cmd, key, data, len));
     VerifyOrExit(SPINEL_HEADER_GET_TID(header) == 0, error = OT_ERROR_PARSE);
 
     switch (cmd)
@@ -400,7 +451,7 @@ void RadioSpinel::HandleNotification(const uint8_t *aBuffer, uint16_t aLength)
             ExitNow();
         }
 
-        HandleValueIs(key, data, static_cast<uint16_t>(len));
+        HandleValueIs(key, data, len);
         break;
 
     case SPINEL_CMD_PROP_VALUE_INSERTED:
@@ -419,26 +470,29 @@ exit:
 void RadioSpinel::HandleResponse(const uint8_t *aBuffer, uint16_t aLength)
 {
     spinel_prop_key_t key;
-    uint8_t *         data   = NULL;
-    spinel_size_t     len    = 0;
+    const uint8_t *   data   = NULL;
+    uint16_t          len    = 0;
     uint8_t           header = 0;
-    uint32_t          cmd    = 0;
-    spinel_ssize_t    rval   = 0;
+    unsigned int      cmd    = 0;
     otError           error  = OT_ERROR_NONE;
+    AsyncRequest *    request;
 
-    rval = spinel_datatype_unpack(aBuffer, aLength, "CiiD", &header, &cmd, &key, &data, &len);
-    VerifyOrExit(rval > 0 && cmd >= SPINEL_CMD_PROP_VALUE_IS && cmd <= SPINEL_CMD_PROP_VALUE_REMOVED,
-                 error = OT_ERROR_PARSE);
+    SuccessOrExit(error = DecodeFrame(aBuffer, aLength, header, cmd, key, data, len));
+    VerifyOrExit(cmd >= SPINEL_CMD_PROP_VALUE_IS && cmd <= SPINEL_CMD_PROP_VALUE_REMOVED, error = OT_ERROR_PARSE);
 
     if (mWaitingTid == SPINEL_HEADER_GET_TID(header))
     {
-        HandleWaitingResponse(cmd, key, data, static_cast<uint16_t>(len));
+        HandleWaitingResponse(cmd, key, data, len);
         FreeTid(mWaitingTid);
         mWaitingTid = 0;
     }
+    else if ((request = FindAsyncRequest(SPINEL_HEADER_GET_TID(header))) != NULL)
+    {
+        HandleAsyncResponse(*request, cmd, key, data, len);
+    }
     else if (mTxRadioTid == SPINEL_HEADER_GET_TID(header))
     {
-        HandleTransmitDone(cmd, key, data, static_cast<uint16_t>(len));
+        HandleTransmitDone(cmd, key, data, len);
         FreeTid(mTxRadioTid);
         mTxRadioTid = 0;
     }
@@ -507,6 +561,31 @@ exit:
     LogIfFail("Error processing result", mError);
 }
 
+void RadioSpinel::HandleAsyncResponse(AsyncRequest &    aRequest,
+                                      uint32_t          aCommand,
+                                      spinel_prop_key_t aKey,
+                                      const uint8_t *   aBuffer,
+                                      uint16_t          aLength)
+{
+    otError error = OT_ERROR_NONE;
+
+    if (aKey == SPINEL_PROP_LAST_STATUS)
+    {
+        spinel_status_t status;
+        spinel_ssize_t  unpacked = spinel_datatype_unpack(aBuffer, aLength, SPINEL_DATATYPE_UINT_PACKED_S, &status);
+
+        VerifyOrExit(unpacked > 0, error = OT_ERROR_PARSE);
+        error = SpinelStatusToOtError(status);
+    }
+    else if (aKey != aRequest.mKey || aCommand != aRequest.mExpectedCommand)
+    {
+        error = OT_ERROR_DROP;
+    }
+
+exit:
+    FinishAsyncRequest(aRequest, error);
+}
+
 void RadioSpinel::HandleValueIs(spinel_prop_key_t aKey, const uint8_t *aBuffer, uint16_t aLength)
 {
     otError error = OT_ERROR_NONE;
@@ -608,27 +687,29 @@ exit:
 
 otError RadioSpinel::ParseRadioFrame(otRadioFrame &aFrame, const uint8_t *aBuffer, uint16_t aLength)
 {
-    otError        error        = OT_ERROR_NONE;
-    uint16_t       packetLength = 0;
-    spinel_ssize_t unpacked;
-    uint16_t       flags      = 0;
-    int8_t         noiseFloor = -128;
-    spinel_size_t  size       = OT_RADIO_FRAME_MAX_SIZE;
+    otError                error        = OT_ERROR_NONE;
+    const uint8_t *        psdu         = NULL;
+    uint16_t               packetLength = 0;
+    uint16_t               flags        = 0;
+    int8_t                 noiseFloor   = -128;
+    ot::Ncp::SpinelDecoder decoder;
 
-    unpacked = spinel_datatype_unpack(aBuffer, aLength, SPINEL_DATATYPE_UINT16_S, &packetLength);
-    VerifyOrExit(unpacked > 0 && packetLength <= OT_RADIO_FRAME_MAX_SIZE, error = OT_ERROR_PARSE);
+    decoder.Init(aBuffer, aLength);
+
+    SuccessOrExit(error = decoder.ReadDataWithLen(psdu, packetLength));
+    VerifyOrExit(packetLength <= OT_RADIO_FRAME_MAX_SIZE, error = OT_ERROR_PARSE);
 
     aFrame.mLength = static_cast<uint8_t>(packetLength);
+    memcpy(aFrame.mPsdu, psdu, packetLength);
 
-    unpacked = spinel_datatype_unpack_in_place(aBuffer, aLength,
-                                               SPINEL_DATATYPE_DATA_WLEN_S SPINEL_DATATYPE_INT8_S SPINEL_DATATYPE_INT8_S
-                                                   SPINEL_DATATYPE_UINT16_S SPINEL_DATATYPE_STRUCT_S( // PHY-data
-                                                       SPINEL_DATATYPE_UINT8_S     // 802.15.4 channel
-                                                           SPINEL_DATATYPE_UINT8_S // 802.15.4 LQI
-                                                       ),
-                                               aFrame.mPsdu, &size, &aFrame.mInfo.mRxInfo.mRssi, &noiseFloor, &flags,
-                                               &aFrame.mChannel, &aFrame.mInfo.mRxInfo.mLqi);
-    VerifyOrExit(unpacked > 0, error = OT_ERROR_PARSE);
+    SuccessOrExit(error = decoder.ReadInt8(aFrame.mInfo.mRxInfo.mRssi));
+    SuccessOrExit(error = decoder.ReadInt8(noiseFloor));
+    SuccessOrExit(error = decoder.ReadUint16(flags));
+
+    SuccessOrExit(error = decoder.OpenStruct());                         // PHY-data
+    SuccessOrExit(error = decoder.ReadUint8(aFrame.mChannel));           // 802.15.4 channel
+    SuccessOrExit(error = decoder.ReadUint8(aFrame.mInfo.mRxInfo.mLqi)); // 802.15.4 LQI
+    SuccessOrExit(error = decoder.CloseStruct());
 
 exit:
     LogIfFail("Handle radio frame failed", error);
@@ -666,28 +747,33 @@ exit:
     return;
 }
 
-void RadioSpinel::UpdateFdSet(fd_set &aReadFdSet, fd_set &aWriteFdSet, int &aMaxFd, struct timeval &aTimeout)
+#if !OPENTHREAD_POSIX_VIRTUAL_TIME
+void RadioSpinel::Update(struct timeval &aTimeout)
 {
-    int sockFd = mHdlcInterface.GetSocket();
+    uint32_t readEvents  = 0;
+    uint32_t writeEvents = 0;
+
+    // Write the frames queued since the last iteration (e.g. by asynchronous requests) in one go.
+    SuccessOrDie(mHdlcInterface.Flush());
 
     if ((mState != OT_RADIO_STATE_TRANSMIT || mTxState == kSent))
     {
-        FD_SET(sockFd, &aReadFdSet);
-
-        if (aMaxFd < sockFd)
-        {
-            aMaxFd = sockFd;
-        }
+        readEvents = OT_SYS_EVENT_READ;
     }
 
     if (mState == OT_RADIO_STATE_TRANSMIT && mTxState == kIdle)
     {
-        FD_SET(sockFd, &aWriteFdSet);
+        writeEvents = OT_SYS_EVENT_WRITE;
+    }
 
-        if (aMaxFd < sockFd)
-        {
-            aMaxFd = sockFd;
-        }
+    if (mHdlcInterface.GetSocket() == mHdlcInterface.GetReadFd())
+    {
+        platformEventUpdate(mHdlcInterface.GetSocket(), readEvents | writeEvents);
+    }
+    else
+    {
+        platformEventUpdate(mHdlcInterface.GetReadFd(), readEvents);
+        platformEventUpdate(mHdlcInterface.GetSocket(), writeEvents);
     }
 
     if (!mFrameQueue.IsEmpty() || (mState == OT_RADIO_STATE_TRANSMIT && mTxState == kDone))
@@ -695,25 +781,55 @@ void RadioSpinel::UpdateFdSet(fd_set &aReadFdSet, fd_set &aWriteFdSet, int &aMax
         aTimeout.tv_sec  = 0;
         aTimeout.tv_usec = 0;
     }
+
+    UpdateAsyncTimeout(aTimeout);
+}
+
+void RadioSpinel::HandleEvent(otInstance *aInstance, void *aContext, uint32_t aEvents)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+
+    static_cast<RadioSpinel *>(aContext)->HandleEvent(aEvents);
 }
 
-void RadioSpinel::Process(const fd_set &aReadFdSet, const fd_set &aWriteFdSet)
+void RadioSpinel::HandleEvent(uint32_t aEvents)
 {
-    if (FD_ISSET(mHdlcInterface.GetSocket(), &aReadFdSet) || !mFrameQueue.IsEmpty())
+    if (aEvents & OT_SYS_EVENT_ERROR)
+    {
+        fprintf(stderr, "NCP error\r\n");
+        exit(OT_EXIT_FAILURE);
+    }
+
+    if (aEvents & OT_SYS_EVENT_READ)
     {
         // Handle frames received during WaitResponse()
         ProcessFrameQueue();
+        mHdlcInterface.Read();
+        ProcessFrameQueue();
+    }
 
-        if (FD_ISSET(mHdlcInterface.GetSocket(), &aReadFdSet))
-        {
-            mHdlcInterface.Read();
-            ProcessFrameQueue();
-        }
+    if ((aEvents & OT_SYS_EVENT_WRITE) && mState == OT_RADIO_STATE_TRANSMIT && mTxState == kIdle)
+    {
+        RadioTransmit();
+    }
+}
+
+void RadioSpinel::Process(void)
+{
+    ProcessAsyncRequests();
+
+    if (!mFrameQueue.IsEmpty())
+    {
+        // Handle frames received during WaitResponse()
+        ProcessFrameQueue();
     }
 
     if (mState == OT_RADIO_STATE_TRANSMIT && mTxState == kDone)
     {
-        mState = OT_RADIO_STATE_RECEIVE;
+        // The state is updated first since the next frame may be
+        // transmitted from within the callback.
+        mState   = OT_RADIO_STATE_RECEIVE;
+        mTxState = kIdle;
 
 #if OPENTHREAD_ENABLE_DIAG
         if (otPlatDiagModeGet())
@@ -725,18 +841,12 @@ void RadioSpinel::Process(const fd_set &aReadFdSet, const fd_set &aWriteFdSet)
         {
             otPlatRadioTxDone(mInstance, mTransmitFrame, (mIsAckRequested ? &mAckRadioFrame : NULL), mTxError);
         }
-
-        mTxState = kIdle;
     }
 
-    if (FD_ISSET(mHdlcInterface.GetSocket(), &aWriteFdSet))
-    {
-        if (mState == OT_RADIO_STATE_TRANSMIT && mTxState == kIdle)
-        {
-            RadioTransmit();
-        }
-    }
+    // Send the radio frame queued by `RadioTransmit()` without waiting for the next iteration.
+    SuccessOrDie(mHdlcInterface.Flush());
 }
+#endif // !OPENTHREAD_POSIX_VIRTUAL_TIME
 
 otError RadioSpinel::SetPromiscuous(bool aEnable)
 {
@@ -754,7 +864,8 @@ otError RadioSpinel::SetShortAddress(uint16_t aAddress)
 {
     otError error;
 
-    SuccessOrExit(error = sRadioSpinel.Set(SPINEL_PROP_MAC_15_4_SADDR, SPINEL_DATATYPE_UINT16_S, aAddress));
+    SuccessOrExit(error = SetAsync(HandleRequiredSetDone, this, SPINEL_PROP_MAC_15_4_SADDR, SPINEL_DATATYPE_UINT16_S,
+                                   aAddress));
     mShortAddress = aAddress;
 
 exit:
@@ -770,7 +881,8 @@ otError RadioSpinel::SetExtendedAddress(const otExtAddress &aExtAddress)
 {
     otError error;
 
-    SuccessOrExit(error = Set(SPINEL_PROP_MAC_15_4_LADDR, SPINEL_DATATYPE_EUI64_S, aExtAddress.m8));
+    SuccessOrExit(error = SetAsync(HandleRequiredSetDone, this, SPINEL_PROP_MAC_15_4_LADDR, SPINEL_DATATYPE_EUI64_S,
+                                   aExtAddress.m8));
     mExtendedAddress = aExtAddress;
 
 exit:
@@ -780,7 +892,8 @@ exit:
 otError RadioSpinel::SetPanId(uint16_t aPanId)
 {
     otError error;
-    SuccessOrExit(error = Set(SPINEL_PROP_MAC_15_4_PANID, SPINEL_DATATYPE_UINT16_S, aPanId));
+    SuccessOrExit(error = SetAsync(HandleRequiredSetDone, this, SPINEL_PROP_MAC_15_4_PANID, SPINEL_DATATYPE_UINT16_S,
+                                   aPanId));
     mPanid = aPanId;
 
 exit:
@@ -789,37 +902,199 @@ exit:
 
 otError RadioSpinel::EnableSrcMatch(bool aEnable)
 {
-    return Set(SPINEL_PROP_MAC_SRC_MATCH_ENABLED, SPINEL_DATATYPE_BOOL_S, aEnable);
+    return SetAsync(HandleRequiredSetDone, this, SPINEL_PROP_MAC_SRC_MATCH_ENABLED, SPINEL_DATATYPE_BOOL_S, aEnable);
 }
 
 otError RadioSpinel::AddSrcMatchShortEntry(const uint16_t aShortAddress)
 {
-    return Insert(SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES, SPINEL_DATATYPE_UINT16_S, aShortAddress);
+    otError error = OT_ERROR_NONE;
+
+    VerifyOrExit(mNumSrcMatchShortEntries < kMaxSrcMatchEntries, error = OT_ERROR_NO_BUFS);
+
+    SuccessOrExit(error = InsertAsync(NULL, NULL, SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES, SPINEL_DATATYPE_UINT16_S,
+                                      aShortAddress));
+    mSrcMatchShortEntries[mNumSrcMatchShortEntries++] = aShortAddress;
+
+exit:
+    return error;
 }
 
 otError RadioSpinel::AddSrcMatchExtEntry(const otExtAddress &aExtAddress)
 {
-    return Insert(SPINEL_PROP_MAC_SRC_MATCH_EXTENDED_ADDRESSES, SPINEL_DATATYPE_EUI64_S, aExtAddress.m8);
+    otError error = OT_ERROR_NONE;
+
+    VerifyOrExit(mNumSrcMatchExtEntries < kMaxSrcMatchEntries, error = OT_ERROR_NO_BUFS);
+
+    SuccessOrExit(error = InsertAsync(NULL, NULL, SPINEL_PROP_MAC_SRC_MATCH_EXTENDED_ADDRESSES,
+                                      SPINEL_DATATYPE_EUI64_S, aExtAddress.m8));
+    mSrcMatchExtEntries[mNumSrcMatchExtEntries++] = aExtAddress;
+
+exit:
+    return error;
 }
 
 otError RadioSpinel::ClearSrcMatchShortEntry(const uint16_t aShortAddress)
 {
-    return Remove(SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES, SPINEL_DATATYPE_UINT16_S, aShortAddress);
+    otError error = OT_ERROR_NONE;
+
+    SuccessOrExit(error = RemoveAsync(NULL, NULL, SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES, SPINEL_DATATYPE_UINT16_S,
+                                      aShortAddress));
+    RemoveSrcMatchShortEntry(aShortAddress);
+
+exit:
+    return error;
 }
 
 otError RadioSpinel::ClearSrcMatchExtEntry(const otExtAddress &aExtAddress)
 {
-    return Remove(SPINEL_PROP_MAC_SRC_MATCH_EXTENDED_ADDRESSES, SPINEL_DATATYPE_EUI64_S, aExtAddress.m8);
+    otError error = OT_ERROR_NONE;
+
+    SuccessOrExit(error = RemoveAsync(NULL, NULL, SPINEL_PROP_MAC_SRC_MATCH_EXTENDED_ADDRESSES,
+                                      SPINEL_DATATYPE_EUI64_S, aExtAddress.m8));
+
+    RemoveSrcMatchExtEntry(aExtAddress);
+
+exit:
+    return error;
 }
 
 otError RadioSpinel::ClearSrcMatchShortEntries(void)
 {
-    return Set(SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES, NULL);
+    mNumSrcMatchShortEntries = 0;
+    return SetAsync(HandleRequiredSetDone, this, SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES, NULL);
 }
 
 otError RadioSpinel::ClearSrcMatchExtEntries(void)
 {
-    return Set(SPINEL_PROP_MAC_SRC_MATCH_EXTENDED_ADDRESSES, NULL);
+    mNumSrcMatchExtEntries = 0;
+    return SetAsync(HandleRequiredSetDone, this, SPINEL_PROP_MAC_SRC_MATCH_EXTENDED_ADDRESSES, NULL);
+}
+
+otError RadioSpinel::UpdateSrcMatchShortEntries(const uint16_t *aAddList,
+                                                uint8_t         aNumAdd,
+                                                const uint16_t *aClearList,
+                                                uint8_t         aNumClear)
+{
+    otError error = OT_ERROR_NONE;
+
+    for (uint8_t i = 0; i < aNumClear; i++)
+    {
+        RemoveSrcMatchShortEntry(aClearList[i]);
+    }
+
+    if (mNumSrcMatchShortEntries + aNumAdd > kMaxSrcMatchEntries)
+    {
+        error   = OT_ERROR_NO_BUFS;
+        aNumAdd = 0;
+    }
+
+    for (uint8_t i = 0; i < aNumAdd; i++)
+    {
+        mSrcMatchShortEntries[mNumSrcMatchShortEntries++] = aAddList[i];
+    }
+
+    if (aNumAdd > 0 || aNumClear > 0)
+    {
+        otError sendError = SendSrcMatchShortEntries();
+
+        if (error == OT_ERROR_NONE)
+        {
+            error = sendError;
+        }
+    }
+
+    return error;
+}
+
+otError RadioSpinel::UpdateSrcMatchExtEntries(const otExtAddress *aAddList,
+                                              uint8_t             aNumAdd,
+                                              const otExtAddress *aClearList,
+                                              uint8_t             aNumClear)
+{
+    otError      error = OT_ERROR_NONE;
+    otExtAddress addr;
+
+    for (uint8_t i = 0; i < aNumClear; i++)
+    {
+        ReverseExtAddress(aClearList[i], addr);
+        RemoveSrcMatchExtEntry(addr);
+    }
+
+    if (mNumSrcMatchExtEntries + aNumAdd > kMaxSrcMatchEntries)
+    {
+        error   = OT_ERROR_NO_BUFS;
+        aNumAdd = 0;
+    }
+
+    for (uint8_t i = 0; i < aNumAdd; i++)
+    {
+        ReverseExtAddress(aAddList[i], mSrcMatchExtEntries[mNumSrcMatchExtEntries++]);
+    }
+
+    if (aNumAdd > 0 || aNumClear > 0)
+    {
+        otError sendError = SendSrcMatchExtEntries();
+
+        if (error == OT_ERROR_NONE)
+        {
+            error = sendError;
+        }
+    }
+
+    return error;
+}
+
+otError RadioSpinel::SendSrcMatchShortEntries(void)
+{
+    uint8_t buffer[kMaxSrcMatchEntries * sizeof(uint16_t)];
+
+    for (uint8_t i = 0; i < mNumSrcMatchShortEntries; i++)
+    {
+        Encoding::LittleEndian::WriteUint16(mSrcMatchShortEntries[i], &buffer[i * sizeof(uint16_t)]);
+    }
+
+    // Setting the property replaces the whole table on the transceiver, in one spinel transaction.
+    return SetAsync(NULL, NULL, SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES, SPINEL_DATATYPE_DATA_S, buffer,
+                    static_cast<spinel_size_t>(mNumSrcMatchShortEntries * sizeof(uint16_t)));
+}
+
+otError RadioSpinel::SendSrcMatchExtEntries(void)
+{
+    return SetAsync(NULL, NULL, SPINEL_PROP_MAC_SRC_MATCH_EXTENDED_ADDRESSES, SPINEL_DATATYPE_DATA_S,
+                    mSrcMatchExtEntries[0].m8,
+                    static_cast<spinel_size_t>(mNumSrcMatchExtEntries * sizeof(otExtAddress)));
+}
+
+void RadioSpinel::RemoveSrcMatchShortEntry(uint16_t aShortAddress)
+{
+    for (uint8_t i = 0; i < mNumSrcMatchShortEntries; i++)
+    {
+        if (mSrcMatchShortEntries[i] == aShortAddress)
+        {
+            mSrcMatchShortEntries[i] = mSrcMatchShortEntries[--mNumSrcMatchShortEntries];
+            break;
+        }
+    }
+}
+
+void RadioSpinel::RemoveSrcMatchExtEntry(const otExtAddress &aExtAddress)
+{
+    for (uint8_t i = 0; i < mNumSrcMatchExtEntries; i++)
+    {
+        if (memcmp(&mSrcMatchExtEntries[i], &aExtAddress, sizeof(aExtAddress)) == 0)
+        {
+            mSrcMatchExtEntries[i] = mSrcMatchExtEntries[--mNumSrcMatchExtEntries];
+            break;
+        }
+    }
+}
+
+void RadioSpinel::ReverseExtAddress(const otExtAddress &aAddress, otExtAddress &aReversed)
+{
+    for (size_t i = 0; i < sizeof(aReversed); i++)
+    {
+        aReversed.m8[i] = aAddress.m8[sizeof(aAddress) - 1 - i];
+    }
 }
 
 otError RadioSpinel::GetTransmitPower(int8_t &aPower)
@@ -920,12 +1195,225 @@ otError RadioSpinel::Remove(spinel_prop_key_t aKey, const char *aFormat, ...)
     return error;
 }
 
+otError RadioSpinel::SetAsync(AsyncResponseHandler aHandler,
+                              void *               aContext,
+                              spinel_prop_key_t    aKey,
+                              const char *         aFormat,
+                              ...)
+{
+    otError error;
+    va_list args;
+
+    va_start(args, aFormat);
+    error = RequestAsyncV(aHandler, aContext, SPINEL_CMD_PROP_VALUE_SET, SPINEL_CMD_PROP_VALUE_IS, aKey, aFormat, args);
+    va_end(args);
+
+    return error;
+}
+
+otError RadioSpinel::InsertAsync(AsyncResponseHandler aHandler,
+                                 void *               aContext,
+                                 spinel_prop_key_t    aKey,
+                                 const char *         aFormat,
+                                 ...)
+{
+    otError error;
+    va_list args;
+
+    va_start(args, aFormat);
+    error = RequestAsyncV(aHandler, aContext, SPINEL_CMD_PROP_VALUE_INSERT, SPINEL_CMD_PROP_VALUE_INSERTED, aKey,
+                          aFormat, args);
+    va_end(args);
+
+    return error;
+}
+
+otError RadioSpinel::RemoveAsync(AsyncResponseHandler aHandler,
+                                 void *               aContext,
+                                 spinel_prop_key_t    aKey,
+                                 const char *         aFormat,
+                                 ...)
+{
+    otError error;
+    va_list args;
+
+    va_start(args, aFormat);
+    error = RequestAsyncV(aHandler, aContext, SPINEL_CMD_PROP_VALUE_REMOVE, SPINEL_CMD_PROP_VALUE_REMOVED, aKey,
+                          aFormat, args);
+    va_end(args);
+
+    return error;
+}
+
+otError RadioSpinel::RequestAsyncV(AsyncResponseHandler aHandler,
+                                   void *               aContext,
+                                   uint32_t             aCommand,
+                                   uint32_t             aExpectedCommand,
+                                   spinel_prop_key_t    aKey,
+                                   const char *         aFormat,
+                                   va_list              aArgs)
+{
+    otError        error   = OT_ERROR_NONE;
+    AsyncRequest * request = FindAsyncRequest(0);
+    spinel_tid_t   tid;
+    struct timeval timeout = {kMaxWaitTime / 1000, (kMaxWaitTime % 1000) * 1000};
+    struct timeval now;
+
+    if (request == NULL)
+    {
+        // All asynchronous transactions are outstanding, so wait for the transceiver to catch up. Responses are
+        // processed in order, so this also completes the earlier requests.
+        assert(mWaitingTid == 0);
+
+        mExpectedCommand = aExpectedCommand;
+        error            = RequestV(true, aCommand, aKey, aFormat, aArgs);
+        mExpectedCommand = SPINEL_CMD_NOOP;
+
+        if (error == OT_ERROR_NONE && aHandler != NULL)
+        {
+            aHandler(aContext, aKey, error);
+        }
+
+        ExitNow();
+    }
+
+    tid = GetNextTid();
+    VerifyOrExit(tid > 0, error = OT_ERROR_BUSY);
+
+    error = SendCommand(aCommand, aKey, tid, aFormat, aArgs);
+
+    if (error != OT_ERROR_NONE)
+    {
+        FreeTid(tid);
+        ExitNow();
+    }
+
+    otSysGetTime(&now);
+    timeradd(&now, &timeout, &request->mDeadline);
+
+    request->mTid             = tid;
+    request->mKey             = aKey;
+    request->mExpectedCommand = aExpectedCommand;
+    request->mHandler         = aHandler;
+    request->mContext         = aContext;
+
+exit:
+    LogIfFail("Error sending asynchronous request", error);
+    return error;
+}
+
+RadioSpinel::AsyncRequest *RadioSpinel::FindAsyncRequest(spinel_tid_t aTid)
+{
+    AsyncRequest *request = NULL;
+
+    for (uint8_t i = 0; i < kMaxAsyncRequests; i++)
+    {
+        if (mAsyncRequests[i].mTid == aTid)
+        {
+            ExitNow(request = &mAsyncRequests[i]);
+        }
+    }
+
+exit:
+    return request;
+}
+
+void RadioSpinel::FinishAsyncRequest(AsyncRequest &aRequest, otError aError)
+{
+    AsyncResponseHandler handler = aRequest.mHandler;
+    void *               context = aRequest.mContext;
+    spinel_prop_key_t    key     = aRequest.mKey;
+
+    // Release the entry before calling the handler, which may issue a new request.
+    FreeTid(aRequest.mTid);
+    aRequest.mTid = 0;
+
+    if (handler != NULL)
+    {
+        handler(context, key, aError);
+    }
+    else if (aError != OT_ERROR_NONE)
+    {
+        otLogWarnPlat("Asynchronous request %s failed: %s", spinel_prop_key_to_cstr(key),
+                      otThreadErrorToString(aError));
+    }
+}
+
+void RadioSpinel::ProcessAsyncRequests(void)
+{
+    struct timeval now;
+
+    otSysGetTime(&now);
+
+    for (uint8_t i = 0; i < kMaxAsyncRequests; i++)
+    {
+        AsyncRequest &request = mAsyncRequests[i];
+
+        if (request.mTid != 0 && !timercmp(&request.mDeadline, &now, >))
+        {
+            FinishAsyncRequest(request, OT_ERROR_RESPONSE_TIMEOUT);
+        }
+    }
+}
+
+void RadioSpinel::UpdateAsyncTimeout(struct timeval &aTimeout)
+{
+    struct timeval now;
+    struct timeval remain;
+
+    otSysGetTime(&now);
+
+    for (uint8_t i = 0; i < kMaxAsyncRequests; i++)
+    {
+        const AsyncRequest &request = mAsyncRequests[i];
+
+        if (request.mTid == 0)
+        {
+            continue;
+        }
+
+        if (timercmp(&request.mDeadline, &now, >))
+        {
+            timersub(&request.mDeadline, &now, &remain);
+        }
+        else
+        {
+            timerclear(&remain);
+        }
+
+        if (timercmp(&remain, &aTimeout, <))
+        {
+            aTimeout = remain;
+        }
+    }
+}
+
+void RadioSpinel::HandleRequiredSetDone(void *aContext, spinel_prop_key_t aKey, otError aError)
+{
+    OT_UNUSED_VARIABLE(aContext);
+    OT_UNUSED_VARIABLE(aKey);
+
+    if (aError != OT_ERROR_NONE)
+    {
+        otLogCritPlat("Failed to set %s: %s", spinel_prop_key_to_cstr(aKey), otThreadErrorToString(aError));
+    }
+
+    SuccessOrDie(aError);
+}
+
 otError RadioSpinel::WaitResponse(void)
 {
     struct timeval end;
     struct timeval now;
     struct timeval timeout = {kMaxWaitTime / 1000, (kMaxWaitTime % 1000) * 1000};
 
+    if ((mError = mHdlcInterface.Flush()) != OT_ERROR_NONE)
+    {
+        FreeTid(mWaitingTid);
+        mWaitingTid = 0;
+        ExitNow();
+    }
+
     otSysGetTime(&now);
     timeradd(&now, &timeout, &end);
 
@@ -954,25 +1442,25 @@ otError RadioSpinel::WaitResponse(void)
             break;
         }
 #else  // OPENTHREAD_POSIX_VIRTUAL_TIME
-        int    sockFd = mHdlcInterface.GetSocket();
+        int    readFd = mHdlcInterface.GetReadFd();
         fd_set read_fds;
         fd_set error_fds;
         int    rval;
 
         FD_ZERO(&read_fds);
         FD_ZERO(&error_fds);
-        FD_SET(sockFd, &read_fds);
-        FD_SET(sockFd, &error_fds);
+        FD_SET(readFd, &read_fds);
+        FD_SET(readFd, &error_fds);
 
-        rval = select(sockFd + 1, &read_fds, NULL, &error_fds, &timeout);
+        rval = select(readFd + 1, &read_fds, NULL, &error_fds, &timeout);
 
         if (rval > 0)
         {
-            if (FD_ISSET(sockFd, &read_fds))
+            if (FD_ISSET(readFd, &read_fds))
             {
                 mHdlcInterface.Read();
             }
-            else if (FD_ISSET(sockFd, &error_fds))
+            else if (FD_ISSET(readFd, &error_fds))
             {
                 fprintf(stderr, "NCP error\r\n");
                 exit(OT_EXIT_FAILURE);
@@ -1034,6 +1522,9 @@ spinel_tid_t RadioSpinel::GetNextTid(void)
  *
  * otPlatRadioTxStarted() is triggered immediately for now, which may be earlier than real started time.
  *
+ * If the frame cannot be sent, the failure is reported through otPlatRadioTxDone() from `Process()`, never from
+ * within this method.
+ *
  */
 void RadioSpinel::RadioTransmit(void)
 {
@@ -1046,8 +1537,11 @@ void RadioSpinel::RadioTransmit(void)
     mIsAckRequested = isAckRequested(mTransmitFrame->mPsdu) && !mIsPromiscuous;
 
     error = Request(true, SPINEL_CMD_PROP_VALUE_SET, SPINEL_PROP_STREAM_RAW,
-                    SPINEL_DATATYPE_DATA_WLEN_S SPINEL_DATATYPE_UINT8_S SPINEL_DATATYPE_INT8_S, mTransmitFrame->mPsdu,
-                    mTransmitFrame->mLength, mTransmitFrame->mChannel, mTransmitFrame->mInfo.mRxInfo.mRssi);
+                    SPINEL_DATATYPE_DATA_WLEN_S SPINEL_DATATYPE_UINT8_S SPINEL_DATATYPE_UINT8_S SPINEL_DATATYPE_UINT8_S
+                        SPINEL_DATATYPE_BOOL_S,
+                    mTransmitFrame->mPsdu, mTransmitFrame->mLength, mTransmitFrame->mChannel,
+                    mTransmitFrame->mInfo.mTxInfo.mMaxCsmaBackoffs, mTransmitFrame->mInfo.mTxInfo.mMaxFrameRetries,
+                    mTransmitFrame->mInfo.mTxInfo.mCsmaCaEnabled);
 
     if (error == OT_ERROR_NONE)
     {
@@ -1055,21 +1549,9 @@ void RadioSpinel::RadioTransmit(void)
     }
     else
     {
-        mState = OT_RADIO_STATE_RECEIVE;
-
-#if OPENTHREAD_ENABLE_DIAG
-
-        if (otPlatDiagModeGet())
-        {
-            otPlatDiagRadioTransmitDone(mInstance, mTransmitFrame, error);
-        }
-        else
-#endif
-        {
-            otPlatRadioTxDone(mInstance, mTransmitFrame, NULL, error);
-        }
-
-        mTxState = kIdle;
+        mIsAckRequested = false;
+        mTxState        = kDone;
+        mTxError        = error;
     }
 }
 
@@ -1218,6 +1700,10 @@ otError RadioSpinel::Transmit(otRadioFrame &aFrame)
     error          = OT_ERROR_NONE;
     mTransmitFrame = &aFrame;
 
+    // Hand the frame to the RCP right away instead of waiting for the
+    // next main loop iteration, which shortens the gap between frames.
+    RadioTransmit();
+
 exit:
     return error;
 }
@@ -1451,16 +1937,18 @@ bool otPlatRadioGetPromiscuous(otInstance *aInstance)
     return sRadioSpinel.IsPromiscuous();
 }
 
-void platformRadioUpdateFdSet(fd_set *aReadFdSet, fd_set *aWriteFdSet, int *aMaxFd, struct timeval *aTimeout)
+#if !OPENTHREAD_POSIX_VIRTUAL_TIME
+void platformRadioUpdate(struct timeval *aTimeout)
 {
-    sRadioSpinel.UpdateFdSet(*aReadFdSet, *aWriteFdSet, *aMaxFd, *aTimeout);
+    sRadioSpinel.Update(*aTimeout);
 }
 
-void platformRadioProcess(otInstance *aInstance, fd_set *aReadFdSet, fd_set *aWriteFdSet)
+void platformRadioProcess(otInstance *aInstance)
 {
-    sRadioSpinel.Process(*aReadFdSet, *aWriteFdSet);
+    sRadioSpinel.Process();
     OT_UNUSED_VARIABLE(aInstance);
 }
+#endif
 
 void otPlatRadioEnableSrcMatch(otInstance *aInstance, bool aEnable)
 {
@@ -1518,6 +2006,26 @@ void otPlatRadioClearSrcMatchExtEntries(otInstance *aInstance)
     OT_UNUSED_VARIABLE(aInstance);
 }
 
+otError otPlatRadioUpdateSrcMatchShortEntries(otInstance *          aInstance,
+                                              const otShortAddress *aAddList,
+                                              uint8_t               aNumAdd,
+                                              const otShortAddress *aClearList,
+                                              uint8_t               aNumClear)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+    return sRadioSpinel.UpdateSrcMatchShortEntries(aAddList, aNumAdd, aClearList, aNumClear);
+}
+
+otError otPlatRadioUpdateSrcMatchExtEntries(otInstance *        aInstance,
+                                            const otExtAddress *aAddList,
+                                            uint8_t             aNumAdd,
+                                            const otExtAddress *aClearList,
+                                            uint8_t             aNumClear)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+    return sRadioSpinel.UpdateSrcMatchExtEntries(aAddList, aNumAdd, aClearList, aNumClear);
+}
+
 otError otPlatRadioEnergyScan(otInstance *aInstance, uint8_t aScanChannel, uint16_t aScanDuration)
 {
     OT_UNUSED_VARIABLE(aInstance);
@@ -1560,7 +2068,10 @@ void ot::PosixApp::RadioSpinel::Process(const Event &aEvent)
 
     if (mState == OT_RADIO_STATE_TRANSMIT && mTxState == kDone)
     {
-        mState = OT_RADIO_STATE_RECEIVE;
+        // The state is updated first since the next frame may be
+        // transmitted from within the callback.
+        mState   = OT_RADIO_STATE_RECEIVE;
+        mTxState = kIdle;
 
 #if OPENTHREAD_ENABLE_DIAG
         if (otPlatDiagModeGet())
@@ -1572,8 +2083,6 @@ void ot::PosixApp::RadioSpinel::Process(const Event &aEvent)
         {
             otPlatRadioTxDone(mInstance, mTransmitFrame, (mIsAckRequested ? &mAckRadioFrame : NULL), mTxError);
         }
-
-        mTxState = kIdle;
     }
 
     if (mState == OT_RADIO_STATE_TRANSMIT && mTxState == kIdle)
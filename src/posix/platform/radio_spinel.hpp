@@ -34,11 +34,14 @@
 #ifndef RADIO_SPINEL_HPP_
 #define RADIO_SPINEL_HPP_
 
+#include <sys/time.h>
+
 #include <openthread/platform/radio.h>
 
 #include "frame_queue.hpp"
 #include "hdlc_interface.hpp"
 #include "spinel.h"
+#include "ncp/spinel_decoder.hpp"
 
 namespace ot {
 namespace PosixApp {
@@ -294,6 +297,48 @@ public:
      */
     otError ClearSrcMatchExtEntries(void);
 
+    /**
+     * This method adds and removes several short addresses in the source address match table.
+     *
+     * The resulting table is sent to the transceiver in a single `SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES` set.
+     *
+     * @param[in]  aAddList     A pointer to the short addresses to be added.
+     * @param[in]  aNumAdd      The number of short addresses in @p aAddList.
+     * @param[in]  aClearList   A pointer to the short addresses to be removed.
+     * @param[in]  aNumClear    The number of short addresses in @p aClearList.
+     *
+     * @retval  OT_ERROR_NONE               Succeeded.
+     * @retval  OT_ERROR_BUSY               Failed due to another operation is on going.
+     * @retval  OT_ERROR_RESPONSE_TIMEOUT   Failed due to no response received from the transceiver.
+     * @retval  OT_ERROR_NO_BUFS            Not enough available entries, the addresses were removed but not added.
+     *
+     */
+    otError UpdateSrcMatchShortEntries(const uint16_t *aAddList,
+                                       uint8_t         aNumAdd,
+                                       const uint16_t *aClearList,
+                                       uint8_t         aNumClear);
+
+    /**
+     * This method adds and removes several extended addresses in the source address match table.
+     *
+     * The resulting table is sent to the transceiver in a single `SPINEL_PROP_MAC_SRC_MATCH_EXTENDED_ADDRESSES` set.
+     *
+     * @param[in]  aAddList     A pointer to the extended addresses to be added, stored in little-endian byte order.
+     * @param[in]  aNumAdd      The number of extended addresses in @p aAddList.
+     * @param[in]  aClearList   A pointer to the extended addresses to be removed, stored in little-endian byte order.
+     * @param[in]  aNumClear    The number of extended addresses in @p aClearList.
+     *
+     * @retval  OT_ERROR_NONE               Succeeded.
+     * @retval  OT_ERROR_BUSY               Failed due to another operation is on going.
+     * @retval  OT_ERROR_RESPONSE_TIMEOUT   Failed due to no response received from the transceiver.
+     * @retval  OT_ERROR_NO_BUFS            Not enough available entries, the addresses were removed but not added.
+     *
+     */
+    otError UpdateSrcMatchExtEntries(const otExtAddress *aAddList,
+                                     uint8_t             aNumAdd,
+                                     const otExtAddress *aClearList,
+                                     uint8_t             aNumClear);
+
     /**
      * This method begins the energy scan sequence on the radio.
      *
@@ -370,25 +415,23 @@ public:
      */
     bool IsEnabled(void) const { return mState != OT_RADIO_STATE_DISABLED; }
 
+#if !OPENTHREAD_POSIX_VIRTUAL_TIME
     /**
-     * This method updates the file descriptor sets with file descriptors used by the radio driver.
+     * This method updates the events of interest of the radio driver with the platform event loop.
      *
-     * @param[inout]  aReadFdSet   A reference to the read file descriptors.
-     * @param[inout]  aWriteFdSet  A reference to the write file descriptors.
-     * @param[inout]  aMaxFd       A reference to the max file descriptor.
      * @param[inout]  aTimeout     A reference to the timeout.
      *
      */
-    void UpdateFdSet(fd_set &aReadFdSet, fd_set &aWriteFdSet, int &aMaxFd, struct timeval &aTimeout);
+    void Update(struct timeval &aTimeout);
 
     /**
-     * This method performs radio driver processing.
+     * This method performs radio driver processing that does not depend on I/O readiness.
      *
-     * @param[in]   aReadFdSet      A reference to the read file descriptors.
-     * @param[in]   aWriteFdSet     A reference to the write file descriptors.
+     * I/O is handled by `HandleEvent()`, called from the platform event loop.
      *
      */
-    void Process(const fd_set &aReadFdSet, const fd_set &aWriteFdSet);
+    void Process(void);
+#endif
 
 #if OPENTHREAD_POSIX_VIRTUAL_TIME
     /**
@@ -456,6 +499,38 @@ private:
         kMaxWaitTime       = 2000, ///< Max time to wait for response in milliseconds.
         kVersionStringSize = 128,  ///< Max size of version string.
         kCapsBufferSize    = 100,  ///< Max buffer size used to store `SPINEL_PROP_CAPS` value.
+        kMaxAsyncRequests  = 8,    ///< Max number of outstanding asynchronous requests.
+    };
+
+    enum
+    {
+        kMaxSrcMatchEntries = OPENTHREAD_CONFIG_MAX_CHILDREN, ///< Max number of source match entries of each type.
+    };
+
+    /**
+     * This function pointer is called when an asynchronous spinel request completes.
+     *
+     * @param[in]   aContext    A pointer to arbitrary context information.
+     * @param[in]   aKey        The spinel property key of the request.
+     * @param[in]   aError      OT_ERROR_NONE if the transceiver accepted the request,
+     *                          OT_ERROR_RESPONSE_TIMEOUT if no response was received, or the error reported
+     *                          by the transceiver.
+     *
+     */
+    typedef void (*AsyncResponseHandler)(void *aContext, spinel_prop_key_t aKey, otError aError);
+
+    /**
+     * This structure represents an outstanding asynchronous spinel request.
+     *
+     */
+    struct AsyncRequest
+    {
+        spinel_tid_t         mTid;             ///< The transaction id, zero if the entry is free.
+        spinel_prop_key_t    mKey;             ///< The property key of the request.
+        uint32_t             mExpectedCommand; ///< Expected response command of the request.
+        AsyncResponseHandler mHandler;         ///< The completion handler, NULL to only log failures.
+        void *               mContext;         ///< The context passed to `mHandler`.
+        struct timeval       mDeadline;        ///< The time after which the request is considered timed out.
     };
 
     otError CheckSpinelVersion(void);
@@ -519,6 +594,64 @@ private:
      */
     otError Remove(spinel_prop_key_t aKey, const char *aFormat, ...);
 
+    /**
+     * This method updates a spinel property of OpenThread transceiver without waiting for the response.
+     *
+     * Up to `kMaxAsyncRequests` requests may be outstanding at a time. When they are all in use, the request is
+     * sent synchronously instead.
+     *
+     * @param[in]   aHandler    A pointer to the completion handler, NULL to only log failures.
+     * @param[in]   aContext    A pointer to arbitrary context information passed to @p aHandler.
+     * @param[in]   aKey        Spinel property key.
+     * @param[in]   aFormat     Spinel formatter to pack property value.
+     * @param[in]   ...         Variable arguments list.
+     *
+     * @retval  OT_ERROR_NONE   Successfully sent the request, @p aHandler will be called on completion.
+     * @retval  OT_ERROR_BUSY   Failed due to no transaction id available.
+     *
+     */
+    otError SetAsync(AsyncResponseHandler aHandler, void *aContext, spinel_prop_key_t aKey, const char *aFormat, ...);
+
+    /**
+     * This method inserts a item into a spinel list property of OpenThread transceiver without waiting for the
+     * response.
+     *
+     * @sa SetAsync
+     *
+     */
+    otError InsertAsync(AsyncResponseHandler aHandler,
+                        void *               aContext,
+                        spinel_prop_key_t    aKey,
+                        const char *         aFormat,
+                        ...);
+
+    /**
+     * This method removes a item from a spinel list property of OpenThread transceiver without waiting for the
+     * response.
+     *
+     * @sa SetAsync
+     *
+     */
+    otError RemoveAsync(AsyncResponseHandler aHandler,
+                        void *               aContext,
+                        spinel_prop_key_t    aKey,
+                        const char *         aFormat,
+                        ...);
+
+    otError       RequestAsyncV(AsyncResponseHandler aHandler,
+                                void *               aContext,
+                                uint32_t             aCommand,
+                                uint32_t             aExpectedCommand,
+                                spinel_prop_key_t    aKey,
+                                const char *         aFormat,
+                                va_list              aArgs);
+    AsyncRequest *FindAsyncRequest(spinel_tid_t aTid);
+    void          FinishAsyncRequest(AsyncRequest &aRequest, otError aError);
+    void          ProcessAsyncRequests(void);
+    void          UpdateAsyncTimeout(struct timeval &aTimeout);
+
+    static void HandleRequiredSetDone(void *aContext, spinel_prop_key_t aKey, otError aError);
+
     spinel_tid_t GetNextTid(void);
     void         FreeTid(spinel_tid_t tid) { mCmdTidsInUse &= ~(1 << tid); }
 
@@ -555,16 +688,40 @@ private:
                  (aKey == SPINEL_PROP_STREAM_RAW || aKey == SPINEL_PROP_MAC_ENERGY_SCAN_RESULT));
     }
 
+    static otError DecodeFrame(const uint8_t *    aBuffer,
+                               uint16_t           aLength,
+                               uint8_t &          aHeader,
+                               unsigned int &     aCommand,
+                               spinel_prop_key_t &aKey,
+                               const uint8_t *&   aData,
+                               uint16_t &         aDataLength);
+
     void HandleNotification(const uint8_t *aBuffer, uint16_t aLength);
     void HandleValueIs(spinel_prop_key_t aKey, const uint8_t *aBuffer, uint16_t aLength);
 
     void HandleResponse(const uint8_t *aBuffer, uint16_t aLength);
     void HandleTransmitDone(uint32_t aCommand, spinel_prop_key_t aKey, const uint8_t *aBuffer, uint16_t aLength);
     void HandleWaitingResponse(uint32_t aCommand, spinel_prop_key_t aKey, const uint8_t *aBuffer, uint16_t aLength);
+    void HandleAsyncResponse(AsyncRequest &    aRequest,
+                             uint32_t          aCommand,
+                             spinel_prop_key_t aKey,
+                             const uint8_t *   aBuffer,
+                             uint16_t          aLength);
 
     void RadioReceive(void);
     void RadioTransmit(void);
 
+    otError     SendSrcMatchShortEntries(void);
+    otError     SendSrcMatchExtEntries(void);
+    void        RemoveSrcMatchShortEntry(uint16_t aShortAddress);
+    void        RemoveSrcMatchExtEntry(const otExtAddress &aExtAddress);
+    static void ReverseExtAddress(const otExtAddress &aAddress, otExtAddress &aReversed);
+
+#if !OPENTHREAD_POSIX_VIRTUAL_TIME
+    static void HandleEvent(otInstance *aInstance, void *aContext, uint32_t aEvents);
+    void        HandleEvent(uint32_t aEvents);
+#endif
+
     otInstance *mInstance;
 
     HdlcInterface mHdlcInterface;
@@ -579,6 +736,8 @@ private:
     uint32_t          mExpectedCommand; ///< Expected response command of current transaction.
     otError           mError;           ///< The result of current transaction.
 
+    AsyncRequest mAsyncRequests[kMaxAsyncRequests]; ///< Outstanding asynchronous transactions.
+
     FrameQueue mFrameQueue;
 
     uint8_t       mRxPsdu[OT_RADIO_FRAME_MAX_SIZE];
@@ -600,6 +759,12 @@ private:
     char         mVersion[kVersionStringSize];
 
     otRadioState mState;
+
+    uint16_t     mSrcMatchShortEntries[kMaxSrcMatchEntries]; ///< Short addresses in the source match table.
+    otExtAddress mSrcMatchExtEntries[kMaxSrcMatchEntries];   ///< Extended addresses (spinel byte order) in the table.
+    uint8_t      mNumSrcMatchShortEntries;
+    uint8_t      mNumSrcMatchExtEntries;
+
     bool         mIsAckRequested : 1;    ///< Ack requested.
     bool         mIsPromiscuous : 1;     ///< Promiscuous mode.
     bool         mIsReady : 1;           ///< NCP ready.
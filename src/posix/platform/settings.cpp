@@ -39,8 +39,10 @@
 #include <inttypes.h>
 #include <stddef.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <sys/stat.h>
+#include <sys/uio.h>
 #include <unistd.h>
 
 #include <openthread/platform/misc.h>
@@ -60,7 +62,41 @@
 
 static const size_t kMaxFileNameSize = sizeof(OPENTHREAD_CONFIG_POSIX_SETTINGS_PATH) + 32;
 
-static int sSettingsFd = -1;
+/**
+ * The settings file is a journal of records, each starting with a 16-bit key and a 16-bit length.
+ *
+ * An add record is followed by `length` bytes of value. A delete record has `kDeleteFlag` set in the length and is
+ * followed by the 16-bit signed index of the deleted value (-1 for all values of the key). Records are only ever
+ * appended, the file is rewritten without the stale records once they take more space than the live ones.
+ *
+ */
+static const uint16_t kDeleteFlag     = 0x8000;
+static const uint16_t kMaxValueLength = kDeleteFlag - 1;
+static const off_t    kMinCompactSize = 4096; ///< Stale bytes below which the journal is never compacted.
+
+/**
+ * This structure represents a live value in the in-memory index of the journal.
+ *
+ */
+struct SettingsRecord
+{
+    uint16_t mKey;
+    uint16_t mLength;
+    off_t    mOffset; ///< Offset of the value in the settings file.
+};
+
+static int             sSettingsFd     = -1;
+static SettingsRecord *sRecords        = NULL;
+static size_t          sNumRecords     = 0;
+static size_t          sMaxRecords     = 0;
+static off_t           sJournalSize    = 0; ///< Size of the valid journal.
+static off_t           sLiveSize       = 0; ///< Bytes of the journal used by live values, including their headers.
+static uint16_t        sUnsyncedWrites = 0;
+
+static off_t recordSize(uint16_t aLength)
+{
+    return static_cast<off_t>(sizeof(uint16_t) + sizeof(uint16_t) + aLength);
+}
 
 static void getSettingsFileName(char aFileName[kMaxFileNameSize], bool aSwap)
 {
@@ -83,13 +119,14 @@ static int swapOpen(void)
 }
 
 /**
- * This function reads @p aLength bytes from the data file and appends to the swap file.
+ * This function reads @p aLength bytes at @p aOffset from the data file and appends to the swap file.
  *
  * @param[in]   aFd     The file descriptor of the current swap file.
+ * @param[in]   aOffset Offset of the bytes in the data file.
  * @param[in]   aLength Number of bytes to copy.
  *
  */
-static void swapWrite(int aFd, uint16_t aLength)
+static void swapWrite(int aFd, off_t aOffset, uint16_t aLength)
 {
     const size_t kBlockSize = 512;
     uint8_t      buffer[kBlockSize];
@@ -97,7 +134,7 @@ static void swapWrite(int aFd, uint16_t aLength)
     while (aLength > 0)
     {
         uint16_t count = aLength >= sizeof(buffer) ? sizeof(buffer) : aLength;
-        ssize_t  rval  = read(sSettingsFd, buffer, count);
+        ssize_t  rval  = pread(sSettingsFd, buffer, count, aOffset);
 
         VerifyOrDie(rval > 0);
         count = static_cast<uint16_t>(rval);
@@ -105,6 +142,7 @@ static void swapWrite(int aFd, uint16_t aLength)
         assert(rval == count);
         VerifyOrDie(rval == count);
         aLength -= count;
+        aOffset += count;
     }
 }
 
@@ -123,18 +161,167 @@ static void swapPersist(int aFd)
     sSettingsFd = aFd;
 }
 
-static void swapDiscard(int aFd)
+static void indexAdd(uint16_t aKey, uint16_t aLength, off_t aOffset)
 {
-    char swapFileName[kMaxFileNameSize];
+    if (sNumRecords == sMaxRecords)
+    {
+        size_t          maxRecords = (sMaxRecords == 0 ? 16 : sMaxRecords * 2);
+        SettingsRecord *records    = static_cast<SettingsRecord *>(realloc(sRecords, maxRecords * sizeof(*records)));
+
+        VerifyOrDie(records != NULL);
+        sRecords    = records;
+        sMaxRecords = maxRecords;
+    }
+
+    sRecords[sNumRecords].mKey    = aKey;
+    sRecords[sNumRecords].mLength = aLength;
+    sRecords[sNumRecords].mOffset = aOffset;
+    sNumRecords++;
+
+    sLiveSize += recordSize(aLength);
+}
+
+static SettingsRecord *indexFind(uint16_t aKey, int aIndex)
+{
+    SettingsRecord *record = NULL;
 
-    VerifyOrDie(0 == close(aFd));
-    getSettingsFileName(swapFileName, true);
-    VerifyOrDie(0 == unlink(swapFileName));
+    for (size_t i = 0; i < sNumRecords; i++)
+    {
+        if (sRecords[i].mKey == aKey && aIndex-- == 0)
+        {
+            record = &sRecords[i];
+            break;
+        }
+    }
+
+    return record;
+}
+
+static otError indexDelete(uint16_t aKey, int aIndex)
+{
+    otError error = OT_ERROR_NOT_FOUND;
+    size_t  count = 0;
+    int     index = 0;
+
+    for (size_t i = 0; i < sNumRecords; i++)
+    {
+        bool remove = false;
+
+        if (sRecords[i].mKey == aKey)
+        {
+            remove = (aIndex == -1 || aIndex == index);
+            index++;
+        }
+
+        if (remove)
+        {
+            sLiveSize -= recordSize(sRecords[i].mLength);
+            error = OT_ERROR_NONE;
+        }
+        else
+        {
+            sRecords[count++] = sRecords[i];
+        }
+    }
+
+    sNumRecords = count;
+
+    return error;
+}
+
+static void indexClear(void)
+{
+    sNumRecords  = 0;
+    sJournalSize = 0;
+    sLiveSize    = 0;
+}
+
+static void journalSync(void)
+{
+    VerifyOrExit(sUnsyncedWrites > 0);
+    VerifyOrDie(0 == fsync(sSettingsFd));
+    sUnsyncedWrites = 0;
+
+exit:
+    return;
+}
+
+/**
+ * This function appends a record to the journal.
+ *
+ * @param[in]   aKey            The key of the record.
+ * @param[in]   aLength         The length field of the record.
+ * @param[in]   aPayload        A pointer to the record payload.
+ * @param[in]   aPayloadLength  The length of the record payload.
+ *
+ * @returns The offset of the payload in the settings file.
+ *
+ */
+static off_t journalAppend(uint16_t aKey, uint16_t aLength, const void *aPayload, uint16_t aPayloadLength)
+{
+    off_t        offset = sJournalSize + recordSize(0);
+    struct iovec iov[3];
+    ssize_t      total;
+
+    iov[0].iov_base = &aKey;
+    iov[0].iov_len  = sizeof(aKey);
+    iov[1].iov_base = &aLength;
+    iov[1].iov_len  = sizeof(aLength);
+    iov[2].iov_base = const_cast<void *>(aPayload);
+    iov[2].iov_len  = aPayloadLength;
+    total           = static_cast<ssize_t>(recordSize(aPayloadLength));
+
+    VerifyOrDie(sJournalSize == lseek(sSettingsFd, sJournalSize, SEEK_SET));
+    VerifyOrDie(writev(sSettingsFd, iov, 3) == total);
+
+    sJournalSize += total;
+
+    // Syncs are batched, records written since the last one are only at risk on power loss, not on a crash.
+    if (++sUnsyncedWrites >= OPENTHREAD_CONFIG_POSIX_SETTINGS_SYNC_INTERVAL)
+    {
+        journalSync();
+    }
+
+    return offset;
+}
+
+/**
+ * This function rewrites the settings file with only the live values, once stale records dominate it.
+ *
+ */
+static void journalCompact(void)
+{
+    off_t stale = sJournalSize - sLiveSize;
+    int   swapFd;
+
+    VerifyOrExit(stale >= kMinCompactSize && stale >= sLiveSize);
+
+    swapFd = swapOpen();
+
+    for (size_t i = 0; i < sNumRecords; i++)
+    {
+        SettingsRecord &record = sRecords[i];
+        off_t           offset = lseek(swapFd, 0, SEEK_CUR) + recordSize(0);
+
+        VerifyOrDie(write(swapFd, &record.mKey, sizeof(record.mKey)) == sizeof(record.mKey) &&
+                    write(swapFd, &record.mLength, sizeof(record.mLength)) == sizeof(record.mLength));
+        swapWrite(swapFd, record.mOffset, record.mLength);
+        record.mOffset = offset;
+    }
+
+    swapPersist(swapFd);
+
+    sJournalSize    = sLiveSize;
+    sUnsyncedWrites = 0;
+
+exit:
+    return;
 }
 
 void otPlatSettingsInit(otInstance *aInstance)
 {
     otError error = OT_ERROR_NONE;
+    off_t   size;
 
     OT_UNUSED_VARIABLE(aInstance);
 
@@ -156,78 +343,87 @@ void otPlatSettingsInit(otInstance *aInstance)
 
     VerifyOrDie(sSettingsFd != -1);
 
-    for (off_t size = lseek(sSettingsFd, 0, SEEK_END), offset = lseek(sSettingsFd, 0, SEEK_SET); offset < size;)
+    indexClear();
+    size = lseek(sSettingsFd, 0, SEEK_END);
+
+    // Replay the journal to build the index.
+    for (off_t offset = 0; offset < size;)
     {
         uint16_t key;
         uint16_t length;
-        ssize_t  rval;
 
-        rval = read(sSettingsFd, &key, sizeof(key));
-        VerifyOrExit(rval == sizeof(key), error = OT_ERROR_PARSE);
+        VerifyOrExit(pread(sSettingsFd, &key, sizeof(key), offset) == sizeof(key), error = OT_ERROR_PARSE);
+        offset += sizeof(key);
+
+        VerifyOrExit(pread(sSettingsFd, &length, sizeof(length), offset) == sizeof(length), error = OT_ERROR_PARSE);
+        offset += sizeof(length);
+
+        if (length & kDeleteFlag)
+        {
+            int16_t index;
+
+            VerifyOrExit(length == (kDeleteFlag | sizeof(index)), error = OT_ERROR_PARSE);
+            VerifyOrExit(pread(sSettingsFd, &index, sizeof(index), offset) == sizeof(index), error = OT_ERROR_PARSE);
+            offset += sizeof(index);
 
-        rval = read(sSettingsFd, &length, sizeof(length));
-        VerifyOrExit(rval == sizeof(length), error = OT_ERROR_PARSE);
+            indexDelete(key, index);
+        }
+        else
+        {
+            VerifyOrExit(offset + length <= size, error = OT_ERROR_PARSE);
+            indexAdd(key, length, offset);
+            offset += length;
+        }
 
-        offset += sizeof(key) + sizeof(length) + length;
-        VerifyOrExit(offset == lseek(sSettingsFd, length, SEEK_CUR), error = OT_ERROR_PARSE);
+        sJournalSize = offset;
     }
 
 exit:
     if (error == OT_ERROR_PARSE)
     {
-        VerifyOrDie(ftruncate(sSettingsFd, 0) == 0);
+        // Drop the partially written record at the tail, if any.
+        VerifyOrDie(ftruncate(sSettingsFd, sJournalSize) == 0);
     }
+
+    journalCompact();
 }
 
-otError otPlatSettingsGet(otInstance *aInstance, uint16_t aKey, int aIndex, uint8_t *aValue, uint16_t *aValueLength)
+void platformSettingsDeinit(void)
 {
-    otError     error  = OT_ERROR_NOT_FOUND;
-    const off_t size   = lseek(sSettingsFd, 0, SEEK_END);
-    off_t       offset = lseek(sSettingsFd, 0, SEEK_SET);
+    VerifyOrExit(sSettingsFd != -1);
 
-    OT_UNUSED_VARIABLE(aInstance);
-    VerifyOrExit(offset == 0 && size >= 0, error = OT_ERROR_PARSE);
+    journalSync();
+    VerifyOrDie(0 == close(sSettingsFd));
+    sSettingsFd = -1;
 
-    while (offset < size)
-    {
-        uint16_t key;
-        uint16_t length;
-        ssize_t  rval;
+    free(sRecords);
+    sRecords    = NULL;
+    sMaxRecords = 0;
+    indexClear();
 
-        rval = read(sSettingsFd, &key, sizeof(key));
-        VerifyOrExit(rval == sizeof(key), error = OT_ERROR_PARSE);
+exit:
+    return;
+}
+
+otError otPlatSettingsGet(otInstance *aInstance, uint16_t aKey, int aIndex, uint8_t *aValue, uint16_t *aValueLength)
+{
+    otError               error  = OT_ERROR_NONE;
+    const SettingsRecord *record = indexFind(aKey, aIndex);
 
-        rval = read(sSettingsFd, &length, sizeof(length));
-        VerifyOrExit(rval == sizeof(length), error = OT_ERROR_PARSE);
+    OT_UNUSED_VARIABLE(aInstance);
+    VerifyOrExit(record != NULL, error = OT_ERROR_NOT_FOUND);
 
-        if (key == aKey)
+    if (aValueLength)
+    {
+        if (aValue)
         {
-            if (aIndex == 0)
-            {
-                error = OT_ERROR_NONE;
-
-                if (aValueLength)
-                {
-                    if (aValue)
-                    {
-                        uint16_t readLength = (length <= *aValueLength ? length : *aValueLength);
-
-                        VerifyOrExit(read(sSettingsFd, aValue, readLength) == readLength, error = OT_ERROR_PARSE);
-                    }
-
-                    *aValueLength = length;
-                }
-
-                break;
-            }
-            else
-            {
-                --aIndex;
-            }
+            uint16_t readLength = (record->mLength <= *aValueLength ? record->mLength : *aValueLength);
+
+            VerifyOrExit(pread(sSettingsFd, aValue, readLength, record->mOffset) == readLength,
+                         error = OT_ERROR_PARSE);
         }
 
-        offset += sizeof(key) + sizeof(length) + length;
-        VerifyOrExit(offset == lseek(sSettingsFd, length, SEEK_CUR), error = OT_ERROR_PARSE);
+        *aValueLength = record->mLength;
     }
 
 exit:
@@ -243,96 +439,30 @@ otError otPlatSettingsSet(otInstance *aInstance, uint16_t aKey, const uint8_t *a
 
 otError otPlatSettingsAdd(otInstance *aInstance, uint16_t aKey, const uint8_t *aValue, uint16_t aValueLength)
 {
-    off_t size   = lseek(sSettingsFd, 0, SEEK_END);
-    int   swapFd = swapOpen();
+    otError error = OT_ERROR_NONE;
 
     OT_UNUSED_VARIABLE(aInstance);
+    VerifyOrExit(aValueLength <= kMaxValueLength, error = OT_ERROR_NO_BUFS);
 
-    if (size > 0)
-    {
-        VerifyOrDie(0 == lseek(sSettingsFd, 0, SEEK_SET));
-        swapWrite(swapFd, static_cast<uint16_t>(size));
-    }
-
-    VerifyOrDie(write(swapFd, &aKey, sizeof(aKey)) == sizeof(aKey) &&
-                write(swapFd, &aValueLength, sizeof(aValueLength)) == sizeof(aValueLength) &&
-                write(swapFd, aValue, aValueLength) == aValueLength);
+    indexAdd(aKey, aValueLength, journalAppend(aKey, aValueLength, aValue, aValueLength));
 
-    swapPersist(swapFd);
-
-    return OT_ERROR_NONE;
+exit:
+    return error;
 }
 
 otError otPlatSettingsDelete(otInstance *aInstance, uint16_t aKey, int aIndex)
 {
-    otError error  = OT_ERROR_NOT_FOUND;
-    off_t   size   = lseek(sSettingsFd, 0, SEEK_END);
-    off_t   offset = lseek(sSettingsFd, 0, SEEK_SET);
-    int     swapFd = swapOpen();
+    otError error;
+    int16_t index = static_cast<int16_t>(aIndex);
 
     OT_UNUSED_VARIABLE(aInstance);
-    assert(swapFd != -1);
-    assert(offset == 0);
-    VerifyOrExit(offset == 0 && size >= 0, error = OT_ERROR_PARSE);
-
-    while (offset < size)
-    {
-        uint16_t key;
-        uint16_t length;
-        ssize_t  rval;
-
-        rval = read(sSettingsFd, &key, sizeof(key));
-        VerifyOrExit(rval == sizeof(key), error = OT_ERROR_PARSE);
-
-        rval = read(sSettingsFd, &length, sizeof(length));
-        VerifyOrExit(rval == sizeof(length), error = OT_ERROR_PARSE);
-
-        offset += sizeof(key) + sizeof(length) + length;
-
-        if (aKey == key)
-        {
-            if (aIndex == 0)
-            {
-                VerifyOrExit(offset == lseek(sSettingsFd, length, SEEK_CUR), error = OT_ERROR_PARSE);
-                swapWrite(swapFd, static_cast<uint16_t>(size - offset));
-                error = OT_ERROR_NONE;
-                break;
-            }
-            else if (aIndex == -1)
-            {
-                VerifyOrExit(offset == lseek(sSettingsFd, length, SEEK_CUR), error = OT_ERROR_PARSE);
-                error = OT_ERROR_NONE;
-                continue;
-            }
-            else
-            {
-                --aIndex;
-            }
-        }
-
-        rval = write(swapFd, &key, sizeof(key));
-        assert(rval == sizeof(key));
-        VerifyOrDie(rval == sizeof(key));
 
-        rval = write(swapFd, &length, sizeof(length));
-        assert(rval == sizeof(length));
-        VerifyOrDie(rval == sizeof(length));
+    SuccessOrExit(error = indexDelete(aKey, aIndex));
 
-        swapWrite(swapFd, length);
-    }
+    journalAppend(aKey, kDeleteFlag | sizeof(index), &index, sizeof(index));
+    journalCompact();
 
 exit:
-    VerifyOrDie(error != OT_ERROR_PARSE);
-
-    if (error == OT_ERROR_NONE)
-    {
-        swapPersist(swapFd);
-    }
-    else if (error == OT_ERROR_NOT_FOUND)
-    {
-        swapDiscard(swapFd);
-    }
-
     return error;
 }
 
@@ -340,6 +470,7 @@ void otPlatSettingsWipe(otInstance *aInstance)
 {
     OT_UNUSED_VARIABLE(aInstance);
     VerifyOrDie(0 == ftruncate(sSettingsFd, 0));
+    indexClear();
 }
 
 #if SELF_TEST
@@ -482,6 +613,45 @@ int main()
     }
     otPlatSettingsWipe(instance);
 
+    // verify the journal is replayed and compacted
+    assert(otPlatSettingsAdd(instance, 0, data, sizeof(data)) == OT_ERROR_NONE);
+    assert(otPlatSettingsAdd(instance, 0, data, sizeof(data) / 2) == OT_ERROR_NONE);
+    assert(otPlatSettingsAdd(instance, 0, data, sizeof(data) / 3) == OT_ERROR_NONE);
+    assert(otPlatSettingsDelete(instance, 0, 1) == OT_ERROR_NONE);
+
+    for (uint16_t i = 0; i < 1000; i++)
+    {
+        assert(otPlatSettingsSet(instance, 1, data, i % sizeof(data)) == OT_ERROR_NONE);
+    }
+
+    assert(lseek(sSettingsFd, 0, SEEK_END) < 2 * kMinCompactSize);
+
+    platformSettingsDeinit();
+    otPlatSettingsInit(instance);
+    {
+        uint8_t  value[sizeof(data)];
+        uint16_t length = sizeof(value);
+
+        assert(otPlatSettingsGet(instance, 0, 0, value, &length) == OT_ERROR_NONE);
+        assert(length == sizeof(data));
+        assert(0 == memcmp(value, data, length));
+
+        length = sizeof(value);
+        assert(otPlatSettingsGet(instance, 0, 1, value, &length) == OT_ERROR_NONE);
+        assert(length == sizeof(data) / 3);
+        assert(0 == memcmp(value, data, length));
+
+        assert(otPlatSettingsGet(instance, 0, 2, NULL, NULL) == OT_ERROR_NOT_FOUND);
+
+        length = sizeof(value);
+        assert(otPlatSettingsGet(instance, 1, 0, value, &length) == OT_ERROR_NONE);
+        assert(length == 999 % sizeof(data));
+        assert(0 == memcmp(value, data, length));
+    }
+    otPlatSettingsWipe(instance);
+
+    platformSettingsDeinit();
+
     return 0;
 }
 #endif
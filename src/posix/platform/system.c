@@ -48,6 +48,8 @@
 #include <openthread/platform/alarm-milli.h>
 #include <openthread/platform/radio.h>
 
+#include "openthread-system.h"
+
 uint64_t gNodeId = 0;
 
 static void PrintUsage(const char *aProgramName, FILE *aStream, int aExitCode)
@@ -140,6 +142,8 @@ otInstance *otSysInit(int aArgCount, char *aArgVector[])
 
 #if OPENTHREAD_POSIX_VIRTUAL_TIME
     otSimInit();
+#else
+    platformEventLoopInit();
 #endif
     platformAlarmInit(speedUpFactor);
     platformRadioInit(radioFile, radioConfig);
@@ -170,6 +174,10 @@ void otSysDeinit(void)
     otSimDeinit();
 #endif
     platformRadioDeinit();
+    platformSettingsDeinit();
+#if !OPENTHREAD_POSIX_VIRTUAL_TIME
+    platformEventLoopDeinit();
+#endif
 }
 
 #if OPENTHREAD_POSIX_VIRTUAL_TIME
@@ -205,6 +213,7 @@ static int trySelect(fd_set *aReadFdSet, fd_set *aWriteFdSet, fd_set *aErrorFdSe
 }
 #endif // OPENTHREAD_POSIX_VIRTUAL_TIME
 
+#if OPENTHREAD_POSIX_VIRTUAL_TIME
 void otSysProcessDrivers(otInstance *aInstance)
 {
     fd_set         readFdSet;
@@ -221,13 +230,10 @@ void otSysProcessDrivers(otInstance *aInstance)
     platformAlarmUpdateTimeout(&timeout);
     platformUartUpdateFdSet(&readFdSet, &writeFdSet, &errorFdSet, &maxFd);
 #if OPENTHREAD_ENABLE_PLATFORM_UDP
+    platformUdpUpdate();
     platformUdpUpdateFdSet(aInstance, &readFdSet, &maxFd);
 #endif
-#if OPENTHREAD_POSIX_VIRTUAL_TIME
     otSimUpdateFdSet(&readFdSet, &writeFdSet, &errorFdSet, &maxFd, &timeout);
-#else
-    platformRadioUpdateFdSet(&readFdSet, &writeFdSet, &maxFd, &timeout);
-#endif
 
     if (otTaskletsArePending(aInstance))
     {
@@ -235,7 +241,6 @@ void otSysProcessDrivers(otInstance *aInstance)
         timeout.tv_usec = 0;
     }
 
-#if OPENTHREAD_POSIX_VIRTUAL_TIME
     if (timerisset(&timeout))
     {
         // Make sure there are no data ready in UART
@@ -265,7 +270,6 @@ void otSysProcessDrivers(otInstance *aInstance)
         }
     }
     else
-#endif
     {
         rval = select(maxFd + 1, &readFdSet, &writeFdSet, &errorFdSet, &timeout);
     }
@@ -276,14 +280,70 @@ void otSysProcessDrivers(otInstance *aInstance)
         exit(OT_EXIT_FAILURE);
     }
 
-#if OPENTHREAD_POSIX_VIRTUAL_TIME
     otSimProcess(aInstance, &readFdSet, &writeFdSet, &errorFdSet);
-#else
-    platformRadioProcess(aInstance, &readFdSet, &writeFdSet);
-#endif
     platformUartProcess(&readFdSet, &writeFdSet, &errorFdSet);
     platformAlarmProcess(aInstance);
 #if OPENTHREAD_ENABLE_PLATFORM_UDP
     platformUdpProcess(aInstance, &readFdSet);
 #endif
 }
+#else  // OPENTHREAD_POSIX_VIRTUAL_TIME
+/**
+ * This function updates the drivers' events of interest and gets the time until the drivers next need processing.
+ *
+ * @param[in]   aInstance  The OpenThread instance structure.
+ * @param[out]  aTimeout   A pointer to the timeout.
+ *
+ */
+static void updateDrivers(otInstance *aInstance, struct timeval *aTimeout)
+{
+    platformAlarmUpdateTimeout(aTimeout);
+    platformUartUpdate();
+    platformRadioUpdate(aTimeout);
+#if OPENTHREAD_ENABLE_PLATFORM_UDP
+    platformUdpUpdate();
+#endif
+
+    if (otTaskletsArePending(aInstance))
+    {
+        aTimeout->tv_sec  = 0;
+        aTimeout->tv_usec = 0;
+    }
+}
+
+void otSysProcessDrivers(otInstance *aInstance)
+{
+    struct timeval timeout;
+
+    updateDrivers(aInstance, &timeout);
+
+    // Registered drivers (radio, UART and platform UDP) handle their I/O from the event loop.
+    platformEventLoopWait(aInstance, &timeout);
+
+    platformRadioProcess(aInstance);
+    platformAlarmProcess(aInstance);
+}
+
+void otSysMainloopUpdate(otInstance *aInstance, otSysMainloopContext *aMainloop)
+{
+    struct timeval timeout;
+
+    updateDrivers(aInstance, &timeout);
+    platformEventLoopUpdateFdSet(&aMainloop->mReadFdSet, &aMainloop->mWriteFdSet, &aMainloop->mErrorFdSet,
+                                 &aMainloop->mMaxFd, &timeout);
+
+    if (timercmp(&timeout, &aMainloop->mTimeout, <))
+    {
+        aMainloop->mTimeout = timeout;
+    }
+}
+
+void otSysMainloopProcess(otInstance *aInstance, const otSysMainloopContext *aMainloop)
+{
+    platformEventLoopProcess(aInstance, &aMainloop->mReadFdSet, &aMainloop->mWriteFdSet, &aMainloop->mErrorFdSet,
+                             aMainloop->mMaxFd);
+
+    platformRadioProcess(aInstance);
+    platformAlarmProcess(aInstance);
+}
+#endif // OPENTHREAD_POSIX_VIRTUAL_TIME
@@ -75,6 +75,72 @@ void platformUartRestore(void)
     dup2(s_out_fd, STDOUT_FILENO);
 }
 
+static void uartRead(void)
+{
+    ssize_t rval = read(s_in_fd, s_receive_buffer, sizeof(s_receive_buffer));
+
+    if (rval > 0)
+    {
+        otPlatUartReceived(s_receive_buffer, (uint16_t)rval);
+    }
+    else if (rval < 0)
+    {
+        perror("UART read");
+        exit(OT_EXIT_FAILURE);
+    }
+    else
+    {
+        fprintf(stderr, "UART ended\r\n");
+        exit(OT_EXIT_SUCCESS);
+    }
+}
+
+static void uartWrite(void)
+{
+    ssize_t rval = write(s_out_fd, s_write_buffer, s_write_length);
+
+    if (rval <= 0)
+    {
+        perror("UART write");
+        exit(OT_EXIT_FAILURE);
+    }
+
+    s_write_buffer += (uint16_t)rval;
+    s_write_length -= (uint16_t)rval;
+
+    if (s_write_length == 0)
+    {
+        otPlatUartSendDone();
+    }
+}
+
+#if !OPENTHREAD_POSIX_VIRTUAL_TIME
+static void uartHandleEvent(otInstance *aInstance, void *aContext, uint32_t aEvents)
+{
+    int fd = (int)(intptr_t)aContext;
+
+    OT_UNUSED_VARIABLE(aInstance);
+
+    errno = 0;
+
+    if (aEvents & OT_SYS_EVENT_ERROR)
+    {
+        perror(fd == s_in_fd ? "s_in_fd" : "s_out_fd");
+        exit(OT_EXIT_FAILURE);
+    }
+
+    if ((aEvents & OT_SYS_EVENT_READ) && fd == s_in_fd)
+    {
+        uartRead();
+    }
+
+    if ((aEvents & OT_SYS_EVENT_WRITE) && fd == s_out_fd && s_write_length > 0)
+    {
+        uartWrite();
+    }
+}
+#endif // !OPENTHREAD_POSIX_VIRTUAL_TIME
+
 otError otPlatUartEnable(void)
 {
     otError        error = OT_ERROR_NONE;
@@ -153,6 +219,11 @@ otError otPlatUartEnable(void)
         otEXPECT_ACTION(tcsetattr(s_out_fd, TCSANOW, &termios) == 0, perror("tcsetattr"); error = OT_ERROR_GENERIC);
     }
 
+#if !OPENTHREAD_POSIX_VIRTUAL_TIME
+    platformEventRegister(s_in_fd, OT_SYS_EVENT_READ, uartHandleEvent, (void *)(intptr_t)s_in_fd);
+    platformEventRegister(s_out_fd, 0, uartHandleEvent, (void *)(intptr_t)s_out_fd);
+#endif
+
     return error;
 
 exit:
@@ -165,6 +236,11 @@ otError otPlatUartDisable(void)
 {
     otError error = OT_ERROR_NONE;
 
+#if !OPENTHREAD_POSIX_VIRTUAL_TIME
+    platformEventUnregister(s_in_fd);
+    platformEventUnregister(s_out_fd);
+#endif
+
     close(s_in_fd);
     close(s_out_fd);
 
@@ -219,7 +295,6 @@ void platformUartUpdateFdSet(fd_set *aReadFdSet, fd_set *aWriteFdSet, fd_set *aE
 
 void platformUartProcess(const fd_set *aReadFdSet, const fd_set *aWriteFdSet, const fd_set *aErrorFdSet)
 {
-    ssize_t rval;
     errno = 0;
 
     if (FD_ISSET(s_in_fd, aErrorFdSet))
@@ -236,40 +311,18 @@ void platformUartProcess(const fd_set *aReadFdSet, const fd_set *aWriteFdSet, co
 
     if (FD_ISSET(s_in_fd, aReadFdSet))
     {
-        rval = read(s_in_fd, s_receive_buffer, sizeof(s_receive_buffer));
-
-        if (rval > 0)
-        {
-            otPlatUartReceived(s_receive_buffer, (uint16_t)rval);
-        }
-        else if (rval < 0)
-        {
-            perror("UART read");
-            exit(OT_EXIT_FAILURE);
-        }
-        else
-        {
-            fprintf(stderr, "UART ended\r\n");
-            exit(OT_EXIT_SUCCESS);
-        }
+        uartRead();
     }
 
     if ((s_write_length > 0) && (FD_ISSET(s_out_fd, aWriteFdSet)))
     {
-        rval = write(s_out_fd, s_write_buffer, s_write_length);
-
-        if (rval <= 0)
-        {
-            perror("UART write");
-            exit(OT_EXIT_FAILURE);
-        }
-
-        s_write_buffer += (uint16_t)rval;
-        s_write_length -= (uint16_t)rval;
-
-        if (s_write_length == 0)
-        {
-            otPlatUartSendDone();
-        }
+        uartWrite();
     }
 }
+
+void platformUartUpdate(void)
+{
+#if !OPENTHREAD_POSIX_VIRTUAL_TIME
+    platformEventUpdate(s_out_fd, (s_write_length > 0) ? OT_SYS_EVENT_WRITE : 0);
+#endif
+}
@@ -54,7 +54,9 @@
 
 static uint32_t sPlatNetifIndex = 0;
 
-static const size_t kMaxUdpSize = 1280;
+static const size_t   kMaxUdpSize     = 1280;
+static const size_t   kMaxControlSize = CMSG_SPACE(sizeof(struct in6_pktinfo)) + CMSG_SPACE(sizeof(int));
+static const uint16_t kBatchSize      = OPENTHREAD_CONFIG_POSIX_APP_UDP_BATCH_SIZE;
 
 static void *FdToHandle(int aFd)
 {
@@ -76,15 +78,46 @@ static bool IsMulticast(const struct in6_addr &aAddress)
     return aAddress.s6_addr[0] == 0xff;
 }
 
-static otError transmitPacket(int aFd, uint8_t *aPayload, uint16_t aLength, const otMessageInfo &aMessageInfo)
+/**
+ * This structure represents a datagram and the `msghdr` describing it to `sendmsg()`/`recvmsg()`.
+ *
+ */
+struct UdpPacket
+{
+    int                 mFd;
+    struct msghdr       mMsg;
+    struct iovec        mIov;
+    struct sockaddr_in6 mPeerAddr;
+    uint8_t             mControl[kMaxControlSize];
+    uint8_t             mPayload[kMaxUdpSize];
+};
+
+static UdpPacket sTxPackets[kBatchSize]; ///< Datagrams queued by `otPlatUdpSend()`, sent by `platformUdpUpdate()`.
+static uint16_t  sTxCount = 0;
+static UdpPacket sRxPackets[kBatchSize];
+
+static void initMsg(UdpPacket &aPacket, size_t aLength)
+{
+    aPacket.mIov.iov_base = aPacket.mPayload;
+    aPacket.mIov.iov_len  = aLength;
+
+    aPacket.mMsg.msg_name       = &aPacket.mPeerAddr;
+    aPacket.mMsg.msg_namelen    = sizeof(aPacket.mPeerAddr);
+    aPacket.mMsg.msg_control    = aPacket.mControl;
+    aPacket.mMsg.msg_controllen = sizeof(aPacket.mControl);
+    aPacket.mMsg.msg_iov        = &aPacket.mIov;
+    aPacket.mMsg.msg_iovlen     = 1;
+    aPacket.mMsg.msg_flags      = 0;
+}
+
+static void preparePacket(UdpPacket &aPacket, int aFd, uint16_t aLength, const otMessageInfo &aMessageInfo)
 {
-    struct sockaddr_in6 peerAddr;
-    uint8_t             control[CMSG_SPACE(sizeof(struct in6_pktinfo)) + CMSG_SPACE(sizeof(int))];
-    size_t              controlLength = 0;
-    struct iovec        iov;
-    struct msghdr       msg;
-    struct cmsghdr *    cmsg;
-    ssize_t             rval;
+    struct sockaddr_in6 &peerAddr      = aPacket.mPeerAddr;
+    struct msghdr &      msg           = aPacket.mMsg;
+    size_t               controlLength = 0;
+    struct cmsghdr *     cmsg;
+
+    aPacket.mFd = aFd;
 
     memset(&peerAddr, 0, sizeof(peerAddr));
     peerAddr.sin6_port   = htons(aMessageInfo.mPeerPort);
@@ -97,18 +130,8 @@ static otError transmitPacket(int aFd, uint8_t *aPayload, uint16_t aLength, cons
         peerAddr.sin6_scope_id = sPlatNetifIndex;
     }
 
-    memset(control, 0, sizeof(control));
-
-    iov.iov_base = aPayload;
-    iov.iov_len  = aLength;
-
-    msg.msg_name       = &peerAddr;
-    msg.msg_namelen    = sizeof(peerAddr);
-    msg.msg_control    = control;
-    msg.msg_controllen = sizeof(control);
-    msg.msg_iov        = &iov;
-    msg.msg_iovlen     = 1;
-    msg.msg_flags      = 0;
+    memset(aPacket.mControl, 0, sizeof(aPacket.mControl));
+    initMsg(aPacket, aLength);
 
     cmsg = CMSG_FIRSTHDR(&msg);
 
@@ -145,36 +168,94 @@ static otError transmitPacket(int aFd, uint8_t *aPayload, uint16_t aLength, cons
 #else
     msg.msg_controllen = controlLength;
 #endif
+}
+
+/**
+ * This function sends up to @p aCount datagrams queued for the same socket.
+ *
+ * @returns The number of datagrams consumed, including a datagram which failed to be sent.
+ *
+ */
+static uint16_t transmitPackets(UdpPacket *aPackets, uint16_t aCount)
+{
+    uint16_t count = 1;
+
+#ifdef __linux__
+    struct mmsghdr msgs[kBatchSize];
+    int            rval;
+
+    for (uint16_t i = 0; i < aCount; i++)
+    {
+        msgs[i].msg_hdr = aPackets[i].mMsg;
+        msgs[i].msg_len = 0;
+    }
+
+    rval = sendmmsg(aPackets[0].mFd, msgs, aCount, 0);
+    VerifyOrExit(rval > 0, perror("sendmmsg"));
+    count = static_cast<uint16_t>(rval);
+#else
+    OT_UNUSED_VARIABLE(aCount);
+    VerifyOrExit(sendmsg(aPackets[0].mFd, &aPackets[0].mMsg, 0) > 0, perror("sendmsg"));
+#endif
+
+exit:
+    return count;
+}
 
-    rval = sendmsg(aFd, &msg, 0);
-    VerifyOrExit(rval > 0, perror("sendmsg"));
+/**
+ * This function receives up to `kBatchSize` pending datagrams from @p aFd into `sRxPackets`.
+ *
+ * @returns The number of datagrams received.
+ *
+ */
+static uint16_t receivePackets(int aFd)
+{
+    uint16_t count = 0;
+
+#ifdef __linux__
+    struct mmsghdr msgs[kBatchSize];
+    int            rval;
+
+    for (uint16_t i = 0; i < kBatchSize; i++)
+    {
+        initMsg(sRxPackets[i], sizeof(sRxPackets[i].mPayload));
+        msgs[i].msg_hdr = sRxPackets[i].mMsg;
+        msgs[i].msg_len = 0;
+    }
+
+    rval = recvmmsg(aFd, msgs, kBatchSize, MSG_DONTWAIT, NULL);
+    VerifyOrExit(rval > 0, perror("recvmmsg"));
+
+    for (count = 0; count < rval; count++)
+    {
+        sRxPackets[count].mMsg         = msgs[count].msg_hdr;
+        sRxPackets[count].mIov.iov_len = msgs[count].msg_len;
+    }
+#else
+    for (; count < kBatchSize; count++)
+    {
+        ssize_t rval;
+
+        initMsg(sRxPackets[count], sizeof(sRxPackets[count].mPayload));
+        rval = recvmsg(aFd, &sRxPackets[count].mMsg, MSG_DONTWAIT);
+
+        if (rval <= 0)
+        {
+            VerifyOrExit(count > 0, perror("recvmsg"));
+            break;
+        }
+
+        sRxPackets[count].mIov.iov_len = static_cast<size_t>(rval);
+    }
+#endif
 
 exit:
-    return rval > 0 ? OT_ERROR_NONE : OT_ERROR_FAILED;
+    return count;
 }
 
-static otError receivePacket(int aFd, uint8_t *aPayload, uint16_t &aLength, otMessageInfo &aMessageInfo)
+static void parsePacket(UdpPacket &aPacket, otMessageInfo &aMessageInfo)
 {
-    struct sockaddr_in6 peerAddr;
-    uint8_t             control[kMaxUdpSize];
-    struct iovec        iov;
-    struct msghdr       msg;
-    ssize_t             rval;
-
-    iov.iov_base = aPayload;
-    iov.iov_len  = aLength;
-
-    msg.msg_name       = &peerAddr;
-    msg.msg_namelen    = sizeof(peerAddr);
-    msg.msg_control    = control;
-    msg.msg_controllen = sizeof(control);
-    msg.msg_iov        = &iov;
-    msg.msg_iovlen     = 1;
-    msg.msg_flags      = 0;
-
-    rval = recvmsg(aFd, &msg, 0);
-    VerifyOrExit(rval > 0, perror("recvmsg"));
-    aLength = static_cast<uint16_t>(rval);
+    struct msghdr &msg = aPacket.mMsg;
 
     for (struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msg); cmsg != NULL; cmsg = CMSG_NXTHDR(&msg, cmsg))
     {
@@ -198,12 +279,59 @@ static otError receivePacket(int aFd, uint8_t *aPayload, uint16_t &aLength, otMe
         }
     }
 
-    aMessageInfo.mPeerPort = ntohs(peerAddr.sin6_port);
-    memcpy(&aMessageInfo.mPeerAddr, &peerAddr.sin6_addr, sizeof(aMessageInfo.mPeerAddr));
+    aMessageInfo.mPeerPort = ntohs(aPacket.mPeerAddr.sin6_port);
+    memcpy(&aMessageInfo.mPeerAddr, &aPacket.mPeerAddr.sin6_addr, sizeof(aMessageInfo.mPeerAddr));
+}
+
+static void deliverPacket(otInstance *aInstance, otUdpSocket *aUdpSocket, UdpPacket &aPacket)
+{
+    otMessageSettings msgSettings = {false, OT_MESSAGE_PRIORITY_NORMAL, 0};
+    otMessageInfo     messageInfo;
+    otMessage *       message = NULL;
+
+    memset(&messageInfo, 0, sizeof(messageInfo));
+    messageInfo.mSockPort = aUdpSocket->mSockName.mPort;
+
+    parsePacket(aPacket, messageInfo);
+
+    message = otUdpNewMessage(aInstance, &msgSettings);
+    VerifyOrExit(message != NULL);
+
+    SuccessOrExit(otMessageAppend(message, aPacket.mPayload, static_cast<uint16_t>(aPacket.mIov.iov_len)));
+
+    aUdpSocket->mHandler(aUdpSocket->mContext, message, &messageInfo);
+
+exit:
+    if (message != NULL)
+    {
+        otMessageFree(message);
+    }
+}
+
+static void HandleUdpReceive(otInstance *aInstance, otUdpSocket *aUdpSocket)
+{
+    void *   handle = aUdpSocket->mHandle;
+    uint16_t count  = receivePackets(FdFromHandle(handle));
+
+    // Stop if a handler closes the socket.
+    for (uint16_t i = 0; i < count && aUdpSocket->mHandle == handle; i++)
+    {
+        deliverPacket(aInstance, aUdpSocket, sRxPackets[i]);
+    }
+}
+
+#if !OPENTHREAD_POSIX_VIRTUAL_TIME
+static void HandleUdpEvent(otInstance *aInstance, void *aContext, uint32_t aEvents)
+{
+    VerifyOrExit(sPlatNetifIndex != 0);
+    VerifyOrExit(aEvents & OT_SYS_EVENT_READ);
+
+    HandleUdpReceive(aInstance, static_cast<otUdpSocket *>(aContext));
 
 exit:
-    return rval > 0 ? OT_ERROR_NONE : OT_ERROR_FAILED;
+    return;
 }
+#endif
 
 otError otPlatUdpSocket(otUdpSocket *aUdpSocket)
 {
@@ -217,6 +345,10 @@ otError otPlatUdpSocket(otUdpSocket *aUdpSocket)
 
     aUdpSocket->mHandle = FdToHandle(fd);
 
+#if !OPENTHREAD_POSIX_VIRTUAL_TIME
+    platformEventRegister(fd, OT_SYS_EVENT_READ, HandleUdpEvent, aUdpSocket);
+#endif
+
 exit:
     return error;
 }
@@ -228,6 +360,14 @@ otError otPlatUdpClose(otUdpSocket *aUdpSocket)
 
     VerifyOrExit(aUdpSocket->mHandle != NULL, error = OT_ERROR_INVALID_ARGS);
     fd = FdFromHandle(aUdpSocket->mHandle);
+
+    // Send datagrams still queued for this socket.
+    platformUdpUpdate();
+
+#if !OPENTHREAD_POSIX_VIRTUAL_TIME
+    platformEventUnregister(fd);
+#endif
+
     VerifyOrExit(0 == close(fd), error = OT_ERROR_FAILED);
 
     aUdpSocket->mHandle = NULL;
@@ -336,12 +476,19 @@ otError otPlatUdpSend(otUdpSocket *aUdpSocket, otMessage *aMessage, const otMess
     VerifyOrExit(aUdpSocket->mHandle != NULL, error = OT_ERROR_INVALID_ARGS);
     fd = FdFromHandle(aUdpSocket->mHandle);
 
+    if (sTxCount == kBatchSize)
     {
-        uint8_t  payload[kMaxUdpSize];
-        uint16_t len = otMessageGetLength(aMessage);
+        platformUdpUpdate();
+    }
+
+    {
+        UdpPacket &packet = sTxPackets[sTxCount];
+        uint16_t   len    = otMessageGetLength(aMessage);
 
-        VerifyOrExit(len == otMessageRead(aMessage, 0, payload, len), error = OT_ERROR_INVALID_ARGS);
-        SuccessOrExit(error = transmitPacket(fd, payload, len, *aMessageInfo));
+        VerifyOrExit(len <= sizeof(packet.mPayload), error = OT_ERROR_NO_BUFS);
+        VerifyOrExit(len == otMessageRead(aMessage, 0, packet.mPayload, len), error = OT_ERROR_INVALID_ARGS);
+        preparePacket(packet, fd, len, *aMessageInfo);
+        sTxCount++;
     }
 
 exit:
@@ -390,46 +537,37 @@ void platformUdpInit(void)
     }
 }
 
-void platformUdpProcess(otInstance *aInstance, const fd_set *aReadFdSet)
+void platformUdpUpdate(void)
 {
-    otMessageSettings msgSettings = {false, OT_MESSAGE_PRIORITY_NORMAL};
+    uint16_t sent = 0;
 
-    VerifyOrExit(sPlatNetifIndex != 0);
-
-    for (otUdpSocket *socket = otUdpGetSockets(aInstance); socket != NULL; socket = socket->mNext)
+    while (sent < sTxCount)
     {
-        int fd = FdFromHandle(socket->mHandle);
+        uint16_t count = 1;
 
-        if (fd > 0 && FD_ISSET(fd, aReadFdSet))
+        // Consecutive datagrams of the same socket are sent with a single call.
+        while (sent + count < sTxCount && sTxPackets[sent + count].mFd == sTxPackets[sent].mFd)
         {
-            otMessageInfo messageInfo;
-            otMessage *   message = NULL;
-            uint8_t       payload[kMaxUdpSize];
-            uint16_t      length = sizeof(payload);
-
-            memset(&messageInfo, 0, sizeof(messageInfo));
-            messageInfo.mSockPort = socket->mSockName.mPort;
+            count++;
+        }
 
-            if (OT_ERROR_NONE != receivePacket(fd, payload, length, messageInfo))
-            {
-                continue;
-            }
+        sent += transmitPackets(&sTxPackets[sent], count);
+    }
 
-            message = otUdpNewMessage(aInstance, &msgSettings);
+    sTxCount = 0;
+}
 
-            if (message == NULL)
-            {
-                continue;
-            }
+void platformUdpProcess(otInstance *aInstance, const fd_set *aReadFdSet)
+{
+    VerifyOrExit(sPlatNetifIndex != 0);
 
-            if (otMessageAppend(message, payload, length) != OT_ERROR_NONE)
-            {
-                otMessageFree(message);
-                continue;
-            }
+    for (otUdpSocket *socket = otUdpGetSockets(aInstance); socket != NULL; socket = socket->mNext)
+    {
+        int fd = FdFromHandle(socket->mHandle);
 
-            socket->mHandler(socket->mContext, message, &messageInfo);
-            otMessageFree(message);
+        if (fd > 0 && FD_ISSET(fd, aReadFdSet))
+        {
+            HandleUdpReceive(aInstance, socket);
             // only process one socket a time
             break;
         }
@@ -26,6 +26,7 @@
  *  POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <stdbool.h>
 #include <string.h>
 
 #include <openthread/platform/alarm-milli.h>
@@ -35,11 +36,24 @@
 #include <openthread/platform/random.h>
 #include <openthread/platform/settings.h>
 
-static uint32_t sRandomState = 1;
+static uint32_t     sRandomState = 1;
+static uint8_t      sRadioTransmitPsdu[OT_RADIO_FRAME_MAX_SIZE];
+static otRadioFrame sRadioTransmitFrame = {.mPsdu = sRadioTransmitPsdu};
+static bool         sRadioTransmitPending;
 
 void FuzzerPlatformInit(void)
 {
-    sRandomState = 1;
+    sRandomState          = 1;
+    sRadioTransmitPending = false;
+}
+
+void FuzzerPlatformProcess(otInstance *aInstance)
+{
+    if (sRadioTransmitPending)
+    {
+        sRadioTransmitPending = false;
+        otPlatRadioTxDone(aInstance, &sRadioTransmitFrame, NULL, OT_ERROR_NONE);
+    }
 }
 
 uint32_t otPlatAlarmMilliGetNow(void)
@@ -159,13 +173,14 @@ otError otPlatRadioTransmit(otInstance *aInstance, otRadioFrame *aFrame)
 {
     (void)aInstance;
     (void)aFrame;
+    sRadioTransmitPending = true;
     return OT_ERROR_NONE;
 }
 
 otRadioFrame *otPlatRadioGetTransmitBuffer(otInstance *aInstance)
 {
     (void)aInstance;
-    return NULL;
+    return &sRadioTransmitFrame;
 }
 
 int8_t otPlatRadioGetRssi(otInstance *aInstance)
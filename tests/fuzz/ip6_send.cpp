@@ -60,6 +60,7 @@ extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
 
     settings.mLinkSecurityEnabled = (data[0] & 0x1) != 0;
     settings.mPriority            = OT_MESSAGE_PRIORITY_NORMAL;
+    settings.mLifetime            = 0;
 
     message = otIp6NewMessage(instance, &settings);
     VerifyOrExit(message != NULL, error = OT_ERROR_NO_BUFS);
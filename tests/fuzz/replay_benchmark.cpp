@@ -0,0 +1,288 @@
+/*
+ *  Copyright (c) 2018, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file replays fuzz corpora through the receive or send path at maximum rate and reports throughput.
+ *
+ *   Unlike the fuzzers, a single OpenThread instance is kept across all inputs and the tasklets are run after each
+ *   one, so the numbers reflect the cost of processing a frame end-to-end rather than instance setup.
+ */
+
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <openthread/instance.h>
+#include <openthread/ip6.h>
+#include <openthread/link.h>
+#include <openthread/message.h>
+#include <openthread/tasklet.h>
+#include <openthread/thread.h>
+#include <openthread/thread_ftd.h>
+#include <openthread/platform/radio.h>
+
+#include "common/code_utils.hpp"
+
+extern "C" void FuzzerPlatformInit(void);
+extern "C" void FuzzerPlatformProcess(otInstance *aInstance);
+
+enum
+{
+    kDefaultRounds = 1000,
+    kMaxInputs     = 1024,
+    kMaxInputSize  = 1280,
+};
+
+enum Mode
+{
+    kModeReceive,
+    kModeSend,
+};
+
+struct Input
+{
+    uint16_t mLength;
+    uint8_t  mData[kMaxInputSize];
+};
+
+static Input    sInputs[kMaxInputs];
+static uint16_t sNumInputs;
+
+static void LoadFile(const char *aPath)
+{
+    FILE * file = fopen(aPath, "rb");
+    Input *input;
+    size_t length;
+
+    VerifyOrExit(file != NULL, fprintf(stderr, "Cannot open %s\n", aPath));
+    VerifyOrExit(sNumInputs < kMaxInputs, fprintf(stderr, "Too many inputs, ignoring %s\n", aPath));
+
+    input  = &sInputs[sNumInputs];
+    length = fread(input->mData, 1, sizeof(input->mData), file);
+    VerifyOrExit(length > 0 && feof(file), fprintf(stderr, "Ignoring empty or oversized input %s\n", aPath));
+
+    input->mLength = static_cast<uint16_t>(length);
+    sNumInputs++;
+
+exit:
+
+    if (file != NULL)
+    {
+        fclose(file);
+    }
+}
+
+static void LoadPath(const char *aPath)
+{
+    DIR *          dir = opendir(aPath);
+    struct dirent *entry;
+    char           path[1024];
+
+    if (dir == NULL)
+    {
+        LoadFile(aPath);
+        ExitNow();
+    }
+
+    while ((entry = readdir(dir)) != NULL)
+    {
+        if (entry->d_name[0] != '.')
+        {
+            snprintf(path, sizeof(path), "%s/%s", aPath, entry->d_name);
+            LoadFile(path);
+        }
+    }
+
+    closedir(dir);
+
+exit:
+    return;
+}
+
+static void Receive(otInstance *aInstance, const Input &aInput)
+{
+    uint8_t      psdu[OT_RADIO_FRAME_MAX_SIZE];
+    otRadioFrame frame;
+
+    VerifyOrExit(aInput.mLength <= OT_RADIO_FRAME_MAX_SIZE);
+
+    memset(&frame, 0, sizeof(frame));
+    frame.mPsdu    = psdu;
+    frame.mChannel = 11;
+    frame.mLength  = static_cast<uint8_t>(aInput.mLength);
+    memcpy(psdu, aInput.mData, aInput.mLength);
+
+    otPlatRadioReceiveDone(aInstance, &frame, OT_ERROR_NONE);
+
+exit:
+    return;
+}
+
+static void Send(otInstance *aInstance, const Input &aInput)
+{
+    otMessage *       message = NULL;
+    otMessageSettings settings;
+
+    // Same input format as the `ip6-send-fuzzer`: link security flag followed by the IPv6 datagram.
+    settings.mLinkSecurityEnabled = (aInput.mData[0] & 0x1) != 0;
+    settings.mPriority            = OT_MESSAGE_PRIORITY_NORMAL;
+    settings.mLifetime            = 0;
+
+    message = otIp6NewMessage(aInstance, &settings);
+    VerifyOrExit(message != NULL);
+
+    SuccessOrExit(otMessageAppend(message, aInput.mData + 1, aInput.mLength - 1));
+
+    otIp6Send(aInstance, message);
+    message = NULL;
+
+exit:
+
+    if (message != NULL)
+    {
+        otMessageFree(message);
+    }
+}
+
+static void Process(otInstance *aInstance)
+{
+    do
+    {
+        otTaskletsProcess(aInstance);
+        FuzzerPlatformProcess(aInstance);
+    } while (otTaskletsArePending(aInstance));
+}
+
+static uint64_t GetNowNs(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return static_cast<uint64_t>(now.tv_sec) * 1000000000ull + static_cast<uint64_t>(now.tv_nsec);
+}
+
+int main(int argc, char *argv[])
+{
+    const otPanId panId  = 0xdead;
+    uint32_t      rounds = kDefaultRounds;
+    Mode          mode   = kModeReceive;
+    otInstance *  instance;
+    otBufferInfo  before;
+    otBufferInfo  after;
+    uint64_t      start;
+    uint64_t      elapsed;
+    uint64_t      frames;
+    int           option;
+
+    while ((option = getopt(argc, argv, "n:m:")) != -1)
+    {
+        switch (option)
+        {
+        case 'n':
+            rounds = static_cast<uint32_t>(strtoul(optarg, NULL, 0));
+            break;
+
+        case 'm':
+            if (strcmp(optarg, "rx") == 0)
+            {
+                mode = kModeReceive;
+                break;
+            }
+            else if (strcmp(optarg, "tx") == 0)
+            {
+                mode = kModeSend;
+                break;
+            }
+
+            // fall through
+
+        default:
+            fprintf(stderr, "Usage: %s [-n rounds] [-m rx|tx] <corpus-file-or-dir>...\n", argv[0]);
+            exit(1);
+        }
+    }
+
+    for (int i = optind; i < argc; i++)
+    {
+        LoadPath(argv[i]);
+    }
+
+    if (sNumInputs == 0 || rounds == 0)
+    {
+        fprintf(stderr, "Nothing to replay\n");
+        exit(1);
+    }
+
+    FuzzerPlatformInit();
+
+    instance = otInstanceInitSingle();
+    otLinkSetPanId(instance, panId);
+    otIp6SetEnabled(instance, true);
+    otThreadSetEnabled(instance, true);
+    otThreadBecomeLeader(instance);
+    Process(instance);
+
+    otMessageGetBufferInfo(instance, &before);
+    start = GetNowNs();
+
+    for (uint32_t round = 0; round < rounds; round++)
+    {
+        for (uint16_t i = 0; i < sNumInputs; i++)
+        {
+            if (mode == kModeReceive)
+            {
+                Receive(instance, sInputs[i]);
+            }
+            else
+            {
+                Send(instance, sInputs[i]);
+            }
+
+            Process(instance);
+        }
+    }
+
+    elapsed = GetNowNs() - start;
+    otMessageGetBufferInfo(instance, &after);
+    frames = static_cast<uint64_t>(rounds) * sNumInputs;
+
+    printf("mode,inputs,frames,total-ns,frames/s,allocations/frame\n");
+    printf("%s,%u,%llu,%llu,%.0f,%.2f\n", (mode == kModeReceive) ? "rx" : "tx", sNumInputs,
+           static_cast<unsigned long long>(frames), static_cast<unsigned long long>(elapsed),
+           (elapsed > 0) ? (frames * 1e9 / elapsed) : 0.0,
+           static_cast<double>(after.mBufferAllocations - before.mBufferAllocations) / frames);
+
+    otInstanceFinalize(instance);
+
+    return 0;
+}
@@ -247,6 +247,15 @@ class Node:
     def scan(self):
         return self.interface.scan()
 
+    def perf_server(self, port=None):
+        return self.interface.perf_server(port)
+
+    def perf_stop(self):
+        return self.interface.perf_stop()
+
+    def perf_client(self, ipaddr, port=5001, length=64, rate=10, duration=10):
+        return self.interface.perf_client(ipaddr, port, length, rate, duration)
+
     def ping(self, ipaddr, num_responses=1, size=None, timeout=5):
         return self.interface.ping(ipaddr, num_responses, size, timeout)
 
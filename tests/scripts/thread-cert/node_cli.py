@@ -622,6 +622,41 @@ class otCli:
 
         return results
 
+    def perf_server(self, port=None):
+        cmd = 'perf server'
+        if port != None:
+            cmd += ' ' + str(port)
+
+        self.send_command(cmd)
+        self._expect('Done')
+
+    def perf_stop(self):
+        self.send_command('perf stop')
+        self._expect('Done')
+
+    def perf_client(self, ipaddr, port=5001, length=64, rate=10, duration=10):
+        cmd = 'perf client %s %d %d %d %d' % (ipaddr, port, length, rate, duration)
+        self.send_command(cmd)
+        self._expect('Done')
+
+        # the client asks for the server report up to three times, one second apart
+        timeout = duration + 5
+        if isinstance(self.simulator, simulator.VirtualTime):
+            self.simulator.go(timeout)
+            timeout = 1
+
+        self._expect('perf client: (.*)\r?\n', timeout=timeout)
+        result = dict(re.findall('(\S+)=(\S+)', self.pexpect.match.groups()[0]))
+
+        try:
+            self._expect('perf rtt: (.*)\r?\n', timeout=1)
+            rtt = re.findall('(\S+)=(\S+)', self.pexpect.match.groups()[0])
+            result.update(('rtt_' + key, value) for key, value in rtt)
+        except (pexpect.TIMEOUT, socket.timeout):
+            pass
+
+        return result
+
     def ping(self, ipaddr, num_responses=1, size=None, timeout=5):
         cmd = 'ping ' + ipaddr
         if size != None:
@@ -0,0 +1,409 @@
+#!/usr/bin/env python
+#
+#  Copyright (c) 2018, The OpenThread Authors.
+#  All rights reserved.
+#
+#  Redistribution and use in source and binary forms, with or without
+#  modification, are permitted provided that the following conditions are met:
+#  1. Redistributions of source code must retain the above copyright
+#     notice, this list of conditions and the following disclaimer.
+#  2. Redistributions in binary form must reproduce the above copyright
+#     notice, this list of conditions and the following disclaimer in the
+#     documentation and/or other materials provided with the distribution.
+#  3. Neither the name of the copyright holder nor the
+#     names of its contributors may be used to endorse or promote products
+#     derived from this software without specific prior written permission.
+#
+#  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+#  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+#  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+#  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+#  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+#  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+#  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+#  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+#  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+#  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+#  POSSIBILITY OF SUCH DAMAGE.
+
+import sys
+import time
+import json
+import re
+import math
+import random
+import socket
+import asyncore
+import argparse
+
+import wpan
+
+#-----------------------------------------------------------------------------------------------------------------------
+# Scenario-driven load generator
+#
+# Builds a network of `wpan.Node` instances from a scenario (topology, number of routers, children per router and
+# their type), runs a traffic mix (unicast and multicast UDP flows, with SED children polling their parents) and
+# reports delivery ratio, latency percentiles and message buffer usage.
+#
+# A scenario can be given as a JSON file (`--scenario`), with the same keys as `DEFAULT_SCENARIO`, and/or on the
+# command line. Command line options override the values from the JSON file.
+#
+#   sudo python load_gen.py --topology grid --routers 16 --children 2 --unicast-flows 24 --rate 2
+#
+# Unlike the `test-nnn` scripts, this is a benchmark and is not run by `start.sh`.
+
+DEFAULT_SCENARIO = {
+    'topology': 'chain',        # 'chain', 'grid' or 'full' (all routers in range of each other)
+    'routers': 4,               # number of routers (including the leader), at most 32
+    'children': 1,              # number of children per router
+    'sed_ratio': 0.5,           # fraction of children which are sleepy (SED), the rest are FED
+    'poll_interval': 500,       # SED poll interval (msec)
+    'unicast_flows': 8,         # number of unicast flows between random node pairs
+    'multicast_flows': 1,       # number of realm-local all-nodes multicast flows from random routers
+    'msg_len': 64,              # UDP payload length (bytes)
+    'msg_count': 20,            # number of messages per flow
+    'rate': 1.0,                # messages per second per flow
+    'speedup': 4,               # simulation time speed up factor
+    'drain_time': 10,           # time (sec) to wait for in-flight messages after the last one is sent
+    'buffer_sample_interval': 1,  # time (sec) between message buffer counter samples (one node per sample)
+    'seed': 123456,
+}
+
+MULTICAST_ADDRESS = 'ff03::1'
+PORT_BASE = 50000
+
+#-----------------------------------------------------------------------------------------------------------------------
+# Traffic sender and receiver
+
+class FlowSender(asyncore.dispatcher):
+    """Sends `count` UDP messages at a fixed `rate`, each carrying the flow id, a sequence number and the send time"""
+
+    def __init__(self, flow_id, node, src_addr, dst_addr, port, msg_len, count, rate):
+        self._flow_id = flow_id
+        self._node = node
+        self._dst_sock_addr = socket.getaddrinfo(dst_addr, port)[0][4]
+        self._msg_len = msg_len
+        self._count = count
+        self._interval = 1.0 / rate
+        self._next_time = 0
+        self.sent = 0
+
+        sock = socket.socket(socket.AF_INET6, socket.SOCK_DGRAM)
+        sock.setsockopt(socket.SOL_SOCKET, wpan._SO_BINDTODEVICE, node.interface_name + '\0')
+        if dst_addr.lower().startswith('ff'):
+            sock.setsockopt(socket.IPPROTO_IPV6, socket.IPV6_MULTICAST_HOPS, 16)
+        sock.bind(socket.getaddrinfo(src_addr, 0)[0][4])
+
+        asyncore.dispatcher.__init__(self, sock)
+
+    def start(self, start_time):
+        # Spread the flows over one interval so that they do not all send at the same time.
+        self._next_time = start_time + random.uniform(0, self._interval)
+
+    @property
+    def done(self):
+        return self.sent >= self._count
+
+    def readable(self):
+        return False
+
+    def writable(self):
+        return not self.done and time.time() >= self._next_time
+
+    def handle_write(self):
+        header = '{}:{}:{:.6f}:'.format(self._flow_id, self.sent, time.time())
+        msg = header + 'x' * max(0, self._msg_len - len(header))
+        self.sendto(msg, self._dst_sock_addr)
+        self.sent += 1
+        self._next_time += self._interval
+
+        if self.done:
+            self.close()
+
+    def handle_close(self):
+        self.close()
+
+
+class FlowReceiver(asyncore.dispatcher):
+    """Listens on a port of a node and records the latency of every (flow id, sequence number) received"""
+
+    _MAX_RECV_SIZE = 2048
+
+    def __init__(self, node, port, metrics):
+        self._metrics = metrics
+
+        sock = socket.socket(socket.AF_INET6, socket.SOCK_DGRAM)
+        sock.setsockopt(socket.SOL_SOCKET, wpan._SO_BINDTODEVICE, node.interface_name + '\0')
+        sock.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEPORT, 1)
+        sock.bind(socket.getaddrinfo('::', port)[0][4])
+
+        asyncore.dispatcher.__init__(self, sock)
+        self._node = node
+
+    def readable(self):
+        return True
+
+    def writable(self):
+        return False
+
+    def handle_read(self):
+        msg = self.recv(FlowReceiver._MAX_RECV_SIZE)
+        now = time.time()
+        try:
+            flow_id, seq, send_time = msg.split(':')[:3]
+            self._metrics.record_rx(int(flow_id), self._node, int(seq), now - float(send_time))
+        except ValueError:
+            pass
+
+    def handle_close(self):
+        self.close()
+
+#-----------------------------------------------------------------------------------------------------------------------
+# Metrics
+
+def percentile(sorted_values, pct):
+    """Returns the `pct` percentile (nearest rank) of a sorted list"""
+    if not sorted_values:
+        return None
+    rank = int(math.ceil(pct / 100.0 * len(sorted_values)))
+    return sorted_values[max(rank, 1) - 1]
+
+
+class Metrics(object):
+    """Collects delivery, latency and buffer usage over a run"""
+
+    def __init__(self, speedup):
+        self._speedup = speedup
+        self._expected = {}     # flow id -> number of receivers
+        self._received = {}     # (flow id, node index, seq) -> latency (sec)
+        self._buffers = {}      # node index -> (total, min free)
+
+    def add_flow(self, flow_id, num_receivers):
+        self._expected[flow_id] = num_receivers
+
+    def record_rx(self, flow_id, node, seq, latency):
+        key = (flow_id, node.index, seq)
+        if flow_id in self._expected and key not in self._received:
+            self._received[key] = latency
+
+    def sample_buffers(self, node):
+        # `MsgBufferCounters` starts with the total and free buffer counts.
+        values = [int(v) for v in re.findall(r'\d+', node.get(wpan.WPAN_OT_MSG_BUFFER_COUNTERS))]
+        if len(values) < 2:
+            return
+        total, free = values[0], values[1]
+        if node.index in self._buffers:
+            free = min(free, self._buffers[node.index][1])
+        self._buffers[node.index] = (total, free)
+
+    def report(self, senders):
+        sent = sum(sender.sent * self._expected[flow_id] for flow_id, sender in senders.items())
+        # Latency is measured on the host clock, scale it to simulated time.
+        latencies = sorted(latency * self._speedup * 1000 for latency in self._received.values())
+
+        result = {
+            'sent': sent,
+            'received': len(self._received),
+            'delivery_ratio': float(len(self._received)) / sent if sent else None,
+            'latency_ms': {
+                'p50': percentile(latencies, 50),
+                'p90': percentile(latencies, 90),
+                'p99': percentile(latencies, 99),
+                'max': latencies[-1] if latencies else None,
+            },
+            'buffers': {
+                'min_free': min(free for (_, free) in self._buffers.values()) if self._buffers else None,
+                'max_used': max(total - free for (total, free) in self._buffers.values()) if self._buffers else None,
+                'per_node_min_free': dict((str(index), free) for index, (_, free) in self._buffers.items()),
+            },
+        }
+        return result
+
+#-----------------------------------------------------------------------------------------------------------------------
+# Topology
+
+def router_links(topology, num_routers):
+    """Returns the list of (i, j) router index pairs which are in range of each other"""
+    if topology == 'chain':
+        return [(i - 1, i) for i in range(1, num_routers)]
+
+    if topology == 'grid':
+        width = int(math.ceil(math.sqrt(num_routers)))
+        links = []
+        for i in range(num_routers):
+            if i % width != 0:
+                links.append((i - 1, i))
+            if i >= width:
+                links.append((i - width, i))
+        return links
+
+    if topology == 'full':
+        return None
+
+    raise ValueError('unknown topology "{}"'.format(topology))
+
+
+def build_network(scenario):
+    """Creates and attaches all nodes, returns (routers, children, sleepy children)"""
+    num_routers = scenario['routers']
+    links = router_links(scenario['topology'], num_routers)
+
+    routers = [wpan.Node() for _ in range(num_routers)]
+    children = []
+    parents = []
+    for router in routers:
+        for _ in range(scenario['children']):
+            children.append(wpan.Node())
+            parents.append(router)
+
+    wpan.Node.init_all_nodes()
+
+    if links is not None:
+        for (i, j) in links:
+            routers[i].whitelist_node(routers[j])
+            routers[j].whitelist_node(routers[i])
+
+    for (child, parent) in zip(children, parents):
+        child.whitelist_node(parent)
+        parent.whitelist_node(child)
+
+    routers[0].form('load-gen')
+
+    # Each router joins through a neighbor which is already attached (the lower index end of a link).
+    for index in range(1, num_routers):
+        if links is None:
+            parent = routers[0]
+        else:
+            parent = routers[min(i for (i, j) in links if j == index)]
+        routers[index].join_node(parent, wpan.JOIN_TYPE_ROUTER)
+
+    seds = []
+    for (index, (child, parent)) in enumerate(zip(children, parents)):
+        # Spread the SEDs evenly over the children, so that routers get a mix of SEDs and FEDs.
+        if int((index + 1) * scenario['sed_ratio']) > int(index * scenario['sed_ratio']):
+            seds.append(child)
+            child.join_node(parent, wpan.JOIN_TYPE_SLEEPY_END_DEVICE)
+            child.set(wpan.WPAN_POLL_INTERVAL, str(scenario['poll_interval']))
+        else:
+            child.join_node(parent, wpan.JOIN_TYPE_END_DEVICE)
+
+    def check_all_routers():
+        for router in routers:
+            wpan.verify(router.get(wpan.WPAN_NODE_TYPE) in [wpan.NODE_TYPE_LEADER, wpan.NODE_TYPE_ROUTER])
+
+    wpan.verify_within(check_all_routers, 120 * num_routers / scenario['speedup'] + 30)
+
+    return routers, children, seds
+
+#-----------------------------------------------------------------------------------------------------------------------
+# Run
+
+def run(scenario):
+    random.seed(scenario['seed'])
+    wpan.Node.set_time_speedup_factor(scenario['speedup'])
+
+    print 'Scenario: {}'.format(json.dumps(scenario, sort_keys=True))
+
+    routers, children, seds = build_network(scenario)
+    all_nodes = routers + children
+    ml_addr = dict((node.index, node.get(wpan.WPAN_IP6_MESH_LOCAL_ADDRESS)[1:-1]) for node in all_nodes)
+
+    metrics = Metrics(scenario['speedup'])
+    senders = {}
+    receivers = []
+    flow_id = 0
+
+    for _ in range(scenario['unicast_flows']):
+        src, dst = random.sample(all_nodes, 2)
+        port = PORT_BASE + flow_id
+        receivers.append(FlowReceiver(dst, port, metrics))
+        senders[flow_id] = FlowSender(flow_id, src, ml_addr[src.index], ml_addr[dst.index], port,
+                                      scenario['msg_len'], scenario['msg_count'], scenario['rate'])
+        metrics.add_flow(flow_id, 1)
+        flow_id += 1
+
+    for _ in range(scenario['multicast_flows']):
+        src = random.choice(routers)
+        port = PORT_BASE + flow_id
+        # Realm-local all-nodes multicast is not delivered to sleepy children.
+        mcast_receivers = [node for node in all_nodes if node is not src and node not in seds]
+        for node in mcast_receivers:
+            receivers.append(FlowReceiver(node, port, metrics))
+        senders[flow_id] = FlowSender(flow_id, src, ml_addr[src.index], MULTICAST_ADDRESS, port,
+                                      scenario['msg_len'], scenario['msg_count'], scenario['rate'])
+        metrics.add_flow(flow_id, len(mcast_receivers))
+        flow_id += 1
+
+    start_time = time.time()
+    for sender in senders.values():
+        sender.start(start_time)
+
+    end_time = None
+    next_sample_time = start_time
+    sample_index = 0
+
+    while end_time is None or time.time() < end_time:
+        asyncore.loop(timeout=0.01, count=1)
+
+        if end_time is None and all(sender.done for sender in senders.values()):
+            end_time = time.time() + scenario['drain_time']
+
+        # Sample one node at a time, so that a large network does not stall the traffic loop.
+        if time.time() >= next_sample_time:
+            metrics.sample_buffers(all_nodes[sample_index % len(all_nodes)])
+            sample_index += 1
+            next_sample_time = time.time() + scenario['buffer_sample_interval']
+
+    for receiver in receivers:
+        receiver.close()
+
+    result = metrics.report(senders)
+    result['duration_sec'] = time.time() - start_time
+    result['nodes'] = len(all_nodes)
+
+    wpan.Node.finalize_all_nodes()
+
+    return result
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(description='Scenario-driven load generator for toranj')
+    parser.add_argument('--scenario', help='JSON file with scenario parameters')
+    parser.add_argument('--output', help='JSON file to write the results to')
+    for key, value in sorted(DEFAULT_SCENARIO.items()):
+        option = '--' + key.replace('_', '-')
+        if key == 'topology':
+            parser.add_argument(option, choices=['chain', 'grid', 'full'])
+        else:
+            parser.add_argument(option, type=type(value))
+    return parser.parse_args()
+
+
+def main():
+    args = parse_args()
+    scenario = dict(DEFAULT_SCENARIO)
+
+    if args.scenario:
+        with open(args.scenario) as scenario_file:
+            scenario.update(json.load(scenario_file))
+
+    for key in DEFAULT_SCENARIO:
+        value = getattr(args, key)
+        if value is not None:
+            scenario[key] = value
+
+    if not 1 <= scenario['routers'] <= 32:
+        print 'Number of routers must be between 1 and 32'
+        sys.exit(1)
+
+    result = run(scenario)
+
+    print json.dumps(result, indent=4, sort_keys=True)
+
+    if args.output:
+        with open(args.output, 'w') as output_file:
+            json.dump({'scenario': scenario, 'result': result}, output_file, indent=4, sort_keys=True)
+
+
+if __name__ == '__main__':
+    main()
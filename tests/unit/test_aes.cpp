@@ -126,6 +126,11 @@ void TestMacCommandFrame()
     aesCcm.Finalize(test + headerLength + payloadLength, &tagLength);
     VerifyOrQuit(memcmp(test, encrypted, sizeof(encrypted)) == 0, "TestMacCommandFrame encrypt failed\n");
 
+    // Decrypt using a separately expanded key schedule.
+    ot::Crypto::AesEcb keySchedule;
+    keySchedule.SetKey(key, 8 * sizeof(key));
+    aesCcm.SetKey(keySchedule);
+
     aesCcm.Init(headerLength, payloadLength, tagLength, nonce, sizeof(nonce));
     aesCcm.Header(test, headerLength);
     aesCcm.Payload(test + headerLength, test + headerLength, payloadLength, false);
@@ -134,11 +139,92 @@ void TestMacCommandFrame()
     VerifyOrQuit(memcmp(test, decrypted, sizeof(decrypted)) == 0, "TestMacCommandFrame decrypt failed\n");
 }
 
+/**
+ * Verifies that the multi-block ECB and the batched CTR keystream match the single block computations.
+ */
+void TestMultiBlock(void)
+{
+    uint8_t key[] = {
+        0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf,
+    };
+
+    uint8_t nonce[] = {
+        0xAC, 0xDE, 0x48, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x06,
+    };
+
+    const uint32_t kChunkLengths[] = {1, 15, 17, 33, 34};
+    const uint32_t kPayloadLength  = 100;
+
+    ot::Crypto::AesEcb keySchedule;
+    ot::Crypto::AesCcm aesCcm;
+    uint8_t            input[4 * ot::Crypto::AesEcb::kBlockSize];
+    uint8_t            output[sizeof(input)];
+    uint8_t            block[ot::Crypto::AesEcb::kBlockSize];
+    uint8_t            payload[kPayloadLength];
+    uint8_t            single[kPayloadLength];
+    uint8_t            chunked[kPayloadLength];
+    uint8_t            singleTag[8];
+    uint8_t            chunkedTag[8];
+    uint8_t            tagLength;
+    uint32_t           offset;
+
+    for (unsigned i = 0; i < sizeof(input); i++)
+    {
+        input[i] = static_cast<uint8_t>(i);
+    }
+
+    for (unsigned i = 0; i < sizeof(payload); i++)
+    {
+        payload[i] = static_cast<uint8_t>(0xff - i);
+    }
+
+    keySchedule.SetKey(key, 8 * sizeof(key));
+    keySchedule.Encrypt(input, output, sizeof(input) / ot::Crypto::AesEcb::kBlockSize);
+
+    for (unsigned i = 0; i < sizeof(input); i += ot::Crypto::AesEcb::kBlockSize)
+    {
+        keySchedule.Encrypt(&input[i], block);
+        VerifyOrQuit(memcmp(&output[i], block, sizeof(block)) == 0, "TestMultiBlock ECB failed\n");
+    }
+
+    aesCcm.SetKey(keySchedule);
+
+    tagLength = sizeof(singleTag);
+    aesCcm.Init(0, kPayloadLength, tagLength, nonce, sizeof(nonce));
+    aesCcm.Payload(payload, single, kPayloadLength, true);
+    aesCcm.Finalize(singleTag, &tagLength);
+
+    tagLength = sizeof(chunkedTag);
+    aesCcm.Init(0, kPayloadLength, tagLength, nonce, sizeof(nonce));
+    offset = 0;
+
+    for (unsigned i = 0; i < sizeof(kChunkLengths) / sizeof(kChunkLengths[0]); i++)
+    {
+        aesCcm.Payload(&payload[offset], &chunked[offset], kChunkLengths[i], true);
+        offset += kChunkLengths[i];
+    }
+
+    VerifyOrQuit(offset == kPayloadLength, "TestMultiBlock chunk lengths are wrong\n");
+    aesCcm.Finalize(chunkedTag, &tagLength);
+
+    VerifyOrQuit(memcmp(single, chunked, sizeof(single)) == 0, "TestMultiBlock CCM payload failed\n");
+    VerifyOrQuit(memcmp(singleTag, chunkedTag, sizeof(singleTag)) == 0, "TestMultiBlock CCM tag failed\n");
+
+    tagLength = sizeof(chunkedTag);
+    aesCcm.Init(0, kPayloadLength, tagLength, nonce, sizeof(nonce));
+    aesCcm.Payload(chunked, single, kPayloadLength, false);
+    aesCcm.Finalize(chunkedTag, &tagLength);
+
+    VerifyOrQuit(memcmp(chunked, payload, sizeof(payload)) == 0, "TestMultiBlock CCM decrypt failed\n");
+    VerifyOrQuit(memcmp(singleTag, chunkedTag, sizeof(singleTag)) == 0, "TestMultiBlock CCM decrypt tag failed\n");
+}
+
 #ifdef ENABLE_TEST_MAIN
 int main(void)
 {
     TestMacBeaconFrame();
     TestMacCommandFrame();
+    TestMultiBlock();
     printf("All tests passed\n");
     return 0;
 }
@@ -155,7 +155,7 @@ void TestChildIp6Address(void)
         SuccessOrQuit(child.AddIp6Address(*sInstance, addresses[index]), "AddIp6Address() failed");
         VerifyChildIp6Addresses(child, 1, &addresses[index]);
 
-        child.ClearIp6Addresses();
+        child.ClearIp6Addresses(*sInstance);
         VerifyChildIp6Addresses(child, 0, NULL);
     }
 
@@ -223,7 +223,7 @@ void TestChildIp6Address(void)
 
     for (uint8_t indexToRemove = 1; indexToRemove < numAddresses - 1; indexToRemove++)
     {
-        child.ClearIp6Addresses();
+        child.ClearIp6Addresses(*sInstance);
 
         for (uint8_t index = 0; index < numAddresses; index++)
         {
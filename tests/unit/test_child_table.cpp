@@ -368,6 +368,37 @@ void TestChildTable(void)
         VerifyChildTableContent(*table, testListLength - i + 1, &testChildList[i - 1]);
     }
 
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    printf("Test FindChild() after child entries change");
+
+    {
+        Child *         child = table->FindChild(testChildList[0].mRloc16, ChildTable::kInStateValid);
+        Mac::ExtAddress extAddress;
+
+        VerifyOrQuit(child != NULL, "FindChild(rloc) failed");
+
+        extAddress = child->GetExtAddress();
+        child->SetRloc16(0x8100);
+        extAddress.m8[0] ^= 0xff;
+        child->SetExtAddress(extAddress);
+
+        VerifyOrQuit(table->FindChild(testChildList[0].mRloc16, ChildTable::kInStateValid) == NULL,
+                     "FindChild(rloc) returned a child with a changed RLOC16");
+        VerifyOrQuit(table->FindChild(0x8100, ChildTable::kInStateValid) == child, "FindChild(rloc) failed");
+        VerifyOrQuit(table->FindChild(static_cast<const Mac::ExtAddress &>(testChildList[0].mExtAddress),
+                                      ChildTable::kInStateValid) == NULL,
+                     "FindChild(ExtAddress) returned a child with a changed address");
+        VerifyOrQuit(table->FindChild(extAddress, ChildTable::kInStateValid) == child, "FindChild(ExtAddress) failed");
+
+        child->SetState(Child::kStateInvalid);
+        VerifyOrQuit(table->FindChild(0x8100, ChildTable::kInStateValid) == NULL,
+                     "FindChild(rloc) returned an invalid child");
+        VerifyOrQuit(table->FindChild(extAddress, ChildTable::kInStateValid) == NULL,
+                     "FindChild(ExtAddress) returned an invalid child");
+    }
+
+    printf(" -- PASS\n");
+
     //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
     printf("Test Get/SetMaxChildrenAllowed");
 
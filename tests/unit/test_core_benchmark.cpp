@@ -0,0 +1,292 @@
+/*
+ *  Copyright (c) 2018, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "common/code_utils.hpp"
+#include "common/instance.hpp"
+#include "common/message.hpp"
+#include "common/timer.hpp"
+#include "crypto/aes_ccm.hpp"
+#include "mac/mac_frame.hpp"
+#include "net/ip6_headers.hpp"
+#include "net/udp6.hpp"
+#include "thread/lowpan.hpp"
+#include "thread/thread_netif.hpp"
+
+#include "test_platform.h"
+#include "test_util.h"
+
+namespace ot {
+
+// This module times core hot paths (`Message::Read`, `Lowpan::Compress`, `AesCcm` and `TimerScheduler::Add`) over
+// a range of sizes. Each result is printed as one CSV row so runs can be compared between commits; it does not
+// verify correctness (see the corresponding `test_*.cpp` for that).
+
+enum
+{
+    kDefaultIterations = 100000,
+    kMaxMessageSize    = 1280,
+};
+
+static const uint16_t sReadSizes[]      = {1, 16, 64, 256, 1024};
+static const uint16_t sPayloadSizes[]   = {0, 16, 64, 512};
+static const uint16_t sAesSizes[]       = {16, 64, 127};
+static const uint16_t sTimerCounts[]    = {1, 8, 32, 128};
+static const uint8_t  sMacSource[]      = {0x00, 0x00, 0x5e, 0xef, 0x10, 0x22, 0x11, 0x00};
+static const uint8_t  sMacDestination[] = {0x00, 0x00, 0x5e, 0xef, 0x10, 0xaa, 0xbb, 0xcc};
+
+static uint8_t sBuffer[kMaxMessageSize];
+
+static uint64_t GetNowNsec(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return static_cast<uint64_t>(now.tv_sec) * 1000000000 + static_cast<uint64_t>(now.tv_nsec);
+}
+
+static void PrintResult(const char *aName, uint16_t aSize, uint32_t aIterations, uint64_t aNsec)
+{
+    printf("%s,%u,%u,%llu,%.1f\n", aName, aSize, static_cast<unsigned int>(aIterations),
+           static_cast<unsigned long long>(aNsec), static_cast<double>(aNsec) / aIterations);
+}
+
+void BenchmarkMessageRead(Instance &aInstance, uint32_t aIterations)
+{
+    Message *message = aInstance.GetMessagePool().New(Message::kTypeIp6, 0);
+
+    VerifyOrQuit(message != NULL, "Message::New failed");
+    SuccessOrQuit(message->Append(sBuffer, sizeof(sBuffer)), "Message::Append failed");
+
+    for (uint8_t index = 0; index < OT_ARRAY_LENGTH(sReadSizes); index++)
+    {
+        uint16_t size  = sReadSizes[index];
+        uint64_t start = GetNowNsec();
+
+        for (uint32_t i = 0; i < aIterations; i++)
+        {
+            // walk the offset so reads start in different buffers of the message
+            uint16_t offset = static_cast<uint16_t>((i * 97) % (sizeof(sBuffer) - size + 1));
+
+            VerifyOrQuit(message->Read(offset, size, sBuffer) == size, "Message::Read failed");
+        }
+
+        PrintResult("Message::Read", size, aIterations, GetNowNsec() - start);
+    }
+
+    message->Free();
+}
+
+void BenchmarkLowpanCompress(Instance &aInstance, uint32_t aIterations)
+{
+    Lowpan::Lowpan &lowpan = aInstance.GetThreadNetif().GetLowpan();
+    Mac::Address    macSource;
+    Mac::Address    macDestination;
+    Ip6::Header     ip6Header;
+    Ip6::UdpHeader  udpHeader;
+    uint8_t         frame[OT_RADIO_FRAME_MAX_SIZE];
+
+    macSource.SetExtended(sMacSource, /* reverse */ false);
+    macDestination.SetExtended(sMacDestination, /* reverse */ false);
+
+    for (uint8_t index = 0; index < OT_ARRAY_LENGTH(sPayloadSizes); index++)
+    {
+        uint16_t size    = sPayloadSizes[index];
+        Message *message = aInstance.GetMessagePool().New(Message::kTypeIp6, 0);
+        uint64_t start;
+
+        VerifyOrQuit(message != NULL, "Message::New failed");
+
+        ip6Header.Init();
+        ip6Header.SetPayloadLength(sizeof(udpHeader) + size);
+        ip6Header.SetNextHeader(Ip6::kProtoUdp);
+        ip6Header.SetHopLimit(64);
+        SuccessOrQuit(ip6Header.GetSource().FromString("fe80::200:5eef:1022:1100"), "FromString failed");
+        SuccessOrQuit(ip6Header.GetDestination().FromString("fe80::200:5eef:10aa:bbcc"), "FromString failed");
+
+        udpHeader.SetSourcePort(61616);
+        udpHeader.SetDestinationPort(61631);
+        udpHeader.SetLength(sizeof(udpHeader) + size);
+        udpHeader.SetChecksum(0xface);
+
+        SuccessOrQuit(message->Append(&ip6Header, sizeof(ip6Header)), "Message::Append failed");
+        SuccessOrQuit(message->Append(&udpHeader, sizeof(udpHeader)), "Message::Append failed");
+        SuccessOrQuit(message->Append(sBuffer, size), "Message::Append failed");
+
+        start = GetNowNsec();
+
+        for (uint32_t i = 0; i < aIterations; i++)
+        {
+            message->SetOffset(0);
+            VerifyOrQuit(lowpan.Compress(*message, macSource, macDestination, frame) > 0, "Lowpan::Compress failed");
+        }
+
+        PrintResult("Lowpan::Compress", size, aIterations, GetNowNsec() - start);
+
+        message->Free();
+    }
+}
+
+void BenchmarkAesCcm(uint32_t aIterations)
+{
+    const uint8_t key[]   = {0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7,
+                           0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf};
+    const uint8_t nonce[] = {0xac, 0xde, 0x48, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x02};
+
+    const uint32_t kHeaderLength = 21;
+    Crypto::AesCcm aesCcm;
+
+    aesCcm.SetKey(key, sizeof(key));
+
+    for (uint8_t index = 0; index < OT_ARRAY_LENGTH(sAesSizes); index++)
+    {
+        uint16_t size  = sAesSizes[index];
+        uint64_t start = GetNowNsec();
+
+        for (uint32_t i = 0; i < aIterations; i++)
+        {
+            uint8_t tagLength = 8;
+
+            SuccessOrQuit(aesCcm.Init(kHeaderLength, size, tagLength, nonce, sizeof(nonce)), "AesCcm::Init failed");
+            aesCcm.Header(sBuffer, kHeaderLength);
+            aesCcm.Payload(sBuffer + kHeaderLength, sBuffer + kHeaderLength, size, true);
+            aesCcm.Finalize(sBuffer + kHeaderLength + size, &tagLength);
+        }
+
+        PrintResult("AesCcm", size, aIterations, GetNowNsec() - start);
+    }
+}
+
+static void HandleTimer(Timer &aTimer)
+{
+    OT_UNUSED_VARIABLE(aTimer);
+}
+
+void BenchmarkTimerSchedulerAdd(Instance &aInstance, uint32_t aIterations)
+{
+    enum
+    {
+        kMaxTimers = 128,
+    };
+
+    TimerMilli *timers[kMaxTimers];
+    TimerMilli  timer(aInstance, HandleTimer, NULL);
+
+    for (uint8_t index = 0; index < kMaxTimers; index++)
+    {
+        timers[index] = new TimerMilli(aInstance, HandleTimer, NULL);
+    }
+
+    for (uint8_t index = 0; index < OT_ARRAY_LENGTH(sTimerCounts); index++)
+    {
+        uint16_t count = sTimerCounts[index];
+        uint64_t start;
+
+        // the running timers are spread out so that `Add()` inserts in the middle of the list on average
+        for (uint16_t i = 0; i < count; i++)
+        {
+            timers[i]->StartAt(0, 1000 + i * 1000);
+        }
+
+        start = GetNowNsec();
+
+        for (uint32_t i = 0; i < aIterations; i++)
+        {
+            timer.StartAt(0, 1000 + (i * 7919) % (count * 1000));
+            timer.Stop();
+        }
+
+        PrintResult("TimerScheduler::Add", count, aIterations, GetNowNsec() - start);
+
+        for (uint16_t i = 0; i < count; i++)
+        {
+            timers[i]->Stop();
+        }
+    }
+
+    for (uint8_t index = 0; index < kMaxTimers; index++)
+    {
+        delete timers[index];
+    }
+}
+
+void RunCoreBenchmark(int aArgc, char *aArgv[])
+{
+    uint32_t  iterations = kDefaultIterations;
+    Instance *instance;
+    int       option;
+
+    while ((option = getopt(aArgc, aArgv, "n:")) != -1)
+    {
+        switch (option)
+        {
+        case 'n':
+            iterations = static_cast<uint32_t>(strtoul(optarg, NULL, 0));
+            break;
+
+        default:
+            fprintf(stderr, "Usage: %s [-n iterations]\n", aArgv[0]);
+            exit(1);
+        }
+    }
+
+    VerifyOrQuit(iterations > 0, "Invalid number of iterations");
+
+    for (uint16_t i = 0; i < sizeof(sBuffer); i++)
+    {
+        sBuffer[i] = static_cast<uint8_t>(i * 13);
+    }
+
+    instance = testInitInstance();
+    VerifyOrQuit(instance != NULL, "Null OpenThread instance");
+
+    printf("benchmark,size,iterations,total-ns,ns/op\n");
+
+    BenchmarkMessageRead(*instance, iterations);
+    BenchmarkLowpanCompress(*instance, iterations);
+    BenchmarkAesCcm(iterations);
+    BenchmarkTimerSchedulerAdd(*instance, iterations);
+
+    testFreeInstance(instance);
+}
+
+} // namespace ot
+
+#ifdef ENABLE_TEST_MAIN
+int main(int argc, char *argv[])
+{
+    ot::RunCoreBenchmark(argc, argv);
+    return 0;
+}
+#endif
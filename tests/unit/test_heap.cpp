@@ -166,10 +166,68 @@ void TestAllocateMultiple(void)
     }
 }
 
+/**
+ * Verifies the fragmentation statistics.
+ *
+ */
+void TestFragmentationStats(void)
+{
+    enum
+    {
+        kNumBlocks = 8,
+    };
+
+    ot::Utils::Heap heap;
+    void *          blocks[kNumBlocks];
+
+    VerifyOrQuit(heap.GetFreeBlockCount() == 1, "TestFragmentationStats initial free block count is wrong!\n");
+    VerifyOrQuit(heap.GetLargestFreeBlockSize() == heap.GetCapacity(),
+                 "TestFragmentationStats initial largest free block is wrong!\n");
+
+    for (size_t i = 0; i < kNumBlocks; i++)
+    {
+        blocks[i] = heap.CAlloc(1, 16);
+        VerifyOrQuit(blocks[i] != NULL, "TestFragmentationStats allocating failed!\n");
+    }
+
+    VerifyOrQuit(heap.GetFreeBlockCount() == 1, "TestFragmentationStats free block count is wrong!\n");
+    VerifyOrQuit(heap.GetLargestFreeBlockSize() == heap.GetFreeSize(),
+                 "TestFragmentationStats largest free block is wrong!\n");
+
+    // Free every other block, none of which can coalesce with each other or with the remaining free space.
+    for (size_t i = 0; i < kNumBlocks; i += 2)
+    {
+        heap.Free(blocks[i]);
+    }
+
+    VerifyOrQuit(heap.GetFreeBlockCount() == kNumBlocks / 2 + 1, "TestFragmentationStats fragmented count is wrong!\n");
+    VerifyOrQuit(heap.GetLargestFreeBlockSize() < heap.GetFreeSize(),
+                 "TestFragmentationStats fragmented largest free block is wrong!\n");
+
+    // Reuse a freed small block.
+    blocks[0] = heap.CAlloc(1, 16);
+    VerifyOrQuit(blocks[0] != NULL, "TestFragmentationStats reallocating failed!\n");
+    VerifyOrQuit(heap.GetFreeBlockCount() == kNumBlocks / 2, "TestFragmentationStats reuse count is wrong!\n");
+
+    // Freeing the remaining blocks coalesces everything back into one block.
+    for (size_t i = 0; i < kNumBlocks; i++)
+    {
+        if (i % 2 == 1 || i == 0)
+        {
+            heap.Free(blocks[i]);
+        }
+    }
+
+    VerifyOrQuit(heap.IsClean() && heap.GetFreeBlockCount() == 1 &&
+                     heap.GetLargestFreeBlockSize() == heap.GetCapacity(),
+                 "TestFragmentationStats heap not clean after freeing all!\n");
+}
+
 void RunTimerTests(void)
 {
     TestAllocateSingle();
     TestAllocateMultiple();
+    TestFragmentationStats();
 }
 
 #ifdef ENABLE_TEST_MAIN
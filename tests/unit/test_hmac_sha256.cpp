@@ -29,7 +29,10 @@
 #include <openthread/config.h>
 
 #include "common/debug.hpp"
+#include "common/instance.hpp"
+#include "common/message.hpp"
 #include "crypto/hmac_sha256.hpp"
+#include "crypto/sha256.hpp"
 #include "utils/wrap_string.h"
 
 #include "test_platform.h"
@@ -80,10 +83,69 @@ void TestHmacSha256(void)
     testFreeInstance(instance);
 }
 
+void TestHmacSha256Message(void)
+{
+    static const uint8_t kKey[]     = {0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b};
+    const uint16_t       kOffsets[] = {0, 1, 100, 511};
+    ot::Instance *       instance;
+    ot::Message *        message;
+    uint8_t              buffer[1024];
+
+    instance = static_cast<ot::Instance *>(testInitInstance());
+    VerifyOrQuit(instance != NULL, "Null OpenThread instance\n");
+
+    for (unsigned i = 0; i < sizeof(buffer); i++)
+    {
+        buffer[i] = static_cast<uint8_t>(random());
+    }
+
+    VerifyOrQuit((message = instance->GetMessagePool().New(ot::Message::kTypeIp6, 0)) != NULL,
+                 "Message::New failed\n");
+    SuccessOrQuit(message->SetLength(sizeof(buffer)), "Message::SetLength failed\n");
+    VerifyOrQuit(message->Write(0, sizeof(buffer), buffer) == sizeof(buffer), "Message::Write failed\n");
+
+    // Make sure hmac and sha256 are destructed before freeing instance.
+    {
+        ot::Crypto::HmacSha256 hmac;
+        ot::Crypto::Sha256     sha256;
+        uint8_t                expected[ot::Crypto::HmacSha256::kHashSize];
+        uint8_t                hash[ot::Crypto::HmacSha256::kHashSize];
+
+        for (unsigned i = 0; i < sizeof(kOffsets) / sizeof(kOffsets[0]); i++)
+        {
+            uint16_t length = static_cast<uint16_t>(sizeof(buffer) - kOffsets[i]);
+
+            hmac.Start(kKey, sizeof(kKey));
+            hmac.Update(buffer + kOffsets[i], length);
+            hmac.Finish(expected);
+
+            hmac.Start(kKey, sizeof(kKey));
+            hmac.Update(*message, kOffsets[i], length);
+            hmac.Finish(hash);
+
+            VerifyOrQuit(memcmp(hash, expected, sizeof(hash)) == 0, "HMAC-SHA-256 over message failed\n");
+
+            sha256.Start();
+            sha256.Update(buffer + kOffsets[i], length);
+            sha256.Finish(expected);
+
+            sha256.Start();
+            sha256.Update(*message, kOffsets[i], length);
+            sha256.Finish(hash);
+
+            VerifyOrQuit(memcmp(hash, expected, sizeof(hash)) == 0, "SHA-256 over message failed\n");
+        }
+    }
+
+    message->Free();
+    testFreeInstance(instance);
+}
+
 #ifdef ENABLE_TEST_MAIN
 int main(void)
 {
     TestHmacSha256();
+    TestHmacSha256Message();
     printf("All tests passed\n");
     return 0;
 }
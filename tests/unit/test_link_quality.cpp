@@ -484,6 +484,46 @@ void TestSuccessRateTracker(void)
     }
 }
 
+#if OPENTHREAD_CONFIG_ENABLE_TX_ERROR_RATE_TRACKING
+void TestAdaptiveFrameRetries(void)
+{
+    LinkQualityInfo linkInfo;
+
+    printf("\nTesting adaptive frame retries\n");
+
+    linkInfo.Clear();
+    VerifyOrQuit(linkInfo.GetAdaptiveFrameRetries() == OPENTHREAD_CONFIG_MAC_MAX_FRAME_RETRIES_DIRECT,
+                 "AdaptiveFrameRetries: incorrect retries on a new link");
+
+    // One failure out of four frames is a moderate loss.
+    for (uint16_t i = 0; i < 1000; i++)
+    {
+        linkInfo.AddFrameTxStatus((i % 4) != 0);
+    }
+
+    VerifyOrQuit(linkInfo.GetAdaptiveFrameRetries() == OPENTHREAD_CONFIG_ADAPTIVE_FRAME_RETRIES_MAX,
+                 "AdaptiveFrameRetries: incorrect retries on a lossy link");
+
+    for (uint16_t i = 0; i < 1000; i++)
+    {
+        linkInfo.AddFrameTxStatus(false);
+    }
+
+    VerifyOrQuit(linkInfo.GetAdaptiveFrameRetries() == OPENTHREAD_CONFIG_ADAPTIVE_FRAME_RETRIES_MIN,
+                 "AdaptiveFrameRetries: incorrect retries on a failing link");
+
+    for (uint16_t i = 0; i < 1000; i++)
+    {
+        linkInfo.AddFrameTxStatus(true);
+    }
+
+    VerifyOrQuit(linkInfo.GetAdaptiveFrameRetries() == OPENTHREAD_CONFIG_MAC_MAX_FRAME_RETRIES_DIRECT,
+                 "AdaptiveFrameRetries: incorrect retries on a recovered link");
+
+    printf("PASS\n");
+}
+#endif
+
 } // namespace ot
 
 #ifdef ENABLE_TEST_MAIN
@@ -492,6 +532,9 @@ int main(void)
     ot::TestRssAveraging();
     ot::TestLinkQualityCalculations();
     ot::TestSuccessRateTracker();
+#if OPENTHREAD_CONFIG_ENABLE_TX_ERROR_RATE_TRACKING
+    ot::TestAdaptiveFrameRetries();
+#endif
     printf("\nAll tests passed\n");
     return 0;
 }
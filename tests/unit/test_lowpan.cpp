@@ -153,6 +153,7 @@ static void Test(TestIphcVector &aVector, bool aCompress, bool aDecompress)
     uint8_t  result[512];
     uint8_t  iphc[512];
     uint8_t  ip6[512];
+    uint8_t  skipped[2 * kBufferSize];
     uint16_t iphcLength;
     uint16_t ip6Length;
 
@@ -205,6 +206,28 @@ static void Test(TestIphcVector &aVector, bool aCompress, bool aDecompress)
 
         message->Free();
         message = NULL;
+
+        // Headers spanning message buffers are compressed the same as headers referenced in place.
+        memset(skipped, 0, sizeof(skipped));
+
+        for (uint16_t skip = 1; aVector.mError == OT_ERROR_NONE && skip < sizeof(skipped); skip++)
+        {
+            VerifyOrQuit((message = sInstance->GetMessagePool().New(Message::kTypeIp6, 0)) != NULL,
+                         "6lo: Ip6::NewMessage failed");
+            SuccessOrQuit(message->Append(skipped, skip), "6lo: Message::Append failed");
+            message->SetOffset(skip);
+            aVector.GetUncompressedStream(*message);
+
+            compressBytes = sLowpan->Compress(*message, aVector.mMacSource, aVector.mMacDestination, result);
+
+            VerifyOrQuit(compressBytes == aVector.mIphcHeader.mLength, "6lo: Lowpan::Compress failed");
+            VerifyOrQuit(message->GetOffset() == skip + aVector.mPayloadOffset, "6lo: Lowpan::Compress failed");
+            VerifyOrQuit(memcmp(iphc, result, static_cast<size_t>(compressBytes)) == 0,
+                         "6lo: Lowpan::Compress failed");
+
+            message->Free();
+            message = NULL;
+        }
     }
 
     if (aDecompress)
@@ -85,6 +85,19 @@ void TestMacHeader(void)
         frame.InitMacHeader(tests[i].fcf, tests[i].secCtl);
         printf("%d\n", frame.GetHeaderLength());
         VerifyOrQuit(frame.GetHeaderLength() == tests[i].headerLength, "MacHeader test failed\n");
+
+        // Cached offsets must match the computed ones, and must be ignored once the header changes.
+        uint8_t footerLength = frame.GetFooterLength();
+
+        frame.SetPayloadLength(10);
+        VerifyOrQuit(frame.ParsePsdu() == OT_ERROR_NONE, "Frame::ParsePsdu() failed\n");
+        VerifyOrQuit(frame.GetHeaderLength() == tests[i].headerLength, "Frame::ParsePsdu() header length failed\n");
+        VerifyOrQuit(frame.GetFooterLength() == footerLength, "Frame::ParsePsdu() footer length failed\n");
+        VerifyOrQuit(frame.GetPayloadLength() == 10, "Frame::ParsePsdu() payload length failed\n");
+
+        frame.SetPayloadLength(20);
+        VerifyOrQuit(frame.GetPayloadLength() == 20, "Frame::ParsePsdu() stale payload length\n");
+        VerifyOrQuit(frame.GetHeaderLength() == tests[i].headerLength, "Frame::ParsePsdu() stale header length\n");
     }
 }
 
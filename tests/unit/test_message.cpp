@@ -29,6 +29,7 @@
 #include "common/debug.hpp"
 #include "common/instance.hpp"
 #include "common/message.hpp"
+#include "net/ip6.hpp"
 #include "utils/wrap_string.h"
 
 #include "test_platform.h"
@@ -63,10 +64,488 @@ void TestMessage(void)
     testFreeInstance(instance);
 }
 
+void TestMessageChunks(void)
+{
+    ot::Instance *     instance;
+    ot::MessagePool *  messagePool;
+    ot::Message *      message;
+    ot::Message::Chunk chunk;
+    uint8_t            writeBuffer[1024];
+    uint8_t            readBuffer[1024];
+    const uint16_t     kOffsets[] = {0, 1, 17, 100, 511, 1000, 1023};
+
+    instance = static_cast<ot::Instance *>(testInitInstance());
+    VerifyOrQuit(instance != NULL, "Null OpenThread instance\n");
+
+    messagePool = &instance->GetMessagePool();
+
+    for (unsigned i = 0; i < sizeof(writeBuffer); i++)
+    {
+        writeBuffer[i] = static_cast<uint8_t>(random());
+    }
+
+    VerifyOrQuit((message = messagePool->New(ot::Message::kTypeIp6, 0)) != NULL, "Message::New failed\n");
+    SuccessOrQuit(message->SetLength(sizeof(writeBuffer)), "Message::SetLength failed\n");
+    VerifyOrQuit(message->Write(0, sizeof(writeBuffer), writeBuffer) == sizeof(writeBuffer), "Message::Write failed\n");
+
+    for (unsigned i = 0; i < sizeof(kOffsets) / sizeof(kOffsets[0]); i++)
+    {
+        uint16_t offset = kOffsets[i];
+        uint16_t length = sizeof(writeBuffer); // longer than the remaining bytes, clipped to end of message
+        uint16_t checksum;
+
+        message->GetFirstChunk(offset, length, chunk);
+
+        while (chunk.mLength > 0)
+        {
+            VerifyOrQuit(memcmp(chunk.mData, writeBuffer + offset, chunk.mLength) == 0,
+                         "Message chunk compare failed\n");
+            offset += chunk.mLength;
+            message->GetNextChunk(length, chunk);
+        }
+
+        VerifyOrQuit(offset == sizeof(writeBuffer), "Message chunks did not cover the message\n");
+        VerifyOrQuit(length == 0, "Message chunk remaining length is incorrect\n");
+
+        checksum = ot::Message::UpdateChecksum(0, writeBuffer + kOffsets[i], sizeof(writeBuffer) - kOffsets[i]);
+        VerifyOrQuit(message->UpdateChecksum(0, kOffsets[i], sizeof(writeBuffer) - kOffsets[i]) == checksum,
+                     "Message::UpdateChecksum failed\n");
+    }
+
+    {
+        uint16_t length = 10;
+
+        message->GetFirstChunk(sizeof(writeBuffer), length, chunk);
+        VerifyOrQuit(chunk.mLength == 0 && length == 0, "Message::GetFirstChunk beyond end of message failed\n");
+    }
+
+    // Copy within the same message to a lower offset (overlapping range).
+    VerifyOrQuit(message->CopyTo(300, 3, sizeof(writeBuffer) - 300, *message) == sizeof(writeBuffer) - 300,
+                 "Message::CopyTo failed\n");
+    VerifyOrQuit(message->Read(0, sizeof(readBuffer), readBuffer) == sizeof(readBuffer), "Message::Read failed\n");
+    VerifyOrQuit(memcmp(readBuffer, writeBuffer, 3) == 0, "Message::CopyTo modified bytes before destination\n");
+    VerifyOrQuit(memcmp(readBuffer + 3, writeBuffer + 300, sizeof(writeBuffer) - 300) == 0,
+                 "Message::CopyTo compare failed\n");
+
+    message->Free();
+
+    testFreeInstance(instance);
+}
+
+void TestMessageBufferClasses(void)
+{
+    ot::Instance *   instance;
+    ot::MessagePool *messagePool;
+    ot::Message *    message;
+
+    instance = static_cast<ot::Instance *>(testInitInstance());
+    VerifyOrQuit(instance != NULL, "Null OpenThread instance\n");
+
+    messagePool = &instance->GetMessagePool();
+
+    VerifyOrQuit((message = messagePool->New(ot::Message::kTypeIp6, 0)) != NULL, "Message::New failed\n");
+    SuccessOrQuit(message->SetLength(100), "Message::SetLength failed\n");
+    SuccessOrQuit(message->SetBufferClass(ot::Message::kBufferClassReassembly), "Message::SetBufferClass failed\n");
+    VerifyOrQuit(messagePool->GetBufferClassCount(ot::Message::kBufferClassReassembly) == message->GetBufferCount(),
+                 "MessagePool::GetBufferClassCount failed\n");
+
+#if OPENTHREAD_CONFIG_MAX_REASSEMBLY_MESSAGE_BUFFERS
+    VerifyOrQuit(message->SetLength(OPENTHREAD_CONFIG_MAX_REASSEMBLY_MESSAGE_BUFFERS * ot::kLargeBufferSize) ==
+                     OT_ERROR_NO_BUFS,
+                 "Message::SetLength did not enforce the buffer class quota\n");
+    VerifyOrQuit(messagePool->GetBufferClassCount(ot::Message::kBufferClassReassembly) <=
+                     OPENTHREAD_CONFIG_MAX_REASSEMBLY_MESSAGE_BUFFERS,
+                 "Buffer class quota exceeded\n");
+#else
+    SuccessOrQuit(message->SetLength(1024), "Message::SetLength failed\n");
+#endif
+
+    VerifyOrQuit(messagePool->GetBufferClassCount(ot::Message::kBufferClassReassembly) == message->GetBufferCount(),
+                 "MessagePool::GetBufferClassCount failed\n");
+
+    SuccessOrQuit(message->SetBufferClass(ot::Message::kBufferClassDefault), "Message::SetBufferClass failed\n");
+    VerifyOrQuit(messagePool->GetBufferClassCount(ot::Message::kBufferClassReassembly) == 0,
+                 "MessagePool::GetBufferClassCount failed\n");
+    SuccessOrQuit(message->SetBufferClass(ot::Message::kBufferClassIndirect), "Message::SetBufferClass failed\n");
+    message->Free();
+    VerifyOrQuit(messagePool->GetBufferClassCount(ot::Message::kBufferClassIndirect) == 0,
+                 "MessagePool::GetBufferClassCount failed after Message::Free\n");
+
+#if OPENTHREAD_CONFIG_NUM_MESSAGE_RESERVED_NET_BUFFERS
+    {
+        ot::Message *messages[ot::kNumBuffers];
+        uint16_t     numMessages = 0;
+
+        while ((message = messagePool->New(ot::Message::kTypeIp6, 0, ot::Message::kPriorityHigh)) != NULL)
+        {
+            messages[numMessages++] = message;
+        }
+
+        VerifyOrQuit(messagePool->GetFreeBufferCount() == ot::MessagePool::GetReservedBufferCount(),
+                     "Reserved buffers were allocated to a non network control message\n");
+
+        VerifyOrQuit((message = messagePool->New(ot::Message::kTypeIp6, 0, ot::Message::kPriorityNet)) != NULL,
+                     "Reserved buffer not available to a network control message\n");
+        message->Free();
+
+        while (numMessages > 0)
+        {
+            messages[--numMessages]->Free();
+        }
+    }
+#endif
+
+    testFreeInstance(instance);
+}
+
+static uint32_t sNow;
+
+static uint32_t TestMessageAlarmGetNow(void)
+{
+    return sNow;
+}
+
+void TestMessageBufferStats(void)
+{
+    ot::Instance *   instance;
+    ot::MessagePool *messagePool;
+    ot::Message *    message;
+    ot::Message *    messages[ot::kNumBuffers + 1];
+    uint16_t         numMessages = 0;
+    uint16_t         allocFailures;
+    uint32_t         lowBufferTime;
+
+    g_testPlatAlarmGetNow = TestMessageAlarmGetNow;
+    sNow                  = 1000;
+
+    instance = static_cast<ot::Instance *>(testInitInstance());
+    VerifyOrQuit(instance != NULL, "Null OpenThread instance\n");
+
+    messagePool   = &instance->GetMessagePool();
+    allocFailures = messagePool->GetAllocFailureCount(ot::Message::kTypeIp6);
+    lowBufferTime = messagePool->GetLowBufferTime();
+
+    // Exhaust the pool.
+
+    while ((message = messagePool->New(ot::Message::kTypeIp6, 0)) != NULL)
+    {
+        VerifyOrQuit(numMessages < ot::kNumBuffers, "Allocated more messages than buffers\n");
+        messages[numMessages++] = message;
+    }
+
+    VerifyOrQuit(messagePool->GetAllocFailureCount(ot::Message::kTypeIp6) == allocFailures + 1,
+                 "MessagePool::GetAllocFailureCount failed\n");
+    VerifyOrQuit(messagePool->GetSubTypeAllocFailureCount(ot::Message::kSubTypeNone) > 0,
+                 "MessagePool::GetSubTypeAllocFailureCount failed\n");
+    VerifyOrQuit(messagePool->GetMaxUsedBufferCount() >= numMessages, "MessagePool::GetMaxUsedBufferCount failed\n");
+
+    sNow += 100;
+    VerifyOrQuit(messagePool->GetLowBufferTime() == lowBufferTime + 100, "MessagePool::GetLowBufferTime failed\n");
+
+    while (numMessages > 0)
+    {
+        messages[--numMessages]->Free();
+    }
+
+    sNow += 100;
+    VerifyOrQuit(messagePool->GetLowBufferTime() == lowBufferTime + 100, "Low buffer time kept increasing\n");
+
+    testFreeInstance(instance);
+
+    g_testPlatAlarmGetNow = NULL;
+}
+
+void TestMessagePrependReallocation(void)
+{
+    ot::Instance *   instance;
+    ot::MessagePool *messagePool;
+    ot::Message *    message;
+    ot::Ip6::Address unicast;
+    ot::Ip6::Address multicast;
+    uint8_t          header[48];
+    uint32_t         reallocations;
+
+    instance = static_cast<ot::Instance *>(testInitInstance());
+    VerifyOrQuit(instance != NULL, "Null OpenThread instance\n");
+
+    messagePool   = &instance->GetMessagePool();
+    reallocations = messagePool->GetPrependReallocationCount();
+
+    // Prepending within the reserved header space is done in place.
+
+    VerifyOrQuit((message = messagePool->New(ot::Message::kTypeIp6, sizeof(header))) != NULL, "Message::New failed\n");
+    SuccessOrQuit(message->SetLength(10), "Message::SetLength failed\n");
+    SuccessOrQuit(message->Prepend(header, sizeof(header)), "Message::Prepend failed\n");
+    VerifyOrQuit(messagePool->GetPrependReallocationCount() == reallocations, "Prepend reallocated unexpectedly\n");
+
+    // Prepending past the reserved header space adds a buffer.
+
+    SuccessOrQuit(message->Prepend(header, 1), "Message::Prepend failed\n");
+    VerifyOrQuit(messagePool->GetPrependReallocationCount() == reallocations + 1, "Prepend reallocation not counted\n");
+    VerifyOrQuit(message->GetLength() == 10 + sizeof(header) + 1, "Message::GetLength failed\n");
+
+    message->Free();
+
+    // Multicast larger than realm-local is tunneled, which needs room for a second IPv6 header.
+
+    SuccessOrQuit(unicast.FromString("fd00::1"), "Address::FromString failed\n");
+    SuccessOrQuit(multicast.FromString("ff05::1"), "Address::FromString failed\n");
+    VerifyOrQuit(ot::Ip6::Ip6::GetHeaderReserve(multicast) >= 2 * ot::Ip6::Ip6::GetHeaderReserve(unicast),
+                 "Ip6::GetHeaderReserve failed\n");
+
+    testFreeInstance(instance);
+}
+
+void TestMessageLifetime(void)
+{
+    ot::Instance *    instance;
+    ot::MessagePool * messagePool;
+    ot::Message *     message;
+    ot::Message *     messageCopy;
+    otMessageSettings settings = {true, OT_MESSAGE_PRIORITY_NORMAL, 500};
+
+    g_testPlatAlarmGetNow = TestMessageAlarmGetNow;
+    sNow                  = 0xfffffe00; // lifetimes wrap around the 32-bit time
+
+    instance = static_cast<ot::Instance *>(testInitInstance());
+    VerifyOrQuit(instance != NULL, "Null OpenThread instance\n");
+
+    messagePool = &instance->GetMessagePool();
+
+    VerifyOrQuit((message = messagePool->New(ot::Message::kTypeIp6, 0)) != NULL, "Message::New failed\n");
+    VerifyOrQuit(!message->IsExpired(sNow + 0x7fffffff), "New message has a lifetime\n");
+    message->Free();
+
+    VerifyOrQuit((message = messagePool->New(ot::Message::kTypeIp6, 0, &settings)) != NULL, "Message::New failed\n");
+    VerifyOrQuit(!message->IsExpired(sNow + 499), "Message expired early\n");
+    VerifyOrQuit(message->IsExpired(sNow + 500), "Message did not expire\n");
+
+    VerifyOrQuit((messageCopy = message->Clone()) != NULL, "Message::Clone failed\n");
+    VerifyOrQuit(!messageCopy->IsExpired(sNow + 499) && messageCopy->IsExpired(sNow + 500),
+                 "Message::Clone did not copy the lifetime\n");
+    messageCopy->Free();
+
+    message->SetLifetime(0);
+    VerifyOrQuit(!message->IsExpired(sNow + 500), "Message::SetLifetime did not clear the lifetime\n");
+    message->Free();
+
+    testFreeInstance(instance);
+
+    g_testPlatAlarmGetNow = NULL;
+}
+
+// Reference (byte at a time) implementation of the 16-bit one's complement sum.
+static uint16_t ReferenceChecksum(uint16_t aChecksum, const uint8_t *aBuf, uint16_t aLength)
+{
+    for (uint16_t i = 0; i < aLength; i++)
+    {
+        aChecksum = ot::Message::UpdateChecksum(aChecksum, (i & 1) ? aBuf[i] : static_cast<uint16_t>(aBuf[i] << 8));
+    }
+
+    return aChecksum;
+}
+
+void TestMessageChecksum(void)
+{
+    ot::Instance *   instance;
+    ot::MessagePool *messagePool;
+    ot::Message *    message;
+    uint8_t          buffer[1024 + sizeof(uint32_t)];
+
+    instance = static_cast<ot::Instance *>(testInitInstance());
+    VerifyOrQuit(instance != NULL, "Null OpenThread instance\n");
+
+    messagePool = &instance->GetMessagePool();
+
+    for (unsigned i = 0; i < sizeof(buffer); i++)
+    {
+        buffer[i] = static_cast<uint8_t>(random());
+    }
+
+    // Different lengths, alignments and initial values (including all ones to exercise carry folding).
+
+    for (uint16_t length = 0; length < 300; length++)
+    {
+        for (uint8_t align = 0; align < sizeof(uint32_t); align++)
+        {
+            uint16_t initial = (length & 1) ? 0xffff : static_cast<uint16_t>(random());
+
+            VerifyOrQuit(ot::Message::UpdateChecksum(initial, buffer + align, length) ==
+                             ReferenceChecksum(initial, buffer + align, length),
+                         "Message::UpdateChecksum does not match reference\n");
+        }
+    }
+
+    memset(buffer, 0xff, 40);
+    VerifyOrQuit(ot::Message::UpdateChecksum(0xffff, buffer, 40) == ReferenceChecksum(0xffff, buffer, 40),
+                 "Message::UpdateChecksum does not match reference for all ones\n");
+
+    // Checksum over a message (spanning multiple buffers).
+
+    VerifyOrQuit((message = messagePool->New(ot::Message::kTypeIp6, 0)) != NULL, "Message::New failed\n");
+    SuccessOrQuit(message->Append(buffer, 1024), "Message::Append failed\n");
+
+    for (uint16_t offset = 0; offset < 1024; offset += 97)
+    {
+        VerifyOrQuit(message->UpdateChecksum(0x1234, offset, 1024 - offset) ==
+                         ReferenceChecksum(0x1234, buffer + offset, 1024 - offset),
+                     "Message::UpdateChecksum over message does not match reference\n");
+    }
+
+    message->Free();
+
+    testFreeInstance(instance);
+}
+
+void TestMessageLargeBuffers(void)
+{
+#if OPENTHREAD_CONFIG_NUM_MESSAGE_LARGE_BUFFERS
+    ot::Instance *   instance;
+    ot::MessagePool *messagePool;
+    ot::Message *    message;
+    ot::Message *    smallMessage;
+    uint8_t          writeBuffer[1024];
+    uint8_t          readBuffer[1024];
+    uint16_t         numFreeBuffers;
+    uint16_t         numFreeLargeBuffers;
+
+    instance = static_cast<ot::Instance *>(testInitInstance());
+    VerifyOrQuit(instance != NULL, "Null OpenThread instance\n");
+
+    messagePool         = &instance->GetMessagePool();
+    numFreeBuffers      = messagePool->GetFreeBufferCount();
+    numFreeLargeBuffers = messagePool->GetFreeLargeBufferCount();
+
+    for (unsigned i = 0; i < sizeof(writeBuffer); i++)
+    {
+        writeBuffer[i] = static_cast<uint8_t>(random());
+    }
+
+    // A small message should only use standard buffers.
+
+    VerifyOrQuit((smallMessage = messagePool->New(ot::Message::kTypeIp6, 0)) != NULL, "Message::New failed\n");
+    SuccessOrQuit(smallMessage->SetLength(10), "Message::SetLength failed\n");
+    VerifyOrQuit(messagePool->GetFreeLargeBufferCount() == numFreeLargeBuffers, "Large buffer used unexpectedly\n");
+
+    // A large message should use large buffers (and fewer buffers in total).
+
+    VerifyOrQuit((message = messagePool->New(ot::Message::kTypeIp6, 0)) != NULL, "Message::New failed\n");
+    SuccessOrQuit(message->SetLength(sizeof(writeBuffer)), "Message::SetLength failed\n");
+    VerifyOrQuit(messagePool->GetFreeLargeBufferCount() < numFreeLargeBuffers, "Large buffer not used\n");
+    VerifyOrQuit(message->GetBufferCount() < (sizeof(writeBuffer) / ot::kBufferSize), "Too many buffers used\n");
+
+    VerifyOrQuit(message->Write(0, sizeof(writeBuffer), writeBuffer) == sizeof(writeBuffer), "Message::Write failed\n");
+    VerifyOrQuit(message->Read(0, sizeof(readBuffer), readBuffer) == sizeof(readBuffer), "Message::Read failed\n");
+    VerifyOrQuit(memcmp(writeBuffer, readBuffer, sizeof(writeBuffer)) == 0, "Message compare failed\n");
+
+    // Read at different offsets (crossing buffer boundaries).
+
+    for (uint16_t offset = 0; offset < sizeof(writeBuffer); offset += 37)
+    {
+        uint16_t length = sizeof(writeBuffer) - offset;
+
+        memset(readBuffer, 0, sizeof(readBuffer));
+        VerifyOrQuit(message->Read(offset, length, readBuffer) == length, "Message::Read failed\n");
+        VerifyOrQuit(memcmp(writeBuffer + offset, readBuffer, length) == 0, "Message compare failed\n");
+    }
+
+    // Prepend a header and verify content.
+
+    SuccessOrQuit(message->Prepend(writeBuffer, 200), "Message::Prepend failed\n");
+    VerifyOrQuit(message->GetLength() == sizeof(writeBuffer) + 200, "Message::GetLength failed\n");
+    VerifyOrQuit(message->Read(200, sizeof(readBuffer), readBuffer) == sizeof(readBuffer), "Message::Read failed\n");
+    VerifyOrQuit(memcmp(writeBuffer, readBuffer, sizeof(writeBuffer)) == 0, "Message compare failed\n");
+    VerifyOrQuit(message->Read(0, 200, readBuffer) == 200, "Message::Read failed\n");
+    VerifyOrQuit(memcmp(writeBuffer, readBuffer, 200) == 0, "Message compare failed\n");
+
+    // Shrink the message and verify large buffers are freed.
+
+    SuccessOrQuit(message->SetLength(10), "Message::SetLength failed\n");
+    VerifyOrQuit(messagePool->GetFreeLargeBufferCount() == numFreeLargeBuffers, "Large buffers not freed\n");
+
+    message->Free();
+    smallMessage->Free();
+
+    VerifyOrQuit(messagePool->GetFreeBufferCount() == numFreeBuffers, "Buffers not freed\n");
+    VerifyOrQuit(messagePool->GetFreeLargeBufferCount() == numFreeLargeBuffers, "Large buffers not freed\n");
+
+    testFreeInstance(instance);
+#endif // OPENTHREAD_CONFIG_NUM_MESSAGE_LARGE_BUFFERS
+}
+
+void TestMessageSharedBuffers(void)
+{
+#if OPENTHREAD_CONFIG_ENABLE_SHARED_MESSAGE_BUFFERS
+    ot::Instance *   instance;
+    ot::MessagePool *messagePool;
+    ot::Message *    message;
+    ot::Message *    clone;
+    uint8_t          writeBuffer[1024];
+    uint8_t          readBuffer[1024];
+    uint16_t         numFreeBuffers;
+    uint16_t         numUsedBuffers;
+
+    instance = static_cast<ot::Instance *>(testInitInstance());
+    VerifyOrQuit(instance != NULL, "Null OpenThread instance\n");
+
+    messagePool    = &instance->GetMessagePool();
+    numFreeBuffers = messagePool->GetFreeBufferCount();
+
+    for (unsigned i = 0; i < sizeof(writeBuffer); i++)
+    {
+        writeBuffer[i] = static_cast<uint8_t>(random());
+    }
+
+    VerifyOrQuit((message = messagePool->New(ot::Message::kTypeIp6, 0)) != NULL, "Message::New failed\n");
+    SuccessOrQuit(message->Append(writeBuffer, sizeof(writeBuffer)), "Message::Append failed\n");
+    numUsedBuffers = numFreeBuffers - messagePool->GetFreeBufferCount();
+
+    // A clone should only allocate a head buffer.
+
+    VerifyOrQuit((clone = message->Clone()) != NULL, "Message::Clone failed\n");
+    VerifyOrQuit(messagePool->GetFreeBufferCount() == numFreeBuffers - numUsedBuffers - 1, "Clone copied buffers\n");
+    VerifyOrQuit(clone->GetLength() == sizeof(writeBuffer), "Message::GetLength failed\n");
+    VerifyOrQuit(clone->Read(0, sizeof(readBuffer), readBuffer) == sizeof(readBuffer), "Message::Read failed\n");
+    VerifyOrQuit(memcmp(writeBuffer, readBuffer, sizeof(writeBuffer)) == 0, "Message compare failed\n");
+
+    // Writing to the clone should not change the original message.
+
+    memset(readBuffer, 0, sizeof(readBuffer));
+    VerifyOrQuit(clone->Write(sizeof(writeBuffer) - 10, 10, readBuffer) == 10, "Message::Write failed\n");
+    VerifyOrQuit(message->Read(0, sizeof(readBuffer), readBuffer) == sizeof(readBuffer), "Message::Read failed\n");
+    VerifyOrQuit(memcmp(writeBuffer, readBuffer, sizeof(writeBuffer)) == 0, "Original message modified\n");
+    VerifyOrQuit(clone->Read(0, sizeof(readBuffer), readBuffer) == sizeof(readBuffer), "Message::Read failed\n");
+    VerifyOrQuit(memcmp(writeBuffer, readBuffer, sizeof(writeBuffer) - 10) == 0, "Message compare failed\n");
+
+    // Shrinking the original message and freeing it should keep the clone content.
+
+    SuccessOrQuit(message->SetLength(10), "Message::SetLength failed\n");
+    message->Free();
+
+    VerifyOrQuit(clone->Read(0, sizeof(readBuffer), readBuffer) == sizeof(readBuffer), "Message::Read failed\n");
+    VerifyOrQuit(memcmp(writeBuffer, readBuffer, sizeof(writeBuffer) - 10) == 0, "Message compare failed\n");
+    VerifyOrQuit(messagePool->GetFreeBufferCount() == numFreeBuffers - numUsedBuffers, "Buffers not freed\n");
+
+    clone->Free();
+
+    VerifyOrQuit(messagePool->GetFreeBufferCount() == numFreeBuffers, "Buffers not freed\n");
+
+    testFreeInstance(instance);
+#endif // OPENTHREAD_CONFIG_ENABLE_SHARED_MESSAGE_BUFFERS
+}
+
 #ifdef ENABLE_TEST_MAIN
 int main(void)
 {
     TestMessage();
+    TestMessageChunks();
+    TestMessageChecksum();
+    TestMessageBufferClasses();
+    TestMessageBufferStats();
+    TestMessagePrependReallocation();
+    TestMessageLifetime();
+    TestMessageLargeBuffers();
+    TestMessageSharedBuffers();
     printf("All tests passed\n");
     return 0;
 }
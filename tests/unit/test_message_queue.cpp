@@ -170,6 +170,26 @@ void TestMessageQueue(void)
                   "MessageQueue::Enqueue() failed.\n");
     VerifyMessageQueueContent(messageQueue, 4, msg[1], msg[0], msg[3], msg[2]);
 
+    // Add before a message in middle
+    SuccessOrQuit(messageQueue.EnqueueBefore(*msg[4], *msg[3]), "MessageQueue::EnqueueBefore() failed.\n");
+    VerifyMessageQueueContent(messageQueue, 5, msg[1], msg[0], msg[4], msg[3], msg[2]);
+
+    // Check the failure case: add before a message which is not in the queue
+    SuccessOrQuit(messageQueue.Dequeue(*msg[4]), "MessageQueue::Dequeue() failed.\n");
+    error = messageQueue.EnqueueBefore(*msg[4], *msg[4]);
+    VerifyOrQuit(error == OT_ERROR_NOT_FOUND, "EnqueueBefore() a message not in the queue did not fail as expected.\n");
+
+    // Add before head
+    SuccessOrQuit(messageQueue.EnqueueBefore(*msg[4], *msg[1]), "MessageQueue::EnqueueBefore() failed.\n");
+    VerifyMessageQueueContent(messageQueue, 5, msg[4], msg[1], msg[0], msg[3], msg[2]);
+
+    // Add before tail
+    SuccessOrQuit(messageQueue.Dequeue(*msg[4]), "MessageQueue::Dequeue() failed.\n");
+    SuccessOrQuit(messageQueue.EnqueueBefore(*msg[4], *msg[2]), "MessageQueue::EnqueueBefore() failed.\n");
+    VerifyMessageQueueContent(messageQueue, 5, msg[1], msg[0], msg[3], msg[4], msg[2]);
+    SuccessOrQuit(messageQueue.Dequeue(*msg[4]), "MessageQueue::Dequeue() failed.\n");
+    VerifyMessageQueueContent(messageQueue, 4, msg[1], msg[0], msg[3], msg[2]);
+
     // Remove all messages.
     SuccessOrQuit(messageQueue.Dequeue(*msg[3]), "MessageQueue::Dequeue() failed.\n");
     VerifyMessageQueueContent(messageQueue, 3, msg[1], msg[0], msg[2]);
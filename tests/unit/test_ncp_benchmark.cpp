@@ -0,0 +1,447 @@
+/*
+ *  Copyright (c) 2018, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "common/code_utils.hpp"
+#include "common/instance.hpp"
+#include "ncp/hdlc.hpp"
+#include "ncp/ncp_base.hpp"
+#include "ncp/ncp_buffer.hpp"
+#include "ncp/spinel.h"
+
+#include "test_platform.h"
+#include "test_util.h"
+
+namespace ot {
+namespace Ncp {
+
+// This module benchmarks the NCP host interface path: `NcpFrameBuffer`, HDLC encoding/decoding and `NcpBase`
+// command dispatch over a loopback HDLC shim. It reports throughput and per-command latency; it does not
+// verify correctness (see `test_ncp_buffer.cpp` for that).
+
+enum
+{
+    kDefaultIterations = 20000,
+    kMaxFrameSize      = 1300,
+    kMaxFrameSizes     = 8,
+    kMaxProperties     = 16,
+    kBufferSize        = 2048,
+    kHdlcBufferSize    = 2 * kMaxFrameSize + 8, // Worst case: every byte escaped, plus flags and FCS.
+};
+
+static const uint16_t sDefaultFrameSizes[] = {16, 64, 127, 512, 1280};
+
+static const spinel_prop_key_t sDefaultProperties[] = {
+    SPINEL_PROP_PROTOCOL_VERSION,
+    SPINEL_PROP_NCP_VERSION,
+    SPINEL_PROP_CAPS,
+    SPINEL_PROP_HWADDR,
+    SPINEL_PROP_PHY_CHAN,
+    SPINEL_PROP_NET_ROLE,
+    SPINEL_PROP_IPV6_ADDRESS_TABLE,
+    SPINEL_PROP_MSG_BUFFER_COUNTERS,
+};
+
+static uint8_t sPayload[kMaxFrameSize];
+
+static uint64_t GetNowUsec(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return static_cast<uint64_t>(now.tv_sec) * 1000000 + static_cast<uint64_t>(now.tv_nsec) / 1000;
+}
+
+static void PrintThroughput(const char *aName, uint16_t aFrameSize, uint32_t aFrames, uint64_t aBytes, uint64_t aUsec)
+{
+    double seconds = (aUsec > 0) ? aUsec / 1000000.0 : 1e-6;
+
+    printf("%-24s %5u %12.0f %14.0f %10.3f\n", aName, aFrameSize, aFrames / seconds, aBytes / seconds,
+           static_cast<double>(aUsec) / aFrames);
+}
+
+/**
+ * This class implements an HDLC write iterator over a flat buffer.
+ *
+ */
+class HdlcBuffer : public Hdlc::Encoder::BufferWriteIterator
+{
+public:
+    HdlcBuffer(void) { Clear(); }
+
+    void Clear(void)
+    {
+        mWritePointer    = mBuffer;
+        mRemainingLength = sizeof(mBuffer);
+    }
+
+    const uint8_t *GetBuffer(void) const { return mBuffer; }
+    uint16_t       GetLength(void) const { return static_cast<uint16_t>(mWritePointer - mBuffer); }
+
+private:
+    uint8_t mBuffer[kHdlcBufferSize];
+};
+
+/**
+ * This class implements a loopback NCP: host frames are HDLC encoded and fed through the NCP frame decoder, and
+ * every frame the NCP queues is read from its TX buffer and HDLC encoded as the UART/SPI framer would.
+ *
+ */
+class LoopbackNcp : public NcpBase
+{
+public:
+    explicit LoopbackNcp(Instance *aInstance)
+        : NcpBase(aInstance)
+        , mFrameDecoder(mRxBuffer, sizeof(mRxBuffer), &LoopbackNcp::HandleFrame, &LoopbackNcp::HandleError, this)
+        , mTxFrames(0)
+        , mTxBytes(0)
+    {
+    }
+
+    void SendToNcp(const uint8_t *aFrame, uint16_t aLength)
+    {
+        Hdlc::Encoder encoder;
+
+        mHostBuffer.Clear();
+        SuccessOrQuit(encoder.Init(mHostBuffer), "Hdlc::Encoder::Init() failed");
+        SuccessOrQuit(encoder.Encode(aFrame, aLength, mHostBuffer), "Hdlc::Encoder::Encode() failed");
+        SuccessOrQuit(encoder.Finalize(mHostBuffer), "Hdlc::Encoder::Finalize() failed");
+
+        mFrameDecoder.Decode(mHostBuffer.GetBuffer(), mHostBuffer.GetLength());
+    }
+
+    void DrainTxBuffer(void)
+    {
+        while (!mTxFrameBuffer.IsEmpty())
+        {
+            Hdlc::Encoder  encoder;
+            const uint8_t *chunk;
+            uint16_t       chunkLength;
+
+            mUartBuffer.Clear();
+            SuccessOrQuit(mTxFrameBuffer.OutFrameBegin(), "OutFrameBegin() failed");
+            SuccessOrQuit(encoder.Init(mUartBuffer), "Hdlc::Encoder::Init() failed");
+
+            while ((chunkLength = mTxFrameBuffer.OutFrameReadChunk(kMaxFrameSize, chunk)) > 0)
+            {
+                SuccessOrQuit(encoder.Encode(chunk, chunkLength, mUartBuffer), "Hdlc::Encoder::Encode() failed");
+            }
+
+            SuccessOrQuit(encoder.Finalize(mUartBuffer), "Hdlc::Encoder::Finalize() failed");
+            SuccessOrQuit(mTxFrameBuffer.OutFrameRemove(), "OutFrameRemove() failed");
+
+            mTxFrames++;
+            mTxBytes += mUartBuffer.GetLength();
+        }
+    }
+
+    uint32_t GetTxFrames(void) const { return mTxFrames; }
+    uint64_t GetTxBytes(void) const { return mTxBytes; }
+
+private:
+    static void HandleFrame(void *aContext, uint8_t *aBuf, uint16_t aBufLength)
+    {
+        static_cast<LoopbackNcp *>(aContext)->HandleReceive(aBuf, aBufLength);
+    }
+
+    static void HandleError(void *aContext, otError aError, uint8_t *aBuf, uint16_t aBufLength)
+    {
+        OT_UNUSED_VARIABLE(aContext);
+        OT_UNUSED_VARIABLE(aBuf);
+        OT_UNUSED_VARIABLE(aBufLength);
+
+        SuccessOrQuit(aError, "Hdlc::Decoder reported an error");
+    }
+
+    Hdlc::Decoder mFrameDecoder;
+    HdlcBuffer    mHostBuffer;
+    HdlcBuffer    mUartBuffer;
+    uint8_t       mRxBuffer[kMaxFrameSize];
+    uint32_t      mTxFrames;
+    uint64_t      mTxBytes;
+};
+
+void BenchmarkNcpFrameBuffer(uint16_t aFrameSize, uint32_t aIterations)
+{
+    uint8_t        buffer[kBufferSize];
+    NcpFrameBuffer ncpBuffer(buffer, sizeof(buffer));
+    uint64_t       bytes = 0;
+    uint64_t       start = GetNowUsec();
+
+    for (uint32_t i = 0; i < aIterations; i++)
+    {
+        const uint8_t *chunk;
+        uint16_t       chunkLength;
+
+        SuccessOrQuit(ncpBuffer.InFrameBegin(NcpFrameBuffer::kPriorityLow), "InFrameBegin() failed");
+        SuccessOrQuit(ncpBuffer.InFrameFeedData(sPayload, aFrameSize), "InFrameFeedData() failed");
+        SuccessOrQuit(ncpBuffer.InFrameEnd(), "InFrameEnd() failed");
+
+        SuccessOrQuit(ncpBuffer.OutFrameBegin(), "OutFrameBegin() failed");
+
+        while ((chunkLength = ncpBuffer.OutFrameReadChunk(aFrameSize, chunk)) > 0)
+        {
+            bytes += chunkLength;
+        }
+
+        SuccessOrQuit(ncpBuffer.OutFrameRemove(), "OutFrameRemove() failed");
+    }
+
+    PrintThroughput("NcpFrameBuffer", aFrameSize, aIterations, bytes, GetNowUsec() - start);
+}
+
+static void HandleDecodedFrame(void *aContext, uint8_t *aFrame, uint16_t aFrameLength)
+{
+    OT_UNUSED_VARIABLE(aFrame);
+
+    *static_cast<uint64_t *>(aContext) += aFrameLength;
+}
+
+static void HandleDecoderError(void *aContext, otError aError, uint8_t *aFrame, uint16_t aFrameLength)
+{
+    OT_UNUSED_VARIABLE(aContext);
+    OT_UNUSED_VARIABLE(aFrame);
+    OT_UNUSED_VARIABLE(aFrameLength);
+
+    SuccessOrQuit(aError, "Hdlc::Decoder reported an error");
+}
+
+void BenchmarkHdlc(uint16_t aFrameSize, uint32_t aIterations)
+{
+    HdlcBuffer    hdlcBuffer;
+    uint8_t       decodeBuffer[kMaxFrameSize];
+    uint64_t      decodedBytes = 0;
+    Hdlc::Decoder decoder(decodeBuffer, sizeof(decodeBuffer), HandleDecodedFrame, HandleDecoderError, &decodedBytes);
+    uint64_t      encodedBytes = 0;
+    uint64_t      start;
+    uint64_t      encodeUsec = 0;
+    uint64_t      decodeUsec = 0;
+
+    for (uint32_t i = 0; i < aIterations; i++)
+    {
+        Hdlc::Encoder encoder;
+
+        start = GetNowUsec();
+        hdlcBuffer.Clear();
+        SuccessOrQuit(encoder.Init(hdlcBuffer), "Hdlc::Encoder::Init() failed");
+        SuccessOrQuit(encoder.Encode(sPayload, aFrameSize, hdlcBuffer), "Hdlc::Encoder::Encode() failed");
+        SuccessOrQuit(encoder.Finalize(hdlcBuffer), "Hdlc::Encoder::Finalize() failed");
+        encodedBytes += hdlcBuffer.GetLength();
+        encodeUsec += GetNowUsec() - start;
+
+        start = GetNowUsec();
+        decoder.Decode(hdlcBuffer.GetBuffer(), hdlcBuffer.GetLength());
+        decodeUsec += GetNowUsec() - start;
+    }
+
+    VerifyOrQuit(decodedBytes == static_cast<uint64_t>(aFrameSize) * aIterations, "Hdlc::Decoder lost frames");
+
+    PrintThroughput("Hdlc::Encoder", aFrameSize, aIterations, encodedBytes, encodeUsec);
+    PrintThroughput("Hdlc::Decoder", aFrameSize, aIterations, encodedBytes, decodeUsec);
+}
+
+void BenchmarkNcpDispatch(LoopbackNcp &            aNcp,
+                          const spinel_prop_key_t *aProperties,
+                          uint8_t                  aNumProperties,
+                          uint32_t                 aIterations)
+{
+    uint64_t totalUsec   = 0;
+    uint32_t totalFrames = aNcp.GetTxFrames();
+    uint64_t totalBytes  = aNcp.GetTxBytes();
+
+    printf("\n%-32s %10s %10s %10s\n", "Command (PROP_VALUE_GET)", "avg-us", "max-us", "resp-bytes");
+
+    for (uint8_t index = 0; index < aNumProperties; index++)
+    {
+        uint8_t  frame[16];
+        uint8_t  tid     = 1;
+        uint64_t usec    = 0;
+        uint64_t maxUsec = 0;
+        uint64_t bytes   = aNcp.GetTxBytes();
+        char     name[33];
+
+        for (uint32_t i = 0; i < aIterations; i++)
+        {
+            spinel_ssize_t length;
+            uint64_t       start;
+            uint64_t       duration;
+
+            length = spinel_datatype_pack(frame, sizeof(frame), "Cii", SPINEL_HEADER_FLAG | tid,
+                                          SPINEL_CMD_PROP_VALUE_GET, aProperties[index]);
+            VerifyOrQuit(length > 0, "spinel_datatype_pack() failed");
+
+            start = GetNowUsec();
+            aNcp.SendToNcp(frame, static_cast<uint16_t>(length));
+            aNcp.DrainTxBuffer();
+            duration = GetNowUsec() - start;
+
+            usec += duration;
+            maxUsec = (duration > maxUsec) ? duration : maxUsec;
+            tid     = SPINEL_GET_NEXT_TID(tid);
+        }
+
+        totalUsec += usec;
+
+        snprintf(name, sizeof(name), "%s", spinel_prop_key_to_cstr(aProperties[index]));
+        printf("%-32s %10.3f %10u %10.1f\n", name, static_cast<double>(usec) / aIterations,
+               static_cast<unsigned int>(maxUsec), static_cast<double>(aNcp.GetTxBytes() - bytes) / aIterations);
+    }
+
+    totalFrames = aNcp.GetTxFrames() - totalFrames;
+    totalBytes  = aNcp.GetTxBytes() - totalBytes;
+
+    printf("\n%-24s %5s %12s %14s %10s\n", "Path", "size", "frames/s", "bytes/s", "us/frame");
+    PrintThroughput("NcpBase dispatch", 0, totalFrames, totalBytes, totalUsec);
+}
+
+static uint8_t ParseList(const char *aString, uint16_t *aValues, uint8_t aMaxValues)
+{
+    uint8_t count = 0;
+    char *  end;
+
+    while ((*aString != '\0') && (count < aMaxValues))
+    {
+        aValues[count++] = static_cast<uint16_t>(strtoul(aString, &end, 0));
+        aString          = (*end == ',') ? end + 1 : end;
+
+        if (end == aString)
+        {
+            break;
+        }
+    }
+
+    return count;
+}
+
+void RunNcpBenchmark(int aArgc, char *aArgv[])
+{
+    uint32_t          iterations = kDefaultIterations;
+    uint16_t          frameSizes[kMaxFrameSizes];
+    uint8_t           numFrameSizes = 0;
+    uint16_t          properties[kMaxProperties];
+    spinel_prop_key_t propertyKeys[kMaxProperties];
+    uint8_t           numProperties = 0;
+    Instance *        instance;
+    LoopbackNcp *     ncp;
+    int               option;
+
+    while ((option = getopt(aArgc, aArgv, "n:s:p:")) != -1)
+    {
+        switch (option)
+        {
+        case 'n':
+            iterations = static_cast<uint32_t>(strtoul(optarg, NULL, 0));
+            break;
+
+        case 's':
+            numFrameSizes = ParseList(optarg, frameSizes, kMaxFrameSizes);
+            break;
+
+        case 'p':
+            numProperties = ParseList(optarg, properties, kMaxProperties);
+            break;
+
+        default:
+            fprintf(stderr, "Usage: %s [-n iterations] [-s frame-size,...] [-p spinel-prop-id,...]\n", aArgv[0]);
+            exit(1);
+        }
+    }
+
+    if (numFrameSizes == 0)
+    {
+        for (; numFrameSizes < OT_ARRAY_LENGTH(sDefaultFrameSizes); numFrameSizes++)
+        {
+            frameSizes[numFrameSizes] = sDefaultFrameSizes[numFrameSizes];
+        }
+    }
+
+    if (numProperties == 0)
+    {
+        for (; numProperties < OT_ARRAY_LENGTH(sDefaultProperties); numProperties++)
+        {
+            propertyKeys[numProperties] = sDefaultProperties[numProperties];
+        }
+    }
+    else
+    {
+        for (uint8_t index = 0; index < numProperties; index++)
+        {
+            propertyKeys[index] = static_cast<spinel_prop_key_t>(properties[index]);
+        }
+    }
+
+    VerifyOrQuit(iterations > 0, "Invalid number of iterations");
+
+    for (uint16_t i = 0; i < sizeof(sPayload); i++)
+    {
+        // Include HDLC flag and escape bytes so that escaping cost is part of the measurement.
+        sPayload[i] = static_cast<uint8_t>(i * 13);
+    }
+
+    printf("NCP host interface benchmark, %u iterations\n\n", static_cast<unsigned int>(iterations));
+    printf("%-24s %5s %12s %14s %10s\n", "Path", "size", "frames/s", "bytes/s", "us/frame");
+
+    for (uint8_t index = 0; index < numFrameSizes; index++)
+    {
+        VerifyOrQuit(frameSizes[index] > 0 && frameSizes[index] <= kMaxFrameSize, "Invalid frame size");
+
+        BenchmarkNcpFrameBuffer(frameSizes[index], iterations);
+        BenchmarkHdlc(frameSizes[index], iterations);
+    }
+
+    instance = testInitInstance();
+    VerifyOrQuit(instance != NULL, "Null OpenThread instance");
+
+    ncp = new LoopbackNcp(instance);
+
+    // Flush the initial unsolicited updates (e.g., RESET status) before measuring.
+    otTaskletsProcess(instance);
+    ncp->DrainTxBuffer();
+
+    BenchmarkNcpDispatch(*ncp, propertyKeys, numProperties, iterations);
+
+    delete ncp;
+    testFreeInstance(instance);
+}
+
+} // namespace Ncp
+} // namespace ot
+
+#ifdef ENABLE_TEST_MAIN
+int main(int argc, char *argv[])
+{
+    ot::Ncp::RunNcpBenchmark(argc, argv);
+    return 0;
+}
+#endif
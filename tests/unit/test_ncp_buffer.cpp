@@ -898,6 +898,55 @@ void TestNcpFrameBuffer(void)
 
     printf(" -- PASS\n");
 
+    printf("\n- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -");
+    printf("\n Test 16: Read frame with a multi-buffer message using OutFrameReadChunk()");
+
+    for (j = 0; j < 2; j++)
+    {
+        NcpFrameBuffer::Priority priority = (j == 0) ? NcpFrameBuffer::kPriorityLow : NcpFrameBuffer::kPriorityHigh;
+        const uint8_t *          chunk;
+        uint16_t                 chunkLen;
+        uint8_t                  expected[sizeof(sHelloText) + 20 * sizeof(sHexText)];
+
+        message = sMessagePool->New(Message::kTypeIp6, 0);
+        VerifyOrQuit(message != NULL, "Null Message");
+
+        for (i = 0; i < 20; i++)
+        {
+            SuccessOrQuit(message->Append(sHexText, sizeof(sHexText)), "Message::Append() failed.");
+            memcpy(expected + sizeof(sHelloText) + i * sizeof(sHexText), sHexText, sizeof(sHexText));
+        }
+
+        memcpy(expected, sHelloText, sizeof(sHelloText));
+
+        SuccessOrQuit(ncpBuffer.InFrameBegin(priority), "InFrameBegin() failed.");
+        SuccessOrQuit(ncpBuffer.InFrameFeedData(sHelloText, sizeof(sHelloText)), "InFrameFeedData() failed.");
+        SuccessOrQuit(ncpBuffer.InFrameFeedMessage(message), "InFrameFeedMessage() failed.");
+        SuccessOrQuit(ncpBuffer.InFrameEnd(), "InFrameEnd() failed.");
+
+        SuccessOrQuit(ncpBuffer.OutFrameBegin(), "OutFrameBegin() failed.");
+        VerifyOrQuit(ncpBuffer.OutFrameGetLength() == sizeof(expected), "OutFrameGetLength() is incorrect.");
+
+        readOffset = 0;
+
+        while ((chunkLen = ncpBuffer.OutFrameReadChunk(sizeof(expected), chunk)) != 0)
+        {
+            VerifyOrQuit(readOffset + chunkLen <= sizeof(expected), "OutFrameReadChunk() read beyond frame end.");
+            VerifyOrQuit(memcmp(chunk, expected + readOffset, chunkLen) == 0,
+                         "OutFrameReadChunk() does not match expected content.");
+            readOffset += chunkLen;
+        }
+
+        VerifyOrQuit(readOffset == sizeof(expected), "OutFrameReadChunk() read length is incorrect.");
+        VerifyOrQuit(ncpBuffer.OutFrameHasEnded(), "OutFrameHasEnded() is incorrect after reading whole frame.");
+
+        SuccessOrQuit(ncpBuffer.OutFrameBegin(), "OutFrameBegin() failed.");
+        ReadAndVerifyContent(ncpBuffer, expected, sizeof(expected));
+        SuccessOrQuit(ncpBuffer.OutFrameRemove(), "OutFrameRemove() failed.");
+    }
+
+    printf(" -- PASS\n");
+
     testFreeInstance(sInstance);
 }
 
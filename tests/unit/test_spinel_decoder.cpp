@@ -679,6 +679,42 @@ void TestSpinelDecoder(void)
     VerifyOrQuit(decoder.ReadUint8(u8) == OT_ERROR_PARSE, "ReadUint8() did not fail");
 
     printf(" -- PASS\n");
+
+    printf("\n- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -");
+    printf("\nTest 11: Test `ReadArray()` in a struct with trailing partial item");
+
+    {
+        const spinel_eui64_t *eui64Array;
+        uint16_t              count;
+
+        frameLen = spinel_datatype_pack(buffer, sizeof(buffer),
+                                        (SPINEL_DATATYPE_STRUCT_S(SPINEL_DATATYPE_EUI64_S SPINEL_DATATYPE_EUI64_S
+                                                                      SPINEL_DATATYPE_UINT8_S) SPINEL_DATATYPE_UINT8_S),
+                                        &kEui64, &kEui64, kUint8, kUint8);
+
+        DumpBuffer("Packed Spinel Frame", buffer, static_cast<uint16_t>(frameLen));
+
+        decoder.Init(buffer, static_cast<uint16_t>(frameLen));
+
+        SuccessOrQuit(decoder.OpenStruct(), "OpenStruct() failed.");
+        {
+            SuccessOrQuit(decoder.ReadArray(eui64Array, count), "ReadArray() failed.");
+            VerifyOrQuit(count == 2, "ReadArray() count is incorrect.");
+            VerifyOrQuit(memcmp(&eui64Array[0], &kEui64, sizeof(spinel_eui64_t)) == 0, "ReadArray() parse failed.");
+            VerifyOrQuit(memcmp(&eui64Array[1], &kEui64, sizeof(spinel_eui64_t)) == 0, "ReadArray() parse failed.");
+            VerifyOrQuit(decoder.GetRemainingLengthInStruct() == sizeof(uint8_t), "ReadArray() read too much.");
+
+            SuccessOrQuit(decoder.ReadArray(eui64Array, count), "ReadArray() failed.");
+            VerifyOrQuit(count == 0, "ReadArray() count is incorrect.");
+        }
+        SuccessOrQuit(decoder.CloseStruct(), "CloseStruct() failed.");
+
+        SuccessOrQuit(decoder.ReadUint8(u8), "ReadUint8() failed.");
+        VerifyOrQuit(u8 == kUint8, "ReadUint8() parse failed.");
+        VerifyOrQuit(decoder.IsAllRead() == true, "IsAllRead() failed.");
+    }
+
+    printf(" -- PASS\n");
 }
 
 } // namespace Ncp
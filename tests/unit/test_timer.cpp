@@ -559,11 +559,275 @@ int TestTenTimers(void)
     return 0;
 }
 
+static ot::Instance *sInstance;
+
+/**
+ * `OrderTestTimer` sub-classes `ot::TimerMilli` and records the order in which the timers get fired.
+ *
+ * The timers are created in an array, so they use the instance from `sInstance`.
+ */
+class OrderTestTimer : public ot::TimerMilli
+{
+public:
+    OrderTestTimer(void)
+        : ot::TimerMilli(*sInstance, OrderTestTimer::HandleTimerFired, NULL)
+        , mIndex(0)
+    {
+    }
+
+    void SetIndex(uint16_t aIndex) { mIndex = aIndex; }
+
+    static void HandleTimerFired(ot::Timer &aTimer) { static_cast<OrderTestTimer &>(aTimer).HandleTimerFired(); }
+
+    void HandleTimerFired(void)
+    {
+        sCallCount[kCallCountIndexTimerHandler]++;
+        sFireOrder[sFireCount++] = mIndex;
+    }
+
+    enum
+    {
+        kMaxTimers = 64,
+    };
+
+    static uint16_t sFireOrder[kMaxTimers];
+    static uint16_t sFireCount;
+
+private:
+    uint16_t mIndex;
+};
+
+uint16_t OrderTestTimer::sFireOrder[OrderTestTimer::kMaxTimers];
+uint16_t OrderTestTimer::sFireCount;
+
+/**
+ * Test that many timers (with same and different fire times, some restarted or stopped) fire in the expected order.
+ */
+int TestTimerFireOrder(void)
+{
+    const uint16_t kNumTimers = OrderTestTimer::kMaxTimers;
+    const uint32_t kTimeT0    = 0U - 5000U;
+    ot::Instance * instance   = (sInstance = testInitInstance());
+    OrderTestTimer timers[kNumTimers];
+    uint32_t       interval[kNumTimers];
+    bool           stopped[kNumTimers];
+    uint32_t       seed       = 1;
+    uint16_t       numStopped = 0;
+
+    printf("TestTimerFireOrder() ");
+
+    InitTestTimer();
+    InitCounters();
+    OrderTestTimer::sFireCount = 0;
+
+    sNow = kTimeT0;
+
+    for (uint16_t i = 0; i < kNumTimers; i++)
+    {
+        // Use a simple linear congruential generator to get a mix of short and long intervals (with duplicates).
+        seed        = seed * 1103515245U + 12345U;
+        interval[i] = ((seed >> 16) % 7 == 0) ? (50000 + (seed >> 16) % 3) : ((seed >> 16) % 2000);
+        stopped[i]  = false;
+
+        timers[i].SetIndex(i);
+        timers[i].Start(interval[i]);
+    }
+
+    // Restart every fifth timer (which moves it after timers with the same fire time) and stop every seventh.
+
+    for (uint16_t i = 0; i < kNumTimers; i += 5)
+    {
+        timers[i].Start(interval[i]);
+    }
+
+    for (uint16_t i = 3; i < kNumTimers; i += 7)
+    {
+        timers[i].Stop();
+        stopped[i] = true;
+        numStopped++;
+    }
+
+    while (sTimerOn)
+    {
+        sNow = sPlatT0 + sPlatDt;
+        otPlatAlarmMilliFired(instance);
+    }
+
+    VerifyOrQuit(OrderTestTimer::sFireCount == kNumTimers - numStopped, "TestTimerFireOrder: Fire count failed.\n");
+
+    for (uint16_t i = 0; i < kNumTimers; i++)
+    {
+        VerifyOrQuit(!timers[i].IsRunning(), "TestTimerFireOrder: Timer running failed.\n");
+    }
+
+    for (uint16_t i = 0; i < OrderTestTimer::sFireCount; i++)
+    {
+        uint16_t cur = OrderTestTimer::sFireOrder[i];
+
+        VerifyOrQuit(!stopped[cur], "TestTimerFireOrder: Stopped timer fired.\n");
+
+        if (i > 0)
+        {
+            uint16_t prev = OrderTestTimer::sFireOrder[i - 1];
+
+            VerifyOrQuit(interval[prev] <= interval[cur], "TestTimerFireOrder: Fire order failed.\n");
+
+            // Timers with the same fire time must fire in the order they were (re)started.
+            if (interval[prev] == interval[cur])
+            {
+                bool prevRestarted = ((prev % 5) == 0);
+                bool curRestarted  = ((cur % 5) == 0);
+
+                VerifyOrQuit((prevRestarted == curRestarted) ? (prev < cur) : curRestarted,
+                             "TestTimerFireOrder: Fire order of same fire time failed.\n");
+            }
+        }
+    }
+
+    printf("--> PASSED\n");
+
+    testFreeInstance(instance);
+
+    return 0;
+}
+
+#if OPENTHREAD_CONFIG_ENABLE_TIMER_SLACK
+/**
+ * Test that timers started with slack are coalesced into a single alarm.
+ */
+int TestTimerSlack(void)
+{
+    const uint32_t kTimeT0  = 1000;
+    ot::Instance * instance = testInitInstance();
+    TestTimer      timer1(*instance);
+    TestTimer      timer2(*instance);
+    TestTimer      timer3(*instance);
+
+    printf("TestTimerSlack() ");
+
+    InitTestTimer();
+    InitCounters();
+
+    sNow = kTimeT0;
+
+    // timer1 fires within [1100, 1150], timer2 within [1120, 1130] and timer3 (no slack) at 1500.
+
+    timer1.StartWithSlack(100, 50);
+    VerifyOrQuit(sPlatT0 == kTimeT0 && sPlatDt == 150, "TestTimerSlack: Start params Failed.\n");
+
+    timer2.StartWithSlack(120, 10);
+    VerifyOrQuit(sPlatDt == 130, "TestTimerSlack: Coalesced alarm Failed.\n");
+
+    timer3.Start(500);
+    VerifyOrQuit(sPlatDt == 130, "TestTimerSlack: Coalesced alarm Failed.\n");
+    VerifyOrQuit(sCallCount[kCallCountIndexAlarmStart] == 2, "TestTimerSlack: Start CallCount Failed.\n");
+    VerifyOrQuit(instance->GetTimerMilliScheduler().GetAlarmStartCount() == 2,
+                 "TestTimerSlack: GetAlarmStartCount() Failed.\n");
+
+    // Both timer1 and timer2 should be handled on the same alarm.
+
+    sNow = kTimeT0 + 130;
+
+    do
+    {
+        otPlatAlarmMilliFired(instance);
+    } while (sPlatDt == 0);
+
+    VerifyOrQuit(timer1.GetFiredCounter() == 1 && timer2.GetFiredCounter() == 1,
+                 "TestTimerSlack: Timer fired counter Failed.\n");
+    VerifyOrQuit(timer3.IsRunning() && timer3.GetFiredCounter() == 0, "TestTimerSlack: Timer fired counter Failed.\n");
+    VerifyOrQuit(sPlatT0 + sPlatDt == kTimeT0 + 500, "TestTimerSlack: Start params Failed.\n");
+
+    // A timer without slack must not be delayed by a timer with slack.
+
+    timer1.StartWithSlack(100, 1000);
+    VerifyOrQuit(sPlatT0 + sPlatDt == kTimeT0 + 500, "TestTimerSlack: Start params Failed.\n");
+
+    sNow = kTimeT0 + 500;
+
+    do
+    {
+        otPlatAlarmMilliFired(instance);
+    } while (sTimerOn && sPlatDt == 0);
+
+    VerifyOrQuit(timer1.GetFiredCounter() == 2 && timer3.GetFiredCounter() == 1,
+                 "TestTimerSlack: Timer fired counter Failed.\n");
+    VerifyOrQuit(!timer1.IsRunning() && !timer2.IsRunning() && !timer3.IsRunning(),
+                 "TestTimerSlack: Timer running Failed.\n");
+
+    printf("--> PASSED\n");
+
+    testFreeInstance(instance);
+
+    return 0;
+}
+#endif // OPENTHREAD_CONFIG_ENABLE_TIMER_SLACK
+
+/**
+ * Test that the scheduler reports the time remaining until the next timer fires.
+ */
+int TestTimerRemainingTime(void)
+{
+    const uint32_t           kTimeT0   = 0U - 10U;
+    ot::Instance *           instance  = testInitInstance();
+    ot::TimerMilliScheduler &scheduler = instance->GetTimerMilliScheduler();
+    TestTimer                timer1(*instance);
+    TestTimer                timer2(*instance);
+    uint32_t                 remaining;
+
+    printf("TestTimerRemainingTime() ");
+
+    InitTestTimer();
+    InitCounters();
+
+    sNow = kTimeT0;
+
+    VerifyOrQuit(scheduler.GetRemainingTime(remaining) == OT_ERROR_NOT_FOUND,
+                 "TestTimerRemainingTime: No timer Failed.\n");
+
+    timer1.Start(100);
+    timer2.Start(40);
+    SuccessOrQuit(scheduler.GetRemainingTime(remaining), "TestTimerRemainingTime: GetRemainingTime() Failed.\n");
+    VerifyOrQuit(remaining == 40, "TestTimerRemainingTime: Remaining time Failed.\n");
+
+    // The remaining time is computed across the wrap of the time counter.
+
+    sNow += 30;
+    SuccessOrQuit(scheduler.GetRemainingTime(remaining), "TestTimerRemainingTime: GetRemainingTime() Failed.\n");
+    VerifyOrQuit(remaining == 10, "TestTimerRemainingTime: Remaining time Failed.\n");
+
+    // A timer that is already due reports zero.
+
+    sNow += 20;
+    SuccessOrQuit(scheduler.GetRemainingTime(remaining), "TestTimerRemainingTime: GetRemainingTime() Failed.\n");
+    VerifyOrQuit(remaining == 0, "TestTimerRemainingTime: Due timer Failed.\n");
+
+    otPlatAlarmMilliFired(instance);
+    VerifyOrQuit(timer2.GetFiredCounter() == 1, "TestTimerRemainingTime: Timer fired counter Failed.\n");
+    SuccessOrQuit(scheduler.GetRemainingTime(remaining), "TestTimerRemainingTime: GetRemainingTime() Failed.\n");
+    VerifyOrQuit(remaining == 50, "TestTimerRemainingTime: Remaining time Failed.\n");
+
+    timer1.Stop();
+    VerifyOrQuit(scheduler.GetRemainingTime(remaining) == OT_ERROR_NOT_FOUND,
+                 "TestTimerRemainingTime: No timer Failed.\n");
+
+    printf("--> PASSED\n");
+
+    testFreeInstance(instance);
+
+    return 0;
+}
+
 void RunTimerTests(void)
 {
     TestOneTimer();
     TestTwoTimers();
     TestTenTimers();
+    TestTimerFireOrder();
+#if OPENTHREAD_CONFIG_ENABLE_TIMER_SLACK
+    TestTimerSlack();
+#endif
+    TestTimerRemainingTime();
 }
 
 #ifdef ENABLE_TEST_MAIN
@@ -0,0 +1,135 @@
+/*
+ *  Copyright (c) 2016, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "common/debug.hpp"
+#include "common/instance.hpp"
+#include "common/message.hpp"
+#include "common/tlvs.hpp"
+
+#include "test_platform.h"
+#include "test_util.h"
+
+static void VerifyTlvIndex(const ot::Message &aMessage)
+{
+    ot::TlvIndex index(aMessage);
+
+    for (unsigned type = 0; type <= 0xff; type++)
+    {
+        uint16_t expectedOffset = 0;
+        uint16_t expectedLength = 0;
+        uint16_t offset         = 0;
+        uint16_t length         = 0;
+        otError  expectedError;
+
+        expectedError = ot::Tlv::GetOffset(aMessage, static_cast<uint8_t>(type), expectedOffset);
+        VerifyOrQuit(index.GetOffset(static_cast<uint8_t>(type), offset) == expectedError,
+                     "TlvIndex::GetOffset result differs from Tlv::GetOffset\n");
+        VerifyOrQuit(expectedError != OT_ERROR_NONE || offset == expectedOffset,
+                     "TlvIndex::GetOffset offset differs from Tlv::GetOffset\n");
+
+        expectedError = ot::Tlv::GetValueOffset(aMessage, static_cast<uint8_t>(type), expectedOffset, expectedLength);
+        VerifyOrQuit(index.GetValueOffset(static_cast<uint8_t>(type), offset, length) == expectedError,
+                     "TlvIndex::GetValueOffset result differs from Tlv::GetValueOffset\n");
+        VerifyOrQuit(expectedError != OT_ERROR_NONE || (offset == expectedOffset && length == expectedLength),
+                     "TlvIndex::GetValueOffset differs from Tlv::GetValueOffset\n");
+    }
+}
+
+void TestTlvIndex(void)
+{
+    ot::Instance *   instance;
+    ot::MessagePool *messagePool;
+    ot::Message *    message;
+    ot::ExtendedTlv  extendedTlv;
+    uint8_t          extendedValue[300];
+    const uint8_t    kHeader[]  = {0xaa, 0xbb, 0xcc};
+    const uint8_t    kTlvs[]    = {1, 2, 0x11, 0x22, 0, 0, 7, 1, 0x33, 1, 1, 0x44, 40, 1, 0x55, 252, 0};
+    const uint8_t    kTrailer[] = {9, 1, 0x66, 12, 5, 0x77}; // the last TLV claims more bytes than remain
+    ot::Tlv          tlv;
+
+    instance = static_cast<ot::Instance *>(testInitInstance());
+    VerifyOrQuit(instance != NULL, "Null OpenThread instance\n");
+
+    messagePool = &instance->GetMessagePool();
+
+    VerifyOrQuit((message = messagePool->New(ot::Message::kTypeIp6, 0)) != NULL, "Message::New failed\n");
+    SuccessOrQuit(message->Append(kHeader, sizeof(kHeader)), "Message::Append failed\n");
+    message->SetOffset(sizeof(kHeader));
+
+    // An empty message has no TLVs.
+    VerifyTlvIndex(*message);
+
+    SuccessOrQuit(message->Append(kTlvs, sizeof(kTlvs)), "Message::Append failed\n");
+
+    memset(extendedValue, 0x5a, sizeof(extendedValue));
+    extendedTlv.SetType(3);
+    extendedTlv.SetLength(sizeof(extendedValue));
+    SuccessOrQuit(message->Append(&extendedTlv, sizeof(extendedTlv)), "Message::Append failed\n");
+    SuccessOrQuit(message->Append(extendedValue, sizeof(extendedValue)), "Message::Append failed\n");
+
+    VerifyTlvIndex(*message);
+
+    SuccessOrQuit(message->Append(kTrailer, sizeof(kTrailer)), "Message::Append failed\n");
+
+    VerifyTlvIndex(*message);
+
+    {
+        ot::TlvIndex index(*message);
+        uint16_t     offset;
+        uint16_t     length;
+
+        // The first of two TLVs with the same type is found.
+        SuccessOrQuit(index.Get(1, sizeof(tlv), tlv), "TlvIndex::Get failed\n");
+        SuccessOrQuit(index.GetOffset(1, offset), "TlvIndex::GetOffset failed\n");
+        VerifyOrQuit(offset == sizeof(kHeader), "TlvIndex::GetOffset returned the wrong TLV\n");
+
+        SuccessOrQuit(index.GetValueOffset(3, offset, length), "TlvIndex::GetValueOffset failed\n");
+        VerifyOrQuit(length == sizeof(extendedValue), "TlvIndex::GetValueOffset extended length is wrong\n");
+
+        // Types beyond the index are still found.
+        SuccessOrQuit(index.GetOffset(252, offset), "TlvIndex::GetOffset failed for a non-indexed type\n");
+
+        // TLVs following a malformed TLV are not found.
+        SuccessOrQuit(index.GetOffset(9, offset), "TlvIndex::GetOffset failed\n");
+        VerifyOrQuit(index.GetOffset(12, offset) == OT_ERROR_NOT_FOUND, "TlvIndex found a truncated TLV\n");
+        VerifyOrQuit(index.GetOffset(5, offset) == OT_ERROR_NOT_FOUND, "TlvIndex found a missing TLV\n");
+    }
+
+    message->Free();
+
+    testFreeInstance(instance);
+}
+
+#ifdef ENABLE_TEST_MAIN
+int main(void)
+{
+    TestTlvIndex();
+    printf("All tests passed\n");
+    return 0;
+}
+#endif
@@ -144,10 +144,35 @@ __inline void mbedtls_platform_zeroize( void *buf, size_t len)
 #define MBEDTLS_MPI_WINDOW_SIZE            1 /**< Maximum windows size used. */
 #define MBEDTLS_MPI_MAX_SIZE              32 /**< Maximum number of bytes for usable MPIs. */
 #define MBEDTLS_ECP_MAX_BITS             256 /**< Maximum bit size of groups */
-#define MBEDTLS_ECP_WINDOW_SIZE            2 /**< Maximum window size used */
-#define MBEDTLS_ECP_FIXED_POINT_OPTIM      0 /**< Enable fixed-point speed-up */
 #define MBEDTLS_ENTROPY_MAX_SOURCES        1 /**< Maximum number of sources supported */
 
+/*
+ * The comb table precomputed for the P-256 generator is kept in the group for the lifetime of the EC-JPAKE or
+ * ECDSA context, so every subsequent multiplication by the generator skips the precomputation step. With the
+ * default window size the table holds only two points; platforms with more heap may raise the window size
+ * (up to 7) to trade memory for faster scalar multiplication.
+ */
+#ifndef MBEDTLS_ECP_WINDOW_SIZE
+#define MBEDTLS_ECP_WINDOW_SIZE            2 /**< Maximum window size used */
+#endif
+#ifndef MBEDTLS_ECP_FIXED_POINT_OPTIM
+#define MBEDTLS_ECP_FIXED_POINT_OPTIM      1 /**< Enable fixed-point speed-up */
+#endif
+
+/*
+ * Platforms with a public-key accelerator plug it in through the mbedTLS ECP alternate-implementation hooks by
+ * defining them in the file named by MBEDTLS_USER_CONFIG_FILE, e.g.:
+ *
+ *   #define MBEDTLS_ECP_INTERNAL_ALT
+ *   #define MBEDTLS_ECP_ADD_MIXED_ALT
+ *   #define MBEDTLS_ECP_DOUBLE_JAC_ALT
+ *   #define MBEDTLS_ECP_NORMALIZE_JAC_ALT
+ *
+ * and providing the matching mbedtls_internal_ecp_*() functions declared in "mbedtls/ecp_internal.h". The
+ * accelerator is only used for groups where mbedtls_internal_ecp_grp_capable() returns non-zero, all other
+ * groups fall back to the software implementation.
+ */
+
 #if OPENTHREAD_ENABLE_MULTIPLE_INSTANCES
 #define MBEDTLS_PLATFORM_STD_CALLOC      otPlatCAlloc /**< Default allocator to use, can be undefined */
 #define MBEDTLS_PLATFORM_STD_FREE        otPlatFree /**< Default free to use, can be undefined */
@@ -0,0 +1,213 @@
+#!/usr/bin/env python
+#
+# Copyright (c) 2018, The OpenThread Authors.
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+# 1. Redistributions of source code must retain the above copyright
+#    notice, this list of conditions and the following disclaimer.
+# 2. Redistributions in binary form must reproduce the above copyright
+#    notice, this list of conditions and the following disclaimer in the
+#    documentation and/or other materials provided with the distribution.
+# 3. Neither the name of the copyright holder nor the
+#    names of its contributors may be used to endorse or promote products
+#    derived from this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+# ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+# LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+# CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+# SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+# INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+# CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+# ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+# POSSIBILITY OF SUCH DAMAGE.
+
+"""
+Builds the token table for NCP tokenized logging and decodes tokenized logs.
+
+With `OPENTHREAD_CONFIG_NCP_ENABLE_TOKENIZED_LOG`, NCP sends logs via
+`SPINEL_PROP_STREAM_LOG_TOKENIZED` as the FNV-1a hash of the format string
+followed by the raw argument values. The format strings remain in the NCP
+firmware image, so the table is generated from the image after it is built:
+
+    spinel_log_tokens.py table ot-ncp-ftd > ot-ncp-ftd.tokens.json
+
+A property value (hex encoded) is then decoded with:
+
+    spinel_log_tokens.py decode ot-ncp-ftd.tokens.json <hex-value>...
+"""
+
+import argparse
+import json
+import re
+import struct
+import sys
+
+FNV_OFFSET_BASIS = 2166136261
+FNV_PRIME = 16777619
+
+# Null-terminated printable strings in the firmware image.
+STRING_PATTERN = re.compile(b'([\\x20-\\x7e\\t\\r\\n]{2,})\\x00')
+
+# Conversions in a printf-style format string.
+CONVERSION_PATTERN = re.compile(r'%([-+ #0]*)(\*|\d*)(?:\.(\*|\d*))?(hh|h|ll|l|j|z|t|L)?([diuoxXcpsneEfFgGaA%])')
+
+
+def get_token(format_string):
+    token = FNV_OFFSET_BASIS
+
+    for byte in bytearray(format_string):
+        token = ((token ^ byte) * FNV_PRIME) & 0xffffffff
+
+    return token
+
+
+def build_table(image):
+    table = {}
+
+    for match in STRING_PATTERN.finditer(image):
+        string = match.group(1)
+        token = '%08x' % get_token(string)
+        previous = table.setdefault(token, string.decode('ascii'))
+
+        if previous != string.decode('ascii'):
+            sys.stderr.write('warning: token collision %s: "%s" and "%s"\n' % (token, previous, string))
+
+    return table
+
+
+class Reader(object):
+
+    def __init__(self, data):
+        self.data = bytearray(data)
+        self.index = 0
+
+    def read_uint8(self):
+        value = self.data[self.index]
+        self.index += 1
+        return value
+
+    def read_uint32(self):
+        value, = struct.unpack_from('<I', bytes(self.data), self.index)
+        self.index += 4
+        return value
+
+    def read_uint64(self):
+        value, = struct.unpack_from('<Q', bytes(self.data), self.index)
+        self.index += 8
+        return value
+
+    def read_uint_packed(self):
+        value = 0
+        shift = 0
+
+        while True:
+            byte = self.read_uint8()
+            value |= (byte & 0x7f) << shift
+            shift += 7
+
+            if byte & 0x80 == 0:
+                return value
+
+    def read_utf8(self):
+        end = self.data.index(0, self.index)
+        value = bytes(self.data[self.index:end]).decode('utf-8', 'replace')
+        self.index = end + 1
+        return value
+
+
+def to_signed(value, bits):
+    if value & (1 << (bits - 1)):
+        value -= 1 << bits
+
+    return value
+
+
+def decode_log(table, value):
+    reader = Reader(value)
+    token = '%08x' % reader.read_uint32()
+    level = reader.read_uint8()
+    region = reader.read_uint_packed()
+
+    if token not in table:
+        return level, region, '<unknown log token %s>' % token
+
+    def convert(match):
+        flags, width, precision, length, conversion = match.groups()
+
+        if conversion == '%':
+            return '%'
+
+        if width == '*':
+            width = str(to_signed(reader.read_uint_packed(), 32))
+
+        if precision == '*':
+            precision = str(to_signed(reader.read_uint_packed(), 32))
+
+        spec = '%' + flags + (width or '') + ('.' + precision if precision is not None else '')
+
+        if conversion == 'n':
+            return ''
+
+        if conversion == 's':
+            return (spec + 's') % reader.read_utf8()
+
+        if conversion in 'eEfFgGaA':
+            return (spec + conversion.replace('a', 'e').replace('A', 'E')) % struct.unpack(
+                '<d', struct.pack('<Q', reader.read_uint64()))[0]
+
+        if length in ('ll', 'j'):
+            value, bits = reader.read_uint64(), 64
+        else:
+            value, bits = reader.read_uint_packed(), 32
+
+        if conversion == 'p':
+            return (spec + 's') % ('0x%x' % value)
+
+        if conversion == 'c':
+            return (spec + 'c') % chr(value & 0xff)
+
+        if conversion in 'di':
+            value = to_signed(value, bits)
+            conversion = 'd'
+
+        return (spec + conversion.replace('u', 'd')) % value
+
+    return level, region, CONVERSION_PATTERN.sub(convert, table[token])
+
+
+def main():
+    parser = argparse.ArgumentParser(description='NCP tokenized log tool')
+    commands = parser.add_subparsers(dest='command')
+
+    table_parser = commands.add_parser('table', help='generate token table from NCP firmware image')
+    table_parser.add_argument('image', help='NCP firmware image (ELF or binary)')
+
+    decode_parser = commands.add_parser('decode', help='decode STREAM_LOG_TOKENIZED property values')
+    decode_parser.add_argument('table', help='token table generated by the "table" command')
+    decode_parser.add_argument('values', nargs='+', help='hex encoded property values')
+
+    args = parser.parse_args()
+
+    if args.command == 'table':
+        with open(args.image, 'rb') as image:
+            json.dump(build_table(image.read()), sys.stdout, indent=1, sort_keys=True)
+
+    elif args.command == 'decode':
+        with open(args.table) as table_file:
+            table = json.load(table_file)
+
+        for value in args.values:
+            level, region, log = decode_log(table, bytearray.fromhex(value))
+            print('[%d:%d] %s' % (level, region, log))
+
+    else:
+        parser.print_help()
+
+
+if __name__ == '__main__':
+    main()